@@ -0,0 +1,1006 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntccfg_bind.h>
+#include <ntccfg_platform.h>
+#include <ntcd_benchmarkutil.h>
+#include <ntcf_system.h>
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+// This application measures the throughput and latency of echoing messages
+// over the loopback interface through stream and datagram sockets, for each
+// driver supported on the current platform. The message size, the number of
+// connections, and the number of I/O threads are swept over the cartesian
+// product of the values given on the command line. Each client connection
+// sends one message at a time and waits for its echo before sending the next,
+// so the latency of each message is its round-trip time.
+//
+// The results of each run are written to standard output as one JSON object
+// per line, suitable for collection and comparison between releases.
+//
+// Usage:
+//
+//     ntcbench [--driver <name>[,<name>...]]
+//              [--socket stream|datagram[,...]]
+//              [--size <bytes>[,<bytes>...]]
+//              [--connections <count>[,<count>...]]
+//              [--threads <count>[,<count>...]]
+//              [--messages <count>]
+//              [--timeout <seconds>]
+//
+// If no driver is specified, every driver supported on the current platform
+// is measured.
+
+namespace benchmark {
+
+/// Describe the parameters of a benchmark run.
+struct Parameters {
+    bsl::string d_driverName;
+    bool        d_datagram;
+    bsl::size_t d_messageSize;
+    bsl::size_t d_numConnections;
+    bsl::size_t d_numThreads;
+    bsl::size_t d_numMessages;
+    bsl::size_t d_timeout;
+
+    Parameters()
+    : d_driverName()
+    , d_datagram(false)
+    , d_messageSize(64)
+    , d_numConnections(1)
+    , d_numThreads(1)
+    , d_numMessages(10000)
+    , d_timeout(60)
+    {
+    }
+};
+
+/// Describe the result of a benchmark run.
+struct Result {
+    ntsa::Error                       d_error;
+    bool                              d_timedOut;
+    double                            d_elapsed;
+    bsl::size_t                       d_numMessages;
+    bsl::vector<bsls::Types::Int64>   d_latency;
+
+    Result()
+    : d_error()
+    , d_timedOut(false)
+    , d_elapsed(0)
+    , d_numMessages(0)
+    , d_latency()
+    {
+    }
+};
+
+/// Provide a stream socket that echoes each message it receives.
+class StreamEchoSession
+{
+    bsl::shared_ptr<ntci::StreamSocket> d_streamSocket_sp;
+    bsl::size_t                         d_messageSize;
+
+  private:
+    StreamEchoSession(const StreamEchoSession&) BSLS_KEYWORD_DELETED;
+    StreamEchoSession& operator=(const StreamEchoSession&)
+        BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Process the receipt of the specified 'data' according to the
+    /// specified 'event'.
+    void processReceive(const bsl::shared_ptr<ntci::Receiver>& receiver,
+                        const bsl::shared_ptr<bdlbb::Blob>&    data,
+                        const ntca::ReceiveEvent&              event)
+    {
+        NTCCFG_WARNING_UNUSED(receiver);
+
+        if (event.type() == ntca::ReceiveEventType::e_ERROR) {
+            return;
+        }
+
+        ntsa::Error error =
+            d_streamSocket_sp->send(*data, ntca::SendOptions());
+        if (error) {
+            return;
+        }
+
+        this->receive();
+    }
+
+  public:
+    /// Create a new session echoing messages of the specified 'messageSize'
+    /// received by the specified 'streamSocket'.
+    StreamEchoSession(const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+                      bsl::size_t                                messageSize)
+    : d_streamSocket_sp(streamSocket)
+    , d_messageSize(messageSize)
+    {
+    }
+
+    /// Receive the next message.
+    void receive()
+    {
+        ntca::ReceiveOptions options;
+        options.setMinSize(d_messageSize);
+        options.setMaxSize(d_messageSize);
+
+        d_streamSocket_sp->receive(
+            options,
+            NTCCFG_BIND(&StreamEchoSession::processReceive,
+                        this,
+                        NTCCFG_BIND_PLACEHOLDER_1,
+                        NTCCFG_BIND_PLACEHOLDER_2,
+                        NTCCFG_BIND_PLACEHOLDER_3));
+    }
+
+    /// Close the socket and block until it is closed.
+    void close()
+    {
+        ntci::StreamSocketCloseGuard guard(d_streamSocket_sp);
+    }
+};
+
+/// Provide a stream socket that sends messages one at a time and measures the
+/// round-trip time of each.
+class StreamClientSession
+{
+    bsl::shared_ptr<ntci::StreamSocket> d_streamSocket_sp;
+    bdlbb::Blob                         d_message;
+    bsl::size_t                         d_messageSize;
+    bsl::size_t                         d_numMessagesLeft;
+    bsls::Types::Int64                  d_sendTime;
+    bsl::vector<bsls::Types::Int64>     d_latency;
+    ntcd::BenchmarkCountdown*           d_connected_p;
+    ntcd::BenchmarkCountdown*           d_complete_p;
+
+  private:
+    StreamClientSession(const StreamClientSession&) BSLS_KEYWORD_DELETED;
+    StreamClientSession& operator=(const StreamClientSession&)
+        BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Process the completion of the connection according to the specified
+    /// 'event'.
+    void processConnect(const bsl::shared_ptr<ntci::Connector>& connector,
+                        const ntca::ConnectEvent&               event)
+    {
+        NTCCFG_WARNING_UNUSED(connector);
+
+        if (event.type() == ntca::ConnectEventType::e_COMPLETE) {
+            d_connected_p->arrive();
+        }
+    }
+
+    /// Process the receipt of the specified 'data' according to the
+    /// specified 'event'.
+    void processReceive(const bsl::shared_ptr<ntci::Receiver>& receiver,
+                        const bsl::shared_ptr<bdlbb::Blob>&    data,
+                        const ntca::ReceiveEvent&              event)
+    {
+        NTCCFG_WARNING_UNUSED(receiver);
+        NTCCFG_WARNING_UNUSED(data);
+
+        if (event.type() == ntca::ReceiveEventType::e_ERROR) {
+            return;
+        }
+
+        d_latency.push_back(bsls::TimeUtil::getTimer() - d_sendTime);
+
+        if (d_numMessagesLeft == 0) {
+            d_complete_p->arrive();
+            return;
+        }
+
+        this->send();
+    }
+
+  public:
+    /// Create a new session for the specified 'streamSocket' that sends
+    /// the specified 'numMessages' each of the specified 'messageSize'.
+    /// Arrive at the specified 'connected' countdown when the connection
+    /// is established and at the specified 'complete' countdown once each
+    /// message has been echoed.
+    StreamClientSession(
+        const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+        bsl::size_t                                messageSize,
+        bsl::size_t                                numMessages,
+        ntcd::BenchmarkCountdown*                  connected,
+        ntcd::BenchmarkCountdown*                  complete)
+    : d_streamSocket_sp(streamSocket)
+    , d_message(streamSocket->outgoingBlobBufferFactory().get())
+    , d_messageSize(messageSize)
+    , d_numMessagesLeft(numMessages)
+    , d_sendTime(0)
+    , d_latency()
+    , d_connected_p(connected)
+    , d_complete_p(complete)
+    {
+        d_latency.reserve(numMessages);
+
+        d_message.setLength(static_cast<int>(messageSize));
+        for (int i = 0; i < d_message.numDataBuffers(); ++i) {
+            bsl::memset(d_message.buffer(i).data(),
+                        'X',
+                        d_message.buffer(i).size());
+        }
+    }
+
+    /// Connect to the specified 'endpoint'. Return the error.
+    ntsa::Error connect(const ntsa::Endpoint& endpoint)
+    {
+        return d_streamSocket_sp->connect(
+            endpoint,
+            ntca::ConnectOptions(),
+            NTCCFG_BIND(&StreamClientSession::processConnect,
+                        this,
+                        NTCCFG_BIND_PLACEHOLDER_1,
+                        NTCCFG_BIND_PLACEHOLDER_2));
+    }
+
+    /// Send the next message and receive its echo.
+    void send()
+    {
+        --d_numMessagesLeft;
+        d_sendTime = bsls::TimeUtil::getTimer();
+
+        d_streamSocket_sp->send(d_message, ntca::SendOptions());
+
+        ntca::ReceiveOptions options;
+        options.setMinSize(d_messageSize);
+        options.setMaxSize(d_messageSize);
+
+        d_streamSocket_sp->receive(
+            options,
+            NTCCFG_BIND(&StreamClientSession::processReceive,
+                        this,
+                        NTCCFG_BIND_PLACEHOLDER_1,
+                        NTCCFG_BIND_PLACEHOLDER_2,
+                        NTCCFG_BIND_PLACEHOLDER_3));
+    }
+
+    /// Close the socket and block until it is closed.
+    void close()
+    {
+        ntci::StreamSocketCloseGuard guard(d_streamSocket_sp);
+    }
+
+    /// Return the round-trip time of each message echoed, in nanoseconds.
+    const bsl::vector<bsls::Types::Int64>& latency() const
+    {
+        return d_latency;
+    }
+};
+
+/// Provide a stream socket server that accepts connections and echoes each
+/// message received from each connection.
+class StreamEchoServer
+{
+    bsl::shared_ptr<ntci::ListenerSocket>            d_listenerSocket_sp;
+    bslmt::Mutex                                     d_mutex;
+    bsl::vector<bsl::shared_ptr<StreamEchoSession> > d_sessions;
+    bsl::size_t                                      d_messageSize;
+    bsl::size_t                                      d_numAcceptsLeft;
+    ntcd::BenchmarkCountdown*                        d_accepted_p;
+
+  private:
+    StreamEchoServer(const StreamEchoServer&) BSLS_KEYWORD_DELETED;
+    StreamEchoServer& operator=(const StreamEchoServer&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Process the acceptance of the specified 'streamSocket' according to
+    /// the specified 'event'.
+    void processAccept(const bsl::shared_ptr<ntci::Acceptor>&     acceptor,
+                       const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+                       const ntca::AcceptEvent&                   event)
+    {
+        NTCCFG_WARNING_UNUSED(acceptor);
+
+        if (event.type() == ntca::AcceptEventType::e_ERROR) {
+            return;
+        }
+
+        bsl::shared_ptr<StreamEchoSession> session;
+        session.createInplace(bslma::Default::allocator(),
+                              streamSocket,
+                              d_messageSize);
+
+        bool more = false;
+        {
+            bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+            d_sessions.push_back(session);
+            more = --d_numAcceptsLeft > 0;
+        }
+
+        session->receive();
+        d_accepted_p->arrive();
+
+        if (more) {
+            this->accept();
+        }
+    }
+
+  public:
+    /// Create a new server for the specified 'listenerSocket' that accepts
+    /// the specified 'numConnections' and echoes messages of the specified
+    /// 'messageSize'. Arrive at the specified 'accepted' countdown as each
+    /// connection is accepted.
+    StreamEchoServer(
+        const bsl::shared_ptr<ntci::ListenerSocket>& listenerSocket,
+        bsl::size_t                                  messageSize,
+        bsl::size_t                                  numConnections,
+        ntcd::BenchmarkCountdown*                    accepted)
+    : d_listenerSocket_sp(listenerSocket)
+    , d_mutex()
+    , d_sessions()
+    , d_messageSize(messageSize)
+    , d_numAcceptsLeft(numConnections)
+    , d_accepted_p(accepted)
+    {
+    }
+
+    /// Accept the next connection.
+    void accept()
+    {
+        d_listenerSocket_sp->accept(
+            ntca::AcceptOptions(),
+            NTCCFG_BIND(&StreamEchoServer::processAccept,
+                        this,
+                        NTCCFG_BIND_PLACEHOLDER_1,
+                        NTCCFG_BIND_PLACEHOLDER_2,
+                        NTCCFG_BIND_PLACEHOLDER_3));
+    }
+
+    /// Close the listener socket and each accepted socket and block until
+    /// they are closed.
+    void close()
+    {
+        {
+            ntci::ListenerSocketCloseGuard guard(d_listenerSocket_sp);
+        }
+
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        for (bsl::size_t i = 0; i < d_sessions.size(); ++i) {
+            d_sessions[i]->close();
+        }
+    }
+};
+
+/// Provide a datagram socket that echoes each datagram it receives to its
+/// sender.
+class DatagramEchoServer
+{
+    bsl::shared_ptr<ntci::DatagramSocket> d_datagramSocket_sp;
+
+  private:
+    DatagramEchoServer(const DatagramEchoServer&) BSLS_KEYWORD_DELETED;
+    DatagramEchoServer& operator=(const DatagramEchoServer&)
+        BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Process the receipt of the specified 'data' according to the
+    /// specified 'event'.
+    void processReceive(const bsl::shared_ptr<ntci::Receiver>& receiver,
+                        const bsl::shared_ptr<bdlbb::Blob>&    data,
+                        const ntca::ReceiveEvent&              event)
+    {
+        NTCCFG_WARNING_UNUSED(receiver);
+
+        if (event.type() == ntca::ReceiveEventType::e_ERROR) {
+            return;
+        }
+
+        if (!event.context().endpoint().isNull()) {
+            ntca::SendOptions options;
+            options.setEndpoint(event.context().endpoint().value());
+
+            d_datagramSocket_sp->send(*data, options);
+        }
+
+        this->receive();
+    }
+
+  public:
+    /// Create a new server for the specified 'datagramSocket'.
+    explicit DatagramEchoServer(
+        const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket)
+    : d_datagramSocket_sp(datagramSocket)
+    {
+    }
+
+    /// Receive the next datagram.
+    void receive()
+    {
+        d_datagramSocket_sp->receive(
+            ntca::ReceiveOptions(),
+            NTCCFG_BIND(&DatagramEchoServer::processReceive,
+                        this,
+                        NTCCFG_BIND_PLACEHOLDER_1,
+                        NTCCFG_BIND_PLACEHOLDER_2,
+                        NTCCFG_BIND_PLACEHOLDER_3));
+    }
+
+    /// Return the endpoint to which the socket is bound.
+    ntsa::Endpoint sourceEndpoint() const
+    {
+        return d_datagramSocket_sp->sourceEndpoint();
+    }
+
+    /// Close the socket and block until it is closed.
+    void close()
+    {
+        ntci::DatagramSocketCloseGuard guard(d_datagramSocket_sp);
+    }
+};
+
+/// Provide a datagram socket that sends datagrams one at a time and measures
+/// the round-trip time of each.
+class DatagramClientSession
+{
+    bsl::shared_ptr<ntci::DatagramSocket> d_datagramSocket_sp;
+    ntsa::Endpoint                        d_remoteEndpoint;
+    bdlbb::Blob                           d_message;
+    bsl::size_t                           d_numMessagesLeft;
+    bsls::Types::Int64                    d_sendTime;
+    bsl::vector<bsls::Types::Int64>       d_latency;
+    ntcd::BenchmarkCountdown*             d_complete_p;
+
+  private:
+    DatagramClientSession(const DatagramClientSession&) BSLS_KEYWORD_DELETED;
+    DatagramClientSession& operator=(const DatagramClientSession&)
+        BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Process the receipt of the specified 'data' according to the
+    /// specified 'event'.
+    void processReceive(const bsl::shared_ptr<ntci::Receiver>& receiver,
+                        const bsl::shared_ptr<bdlbb::Blob>&    data,
+                        const ntca::ReceiveEvent&              event)
+    {
+        NTCCFG_WARNING_UNUSED(receiver);
+        NTCCFG_WARNING_UNUSED(data);
+
+        if (event.type() == ntca::ReceiveEventType::e_ERROR) {
+            return;
+        }
+
+        d_latency.push_back(bsls::TimeUtil::getTimer() - d_sendTime);
+
+        if (d_numMessagesLeft == 0) {
+            d_complete_p->arrive();
+            return;
+        }
+
+        this->send();
+    }
+
+  public:
+    /// Create a new session for the specified 'datagramSocket' that sends
+    /// the specified 'numMessages' each of the specified 'messageSize' to
+    /// the specified 'remoteEndpoint'. Arrive at the specified 'complete'
+    /// countdown once each datagram has been echoed.
+    DatagramClientSession(
+        const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
+        const ntsa::Endpoint&                        remoteEndpoint,
+        bsl::size_t                                  messageSize,
+        bsl::size_t                                  numMessages,
+        ntcd::BenchmarkCountdown*                    complete)
+    : d_datagramSocket_sp(datagramSocket)
+    , d_remoteEndpoint(remoteEndpoint)
+    , d_message(datagramSocket->outgoingBlobBufferFactory().get())
+    , d_numMessagesLeft(numMessages)
+    , d_sendTime(0)
+    , d_latency()
+    , d_complete_p(complete)
+    {
+        d_latency.reserve(numMessages);
+
+        d_message.setLength(static_cast<int>(messageSize));
+        for (int i = 0; i < d_message.numDataBuffers(); ++i) {
+            bsl::memset(d_message.buffer(i).data(),
+                        'X',
+                        d_message.buffer(i).size());
+        }
+    }
+
+    /// Send the next datagram and receive its echo.
+    void send()
+    {
+        --d_numMessagesLeft;
+
+        ntca::ReceiveOptions receiveOptions;
+
+        d_datagramSocket_sp->receive(
+            receiveOptions,
+            NTCCFG_BIND(&DatagramClientSession::processReceive,
+                        this,
+                        NTCCFG_BIND_PLACEHOLDER_1,
+                        NTCCFG_BIND_PLACEHOLDER_2,
+                        NTCCFG_BIND_PLACEHOLDER_3));
+
+        ntca::SendOptions sendOptions;
+        sendOptions.setEndpoint(d_remoteEndpoint);
+
+        d_sendTime = bsls::TimeUtil::getTimer();
+        d_datagramSocket_sp->send(d_message, sendOptions);
+    }
+
+    /// Close the socket and block until it is closed.
+    void close()
+    {
+        ntci::DatagramSocketCloseGuard guard(d_datagramSocket_sp);
+    }
+
+    /// Return the round-trip time of each datagram echoed, in nanoseconds.
+    const bsl::vector<bsls::Types::Int64>& latency() const
+    {
+        return d_latency;
+    }
+};
+
+/// Provide the benchmark runs.
+struct Benchmark {
+    /// Return a new interface configured according to the specified
+    /// 'parameters', or null if the interface cannot be started.
+    static bsl::shared_ptr<ntci::Interface> createInterface(
+        const Parameters& parameters);
+
+    /// Run the stream socket benchmark described by the specified
+    /// 'parameters' and load the outcome into the specified 'result'.
+    static void runStream(Result* result, const Parameters& parameters);
+
+    /// Run the datagram socket benchmark described by the specified
+    /// 'parameters' and load the outcome into the specified 'result'.
+    static void runDatagram(Result* result, const Parameters& parameters);
+
+    /// Write the specified 'result' of the run described by the specified
+    /// 'parameters' to the specified 'stream' as a single line of JSON.
+    static void report(bsl::ostream&     stream,
+                       const Parameters& parameters,
+                       const Result&     result);
+};
+
+bsl::shared_ptr<ntci::Interface> Benchmark::createInterface(
+    const Parameters& parameters)
+{
+    ntca::InterfaceConfig config;
+    config.setMetricName("bench");
+    config.setThreadName("bench");
+    config.setDriverName(parameters.d_driverName);
+    config.setMinThreads(parameters.d_numThreads);
+    config.setMaxThreads(parameters.d_numThreads);
+    config.setDynamicLoadBalancing(false);
+    config.setDriverMetrics(false);
+    config.setSocketMetrics(false);
+
+    bsl::shared_ptr<ntci::Interface> interface =
+        ntcf::System::createInterface(config);
+
+    ntsa::Error error = interface->start();
+    if (error) {
+        return bsl::shared_ptr<ntci::Interface>();
+    }
+
+    return interface;
+}
+
+void Benchmark::runStream(Result* result, const Parameters& parameters)
+{
+    bsl::shared_ptr<ntci::Interface> interface =
+        Benchmark::createInterface(parameters);
+    if (!interface) {
+        result->d_error = ntsa::Error(ntsa::Error::e_INVALID);
+        return;
+    }
+
+    ntcd::BenchmarkCountdown accepted(parameters.d_numConnections);
+    ntcd::BenchmarkCountdown connected(parameters.d_numConnections);
+    ntcd::BenchmarkCountdown complete(parameters.d_numConnections);
+
+    ntca::ListenerSocketOptions listenerSocketOptions;
+    listenerSocketOptions.setTransport(ntsa::Transport::e_TCP_IPV4_STREAM);
+    listenerSocketOptions.setSourceEndpoint(ntsa::Endpoint("127.0.0.1:0"));
+    listenerSocketOptions.setBacklog(parameters.d_numConnections);
+    listenerSocketOptions.setNoDelay(true);
+
+    bsl::shared_ptr<ntci::ListenerSocket> listenerSocket =
+        interface->createListenerSocket(listenerSocketOptions);
+
+    result->d_error = listenerSocket->open();
+    if (!result->d_error) {
+        result->d_error = listenerSocket->listen();
+    }
+
+    StreamEchoServer server(listenerSocket,
+                            parameters.d_messageSize,
+                            parameters.d_numConnections,
+                            &accepted);
+
+    bsl::vector<bsl::shared_ptr<StreamClientSession> > clients;
+
+    if (!result->d_error) {
+        server.accept();
+
+        for (bsl::size_t i = 0; i < parameters.d_numConnections; ++i) {
+            ntca::StreamSocketOptions streamSocketOptions;
+            streamSocketOptions.setTransport(
+                ntsa::Transport::e_TCP_IPV4_STREAM);
+            streamSocketOptions.setNoDelay(true);
+
+            bsl::shared_ptr<StreamClientSession> client;
+            client.createInplace(
+                bslma::Default::allocator(),
+                interface->createStreamSocket(streamSocketOptions),
+                parameters.d_messageSize,
+                parameters.d_numMessages,
+                &connected,
+                &complete);
+
+            clients.push_back(client);
+
+            result->d_error =
+                client->connect(listenerSocket->sourceEndpoint());
+            if (result->d_error) {
+                break;
+            }
+        }
+    }
+
+    if (!result->d_error) {
+        if (!connected.wait(parameters.d_timeout) ||
+            !accepted.wait(parameters.d_timeout))
+        {
+            result->d_timedOut = true;
+        }
+    }
+
+    if (!result->d_error && !result->d_timedOut) {
+        const bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+
+        for (bsl::size_t i = 0; i < clients.size(); ++i) {
+            clients[i]->send();
+        }
+
+        result->d_timedOut = !complete.wait(parameters.d_timeout);
+
+        result->d_elapsed =
+            static_cast<double>(bsls::TimeUtil::getTimer() - startTime) /
+            1000000000.0;
+    }
+
+    for (bsl::size_t i = 0; i < clients.size(); ++i) {
+        clients[i]->close();
+    }
+
+    server.close();
+
+    for (bsl::size_t i = 0; i < clients.size(); ++i) {
+        const bsl::vector<bsls::Types::Int64>& latency = clients[i]->latency();
+        result->d_latency.insert(result->d_latency.end(),
+                                 latency.begin(),
+                                 latency.end());
+    }
+
+    result->d_numMessages = result->d_latency.size();
+
+    interface->shutdown();
+    interface->linger();
+}
+
+void Benchmark::runDatagram(Result* result, const Parameters& parameters)
+{
+    bsl::shared_ptr<ntci::Interface> interface =
+        Benchmark::createInterface(parameters);
+    if (!interface) {
+        result->d_error = ntsa::Error(ntsa::Error::e_INVALID);
+        return;
+    }
+
+    ntcd::BenchmarkCountdown complete(parameters.d_numConnections);
+
+    ntca::DatagramSocketOptions serverOptions;
+    serverOptions.setTransport(ntsa::Transport::e_UDP_IPV4_DATAGRAM);
+    serverOptions.setSourceEndpoint(ntsa::Endpoint("127.0.0.1:0"));
+
+    bsl::shared_ptr<ntci::DatagramSocket> serverSocket =
+        interface->createDatagramSocket(serverOptions);
+
+    result->d_error = serverSocket->open();
+
+    DatagramEchoServer server(serverSocket);
+
+    bsl::vector<bsl::shared_ptr<DatagramClientSession> > clients;
+
+    if (!result->d_error) {
+        server.receive();
+
+        for (bsl::size_t i = 0; i < parameters.d_numConnections; ++i) {
+            ntca::DatagramSocketOptions clientOptions;
+            clientOptions.setTransport(ntsa::Transport::e_UDP_IPV4_DATAGRAM);
+            clientOptions.setSourceEndpoint(ntsa::Endpoint("127.0.0.1:0"));
+
+            bsl::shared_ptr<ntci::DatagramSocket> clientSocket =
+                interface->createDatagramSocket(clientOptions);
+
+            result->d_error = clientSocket->open();
+            if (result->d_error) {
+                break;
+            }
+
+            bsl::shared_ptr<DatagramClientSession> client;
+            client.createInplace(bslma::Default::allocator(),
+                                 clientSocket,
+                                 server.sourceEndpoint(),
+                                 parameters.d_messageSize,
+                                 parameters.d_numMessages,
+                                 &complete);
+
+            clients.push_back(client);
+        }
+    }
+
+    if (!result->d_error) {
+        const bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+
+        for (bsl::size_t i = 0; i < clients.size(); ++i) {
+            clients[i]->send();
+        }
+
+        // Note that a datagram lost in transit stalls its client until the
+        // run times out.
+
+        result->d_timedOut = !complete.wait(parameters.d_timeout);
+
+        result->d_elapsed =
+            static_cast<double>(bsls::TimeUtil::getTimer() - startTime) /
+            1000000000.0;
+    }
+
+    for (bsl::size_t i = 0; i < clients.size(); ++i) {
+        clients[i]->close();
+    }
+
+    server.close();
+
+    for (bsl::size_t i = 0; i < clients.size(); ++i) {
+        const bsl::vector<bsls::Types::Int64>& latency = clients[i]->latency();
+        result->d_latency.insert(result->d_latency.end(),
+                                 latency.begin(),
+                                 latency.end());
+    }
+
+    result->d_numMessages = result->d_latency.size();
+
+    interface->shutdown();
+    interface->linger();
+}
+
+void Benchmark::report(bsl::ostream&     stream,
+                       const Parameters& parameters,
+                       const Result&     result)
+{
+    bsl::vector<bsls::Types::Int64> latency(result.d_latency);
+    bsl::sort(latency.begin(), latency.end());
+
+    double messagesPerSecond = 0;
+    double bytesPerSecond    = 0;
+
+    if (result.d_elapsed > 0) {
+        messagesPerSecond = result.d_numMessages / result.d_elapsed;
+        bytesPerSecond    = messagesPerSecond * parameters.d_messageSize;
+    }
+
+    stream << "{\"benchmark\":\"echo\""
+           << ",\"socket\":\""
+           << (parameters.d_datagram ? "datagram" : "stream") << "\""
+           << ",\"driver\":\"" << parameters.d_driverName << "\""
+           << ",\"messageSize\":" << parameters.d_messageSize
+           << ",\"connections\":" << parameters.d_numConnections
+           << ",\"threads\":" << parameters.d_numThreads
+           << ",\"messages\":" << result.d_numMessages
+           << ",\"timedOut\":" << (result.d_timedOut ? "true" : "false")
+           << ",\"error\":\"" << (result.d_error ? result.d_error.text() : "")
+           << "\""
+           << ",\"elapsedSeconds\":" << result.d_elapsed
+           << ",\"messagesPerSecond\":" << messagesPerSecond
+           << ",\"bytesPerSecond\":" << bytesPerSecond
+           << ",\"latencyP50Nanoseconds\":"
+           << ntcd::BenchmarkUtil::percentile(latency, 0.50)
+           << ",\"latencyP99Nanoseconds\":"
+           << ntcd::BenchmarkUtil::percentile(latency, 0.99)
+           << ",\"latencyP999Nanoseconds\":"
+           << ntcd::BenchmarkUtil::percentile(latency, 0.999)
+           << ",\"latencyMaxNanoseconds\":"
+           << (latency.empty() ? 0 : latency.back()) << "}" << bsl::endl;
+}
+
+/// Load into the specified 'result' each comma-separated field of the
+/// specified 'text'.
+void split(bsl::vector<bsl::string>* result, const bsl::string& text)
+{
+    result->clear();
+
+    bsl::size_t begin = 0;
+    while (begin <= text.size()) {
+        bsl::size_t end = text.find(',', begin);
+        if (end == bsl::string::npos) {
+            end = text.size();
+        }
+
+        if (end > begin) {
+            result->push_back(text.substr(begin, end - begin));
+        }
+
+        begin = end + 1;
+    }
+}
+
+/// Load into the specified 'result' each comma-separated number of the
+/// specified 'text'. Return true if each field is a positive number,
+/// otherwise return false.
+bool split(bsl::vector<bsl::size_t>* result, const bsl::string& text)
+{
+    bsl::vector<bsl::string> fields;
+    split(&fields, text);
+
+    result->clear();
+
+    for (bsl::size_t i = 0; i < fields.size(); ++i) {
+        char*         end   = 0;
+        unsigned long value = bsl::strtoul(fields[i].c_str(), &end, 10);
+        if (end == fields[i].c_str() || *end != 0 || value == 0) {
+            return false;
+        }
+
+        result->push_back(static_cast<bsl::size_t>(value));
+    }
+
+    return !result->empty();
+}
+
+}  // close namespace 'benchmark'
+
+int main(int argc, char** argv)
+{
+    ntcf::System::initialize();
+    ntcf::System::ignore(ntscfg::Signal::e_PIPE);
+
+    bsl::vector<bsl::string> driverNames;
+    bsl::vector<bsl::string> socketTypes;
+    bsl::vector<bsl::size_t> messageSizes(1, 64);
+    bsl::vector<bsl::size_t> connectionCounts(1, 1);
+    bsl::vector<bsl::size_t> threadCounts(1, 1);
+    bsl::size_t              numMessages = 10000;
+    bsl::size_t              timeout     = 60;
+
+    socketTypes.push_back("stream");
+    socketTypes.push_back("datagram");
+
+    for (int i = 1; i < argc; ++i) {
+        const bsl::string option(argv[i]);
+        if (i + 1 >= argc) {
+            bsl::cerr << "Missing value for option " << option << bsl::endl;
+            return 1;
+        }
+
+        const bsl::string value(argv[++i]);
+
+        bool valid = true;
+
+        if (option == "--driver") {
+            benchmark::split(&driverNames, value);
+        }
+        else if (option == "--socket") {
+            benchmark::split(&socketTypes, value);
+            for (bsl::size_t j = 0; j < socketTypes.size(); ++j) {
+                if (socketTypes[j] != "stream" && socketTypes[j] != "datagram")
+                {
+                    valid = false;
+                }
+            }
+        }
+        else if (option == "--size") {
+            valid = benchmark::split(&messageSizes, value);
+        }
+        else if (option == "--connections") {
+            valid = benchmark::split(&connectionCounts, value);
+        }
+        else if (option == "--threads") {
+            valid = benchmark::split(&threadCounts, value);
+        }
+        else if (option == "--messages") {
+            bsl::vector<bsl::size_t> values;
+            valid = benchmark::split(&values, value) && values.size() == 1;
+            if (valid) {
+                numMessages = values.front();
+            }
+        }
+        else if (option == "--timeout") {
+            bsl::vector<bsl::size_t> values;
+            valid = benchmark::split(&values, value) && values.size() == 1;
+            if (valid) {
+                timeout = values.front();
+            }
+        }
+        else {
+            valid = false;
+        }
+
+        if (!valid) {
+            bsl::cerr << "Invalid option " << option << " " << value
+                      << bsl::endl;
+            return 1;
+        }
+    }
+
+    if (driverNames.empty()) {
+        ntcf::System::loadDriverSupport(&driverNames, false);
+    }
+
+    for (bsl::size_t d = 0; d < driverNames.size(); ++d) {
+        for (bsl::size_t s = 0; s < socketTypes.size(); ++s) {
+            for (bsl::size_t m = 0; m < messageSizes.size(); ++m) {
+                for (bsl::size_t c = 0; c < connectionCounts.size(); ++c) {
+                    for (bsl::size_t t = 0; t < threadCounts.size(); ++t) {
+                        benchmark::Parameters parameters;
+                        parameters.d_driverName     = driverNames[d];
+                        parameters.d_datagram       = socketTypes[s] ==
+                                                "datagram";
+                        parameters.d_messageSize    = messageSizes[m];
+                        parameters.d_numConnections = connectionCounts[c];
+                        parameters.d_numThreads     = threadCounts[t];
+                        parameters.d_numMessages    = numMessages;
+                        parameters.d_timeout        = timeout;
+
+                        if (parameters.d_datagram &&
+                            parameters.d_messageSize > 65000)
+                        {
+                            continue;
+                        }
+
+                        benchmark::Result result;
+                        if (parameters.d_datagram) {
+                            benchmark::Benchmark::runDatagram(&result,
+                                                              parameters);
+                        }
+                        else {
+                            benchmark::Benchmark::runStream(&result,
+                                                            parameters);
+                        }
+
+                        benchmark::Benchmark::report(bsl::cout,
+                                                     parameters,
+                                                     result);
+                    }
+                }
+            }
+        }
+    }
+
+    return 0;
+}
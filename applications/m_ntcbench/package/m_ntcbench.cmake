@@ -0,0 +1,6 @@
+bde_prefixed_override(m_ntcbench application_initialize)
+function(m_ntcbench_application_initialize retUor appName)
+    string(REGEX REPLACE "(m_)?(.+)" "\\2" appTrimmedName ${appName})
+    application_initialize_base("" tmpUor ${appTrimmedName})
+    bde_return(${tmpUor})
+endfunction()
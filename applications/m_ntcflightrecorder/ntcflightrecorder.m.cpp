@@ -0,0 +1,267 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_flightrecorder.h>
+#include <bdlt_datetime.h>
+#include <bdlt_epochutil.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+// This application decodes a file written by 'ntcs::FlightRecorder', either
+// on demand through 'ntcf::System::dumpFlightRecorder' or when a process
+// crashes, and prints the events recorded by every thread as a single
+// timeline ordered by time. Each line describes the time of the event
+// relative to the first event, the time elapsed since the previous event
+// recorded by the same thread, the thread that recorded the event, and the
+// event itself. Lines whose elapsed time exceeds the optional threshold are
+// marked, so that the gaps that cause latency spikes stand out.
+//
+// Usage:
+//
+//     ntcflightrecorder <path>
+//                       [--thread <id>]
+//                       [--threshold <microseconds>]
+//
+// By default the events of every thread are printed and no lines are
+// marked.
+
+namespace flightrecorder {
+
+/// Describe the parameters of the decoder.
+struct Parameters {
+    bsl::string         d_path;
+    bsls::Types::Uint64 d_threadId;
+    bsls::Types::Int64  d_threshold;
+
+    Parameters()
+    : d_path()
+    , d_threadId(0)
+    , d_threshold(0)
+    {
+    }
+};
+
+/// Describe an event in the timeline.
+struct Entry {
+    ntcs::FlightRecorderEvent          d_event;
+    bsls::Types::Int64                 d_elapsed;
+    const ntcs::FlightRecorderJournal* d_journal_p;
+};
+
+/// Return true if the specified 'lhs' occurs before the specified 'rhs',
+/// otherwise return false.
+bool isBefore(const Entry& lhs, const Entry& rhs)
+{
+    return lhs.d_event.d_time < rhs.d_event.d_time;
+}
+
+/// Print the specified 'nanoseconds' as microseconds to the specified
+/// 'stream'.
+void printMicroseconds(bsl::ostream& stream, bsls::Types::Int64 nanoseconds)
+{
+    stream << bsl::fixed << bsl::setprecision(3) << bsl::setw(14)
+           << static_cast<double>(nanoseconds) / 1000.0;
+}
+
+/// Print the description of the specified 'event' to the specified
+/// 'stream'.
+void printEvent(bsl::ostream& stream, const ntcs::FlightRecorderEvent& event)
+{
+    ntcs::FlightRecorderEventType::Value type;
+    if (ntcs::FlightRecorderEventType::fromInt(&type, event.d_type) != 0) {
+        stream << "UNKNOWN type = " << event.d_type;
+        return;
+    }
+
+    stream << type;
+
+    switch (type) {
+    case ntcs::FlightRecorderEventType::e_WAIT_ENTER:
+        if (event.d_value < 0) {
+            stream << " timeout = indefinite";
+        }
+        else {
+            stream << " timeout = " << event.d_value << " ms";
+        }
+        break;
+    case ntcs::FlightRecorderEventType::e_WAIT_EXIT:
+        stream << " events = " << event.d_value;
+        break;
+    case ntcs::FlightRecorderEventType::e_POLL:
+        stream << " handle = " << event.d_handle;
+        if ((event.d_flags & ntcs::FlightRecorderEvent::e_READABLE) != 0) {
+            stream << " readable";
+        }
+        if ((event.d_flags & ntcs::FlightRecorderEvent::e_WRITABLE) != 0) {
+            stream << " writable";
+        }
+        if ((event.d_flags & ntcs::FlightRecorderEvent::e_ERROR) != 0) {
+            stream << " error";
+        }
+        break;
+    case ntcs::FlightRecorderEventType::e_TIMER:
+        stream << " late = " << event.d_value << " us";
+        break;
+    case ntcs::FlightRecorderEventType::e_SUBMIT:
+        stream << " handle = " << event.d_handle
+               << " operation = " << event.d_value;
+        break;
+    case ntcs::FlightRecorderEventType::e_COMPLETE:
+        stream << " handle = " << event.d_handle;
+        if ((event.d_flags & ntcs::FlightRecorderEvent::e_FAILED) != 0) {
+            stream << " error = " << event.d_value;
+        }
+        else {
+            stream << " result = " << event.d_value;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+}  // close namespace 'flightrecorder'
+
+int main(int argc, char** argv)
+{
+    flightrecorder::Parameters parameters;
+
+    for (int i = 1; i < argc; ++i) {
+        const bsl::string option(argv[i]);
+
+        if (option.empty() || option[0] != '-') {
+            parameters.d_path = option;
+            continue;
+        }
+
+        if (i + 1 >= argc) {
+            bsl::cerr << "Missing value for option " << option << bsl::endl;
+            return 1;
+        }
+
+        const bsl::string value(argv[++i]);
+
+        if (option == "--thread") {
+            parameters.d_threadId = bsl::strtoull(value.c_str(), 0, 10);
+        }
+        else if (option == "--threshold") {
+            parameters.d_threshold =
+                bsl::strtoll(value.c_str(), 0, 10) * 1000;
+        }
+        else {
+            bsl::cerr << "Invalid option " << option << " " << value
+                      << bsl::endl;
+            return 1;
+        }
+    }
+
+    if (parameters.d_path.empty()) {
+        bsl::cerr << "Usage: ntcflightrecorder <path> [--thread <id>] "
+                     "[--threshold <microseconds>]"
+                  << bsl::endl;
+        return 1;
+    }
+
+    bsl::vector<ntcs::FlightRecorderJournal> journals;
+
+    ntsa::Error error =
+        ntcs::FlightRecorder::load(&journals, parameters.d_path.c_str());
+    if (error) {
+        bsl::cerr << "Failed to load '" << parameters.d_path
+                  << "': " << error << bsl::endl;
+        return 1;
+    }
+
+    bsl::vector<flightrecorder::Entry> timeline;
+
+    for (bsl::size_t i = 0; i < journals.size(); ++i) {
+        const ntcs::FlightRecorderJournal& journal = journals[i];
+
+        if (parameters.d_threadId != 0 &&
+            parameters.d_threadId != journal.threadId())
+        {
+            continue;
+        }
+
+        const bsl::vector<ntcs::FlightRecorderEvent>& events =
+            journal.events();
+
+        for (bsl::size_t j = 0; j < events.size(); ++j) {
+            flightrecorder::Entry entry;
+            entry.d_event     = events[j];
+            entry.d_elapsed   = j == 0 ? 0 : events[j].d_time -
+                                                 events[j - 1].d_time;
+            entry.d_journal_p = &journal;
+
+            timeline.push_back(entry);
+        }
+    }
+
+    if (timeline.empty()) {
+        bsl::cout << "No events recorded" << bsl::endl;
+        return 0;
+    }
+
+    bsl::stable_sort(timeline.begin(),
+                     timeline.end(),
+                     &flightrecorder::isBefore);
+
+    const bsls::Types::Int64 origin = timeline.front().d_event.d_time;
+
+    bsls::TimeInterval originInterval;
+    originInterval.setTotalNanoseconds(origin);
+
+    bsl::cout << "Timeline of " << timeline.size() << " events from "
+              << journals.size() << " threads starting at "
+              << bdlt::EpochUtil::convertFromTimeInterval(originInterval)
+              << " UTC" << bsl::endl;
+
+    bsl::cout << "    Time (us)   Elapsed (us)  Thread" << bsl::endl;
+
+    for (bsl::size_t i = 0; i < timeline.size(); ++i) {
+        const flightrecorder::Entry& entry = timeline[i];
+
+        flightrecorder::printMicroseconds(bsl::cout,
+                                          entry.d_event.d_time - origin);
+        bsl::cout << " ";
+        flightrecorder::printMicroseconds(bsl::cout, entry.d_elapsed);
+
+        bsl::cout << "  " << entry.d_journal_p->threadId();
+        if (!entry.d_journal_p->threadName().empty()) {
+            bsl::cout << " (" << entry.d_journal_p->threadName() << ")";
+        }
+
+        bsl::cout << "  ";
+        flightrecorder::printEvent(bsl::cout, entry.d_event);
+
+        if (parameters.d_threshold > 0 &&
+            entry.d_elapsed > parameters.d_threshold)
+        {
+            bsl::cout << "  <<< GAP";
+        }
+
+        bsl::cout << bsl::endl;
+    }
+
+    return 0;
+}
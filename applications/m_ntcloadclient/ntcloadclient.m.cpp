@@ -0,0 +1,649 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntccfg_bind.h>
+#include <ntccfg_platform.h>
+#include <ntcd_benchmarkutil.h>
+#include <ntcf_system.h>
+#include <ntsd_datautil.h>
+#include <ntsd_message.h>
+#include <ntsd_messageparser.h>
+#include <ntsd_messagetype.h>
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlt_currenttime.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+#include <bsls_atomic.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+// This application is the load generating half of a load generator built on
+// the test protocol defined by 'ntsd::Message', and is intended to be run
+// against 'ntcloadserver'. The client opens a number of stream socket
+// connections to the server and sends requests over them in one of two modes:
+//
+// In closed-loop mode, each connection keeps a fixed number of requests
+// outstanding, sending a new request each time a response is received. The
+// offered load therefore adapts to the latency of the server.
+//
+// In open-loop mode, requests are sent at a fixed aggregate rate distributed
+// round-robin over the connections, regardless of how many requests are
+// outstanding. Each request is stamped with the time at which it was
+// scheduled to be sent rather than the time at which it was actually sent,
+// so a stall in the client or the server is charged to each request that
+// should have been sent during the stall, correcting for coordinated
+// omission.
+//
+// In both modes the round-trip time of each request is computed from the
+// request timestamp echoed back in its response, so no per-request state is
+// kept by the client. The request and response sizes are chosen by cycling
+// through the lists given on the command line, so that a mix of message sizes
+// observed in production may be reproduced. The server is asked to delay each
+// response by the given response delay to model the service time.
+//
+// When the run completes, the results are written to standard output as a
+// single line of JSON.
+//
+// Usage:
+//
+//     ntcloadclient --connect <endpoint>
+//                   [--driver <name>]
+//                   [--threads <count>]
+//                   [--connections <count>]
+//                   [--mode closed|open]
+//                   [--depth <count>]
+//                   [--rate <requests-per-second>]
+//                   [--duration <seconds>]
+//                   [--request-size <bytes>[,<bytes>...]]
+//                   [--response-size <bytes>[,<bytes>...]]
+//                   [--response-delay <microseconds>]
+
+namespace loadclient {
+
+/// Describe the parameters of the client.
+struct Parameters {
+    bsl::string              d_driverName;
+    bsl::size_t              d_numThreads;
+    ntsa::Endpoint           d_endpoint;
+    bsl::size_t              d_numConnections;
+    bool                     d_openLoop;
+    bsl::size_t              d_depth;
+    bsl::size_t              d_rate;
+    bsl::size_t              d_duration;
+    bsl::vector<bsl::size_t> d_requestSizes;
+    bsl::vector<bsl::size_t> d_responseSizes;
+    bsl::size_t              d_responseDelay;
+
+    Parameters()
+    : d_driverName()
+    , d_numThreads(1)
+    , d_endpoint()
+    , d_numConnections(1)
+    , d_openLoop(false)
+    , d_depth(1)
+    , d_rate(1000)
+    , d_duration(10)
+    , d_requestSizes(1, 64)
+    , d_responseSizes(1, 64)
+    , d_responseDelay(0)
+    {
+    }
+};
+
+/// Provide a recorder of the round-trip time of each request.
+class Recorder
+{
+    bslmt::Mutex                    d_mutex;
+    bsl::vector<bsls::Types::Int64> d_latency;
+    bsls::AtomicUint64              d_numSent;
+    bsls::AtomicUint64              d_numReceived;
+    bsls::AtomicBool                d_stopped;
+
+  private:
+    Recorder(const Recorder&) BSLS_KEYWORD_DELETED;
+    Recorder& operator=(const Recorder&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new recorder.
+    Recorder()
+    : d_mutex()
+    , d_latency()
+    , d_numSent(0)
+    , d_numReceived(0)
+    , d_stopped(false)
+    {
+    }
+
+    /// Record a request was sent.
+    void recordSend()
+    {
+        ++d_numSent;
+    }
+
+    /// Record a response was received for a request having the specified
+    /// round-trip 'latency', in microseconds.
+    void recordReceive(bsls::Types::Int64 latency)
+    {
+        {
+            bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+            d_latency.push_back(latency);
+        }
+
+        ++d_numReceived;
+    }
+
+    /// Stop sending requests.
+    void stop()
+    {
+        d_stopped = true;
+    }
+
+    /// Load into the specified 'result' the round-trip time of each request
+    /// for which a response has been received, in microseconds, sorted in
+    /// ascending order.
+    void load(bsl::vector<bsls::Types::Int64>* result)
+    {
+        {
+            bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+            *result = d_latency;
+        }
+
+        bsl::sort(result->begin(), result->end());
+    }
+
+    /// Return the number of requests sent.
+    bsl::uint64_t numSent() const
+    {
+        return d_numSent;
+    }
+
+    /// Return the number of responses received.
+    bsl::uint64_t numReceived() const
+    {
+        return d_numReceived;
+    }
+
+    /// Return true if requests should no longer be sent, otherwise return
+    /// false.
+    bool stopped() const
+    {
+        return d_stopped;
+    }
+};
+
+/// Provide a stream socket that sends requests and measures the round-trip
+/// time of each response.
+class Session : public ntccfg::Shared<Session>
+{
+    bsl::shared_ptr<ntci::StreamSocket> d_streamSocket_sp;
+    ntsd::MessageParser                 d_parser;
+    bdlbb::Blob                         d_readQueue;
+    int                                 d_numNeeded;
+    bsls::AtomicUint                    d_sequenceNumber;
+    bsl::uint32_t                       d_userId;
+    const Parameters&                   d_parameters;
+    Recorder*                           d_recorder_p;
+    ntcd::BenchmarkCountdown*           d_connected_p;
+
+  private:
+    Session(const Session&) BSLS_KEYWORD_DELETED;
+    Session& operator=(const Session&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Process the completion of the connection according to the specified
+    /// 'event'.
+    void processConnect(const bsl::shared_ptr<ntci::Connector>& connector,
+                        const ntca::ConnectEvent&               event)
+    {
+        NTCCFG_WARNING_UNUSED(connector);
+
+        if (event.type() == ntca::ConnectEventType::e_COMPLETE) {
+            this->receive();
+            d_connected_p->arrive();
+        }
+    }
+
+    /// Process the receipt of the specified 'data' according to the
+    /// specified 'event'.
+    void processReceive(const bsl::shared_ptr<ntci::Receiver>& receiver,
+                        const bsl::shared_ptr<bdlbb::Blob>&    data,
+                        const ntca::ReceiveEvent&              event)
+    {
+        NTCCFG_WARNING_UNUSED(receiver);
+
+        if (event.type() == ntca::ReceiveEventType::e_ERROR) {
+            return;
+        }
+
+        bdlbb::BlobUtil::append(&d_readQueue, *data);
+
+        ntsa::Error error = d_parser.parse(
+            &d_numNeeded,
+            &d_readQueue,
+            NTCCFG_BIND(&Session::processMessage,
+                        this,
+                        NTCCFG_BIND_PLACEHOLDER_1));
+        if (error) {
+            d_streamSocket_sp->close();
+            return;
+        }
+
+        this->receive();
+    }
+
+    /// Process the specified 'response'.
+    void processMessage(const ntsd::Message& response)
+    {
+        if (response.type() != ntsd::MessageType::e_RESPONSE) {
+            return;
+        }
+
+        const bsls::TimeInterval now = bdlt::CurrentTime::now();
+
+        d_recorder_p->recordReceive(
+            (now - response.requestTimestamp()).totalMicroseconds());
+
+        if (!d_parameters.d_openLoop && !d_recorder_p->stopped()) {
+            this->send(now);
+        }
+    }
+
+    /// Receive at least enough data to make progress parsing the next
+    /// message.
+    void receive()
+    {
+        int minSize = d_numNeeded - d_readQueue.length();
+        if (minSize < 1) {
+            minSize = 1;
+        }
+
+        ntca::ReceiveOptions options;
+        options.setMinSize(static_cast<bsl::size_t>(minSize));
+        options.setMaxSize(static_cast<bsl::size_t>(minSize) + 65536);
+
+        d_streamSocket_sp->receive(
+            options,
+            NTCCFG_BIND(&Session::processReceive,
+                        this->getSelf(this),
+                        NTCCFG_BIND_PLACEHOLDER_1,
+                        NTCCFG_BIND_PLACEHOLDER_2,
+                        NTCCFG_BIND_PLACEHOLDER_3));
+    }
+
+  public:
+    /// Create a new session for the specified 'streamSocket' identified by
+    /// the specified 'userId' that sends requests according to the
+    /// specified 'parameters' and records their round-trip times in the
+    /// specified 'recorder'. Arrive at the specified 'connected' countdown
+    /// once the connection is established.
+    Session(const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+            bsl::uint32_t                              userId,
+            const Parameters&                          parameters,
+            Recorder*                                  recorder,
+            ntcd::BenchmarkCountdown*                  connected)
+    : d_streamSocket_sp(streamSocket)
+    , d_parser()
+    , d_readQueue(streamSocket->incomingBlobBufferFactory().get())
+    , d_numNeeded(static_cast<int>(sizeof(ntsd::MessageHeader)))
+    , d_sequenceNumber(0)
+    , d_userId(userId)
+    , d_parameters(parameters)
+    , d_recorder_p(recorder)
+    , d_connected_p(connected)
+    {
+    }
+
+    /// Connect to the specified 'endpoint'. Return the error.
+    ntsa::Error connect(const ntsa::Endpoint& endpoint)
+    {
+        return d_streamSocket_sp->connect(
+            endpoint,
+            ntca::ConnectOptions(),
+            NTCCFG_BIND(&Session::processConnect,
+                        this->getSelf(this),
+                        NTCCFG_BIND_PLACEHOLDER_1,
+                        NTCCFG_BIND_PLACEHOLDER_2));
+    }
+
+    /// Send a request stamped with the specified 'requestTimestamp'.
+    void send(const bsls::TimeInterval& requestTimestamp)
+    {
+        const bsl::uint32_t sequenceNumber = d_sequenceNumber++;
+
+        const bsl::size_t requestSize =
+            d_parameters.d_requestSizes[sequenceNumber %
+                                        d_parameters.d_requestSizes.size()];
+
+        const bsl::size_t responseSize =
+            d_parameters.d_responseSizes[sequenceNumber %
+                                         d_parameters.d_responseSizes.size()];
+
+        bsls::TimeInterval responseDelay;
+        responseDelay.addMicroseconds(
+            static_cast<bsls::Types::Int64>(d_parameters.d_responseDelay));
+
+        ntsd::Message request(
+            d_streamSocket_sp->outgoingBlobBufferFactory().get());
+
+        request.setType(ntsd::MessageType::e_REQUEST);
+        request.setUserId(d_userId);
+        request.setTransactionId(sequenceNumber);
+        request.setSequenceNumber(sequenceNumber);
+        request.setRequestSize(static_cast<bsl::uint32_t>(requestSize));
+        request.setResponseSize(static_cast<bsl::uint32_t>(responseSize));
+        request.setResponseDelay(responseDelay);
+        request.setRequestTimestamp(requestTimestamp);
+
+        if (requestSize > 0) {
+            bdlbb::Blob payload(
+                d_streamSocket_sp->outgoingBlobBufferFactory().get());
+            ntsd::DataUtil::generateData(&payload, requestSize);
+            request.setPayload(payload);
+        }
+
+        bdlbb::Blob data(d_streamSocket_sp->outgoingBlobBufferFactory().get());
+        request.encode(&data);
+
+        ntsa::Error error = d_streamSocket_sp->send(data, ntca::SendOptions());
+        if (!error) {
+            d_recorder_p->recordSend();
+        }
+    }
+
+    /// Close the socket and block until it is closed.
+    void close()
+    {
+        ntci::StreamSocketCloseGuard guard(d_streamSocket_sp);
+    }
+};
+
+/// Load into the specified 'result' each comma-separated number of the
+/// specified 'text'. Return true if at least one number is parsed and each
+/// field is a number, otherwise return false.
+bool split(bsl::vector<bsl::size_t>* result, const bsl::string& text)
+{
+    result->clear();
+
+    bsl::size_t begin = 0;
+    while (begin <= text.size()) {
+        bsl::size_t end = text.find(',', begin);
+        if (end == bsl::string::npos) {
+            end = text.size();
+        }
+
+        const bsl::string field = text.substr(begin, end - begin);
+
+        char*         last  = 0;
+        unsigned long value = bsl::strtoul(field.c_str(), &last, 10);
+        if (field.empty() || *last != 0) {
+            return false;
+        }
+
+        result->push_back(static_cast<bsl::size_t>(value));
+
+        begin = end + 1;
+    }
+
+    return !result->empty();
+}
+
+}  // close namespace 'loadclient'
+
+int main(int argc, char** argv)
+{
+    ntcf::System::initialize();
+    ntcf::System::ignore(ntscfg::Signal::e_PIPE);
+
+    loadclient::Parameters parameters;
+
+    for (int i = 1; i < argc; ++i) {
+        const bsl::string option(argv[i]);
+        if (i + 1 >= argc) {
+            bsl::cerr << "Missing value for option " << option << bsl::endl;
+            return 1;
+        }
+
+        const bsl::string value(argv[++i]);
+
+        bool valid = true;
+
+        if (option == "--connect") {
+            valid = parameters.d_endpoint.parse(value);
+        }
+        else if (option == "--driver") {
+            parameters.d_driverName = value;
+        }
+        else if (option == "--threads") {
+            parameters.d_numThreads = bsl::strtoul(value.c_str(), 0, 10);
+            valid                   = parameters.d_numThreads > 0;
+        }
+        else if (option == "--connections") {
+            parameters.d_numConnections = bsl::strtoul(value.c_str(), 0, 10);
+            valid = parameters.d_numConnections > 0;
+        }
+        else if (option == "--mode") {
+            valid                 = value == "closed" || value == "open";
+            parameters.d_openLoop = value == "open";
+        }
+        else if (option == "--depth") {
+            parameters.d_depth = bsl::strtoul(value.c_str(), 0, 10);
+            valid              = parameters.d_depth > 0;
+        }
+        else if (option == "--rate") {
+            parameters.d_rate = bsl::strtoul(value.c_str(), 0, 10);
+            valid             = parameters.d_rate > 0;
+        }
+        else if (option == "--duration") {
+            parameters.d_duration = bsl::strtoul(value.c_str(), 0, 10);
+            valid                 = parameters.d_duration > 0;
+        }
+        else if (option == "--request-size") {
+            valid = loadclient::split(&parameters.d_requestSizes, value);
+        }
+        else if (option == "--response-size") {
+            valid = loadclient::split(&parameters.d_responseSizes, value);
+        }
+        else if (option == "--response-delay") {
+            parameters.d_responseDelay = bsl::strtoul(value.c_str(), 0, 10);
+        }
+        else {
+            valid = false;
+        }
+
+        if (!valid) {
+            bsl::cerr << "Invalid option " << option << " " << value
+                      << bsl::endl;
+            return 1;
+        }
+    }
+
+    if (parameters.d_endpoint.isUndefined()) {
+        bsl::cerr << "The --connect option is required" << bsl::endl;
+        return 1;
+    }
+
+    ntsa::Error error;
+
+    ntca::InterfaceConfig interfaceConfig;
+    interfaceConfig.setMetricName("client");
+    interfaceConfig.setThreadName("client");
+    interfaceConfig.setMinThreads(parameters.d_numThreads);
+    interfaceConfig.setMaxThreads(parameters.d_numThreads);
+
+    if (!parameters.d_driverName.empty()) {
+        interfaceConfig.setDriverName(parameters.d_driverName);
+    }
+
+    bsl::shared_ptr<ntci::Interface> interface =
+        ntcf::System::createInterface(interfaceConfig);
+
+    error = interface->start();
+    if (error) {
+        bsl::cerr << "Failed to start interface: " << error << bsl::endl;
+        return 1;
+    }
+
+    loadclient::Recorder  recorder;
+    ntcd::BenchmarkCountdown connected(parameters.d_numConnections);
+
+    bsl::vector<bsl::shared_ptr<loadclient::Session> > sessions;
+
+    for (bsl::size_t i = 0; i < parameters.d_numConnections; ++i) {
+        ntca::StreamSocketOptions streamSocketOptions;
+        streamSocketOptions.setTransport(
+            parameters.d_endpoint.isIp() &&
+                    parameters.d_endpoint.ip().host().isV6()
+                ? ntsa::Transport::e_TCP_IPV6_STREAM
+                : ntsa::Transport::e_TCP_IPV4_STREAM);
+        streamSocketOptions.setNoDelay(true);
+
+        bsl::shared_ptr<loadclient::Session> session;
+        session.createInplace(
+            bslma::Default::allocator(),
+            interface->createStreamSocket(streamSocketOptions),
+            static_cast<bsl::uint32_t>(i),
+            parameters,
+            &recorder,
+            &connected);
+
+        error = session->connect(parameters.d_endpoint);
+        if (error) {
+            bsl::cerr << "Failed to connect to " << parameters.d_endpoint
+                      << ": " << error << bsl::endl;
+            return 1;
+        }
+
+        sessions.push_back(session);
+    }
+
+    if (!connected.wait(10)) {
+        bsl::cerr << "Failed to connect to " << parameters.d_endpoint
+                  << bsl::endl;
+        return 1;
+    }
+
+    const bsls::Types::Int64 k_NANOSECONDS_PER_SECOND = 1000000000;
+
+    const bsls::Types::Int64 startTimer = bsls::TimeUtil::getTimer();
+    const bsls::TimeInterval startTime  = bdlt::CurrentTime::now();
+
+    const bsls::Types::Int64 stopTimer =
+        startTimer + static_cast<bsls::Types::Int64>(parameters.d_duration) *
+                         k_NANOSECONDS_PER_SECOND;
+
+    if (parameters.d_openLoop) {
+        const double period = static_cast<double>(k_NANOSECONDS_PER_SECOND) /
+                              static_cast<double>(parameters.d_rate);
+
+        for (bsl::uint64_t k = 0; true; ++k) {
+            const bsls::Types::Int64 offset =
+                static_cast<bsls::Types::Int64>(period * k);
+
+            const bsls::Types::Int64 scheduledTimer = startTimer + offset;
+            if (scheduledTimer >= stopTimer) {
+                break;
+            }
+
+            const bsls::Types::Int64 now = bsls::TimeUtil::getTimer();
+            if (now < scheduledTimer) {
+                bslmt::ThreadUtil::microSleep(
+                    static_cast<int>((scheduledTimer - now) / 1000));
+            }
+
+            bsls::TimeInterval scheduledTime = startTime;
+            scheduledTime.addNanoseconds(offset);
+
+            sessions[k % sessions.size()]->send(scheduledTime);
+        }
+    }
+    else {
+        for (bsl::size_t i = 0; i < sessions.size(); ++i) {
+            for (bsl::size_t j = 0; j < parameters.d_depth; ++j) {
+                sessions[i]->send(bdlt::CurrentTime::now());
+            }
+        }
+
+        bslmt::ThreadUtil::sleep(
+            bsls::TimeInterval(static_cast<double>(parameters.d_duration)));
+    }
+
+    recorder.stop();
+
+    const double elapsed =
+        static_cast<double>(bsls::TimeUtil::getTimer() - startTimer) /
+        static_cast<double>(k_NANOSECONDS_PER_SECOND);
+
+    // Allow the responses to the requests outstanding to arrive.
+
+    for (int i = 0; i < 100; ++i) {
+        if (recorder.numReceived() >= recorder.numSent()) {
+            break;
+        }
+
+        bslmt::ThreadUtil::microSleep(50000);
+    }
+
+    for (bsl::size_t i = 0; i < sessions.size(); ++i) {
+        sessions[i]->close();
+    }
+
+    interface->shutdown();
+    interface->linger();
+
+    bsl::vector<bsls::Types::Int64> latency;
+    recorder.load(&latency);
+
+    bsl::cout << "{\"mode\":\""
+              << (parameters.d_openLoop ? "open" : "closed") << "\""
+              << ",\"driver\":\"" << parameters.d_driverName << "\""
+              << ",\"endpoint\":\"" << parameters.d_endpoint << "\""
+              << ",\"connections\":" << parameters.d_numConnections
+              << ",\"threads\":" << parameters.d_numThreads;
+
+    if (parameters.d_openLoop) {
+        bsl::cout << ",\"rate\":" << parameters.d_rate;
+    }
+    else {
+        bsl::cout << ",\"depth\":" << parameters.d_depth;
+    }
+
+    bsl::cout << ",\"elapsedSeconds\":" << elapsed
+              << ",\"requestsSent\":" << recorder.numSent()
+              << ",\"responsesReceived\":" << recorder.numReceived()
+              << ",\"responsesPerSecond\":"
+              << static_cast<double>(latency.size()) / elapsed
+              << ",\"latencyP50Microseconds\":"
+              << ntcd::BenchmarkUtil::percentile(latency, 0.50)
+              << ",\"latencyP90Microseconds\":"
+              << ntcd::BenchmarkUtil::percentile(latency, 0.90)
+              << ",\"latencyP99Microseconds\":"
+              << ntcd::BenchmarkUtil::percentile(latency, 0.99)
+              << ",\"latencyP999Microseconds\":"
+              << ntcd::BenchmarkUtil::percentile(latency, 0.999)
+              << ",\"latencyMaxMicroseconds\":"
+              << (latency.empty() ? 0 : latency.back()) << "}" << bsl::endl;
+
+    return 0;
+}
@@ -0,0 +1,384 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntccfg_bind.h>
+#include <ntccfg_platform.h>
+#include <ntcf_system.h>
+#include <ntsd_datautil.h>
+#include <ntsd_message.h>
+#include <ntsd_messageparser.h>
+#include <ntsd_messagetype.h>
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlt_currenttime.h>
+#include <bslmt_threadutil.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+
+// This application is the responder half of a load generator built on the
+// test protocol defined by 'ntsd::Message'. The server accepts stream socket
+// connections and, for each request it parses, sends a response having the
+// response size requested by the client after waiting the response delay
+// requested by the client. The request timestamp is copied into the response
+// so that the client may compute the round-trip time of each request without
+// maintaining any per-request state. One-way messages are consumed without
+// a response.
+//
+// The server writes the endpoint to which it is bound to standard output as a
+// single line of JSON once it is ready to accept connections.
+//
+// Usage:
+//
+//     ntcloadserver [--driver <name>]
+//                   [--threads <count>]
+//                   [--listen <endpoint>]
+//                   [--duration <seconds>]
+//
+// By default the server listens on 127.0.0.1 at an ephemeral port, using the
+// default driver with a single I/O thread, and runs until terminated.
+
+namespace loadserver {
+
+/// Describe the parameters of the server.
+struct Parameters {
+    bsl::string    d_driverName;
+    bsl::size_t    d_numThreads;
+    ntsa::Endpoint d_endpoint;
+    bsl::size_t    d_duration;
+
+    Parameters()
+    : d_driverName()
+    , d_numThreads(1)
+    , d_endpoint("127.0.0.1:0")
+    , d_duration(0)
+    {
+    }
+};
+
+/// Provide a stream socket that responds to each request it receives.
+class Session : public ntccfg::Shared<Session>
+{
+    bsl::shared_ptr<ntci::StreamSocket> d_streamSocket_sp;
+    ntsd::MessageParser                 d_parser;
+    bdlbb::Blob                         d_readQueue;
+    int                                 d_numNeeded;
+
+  private:
+    Session(const Session&) BSLS_KEYWORD_DELETED;
+    Session& operator=(const Session&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Process the receipt of the specified 'data' according to the
+    /// specified 'event'.
+    void processReceive(const bsl::shared_ptr<ntci::Receiver>& receiver,
+                        const bsl::shared_ptr<bdlbb::Blob>&    data,
+                        const ntca::ReceiveEvent&              event)
+    {
+        NTCCFG_WARNING_UNUSED(receiver);
+
+        if (event.type() == ntca::ReceiveEventType::e_ERROR) {
+            return;
+        }
+
+        bdlbb::BlobUtil::append(&d_readQueue, *data);
+
+        ntsa::Error error = d_parser.parse(
+            &d_numNeeded,
+            &d_readQueue,
+            NTCCFG_BIND(&Session::processMessage,
+                        this,
+                        NTCCFG_BIND_PLACEHOLDER_1));
+        if (error) {
+            d_streamSocket_sp->close();
+            return;
+        }
+
+        this->receive();
+    }
+
+    /// Process the specified 'request'.
+    void processMessage(const ntsd::Message& request)
+    {
+        if (request.type() != ntsd::MessageType::e_REQUEST) {
+            return;
+        }
+
+        ntsd::Message response(
+            d_streamSocket_sp->outgoingBlobBufferFactory().get());
+
+        response.setHeader(request.header());
+        response.setType(ntsd::MessageType::e_RESPONSE);
+
+        if (request.responseSize() > 0) {
+            bdlbb::Blob payload(
+                d_streamSocket_sp->outgoingBlobBufferFactory().get());
+            ntsd::DataUtil::generateData(&payload, request.responseSize());
+            response.setPayload(payload);
+        }
+
+        if (request.responseDelay() > bsls::TimeInterval()) {
+            ntca::TimerOptions timerOptions;
+            timerOptions.setOneShot(true);
+            timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
+            timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
+
+            ntci::TimerCallback timerCallback =
+                d_streamSocket_sp->createTimerCallback(
+                    NTCCFG_BIND(&Session::processTimer,
+                                this->getSelf(this),
+                                response,
+                                NTCCFG_BIND_PLACEHOLDER_1,
+                                NTCCFG_BIND_PLACEHOLDER_2));
+
+            bsl::shared_ptr<ntci::Timer> timer =
+                d_streamSocket_sp->createTimer(timerOptions, timerCallback);
+
+            timer->schedule(d_streamSocket_sp->currentTime() +
+                            request.responseDelay());
+        }
+        else {
+            this->send(&response);
+        }
+    }
+
+    /// Process the deadline of the specified 'timer' by sending the
+    /// specified 'response'.
+    void processTimer(ntsd::Message                       response,
+                      const bsl::shared_ptr<ntci::Timer>& timer,
+                      const ntca::TimerEvent&             event)
+    {
+        NTCCFG_WARNING_UNUSED(timer);
+
+        if (event.type() == ntca::TimerEventType::e_DEADLINE) {
+            this->send(&response);
+        }
+    }
+
+    /// Stamp the specified 'response' with the current time and send it.
+    void send(ntsd::Message* response)
+    {
+        response->setResponseTimestamp(bdlt::CurrentTime::now());
+
+        bdlbb::Blob data(d_streamSocket_sp->outgoingBlobBufferFactory().get());
+        response->encode(&data);
+
+        d_streamSocket_sp->send(data, ntca::SendOptions());
+    }
+
+  public:
+    /// Create a new session for the specified 'streamSocket'.
+    explicit Session(const bsl::shared_ptr<ntci::StreamSocket>& streamSocket)
+    : d_streamSocket_sp(streamSocket)
+    , d_parser()
+    , d_readQueue(streamSocket->incomingBlobBufferFactory().get())
+    , d_numNeeded(static_cast<int>(sizeof(ntsd::MessageHeader)))
+    {
+    }
+
+    /// Receive at least enough data to make progress parsing the next
+    /// message.
+    void receive()
+    {
+        int minSize = d_numNeeded - d_readQueue.length();
+        if (minSize < 1) {
+            minSize = 1;
+        }
+
+        ntca::ReceiveOptions options;
+        options.setMinSize(static_cast<bsl::size_t>(minSize));
+        options.setMaxSize(static_cast<bsl::size_t>(minSize) + 65536);
+
+        d_streamSocket_sp->receive(
+            options,
+            NTCCFG_BIND(&Session::processReceive,
+                        this->getSelf(this),
+                        NTCCFG_BIND_PLACEHOLDER_1,
+                        NTCCFG_BIND_PLACEHOLDER_2,
+                        NTCCFG_BIND_PLACEHOLDER_3));
+    }
+};
+
+/// Provide a listener that creates a session for each connection accepted.
+class Server
+{
+    bsl::shared_ptr<ntci::ListenerSocket> d_listenerSocket_sp;
+
+  private:
+    Server(const Server&) BSLS_KEYWORD_DELETED;
+    Server& operator=(const Server&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Process the acceptance of the specified 'streamSocket' according to
+    /// the specified 'event'.
+    void processAccept(const bsl::shared_ptr<ntci::Acceptor>&     acceptor,
+                       const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+                       const ntca::AcceptEvent&                   event)
+    {
+        NTCCFG_WARNING_UNUSED(acceptor);
+
+        if (event.type() == ntca::AcceptEventType::e_ERROR) {
+            return;
+        }
+
+        bsl::shared_ptr<Session> session;
+        session.createInplace(bslma::Default::allocator(), streamSocket);
+
+        session->receive();
+
+        this->accept();
+    }
+
+  public:
+    /// Create a new server for the specified 'listenerSocket'.
+    explicit Server(
+        const bsl::shared_ptr<ntci::ListenerSocket>& listenerSocket)
+    : d_listenerSocket_sp(listenerSocket)
+    {
+    }
+
+    /// Accept the next connection.
+    void accept()
+    {
+        d_listenerSocket_sp->accept(
+            ntca::AcceptOptions(),
+            NTCCFG_BIND(&Server::processAccept,
+                        this,
+                        NTCCFG_BIND_PLACEHOLDER_1,
+                        NTCCFG_BIND_PLACEHOLDER_2,
+                        NTCCFG_BIND_PLACEHOLDER_3));
+    }
+
+    /// Close the listener socket and block until it is closed.
+    void close()
+    {
+        ntci::ListenerSocketCloseGuard guard(d_listenerSocket_sp);
+    }
+};
+
+}  // close namespace 'loadserver'
+
+int main(int argc, char** argv)
+{
+    ntcf::System::initialize();
+    ntcf::System::ignore(ntscfg::Signal::e_PIPE);
+
+    loadserver::Parameters parameters;
+
+    for (int i = 1; i < argc; ++i) {
+        const bsl::string option(argv[i]);
+        if (i + 1 >= argc) {
+            bsl::cerr << "Missing value for option " << option << bsl::endl;
+            return 1;
+        }
+
+        const bsl::string value(argv[++i]);
+
+        bool valid = true;
+
+        if (option == "--driver") {
+            parameters.d_driverName = value;
+        }
+        else if (option == "--threads") {
+            parameters.d_numThreads = bsl::strtoul(value.c_str(), 0, 10);
+            valid                   = parameters.d_numThreads > 0;
+        }
+        else if (option == "--listen") {
+            valid = parameters.d_endpoint.parse(value);
+        }
+        else if (option == "--duration") {
+            parameters.d_duration = bsl::strtoul(value.c_str(), 0, 10);
+        }
+        else {
+            valid = false;
+        }
+
+        if (!valid) {
+            bsl::cerr << "Invalid option " << option << " " << value
+                      << bsl::endl;
+            return 1;
+        }
+    }
+
+    ntsa::Error error;
+
+    ntca::InterfaceConfig interfaceConfig;
+    interfaceConfig.setMetricName("server");
+    interfaceConfig.setThreadName("server");
+    interfaceConfig.setMinThreads(parameters.d_numThreads);
+    interfaceConfig.setMaxThreads(parameters.d_numThreads);
+
+    if (!parameters.d_driverName.empty()) {
+        interfaceConfig.setDriverName(parameters.d_driverName);
+    }
+
+    bsl::shared_ptr<ntci::Interface> interface =
+        ntcf::System::createInterface(interfaceConfig);
+
+    error = interface->start();
+    if (error) {
+        bsl::cerr << "Failed to start interface: " << error << bsl::endl;
+        return 1;
+    }
+
+    ntca::ListenerSocketOptions listenerSocketOptions;
+    listenerSocketOptions.setTransport(
+        parameters.d_endpoint.isIp() &&
+                parameters.d_endpoint.ip().host().isV6()
+            ? ntsa::Transport::e_TCP_IPV6_STREAM
+            : ntsa::Transport::e_TCP_IPV4_STREAM);
+    listenerSocketOptions.setSourceEndpoint(parameters.d_endpoint);
+    listenerSocketOptions.setReuseAddress(true);
+    listenerSocketOptions.setNoDelay(true);
+
+    bsl::shared_ptr<ntci::ListenerSocket> listenerSocket =
+        interface->createListenerSocket(listenerSocketOptions);
+
+    error = listenerSocket->open();
+    if (!error) {
+        error = listenerSocket->listen();
+    }
+
+    if (error) {
+        bsl::cerr << "Failed to listen at " << parameters.d_endpoint << ": "
+                  << error << bsl::endl;
+        return 1;
+    }
+
+    loadserver::Server server(listenerSocket);
+    server.accept();
+
+    bsl::cout << "{\"endpoint\":\"" << listenerSocket->sourceEndpoint()
+              << "\"}" << bsl::endl;
+
+    if (parameters.d_duration == 0) {
+        while (true) {
+            bslmt::ThreadUtil::sleep(bsls::TimeInterval(60));
+        }
+    }
+
+    bslmt::ThreadUtil::sleep(
+        bsls::TimeInterval(static_cast<double>(parameters.d_duration)));
+
+    server.close();
+
+    interface->shutdown();
+    interface->linger();
+
+    return 0;
+}
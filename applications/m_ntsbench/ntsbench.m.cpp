@@ -0,0 +1,441 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntsa_domainname.h>
+#include <ntsa_endpoint.h>
+#include <ntsa_ipaddress.h>
+#include <ntsa_ipv4address.h>
+#include <ntsa_ipv6address.h>
+#include <ntsa_uri.h>
+#include <bslh_hash.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+// This application measures the cost of the operations performed on the
+// value-semantic types of 'ntsa' on the hot paths of connecting and
+// resolving: parsing each type from its textual representation, formatting
+// it back into text, hashing it, comparing it, and copying it. Each
+// operation is repeated over a fixed corpus of representative values, so
+// that the results of different builds are directly comparable.
+//
+// The results of each measurement are written to standard output as one
+// JSON object per line, suitable for collection and comparison between
+// releases.
+//
+// Usage:
+//
+//     ntsbench [--type <name>[,<name>...]]
+//              [--operation <name>[,<name>...]]
+//              [--iterations <count>]
+//
+// The types are "ipv4address", "ipv6address", "ipaddress", "endpoint",
+// "uri", and "domainname". The operations are "parse", "format", "hash",
+// "compare", and "copy". By default every operation is measured for every
+// type over 1000000 iterations.
+
+namespace benchmark {
+
+const char* const IPV4_ADDRESS_CORPUS[] = {
+    "127.0.0.1",
+    "10.0.0.1",
+    "192.168.1.254",
+    "172.16.31.7",
+    "255.255.255.255",
+    "0.0.0.0",
+    "8.8.4.4",
+    "100.64.12.200"
+};
+
+const char* const IPV6_ADDRESS_CORPUS[] = {
+    "::1",
+    "::",
+    "fe80::1ff:fe23:4567:890a",
+    "2001:db8::8a2e:370:7334",
+    "2001:0db8:85a3:0000:0000:8a2e:0370:7334",
+    "fe80::1ff:fe23:4567:890a%3",
+    "2001:db8:0:0:1:0:0:1",
+    "ff02::2"
+};
+
+const char* const IP_ADDRESS_CORPUS[] = {
+    "127.0.0.1",
+    "::1",
+    "10.0.0.1",
+    "2001:db8::8a2e:370:7334",
+    "192.168.1.254",
+    "fe80::1ff:fe23:4567:890a",
+    "8.8.4.4",
+    "ff02::2"
+};
+
+const char* const ENDPOINT_CORPUS[] = {
+    "127.0.0.1:80",
+    "[::1]:443",
+    "10.0.0.1:12345",
+    "[2001:db8::8a2e:370:7334]:8080",
+    "192.168.1.254:65535",
+    "[fe80::1ff:fe23:4567:890a]:53",
+    "0.0.0.0:0",
+    "/tmp/ntf/benchmark.sock"
+};
+
+const char* const URI_CORPUS[] = {
+    "http://example.com",
+    "https://user@www.example.com:8443/path/to/resource",
+    "tcp://127.0.0.1:12345",
+    "https://www.example.com/index.html?k1=p1&k2=p2#anchor",
+    "udp://dns.example.net:53",
+    "http://example.com/search?q=network&limit=10",
+    "tcp://user@host.domain:12345/path/to?k1=p1#anchor",
+    "https://api.example.org/v1/items/42"
+};
+
+const char* const DOMAIN_NAME_CORPUS[] = {
+    "localhost",
+    "example.com",
+    "www.example.com",
+    "api.service.internal.example.org",
+    "a.b.c.d.e.f.example.net",
+    "dns.google",
+    "mail-01.eu-west.example.co.uk",
+    "very-long-label-for-measurement.subdomain.example.com"
+};
+
+/// Describe the parameters of the benchmark.
+struct Parameters {
+    bsl::vector<bsl::string> d_types;
+    bsl::vector<bsl::string> d_operations;
+    bsl::size_t              d_numIterations;
+
+    Parameters()
+    : d_types()
+    , d_operations()
+    , d_numIterations(1000000)
+    {
+    }
+};
+
+/// Describe a type measured by this benchmark.
+struct TypeDescription {
+    /// Define a type alias for a function to measure each operation named
+    /// in the specified 'parameters' on the type described by the specified
+    /// 'description' and write the results to the specified 'stream'.
+    typedef void (*Function)(bsl::ostream&          stream,
+                             const TypeDescription& description,
+                             const Parameters&      parameters);
+
+    const char*        d_name;
+    const char*        d_typeName;
+    const char* const* d_corpus;
+    bsl::size_t        d_corpusSize;
+    Function           d_function;
+};
+
+/// Accumulate results so that the compiler does not elide the measured
+/// operations.
+volatile bsl::size_t s_sink;
+
+/// Provide the formatting of a value into text.
+template <typename TYPE>
+struct Formatter {
+    /// Format the specified 'value' and return the number of characters
+    /// formatted.
+    static bsl::size_t format(const TYPE& value)
+    {
+        return value.text().size();
+    }
+};
+
+/// Provide the formatting of an IPv4 address into text, without allocating
+/// memory, as performed on hot paths.
+template <>
+struct Formatter<ntsa::Ipv4Address> {
+    /// Format the specified 'value' and return the number of characters
+    /// formatted.
+    static bsl::size_t format(const ntsa::Ipv4Address& value)
+    {
+        char buffer[ntsa::Ipv4Address::MAX_TEXT_LENGTH + 1];
+        return value.format(buffer, sizeof buffer);
+    }
+};
+
+/// Provide the formatting of an IPv6 address into text, without allocating
+/// memory, as performed on hot paths.
+template <>
+struct Formatter<ntsa::Ipv6Address> {
+    /// Format the specified 'value' and return the number of characters
+    /// formatted.
+    static bsl::size_t format(const ntsa::Ipv6Address& value)
+    {
+        char buffer[ntsa::Ipv6Address::MAX_TEXT_LENGTH + 1];
+        return value.format(buffer, sizeof buffer);
+    }
+};
+
+/// Provide the measurement of the operations on a value-semantic 'TYPE'.
+template <typename TYPE>
+struct Suite {
+    /// Measure each operation named in the specified 'parameters' on the
+    /// type described by the specified 'description' and write the results
+    /// to the specified 'stream'.
+    static void run(bsl::ostream&          stream,
+                    const TypeDescription& description,
+                    const Parameters&      parameters);
+
+    /// Return the number of nanoseconds elapsed performing the specified
+    /// 'operation' the specified 'numIterations' times over the specified
+    /// 'corpus' and its parsed 'values', or a negative value if the
+    /// 'operation' is unknown.
+    static bsls::Types::Int64 measure(
+        const bsl::string&       operation,
+        bsl::size_t              numIterations,
+        const TypeDescription&   corpus,
+        const bsl::vector<TYPE>& values);
+};
+
+template <typename TYPE>
+void Suite<TYPE>::run(bsl::ostream&          stream,
+                      const TypeDescription& description,
+                      const Parameters&      parameters)
+{
+    bsl::vector<TYPE> values;
+    values.reserve(description.d_corpusSize);
+
+    for (bsl::size_t i = 0; i < description.d_corpusSize; ++i) {
+        TYPE value;
+        if (!value.parse(description.d_corpus[i])) {
+            bsl::cerr << "Failed to parse " << description.d_typeName << " '"
+                      << description.d_corpus[i] << "'" << bsl::endl;
+            bsl::exit(1);
+        }
+
+        values.push_back(value);
+    }
+
+    for (bsl::size_t i = 0; i < parameters.d_operations.size(); ++i) {
+        const bsl::string& operation = parameters.d_operations[i];
+
+        // Warm the caches and the branch predictors before measuring.
+
+        Suite<TYPE>::measure(
+            operation, description.d_corpusSize, description, values);
+
+        const bsls::Types::Int64 elapsed = Suite<TYPE>::measure(
+            operation, parameters.d_numIterations, description, values);
+
+        if (elapsed < 0) {
+            continue;
+        }
+
+        stream << "{\"type\":\"" << description.d_typeName << "\""
+               << ",\"operation\":\"" << operation << "\""
+               << ",\"corpus\":" << description.d_corpusSize
+               << ",\"iterations\":" << parameters.d_numIterations
+               << ",\"nanoseconds\":" << elapsed
+               << ",\"nanosecondsPerOperation\":" << bsl::fixed
+               << bsl::setprecision(2)
+               << static_cast<double>(elapsed) /
+                      static_cast<double>(parameters.d_numIterations)
+               << "}" << bsl::endl;
+    }
+}
+
+template <typename TYPE>
+bsls::Types::Int64 Suite<TYPE>::measure(
+    const bsl::string&       operation,
+    bsl::size_t              numIterations,
+    const TypeDescription&   corpus,
+    const bsl::vector<TYPE>& values)
+{
+    const bsl::size_t n = corpus.d_corpusSize;
+
+    bsl::size_t result = 0;
+
+    bsls::Types::Int64 startTime = 0;
+
+    if (operation == "parse") {
+        TYPE value;
+        startTime = bsls::TimeUtil::getTimer();
+        for (bsl::size_t i = 0; i < numIterations; ++i) {
+            result += value.parse(corpus.d_corpus[i % n]) ? 1 : 0;
+        }
+    }
+    else if (operation == "format") {
+        startTime = bsls::TimeUtil::getTimer();
+        for (bsl::size_t i = 0; i < numIterations; ++i) {
+            result += Formatter<TYPE>::format(values[i % n]);
+        }
+    }
+    else if (operation == "hash") {
+        bslh::Hash<> hasher;
+        startTime = bsls::TimeUtil::getTimer();
+        for (bsl::size_t i = 0; i < numIterations; ++i) {
+            result += hasher(values[i % n]);
+        }
+    }
+    else if (operation == "compare") {
+        startTime = bsls::TimeUtil::getTimer();
+        for (bsl::size_t i = 0; i < numIterations; ++i) {
+            const TYPE& lhs = values[i % n];
+            const TYPE& rhs = values[(i + 1) % n];
+            result += (lhs == rhs) ? 1 : 0;
+            result += (lhs < rhs) ? 1 : 0;
+        }
+    }
+    else if (operation == "copy") {
+        bsl::vector<TYPE> targets(values);
+        startTime = bsls::TimeUtil::getTimer();
+        for (bsl::size_t i = 0; i < numIterations; ++i) {
+            targets[i % n] = values[(i + 1) % n];
+        }
+        result += targets.size();
+    }
+    else {
+        return -1;
+    }
+
+    const bsls::Types::Int64 elapsed =
+        bsls::TimeUtil::getTimer() - startTime;
+
+    s_sink = s_sink + result;
+
+    return elapsed;
+}
+
+/// Return true if the specified 'name' is in the specified 'names',
+/// otherwise return false.
+bool contains(const bsl::vector<bsl::string>& names, const char* name)
+{
+    for (bsl::size_t i = 0; i < names.size(); ++i) {
+        if (names[i] == name) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/// Load into the specified 'result' each comma-separated field of the
+/// specified 'text'.
+void split(bsl::vector<bsl::string>* result, const bsl::string& text)
+{
+    result->clear();
+
+    bsl::size_t begin = 0;
+    while (begin <= text.size()) {
+        bsl::size_t end = text.find(',', begin);
+        if (end == bsl::string::npos) {
+            end = text.size();
+        }
+
+        if (end > begin) {
+            result->push_back(text.substr(begin, end - begin));
+        }
+
+        begin = end + 1;
+    }
+}
+
+#define NTSBENCH_TYPE(name, type, corpus)                                     \
+    {                                                                         \
+        name, #type, corpus, sizeof corpus / sizeof corpus[0],                \
+            &Suite<type>::run                                                 \
+    }
+
+const TypeDescription TYPES[] = {
+    NTSBENCH_TYPE("ipv4address", ntsa::Ipv4Address, IPV4_ADDRESS_CORPUS),
+    NTSBENCH_TYPE("ipv6address", ntsa::Ipv6Address, IPV6_ADDRESS_CORPUS),
+    NTSBENCH_TYPE("ipaddress", ntsa::IpAddress, IP_ADDRESS_CORPUS),
+    NTSBENCH_TYPE("endpoint", ntsa::Endpoint, ENDPOINT_CORPUS),
+    NTSBENCH_TYPE("uri", ntsa::Uri, URI_CORPUS),
+    NTSBENCH_TYPE("domainname", ntsa::DomainName, DOMAIN_NAME_CORPUS)
+};
+
+#undef NTSBENCH_TYPE
+
+}  // close namespace 'benchmark'
+
+int main(int argc, char** argv)
+{
+    benchmark::Parameters parameters;
+
+    for (int i = 1; i < argc; ++i) {
+        const bsl::string option(argv[i]);
+        if (i + 1 >= argc) {
+            bsl::cerr << "Missing value for option " << option << bsl::endl;
+            return 1;
+        }
+
+        const bsl::string value(argv[++i]);
+
+        bool valid = true;
+
+        if (option == "--type") {
+            benchmark::split(&parameters.d_types, value);
+        }
+        else if (option == "--operation") {
+            benchmark::split(&parameters.d_operations, value);
+        }
+        else if (option == "--iterations") {
+            char*         end = 0;
+            unsigned long n   = bsl::strtoul(value.c_str(), &end, 10);
+            valid             = end != value.c_str() && *end == 0 && n > 0;
+            if (valid) {
+                parameters.d_numIterations = static_cast<bsl::size_t>(n);
+            }
+        }
+        else {
+            valid = false;
+        }
+
+        if (!valid) {
+            bsl::cerr << "Invalid option " << option << " " << value
+                      << bsl::endl;
+            return 1;
+        }
+    }
+
+    if (parameters.d_operations.empty()) {
+        parameters.d_operations.push_back("parse");
+        parameters.d_operations.push_back("format");
+        parameters.d_operations.push_back("hash");
+        parameters.d_operations.push_back("compare");
+        parameters.d_operations.push_back("copy");
+    }
+
+    const bsl::size_t numTypes =
+        sizeof benchmark::TYPES / sizeof benchmark::TYPES[0];
+
+    for (bsl::size_t i = 0; i < numTypes; ++i) {
+        const benchmark::TypeDescription& type = benchmark::TYPES[i];
+
+        if (!parameters.d_types.empty() &&
+            !benchmark::contains(parameters.d_types, type.d_name))
+        {
+            continue;
+        }
+
+        type.d_function(bsl::cout, type, parameters);
+    }
+
+    return 0;
+}
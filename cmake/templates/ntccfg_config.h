@@ -115,6 +115,9 @@ namespace ntccfg {
 // Build with metrics.
 #define NTC_BUILD_WITH_METRICS @NTF_BUILD_WITH_METRICS@
 
+// Build with USDT static tracepoints. Tracepoints are available on Linux.
+#define NTC_BUILD_WITH_TRACEPOINTS @NTF_BUILD_WITH_TRACEPOINTS@
+
 // Build with branch prediction.
 #define NTC_BUILD_WITH_BRANCH_PREDICTION @NTF_BUILD_WITH_BRANCH_PREDICTION@
 
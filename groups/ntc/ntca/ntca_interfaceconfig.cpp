@@ -71,6 +71,7 @@ InterfaceConfig::InterfaceConfig(bslma::Allocator* basicAllocator)
 , d_multicastTimeToLive()
 , d_multicastInterface()
 , d_dynamicLoadBalancing()
+, d_numaAware()
 , d_driverMetrics()
 , d_driverMetricsPerWaiter()
 , d_socketMetrics()
@@ -128,6 +129,7 @@ InterfaceConfig::InterfaceConfig(const InterfaceConfig& other,
 , d_multicastTimeToLive(other.d_multicastTimeToLive)
 , d_multicastInterface(other.d_multicastInterface)
 , d_dynamicLoadBalancing(other.d_dynamicLoadBalancing)
+, d_numaAware(other.d_numaAware)
 , d_driverMetrics(other.d_driverMetrics)
 , d_driverMetricsPerWaiter(other.d_driverMetricsPerWaiter)
 , d_socketMetrics(other.d_socketMetrics)
@@ -192,6 +194,7 @@ InterfaceConfig& InterfaceConfig::operator=(const InterfaceConfig& other)
         d_multicastTimeToLive       = other.d_multicastTimeToLive;
         d_multicastInterface        = other.d_multicastInterface;
         d_dynamicLoadBalancing      = other.d_dynamicLoadBalancing;
+        d_numaAware                 = other.d_numaAware;
         d_driverMetrics             = other.d_driverMetrics;
         d_driverMetricsPerWaiter    = other.d_driverMetricsPerWaiter;
         d_socketMetrics             = other.d_socketMetrics;
@@ -433,6 +436,11 @@ void InterfaceConfig::setDynamicLoadBalancing(bool value)
     d_dynamicLoadBalancing = value;
 }
 
+void InterfaceConfig::setNumaAware(bool value)
+{
+    d_numaAware = value;
+}
+
 void InterfaceConfig::setDriverMetrics(bool value)
 {
     d_driverMetrics = value;
@@ -714,6 +722,11 @@ const bdlb::NullableValue<bool>& InterfaceConfig::dynamicLoadBalancing() const
     return d_dynamicLoadBalancing;
 }
 
+const bdlb::NullableValue<bool>& InterfaceConfig::numaAware() const
+{
+    return d_numaAware;
+}
+
 const bdlb::NullableValue<bool>& InterfaceConfig::driverMetrics() const
 {
     return d_driverMetrics;
@@ -943,6 +956,10 @@ bsl::ostream& InterfaceConfig::print(bsl::ostream& stream,
         printer.printAttribute("dynamicLoadBalancing", d_dynamicLoadBalancing);
     }
 
+    if (!d_numaAware.isNull()) {
+        printer.printAttribute("numaAware", d_numaAware);
+    }
+
     if (!d_driverMetrics.isNull()) {
         printer.printAttribute("driverMetrics", d_driverMetrics);
     }
@@ -273,6 +273,13 @@ namespace ntca {
 /// When set to false, this option indicates the user favors greater efficiency
 /// and throughput at the expense of a larger variance in latency.
 ///
+/// @li @b numaAware:
+/// The flag that indicates one data pool should be created for each NUMA
+/// node, each thread bound to the CPUs of a node, and each socket supplied
+/// buffers from the data pool of the node on which its thread runs. This
+/// option is ignored when dynamic load balancing is enabled or when the
+/// machine has a single NUMA node.
+///
 /// @li @b driverMetrics:
 /// The flag that indicates driver metrics should be collected.
 ///
@@ -358,6 +365,7 @@ class InterfaceConfig
     bdlb::NullableValue<ntsa::IpAddress> d_multicastInterface;
 
     bdlb::NullableValue<bool> d_dynamicLoadBalancing;
+    bdlb::NullableValue<bool> d_numaAware;
 
     bdlb::NullableValue<bool> d_driverMetrics;
     bdlb::NullableValue<bool> d_driverMetricsPerWaiter;
@@ -552,6 +560,11 @@ class InterfaceConfig
     /// to the specified 'value'.
     void setDynamicLoadBalancing(bool value);
 
+    /// Set the flag that indicates one data pool should be created for
+    /// each NUMA node and each thread bound to the CPUs of a node to the
+    /// specified 'value'.
+    void setNumaAware(bool value);
+
     /// Set the flag that indicates driver metrics should be collected to
     /// the specified 'value'.
     void setDriverMetrics(bool value);
@@ -740,6 +753,10 @@ class InterfaceConfig
     /// dynamically rather than statically at the time of socket creation.
     const bdlb::NullableValue<bool>& dynamicLoadBalancing() const;
 
+    /// Return the flag that indicates one data pool should be created for
+    /// each NUMA node and each thread bound to the CPUs of a node.
+    const bdlb::NullableValue<bool>& numaAware() const;
+
     /// Set the flag that indicates driver metrics should be collected to
     /// the specified 'value'.
     const bdlb::NullableValue<bool>& driverMetrics() const;
@@ -64,6 +64,13 @@ ListenerSocketOptions::ListenerSocketOptions()
 , d_timestampOutgoingData()
 , d_timestampIncomingData()
 , d_zeroCopyThreshold()
+, d_receiveFramer()
+, d_sendCoalescing()
+, d_sendCoalescingWindow()
+, d_tcpInfoInterval()
+, d_adaptiveWriteQueue()
+, d_unsentLowWatermark()
+, d_encryptionOffload()
 , d_loadBalancingOptions()
 {
 }
@@ -104,6 +111,13 @@ ListenerSocketOptions::ListenerSocketOptions(
 , d_timestampOutgoingData(other.d_timestampOutgoingData)
 , d_timestampIncomingData(other.d_timestampIncomingData)
 , d_zeroCopyThreshold(other.d_zeroCopyThreshold)
+, d_receiveFramer(other.d_receiveFramer)
+, d_sendCoalescing(other.d_sendCoalescing)
+, d_sendCoalescingWindow(other.d_sendCoalescingWindow)
+, d_tcpInfoInterval(other.d_tcpInfoInterval)
+, d_adaptiveWriteQueue(other.d_adaptiveWriteQueue)
+, d_unsentLowWatermark(other.d_unsentLowWatermark)
+, d_encryptionOffload(other.d_encryptionOffload)
 , d_loadBalancingOptions(other.d_loadBalancingOptions)
 {
 }
@@ -152,6 +166,13 @@ ListenerSocketOptions& ListenerSocketOptions::operator=(
         d_timestampOutgoingData     = other.d_timestampOutgoingData;
         d_timestampIncomingData     = other.d_timestampIncomingData;
         d_zeroCopyThreshold         = other.d_zeroCopyThreshold;
+        d_receiveFramer             = other.d_receiveFramer;
+        d_sendCoalescing            = other.d_sendCoalescing;
+        d_sendCoalescingWindow      = other.d_sendCoalescingWindow;
+        d_tcpInfoInterval           = other.d_tcpInfoInterval;
+        d_adaptiveWriteQueue        = other.d_adaptiveWriteQueue;
+        d_unsentLowWatermark        = other.d_unsentLowWatermark;
+        d_encryptionOffload         = other.d_encryptionOffload;
         d_loadBalancingOptions      = other.d_loadBalancingOptions;
     }
 
@@ -331,6 +352,42 @@ void ListenerSocketOptions::setZeroCopyThreshold(bsl::size_t value)
     d_zeroCopyThreshold = value;
 }
 
+void ListenerSocketOptions::setReceiveFramer(const ntca::ReceiveFramer& value)
+{
+    d_receiveFramer = value;
+}
+
+void ListenerSocketOptions::setSendCoalescing(bool value)
+{
+    d_sendCoalescing = value;
+}
+
+void ListenerSocketOptions::setSendCoalescingWindow(
+    const bsls::TimeInterval& value)
+{
+    d_sendCoalescingWindow = value;
+}
+
+void ListenerSocketOptions::setTcpInfoInterval(const bsls::TimeInterval& value)
+{
+    d_tcpInfoInterval = value;
+}
+
+void ListenerSocketOptions::setAdaptiveWriteQueue(bool value)
+{
+    d_adaptiveWriteQueue = value;
+}
+
+void ListenerSocketOptions::setUnsentLowWatermark(bsl::size_t value)
+{
+    d_unsentLowWatermark = value;
+}
+
+void ListenerSocketOptions::setEncryptionOffload(bool value)
+{
+    d_encryptionOffload = value;
+}
+
 void ListenerSocketOptions::setLoadBalancingOptions(
     const ntca::LoadBalancingOptions& value)
 {
@@ -529,6 +586,47 @@ const bdlb::NullableValue<bsl::size_t>& ListenerSocketOptions::
     return d_zeroCopyThreshold;
 }
 
+const bdlb::NullableValue<ntca::ReceiveFramer>& ListenerSocketOptions::
+    receiveFramer() const
+{
+    return d_receiveFramer;
+}
+
+const bdlb::NullableValue<bool>& ListenerSocketOptions::sendCoalescing() const
+{
+    return d_sendCoalescing;
+}
+
+const bdlb::NullableValue<bsls::TimeInterval>& ListenerSocketOptions::
+    sendCoalescingWindow() const
+{
+    return d_sendCoalescingWindow;
+}
+
+const bdlb::NullableValue<bsls::TimeInterval>& ListenerSocketOptions::
+    tcpInfoInterval() const
+{
+    return d_tcpInfoInterval;
+}
+
+const bdlb::NullableValue<bool>& ListenerSocketOptions::adaptiveWriteQueue()
+    const
+{
+    return d_adaptiveWriteQueue;
+}
+
+const bdlb::NullableValue<bsl::size_t>& ListenerSocketOptions::
+    unsentLowWatermark() const
+{
+    return d_unsentLowWatermark;
+}
+
+const bdlb::NullableValue<bool>& ListenerSocketOptions::encryptionOffload()
+    const
+{
+    return d_encryptionOffload;
+}
+
 const ntca::LoadBalancingOptions& ListenerSocketOptions::loadBalancingOptions()
     const
 {
@@ -578,6 +676,13 @@ bsl::ostream& ListenerSocketOptions::print(bsl::ostream& stream,
     printer.printAttribute("timestampOutgoingData", d_timestampOutgoingData);
     printer.printAttribute("timestampIncomingData", d_timestampIncomingData);
     printer.printAttribute("zeroCopyThreshold", d_zeroCopyThreshold);
+    printer.printAttribute("receiveFramer", d_receiveFramer);
+    printer.printAttribute("sendCoalescing", d_sendCoalescing);
+    printer.printAttribute("sendCoalescingWindow", d_sendCoalescingWindow);
+    printer.printAttribute("tcpInfoInterval", d_tcpInfoInterval);
+    printer.printAttribute("adaptiveWriteQueue", d_adaptiveWriteQueue);
+    printer.printAttribute("unsentLowWatermark", d_unsentLowWatermark);
+    printer.printAttribute("encryptionOffload", d_encryptionOffload);
     printer.printAttribute("loadBalancingOptions", d_loadBalancingOptions);
     printer.end();
     return stream;
@@ -619,6 +724,13 @@ bool operator==(const ListenerSocketOptions& lhs,
            lhs.timestampOutgoingData() == rhs.timestampOutgoingData() &&
            lhs.timestampIncomingData() == rhs.timestampIncomingData() &&
            lhs.zeroCopyThreshold() == rhs.zeroCopyThreshold() &&
+           lhs.receiveFramer() == rhs.receiveFramer() &&
+           lhs.sendCoalescing() == rhs.sendCoalescing() &&
+           lhs.sendCoalescingWindow() == rhs.sendCoalescingWindow() &&
+           lhs.tcpInfoInterval() == rhs.tcpInfoInterval() &&
+           lhs.adaptiveWriteQueue() == rhs.adaptiveWriteQueue() &&
+           lhs.unsentLowWatermark() == rhs.unsentLowWatermark() &&
+           lhs.encryptionOffload() == rhs.encryptionOffload() &&
            lhs.loadBalancingOptions() == rhs.loadBalancingOptions();
 }
 
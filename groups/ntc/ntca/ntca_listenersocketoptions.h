@@ -20,11 +20,13 @@
 BSLS_IDENT("$Id: $")
 
 #include <ntca_loadbalancingoptions.h>
+#include <ntca_receiveframer.h>
 #include <ntccfg_platform.h>
 #include <ntcscm_version.h>
 #include <ntsa_endpoint.h>
 #include <ntsa_transport.h>
 #include <bdlb_nullablevalue.h>
+#include <bsls_timeinterval.h>
 #include <bsl_iosfwd.h>
 
 namespace BloombergLP {
@@ -203,6 +205,64 @@ namespace ntca {
 /// The minimum number of bytes that must be available to send in order to
 /// attempt a zero-copy send.
 ///
+/// @li @b receiveFramer:
+/// The description of how messages are delimited in the read queue, applied
+/// to each receive operation that does not describe its own framing.
+///
+/// @li @b sendCoalescing:
+/// The flag indicating that data sent while the write queue is empty should
+/// not be copied to the socket send buffer immediately, but rather be
+/// coalesced with any other data sent until the end of the send coalescing
+/// window, then copied to the socket send buffer using as few system calls,
+/// and so as few partially-filled segments, as possible. Data sent with the
+/// 'flush' send option is copied immediately along with any data coalesced
+/// before it. When set to true, this option indicates the user favors higher
+/// throughput and fewer, larger segments, at the expense of higher latency
+/// for each individual send. The default value is false.
+///
+/// @li @b sendCoalescingWindow:
+/// The maximum duration for which data may be coalesced when the send
+/// coalescing option is set. If this value is zero or null, the data
+/// coalesced is flushed once the reactor has finished processing the events
+/// of the current iteration, so all data sent while processing those events
+/// is coalesced.
+///
+/// @li @b tcpInfoInterval:
+/// The interval at which the state of the TCP connection measured by the
+/// operating system, e.g. its smoothed round trip time, congestion window,
+/// retransmissions, and delivery rate, is sampled and recorded in the socket
+/// metrics. If null, the state of the TCP connection is not sampled. Note
+/// that this option is only supported on Linux.
+///
+/// @li @b adaptiveWriteQueue:
+/// The flag indicating that the write queue high watermark should be raised
+/// to twice the bandwidth-delay product of the connection each time the
+/// state of the TCP connection is sampled, but never below the write queue
+/// high watermark configured by the user. This option has no effect unless
+/// the state of the TCP connection is sampled. The default value is false.
+///
+/// @li @b unsentLowWatermark:
+/// The maximum number of bytes that may be buffered in the socket send
+/// buffer but not yet sent before the operating system stops indicating the
+/// socket is writable. Limiting the data buffered in the kernel keeps the
+/// data in the write queue, where it may still be coalesced or discarded,
+/// and reduces the latency of data sent later. If null, the operating
+/// system default is used. Note that this option is only supported on Linux
+/// and Darwin.
+///
+/// @li @b encryptionOffload:
+/// The flag indicating that, once the TLS handshake of an upgraded socket
+/// is complete, the record encryption of the session should be offloaded to
+/// the operating system, if supported by both the encryption driver and
+/// the platform. Only outgoing records are offloaded: data is sent as
+/// plaintext, so zero-copy transmission and file transmission may be used,
+/// while incoming records continue to be decrypted by the encryption
+/// session, so that records other than application data, such as a TLS 1.3
+/// NewSessionTicket, continue to be processed. If the encryption cannot be
+/// offloaded it continues to be performed by the encryption session. The
+/// default value is false. Note that this option is only supported on
+/// Linux.
+///
 /// @li @b loadBalancingOptions:
 /// The configurable parameters used select a reactor or proactor that drives
 /// the I/O for the socket.
@@ -213,41 +273,48 @@ namespace ntca {
 /// @ingroup module_ntci_socket
 class ListenerSocketOptions
 {
-    ntsa::Transport::Value              d_transport;
-    bdlb::NullableValue<ntsa::Endpoint> d_sourceEndpoint;
-    bool                                d_reuseAddress;
-    bdlb::NullableValue<bsl::size_t>    d_backlog;
-    bdlb::NullableValue<bsl::size_t>    d_acceptQueueLowWatermark;
-    bdlb::NullableValue<bsl::size_t>    d_acceptQueueHighWatermark;
-    bdlb::NullableValue<bsl::size_t>    d_readQueueLowWatermark;
-    bdlb::NullableValue<bsl::size_t>    d_readQueueHighWatermark;
-    bdlb::NullableValue<bsl::size_t>    d_writeQueueLowWatermark;
-    bdlb::NullableValue<bsl::size_t>    d_writeQueueHighWatermark;
-    bdlb::NullableValue<bsl::size_t>    d_minIncomingStreamTransferSize;
-    bdlb::NullableValue<bsl::size_t>    d_maxIncomingStreamTransferSize;
-    bdlb::NullableValue<bool>           d_acceptGreedily;
-    bdlb::NullableValue<bool>           d_sendGreedily;
-    bdlb::NullableValue<bool>           d_receiveGreedily;
-    bdlb::NullableValue<bsl::size_t>    d_sendBufferSize;
-    bdlb::NullableValue<bsl::size_t>    d_receiveBufferSize;
-    bdlb::NullableValue<bsl::size_t>    d_sendBufferLowWatermark;
-    bdlb::NullableValue<bsl::size_t>    d_receiveBufferLowWatermark;
-    bdlb::NullableValue<bsl::size_t>    d_sendTimeout;
-    bdlb::NullableValue<bsl::size_t>    d_receiveTimeout;
-    bdlb::NullableValue<bool>           d_keepAlive;
-    bdlb::NullableValue<bool>           d_noDelay;
-    bdlb::NullableValue<bool>           d_debugFlag;
-    bdlb::NullableValue<bool>           d_allowBroadcasting;
-    bdlb::NullableValue<bool>           d_bypassNormalRouting;
-    bdlb::NullableValue<bool>           d_leaveOutOfBandDataInline;
-    bdlb::NullableValue<bool>           d_lingerFlag;
-    bdlb::NullableValue<bsl::size_t>    d_lingerTimeout;
-    bdlb::NullableValue<bool>           d_keepHalfOpen;
-    bdlb::NullableValue<bool>           d_metrics;
-    bdlb::NullableValue<bool>           d_timestampOutgoingData;
-    bdlb::NullableValue<bool>           d_timestampIncomingData;
-    bdlb::NullableValue<bsl::size_t>    d_zeroCopyThreshold;
-    ntca::LoadBalancingOptions          d_loadBalancingOptions;
+    ntsa::Transport::Value                   d_transport;
+    bdlb::NullableValue<ntsa::Endpoint>      d_sourceEndpoint;
+    bool                                     d_reuseAddress;
+    bdlb::NullableValue<bsl::size_t>         d_backlog;
+    bdlb::NullableValue<bsl::size_t>         d_acceptQueueLowWatermark;
+    bdlb::NullableValue<bsl::size_t>         d_acceptQueueHighWatermark;
+    bdlb::NullableValue<bsl::size_t>         d_readQueueLowWatermark;
+    bdlb::NullableValue<bsl::size_t>         d_readQueueHighWatermark;
+    bdlb::NullableValue<bsl::size_t>         d_writeQueueLowWatermark;
+    bdlb::NullableValue<bsl::size_t>         d_writeQueueHighWatermark;
+    bdlb::NullableValue<bsl::size_t>         d_minIncomingStreamTransferSize;
+    bdlb::NullableValue<bsl::size_t>         d_maxIncomingStreamTransferSize;
+    bdlb::NullableValue<bool>                d_acceptGreedily;
+    bdlb::NullableValue<bool>                d_sendGreedily;
+    bdlb::NullableValue<bool>                d_receiveGreedily;
+    bdlb::NullableValue<bsl::size_t>         d_sendBufferSize;
+    bdlb::NullableValue<bsl::size_t>         d_receiveBufferSize;
+    bdlb::NullableValue<bsl::size_t>         d_sendBufferLowWatermark;
+    bdlb::NullableValue<bsl::size_t>         d_receiveBufferLowWatermark;
+    bdlb::NullableValue<bsl::size_t>         d_sendTimeout;
+    bdlb::NullableValue<bsl::size_t>         d_receiveTimeout;
+    bdlb::NullableValue<bool>                d_keepAlive;
+    bdlb::NullableValue<bool>                d_noDelay;
+    bdlb::NullableValue<bool>                d_debugFlag;
+    bdlb::NullableValue<bool>                d_allowBroadcasting;
+    bdlb::NullableValue<bool>                d_bypassNormalRouting;
+    bdlb::NullableValue<bool>                d_leaveOutOfBandDataInline;
+    bdlb::NullableValue<bool>                d_lingerFlag;
+    bdlb::NullableValue<bsl::size_t>         d_lingerTimeout;
+    bdlb::NullableValue<bool>                d_keepHalfOpen;
+    bdlb::NullableValue<bool>                d_metrics;
+    bdlb::NullableValue<bool>                d_timestampOutgoingData;
+    bdlb::NullableValue<bool>                d_timestampIncomingData;
+    bdlb::NullableValue<bsl::size_t>         d_zeroCopyThreshold;
+    bdlb::NullableValue<ntca::ReceiveFramer> d_receiveFramer;
+    bdlb::NullableValue<bool>                d_sendCoalescing;
+    bdlb::NullableValue<bsls::TimeInterval>  d_sendCoalescingWindow;
+    bdlb::NullableValue<bsls::TimeInterval>  d_tcpInfoInterval;
+    bdlb::NullableValue<bool>                d_adaptiveWriteQueue;
+    bdlb::NullableValue<bsl::size_t>         d_unsentLowWatermark;
+    bdlb::NullableValue<bool>                d_encryptionOffload;
+    ntca::LoadBalancingOptions               d_loadBalancingOptions;
 
   public:
     /// Create new listener socket options.
@@ -382,6 +449,37 @@ class ListenerSocketOptions
     /// to attempt a zero-copy send to the specified 'value'.
     void setZeroCopyThreshold(size_t value);
 
+    /// Set the description of how messages are delimited in the read queue
+    /// to the specified 'value'.
+    void setReceiveFramer(const ntca::ReceiveFramer& value);
+
+    /// Set the flag that controls whether sends are coalesced to the
+    /// specified 'value'.
+    void setSendCoalescing(bool value);
+
+    /// Set the maximum duration for which sends are coalesced to the
+    /// specified 'value'.
+    void setSendCoalescingWindow(const bsls::TimeInterval& value);
+
+    /// Set the interval at which the state of the TCP connection is sampled
+    /// to the specified 'value'.
+    void setTcpInfoInterval(const bsls::TimeInterval& value);
+
+    /// Set the flag that controls whether the write queue high watermark
+    /// adapts to the bandwidth-delay product of the connection to the
+    /// specified 'value'.
+    void setAdaptiveWriteQueue(bool value);
+
+    /// Set the maximum number of bytes buffered in the socket send buffer
+    /// but not yet sent before the socket is no longer writable to the
+    /// specified 'value'.
+    void setUnsentLowWatermark(bsl::size_t value);
+
+    /// Set the flag that controls whether the record encryption of an
+    /// established TLS session is offloaded to the operating system to the
+    /// specified 'value'.
+    void setEncryptionOffload(bool value);
+
     /// Set the load balancing options to the specified 'value'.
     void setLoadBalancingOptions(const ntca::LoadBalancingOptions& value);
 
@@ -497,6 +595,33 @@ class ListenerSocketOptions
     /// order to attempt a zero-copy send.
     const bdlb::NullableValue<bsl::size_t>& zeroCopyThreshold() const;
 
+    /// Return the description of how messages are delimited in the read
+    /// queue.
+    const bdlb::NullableValue<ntca::ReceiveFramer>& receiveFramer() const;
+
+    /// Return the flag that controls whether sends are coalesced.
+    const bdlb::NullableValue<bool>& sendCoalescing() const;
+
+    /// Return the maximum duration for which sends are coalesced.
+    const bdlb::NullableValue<bsls::TimeInterval>& sendCoalescingWindow()
+        const;
+
+    /// Return the interval at which the state of the TCP connection is
+    /// sampled.
+    const bdlb::NullableValue<bsls::TimeInterval>& tcpInfoInterval() const;
+
+    /// Return the flag that controls whether the write queue high watermark
+    /// adapts to the bandwidth-delay product of the connection.
+    const bdlb::NullableValue<bool>& adaptiveWriteQueue() const;
+
+    /// Return the maximum number of bytes buffered in the socket send buffer
+    /// but not yet sent before the socket is no longer writable.
+    const bdlb::NullableValue<bsl::size_t>& unsentLowWatermark() const;
+
+    /// Return the flag that controls whether the record encryption of an
+    /// established TLS session is offloaded to the operating system.
+    const bdlb::NullableValue<bool>& encryptionOffload() const;
+
     /// Return the load balancing options.
     const ntca::LoadBalancingOptions& loadBalancingOptions() const;
 
@@ -26,7 +26,8 @@ namespace ntca {
 bool ReceiveContext::equals(const ReceiveContext& other) const
 {
     return (d_endpoint == other.d_endpoint &&
-            d_transport == other.d_transport && d_error == other.d_error);
+            d_transport == other.d_transport && d_error == other.d_error &&
+            d_bytesReceived == other.d_bytesReceived);
 }
 
 bool ReceiveContext::less(const ReceiveContext& other) const
@@ -47,7 +48,15 @@ bool ReceiveContext::less(const ReceiveContext& other) const
         return false;
     }
 
-    return d_error < other.d_error;
+    if (d_error < other.d_error) {
+        return true;
+    }
+
+    if (other.d_error < d_error) {
+        return false;
+    }
+
+    return d_bytesReceived < other.d_bytesReceived;
 }
 
 bsl::ostream& ReceiveContext::print(bsl::ostream& stream,
@@ -63,6 +72,7 @@ bsl::ostream& ReceiveContext::print(bsl::ostream& stream,
 
     printer.printAttribute("transport", d_transport);
     printer.printAttribute("error", d_error);
+    printer.printAttribute("bytesReceived", d_bytesReceived);
     printer.end();
     return stream;
 }
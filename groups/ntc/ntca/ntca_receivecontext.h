@@ -46,6 +46,10 @@ namespace ntca {
 /// @li @b error:
 /// The error detected when performing the operation.
 ///
+/// @li @b bytesReceived:
+/// The number of bytes copied into the buffers supplied to the operation.
+/// This value is zero when the received data is instead described by a blob.
+///
 /// @par Thread Safety
 /// This class is not thread safe.
 ///
@@ -55,6 +59,7 @@ class ReceiveContext
     bdlb::NullableValue<ntsa::Endpoint> d_endpoint;
     ntsa::Transport::Value              d_transport;
     ntsa::Error                         d_error;
+    bsl::size_t                         d_bytesReceived;
 
   public:
     /// Create a new receive context having the default value.
@@ -86,6 +91,10 @@ class ReceiveContext
     /// specified 'value'.
     void setError(const ntsa::Error& value);
 
+    /// Set the number of bytes copied into the buffers supplied to the
+    /// operation to the specified 'value'.
+    void setBytesReceived(bsl::size_t value);
+
     /// Return the endpoint from which the data was sent. This value might
     /// be null for connected receivers.
     const bdlb::NullableValue<ntsa::Endpoint>& endpoint() const;
@@ -111,6 +120,10 @@ class ReceiveContext
     /// Return the error detected when performing the operation.
     const ntsa::Error& error() const;
 
+    /// Return the number of bytes copied into the buffers supplied to the
+    /// operation.
+    bsl::size_t bytesReceived() const;
+
     /// Return true if this object has the same value as the specified
     /// 'other' object, otherwise return false.
     bool equals(const ReceiveContext& other) const;
@@ -176,6 +189,7 @@ ReceiveContext::ReceiveContext()
 : d_endpoint()
 , d_transport(ntsa::Transport::e_UNDEFINED)
 , d_error()
+, d_bytesReceived(0)
 {
 }
 
@@ -184,6 +198,7 @@ ReceiveContext::ReceiveContext(const ReceiveContext& original)
 : d_endpoint(original.d_endpoint)
 , d_transport(original.d_transport)
 , d_error(original.d_error)
+, d_bytesReceived(original.d_bytesReceived)
 {
 }
 
@@ -195,9 +210,10 @@ ReceiveContext::~ReceiveContext()
 NTCCFG_INLINE
 ReceiveContext& ReceiveContext::operator=(const ReceiveContext& other)
 {
-    d_endpoint  = other.d_endpoint;
-    d_transport = other.d_transport;
-    d_error     = other.d_error;
+    d_endpoint      = other.d_endpoint;
+    d_transport     = other.d_transport;
+    d_error         = other.d_error;
+    d_bytesReceived = other.d_bytesReceived;
     return *this;
 }
 
@@ -205,8 +221,9 @@ NTCCFG_INLINE
 void ReceiveContext::reset()
 {
     d_endpoint.reset();
-    d_transport = ntsa::Transport::e_UNDEFINED;
-    d_error     = ntsa::Error();
+    d_transport     = ntsa::Transport::e_UNDEFINED;
+    d_error         = ntsa::Error();
+    d_bytesReceived = 0;
 }
 
 NTCCFG_INLINE
@@ -227,6 +244,12 @@ void ReceiveContext::setError(const ntsa::Error& value)
     d_error = value;
 }
 
+NTCCFG_INLINE
+void ReceiveContext::setBytesReceived(bsl::size_t value)
+{
+    d_bytesReceived = value;
+}
+
 NTCCFG_INLINE
 const bdlb::NullableValue<ntsa::Endpoint>& ReceiveContext::endpoint() const
 {
@@ -263,6 +286,12 @@ const ntsa::Error& ReceiveContext::error() const
     return d_error;
 }
 
+NTCCFG_INLINE
+bsl::size_t ReceiveContext::bytesReceived() const
+{
+    return d_bytesReceived;
+}
+
 NTCCFG_INLINE
 bsl::ostream& operator<<(bsl::ostream& stream, const ReceiveContext& object)
 {
@@ -295,6 +324,7 @@ void hashAppend(HASH_ALGORITHM& algorithm, const ReceiveContext& value)
     hashAppend(algorithm, value.endpoint());
     hashAppend(algorithm, value.transport());
     hashAppend(algorithm, value.error());
+    hashAppend(algorithm, value.bytesReceived());
 }
 
 }  // close package namespace
@@ -0,0 +1,113 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntca_receiveframer.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntca_receiveframer_cpp, "$Id$ $CSID$")
+
+#include <bslim_printer.h>
+
+namespace BloombergLP {
+namespace ntca {
+
+bool ReceiveFramer::equals(const ReceiveFramer& other) const
+{
+    return (d_type == other.d_type && d_lengthOffset == other.d_lengthOffset &&
+            d_lengthSize == other.d_lengthSize &&
+            d_bigEndian == other.d_bigEndian &&
+            d_lengthAdjustment == other.d_lengthAdjustment &&
+            this->delimiter() == other.delimiter() &&
+            d_strip == other.d_strip);
+}
+
+bool ReceiveFramer::less(const ReceiveFramer& other) const
+{
+    if (d_type < other.d_type) {
+        return true;
+    }
+
+    if (other.d_type < d_type) {
+        return false;
+    }
+
+    if (d_lengthOffset < other.d_lengthOffset) {
+        return true;
+    }
+
+    if (other.d_lengthOffset < d_lengthOffset) {
+        return false;
+    }
+
+    if (d_lengthSize < other.d_lengthSize) {
+        return true;
+    }
+
+    if (other.d_lengthSize < d_lengthSize) {
+        return false;
+    }
+
+    if (d_bigEndian < other.d_bigEndian) {
+        return true;
+    }
+
+    if (other.d_bigEndian < d_bigEndian) {
+        return false;
+    }
+
+    if (d_lengthAdjustment < other.d_lengthAdjustment) {
+        return true;
+    }
+
+    if (other.d_lengthAdjustment < d_lengthAdjustment) {
+        return false;
+    }
+
+    if (this->delimiter() < other.delimiter()) {
+        return true;
+    }
+
+    if (other.delimiter() < this->delimiter()) {
+        return false;
+    }
+
+    return d_strip < other.d_strip;
+}
+
+bsl::ostream& ReceiveFramer::print(bsl::ostream& stream,
+                                   int           level,
+                                   int           spacesPerLevel) const
+{
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    printer.printAttribute("type", d_type);
+
+    if (d_type == ntca::ReceiveFramerType::e_LENGTH) {
+        printer.printAttribute("lengthOffset", d_lengthOffset);
+        printer.printAttribute("lengthSize", d_lengthSize);
+        printer.printAttribute("bigEndian", d_bigEndian);
+        printer.printAttribute("lengthAdjustment", d_lengthAdjustment);
+    }
+    else if (d_type == ntca::ReceiveFramerType::e_DELIMITER) {
+        printer.printAttribute("delimiterSize", d_delimiterSize);
+    }
+
+    printer.printAttribute("strip", d_strip);
+    printer.end();
+    return stream;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,428 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCA_RECEIVEFRAMER
+#define INCLUDED_NTCA_RECEIVEFRAMER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntca_receiveframertype.h>
+#include <ntccfg_platform.h>
+#include <ntcscm_version.h>
+#include <bslh_hash.h>
+#include <bsls_assert.h>
+#include <bsls_types.h>
+#include <bsl_cstring.h>
+#include <bsl_iosfwd.h>
+#include <bsl_string.h>
+
+namespace BloombergLP {
+namespace ntca {
+
+/// Describe how messages are delimited in a stream.
+///
+/// @details
+/// A receive operation described by a framer is satisfied by exactly one
+/// complete message at the front of the read queue, regardless of the amount
+/// of data in the read queue. Messages may be delimited by a length header or
+/// by a trailing sequence of bytes.
+///
+/// @par Attributes
+/// This class is composed of the following attributes.
+///
+/// @li @b type:
+/// The method by which messages are delimited.
+///
+/// @li @b lengthOffset:
+/// The number of bytes at the front of each message that precede the length
+/// field, when messages are delimited by a length header. The default value
+/// is 0.
+///
+/// @li @b lengthSize:
+/// The width of the length field, in bytes, which must be between 1 and 8.
+/// The default value is 4.
+///
+/// @li @b bigEndian:
+/// The flag that indicates the length field is encoded in big-endian (i.e.,
+/// network) byte order, otherwise the length field is encoded in
+/// little-endian byte order. The default value is true.
+///
+/// @li @b lengthAdjustment:
+/// The number of bytes added to the value of the length field to compute the
+/// number of bytes that follow the length field. For example, when the value
+/// of the length field includes the size of the header, the adjustment is
+/// the negated sum of the length offset and the length size. The default
+/// value is 0.
+///
+/// @li @b delimiter:
+/// The sequence of at most 8 bytes that follows each message, when messages
+/// are delimited by a trailing sequence of bytes. The delimiter is not
+/// included in the message delivered to the user.
+///
+/// @li @b strip:
+/// The number of bytes removed from the front of each message before it is
+/// delivered to the user, for example, to remove the length header. The
+/// default value is 0.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntci_operation_receive
+class ReceiveFramer
+{
+  public:
+    /// Define a constant that defines the maximum size of a delimiter.
+    enum { k_MAX_DELIMITER_SIZE = 8 };
+
+  private:
+    ntca::ReceiveFramerType::Value d_type;
+    bsl::size_t                    d_lengthOffset;
+    bsl::size_t                    d_lengthSize;
+    bool                           d_bigEndian;
+    bsls::Types::Int64             d_lengthAdjustment;
+    char                           d_delimiter[k_MAX_DELIMITER_SIZE];
+    bsl::size_t                    d_delimiterSize;
+    bsl::size_t                    d_strip;
+
+  public:
+    /// Create a new receive framer having the default value.
+    ReceiveFramer();
+
+    /// Create a new receive framer having the same value as the specified
+    /// 'original' object.
+    ReceiveFramer(const ReceiveFramer& original);
+
+    /// Destroy this object.
+    ~ReceiveFramer();
+
+    /// Assign the value of the specified 'other' object to this object.
+    /// Return a reference to this modifiable object.
+    ReceiveFramer& operator=(const ReceiveFramer& other);
+
+    /// Reset the value of this object to its value upon default
+    /// construction.
+    void reset();
+
+    /// Set the method by which messages are delimited to the specified
+    /// 'value'.
+    void setType(ntca::ReceiveFramerType::Value value);
+
+    /// Set the number of bytes that precede the length field to the
+    /// specified 'value'.
+    void setLengthOffset(bsl::size_t value);
+
+    /// Set the width of the length field, in bytes, to the specified
+    /// 'value'. The behavior is undefined unless 'value' is between 1 and 8.
+    void setLengthSize(bsl::size_t value);
+
+    /// Set the flag that indicates the length field is encoded in big-endian
+    /// byte order to the specified 'value'.
+    void setBigEndian(bool value);
+
+    /// Set the number of bytes added to the value of the length field to
+    /// compute the number of bytes that follow the length field to the
+    /// specified 'value'.
+    void setLengthAdjustment(bsls::Types::Int64 value);
+
+    /// Set the sequence of bytes that follows each message to the specified
+    /// 'value'. The behavior is undefined unless the length of 'value' is
+    /// between 1 and 'k_MAX_DELIMITER_SIZE'.
+    void setDelimiter(const bslstl::StringRef& value);
+
+    /// Set the number of bytes removed from the front of each message to the
+    /// specified 'value'.
+    void setStrip(bsl::size_t value);
+
+    /// Return the method by which messages are delimited.
+    ntca::ReceiveFramerType::Value type() const;
+
+    /// Return the number of bytes that precede the length field.
+    bsl::size_t lengthOffset() const;
+
+    /// Return the width of the length field, in bytes.
+    bsl::size_t lengthSize() const;
+
+    /// Return the flag that indicates the length field is encoded in
+    /// big-endian byte order.
+    bool bigEndian() const;
+
+    /// Return the number of bytes added to the value of the length field to
+    /// compute the number of bytes that follow the length field.
+    bsls::Types::Int64 lengthAdjustment() const;
+
+    /// Return the sequence of bytes that follows each message.
+    bslstl::StringRef delimiter() const;
+
+    /// Return the number of bytes removed from the front of each message.
+    bsl::size_t strip() const;
+
+    /// Return true if this object has the same value as the specified
+    /// 'other' object, otherwise return false.
+    bool equals(const ReceiveFramer& other) const;
+
+    /// Return true if the value of this object is less than the value of
+    /// the specified 'other' object, otherwise return false.
+    bool less(const ReceiveFramer& other) const;
+
+    /// Format this object to the specified output 'stream' at the
+    /// optionally specified indentation 'level' and return a reference to
+    /// the modifiable 'stream'.  If 'level' is specified, optionally
+    /// specify 'spacesPerLevel', the number of spaces per indentation level
+    /// for this and all of its nested objects.  Each line is indented by
+    /// the absolute value of 'level * spacesPerLevel'.  If 'level' is
+    /// negative, suppress indentation of the first line.  If
+    /// 'spacesPerLevel' is negative, suppress line breaks and format the
+    /// entire output on one line.  If 'stream' is initially invalid, this
+    /// operation has no effect.  Note that a trailing newline is provided
+    /// in multiline mode only.
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level          = 0,
+                        int           spacesPerLevel = 4) const;
+
+    /// Defines the traits of this type. These traits can be used to select,
+    /// at compile-time, the most efficient algorithm to manipulate objects
+    /// of this type.
+    NTCCFG_DECLARE_NESTED_BITWISE_MOVABLE_TRAITS(ReceiveFramer);
+};
+
+/// Write the specified 'object' to the specified 'stream'. Return
+/// a modifiable reference to the 'stream'.
+///
+/// @related ntca::ReceiveFramer
+bsl::ostream& operator<<(bsl::ostream& stream, const ReceiveFramer& object);
+
+/// Return true if the specified 'lhs' has the same value as the specified
+/// 'rhs', otherwise return false.
+///
+/// @related ntca::ReceiveFramer
+bool operator==(const ReceiveFramer& lhs, const ReceiveFramer& rhs);
+
+/// Return true if the specified 'lhs' does not have the same value as the
+/// specified 'rhs', otherwise return false.
+///
+/// @related ntca::ReceiveFramer
+bool operator!=(const ReceiveFramer& lhs, const ReceiveFramer& rhs);
+
+/// Return true if the value of the specified 'lhs' is less than the value
+/// of the specified 'rhs', otherwise return false.
+///
+/// @related ntca::ReceiveFramer
+bool operator<(const ReceiveFramer& lhs, const ReceiveFramer& rhs);
+
+/// Contribute the values of the salient attributes of the specified 'value'
+/// to the specified hash 'algorithm'.
+///
+/// @related ntca::ReceiveFramer
+template <typename HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& algorithm, const ReceiveFramer& value);
+
+NTCCFG_INLINE
+ReceiveFramer::ReceiveFramer()
+: d_type(ntca::ReceiveFramerType::e_UNDEFINED)
+, d_lengthOffset(0)
+, d_lengthSize(4)
+, d_bigEndian(true)
+, d_lengthAdjustment(0)
+, d_delimiterSize(0)
+, d_strip(0)
+{
+    bsl::memset(d_delimiter, 0, sizeof d_delimiter);
+}
+
+NTCCFG_INLINE
+ReceiveFramer::ReceiveFramer(const ReceiveFramer& original)
+: d_type(original.d_type)
+, d_lengthOffset(original.d_lengthOffset)
+, d_lengthSize(original.d_lengthSize)
+, d_bigEndian(original.d_bigEndian)
+, d_lengthAdjustment(original.d_lengthAdjustment)
+, d_delimiterSize(original.d_delimiterSize)
+, d_strip(original.d_strip)
+{
+    bsl::memcpy(d_delimiter, original.d_delimiter, sizeof d_delimiter);
+}
+
+NTCCFG_INLINE
+ReceiveFramer::~ReceiveFramer()
+{
+}
+
+NTCCFG_INLINE
+ReceiveFramer& ReceiveFramer::operator=(const ReceiveFramer& other)
+{
+    if (this != &other) {
+        d_type             = other.d_type;
+        d_lengthOffset     = other.d_lengthOffset;
+        d_lengthSize       = other.d_lengthSize;
+        d_bigEndian        = other.d_bigEndian;
+        d_lengthAdjustment = other.d_lengthAdjustment;
+        d_delimiterSize    = other.d_delimiterSize;
+        d_strip            = other.d_strip;
+
+        bsl::memcpy(d_delimiter, other.d_delimiter, sizeof d_delimiter);
+    }
+
+    return *this;
+}
+
+NTCCFG_INLINE
+void ReceiveFramer::reset()
+{
+    d_type             = ntca::ReceiveFramerType::e_UNDEFINED;
+    d_lengthOffset     = 0;
+    d_lengthSize       = 4;
+    d_bigEndian        = true;
+    d_lengthAdjustment = 0;
+    d_delimiterSize    = 0;
+    d_strip            = 0;
+
+    bsl::memset(d_delimiter, 0, sizeof d_delimiter);
+}
+
+NTCCFG_INLINE
+void ReceiveFramer::setType(ntca::ReceiveFramerType::Value value)
+{
+    d_type = value;
+}
+
+NTCCFG_INLINE
+void ReceiveFramer::setLengthOffset(bsl::size_t value)
+{
+    d_lengthOffset = value;
+}
+
+NTCCFG_INLINE
+void ReceiveFramer::setLengthSize(bsl::size_t value)
+{
+    BSLS_ASSERT(value >= 1);
+    BSLS_ASSERT(value <= 8);
+
+    d_lengthSize = value;
+}
+
+NTCCFG_INLINE
+void ReceiveFramer::setBigEndian(bool value)
+{
+    d_bigEndian = value;
+}
+
+NTCCFG_INLINE
+void ReceiveFramer::setLengthAdjustment(bsls::Types::Int64 value)
+{
+    d_lengthAdjustment = value;
+}
+
+NTCCFG_INLINE
+void ReceiveFramer::setDelimiter(const bslstl::StringRef& value)
+{
+    BSLS_ASSERT(value.size() >= 1);
+    BSLS_ASSERT(value.size() <= k_MAX_DELIMITER_SIZE);
+
+    bsl::memset(d_delimiter, 0, sizeof d_delimiter);
+    bsl::memcpy(d_delimiter, value.data(), value.size());
+
+    d_delimiterSize = value.size();
+}
+
+NTCCFG_INLINE
+void ReceiveFramer::setStrip(bsl::size_t value)
+{
+    d_strip = value;
+}
+
+NTCCFG_INLINE
+ntca::ReceiveFramerType::Value ReceiveFramer::type() const
+{
+    return d_type;
+}
+
+NTCCFG_INLINE
+bsl::size_t ReceiveFramer::lengthOffset() const
+{
+    return d_lengthOffset;
+}
+
+NTCCFG_INLINE
+bsl::size_t ReceiveFramer::lengthSize() const
+{
+    return d_lengthSize;
+}
+
+NTCCFG_INLINE
+bool ReceiveFramer::bigEndian() const
+{
+    return d_bigEndian;
+}
+
+NTCCFG_INLINE
+bsls::Types::Int64 ReceiveFramer::lengthAdjustment() const
+{
+    return d_lengthAdjustment;
+}
+
+NTCCFG_INLINE
+bslstl::StringRef ReceiveFramer::delimiter() const
+{
+    return bslstl::StringRef(d_delimiter, d_delimiterSize);
+}
+
+NTCCFG_INLINE
+bsl::size_t ReceiveFramer::strip() const
+{
+    return d_strip;
+}
+
+NTCCFG_INLINE
+bsl::ostream& operator<<(bsl::ostream& stream, const ReceiveFramer& object)
+{
+    return object.print(stream, 0, -1);
+}
+
+NTCCFG_INLINE
+bool operator==(const ReceiveFramer& lhs, const ReceiveFramer& rhs)
+{
+    return lhs.equals(rhs);
+}
+
+NTCCFG_INLINE
+bool operator!=(const ReceiveFramer& lhs, const ReceiveFramer& rhs)
+{
+    return !operator==(lhs, rhs);
+}
+
+NTCCFG_INLINE
+bool operator<(const ReceiveFramer& lhs, const ReceiveFramer& rhs)
+{
+    return lhs.less(rhs);
+}
+
+template <typename HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& algorithm, const ReceiveFramer& value)
+{
+    using bslh::hashAppend;
+
+    hashAppend(algorithm, value.type());
+    hashAppend(algorithm, value.lengthOffset());
+    hashAppend(algorithm, value.lengthSize());
+    hashAppend(algorithm, value.bigEndian());
+    hashAppend(algorithm, value.lengthAdjustment());
+    hashAppend(algorithm, value.delimiter());
+    hashAppend(algorithm, value.strip());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
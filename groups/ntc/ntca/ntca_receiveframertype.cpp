@@ -0,0 +1,90 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntca_receiveframertype.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntca_receiveframertype_cpp, "$Id$ $CSID$")
+
+#include <bdlb_string.h>
+#include <bsls_assert.h>
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+namespace ntca {
+
+int ReceiveFramerType::fromInt(ReceiveFramerType::Value* result, int number)
+{
+    switch (number) {
+    case ReceiveFramerType::e_UNDEFINED:
+    case ReceiveFramerType::e_LENGTH:
+    case ReceiveFramerType::e_DELIMITER:
+        *result = static_cast<ReceiveFramerType::Value>(number);
+        return 0;
+    default:
+        return -1;
+    }
+}
+
+int ReceiveFramerType::fromString(ReceiveFramerType::Value* result,
+                                  const bslstl::StringRef&  string)
+{
+    if (bdlb::String::areEqualCaseless(string, "UNDEFINED")) {
+        *result = e_UNDEFINED;
+        return 0;
+    }
+    if (bdlb::String::areEqualCaseless(string, "LENGTH")) {
+        *result = e_LENGTH;
+        return 0;
+    }
+    if (bdlb::String::areEqualCaseless(string, "DELIMITER")) {
+        *result = e_DELIMITER;
+        return 0;
+    }
+
+    return -1;
+}
+
+const char* ReceiveFramerType::toString(ReceiveFramerType::Value value)
+{
+    switch (value) {
+    case e_UNDEFINED: {
+        return "UNDEFINED";
+    } break;
+    case e_LENGTH: {
+        return "LENGTH";
+    } break;
+    case e_DELIMITER: {
+        return "DELIMITER";
+    } break;
+    }
+
+    BSLS_ASSERT(!"invalid enumerator");
+    return 0;
+}
+
+bsl::ostream& ReceiveFramerType::print(bsl::ostream&            stream,
+                                       ReceiveFramerType::Value value)
+{
+    return stream << toString(value);
+}
+
+bsl::ostream& operator<<(bsl::ostream& stream, ReceiveFramerType::Value rhs)
+{
+    return ReceiveFramerType::print(stream, rhs);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
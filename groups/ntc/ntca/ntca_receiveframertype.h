@@ -0,0 +1,81 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCA_RECEIVEFRAMERTYPE
+#define INCLUDED_NTCA_RECEIVEFRAMERTYPE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntccfg_platform.h>
+#include <ntcscm_version.h>
+
+namespace BloombergLP {
+namespace ntca {
+
+/// Enumerate the methods by which messages are delimited in a stream.
+///
+/// @par Thread Safety
+/// This struct is thread safe.
+///
+/// @ingroup module_ntci_operation_receive
+struct ReceiveFramerType {
+  public:
+    /// Enumerate the methods by which messages are delimited in a stream.
+    enum Value {
+        /// The framing method is undefined.
+        e_UNDEFINED = 0,
+
+        /// Each message is preceded by a header that contains the length of
+        /// the message as an unsigned integer.
+        e_LENGTH = 1,
+
+        /// Each message is followed by a delimiting sequence of bytes.
+        e_DELIMITER = 2
+    };
+
+    /// Return the string representation exactly matching the enumerator
+    /// name corresponding to the specified enumeration 'value'.
+    static const char* toString(Value value);
+
+    /// Load into the specified 'result' the enumerator matching the
+    /// specified 'string'.  Return 0 on success, and a non-zero value with
+    /// no effect on 'result' otherwise (i.e., 'string' does not match any
+    /// enumerator).
+    static int fromString(Value* result, const bslstl::StringRef& string);
+
+    /// Load into the specified 'result' the enumerator matching the
+    /// specified 'number'.  Return 0 on success, and a non-zero value with
+    /// no effect on 'result' otherwise (i.e., 'number' does not match any
+    /// enumerator).
+    static int fromInt(Value* result, int number);
+
+    /// Write to the specified 'stream' the string representation of the
+    /// specified enumeration 'value'.  Return a reference to the modifiable
+    /// 'stream'.
+    static bsl::ostream& print(bsl::ostream& stream, Value value);
+};
+
+// FREE OPERATORS
+
+/// Format the specified 'rhs' to the specified output 'stream' and return a
+/// reference to the modifiable 'stream'.
+///
+/// @related ntca::ReceiveFramerType
+bsl::ostream& operator<<(bsl::ostream& stream, ReceiveFramerType::Value rhs);
+
+}  // end namespace ntca
+}  // end namespace BloombergLP
+#endif
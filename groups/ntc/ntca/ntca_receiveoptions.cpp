@@ -26,7 +26,9 @@ namespace ntca {
 bool ReceiveOptions::equals(const ReceiveOptions& other) const
 {
     return (d_token == other.d_token && d_minSize == other.d_minSize &&
-            d_maxSize == other.d_maxSize && d_deadline == other.d_deadline &&
+            d_maxSize == other.d_maxSize && d_framer == other.d_framer &&
+            d_maxMessages == other.d_maxMessages &&
+            d_deadline == other.d_deadline &&
             d_recurse == other.d_recurse);
 }
 
@@ -56,6 +58,22 @@ bool ReceiveOptions::less(const ReceiveOptions& other) const
         return false;
     }
 
+    if (d_framer < other.d_framer) {
+        return true;
+    }
+
+    if (other.d_framer < d_framer) {
+        return false;
+    }
+
+    if (d_maxMessages < other.d_maxMessages) {
+        return true;
+    }
+
+    if (other.d_maxMessages < d_maxMessages) {
+        return false;
+    }
+
     if (d_deadline < other.d_deadline) {
         return true;
     }
@@ -76,6 +94,8 @@ bsl::ostream& ReceiveOptions::print(bsl::ostream& stream,
     printer.printAttribute("token", d_token);
     printer.printAttribute("minSize", d_minSize);
     printer.printAttribute("maxSize", d_maxSize);
+    printer.printAttribute("framer", d_framer);
+    printer.printAttribute("maxMessages", d_maxMessages);
     printer.printAttribute("deadline", d_deadline);
     printer.printAttribute("recurse", d_recurse);
     printer.end();
@@ -19,6 +19,7 @@
 #include <bsls_ident.h>
 BSLS_IDENT("$Id: $")
 
+#include <ntca_receiveframer.h>
 #include <ntca_receivetoken.h>
 #include <ntccfg_platform.h>
 #include <ntcscm_version.h>
@@ -46,6 +47,20 @@ namespace ntca {
 /// @li @b maxSize:
 /// The maximum amount of data in the read queue to receive.
 ///
+/// @li @b framer:
+/// The description of how messages are delimited in the read queue. When
+/// defined, the receive operation is satisfied by exactly one complete
+/// message at the front of the read queue, the minimum size is ignored, and
+/// the operation fails if the message is larger than the maximum size. When
+/// undefined, the framer of the socket, if any, is applied instead.
+///
+/// @li @b maxMessages:
+/// The maximum number of messages delivered by a single completion of a
+/// batch receive operation. The total size of the messages in each batch is
+/// limited by the maximum size, except that the first message is always
+/// delivered. This value is ignored by receive operations that complete with
+/// a single message.
+///
 /// @li @b deadline:
 /// The deadline within which the message must be received, in absolute time
 /// since the Unix epoch.
@@ -61,11 +76,13 @@ namespace ntca {
 /// @ingroup module_ntci_operation_receive
 class ReceiveOptions
 {
-    bdlb::NullableValue<ntca::ReceiveToken> d_token;
-    bsl::size_t                             d_minSize;
-    bsl::size_t                             d_maxSize;
-    bdlb::NullableValue<bsls::TimeInterval> d_deadline;
-    bool                                    d_recurse;
+    bdlb::NullableValue<ntca::ReceiveToken>  d_token;
+    bsl::size_t                              d_minSize;
+    bsl::size_t                              d_maxSize;
+    bdlb::NullableValue<ntca::ReceiveFramer> d_framer;
+    bsl::size_t                              d_maxMessages;
+    bdlb::NullableValue<bsls::TimeInterval>  d_deadline;
+    bool                                     d_recurse;
 
   public:
     /// Create new receive options having the default value.
@@ -100,6 +117,15 @@ class ReceiveOptions
     /// maximum number of bytes to the same 'value'.
     void setSize(bsl::size_t value);
 
+    /// Set the description of how messages are delimited in the read queue
+    /// to the specified 'value'.
+    void setFramer(const ntca::ReceiveFramer& value);
+
+    /// Set the maximum number of messages delivered by a single completion
+    /// of a batch receive operation to the specified 'value'. Note that a
+    /// 'value' of zero is interpreted as one.
+    void setMaxMessages(bsl::size_t value);
+
     /// Set the deadline within which the data must be received to the
     /// specified 'value'.
     void setDeadline(const bsls::TimeInterval& value);
@@ -118,6 +144,14 @@ class ReceiveOptions
     /// Return the maximum number of bytes to copy.
     bsl::size_t maxSize() const;
 
+    /// Return the description of how messages are delimited in the read
+    /// queue.
+    const bdlb::NullableValue<ntca::ReceiveFramer>& framer() const;
+
+    /// Return the maximum number of messages delivered by a single
+    /// completion of a batch receive operation.
+    bsl::size_t maxMessages() const;
+
     /// Return the deadline within which the data must be received.
     const bdlb::NullableValue<bsls::TimeInterval>& deadline() const;
 
@@ -191,6 +225,8 @@ ReceiveOptions::ReceiveOptions()
 : d_token()
 , d_minSize(1)
 , d_maxSize(bsl::numeric_limits<bsl::size_t>::max())
+, d_framer()
+, d_maxMessages(1)
 , d_deadline()
 , d_recurse(false)
 {
@@ -201,6 +237,8 @@ ReceiveOptions::ReceiveOptions(const ReceiveOptions& original)
 : d_token(original.d_token)
 , d_minSize(original.d_minSize)
 , d_maxSize(original.d_maxSize)
+, d_framer(original.d_framer)
+, d_maxMessages(original.d_maxMessages)
 , d_deadline(original.d_deadline)
 , d_recurse(original.d_recurse)
 {
@@ -214,11 +252,13 @@ ReceiveOptions::~ReceiveOptions()
 NTCCFG_INLINE
 ReceiveOptions& ReceiveOptions::operator=(const ReceiveOptions& other)
 {
-    d_token    = other.d_token;
-    d_minSize  = other.d_minSize;
-    d_maxSize  = other.d_maxSize;
-    d_deadline = other.d_deadline;
-    d_recurse  = other.d_recurse;
+    d_token       = other.d_token;
+    d_minSize     = other.d_minSize;
+    d_maxSize     = other.d_maxSize;
+    d_framer      = other.d_framer;
+    d_maxMessages = other.d_maxMessages;
+    d_deadline    = other.d_deadline;
+    d_recurse     = other.d_recurse;
     return *this;
 }
 
@@ -228,6 +268,8 @@ void ReceiveOptions::reset()
     d_token.reset();
     d_minSize = 1;
     d_maxSize = bsl::numeric_limits<bsl::size_t>::max();
+    d_framer.reset();
+    d_maxMessages = 1;
     d_deadline.reset();
     d_recurse = false;
 }
@@ -269,6 +311,21 @@ void ReceiveOptions::setMaxSize(bsl::size_t value)
     }
 }
 
+NTCCFG_INLINE
+void ReceiveOptions::setFramer(const ntca::ReceiveFramer& value)
+{
+    d_framer = value;
+}
+
+NTCCFG_INLINE
+void ReceiveOptions::setMaxMessages(bsl::size_t value)
+{
+    d_maxMessages = value;
+    if (d_maxMessages == 0) {
+        d_maxMessages = 1;
+    }
+}
+
 NTCCFG_INLINE
 void ReceiveOptions::setDeadline(const bsls::TimeInterval& value)
 {
@@ -302,6 +359,18 @@ bsl::size_t ReceiveOptions::maxSize() const
     return d_maxSize;
 }
 
+NTCCFG_INLINE
+const bdlb::NullableValue<ntca::ReceiveFramer>& ReceiveOptions::framer() const
+{
+    return d_framer;
+}
+
+NTCCFG_INLINE
+bsl::size_t ReceiveOptions::maxMessages() const
+{
+    return d_maxMessages;
+}
+
 NTCCFG_INLINE
 const bdlb::NullableValue<bsls::TimeInterval>& ReceiveOptions::deadline() const
 {
@@ -346,6 +415,8 @@ void hashAppend(HASH_ALGORITHM& algorithm, const ReceiveOptions& value)
     hashAppend(algorithm, value.token());
     hashAppend(algorithm, value.minSize());
     hashAppend(algorithm, value.maxSize());
+    hashAppend(algorithm, value.framer());
+    hashAppend(algorithm, value.maxMessages());
     hashAppend(algorithm, value.deadline());
     hashAppend(algorithm, value.recurse());
 }
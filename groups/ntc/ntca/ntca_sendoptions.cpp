@@ -28,7 +28,9 @@ bool SendOptions::equals(const SendOptions& other) const
     return (d_token == other.d_token && d_endpoint == other.d_endpoint &&
             d_priority == other.d_priority &&
             d_highWatermark == other.d_highWatermark &&
-            d_deadline == other.d_deadline && d_recurse == other.d_recurse);
+            d_deadline == other.d_deadline &&
+            d_conflationKey == other.d_conflationKey &&
+            d_recurse == other.d_recurse && d_flush == other.d_flush);
 }
 
 bool SendOptions::less(const SendOptions& other) const
@@ -73,7 +75,23 @@ bool SendOptions::less(const SendOptions& other) const
         return false;
     }
 
-    return d_recurse < other.d_recurse;
+    if (d_conflationKey < other.d_conflationKey) {
+        return true;
+    }
+
+    if (other.d_conflationKey < d_conflationKey) {
+        return false;
+    }
+
+    if (d_recurse < other.d_recurse) {
+        return true;
+    }
+
+    if (other.d_recurse < d_recurse) {
+        return false;
+    }
+
+    return d_flush < other.d_flush;
 }
 
 bsl::ostream& SendOptions::print(bsl::ostream& stream,
@@ -103,7 +121,12 @@ bsl::ostream& SendOptions::print(bsl::ostream& stream,
         printer.printAttribute("deadline", d_deadline);
     }
 
+    if (!d_conflationKey.isNull()) {
+        printer.printAttribute("conflationKey", d_conflationKey);
+    }
+
     printer.printAttribute("recurse", d_recurse);
+    printer.printAttribute("flush", d_flush);
     printer.end();
     return stream;
 }
@@ -26,6 +26,7 @@ BSLS_IDENT("$Id: $")
 #include <bdlb_nullablevalue.h>
 #include <bslh_hash.h>
 #include <bsls_timeinterval.h>
+#include <bsl_cstdint.h>
 #include <bsl_iosfwd.h>
 
 namespace BloombergLP {
@@ -53,11 +54,25 @@ namespace ntca {
 /// The deadline within which the message must be sent, in absolute time since
 /// the Unix epoch.
 ///
+/// @li @b conflationKey:
+/// The key that identifies the topic of the message. If the write queue
+/// contains a message with the same key that has not yet been at least
+/// partially copied to the socket send buffer, that message is replaced by
+/// this message, which assumes its position in the write queue, and the
+/// replaced message's callback, if any, is invoked with an error indicating
+/// it has been cancelled. This option has no effect on datagram sockets.
+///
 /// @li @b recurse:
 /// Allow callbacks to be invoked immediately and recursively if their
 /// constraints are already satisified at the time the asynchronous operation
 /// is initiated.
 ///
+/// @li @b flush:
+/// Send the data, and any data previously coalesced by a socket configured
+/// to coalesce sends, immediately rather than at the end of the coalescing
+/// window. This flag has no effect on sockets not configured to coalesce
+/// sends.
+///
 /// @par Thread Safety
 /// This class is not thread safe.
 ///
@@ -69,7 +84,9 @@ class SendOptions
     bdlb::NullableValue<bsl::size_t>        d_priority;
     bdlb::NullableValue<bsl::size_t>        d_highWatermark;
     bdlb::NullableValue<bsls::TimeInterval> d_deadline;
+    bdlb::NullableValue<bsl::uint64_t>      d_conflationKey;
     bool                                    d_recurse;
+    bool                                    d_flush;
 
   public:
     /// Create new send options having the default value.
@@ -109,11 +126,20 @@ class SendOptions
     /// specified 'value'.
     void setDeadline(const bsls::TimeInterval& value);
 
+    /// Set the key that identifies the topic of the data, such that the
+    /// data replaces any unsent data queued with the same key, to the
+    /// specified 'value'.
+    void setConflationKey(bsl::uint64_t value);
+
     /// Set the flag that allows callbacks to be invoked immediately and
     /// recursively if their constraints are already satisified at the time
     /// the asynchronous operation is initiated.
     void setRecurse(bool value);
 
+    /// Set the flag that forces the data, and any data previously coalesced,
+    /// to be sent immediately to the specified 'value'.
+    void setFlush(bool value);
+
     /// Return the token used to cancel the operation.
     const bdlb::NullableValue<ntca::SendToken>& token() const;
 
@@ -130,11 +156,18 @@ class SendOptions
     /// Return the deadline within which the data must be sent.
     const bdlb::NullableValue<bsls::TimeInterval>& deadline() const;
 
+    /// Return the key that identifies the topic of the data.
+    const bdlb::NullableValue<bsl::uint64_t>& conflationKey() const;
+
     /// Return true if callbacks are allowed to be invoked immediately and
     /// recursively if their constraints are already satisified at the time
     /// the asynchronous operation is initiated, otherwise return false.
     bool recurse() const;
 
+    /// Return true if the data, and any data previously coalesced, is forced
+    /// to be sent immediately, otherwise return false.
+    bool flush() const;
+
     /// Return true if this object has the same value as the specified
     /// 'other' object, otherwise return false.
     bool equals(const SendOptions& other) const;
@@ -202,7 +235,9 @@ SendOptions::SendOptions()
 , d_priority()
 , d_highWatermark()
 , d_deadline()
+, d_conflationKey()
 , d_recurse(false)
+, d_flush(false)
 {
 }
 
@@ -213,7 +248,9 @@ SendOptions::SendOptions(const SendOptions& original)
 , d_priority(original.d_priority)
 , d_highWatermark(original.d_highWatermark)
 , d_deadline(original.d_deadline)
+, d_conflationKey(original.d_conflationKey)
 , d_recurse(original.d_recurse)
+, d_flush(original.d_flush)
 {
 }
 
@@ -230,7 +267,9 @@ SendOptions& SendOptions::operator=(const SendOptions& other)
     d_priority      = other.d_priority;
     d_highWatermark = other.d_highWatermark;
     d_deadline      = other.d_deadline;
+    d_conflationKey = other.d_conflationKey;
     d_recurse       = other.d_recurse;
+    d_flush         = other.d_flush;
     return *this;
 }
 
@@ -242,7 +281,9 @@ void SendOptions::reset()
     d_priority.reset();
     d_highWatermark.reset();
     d_deadline.reset();
+    d_conflationKey.reset();
     d_recurse = false;
+    d_flush   = false;
 }
 
 NTCCFG_INLINE
@@ -275,12 +316,24 @@ void SendOptions::setDeadline(const bsls::TimeInterval& value)
     d_deadline = value;
 }
 
+NTCCFG_INLINE
+void SendOptions::setConflationKey(bsl::uint64_t value)
+{
+    d_conflationKey = value;
+}
+
 NTCCFG_INLINE
 void SendOptions::setRecurse(bool value)
 {
     d_recurse = value;
 }
 
+NTCCFG_INLINE
+void SendOptions::setFlush(bool value)
+{
+    d_flush = value;
+}
+
 NTCCFG_INLINE
 const bdlb::NullableValue<ntca::SendToken>& SendOptions::token() const
 {
@@ -311,12 +364,24 @@ const bdlb::NullableValue<bsls::TimeInterval>& SendOptions::deadline() const
     return d_deadline;
 }
 
+NTCCFG_INLINE
+const bdlb::NullableValue<bsl::uint64_t>& SendOptions::conflationKey() const
+{
+    return d_conflationKey;
+}
+
 NTCCFG_INLINE
 bool SendOptions::recurse() const
 {
     return d_recurse;
 }
 
+NTCCFG_INLINE
+bool SendOptions::flush() const
+{
+    return d_flush;
+}
+
 NTCCFG_INLINE
 bsl::ostream& operator<<(bsl::ostream& stream, const SendOptions& object)
 {
@@ -351,7 +416,9 @@ void hashAppend(HASH_ALGORITHM& algorithm, const SendOptions& value)
     hashAppend(algorithm, value.priority());
     hashAppend(algorithm, value.highWatermark());
     hashAppend(algorithm, value.deadline());
+    hashAppend(algorithm, value.conflationKey());
     hashAppend(algorithm, value.recurse());
+    hashAppend(algorithm, value.flush());
 }
 
 }  // close package namespace
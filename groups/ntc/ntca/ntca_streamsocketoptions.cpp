@@ -54,6 +54,13 @@ StreamSocketOptions::StreamSocketOptions()
 , d_timestampOutgoingData()
 , d_timestampIncomingData()
 , d_zeroCopyThreshold()
+, d_receiveFramer()
+, d_sendCoalescing()
+, d_sendCoalescingWindow()
+, d_tcpInfoInterval()
+, d_adaptiveWriteQueue()
+, d_unsentLowWatermark()
+, d_encryptionOffload()
 , d_loadBalancingOptions()
 {
 }
@@ -89,6 +96,13 @@ StreamSocketOptions::StreamSocketOptions(const StreamSocketOptions& other)
 , d_timestampOutgoingData(other.d_timestampOutgoingData)
 , d_timestampIncomingData(other.d_timestampIncomingData)
 , d_zeroCopyThreshold(other.d_zeroCopyThreshold)
+, d_receiveFramer(other.d_receiveFramer)
+, d_sendCoalescing(other.d_sendCoalescing)
+, d_sendCoalescingWindow(other.d_sendCoalescingWindow)
+, d_tcpInfoInterval(other.d_tcpInfoInterval)
+, d_adaptiveWriteQueue(other.d_adaptiveWriteQueue)
+, d_unsentLowWatermark(other.d_unsentLowWatermark)
+, d_encryptionOffload(other.d_encryptionOffload)
 , d_loadBalancingOptions(other.d_loadBalancingOptions)
 {
 }
@@ -133,6 +147,13 @@ StreamSocketOptions& StreamSocketOptions::operator=(
         d_timestampOutgoingData     = other.d_timestampOutgoingData;
         d_timestampIncomingData     = other.d_timestampIncomingData;
         d_zeroCopyThreshold         = other.d_zeroCopyThreshold;
+        d_receiveFramer             = other.d_receiveFramer;
+        d_sendCoalescing            = other.d_sendCoalescing;
+        d_sendCoalescingWindow      = other.d_sendCoalescingWindow;
+        d_tcpInfoInterval           = other.d_tcpInfoInterval;
+        d_adaptiveWriteQueue        = other.d_adaptiveWriteQueue;
+        d_unsentLowWatermark        = other.d_unsentLowWatermark;
+        d_encryptionOffload         = other.d_encryptionOffload;
         d_loadBalancingOptions      = other.d_loadBalancingOptions;
     }
 
@@ -292,6 +313,42 @@ void StreamSocketOptions::setZeroCopyThreshold(size_t value)
     d_zeroCopyThreshold = value;
 }
 
+void StreamSocketOptions::setReceiveFramer(const ntca::ReceiveFramer& value)
+{
+    d_receiveFramer = value;
+}
+
+void StreamSocketOptions::setSendCoalescing(bool value)
+{
+    d_sendCoalescing = value;
+}
+
+void StreamSocketOptions::setSendCoalescingWindow(
+    const bsls::TimeInterval& value)
+{
+    d_sendCoalescingWindow = value;
+}
+
+void StreamSocketOptions::setTcpInfoInterval(const bsls::TimeInterval& value)
+{
+    d_tcpInfoInterval = value;
+}
+
+void StreamSocketOptions::setAdaptiveWriteQueue(bool value)
+{
+    d_adaptiveWriteQueue = value;
+}
+
+void StreamSocketOptions::setUnsentLowWatermark(bsl::size_t value)
+{
+    d_unsentLowWatermark = value;
+}
+
+void StreamSocketOptions::setEncryptionOffload(bool value)
+{
+    d_encryptionOffload = value;
+}
+
 void StreamSocketOptions::setLoadBalancingOptions(
     const ntca::LoadBalancingOptions& value)
 {
@@ -473,6 +530,47 @@ const bdlb::NullableValue<bsl::size_t>& StreamSocketOptions::
     return d_zeroCopyThreshold;
 }
 
+const bdlb::NullableValue<ntca::ReceiveFramer>& StreamSocketOptions::
+    receiveFramer() const
+{
+    return d_receiveFramer;
+}
+
+const bdlb::NullableValue<bool>& StreamSocketOptions::sendCoalescing() const
+{
+    return d_sendCoalescing;
+}
+
+const bdlb::NullableValue<bsls::TimeInterval>& StreamSocketOptions::
+    sendCoalescingWindow() const
+{
+    return d_sendCoalescingWindow;
+}
+
+const bdlb::NullableValue<bsls::TimeInterval>& StreamSocketOptions::
+    tcpInfoInterval() const
+{
+    return d_tcpInfoInterval;
+}
+
+const bdlb::NullableValue<bool>& StreamSocketOptions::adaptiveWriteQueue()
+    const
+{
+    return d_adaptiveWriteQueue;
+}
+
+const bdlb::NullableValue<bsl::size_t>& StreamSocketOptions::
+    unsentLowWatermark() const
+{
+    return d_unsentLowWatermark;
+}
+
+const bdlb::NullableValue<bool>& StreamSocketOptions::encryptionOffload()
+    const
+{
+    return d_encryptionOffload;
+}
+
 bool StreamSocketOptions::abortiveClose() const
 {
     return (!d_lingerFlag.isNull() && d_lingerFlag.value() == true &&
@@ -516,6 +614,13 @@ bsl::ostream& StreamSocketOptions::print(bsl::ostream& stream,
     printer.printAttribute("timestampOutgoingData", d_timestampOutgoingData);
     printer.printAttribute("timestampIncomingData", d_timestampIncomingData);
     printer.printAttribute("zeroCopyThreshold", d_zeroCopyThreshold);
+    printer.printAttribute("receiveFramer", d_receiveFramer);
+    printer.printAttribute("sendCoalescing", d_sendCoalescing);
+    printer.printAttribute("sendCoalescingWindow", d_sendCoalescingWindow);
+    printer.printAttribute("tcpInfoInterval", d_tcpInfoInterval);
+    printer.printAttribute("adaptiveWriteQueue", d_adaptiveWriteQueue);
+    printer.printAttribute("unsentLowWatermark", d_unsentLowWatermark);
+    printer.printAttribute("encryptionOffload", d_encryptionOffload);
     printer.printAttribute("loadBalancingOptions", d_loadBalancingOptions);
     printer.end();
     return stream;
@@ -552,6 +657,13 @@ bool operator==(const StreamSocketOptions& lhs, const StreamSocketOptions& rhs)
            lhs.timestampOutgoingData() == rhs.timestampOutgoingData() &&
            lhs.timestampIncomingData() == rhs.timestampIncomingData() &&
            lhs.zeroCopyThreshold() == rhs.zeroCopyThreshold() &&
+           lhs.receiveFramer() == rhs.receiveFramer() &&
+           lhs.sendCoalescing() == rhs.sendCoalescing() &&
+           lhs.sendCoalescingWindow() == rhs.sendCoalescingWindow() &&
+           lhs.tcpInfoInterval() == rhs.tcpInfoInterval() &&
+           lhs.adaptiveWriteQueue() == rhs.adaptiveWriteQueue() &&
+           lhs.unsentLowWatermark() == rhs.unsentLowWatermark() &&
+           lhs.encryptionOffload() == rhs.encryptionOffload() &&
            lhs.loadBalancingOptions() == rhs.loadBalancingOptions();
 }
 
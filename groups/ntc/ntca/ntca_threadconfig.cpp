@@ -33,6 +33,7 @@ ThreadConfig::ThreadConfig(bslma::Allocator* basicAllocator)
 , d_metricCollection()
 , d_metricCollectionPerWaiter()
 , d_metricCollectionPerSocket()
+, d_numaNode()
 , d_resolverEnabled()
 , d_resolverConfig(basicAllocator)
 {
@@ -49,7 +50,8 @@ ThreadConfig::ThreadConfig(const ThreadConfig& original,
 , d_metricCollection(original.d_metricCollection)
 , d_metricCollectionPerWaiter(original.d_metricCollectionPerWaiter)
 , d_metricCollectionPerSocket(original.d_metricCollectionPerSocket)
-, d_resolverEnabled()
+, d_numaNode(original.d_numaNode)
+, d_resolverEnabled(original.d_resolverEnabled)
 , d_resolverConfig(original.d_resolverConfig, basicAllocator)
 {
 }
@@ -70,6 +72,7 @@ ThreadConfig& ThreadConfig::operator=(const ThreadConfig& other)
         d_metricCollection          = other.d_metricCollection;
         d_metricCollectionPerWaiter = other.d_metricCollectionPerWaiter;
         d_metricCollectionPerSocket = other.d_metricCollectionPerSocket;
+        d_numaNode                  = other.d_numaNode;
         d_resolverEnabled           = other.d_resolverEnabled;
         d_resolverConfig            = other.d_resolverConfig;
     }
@@ -88,6 +91,7 @@ void ThreadConfig::reset()
     d_metricCollection.reset();
     d_metricCollectionPerWaiter.reset();
     d_metricCollectionPerSocket.reset();
+    d_numaNode.reset();
     d_resolverEnabled.reset();
     d_resolverConfig.reset();
 }
@@ -137,6 +141,11 @@ void ThreadConfig::setMetricCollectionPerSocket(bool value)
     d_metricCollectionPerSocket = value;
 }
 
+void ThreadConfig::setNumaNode(bsl::size_t value)
+{
+    d_numaNode = value;
+}
+
 void ThreadConfig::setResolverEnabled(bool value)
 {
     d_resolverEnabled = value;
@@ -194,6 +203,11 @@ const bdlb::NullableValue<bool>& ThreadConfig::metricCollectionPerSocket()
     return d_metricCollectionPerSocket;
 }
 
+const bdlb::NullableValue<bsl::size_t>& ThreadConfig::numaNode() const
+{
+    return d_numaNode;
+}
+
 const bdlb::NullableValue<bool>& ThreadConfig::resolverEnabled() const
 {
     return d_resolverEnabled;
@@ -216,6 +230,7 @@ bool ThreadConfig::equals(const ThreadConfig& other) const
            d_metricCollection == other.d_metricCollection &&
            d_metricCollectionPerWaiter == other.d_metricCollectionPerWaiter &&
            d_metricCollectionPerSocket == other.d_metricCollectionPerSocket &&
+           d_numaNode == other.d_numaNode &&
            d_resolverEnabled == other.d_resolverEnabled &&
            d_resolverConfig == other.d_resolverConfig;
 }
@@ -237,6 +252,7 @@ bsl::ostream& ThreadConfig::print(bsl::ostream& stream,
                            d_metricCollectionPerWaiter);
     printer.printAttribute("metricCollectionPerSocket",
                            d_metricCollectionPerSocket);
+    printer.printAttribute("numaNode", d_numaNode);
     printer.printAttribute("resolverEnabled", d_resolverEnabled);
     printer.printAttribute("resolverConfig", d_resolverConfig);
     printer.end();
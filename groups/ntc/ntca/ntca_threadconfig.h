@@ -80,6 +80,11 @@ namespace ntca {
 /// The flag that indicates the collection of metrics per socket is enabled or
 /// disabled.
 ///
+/// @li @b numaNode:
+/// The index of the NUMA node, as numbered by the operating system, to whose
+/// CPUs the thread is bound. The default value is null, indicating the thread
+/// may run on any CPU.
+///
 /// @li @b resolverEnabled:
 /// The flag that indicates this interface should run an asynchronous resolver.
 /// The default value is null, indicating that a default resolver is *not* run.
@@ -104,6 +109,7 @@ class ThreadConfig
     bdlb::NullableValue<bool>                 d_metricCollection;
     bdlb::NullableValue<bool>                 d_metricCollectionPerWaiter;
     bdlb::NullableValue<bool>                 d_metricCollectionPerSocket;
+    bdlb::NullableValue<bsl::size_t>          d_numaNode;
     bdlb::NullableValue<bool>                 d_resolverEnabled;
     bdlb::NullableValue<ntca::ResolverConfig> d_resolverConfig;
 
@@ -175,6 +181,10 @@ class ThreadConfig
     /// according to the specified 'value'.
     void setMetricCollectionPerSocket(bool value);
 
+    /// Set the index of the NUMA node, as numbered by the operating system,
+    /// to whose CPUs the thread is bound to the specified 'value'.
+    void setNumaNode(bsl::size_t value);
+
     /// Set the flag that indicates this interface should run an
     /// asynchronous resolver to the specified 'value'. The default value is
     /// null, indicating that a default resolver is *not* run.
@@ -226,6 +236,11 @@ class ThreadConfig
     /// is enabled or disabled.
     const bdlb::NullableValue<bool>& metricCollectionPerSocket() const;
 
+    /// Return the index of the NUMA node, as numbered by the operating
+    /// system, to whose CPUs the thread is bound. If the value is null, the
+    /// thread may run on any CPU.
+    const bdlb::NullableValue<bsl::size_t>& numaNode() const;
+
     /// Return the flag that indicates this interface should run an
     /// asynchronous resolver. The default value is null, indicating that a
     /// default resolver is *not* run.
@@ -0,0 +1,186 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntccfg_inplacefunction.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntccfg_inplacefunction_cpp, "$Id$ $CSID$")
+
+namespace BloombergLP {
+namespace ntccfg {
+
+void InplaceFunction::adopt(FunctionType* function)
+{
+    this->reset();
+
+    if (!*function) {
+        return;
+    }
+
+    FunctionType* object = new (d_buffer.buffer())
+        FunctionType(bsl::allocator_arg, function->get_allocator());
+
+    object->swap(*function);
+
+    d_invoker_p = &InplaceRep<FunctionType>::invoke;
+    d_manager_p = &InplaceRep<FunctionType>::manage;
+    d_inplace   = true;
+}
+
+void InplaceFunction::swap(InplaceFunction& other)
+{
+    BSLS_ASSERT(d_allocator_p == other.d_allocator_p);
+
+    if (this == &other) {
+        return;
+    }
+
+    InplaceFunction temporary(d_allocator_p);
+
+    temporary.moveFrom(this);
+    this->moveFrom(&other);
+    other.moveFrom(&temporary);
+}
+
+InplaceFunctionQueue::InplaceFunctionQueue(bslma::Allocator* basicAllocator)
+: d_head_p(0)
+, d_tail_p(0)
+, d_size(0)
+, d_free_p(0)
+, d_freeSize(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+InplaceFunctionQueue::~InplaceFunctionQueue()
+{
+    this->clear();
+
+    while (d_free_p) {
+        Node* node = d_free_p;
+        d_free_p   = node->d_next_p;
+        bslma::DeleterHelper::deleteObject(node, d_allocator_p);
+    }
+
+    d_freeSize = 0;
+}
+
+bool InplaceFunctionQueue::pop(InplaceFunction* result)
+{
+    BSLS_ASSERT(result->allocator() == d_allocator_p);
+
+    if (d_head_p == 0) {
+        return false;
+    }
+
+    Node* node = d_head_p;
+
+    d_head_p = node->d_next_p;
+    if (d_head_p == 0) {
+        d_tail_p = 0;
+    }
+
+    --d_size;
+
+    result->reset();
+    result->swap(node->d_function);
+
+    this->privateRelease(node);
+
+    return true;
+}
+
+void InplaceFunctionQueue::splice(InplaceFunctionQueue* other)
+{
+    BSLS_ASSERT(other->d_allocator_p == d_allocator_p);
+
+    if (other == this || other->d_head_p == 0) {
+        return;
+    }
+
+    if (d_tail_p) {
+        d_tail_p->d_next_p = other->d_head_p;
+    }
+    else {
+        d_head_p = other->d_head_p;
+    }
+
+    d_tail_p  = other->d_tail_p;
+    d_size   += other->d_size;
+
+    other->d_head_p = 0;
+    other->d_tail_p = 0;
+    other->d_size   = 0;
+}
+
+void InplaceFunctionQueue::reclaim(InplaceFunctionQueue* other)
+{
+    BSLS_ASSERT(other->d_allocator_p == d_allocator_p);
+
+    if (other == this) {
+        return;
+    }
+
+    other->clear();
+
+    while (other->d_free_p) {
+        Node* node      = other->d_free_p;
+        other->d_free_p = node->d_next_p;
+
+        node->d_next_p = d_free_p;
+        d_free_p       = node;
+    }
+
+    d_freeSize        += other->d_freeSize;
+    other->d_freeSize  = 0;
+}
+
+bsl::size_t InplaceFunctionQueue::execute()
+{
+    bsl::size_t numExecuted = 0;
+
+    while (d_head_p) {
+        Node* node = d_head_p;
+
+        node->d_function();
+        ++numExecuted;
+
+        d_head_p = node->d_next_p;
+        if (d_head_p == 0) {
+            d_tail_p = 0;
+        }
+
+        --d_size;
+
+        this->privateRelease(node);
+    }
+
+    return numExecuted;
+}
+
+void InplaceFunctionQueue::clear()
+{
+    while (d_head_p) {
+        Node* node = d_head_p;
+        d_head_p   = node->d_next_p;
+        this->privateRelease(node);
+    }
+
+    d_tail_p = 0;
+    d_size   = 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
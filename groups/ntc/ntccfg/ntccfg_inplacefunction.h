@@ -0,0 +1,650 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCCFG_INPLACEFUNCTION
+#define INCLUDED_NTCCFG_INPLACEFUNCTION
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntccfg_config.h>
+#include <ntccfg_inline.h>
+#include <ntccfg_likely.h>
+#include <ntcscm_version.h>
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_deleterhelper.h>
+#include <bslmf_integralconstant.h>
+#include <bslmf_movableref.h>
+#include <bsls_alignedbuffer.h>
+#include <bsls_alignmentfromtype.h>
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_new.h>
+
+namespace BloombergLP {
+namespace ntccfg {
+
+/// @internal @brief
+/// Provide a move-only function taking no arguments and returning void that
+/// stores small function objects inline.
+///
+/// @details
+/// Function objects whose size is not greater than 'k_CAPACITY' bytes are
+/// constructed in an inline buffer and never allocate memory themselves.
+/// Larger function objects are allocated from the allocator supplied at
+/// construction. The capacity is at least 64 bytes and is always large
+/// enough to hold a 'bsl::function<void()>', so an existing type-erased
+/// function may be adopted by an object of this class without allocating.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntccfg
+class InplaceFunction
+{
+  public:
+    /// Define a type alias for the type-erased function that may be adopted
+    /// by this class without copying its target.
+    typedef bsl::function<void()> FunctionType;
+
+    enum {
+        /// The minimum size of the inline buffer, in bytes.
+        k_MIN_CAPACITY = 64,
+
+        /// The size of the inline buffer, in bytes.
+        k_CAPACITY = sizeof(FunctionType) > k_MIN_CAPACITY
+                         ? sizeof(FunctionType)
+                         : k_MIN_CAPACITY
+    };
+
+  private:
+    /// Enumerate the operations performed by a manager.
+    enum Operation {
+        /// Move the object from the source to the destination.
+        e_MOVE,
+
+        /// Destroy the object in the destination.
+        e_DESTROY
+    };
+
+    /// Define a type alias for a function that invokes the object stored
+    /// in a function.
+    typedef void (*Invoker)(InplaceFunction* function);
+
+    /// Define a type alias for a function that moves or destroys the
+    /// object stored in a function.
+    typedef void (*Manager)(Operation        operation,
+                            InplaceFunction* destination,
+                            InplaceFunction* source);
+
+    /// Provide functions to invoke and manage an object of the
+    /// parameterized 'FUNCTION' type stored in the inline buffer.
+    template <typename FUNCTION>
+    struct InplaceRep {
+        /// Return the object stored in the specified 'function'.
+        static FUNCTION* object(InplaceFunction* function);
+
+        /// Invoke the object stored in the specified 'function'.
+        static void invoke(InplaceFunction* function);
+
+        /// Perform the specified 'operation' on the specified
+        /// 'destination' and 'source'.
+        static void manage(Operation        operation,
+                           InplaceFunction* destination,
+                           InplaceFunction* source);
+    };
+
+    /// Provide functions to invoke and manage an object of the
+    /// parameterized 'FUNCTION' type allocated from the allocator.
+    template <typename FUNCTION>
+    struct AllocatedRep {
+        /// Return a reference to the pointer to the object stored in the
+        /// specified 'function'.
+        static FUNCTION*& object(InplaceFunction* function);
+
+        /// Invoke the object stored in the specified 'function'.
+        static void invoke(InplaceFunction* function);
+
+        /// Perform the specified 'operation' on the specified
+        /// 'destination' and 'source'.
+        static void manage(Operation        operation,
+                           InplaceFunction* destination,
+                           InplaceFunction* source);
+    };
+
+    /// Provide a compile-time predicate that indicates whether an object of
+    /// the parameterized 'FUNCTION' type may be stored inline.
+    template <typename FUNCTION>
+    struct IsInplace
+    : public bsl::integral_constant<
+          bool,
+          sizeof(FUNCTION) <= k_CAPACITY &&
+              static_cast<int>(bsls::AlignmentFromType<FUNCTION>::VALUE) <=
+                  static_cast<int>(bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT)> {
+    };
+
+    bsls::AlignedBuffer<k_CAPACITY> d_buffer;
+    Invoker                         d_invoker_p;
+    Manager                         d_manager_p;
+    bool                            d_inplace;
+    bslma::Allocator*               d_allocator_p;
+
+  private:
+    InplaceFunction(const InplaceFunction&) BSLS_KEYWORD_DELETED;
+    InplaceFunction& operator=(const InplaceFunction&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Construct a copy of the specified 'function' in the inline buffer.
+    /// The behavior is undefined unless this object is empty.
+    template <typename FUNCTION>
+    void construct(const FUNCTION& function, bsl::true_type);
+
+    /// Construct a copy of the specified 'function' allocated from the
+    /// allocator. The behavior is undefined unless this object is empty.
+    template <typename FUNCTION>
+    void construct(const FUNCTION& function, bsl::false_type);
+
+    /// Construct a copy of the specified 'function' in the inline buffer
+    /// using the allocator of this object to supply memory for the copy of
+    /// its target, if necessary. The behavior is undefined unless this
+    /// object is empty.
+    void construct(const FunctionType& function, bsl::true_type);
+
+    /// Move the object stored in the specified 'source' to this object,
+    /// leaving 'source' empty. The behavior is undefined unless this
+    /// object is empty.
+    void moveFrom(InplaceFunction* source);
+
+  public:
+    /// Create a new, empty function. Optionally specify a 'basicAllocator'
+    /// used to supply memory. If 'basicAllocator' is 0, the currently
+    /// installed default allocator is used.
+    explicit InplaceFunction(bslma::Allocator* basicAllocator = 0);
+
+    /// Create a new function that invokes a copy of the specified
+    /// 'function'. Optionally specify a 'basicAllocator' used to supply
+    /// memory. If 'basicAllocator' is 0, the currently installed default
+    /// allocator is used.
+    template <typename FUNCTION>
+    explicit InplaceFunction(const FUNCTION&   function,
+                             bslma::Allocator* basicAllocator = 0);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES)
+    /// Create a new function that invokes the object stored in the
+    /// specified 'original' object, leaving 'original' empty.
+    InplaceFunction(InplaceFunction&& original);
+
+    /// Invoke the object stored in the specified 'other' object instead of
+    /// the object currently stored in this object, leaving 'other' empty.
+    /// Return a reference to this modifiable object.
+    InplaceFunction& operator=(InplaceFunction&& other);
+#endif
+
+    /// Destroy this object.
+    ~InplaceFunction();
+
+    /// Invoke a copy of the specified 'function' instead of the object
+    /// currently stored in this object.
+    template <typename FUNCTION>
+    void assign(const FUNCTION& function);
+
+    /// Invoke the target of the specified 'function' instead of the object
+    /// currently stored in this object, leaving 'function' empty. Note that
+    /// the target of 'function' is not copied and no memory is allocated.
+    void adopt(FunctionType* function);
+
+    /// Reset the value of this object to its value upon default
+    /// construction.
+    void reset();
+
+    /// Swap the value of this object with the specified 'other' object. The
+    /// behavior is undefined unless this object and 'other' use the same
+    /// allocator.
+    void swap(InplaceFunction& other);
+
+    /// Invoke the stored object. The behavior is undefined unless this
+    /// object is not empty.
+    void operator()();
+
+    /// Return true if this object stores a function, otherwise return
+    /// false.
+    operator bool() const;
+
+    /// Return true if the stored object, if any, is stored in the inline
+    /// buffer, otherwise return false.
+    bool isInplace() const;
+
+    /// Return the allocator used to supply memory.
+    bslma::Allocator* allocator() const;
+};
+
+/// @internal @brief
+/// Provide a first-in, first-out queue of functions whose nodes are
+/// recycled.
+///
+/// @details
+/// Each function is stored in an 'ntccfg::InplaceFunction' in a node of an
+/// intrusive, singly-linked list. Nodes whose functions have been invoked,
+/// popped, or cleared are returned to a free list and re-used by subsequent
+/// pushes, so once the queue has reached its steady-state depth, pushing
+/// functions whose objects fit in the inline buffer of an
+/// 'ntccfg::InplaceFunction' does not allocate memory. Functions may be
+/// moved between queues that use the same allocator without copying.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntccfg
+class InplaceFunctionQueue
+{
+    /// This struct describes a node in the queue.
+    struct Node {
+        explicit Node(bslma::Allocator* basicAllocator)
+        : d_function(basicAllocator)
+        , d_next_p(0)
+        {
+        }
+
+        ntccfg::InplaceFunction d_function;
+        Node*                   d_next_p;
+    };
+
+    Node*             d_head_p;
+    Node*             d_tail_p;
+    bsl::size_t       d_size;
+    Node*             d_free_p;
+    bsl::size_t       d_freeSize;
+    bslma::Allocator* d_allocator_p;
+
+  private:
+    InplaceFunctionQueue(const InplaceFunctionQueue&) BSLS_KEYWORD_DELETED;
+    InplaceFunctionQueue& operator=(const InplaceFunctionQueue&)
+        BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Return a node from the free list, or a newly-allocated node if the
+    /// free list is empty, appended to the back of the queue.
+    Node* privateAcquire();
+
+    /// Reset the function stored in the specified 'node' and return the
+    /// 'node' to the free list.
+    void privateRelease(Node* node);
+
+  public:
+    /// Create a new, empty queue. Optionally specify a 'basicAllocator'
+    /// used to supply memory. If 'basicAllocator' is 0, the currently
+    /// installed default allocator is used.
+    explicit InplaceFunctionQueue(bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~InplaceFunctionQueue();
+
+    /// Push a copy of the specified 'function' onto the back of the queue.
+    template <typename FUNCTION>
+    void push(const FUNCTION& function);
+
+    /// Push the target of the specified 'function' onto the back of the
+    /// queue, leaving 'function' empty. Note that the target of 'function'
+    /// is not copied.
+    void adopt(InplaceFunction::FunctionType* function);
+
+    /// Pop the function at the front of the queue and load it into the
+    /// specified 'result'. Return true if a function was popped, and false
+    /// if the queue is empty. The behavior is undefined unless 'result'
+    /// uses the same allocator as this object.
+    bool pop(InplaceFunction* result);
+
+    /// Move all functions from the specified 'other' queue onto the back of
+    /// this queue, preserving their order, leaving 'other' empty. The
+    /// behavior is undefined unless 'other' uses the same allocator as this
+    /// object.
+    void splice(InplaceFunctionQueue* other);
+
+    /// Move the nodes previously used by the specified 'other' queue onto
+    /// the free list of this queue, so they are re-used by subsequent
+    /// pushes onto this queue. The behavior is undefined unless 'other'
+    /// uses the same allocator as this object.
+    void reclaim(InplaceFunctionQueue* other);
+
+    /// Invoke and pop each function on the queue in order, including any
+    /// functions pushed onto the queue by invoked functions. Return the
+    /// number of functions invoked.
+    bsl::size_t execute();
+
+    /// Remove all functions from the queue without invoking them.
+    void clear();
+
+    /// Return the number of functions on the queue.
+    bsl::size_t size() const;
+
+    /// Return true if there are no functions on the queue, otherwise return
+    /// false.
+    bool empty() const;
+
+    /// Return the number of previously-allocated nodes available for
+    /// re-use.
+    bsl::size_t numAvailable() const;
+
+    /// Return the allocator used to supply memory.
+    bslma::Allocator* allocator() const;
+};
+
+template <typename FUNCTION>
+NTCCFG_INLINE FUNCTION* InplaceFunction::InplaceRep<FUNCTION>::object(
+    InplaceFunction* function)
+{
+    return reinterpret_cast<FUNCTION*>(function->d_buffer.buffer());
+}
+
+template <typename FUNCTION>
+NTCCFG_INLINE void InplaceFunction::InplaceRep<FUNCTION>::invoke(
+    InplaceFunction* function)
+{
+    (*object(function))();
+}
+
+template <typename FUNCTION>
+void InplaceFunction::InplaceRep<FUNCTION>::manage(
+    Operation        operation,
+    InplaceFunction* destination,
+    InplaceFunction* source)
+{
+    if (operation == e_MOVE) {
+        FUNCTION* sourceObject = object(source);
+        new (destination->d_buffer.buffer())
+            FUNCTION(bslmf::MovableRefUtil::move(*sourceObject));
+        sourceObject->~FUNCTION();
+    }
+    else {
+        object(destination)->~FUNCTION();
+    }
+}
+
+template <typename FUNCTION>
+NTCCFG_INLINE FUNCTION*& InplaceFunction::AllocatedRep<FUNCTION>::object(
+    InplaceFunction* function)
+{
+    return *reinterpret_cast<FUNCTION**>(function->d_buffer.buffer());
+}
+
+template <typename FUNCTION>
+NTCCFG_INLINE void InplaceFunction::AllocatedRep<FUNCTION>::invoke(
+    InplaceFunction* function)
+{
+    (*object(function))();
+}
+
+template <typename FUNCTION>
+void InplaceFunction::AllocatedRep<FUNCTION>::manage(
+    Operation        operation,
+    InplaceFunction* destination,
+    InplaceFunction* source)
+{
+    if (operation == e_MOVE) {
+        if (destination->d_allocator_p == source->d_allocator_p) {
+            object(destination) = object(source);
+        }
+        else {
+            FUNCTION* sourceObject = object(source);
+            object(destination) = new (*destination->d_allocator_p)
+                FUNCTION(bslmf::MovableRefUtil::move(*sourceObject));
+            bslma::DeleterHelper::deleteObject(sourceObject,
+                                               source->d_allocator_p);
+        }
+        object(source) = 0;
+    }
+    else {
+        bslma::DeleterHelper::deleteObject(object(destination),
+                                           destination->d_allocator_p);
+        object(destination) = 0;
+    }
+}
+
+template <typename FUNCTION>
+NTCCFG_INLINE void InplaceFunction::construct(const FUNCTION& function,
+                                              bsl::true_type)
+{
+    new (d_buffer.buffer()) FUNCTION(function);
+
+    d_invoker_p = &InplaceRep<FUNCTION>::invoke;
+    d_manager_p = &InplaceRep<FUNCTION>::manage;
+    d_inplace   = true;
+}
+
+template <typename FUNCTION>
+NTCCFG_INLINE void InplaceFunction::construct(const FUNCTION& function,
+                                              bsl::false_type)
+{
+    AllocatedRep<FUNCTION>::object(this) =
+        new (*d_allocator_p) FUNCTION(function);
+
+    d_invoker_p = &AllocatedRep<FUNCTION>::invoke;
+    d_manager_p = &AllocatedRep<FUNCTION>::manage;
+    d_inplace   = false;
+}
+
+NTCCFG_INLINE
+void InplaceFunction::construct(const FunctionType& function, bsl::true_type)
+{
+    new (d_buffer.buffer())
+        FunctionType(bsl::allocator_arg, d_allocator_p, function);
+
+    d_invoker_p = &InplaceRep<FunctionType>::invoke;
+    d_manager_p = &InplaceRep<FunctionType>::manage;
+    d_inplace   = true;
+}
+
+NTCCFG_INLINE
+void InplaceFunction::moveFrom(InplaceFunction* source)
+{
+    BSLS_ASSERT(d_manager_p == 0);
+
+    if (source->d_manager_p) {
+        source->d_manager_p(e_MOVE, this, source);
+
+        d_invoker_p = source->d_invoker_p;
+        d_manager_p = source->d_manager_p;
+        d_inplace   = source->d_inplace;
+
+        source->d_invoker_p = 0;
+        source->d_manager_p = 0;
+        source->d_inplace   = false;
+    }
+}
+
+NTCCFG_INLINE
+InplaceFunction::InplaceFunction(bslma::Allocator* basicAllocator)
+: d_buffer()
+, d_invoker_p(0)
+, d_manager_p(0)
+, d_inplace(false)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <typename FUNCTION>
+NTCCFG_INLINE InplaceFunction::InplaceFunction(
+    const FUNCTION&   function,
+    bslma::Allocator* basicAllocator)
+: d_buffer()
+, d_invoker_p(0)
+, d_manager_p(0)
+, d_inplace(false)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    this->construct(function, IsInplace<FUNCTION>());
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES)
+
+NTCCFG_INLINE
+InplaceFunction::InplaceFunction(InplaceFunction&& original)
+: d_buffer()
+, d_invoker_p(0)
+, d_manager_p(0)
+, d_inplace(false)
+, d_allocator_p(original.d_allocator_p)
+{
+    this->moveFrom(&original);
+}
+
+NTCCFG_INLINE
+InplaceFunction& InplaceFunction::operator=(InplaceFunction&& other)
+{
+    if (this != &other) {
+        this->reset();
+        this->moveFrom(&other);
+    }
+
+    return *this;
+}
+
+#endif
+
+NTCCFG_INLINE
+InplaceFunction::~InplaceFunction()
+{
+    this->reset();
+}
+
+template <typename FUNCTION>
+NTCCFG_INLINE void InplaceFunction::assign(const FUNCTION& function)
+{
+    this->reset();
+    this->construct(function, IsInplace<FUNCTION>());
+}
+
+NTCCFG_INLINE
+void InplaceFunction::reset()
+{
+    if (d_manager_p) {
+        d_manager_p(e_DESTROY, this, 0);
+
+        d_invoker_p = 0;
+        d_manager_p = 0;
+        d_inplace   = false;
+    }
+}
+
+NTCCFG_INLINE
+void InplaceFunction::operator()()
+{
+    BSLS_ASSERT(d_invoker_p);
+    d_invoker_p(this);
+}
+
+NTCCFG_INLINE
+InplaceFunction::operator bool() const
+{
+    return d_invoker_p != 0;
+}
+
+NTCCFG_INLINE
+bool InplaceFunction::isInplace() const
+{
+    return d_inplace;
+}
+
+NTCCFG_INLINE
+bslma::Allocator* InplaceFunction::allocator() const
+{
+    return d_allocator_p;
+}
+
+NTCCFG_INLINE
+InplaceFunctionQueue::Node* InplaceFunctionQueue::privateAcquire()
+{
+    Node* node;
+
+    if (NTCCFG_LIKELY(d_free_p)) {
+        node     = d_free_p;
+        d_free_p = node->d_next_p;
+        --d_freeSize;
+    }
+    else {
+        node = new (*d_allocator_p) Node(d_allocator_p);
+    }
+
+    node->d_next_p = 0;
+
+    if (d_tail_p) {
+        d_tail_p->d_next_p = node;
+    }
+    else {
+        d_head_p = node;
+    }
+
+    d_tail_p = node;
+    ++d_size;
+
+    return node;
+}
+
+NTCCFG_INLINE
+void InplaceFunctionQueue::privateRelease(Node* node)
+{
+    node->d_function.reset();
+
+    node->d_next_p = d_free_p;
+    d_free_p       = node;
+    ++d_freeSize;
+}
+
+template <typename FUNCTION>
+NTCCFG_INLINE void InplaceFunctionQueue::push(const FUNCTION& function)
+{
+    Node* node = this->privateAcquire();
+    node->d_function.assign(function);
+}
+
+NTCCFG_INLINE
+void InplaceFunctionQueue::adopt(InplaceFunction::FunctionType* function)
+{
+    Node* node = this->privateAcquire();
+    node->d_function.adopt(function);
+}
+
+NTCCFG_INLINE
+bsl::size_t InplaceFunctionQueue::size() const
+{
+    return d_size;
+}
+
+NTCCFG_INLINE
+bool InplaceFunctionQueue::empty() const
+{
+    return d_size == 0;
+}
+
+NTCCFG_INLINE
+bsl::size_t InplaceFunctionQueue::numAvailable() const
+{
+    return d_freeSize;
+}
+
+NTCCFG_INLINE
+bslma::Allocator* InplaceFunctionQueue::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
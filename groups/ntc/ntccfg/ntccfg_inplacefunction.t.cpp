@@ -0,0 +1,270 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntccfg_inplacefunction.h>
+
+#include <ntccfg_bind.h>
+#include <ntccfg_test.h>
+#include <bslma_testallocator.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+//
+//-----------------------------------------------------------------------------
+
+// [ 1]
+//-----------------------------------------------------------------------------
+// [ 1]
+//-----------------------------------------------------------------------------
+
+namespace test {
+
+/// Provide a function object small enough to be stored inline.
+class SmallFunction
+{
+    int* d_counter_p;
+
+  public:
+    /// Create a new function object that increments the specified
+    /// 'counter' each time it is invoked.
+    explicit SmallFunction(int* counter)
+    : d_counter_p(counter)
+    {
+    }
+
+    /// Increment the counter.
+    void operator()()
+    {
+        ++(*d_counter_p);
+    }
+};
+
+/// Provide a function object too large to be stored inline.
+class LargeFunction
+{
+    int* d_counter_p;
+    char d_padding[ntccfg::InplaceFunction::k_CAPACITY];
+
+  public:
+    /// Create a new function object that increments the specified
+    /// 'counter' each time it is invoked.
+    explicit LargeFunction(int* counter)
+    : d_counter_p(counter)
+    {
+        d_padding[0] = 0;
+    }
+
+    /// Increment the counter.
+    void operator()()
+    {
+        ++(*d_counter_p);
+    }
+};
+
+/// Append the specified 'value' to the specified 'result'.
+void append(bsl::string* result, char value)
+{
+    result->push_back(value);
+}
+
+}  // close namespace 'test'
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: Small function objects are stored inline without allocating,
+    // large function objects are allocated, and both are invoked.
+
+    ntccfg::TestAllocator ta;
+    {
+        int counter = 0;
+
+        {
+            ntccfg::InplaceFunction function(&ta);
+            NTCCFG_TEST_FALSE(function);
+
+            bsls::Types::Int64 numBlocksInUse = ta.numBlocksInUse();
+
+            function.assign(test::SmallFunction(&counter));
+            NTCCFG_TEST_TRUE(function);
+            NTCCFG_TEST_TRUE(function.isInplace());
+            NTCCFG_TEST_EQ(ta.numBlocksInUse(), numBlocksInUse);
+
+            function();
+            NTCCFG_TEST_EQ(counter, 1);
+
+            function.assign(test::LargeFunction(&counter));
+            NTCCFG_TEST_TRUE(function);
+            NTCCFG_TEST_FALSE(function.isInplace());
+            NTCCFG_TEST_EQ(ta.numBlocksInUse(), numBlocksInUse + 1);
+
+            function();
+            NTCCFG_TEST_EQ(counter, 2);
+
+            function.reset();
+            NTCCFG_TEST_FALSE(function);
+            NTCCFG_TEST_EQ(ta.numBlocksInUse(), numBlocksInUse);
+        }
+
+        {
+            ntccfg::InplaceFunction function1(test::SmallFunction(&counter),
+                                              &ta);
+            ntccfg::InplaceFunction function2(test::LargeFunction(&counter),
+                                              &ta);
+
+            function1.swap(function2);
+
+            NTCCFG_TEST_FALSE(function1.isInplace());
+            NTCCFG_TEST_TRUE(function2.isInplace());
+
+            function1();
+            function2();
+
+            NTCCFG_TEST_EQ(counter, 4);
+        }
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: Adopting a 'bsl::function' stores it inline and leaves the
+    // original empty.
+
+    ntccfg::TestAllocator ta;
+    {
+        bsl::string result(&ta);
+
+        ntccfg::InplaceFunction::FunctionType source(
+            NTCCFG_FUNCTION_INIT(&ta));
+        source = NTCCFG_BIND(&test::append, &result, 'a');
+
+        ntccfg::InplaceFunction function(&ta);
+        function.adopt(&source);
+
+        NTCCFG_TEST_FALSE(source);
+        NTCCFG_TEST_TRUE(function);
+        NTCCFG_TEST_TRUE(function.isInplace());
+
+        function();
+
+        NTCCFG_TEST_EQ(result, "a");
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(3)
+{
+    // Concern: Functions are executed in the order they are pushed, nodes
+    // are recycled, and functions may be spliced between queues.
+
+    ntccfg::TestAllocator ta;
+    {
+        bsl::string result(&ta);
+
+        ntccfg::InplaceFunctionQueue queue1(&ta);
+        ntccfg::InplaceFunctionQueue queue2(&ta);
+
+        queue1.push(NTCCFG_BIND(&test::append, &result, 'a'));
+        queue1.push(NTCCFG_BIND(&test::append, &result, 'b'));
+        queue2.push(NTCCFG_BIND(&test::append, &result, 'c'));
+
+        NTCCFG_TEST_EQ(queue1.size(), 2);
+        NTCCFG_TEST_EQ(queue2.size(), 1);
+
+        queue1.splice(&queue2);
+
+        NTCCFG_TEST_EQ(queue1.size(), 3);
+        NTCCFG_TEST_TRUE(queue2.empty());
+
+        NTCCFG_TEST_EQ(queue1.execute(), 3);
+        NTCCFG_TEST_EQ(result, "abc");
+
+        NTCCFG_TEST_TRUE(queue1.empty());
+        NTCCFG_TEST_EQ(queue1.numAvailable(), 3);
+
+        queue2.reclaim(&queue1);
+
+        NTCCFG_TEST_EQ(queue1.numAvailable(), 0);
+        NTCCFG_TEST_EQ(queue2.numAvailable(), 3);
+
+        queue2.push(NTCCFG_BIND(&test::append, &result, 'd'));
+
+        ntccfg::InplaceFunction function(&ta);
+        NTCCFG_TEST_TRUE(queue2.pop(&function));
+        NTCCFG_TEST_FALSE(queue2.pop(&function));
+
+        function();
+        NTCCFG_TEST_EQ(result, "abcd");
+
+        NTCCFG_TEST_EQ(queue2.numAvailable(), 3);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(4)
+{
+    // Concern: Pushing and executing functions whose objects fit in the
+    // inline buffer performs no memory allocation once the queue has reached
+    // its steady-state depth.
+
+    ntccfg::TestAllocator ta;
+    {
+        const bsl::size_t k_QUEUE_DEPTH = 64;
+        const bsl::size_t k_NUM_ROUNDS  = 100;
+
+        int counter = 0;
+
+        bslma::TestAllocator queueAllocator;
+
+        ntccfg::InplaceFunctionQueue queue(&queueAllocator);
+
+        bsls::Types::Int64 numAllocationsAfterWarmup = 0;
+
+        for (bsl::size_t round = 0; round < k_NUM_ROUNDS; ++round) {
+            for (bsl::size_t i = 0; i < k_QUEUE_DEPTH; ++i) {
+                queue.push(test::SmallFunction(&counter));
+            }
+
+            NTCCFG_TEST_EQ(queue.execute(), k_QUEUE_DEPTH);
+
+            if (round == 0) {
+                numAllocationsAfterWarmup = queueAllocator.numAllocations();
+            }
+            else {
+                NTCCFG_TEST_EQ(queueAllocator.numAllocations(),
+                               numAllocationsAfterWarmup);
+            }
+        }
+
+        NTCCFG_TEST_EQ(counter,
+                       static_cast<int>(k_QUEUE_DEPTH * k_NUM_ROUNDS));
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+    NTCCFG_TEST_REGISTER(3);
+    NTCCFG_TEST_REGISTER(4);
+}
+NTCCFG_TEST_DRIVER_END;
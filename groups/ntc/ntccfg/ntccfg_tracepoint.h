@@ -0,0 +1,104 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCCFG_TRACEPOINT
+#define INCLUDED_NTCCFG_TRACEPOINT
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntccfg_config.h>
+#include <ntcscm_version.h>
+#include <bsls_platform.h>
+
+// Tracepoints are implemented as user-level statically-defined tracing
+// (USDT) probes in the "ntf" provider. Each probe compiles to a single
+// no-op instruction and a note in the ELF binary describing the location of
+// its arguments. A tracer such as 'perf' or 'bpftrace' attached to a running
+// process replaces the no-op with a breakpoint, so tracepoints cost nothing
+// beyond the evaluation of their arguments until they are traced. Note that
+// arguments should therefore be cheap to evaluate, such as a pointer, a
+// handle, or a value already computed. See 'tools/bpftrace' for scripts that
+// consume these tracepoints.
+
+#if NTC_BUILD_WITH_TRACEPOINTS && defined(BSLS_PLATFORM_OS_LINUX)
+#if defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#define NTCCFG_TRACEPOINT_ENABLED 1
+#endif
+#endif
+#endif
+
+#if !defined(NTCCFG_TRACEPOINT_ENABLED)
+#define NTCCFG_TRACEPOINT_ENABLED 0
+#endif
+
+#if NTCCFG_TRACEPOINT_ENABLED
+
+#include <sys/sdt.h>
+
+/// Define a tracepoint with the specified 'name'.
+/// @ingroup module_ntccfg
+#define NTCCFG_TRACEPOINT(name) DTRACE_PROBE(ntf, name)
+
+/// Define a tracepoint with the specified 'name' and argument 'a1'.
+/// @ingroup module_ntccfg
+#define NTCCFG_TRACEPOINT1(name, a1) DTRACE_PROBE1(ntf, name, a1)
+
+/// Define a tracepoint with the specified 'name' and arguments 'a1' and
+/// 'a2'.
+/// @ingroup module_ntccfg
+#define NTCCFG_TRACEPOINT2(name, a1, a2) DTRACE_PROBE2(ntf, name, a1, a2)
+
+/// Define a tracepoint with the specified 'name' and arguments 'a1', 'a2',
+/// and 'a3'.
+/// @ingroup module_ntccfg
+#define NTCCFG_TRACEPOINT3(name, a1, a2, a3)                                  \
+    DTRACE_PROBE3(ntf, name, a1, a2, a3)
+
+/// Define a tracepoint with the specified 'name' and arguments 'a1', 'a2',
+/// 'a3', and 'a4'.
+/// @ingroup module_ntccfg
+#define NTCCFG_TRACEPOINT4(name, a1, a2, a3, a4)                              \
+    DTRACE_PROBE4(ntf, name, a1, a2, a3, a4)
+
+#else
+
+/// Define a tracepoint with the specified 'name'.
+/// @ingroup module_ntccfg
+#define NTCCFG_TRACEPOINT(name)
+
+/// Define a tracepoint with the specified 'name' and argument 'a1'.
+/// @ingroup module_ntccfg
+#define NTCCFG_TRACEPOINT1(name, a1)
+
+/// Define a tracepoint with the specified 'name' and arguments 'a1' and
+/// 'a2'.
+/// @ingroup module_ntccfg
+#define NTCCFG_TRACEPOINT2(name, a1, a2)
+
+/// Define a tracepoint with the specified 'name' and arguments 'a1', 'a2',
+/// and 'a3'.
+/// @ingroup module_ntccfg
+#define NTCCFG_TRACEPOINT3(name, a1, a2, a3)
+
+/// Define a tracepoint with the specified 'name' and arguments 'a1', 'a2',
+/// 'a3', and 'a4'.
+/// @ingroup module_ntccfg
+#define NTCCFG_TRACEPOINT4(name, a1, a2, a3, a4)
+
+#endif
+
+#endif
@@ -0,0 +1,83 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcd_benchmarkutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntcd_benchmarkutil_cpp, "$Id$ $CSID$")
+
+#include <bdlt_currenttime.h>
+#include <bslmt_lockguard.h>
+#include <bsls_timeinterval.h>
+
+namespace BloombergLP {
+namespace ntcd {
+
+BenchmarkCountdown::BenchmarkCountdown(bsl::size_t count)
+: d_mutex()
+, d_condition()
+, d_count(count)
+{
+}
+
+BenchmarkCountdown::~BenchmarkCountdown()
+{
+}
+
+void BenchmarkCountdown::arrive()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    if (d_count > 0) {
+        --d_count;
+        if (d_count == 0) {
+            d_condition.broadcast();
+        }
+    }
+}
+
+bool BenchmarkCountdown::wait(bsl::size_t timeout)
+{
+    bsls::TimeInterval deadline = bdlt::CurrentTime::now();
+    deadline.addSeconds(static_cast<bsls::Types::Int64>(timeout));
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    while (d_count > 0) {
+        int rc = d_condition.timedWait(&d_mutex, deadline);
+        if (rc != 0 && d_count > 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bsls::Types::Int64 BenchmarkUtil::percentile(
+    const bsl::vector<bsls::Types::Int64>& sorted,
+    double                                 fraction)
+{
+    if (sorted.empty()) {
+        return 0;
+    }
+
+    bsl::size_t index = static_cast<bsl::size_t>(fraction * sorted.size());
+    if (index >= sorted.size()) {
+        index = sorted.size() - 1;
+    }
+
+    return sorted[index];
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,85 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCD_BENCHMARKUTIL
+#define INCLUDED_NTCD_BENCHMARKUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntccfg_platform.h>
+#include <ntcscm_version.h>
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+#include <bsl_cstddef.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ntcd {
+
+/// @internal @brief
+/// Provide a countdown that may be waited upon with a timeout.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntcd
+class BenchmarkCountdown
+{
+    bslmt::Mutex     d_mutex;
+    bslmt::Condition d_condition;
+    bsl::size_t      d_count;
+
+  private:
+    BenchmarkCountdown(const BenchmarkCountdown&) BSLS_KEYWORD_DELETED;
+    BenchmarkCountdown& operator=(const BenchmarkCountdown&)
+        BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new countdown from the specified 'count'.
+    explicit BenchmarkCountdown(bsl::size_t count);
+
+    /// Destroy this object.
+    ~BenchmarkCountdown();
+
+    /// Decrement the count and wake any waiters if the count reaches zero.
+    void arrive();
+
+    /// Block until the count reaches zero or the specified 'timeout' in
+    /// seconds elapses. Return true if the count reached zero, otherwise
+    /// return false.
+    bool wait(bsl::size_t timeout);
+};
+
+/// @internal @brief
+/// Provide utilities for reporting the results of benchmarks.
+///
+/// @par Thread Safety
+/// This struct is thread safe.
+///
+/// @ingroup module_ntcd
+struct BenchmarkUtil {
+    /// Return the value at the specified 'fraction' percentile of the
+    /// specified 'sorted' values, or 0 if 'sorted' is empty.
+    static bsls::Types::Int64 percentile(
+        const bsl::vector<bsls::Types::Int64>& sorted,
+        double                                 fraction);
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
@@ -0,0 +1,68 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcd_benchmarkutil.h>
+
+#include <ntccfg_test.h>
+
+using namespace BloombergLP;
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: Percentiles are selected from the sorted values.
+
+    ntccfg::TestAllocator ta;
+    {
+        bsl::vector<bsls::Types::Int64> sorted(&ta);
+
+        NTCCFG_TEST_EQ(ntcd::BenchmarkUtil::percentile(sorted, 0.5), 0);
+
+        for (bsls::Types::Int64 i = 1; i <= 100; ++i) {
+            sorted.push_back(i);
+        }
+
+        NTCCFG_TEST_EQ(ntcd::BenchmarkUtil::percentile(sorted, 0.0), 1);
+        NTCCFG_TEST_EQ(ntcd::BenchmarkUtil::percentile(sorted, 0.5), 51);
+        NTCCFG_TEST_EQ(ntcd::BenchmarkUtil::percentile(sorted, 0.99), 100);
+        NTCCFG_TEST_EQ(ntcd::BenchmarkUtil::percentile(sorted, 1.0), 100);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: Waiting on a countdown succeeds once each party has arrived,
+    // and times out otherwise.
+
+    {
+        ntcd::BenchmarkCountdown countdown(2);
+
+        countdown.arrive();
+        NTCCFG_TEST_FALSE(countdown.wait(0));
+
+        countdown.arrive();
+        NTCCFG_TEST_TRUE(countdown.wait(0));
+
+        countdown.arrive();
+        NTCCFG_TEST_TRUE(countdown.wait(0));
+    }
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+}
+NTCCFG_TEST_DRIVER_END;
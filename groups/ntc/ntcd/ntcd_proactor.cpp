@@ -1632,21 +1632,24 @@ void Proactor::poll(ntci::Waiter waiter)
                 if (entry->announceError(event)) {
                     ++numErrors;
                 }
-                NTCS_PROACTORMETRICS_UPDATE_ERROR_CALLBACK_TIME_END();
+                NTCS_PROACTORMETRICS_UPDATE_ERROR_CALLBACK_TIME_END(
+                    descriptorHandle);
             }
             else if (event.isWritable()) {
                 NTCS_PROACTORMETRICS_UPDATE_WRITE_CALLBACK_TIME_BEGIN();
                 if (entry->announceWritable(event)) {
                     ++numWritable;
                 }
-                NTCS_PROACTORMETRICS_UPDATE_WRITE_CALLBACK_TIME_END();
+                NTCS_PROACTORMETRICS_UPDATE_WRITE_CALLBACK_TIME_END(
+                    descriptorHandle);
             }
             else if (event.isReadable()) {
                 NTCS_PROACTORMETRICS_UPDATE_READ_CALLBACK_TIME_BEGIN();
                 if (entry->announceReadable(event)) {
                     ++numReadable;
                 }
-                NTCS_PROACTORMETRICS_UPDATE_READ_CALLBACK_TIME_END();
+                NTCS_PROACTORMETRICS_UPDATE_READ_CALLBACK_TIME_END(
+                    descriptorHandle);
             }
             if (entry->decrementProcessCounter() == 0 &&
                 entry->announceDetached(this->getSelf(this)))
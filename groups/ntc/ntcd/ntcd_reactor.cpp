@@ -1311,7 +1311,8 @@ void Reactor::poll(ntci::Waiter waiter)
                     if (entry->announceError(event)) {
                         ++numErrors;
                     }
-                    NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END();
+                    NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END(
+                        descriptorHandle);
                 }
                 else {
                     bsl::weak_ptr<ntcd::Session> session_wp;
@@ -1339,7 +1340,8 @@ void Reactor::poll(ntci::Waiter waiter)
                                 {
                                     ++numErrors;
                                 }
-                                NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END();
+                                NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END(
+                                    descriptorHandle);
                             }
                         }
                     }
@@ -1351,14 +1353,16 @@ void Reactor::poll(ntci::Waiter waiter)
                     if (entry->announceWritable(event)) {
                         ++numWritable;
                     }
-                    NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END();
+                    NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END(
+                        descriptorHandle);
                 }
                 else if (event.isReadable()) {
                     NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_BEGIN();
                     if (entry->announceReadable(event)) {
                         ++numReadable;
                     }
-                    NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END();
+                    NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END(
+                        descriptorHandle);
                 }
             }
 
@@ -20,11 +20,14 @@
 #include <ntsa_host.h>
 #include <ntsu_resolverutil.h>
 
+#include <bdld_datum.h>
+#include <bdld_manageddatum.h>
 #include <bslim_printer.h>
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 #include <bslmt_lockguard.h>
 #include <bsls_assert.h>
+#include <bsl_cstring.h>
 
 namespace BloombergLP {
 namespace ntcdns {
@@ -43,7 +46,7 @@ const bsl::size_t k_DEFAULT_NEGATIVE_CACHE_MAX_TIME_TO_LIVE =
 }  // close unnamed namespace
 
 CacheHostEntry::CacheHostEntry(bslma::Allocator* basicAllocator)
-: d_domainName(basicAllocator)
+: d_domainName()
 , d_ipAddress()
 , d_nameServer()
 , d_timeToLive(0)
@@ -52,13 +55,14 @@ CacheHostEntry::CacheHostEntry(bslma::Allocator* basicAllocator)
 , d_iteratorByDomainName()
 , d_iteratorByIpAddress()
 {
+    NTCCFG_WARNING_UNUSED(basicAllocator);
 }
 
 CacheHostEntry::~CacheHostEntry()
 {
 }
 
-void CacheHostEntry::setDomainName(const bsl::string& value)
+void CacheHostEntry::setDomainName(const bslstl::StringRef& value)
 {
     d_domainName = value;
 }
@@ -100,7 +104,7 @@ void CacheHostEntry::setIteratorByIpAddress(
     d_iteratorByIpAddress = value;
 }
 
-const bsl::string& CacheHostEntry::domainName() const
+const bslstl::StringRef& CacheHostEntry::domainName() const
 {
     return d_domainName;
 }
@@ -163,6 +167,20 @@ bsl::ostream& operator<<(bsl::ostream& stream, const CacheHostEntry& object)
     return object.print(stream, 0, -1);
 }
 
+const ntci::MetricMetadata Cache::STATISTICS[] = {
+    NTCI_METRIC_METADATA_GAUGE(hostEntries),
+    NTCI_METRIC_METADATA_GAUGE(domainNames),
+    NTCI_METRIC_METADATA_GAUGE(domainNameBytes),
+    NTCI_METRIC_METADATA_GAUGE(bytesInUse),
+};
+
+Cache::DomainName::DomainName(const bslstl::StringRef& value,
+                              bslma::Allocator*        basicAllocator)
+: d_value(value, basicAllocator)
+, d_numReferences(0)
+{
+}
+
 void Cache::privateRemove(
     const bsl::shared_ptr<ntcdns::CacheHostEntry>& cacheEntry)
 {
@@ -176,13 +194,59 @@ void Cache::privateRemove(
 
     d_cacheEntryByIpAddress.erase(cacheEntry->iteratorByIpAddress());
 
+    this->privateReleaseDomainName(cacheEntry->domainName());
+    cacheEntry->setDomainName(bslstl::StringRef());
+
     --d_cacheEntryCount;
 }
 
+bslstl::StringRef Cache::privateAcquireDomainName(
+    const bslstl::StringRef& domainName)
+{
+    DomainName* interned;
+
+    DomainNameTable::iterator it = d_domainNameTable.find(domainName);
+    if (it != d_domainNameTable.end()) {
+        interned = it->second;
+    }
+    else {
+        interned = new (d_memoryPool) DomainName(domainName, &d_memoryPool);
+
+        d_domainNameTable.insert(
+            DomainNameTable::value_type(bslstl::StringRef(interned->d_value),
+                                        interned));
+
+        d_domainNameBytes += interned->d_value.size();
+    }
+
+    ++interned->d_numReferences;
+
+    return interned->d_value;
+}
+
+void Cache::privateReleaseDomainName(const bslstl::StringRef& domainName)
+{
+    DomainNameTable::iterator it = d_domainNameTable.find(domainName);
+    BSLS_ASSERT_OPT(it != d_domainNameTable.end());
+
+    DomainName* interned = it->second;
+    BSLS_ASSERT_OPT(interned->d_numReferences > 0);
+
+    if (--interned->d_numReferences == 0) {
+        d_domainNameBytes -= interned->d_value.size();
+        d_domainNameTable.erase(it);
+        d_memoryPool.deleteObject(interned);
+    }
+}
+
 Cache::Cache(bslma::Allocator* basicAllocator)
 : d_mutex()
-, d_cacheEntryByDomainName(basicAllocator)
-, d_cacheEntryByIpAddress(basicAllocator)
+, d_memoryCounter("ntcdns::Cache", basicAllocator)
+, d_memoryPool(&d_memoryCounter)
+, d_cacheEntryByDomainName(&d_memoryPool)
+, d_cacheEntryByIpAddress(&d_memoryPool)
+, d_domainNameTable(&d_memoryPool)
+, d_domainNameBytes(0)
 , d_cacheEntryCount(0)
 , d_positiveCacheEnabled(k_DEFAULT_POSITIVE_CACHE_ENABLED)
 , d_positiveCacheMinTimeToLive(k_DEFAULT_POSITIVE_CACHE_MIN_TIME_TO_LIVE)
@@ -232,8 +296,26 @@ void Cache::clear()
 {
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
-    d_cacheEntryByDomainName.clear();
-    d_cacheEntryByIpAddress.clear();
+    // Destroy the host entries and the indexes, then release all memory
+    // supplied by the pool at once. The interned domain names are not
+    // destroyed individually: their only resource is memory supplied by the
+    // pool.
+
+    {
+        ntcdns::CacheHostEntryByDomainName cacheEntryByDomainName(
+            &d_memoryPool);
+        ntcdns::CacheHostEntryByIpAddress cacheEntryByIpAddress(
+            &d_memoryPool);
+        DomainNameTable domainNameTable(&d_memoryPool);
+
+        cacheEntryByDomainName.swap(d_cacheEntryByDomainName);
+        cacheEntryByIpAddress.swap(d_cacheEntryByIpAddress);
+        domainNameTable.swap(d_domainNameTable);
+    }
+
+    d_memoryPool.release();
+
+    d_domainNameBytes = 0;
     d_cacheEntryCount = 0;
 }
 
@@ -245,11 +327,15 @@ void Cache::updateHost(const bsl::string&        domainName,
 {
     NTCI_LOG_CONTEXT();
 
-    bsl::shared_ptr<ntcdns::CacheHostEntry> newCacheEntry;
-    bool                                    oldCacheEntryUpdated = false;
+    // Lock the mutex before declaring any host entry so that the last
+    // reference to an entry is never released after the mutex is unlocked,
+    // which could otherwise race with 'clear'.
 
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
+    bsl::shared_ptr<ntcdns::CacheHostEntry> newCacheEntry;
+    bool                                    oldCacheEntryUpdated = false;
+
     {
         bool mustInsert = true;
 
@@ -296,13 +382,13 @@ void Cache::updateHost(const bsl::string&        domainName,
 
                     BSLS_ASSERT_OPT(jt == cacheEntry->iteratorByDomainName());
 
-                    this->privateRemove(cacheEntry);
-
                     NTCI_LOG_STREAM_TRACE
                         << "DNS cache removed host entry " << *cacheEntry
                         << ": expiration at " << cacheEntry->expiration()
                         << " is greater than or equal to now at " << now
                         << NTCI_LOG_STREAM_END;
+
+                    this->privateRemove(cacheEntry);
                 }
                 else {
                     ++it;
@@ -312,9 +398,10 @@ void Cache::updateHost(const bsl::string&        domainName,
 
         if (mustInsert) {
             if (!newCacheEntry) {
-                newCacheEntry.createInplace(d_allocator_p, d_allocator_p);
+                newCacheEntry.createInplace(&d_memoryPool, &d_memoryPool);
 
-                newCacheEntry->setDomainName(domainName);
+                newCacheEntry->setDomainName(
+                    this->privateAcquireDomainName(domainName));
                 newCacheEntry->setIpAddress(ipAddress);
                 newCacheEntry->setNameServer(nameServer);
                 newCacheEntry->setTimeToLive(timeToLive);
@@ -335,7 +422,7 @@ void Cache::updateHost(const bsl::string&        domainName,
                 newCacheEntryIteratorByDomainName =
                     d_cacheEntryByDomainName.insert(
                         ntcdns::CacheHostEntryByDomainName::value_type(
-                            domainName,
+                            newCacheEntry->domainName(),
                             newCacheEntry));
 
             newCacheEntry->setIteratorByDomainName(
@@ -379,13 +466,13 @@ void Cache::updateHost(const bsl::string&        domainName,
 
                 BSLS_ASSERT_OPT(it == cacheEntry->iteratorByIpAddress());
 
-                this->privateRemove(cacheEntry);
-
                 NTCI_LOG_STREAM_TRACE
                     << "DNS cache removed host entry " << *cacheEntry
                     << ": expiration at " << cacheEntry->expiration()
                     << " is greater than or equal to now at " << now
                     << NTCI_LOG_STREAM_END;
+
+                this->privateRemove(cacheEntry);
             }
         }
 
@@ -394,9 +481,10 @@ void Cache::updateHost(const bsl::string&        domainName,
                 // MRM: Logically, the new cache entry must have been created.
                 BSLS_ASSERT_OPT(newCacheEntry);
 
-                newCacheEntry.createInplace(d_allocator_p, d_allocator_p);
+                newCacheEntry.createInplace(&d_memoryPool, &d_memoryPool);
 
-                newCacheEntry->setDomainName(domainName);
+                newCacheEntry->setDomainName(
+                    this->privateAcquireDomainName(domainName));
                 newCacheEntry->setIpAddress(ipAddress);
                 newCacheEntry->setNameServer(nameServer);
                 newCacheEntry->setTimeToLive(timeToLive);
@@ -466,10 +554,8 @@ ntsa::Error Cache::getIpAddress(ntca::GetIpAddressContext*       context,
 
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
-    bsl::string key = domainName;
-
     ntcdns::CacheHostEntryByDomainNameIteratorPair range =
-        d_cacheEntryByDomainName.equal_range(key);
+        d_cacheEntryByDomainName.equal_range(domainName);
 
     if (range.first == d_cacheEntryByDomainName.end()) {
         NTCI_LOG_STREAM_TRACE
@@ -497,13 +583,13 @@ ntsa::Error Cache::getIpAddress(ntca::GetIpAddressContext*       context,
 
             BSLS_ASSERT_OPT(jt == cacheEntry->iteratorByDomainName());
 
-            const_cast<Cache*>(this)->privateRemove(cacheEntry);
-
             NTCI_LOG_STREAM_TRACE
                 << "DNS cache removed host entry " << *cacheEntry
                 << ": expiration at " << cacheEntry->expiration()
                 << " is greater than or equal to now at " << now
                 << NTCI_LOG_STREAM_END;
+
+            const_cast<Cache*>(this)->privateRemove(cacheEntry);
         }
         else {
             if (ipAddressType.isNull() ||
@@ -619,19 +705,20 @@ ntsa::Error Cache::getDomainName(ntca::GetDomainNameContext*       context,
     if (now >= cacheEntry->expiration()) {
         BSLS_ASSERT_OPT(it == cacheEntry->iteratorByIpAddress());
 
-        const_cast<Cache*>(this)->privateRemove(cacheEntry);
-
         NTCI_LOG_STREAM_TRACE << "DNS cache removed host entry " << *cacheEntry
                               << ": expiration at " << cacheEntry->expiration()
                               << " is greater than or equal to now at " << now
                               << NTCI_LOG_STREAM_END;
+
+        const_cast<Cache*>(this)->privateRemove(cacheEntry);
     }
     else {
         NTCI_LOG_STREAM_TRACE << "DNS cache found host entry " << *cacheEntry
                               << " for IP address " << ipAddress
                               << NTCI_LOG_STREAM_END;
 
-        domainName = cacheEntry->domainName();
+        domainName.assign(cacheEntry->domainName().data(),
+                          cacheEntry->domainName().length());
 
         if (nameServer.isNull()) {
             nameServer.makeValue(cacheEntry->nameServer());
@@ -717,5 +804,118 @@ bsl::size_t Cache::numPortEntries() const
     return 0;
 }
 
+bsl::size_t Cache::numDomainNames() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_domainNameTable.size();
+}
+
+bsl::size_t Cache::numDomainNameBytes() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_domainNameBytes;
+}
+
+bsl::size_t Cache::numBytesInUse() const
+{
+    return NTCCFG_WARNING_NARROW(bsl::size_t,
+                                 d_memoryCounter.numBytesInUse());
+}
+
+void Cache::getStats(bdld::ManagedDatum* result)
+{
+    bsl::size_t numHostEntries     = 0;
+    bsl::size_t numDomainNames     = 0;
+    bsl::size_t numDomainNameBytes = 0;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        numHostEntries     = d_cacheEntryCount;
+        numDomainNames     = d_domainNameTable.size();
+        numDomainNameBytes = d_domainNameBytes;
+    }
+
+    bsl::size_t numBytesInUse = this->numBytesInUse();
+
+    bdld::DatumMutableArrayRef array;
+    bdld::Datum::createUninitializedArray(&array,
+                                          numOrdinals(),
+                                          result->allocator());
+
+    array.data()[0] = bdld::Datum::createDouble(double(numHostEntries));
+    array.data()[1] = bdld::Datum::createDouble(double(numDomainNames));
+    array.data()[2] = bdld::Datum::createDouble(double(numDomainNameBytes));
+    array.data()[3] = bdld::Datum::createDouble(double(numBytesInUse));
+
+    *array.length() = numOrdinals();
+
+    result->adopt(bdld::Datum::adoptArray(array));
+}
+
+const char* Cache::getFieldPrefix(int ordinal) const
+{
+    NTCCFG_WARNING_UNUSED(ordinal);
+
+    return "resolver";
+}
+
+const char* Cache::getFieldName(int ordinal) const
+{
+    if (ordinal < numOrdinals()) {
+        return Cache::STATISTICS[ordinal].d_name;
+    }
+    else {
+        return 0;
+    }
+}
+
+const char* Cache::getFieldDescription(int ordinal) const
+{
+    NTCCFG_WARNING_UNUSED(ordinal);
+
+    return "";
+}
+
+ntci::Monitorable::StatisticType Cache::getFieldType(int ordinal) const
+{
+    if (ordinal < numOrdinals()) {
+        return Cache::STATISTICS[ordinal].d_type;
+    }
+    else {
+        return ntci::Monitorable::e_AVERAGE;
+    }
+}
+
+int Cache::getFieldTags(int ordinal) const
+{
+    NTCCFG_WARNING_UNUSED(ordinal);
+
+    return ntci::Monitorable::e_ANONYMOUS;
+}
+
+int Cache::getFieldOrdinal(const char* fieldName) const
+{
+    int result = 0;
+
+    for (int ordinal = 0; ordinal < numOrdinals(); ++ordinal) {
+        if (bsl::strcmp(Cache::STATISTICS[ordinal].d_name, fieldName) == 0) {
+            result = ordinal;
+        }
+    }
+
+    return result;
+}
+
+int Cache::numOrdinals() const
+{
+    return sizeof Cache::STATISTICS / sizeof Cache::STATISTICS[0];
+}
+
+const char* Cache::objectName() const
+{
+    return "cache";
+}
+
 }  // close package namespace
 }  // close enterprise namespace
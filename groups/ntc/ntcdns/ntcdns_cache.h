@@ -19,6 +19,8 @@
 #include <ntcdns_database.h>
 #include <ntcdns_utility.h>
 #include <ntcdns_vocabulary.h>
+#include <ntci_metric.h>
+#include <ntci_monitorable.h>
 #include <ntcscm_version.h>
 
 #include <ntsa_domainname.h>
@@ -27,7 +29,11 @@
 #include <ntsa_ipaddress.h>
 #include <ntsa_port.h>
 
+#include <bdlma_concurrentmultipoolallocator.h>
+#include <bdlma_countingallocator.h>
 #include <bslmt_mutex.h>
+#include <bslstl_stringref.h>
+#include <bsls_keyword.h>
 #include <bsls_timeinterval.h>
 
 #include <bsl_map.h>
@@ -46,10 +52,11 @@ namespace ntcdns {
 /// Define a type alias for a multi-valued association
 /// between a domain name and the cached entries that describe the
 /// association between the domain name and the last known IP addresses
-/// it has been assigned.
+/// it has been assigned. Each key refers to the domain name interned by
+/// the cache.
 ///
 /// @ingroup module_ntcdns
-typedef bsl::unordered_multimap<bsl::string,
+typedef bsl::unordered_multimap<bslstl::StringRef,
                                 bsl::shared_ptr<ntcdns::CacheHostEntry> >
     CacheHostEntryByDomainName;
 
@@ -97,7 +104,7 @@ typedef CacheHostEntryByIpAddress::iterator CacheHostEntryByIpAddressIterator;
 /// @ingroup module_ntcdns
 class CacheHostEntry
 {
-    bsl::string        d_domainName;
+    bslstl::StringRef  d_domainName;
     ntsa::IpAddress    d_ipAddress;
     ntsa::Endpoint     d_nameServer;
     bsl::size_t        d_timeToLive;
@@ -120,8 +127,12 @@ class CacheHostEntry
     /// Destroy this object.
     ~CacheHostEntry();
 
-    /// Set the domain name to the specified 'value'.
-    void setDomainName(const bsl::string& value);
+    /// Set the domain name to the specified 'value'. The behavior is
+    /// undefined unless the characters referred to by 'value' remain valid
+    /// until the domain name is next set or this object is destroyed. Note
+    /// that 'value' typically refers to a domain name interned by the
+    /// cache.
+    void setDomainName(const bslstl::StringRef& value);
 
     /// Set the IP address to the specified 'value'.
     void setIpAddress(const ntsa::IpAddress& value);
@@ -151,7 +162,7 @@ class CacheHostEntry
         ntcdns::CacheHostEntryByIpAddressIterator value);
 
     /// Return the domain name.
-    const bsl::string& domainName() const;
+    const bslstl::StringRef& domainName() const;
 
     /// Return the IP address.
     const ntsa::IpAddress& ipAddress() const;
@@ -201,15 +212,46 @@ bsl::ostream& operator<<(bsl::ostream& stream, const CacheHostEntry& object);
 /// @internal @brief
 /// Provide a cache of names, addresses, and ports.
 ///
+/// @details
+/// All memory for the host entries, the indexes of the host entries, and
+/// the domain names is supplied by a multipool owned by the cache, so that
+/// entries of similar size are packed together and clearing the cache
+/// returns the memory to the allocator supplied at construction in bulk.
+/// Each distinct domain name is stored once, regardless of the number of IP
+/// addresses to which it is assigned. The number of entries, the number of
+/// distinct domain names, and the memory footprint of the cache are
+/// reported through the 'ntci::Monitorable' interface.
+///
 /// @par Thread Safety
 /// This class is thread safe.
 ///
 /// @ingroup module_ntcdns
-class Cache
+class Cache : public ntci::Monitorable
 {
+    /// This struct describes a domain name interned by the cache.
+    struct DomainName {
+        /// Create a new interned copy of the specified 'value'. Use the
+        /// specified 'basicAllocator' to supply memory.
+        DomainName(const bslstl::StringRef& value,
+                   bslma::Allocator*        basicAllocator);
+
+        bsl::string d_value;
+        bsl::size_t d_numReferences;
+    };
+
+    /// Define a type alias for a map of domain names to their interned
+    /// representation. Each key refers to the value of its interned
+    /// domain name.
+    typedef bsl::unordered_map<bslstl::StringRef, DomainName*>
+        DomainNameTable;
+
     mutable bslmt::Mutex                       d_mutex;
+    bdlma::CountingAllocator                   d_memoryCounter;
+    bdlma::ConcurrentMultipoolAllocator        d_memoryPool;
     mutable ntcdns::CacheHostEntryByDomainName d_cacheEntryByDomainName;
     mutable ntcdns::CacheHostEntryByIpAddress  d_cacheEntryByIpAddress;
+    mutable DomainNameTable                    d_domainNameTable;
+    mutable bsl::size_t                        d_domainNameBytes;
     mutable bsl::size_t                        d_cacheEntryCount;
     bool                                       d_positiveCacheEnabled;
     bsl::size_t                                d_positiveCacheMinTimeToLive;
@@ -219,15 +261,30 @@ class Cache
     bsl::size_t                                d_negativeCacheMaxTimeToLive;
     bslma::Allocator*                          d_allocator_p;
 
+    static const struct ntci::MetricMetadata STATISTICS[];
+
   private:
     Cache(const Cache&) BSLS_KEYWORD_DELETED;
     Cache& operator=(const Cache&) BSLS_KEYWORD_DELETED;
 
   private:
-    /// Remove the specified 'cacheEntry'.
+    /// Remove the specified 'cacheEntry' and release its reference to its
+    /// interned domain name. The behavior is undefined unless the mutex is
+    /// locked.
     void privateRemove(
         const bsl::shared_ptr<ntcdns::CacheHostEntry>& cacheEntry);
 
+    /// Return the interned copy of the specified 'domainName', interning
+    /// it if necessary, and acquire a reference to it. The behavior is
+    /// undefined unless the mutex is locked.
+    bslstl::StringRef privateAcquireDomainName(
+        const bslstl::StringRef& domainName);
+
+    /// Release a reference to the specified interned 'domainName',
+    /// destroying the interned copy if no references remain. The behavior
+    /// is undefined unless the mutex is locked.
+    void privateReleaseDomainName(const bslstl::StringRef& domainName);
+
   public:
     /// Create a new object. Optionally specify a 'basicAllocator' used to
     /// supply memory. If 'basicAllocator' is 0, the currently installed
@@ -235,9 +292,10 @@ class Cache
     explicit Cache(bslma::Allocator* basicAllocator = 0);
 
     /// Destroy this object.
-    ~Cache();
+    ~Cache() BSLS_KEYWORD_OVERRIDE;
 
-    /// Clear the cache.
+    /// Clear the cache and release all memory used by the cache back to
+    /// the allocator supplied at construction.
     void clear();
 
     /// Set the flag indicating the positive cache is enabled to the
@@ -326,6 +384,60 @@ class Cache
 
     /// Return the number of cached service name to port associations.
     bsl::size_t numPortEntries() const;
+
+    /// Return the number of distinct domain names interned by the cache.
+    bsl::size_t numDomainNames() const;
+
+    /// Return the number of characters in the distinct domain names
+    /// interned by the cache.
+    bsl::size_t numDomainNameBytes() const;
+
+    /// Return the number of bytes currently allocated by the cache from the
+    /// allocator supplied at construction.
+    bsl::size_t numBytesInUse() const;
+
+    /// Load into the specified 'result' the array of statistics for this
+    /// object. Note that 'result->theArray().length()' is expected to have
+    /// the same value each time this function returns.
+    void getStats(bdld::ManagedDatum* result) BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the prefix corresponding to the field at the specified
+    /// 'ordinal' position, or 0 if no field at the 'ordinal' position
+    /// exists.
+    const char* getFieldPrefix(int ordinal) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the field name corresponding to the field at the specified
+    /// 'ordinal' position, or 0 if no field at the 'ordinal' position
+    /// exists.
+    const char* getFieldName(int ordinal) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the field description corresponding to the field at the
+    /// specified 'ordinal' position, or 0 if no field at the 'ordinal'
+    /// position exists.
+    const char* getFieldDescription(int ordinal) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the type of the statistic at the specified 'ordinal'
+    /// position, or e_AVERAGE if no field at the 'ordinal' position exists
+    /// or the type is unknown.
+    ntci::Monitorable::StatisticType getFieldType(int ordinal) const
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the flags that indicate which indexes to apply to the
+    /// statistics measured by this monitorable object.
+    int getFieldTags(int ordinal) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the ordinal of the specified 'fieldName', or a negative value
+    /// if no field identified by 'fieldName' exists.
+    int getFieldOrdinal(const char* fieldName) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the maximum number of elements in a datum resulting from
+    /// a call to 'getStats()'.
+    int numOrdinals() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the human-readable name of the monitorable object, or 0 or
+    /// the empty string if no such human-readable name has been assigned to
+    /// the monitorable object.
+    const char* objectName() const BSLS_KEYWORD_OVERRIDE;
 };
 
 }  // close package namespace
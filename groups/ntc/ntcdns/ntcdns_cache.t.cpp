@@ -19,6 +19,8 @@
 #include <ntcdns_utility.h>
 #include <ntci_log.h>
 
+#include <bdld_datum.h>
+#include <bdld_manageddatum.h>
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 #include <bsls_assert.h>
@@ -681,11 +683,140 @@ NTCCFG_TEST_CASE(4)
     NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
 
+NTCCFG_TEST_CASE(5)
+{
+    // Concern: Domain names are interned, memory usage is reported, and
+    // 'clear' releases all memory held by the cache.
+    // Plan:
+
+    NTCI_LOG_CONTEXT();
+
+    ntsa::Error error;
+
+    ntccfg::TestAllocator ta;
+    {
+        // Create a cache.
+
+        ntcdns::Cache cache(&ta);
+
+        NTCCFG_TEST_EQ(cache.numHostEntries(), 0);
+        NTCCFG_TEST_EQ(cache.numDomainNames(), 0);
+        NTCCFG_TEST_EQ(cache.numDomainNameBytes(), 0);
+
+        const bsl::size_t initialBytesInUse = cache.numBytesInUse();
+
+        // Insert several IP addresses for the same domain name, and one IP
+        // address for a different domain name.
+
+        const bsl::string    DOMAIN_NAME_1("test1.example.com");
+        const bsl::string    DOMAIN_NAME_2("test2.example.com");
+        const ntsa::Endpoint NAME_SERVER("127.0.0.1:53");
+        const bsl::size_t    TTL = 60;
+
+        cache.updateHost(DOMAIN_NAME_1,
+                         ntsa::IpAddress("192.168.0.101"),
+                         NAME_SERVER,
+                         TTL,
+                         test::getNow());
+
+        cache.updateHost(DOMAIN_NAME_1,
+                         ntsa::IpAddress("192.168.0.102"),
+                         NAME_SERVER,
+                         TTL,
+                         test::getNow());
+
+        cache.updateHost(DOMAIN_NAME_1,
+                         ntsa::IpAddress("192.168.0.103"),
+                         NAME_SERVER,
+                         TTL,
+                         test::getNow());
+
+        // Ensure each domain name is stored once, regardless of the number
+        // of IP addresses assigned to it.
+
+        NTCCFG_TEST_EQ(cache.numHostEntries(), 3);
+        NTCCFG_TEST_EQ(cache.numDomainNames(), 1);
+        NTCCFG_TEST_EQ(cache.numDomainNameBytes(), DOMAIN_NAME_1.size());
+
+        cache.updateHost(DOMAIN_NAME_2,
+                         ntsa::IpAddress("192.168.0.104"),
+                         NAME_SERVER,
+                         TTL,
+                         test::getNow());
+
+        NTCCFG_TEST_EQ(cache.numHostEntries(), 4);
+        NTCCFG_TEST_EQ(cache.numDomainNames(), 2);
+        NTCCFG_TEST_EQ(cache.numDomainNameBytes(),
+                       DOMAIN_NAME_1.size() + DOMAIN_NAME_2.size());
+
+        NTCCFG_TEST_GT(cache.numBytesInUse(), initialBytesInUse);
+
+        // Ensure lookups by domain name find every IP address.
+
+        {
+            ntca::GetIpAddressContext context;
+            ntca::GetIpAddressOptions options;
+
+            bsl::vector<ntsa::IpAddress> ipAddressList;
+            error = cache.getIpAddress(&context,
+                                       &ipAddressList,
+                                       DOMAIN_NAME_1,
+                                       options,
+                                       test::getNow());
+            NTCCFG_TEST_OK(error);
+
+            NTCCFG_TEST_EQ(ipAddressList.size(), 3);
+        }
+
+        // Ensure the statistics describe the cache.
+
+        {
+            bdld::ManagedDatum stats(&ta);
+            cache.getStats(&stats);
+
+            NTCCFG_TEST_TRUE(stats->isArray());
+            NTCCFG_TEST_EQ(stats->theArray().length(),
+                           static_cast<bsl::size_t>(cache.numOrdinals()));
+
+            NTCCFG_TEST_EQ(stats->theArray()[0].theDouble(), 4.0);
+            NTCCFG_TEST_EQ(stats->theArray()[1].theDouble(), 2.0);
+            NTCCFG_TEST_EQ(
+                stats->theArray()[2].theDouble(),
+                double(DOMAIN_NAME_1.size() + DOMAIN_NAME_2.size()));
+
+            NTCCFG_TEST_EQ(cache.getFieldOrdinal("domainNames.current"), 1);
+        }
+
+        // Clear the cache. Ensure all entries, all interned domain names, and
+        // all memory used to store them is released.
+
+        cache.clear();
+
+        NTCCFG_TEST_EQ(cache.numHostEntries(), 0);
+        NTCCFG_TEST_EQ(cache.numDomainNames(), 0);
+        NTCCFG_TEST_EQ(cache.numDomainNameBytes(), 0);
+        NTCCFG_TEST_LE(cache.numBytesInUse(), initialBytesInUse);
+
+        // Ensure the cache remains usable after being cleared.
+
+        cache.updateHost(DOMAIN_NAME_2,
+                         ntsa::IpAddress("192.168.0.104"),
+                         NAME_SERVER,
+                         TTL,
+                         test::getNow());
+
+        NTCCFG_TEST_EQ(cache.numHostEntries(), 1);
+        NTCCFG_TEST_EQ(cache.numDomainNames(), 1);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
     NTCCFG_TEST_REGISTER(2);
     NTCCFG_TEST_REGISTER(3);
     NTCCFG_TEST_REGISTER(4);
+    NTCCFG_TEST_REGISTER(5);
 }
 NTCCFG_TEST_DRIVER_END;
@@ -18,6 +18,7 @@
 #include <ntcdns_compat.h>
 #include <ntcdns_utility.h>
 #include <ntci_log.h>
+#include <ntcm_monitorableutil.h>
 
 #include <ntsa_endpointoptions.h>
 #include <ntsa_ipaddressoptions.h>
@@ -263,6 +264,8 @@ ntsa::Error Resolver::initialize()
                 d_cache_sp->setNegativeCacheMaxTimeToLive(
                     d_config.negativeCacheMaxTimeToLive().value());
             }
+
+            ntcm::MonitorableUtil::registerMonitorable(d_cache_sp);
         }
     }
 
@@ -520,6 +523,10 @@ Resolver::~Resolver()
 {
     this->shutdown();
     this->linger();
+
+    if (d_cache_sp) {
+        ntcm::MonitorableUtil::deregisterMonitorable(d_cache_sp);
+    }
 }
 
 ntsa::Error Resolver::start()
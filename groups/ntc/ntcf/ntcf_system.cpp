@@ -24,8 +24,10 @@ BSLS_IDENT_RCSID(ntcf_system_cpp, "$Id$ $CSID$")
 #include <ntci_monitorable.h>
 #include <ntcm_monitorableutil.h>
 #include <ntcs_authorization.h>
+#include <ntcs_chronologymetrics.h>
 #include <ntcs_compat.h>
 #include <ntcs_datapool.h>
+#include <ntcs_flightrecorder.h>
 #include <ntcs_global.h>
 #include <ntcs_metrics.h>
 #include <ntcs_plugin.h>
@@ -34,6 +36,7 @@ BSLS_IDENT_RCSID(ntcf_system_cpp, "$Id$ $CSID$")
 #include <ntcs_ratelimiter.h>
 #include <ntcs_reactormetrics.h>
 #include <ntcs_reservation.h>
+#include <ntcs_watchdog.h>
 
 #include <ntcr_datagramsocket.h>
 #include <ntcr_interface.h>
@@ -1938,6 +1941,52 @@ void System::disableProcessMetrics()
     ntcm::MonitorableUtil::deregisterMonitorableProcess();
 }
 
+void System::enableChronologyMetrics()
+{
+    ntsa::Error error;
+
+    error = ntcf::System::initialize();
+    BSLS_ASSERT_OPT(!error);
+
+    ntcs::ChronologyMetrics::enable();
+
+    ntcm::MonitorableUtil::registerMonitorable(
+        ntcs::ChronologyMetrics::global());
+}
+
+void System::disableChronologyMetrics()
+{
+    ntsa::Error error;
+
+    error = ntcf::System::initialize();
+    BSLS_ASSERT_OPT(!error);
+
+    ntcs::ChronologyMetrics::disable();
+
+    ntcm::MonitorableUtil::deregisterMonitorable(
+        ntcs::ChronologyMetrics::global());
+}
+
+void System::setStallThreshold(const bsls::TimeInterval& threshold)
+{
+    ntcs::Watchdog::setThreshold(threshold);
+}
+
+void System::enableFlightRecorder()
+{
+    ntcs::FlightRecorder::enable();
+}
+
+void System::disableFlightRecorder()
+{
+    ntcs::FlightRecorder::disable();
+}
+
+ntsa::Error System::dumpFlightRecorder(const bsl::string& path)
+{
+    return ntcs::FlightRecorder::dump(path.c_str());
+}
+
 void System::registerMonitorable(
     const bsl::shared_ptr<ntci::Monitorable>& monitorable)
 {
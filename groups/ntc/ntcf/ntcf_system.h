@@ -23,6 +23,7 @@ BSLS_IDENT("$Id: $")
 #include <ntcf_api.h>
 #include <ntcscm_version.h>
 #include <bdlbb_blob.h>
+#include <bsls_timeinterval.h>
 #include <bsl_memory.h>
 
 namespace BloombergLP {
@@ -835,6 +836,39 @@ struct System {
     /// Disable the periodic collection of process-wide metrics.
     static void disableProcessMetrics();
 
+    /// Enable the periodic collection of the process-wide lateness of timers
+    /// and the queueing delay of deferred functions, measured across every
+    /// reactor, proactor, and interface, separately for one-shot and
+    /// recurring timers.
+    static void enableChronologyMetrics();
+
+    /// Disable the periodic collection of the process-wide lateness of
+    /// timers and the queueing delay of deferred functions.
+    static void disableChronologyMetrics();
+
+    /// Set the duration of a callback invoked by a reactor or proactor
+    /// thread beyond which the callback is considered to stall the thread to
+    /// the specified 'threshold'. Each stall is logged as a warning attributed
+    /// to the log context of the socket whose callback stalled the thread, and
+    /// counted in the metrics of the driver. A zero 'threshold' disables the
+    /// detection of stalls, which is the default. Note that stalls are only
+    /// detected by drivers that collect metrics.
+    static void setStallThreshold(const bsls::TimeInterval& threshold);
+
+    /// Start recording driver events into the flight recorder of each
+    /// thread. Note that the flight recorder is disabled by default.
+    static void enableFlightRecorder();
+
+    /// Stop recording driver events into the flight recorder of each
+    /// thread. Note that events already recorded are retained.
+    static void disableFlightRecorder();
+
+    /// Write the driver events retained by the flight recorder of each
+    /// thread to the file at the specified 'path'. Return the error. Note
+    /// that the file may be decoded into a timeline of events by the
+    /// 'ntcflightrecorder' application.
+    static ntsa::Error dumpFlightRecorder(const bsl::string& path);
+
     /// Add the specified 'monitorable' to the default monitorable object
     /// registry, if a default monitorable object registry has been enabled.
     static void registerMonitorable(
@@ -19,6 +19,9 @@
 #include <ntccfg_test.h>
 #include <ntcd_datautil.h>
 #include <ntci_log.h>
+#include <ntci_reactorpool.h>
+#include <ntcm_openmetricspublisher.h>
+#include <ntcm_openmetricsserver.h>
 #include <ntcs_blobutil.h>
 #include <ntcs_datapool.h>
 #include <ntcs_ratelimiter.h>
@@ -59,6 +62,7 @@
 #include <bsl_algorithm.h>
 #include <bsl_cctype.h>
 #include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
 #include <bsl_fstream.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
@@ -12977,6 +12981,1182 @@ void concernListenerSocketAcceptRateLimitTimerEventNotifications(
     }
 }
 
+/// Provide utilities for exchanging requests with an OpenMetrics server.
+struct OpenMetricsUtil {
+    /// Connect a stream socket created by the specified 'interface' to the
+    /// specified 'endpoint', send the specified 'request', if not empty,
+    /// and load into the specified 'response' the data received until the
+    /// server closes the connection. Use the specified 'allocator' to supply
+    /// memory.
+    static void exchange(const bsl::shared_ptr<ntci::Interface>& interface,
+                         const ntsa::Endpoint&                   endpoint,
+                         const bsl::string&                      request,
+                         bsl::string*                            response,
+                         bslma::Allocator*                       allocator);
+};
+
+void OpenMetricsUtil::exchange(
+    const bsl::shared_ptr<ntci::Interface>& interface,
+    const ntsa::Endpoint&                   endpoint,
+    const bsl::string&                      request,
+    bsl::string*                            response,
+    bslma::Allocator*                       allocator)
+{
+    ntsa::Error error;
+
+    response->clear();
+
+    ntca::StreamSocketOptions options;
+    options.setTransport(ntsa::Transport::e_TCP_IPV4_STREAM);
+
+    bsl::shared_ptr<ntci::StreamSocket> streamSocket =
+        interface->createStreamSocket(options, allocator);
+
+    ntci::ConnectFuture connectFuture(allocator);
+    error = streamSocket->connect(endpoint,
+                                  ntca::ConnectOptions(),
+                                  connectFuture);
+    NTCCFG_TEST_OK(error);
+
+    ntci::ConnectResult connectResult;
+    error = connectFuture.wait(&connectResult);
+    NTCCFG_TEST_OK(error);
+    NTCCFG_TEST_EQ(connectResult.event().type(),
+                   ntca::ConnectEventType::e_COMPLETE);
+
+    if (!request.empty()) {
+        bdlbb::Blob data(streamSocket->outgoingBlobBufferFactory().get());
+        bdlbb::BlobUtil::append(&data,
+                                request.data(),
+                                static_cast<int>(request.size()));
+
+        error = streamSocket->send(data, ntca::SendOptions());
+        NTCCFG_TEST_OK(error);
+    }
+
+    // Receive until the server closes the connection, bounding the wait so
+    // that a server that never closes the connection fails the test rather
+    // than hanging it.
+
+    const bsls::TimeInterval deadline =
+        streamSocket->currentTime() + bsls::TimeInterval(30, 0);
+
+    while (true) {
+        ntca::ReceiveOptions receiveOptions;
+        receiveOptions.setMinSize(1);
+        receiveOptions.setMaxSize(64 * 1024);
+
+        ntci::ReceiveFuture receiveFuture(allocator);
+        error = streamSocket->receive(receiveOptions, receiveFuture);
+        if (error == ntsa::Error(ntsa::Error::e_EOF)) {
+            break;
+        }
+
+        NTCCFG_TEST_OK(error);
+
+        ntci::ReceiveResult receiveResult(allocator);
+        error = receiveFuture.wait(&receiveResult, deadline);
+        NTCCFG_TEST_OK(error);
+
+        if (receiveResult.event().type() == ntca::ReceiveEventType::e_ERROR)
+        {
+            NTCCFG_TEST_EQ(receiveResult.event().context().error(),
+                           ntsa::Error(ntsa::Error::e_EOF));
+            break;
+        }
+
+        const bdlbb::Blob& data   = *receiveResult.data();
+        const bsl::size_t  offset = response->size();
+
+        response->resize(offset + static_cast<bsl::size_t>(data.length()));
+        bdlbb::BlobUtil::copy(&(*response)[offset], data, 0, data.length());
+    }
+
+    ntci::StreamSocketCloseGuard closeGuard(streamSocket);
+}
+
+void concernOpenMetricsServer(
+    const bsl::shared_ptr<ntci::Interface>& interface,
+    bslma::Allocator*                       allocator)
+{
+    // Concern: The OpenMetrics server answers requests for the exposition,
+    // rejects requests for other paths and methods, and closes connections
+    // that do not deliver a complete request within the request timeout.
+
+    NTCI_LOG_CONTEXT();
+    NTCI_LOG_DEBUG("OpenMetrics server test starting");
+
+    ntsa::Error error;
+
+    bsl::shared_ptr<ntcm::OpenMetricsPublisher> publisher;
+    publisher.createInplace(allocator, allocator);
+
+    bsl::shared_ptr<ntcm::OpenMetricsServer> server;
+    server.createInplace(allocator, publisher, interface, allocator);
+
+    bsls::TimeInterval requestTimeout;
+    requestTimeout.setTotalMilliseconds(200);
+
+    server->setRequestTimeout(requestTimeout);
+
+    error = server->open(
+        test::EndpointUtil::any(ntsa::Transport::e_TCP_IPV4_STREAM));
+    NTCCFG_TEST_OK(error);
+
+    const ntsa::Endpoint endpoint = server->sourceEndpoint();
+
+    bsl::string expectedBody(allocator);
+    publisher->load(&expectedBody);
+
+    bsl::string response(allocator);
+
+    test::OpenMetricsUtil::exchange(interface,
+                                    endpoint,
+                                    "GET /metrics HTTP/1.1\r\n"
+                                    "Host: localhost\r\n\r\n",
+                                    &response,
+                                    allocator);
+
+    NTCCFG_TEST_EQ(response.find("HTTP/1.1 200 OK\r\n"), 0);
+    NTCCFG_TEST_NE(response.find(ntcm::OpenMetricsPublisher::contentType()),
+                   bsl::string::npos);
+    NTCCFG_TEST_GE(response.size(), expectedBody.size());
+    NTCCFG_TEST_EQ(response.substr(response.size() - expectedBody.size()),
+                   expectedBody);
+
+    test::OpenMetricsUtil::exchange(interface,
+                                    endpoint,
+                                    "GET /other HTTP/1.1\r\n\r\n",
+                                    &response,
+                                    allocator);
+
+    NTCCFG_TEST_EQ(response.find("HTTP/1.1 404 Not Found\r\n"), 0);
+
+    test::OpenMetricsUtil::exchange(interface,
+                                    endpoint,
+                                    "POST /metrics HTTP/1.1\r\n\r\n",
+                                    &response,
+                                    allocator);
+
+    NTCCFG_TEST_EQ(response.find("HTTP/1.1 405 Method Not Allowed\r\n"), 0);
+
+    // Connect but send only part of a request: the server must close the
+    // connection without responding once the request timeout elapses.
+
+    test::OpenMetricsUtil::exchange(interface,
+                                    endpoint,
+                                    "GET /metrics HTTP/1.1\r\n",
+                                    &response,
+                                    allocator);
+
+    NTCCFG_TEST_TRUE(response.empty());
+
+    server->close();
+
+    NTCI_LOG_DEBUG("OpenMetrics server test complete");
+}
+
+/// Provide utilities for batched receive tests.
+struct ReceiveBatchUtil {
+    /// Block until the read queue of the specified 'socket' contains at
+    /// least the specified 'size' bytes.
+    template <typename SOCKET>
+    static void waitForReadQueue(const bsl::shared_ptr<SOCKET>& socket,
+                                 bsl::size_t                    size);
+
+    /// Append the contents of each of the specified 'results' to the
+    /// specified 'messages', and the endpoint of each result, if any, to the
+    /// specified 'endpoints', then post to the specified 'semaphore'.
+    static void processReceiveBatch(
+        const bsl::shared_ptr<ntci::Receiver>&  receiver,
+        const bsl::vector<ntci::ReceiveResult>& results,
+        const ntca::ReceiveEvent&               event,
+        bsl::vector<bsl::string>*               messages,
+        bsl::vector<ntsa::Endpoint>*            endpoints,
+        bslmt::Semaphore*                       semaphore);
+};
+
+template <typename SOCKET>
+void ReceiveBatchUtil::waitForReadQueue(const bsl::shared_ptr<SOCKET>& socket,
+                                        bsl::size_t                    size)
+{
+    while (socket->readQueueSize() < size) {
+        bslmt::ThreadUtil::microSleep(10 * 1000);
+    }
+}
+
+void ReceiveBatchUtil::processReceiveBatch(
+    const bsl::shared_ptr<ntci::Receiver>&  receiver,
+    const bsl::vector<ntci::ReceiveResult>& results,
+    const ntca::ReceiveEvent&               event,
+    bsl::vector<bsl::string>*               messages,
+    bsl::vector<ntsa::Endpoint>*            endpoints,
+    bslmt::Semaphore*                       semaphore)
+{
+    NTCCFG_WARNING_UNUSED(receiver);
+
+    NTCCFG_TEST_EQ(event.type(), ntca::ReceiveEventType::e_COMPLETE);
+
+    messages->clear();
+    endpoints->clear();
+
+    for (bsl::size_t i = 0; i < results.size(); ++i) {
+        const bdlbb::Blob& data = *results[i].data();
+
+        bsl::string message(static_cast<bsl::size_t>(data.length()), ' ');
+        if (data.length() > 0) {
+            bdlbb::BlobUtil::copy(&message[0], data, 0, data.length());
+        }
+
+        messages->push_back(message);
+
+        if (!results[i].event().context().endpoint().isNull()) {
+            endpoints->push_back(
+                results[i].event().context().endpoint().value());
+        }
+    }
+
+    semaphore->post();
+}
+
+void concernStreamSocketReceiveBatch(
+    const bsl::shared_ptr<ntci::Interface>& interface,
+    bslma::Allocator*                       allocator)
+{
+    // Concern: A batched receive on a stream socket delivers at most the
+    // maximum number of framed messages, stops before the total size of the
+    // batch exceeds the maximum size, and always delivers the first message.
+
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_DEBUG("Stream socket receive batch test starting");
+
+    const ntsa::Transport::Value transport =
+        ntsa::Transport::e_TCP_IPV4_STREAM;
+
+    const char        k_DATA[]    = "a\nbb\nccc\ndddd\neeeee\n";
+    const bsl::size_t k_DATA_SIZE = sizeof k_DATA - 1;
+
+    ntsa::Error      error;
+    bslmt::Semaphore semaphore;
+
+    bsl::shared_ptr<ntci::StreamSocket> clientStreamSocket;
+    bsl::shared_ptr<ntci::StreamSocket> serverStreamSocket;
+    {
+        ntca::ReceiveFramer receiveFramer;
+        receiveFramer.setType(ntca::ReceiveFramerType::e_DELIMITER);
+        receiveFramer.setDelimiter("\n");
+
+        ntca::StreamSocketOptions options;
+        options.setTransport(transport);
+        options.setReceiveFramer(receiveFramer);
+
+        bsl::shared_ptr<ntsi::StreamSocket> basicClientSocket;
+        bsl::shared_ptr<ntsi::StreamSocket> basicServerSocket;
+
+        error = ntsf::System::createStreamSocketPair(&basicClientSocket,
+                                                     &basicServerSocket,
+                                                     transport);
+        NTCCFG_TEST_FALSE(error);
+
+        clientStreamSocket = interface->createStreamSocket(options, allocator);
+
+        error = clientStreamSocket->open(transport, basicClientSocket);
+        NTCCFG_TEST_FALSE(error);
+
+        serverStreamSocket = interface->createStreamSocket(options, allocator);
+
+        error = serverStreamSocket->open(transport, basicServerSocket);
+        NTCCFG_TEST_FALSE(error);
+    }
+
+    {
+        bdlbb::Blob data(clientStreamSocket->outgoingBlobBufferFactory().get(),
+                         allocator);
+        bdlbb::BlobUtil::append(&data,
+                                k_DATA,
+                                static_cast<int>(k_DATA_SIZE));
+
+        error = clientStreamSocket->send(data, ntca::SendOptions());
+        NTCCFG_TEST_OK(error);
+    }
+
+    test::ReceiveBatchUtil::waitForReadQueue(serverStreamSocket, k_DATA_SIZE);
+
+    bsl::vector<bsl::string>    messages(allocator);
+    bsl::vector<ntsa::Endpoint> endpoints(allocator);
+
+    ntci::ReceiveBatchCallback receiveBatchCallback =
+        serverStreamSocket->createReceiveBatchCallback(
+            NTCCFG_BIND(&test::ReceiveBatchUtil::processReceiveBatch,
+                        NTCCFG_BIND_PLACEHOLDER_1,
+                        NTCCFG_BIND_PLACEHOLDER_2,
+                        NTCCFG_BIND_PLACEHOLDER_3,
+                        &messages,
+                        &endpoints,
+                        &semaphore),
+            allocator);
+
+    // The batch is limited to the maximum number of messages.
+
+    {
+        ntca::ReceiveOptions receiveOptions;
+        receiveOptions.setMaxMessages(2);
+
+        error = serverStreamSocket->receiveBatch(receiveOptions,
+                                                 receiveBatchCallback);
+        NTCCFG_TEST_OK(error);
+
+        semaphore.wait();
+
+        NTCCFG_TEST_EQ(messages.size(), 2);
+        NTCCFG_TEST_EQ(messages[0], "a");
+        NTCCFG_TEST_EQ(messages[1], "bb");
+    }
+
+    // The batch stops before its total size exceeds the maximum size.
+
+    {
+        ntca::ReceiveOptions receiveOptions;
+        receiveOptions.setMaxMessages(10);
+        receiveOptions.setMaxSize(6);
+
+        error = serverStreamSocket->receiveBatch(receiveOptions,
+                                                 receiveBatchCallback);
+        NTCCFG_TEST_OK(error);
+
+        semaphore.wait();
+
+        NTCCFG_TEST_EQ(messages.size(), 1);
+        NTCCFG_TEST_EQ(messages[0], "ccc");
+    }
+
+    // The first message is delivered even though the maximum size leaves no
+    // room for any other message.
+
+    {
+        ntca::ReceiveOptions receiveOptions;
+        receiveOptions.setMaxMessages(10);
+        receiveOptions.setMaxSize(5);
+
+        error = serverStreamSocket->receiveBatch(receiveOptions,
+                                                 receiveBatchCallback);
+        NTCCFG_TEST_OK(error);
+
+        semaphore.wait();
+
+        NTCCFG_TEST_EQ(messages.size(), 1);
+        NTCCFG_TEST_EQ(messages[0], "dddd");
+
+        error = serverStreamSocket->receiveBatch(receiveOptions,
+                                                 receiveBatchCallback);
+        NTCCFG_TEST_OK(error);
+
+        semaphore.wait();
+
+        NTCCFG_TEST_EQ(messages.size(), 1);
+        NTCCFG_TEST_EQ(messages[0], "eeeee");
+    }
+
+    NTCCFG_TEST_EQ(serverStreamSocket->readQueueSize(), 0);
+
+    {
+        ntci::StreamSocketCloseGuard clientStreamSocketCloseGuard(
+            clientStreamSocket);
+
+        ntci::StreamSocketCloseGuard serverStreamSocketCloseGuard(
+            serverStreamSocket);
+    }
+
+    NTCI_LOG_DEBUG("Stream socket receive batch test complete");
+}
+
+void concernDatagramSocketReceiveBatch(
+    const bsl::shared_ptr<ntci::Interface>& interface,
+    bslma::Allocator*                       allocator)
+{
+    // Concern: A batched receive on a datagram socket delivers at most the
+    // maximum number of datagrams, each identifying its sender, stops before
+    // the total size of the batch exceeds the maximum size, and always
+    // delivers the first datagram, even when it alone is larger than the
+    // maximum size.
+
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_DEBUG("Datagram socket receive batch test starting");
+
+    const ntsa::Transport::Value transport =
+        ntsa::Transport::e_UDP_IPV4_DATAGRAM;
+
+    const bsl::size_t k_NUM_MESSAGES = 4;
+    const bsl::size_t k_UNIT_SIZE    = 10;
+
+    ntsa::Error      error;
+    bslmt::Semaphore semaphore;
+
+    bsl::shared_ptr<ntci::DatagramSocket> clientDatagramSocket;
+    bsl::shared_ptr<ntci::DatagramSocket> serverDatagramSocket;
+    {
+        ntca::DatagramSocketOptions options;
+        options.setTransport(transport);
+
+        bsl::shared_ptr<ntsi::DatagramSocket> basicClientSocket;
+        bsl::shared_ptr<ntsi::DatagramSocket> basicServerSocket;
+
+        error = ntsf::System::createDatagramSocketPair(&basicClientSocket,
+                                                       &basicServerSocket,
+                                                       transport);
+        NTCCFG_TEST_FALSE(error);
+
+        clientDatagramSocket =
+            interface->createDatagramSocket(options, allocator);
+
+        error = clientDatagramSocket->open(transport, basicClientSocket);
+        NTCCFG_TEST_FALSE(error);
+
+        serverDatagramSocket =
+            interface->createDatagramSocket(options, allocator);
+
+        error = serverDatagramSocket->open(transport, basicServerSocket);
+        NTCCFG_TEST_FALSE(error);
+    }
+
+    // Send datagrams of 10, 20, 30, and 40 bytes, each filled with a
+    // distinct letter.
+
+    bsl::size_t totalSize = 0;
+
+    for (bsl::size_t i = 0; i < k_NUM_MESSAGES; ++i) {
+        const bsl::size_t messageSize = (i + 1) * k_UNIT_SIZE;
+        const bsl::string message(messageSize, static_cast<char>('a' + i));
+
+        bdlbb::Blob data(
+            clientDatagramSocket->outgoingBlobBufferFactory().get(),
+            allocator);
+        bdlbb::BlobUtil::append(&data,
+                                message.data(),
+                                static_cast<int>(message.size()));
+
+        error = clientDatagramSocket->send(data, ntca::SendOptions());
+        NTCCFG_TEST_OK(error);
+
+        totalSize += messageSize;
+    }
+
+    test::ReceiveBatchUtil::waitForReadQueue(serverDatagramSocket,
+                                             totalSize);
+
+    const ntsa::Endpoint clientEndpoint =
+        clientDatagramSocket->sourceEndpoint();
+
+    bsl::vector<bsl::string>    messages(allocator);
+    bsl::vector<ntsa::Endpoint> endpoints(allocator);
+
+    ntci::ReceiveBatchCallback receiveBatchCallback =
+        serverDatagramSocket->createReceiveBatchCallback(
+            NTCCFG_BIND(&test::ReceiveBatchUtil::processReceiveBatch,
+                        NTCCFG_BIND_PLACEHOLDER_1,
+                        NTCCFG_BIND_PLACEHOLDER_2,
+                        NTCCFG_BIND_PLACEHOLDER_3,
+                        &messages,
+                        &endpoints,
+                        &semaphore),
+            allocator);
+
+    // The batch is limited to the maximum number of messages.
+
+    {
+        ntca::ReceiveOptions receiveOptions;
+        receiveOptions.setMaxMessages(2);
+
+        error = serverDatagramSocket->receiveBatch(receiveOptions,
+                                                   receiveBatchCallback);
+        NTCCFG_TEST_OK(error);
+
+        semaphore.wait();
+
+        NTCCFG_TEST_EQ(messages.size(), 2);
+        NTCCFG_TEST_EQ(messages[0], bsl::string(10, 'a'));
+        NTCCFG_TEST_EQ(messages[1], bsl::string(20, 'b'));
+
+        NTCCFG_TEST_EQ(endpoints.size(), 2);
+        NTCCFG_TEST_EQ(endpoints[0], clientEndpoint);
+        NTCCFG_TEST_EQ(endpoints[1], clientEndpoint);
+    }
+
+    // The first datagram is delivered even though it alone is larger than
+    // the maximum size, but no other datagram joins it.
+
+    {
+        ntca::ReceiveOptions receiveOptions;
+        receiveOptions.setMaxMessages(10);
+        receiveOptions.setMaxSize(5);
+
+        error = serverDatagramSocket->receiveBatch(receiveOptions,
+                                                   receiveBatchCallback);
+        NTCCFG_TEST_OK(error);
+
+        semaphore.wait();
+
+        NTCCFG_TEST_EQ(messages.size(), 1);
+        NTCCFG_TEST_EQ(messages[0], bsl::string(30, 'c'));
+    }
+
+    // The remaining datagram fits within the maximum size.
+
+    {
+        ntca::ReceiveOptions receiveOptions;
+        receiveOptions.setMaxMessages(10);
+        receiveOptions.setMaxSize(40);
+
+        error = serverDatagramSocket->receiveBatch(receiveOptions,
+                                                   receiveBatchCallback);
+        NTCCFG_TEST_OK(error);
+
+        semaphore.wait();
+
+        NTCCFG_TEST_EQ(messages.size(), 1);
+        NTCCFG_TEST_EQ(messages[0], bsl::string(40, 'd'));
+    }
+
+    NTCCFG_TEST_EQ(serverDatagramSocket->readQueueSize(), 0);
+
+    {
+        ntci::DatagramSocketCloseGuard closeGuardClient(clientDatagramSocket);
+        ntci::DatagramSocketCloseGuard closeGuardServer(serverDatagramSocket);
+    }
+
+    NTCI_LOG_DEBUG("Datagram socket receive batch test complete");
+}
+
+/// Provide utilities for tests of receiving into caller-supplied buffers.
+struct ReceiveBufferUtil {
+    /// Assert the specified 'event' indicates the operation completed and
+    /// the specified 'data' is null, load into the specified 'numBytes' the
+    /// number of bytes received, then post to the specified 'semaphore'.
+    static void processReceive(
+        const bsl::shared_ptr<ntci::Receiver>& receiver,
+        const bsl::shared_ptr<bdlbb::Blob>&    data,
+        const ntca::ReceiveEvent&              event,
+        bsl::size_t*                           numBytes,
+        bslmt::Semaphore*                      semaphore);
+
+    /// Block until the read queue of the specified 'streamSocket' contains
+    /// at least the specified 'size' bytes.
+    static void waitForReadQueue(
+        const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+        bsl::size_t                                size);
+
+    /// Send the specified 'text' from the specified 'streamSocket'.
+    static void send(const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+                     const char*                                text,
+                     bslma::Allocator*                          allocator);
+};
+
+void ReceiveBufferUtil::processReceive(
+    const bsl::shared_ptr<ntci::Receiver>& receiver,
+    const bsl::shared_ptr<bdlbb::Blob>&    data,
+    const ntca::ReceiveEvent&              event,
+    bsl::size_t*                           numBytes,
+    bslmt::Semaphore*                      semaphore)
+{
+    NTCCFG_WARNING_UNUSED(receiver);
+
+    NTCCFG_TEST_EQ(event.type(), ntca::ReceiveEventType::e_COMPLETE);
+    NTCCFG_TEST_FALSE(data);
+
+    *numBytes = event.context().bytesReceived();
+
+    semaphore->post();
+}
+
+void ReceiveBufferUtil::waitForReadQueue(
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+    bsl::size_t                                size)
+{
+    while (streamSocket->readQueueSize() < size) {
+        bslmt::ThreadUtil::microSleep(10 * 1000);
+    }
+}
+
+void ReceiveBufferUtil::send(
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+    const char*                                text,
+    bslma::Allocator*                          allocator)
+{
+    bdlbb::Blob data(streamSocket->outgoingBlobBufferFactory().get(),
+                     allocator);
+    bdlbb::BlobUtil::append(&data,
+                            text,
+                            static_cast<int>(bsl::strlen(text)));
+
+    ntsa::Error error = streamSocket->send(data, ntca::SendOptions());
+    NTCCFG_TEST_OK(error);
+}
+
+void concernStreamSocketReceiveBuffers(
+    const bsl::shared_ptr<ntci::Interface>& interface,
+    bslma::Allocator*                       allocator)
+{
+    // Concern: Data received into caller-supplied buffers is scattered
+    // across those buffers, either directly from the socket or, when less
+    // than the minimum size arrives at once or the maximum size is less than
+    // the capacity of the buffers, by way of the read queue.
+
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_DEBUG("Stream socket receive buffers test starting");
+
+    const ntsa::Transport::Value transport =
+        ntsa::Transport::e_TCP_IPV4_STREAM;
+
+    ntsa::Error      error;
+    bslmt::Semaphore semaphore;
+
+    bsl::shared_ptr<ntci::StreamSocket> clientStreamSocket;
+    bsl::shared_ptr<ntci::StreamSocket> serverStreamSocket;
+    {
+        ntca::StreamSocketOptions options;
+        options.setTransport(transport);
+
+        bsl::shared_ptr<ntsi::StreamSocket> basicClientSocket;
+        bsl::shared_ptr<ntsi::StreamSocket> basicServerSocket;
+
+        error = ntsf::System::createStreamSocketPair(&basicClientSocket,
+                                                     &basicServerSocket,
+                                                     transport);
+        NTCCFG_TEST_FALSE(error);
+
+        clientStreamSocket = interface->createStreamSocket(options, allocator);
+
+        error = clientStreamSocket->open(transport, basicClientSocket);
+        NTCCFG_TEST_FALSE(error);
+
+        serverStreamSocket = interface->createStreamSocket(options, allocator);
+
+        error = serverStreamSocket->open(transport, basicServerSocket);
+        NTCCFG_TEST_FALSE(error);
+    }
+
+    char storage[10];
+
+    ntsa::MutableBufferArray buffers(allocator);
+    buffers.append(storage, 3);
+    buffers.append(storage + 3, 7);
+
+    bsl::size_t numBytes = 0;
+
+    ntci::ReceiveCallback receiveCallback =
+        serverStreamSocket->createReceiveCallback(
+            NTCCFG_BIND(&test::ReceiveBufferUtil::processReceive,
+                        NTCCFG_BIND_PLACEHOLDER_1,
+                        NTCCFG_BIND_PLACEHOLDER_2,
+                        NTCCFG_BIND_PLACEHOLDER_3,
+                        &numBytes,
+                        &semaphore),
+            allocator);
+
+    // The operation is pending when the data arrives, so a reactor socket
+    // reads the data from the socket directly into the buffers, spanning
+    // both of them.
+
+    {
+        bsl::memset(storage, 0, sizeof storage);
+
+        ntca::ReceiveOptions receiveOptions;
+        receiveOptions.setMinSize(10);
+
+        error = serverStreamSocket->receive(receiveOptions,
+                                            buffers,
+                                            receiveCallback);
+        NTCCFG_TEST_OK(error);
+
+        test::ReceiveBufferUtil::send(clientStreamSocket,
+                                      "abcdefghij",
+                                      allocator);
+
+        semaphore.wait();
+
+        NTCCFG_TEST_EQ(numBytes, 10);
+        NTCCFG_TEST_EQ(bsl::string(storage, 10), "abcdefghij");
+        NTCCFG_TEST_EQ(serverStreamSocket->readQueueSize(), 0);
+    }
+
+    // Less than the minimum size arrives, so the data is held in the read
+    // queue until the rest arrives, then copied into the buffers in order.
+
+    {
+        bsl::memset(storage, 0, sizeof storage);
+
+        ntca::ReceiveOptions receiveOptions;
+        receiveOptions.setMinSize(10);
+
+        error = serverStreamSocket->receive(receiveOptions,
+                                            buffers,
+                                            receiveCallback);
+        NTCCFG_TEST_OK(error);
+
+        test::ReceiveBufferUtil::send(clientStreamSocket, "klmn", allocator);
+
+        test::ReceiveBufferUtil::waitForReadQueue(serverStreamSocket, 4);
+
+        NTCCFG_TEST_NE(semaphore.tryWait(), 0);
+
+        test::ReceiveBufferUtil::send(clientStreamSocket,
+                                      "opqrst",
+                                      allocator);
+
+        semaphore.wait();
+
+        NTCCFG_TEST_EQ(numBytes, 10);
+        NTCCFG_TEST_EQ(bsl::string(storage, 10), "klmnopqrst");
+        NTCCFG_TEST_EQ(serverStreamSocket->readQueueSize(), 0);
+    }
+
+    // The maximum size is less than the capacity of the buffers, so the data
+    // is not read directly into the buffers, which could receive more than
+    // the maximum size, but into the read queue, from which no more than the
+    // maximum size is copied into the buffers.
+
+    {
+        bsl::memset(storage, 0, sizeof storage);
+
+        ntca::ReceiveOptions receiveOptions;
+        receiveOptions.setMinSize(4);
+        receiveOptions.setMaxSize(4);
+
+        error = serverStreamSocket->receive(receiveOptions,
+                                            buffers,
+                                            receiveCallback);
+        NTCCFG_TEST_OK(error);
+
+        test::ReceiveBufferUtil::send(clientStreamSocket,
+                                      "uvwxyz0123",
+                                      allocator);
+
+        semaphore.wait();
+
+        NTCCFG_TEST_EQ(numBytes, 4);
+        NTCCFG_TEST_EQ(bsl::string(storage, 4), "uvwx");
+        NTCCFG_TEST_EQ(storage[4], 0);
+
+        test::ReceiveBufferUtil::waitForReadQueue(serverStreamSocket, 6);
+
+        bsl::memset(storage, 0, sizeof storage);
+
+        receiveOptions.setMinSize(6);
+        receiveOptions.setMaxSize(10);
+
+        error = serverStreamSocket->receive(receiveOptions,
+                                            buffers,
+                                            receiveCallback);
+        NTCCFG_TEST_OK(error);
+
+        semaphore.wait();
+
+        NTCCFG_TEST_EQ(numBytes, 6);
+        NTCCFG_TEST_EQ(bsl::string(storage, 6), "yz0123");
+        NTCCFG_TEST_EQ(serverStreamSocket->readQueueSize(), 0);
+    }
+
+    {
+        ntci::StreamSocketCloseGuard clientStreamSocketCloseGuard(
+            clientStreamSocket);
+
+        ntci::StreamSocketCloseGuard serverStreamSocketCloseGuard(
+            serverStreamSocket);
+    }
+
+    NTCI_LOG_DEBUG("Stream socket receive buffers test complete");
+}
+
+/// Provide utilities for send coalescing tests.
+struct SendCoalescingUtil {
+    /// Send the specified 'text' from the specified 'streamSocket' according
+    /// to the specified 'options'.
+    static void send(const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+                     const bsl::string&                         text,
+                     const ntca::SendOptions&                   options,
+                     bslma::Allocator*                          allocator);
+
+    /// Receive from the specified blocking 'basicSocket' at most the
+    /// specified 'capacity' bytes with a single system call and return
+    /// the data received, which is empty if the peer has shut down.
+    static bsl::string receive(
+        const bsl::shared_ptr<ntsi::StreamSocket>& basicSocket,
+        bsl::size_t                                capacity,
+        bslma::Allocator*                          allocator);
+};
+
+void SendCoalescingUtil::send(
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+    const bsl::string&                         text,
+    const ntca::SendOptions&                   options,
+    bslma::Allocator*                          allocator)
+{
+    bdlbb::Blob data(streamSocket->outgoingBlobBufferFactory().get(),
+                     allocator);
+    bdlbb::BlobUtil::append(&data,
+                            text.data(),
+                            static_cast<int>(text.size()));
+
+    ntsa::Error error = streamSocket->send(data, options);
+    NTCCFG_TEST_OK(error);
+}
+
+bsl::string SendCoalescingUtil::receive(
+    const bsl::shared_ptr<ntsi::StreamSocket>& basicSocket,
+    bsl::size_t                                capacity,
+    bslma::Allocator*                          allocator)
+{
+    bsl::string result(capacity, ' ', allocator);
+
+    ntsa::ReceiveContext receiveContext;
+    ntsa::ReceiveOptions receiveOptions;
+
+    ntsa::Data data(ntsa::MutableBuffer(&result[0], result.size()));
+
+    ntsa::Error error =
+        basicSocket->receive(&receiveContext, &data, receiveOptions);
+    if (error) {
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_EOF));
+        result.clear();
+        return result;
+    }
+
+    result.resize(receiveContext.bytesReceived());
+    return result;
+}
+
+void concernStreamSocketSendCoalescing(
+    const bsl::shared_ptr<ntci::Interface>& interface,
+    bslma::Allocator*                       allocator)
+{
+    // Concern: Data sent by a socket configured to coalesce sends is held on
+    // the write queue until the end of the coalescing window then copied to
+    // the socket send buffer with a single system call, unless forced out
+    // sooner by a send that requests a flush, and data still coalesced when
+    // the socket is closed is discarded without the coalescing timer firing.
+    // Note that proactor sockets accept but ignore send coalescing.
+
+    NTCI_LOG_CONTEXT();
+
+    if (!bsl::dynamic_pointer_cast<ntci::ReactorPool>(interface)) {
+        return;
+    }
+
+    NTCI_LOG_DEBUG("Stream socket send coalescing test starting");
+
+    const ntsa::Transport::Value transport =
+        ntsa::Transport::e_TCP_IPV4_STREAM;
+
+    const bsl::size_t k_NUM_MESSAGES = 10;
+    const bsl::size_t k_MESSAGE_SIZE = 10;
+    const bsl::size_t k_CAPACITY     = 1024;
+
+    ntsa::Error error;
+
+    bsl::shared_ptr<ntci::StreamSocket> clientStreamSocket;
+    bsl::shared_ptr<ntsi::StreamSocket> basicServerSocket;
+    {
+        ntca::StreamSocketOptions options;
+        options.setTransport(transport);
+        options.setSendCoalescing(true);
+        options.setSendCoalescingWindow(bsls::TimeInterval(0.2));
+
+        bsl::shared_ptr<ntsi::StreamSocket> basicClientSocket;
+
+        error = ntsf::System::createStreamSocketPair(&basicClientSocket,
+                                                     &basicServerSocket,
+                                                     transport);
+        NTCCFG_TEST_FALSE(error);
+
+        error = basicServerSocket->setBlocking(true);
+        NTCCFG_TEST_FALSE(error);
+
+        clientStreamSocket = interface->createStreamSocket(options, allocator);
+
+        error = clientStreamSocket->open(transport, basicClientSocket);
+        NTCCFG_TEST_FALSE(error);
+    }
+
+    // Messages sent within the coalescing window are held on the write queue
+    // then written together, and so are read together.
+
+    {
+        bsl::string expected(allocator);
+
+        for (bsl::size_t i = 0; i < k_NUM_MESSAGES; ++i) {
+            const bsl::string message(k_MESSAGE_SIZE,
+                                      static_cast<char>('a' + i),
+                                      allocator);
+
+            test::SendCoalescingUtil::send(clientStreamSocket,
+                                           message,
+                                           ntca::SendOptions(),
+                                           allocator);
+
+            expected.append(message);
+        }
+
+        NTCCFG_TEST_EQ(clientStreamSocket->writeQueueSize(),
+                       k_NUM_MESSAGES * k_MESSAGE_SIZE);
+
+        const bsl::string received = test::SendCoalescingUtil::receive(
+            basicServerSocket,
+            k_CAPACITY,
+            allocator);
+
+        NTCCFG_TEST_EQ(received, expected);
+        NTCCFG_TEST_EQ(clientStreamSocket->writeQueueSize(), 0);
+    }
+
+    // A send that requests a flush forces out the data already coalesced,
+    // ahead of its own data, before the send returns.
+
+    {
+        test::SendCoalescingUtil::send(clientStreamSocket,
+                                       "first",
+                                       ntca::SendOptions(),
+                                       allocator);
+
+        test::SendCoalescingUtil::send(clientStreamSocket,
+                                       "second",
+                                       ntca::SendOptions(),
+                                       allocator);
+
+        NTCCFG_TEST_EQ(clientStreamSocket->writeQueueSize(), 11);
+
+        ntca::SendOptions sendOptions;
+        sendOptions.setFlush(true);
+
+        test::SendCoalescingUtil::send(clientStreamSocket,
+                                       "third",
+                                       sendOptions,
+                                       allocator);
+
+        NTCCFG_TEST_EQ(clientStreamSocket->writeQueueSize(), 0);
+
+        bsl::string received(allocator);
+        while (received.size() < 16) {
+            const bsl::string data = test::SendCoalescingUtil::receive(
+                basicServerSocket,
+                k_CAPACITY,
+                allocator);
+            NTCCFG_TEST_FALSE(data.empty());
+
+            received.append(data);
+        }
+
+        NTCCFG_TEST_EQ(received, "firstsecondthird");
+    }
+
+    // Data still coalesced when the socket is closed is discarded, and the
+    // coalescing timer is closed rather than left to flush it, or to keep
+    // the socket alive, afterwards.
+
+    {
+        test::SendCoalescingUtil::send(clientStreamSocket,
+                                       "discarded",
+                                       ntca::SendOptions(),
+                                       allocator);
+
+        NTCCFG_TEST_EQ(clientStreamSocket->writeQueueSize(), 9);
+
+        {
+            ntci::StreamSocketCloseGuard clientStreamSocketCloseGuard(
+                clientStreamSocket);
+        }
+
+        const bsl::string received = test::SendCoalescingUtil::receive(
+            basicServerSocket,
+            k_CAPACITY,
+            allocator);
+
+        NTCCFG_TEST_TRUE(received.empty());
+    }
+
+    NTCI_LOG_DEBUG("Stream socket send coalescing test complete");
+}
+
+/// Provide utilities for testing send conflation.
+struct SendConflationUtil {
+    /// Process the specified send 'event' for data replaced on the write
+    /// queue of the socket identified by the specified 'sender', then post
+    /// to the specified 'semaphore'.
+    static void processSendCancelled(
+        const bsl::shared_ptr<ntci::Sender>& sender,
+        const ntca::SendEvent&               event,
+        bslmt::Semaphore*                    semaphore);
+};
+
+void SendConflationUtil::processSendCancelled(
+    const bsl::shared_ptr<ntci::Sender>& sender,
+    const ntca::SendEvent&               event,
+    bslmt::Semaphore*                    semaphore)
+{
+    NTCCFG_TEST_EQ(event.type(), ntca::SendEventType::e_ERROR);
+    NTCCFG_TEST_EQ(event.context().error(), ntsa::Error::e_CANCELLED);
+
+    semaphore->post();
+}
+
+void concernStreamSocketSendConflation(
+    const bsl::shared_ptr<ntci::Interface>& interface,
+    bslma::Allocator*                       allocator)
+{
+    // Concern: A send with the same conflation key as data still on the
+    // write queue replaces that data in place, and cancels its callback,
+    // even when the write queue is past its high watermark, as long as the
+    // replacement does not grow the write queue. Sends that would grow the
+    // write queue past its high watermark still fail with e_WOULD_BLOCK.
+
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_DEBUG("Stream socket send conflation test starting");
+
+    const ntsa::Transport::Value transport =
+        ntsa::Transport::e_TCP_IPV4_STREAM;
+
+    const bsl::size_t   k_FILL_SIZE      = 1024 * 1024 * 16;
+    const bsl::size_t   k_HIGH_WATERMARK = 1024;
+    const bsl::size_t   k_CAPACITY       = 1024 * 64;
+    const bsl::uint64_t k_KEY            = 1;
+
+    ntsa::Error      error;
+    bslmt::Semaphore sendSemaphore;
+
+    bsl::shared_ptr<ntci::StreamSocket> clientStreamSocket;
+    bsl::shared_ptr<ntsi::StreamSocket> basicServerSocket;
+    {
+        ntca::StreamSocketOptions options;
+        options.setTransport(transport);
+        options.setWriteQueueHighWatermark(k_HIGH_WATERMARK);
+
+        bsl::shared_ptr<ntsi::StreamSocket> basicClientSocket;
+
+        error = ntsf::System::createStreamSocketPair(&basicClientSocket,
+                                                     &basicServerSocket,
+                                                     transport);
+        NTCCFG_TEST_FALSE(error);
+
+        error = basicServerSocket->setBlocking(true);
+        NTCCFG_TEST_FALSE(error);
+
+        clientStreamSocket = interface->createStreamSocket(options, allocator);
+
+        error = clientStreamSocket->open(transport, basicClientSocket);
+        NTCCFG_TEST_FALSE(error);
+    }
+
+    // Fill the write queue past its high watermark while the peer is not
+    // reading, then enqueue keyed data followed by unkeyed data, overriding
+    // the high watermark for each send.
+
+    ntca::SendOptions overrideOptions;
+    overrideOptions.setHighWatermark(bsl::numeric_limits<bsl::size_t>::max());
+
+    test::SendCoalescingUtil::send(clientStreamSocket,
+                                   bsl::string(k_FILL_SIZE, 'x', allocator),
+                                   ntca::SendOptions(),
+                                   allocator);
+
+    {
+        bdlbb::Blob data(clientStreamSocket->outgoingBlobBufferFactory().get(),
+                         allocator);
+        bdlbb::BlobUtil::append(&data, "AAAA", 4);
+
+        ntca::SendOptions sendOptions(overrideOptions);
+        sendOptions.setConflationKey(k_KEY);
+
+        ntci::SendCallback sendCallback =
+            clientStreamSocket->createSendCallback(
+                NTCCFG_BIND(&test::SendConflationUtil::processSendCancelled,
+                            NTCCFG_BIND_PLACEHOLDER_1,
+                            NTCCFG_BIND_PLACEHOLDER_2,
+                            &sendSemaphore),
+                allocator);
+
+        error = clientStreamSocket->send(data, sendOptions, sendCallback);
+        NTCCFG_TEST_OK(error);
+    }
+
+    test::SendCoalescingUtil::send(clientStreamSocket,
+                                   "tail",
+                                   overrideOptions,
+                                   allocator);
+
+    NTCCFG_TEST_GT(clientStreamSocket->writeQueueSize(), k_HIGH_WATERMARK);
+
+    // Sends subject to the high watermark are rejected unless they replace
+    // queued data without growing the write queue.
+
+    {
+        ntca::SendOptions sendOptions;
+
+        bdlbb::Blob data(clientStreamSocket->outgoingBlobBufferFactory().get(),
+                         allocator);
+        bdlbb::BlobUtil::append(&data, "unkeyed", 7);
+
+        error = clientStreamSocket->send(data, sendOptions);
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+
+        sendOptions.setConflationKey(k_KEY + 1);
+
+        error = clientStreamSocket->send(data, sendOptions);
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+
+        sendOptions.setConflationKey(k_KEY);
+
+        error = clientStreamSocket->send(data, sendOptions);
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+    }
+
+    {
+        ntca::SendOptions sendOptions;
+        sendOptions.setConflationKey(k_KEY);
+
+        test::SendCoalescingUtil::send(clientStreamSocket,
+                                       "BBBB",
+                                       sendOptions,
+                                       allocator);
+    }
+
+    sendSemaphore.wait();
+
+    // The peer receives the replacement in the position of the data it
+    // replaced, ahead of the data enqueued after it.
+
+    {
+        const bsl::string expected = "BBBBtail";
+        const bsl::size_t total    = k_FILL_SIZE + expected.size();
+
+        bsl::string received(allocator);
+        received.reserve(total);
+
+        while (received.size() < total) {
+            const bsl::string data = test::SendCoalescingUtil::receive(
+                basicServerSocket,
+                k_CAPACITY,
+                allocator);
+            NTCCFG_TEST_FALSE(data.empty());
+
+            received.append(data);
+        }
+
+        NTCCFG_TEST_EQ(received.size(), total);
+        NTCCFG_TEST_EQ(received.substr(k_FILL_SIZE), expected);
+        NTCCFG_TEST_EQ(received.find_first_not_of('x'), k_FILL_SIZE);
+    }
+
+    {
+        ntci::StreamSocketCloseGuard clientStreamSocketCloseGuard(
+            clientStreamSocket);
+    }
+
+    NTCI_LOG_DEBUG("Stream socket send conflation test complete");
+}
+
 }  // close namespace 'test'
 
 NTCCFG_TEST_CASE(1)
@@ -14235,6 +15415,60 @@ NTCCFG_TEST_CASE(81)
     NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
 
+NTCCFG_TEST_CASE(82)
+{
+    ntccfg::TestAllocator ta;
+    {
+        test::concern(&test::concernOpenMetricsServer, &ta);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(83)
+{
+    ntccfg::TestAllocator ta;
+    {
+        test::concern(&test::concernStreamSocketReceiveBatch, &ta);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(84)
+{
+    ntccfg::TestAllocator ta;
+    {
+        test::concern(&test::concernDatagramSocketReceiveBatch, &ta);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(85)
+{
+    ntccfg::TestAllocator ta;
+    {
+        test::concern(&test::concernStreamSocketReceiveBuffers, &ta);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(86)
+{
+    ntccfg::TestAllocator ta;
+    {
+        test::concern(&test::concernStreamSocketSendCoalescing, &ta);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(87)
+{
+    ntccfg::TestAllocator ta;
+    {
+        test::concern(&test::concernStreamSocketSendConflation, &ta);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
@@ -14318,5 +15552,11 @@ NTCCFG_TEST_DRIVER
     NTCCFG_TEST_REGISTER(79);
     NTCCFG_TEST_REGISTER(80);
     NTCCFG_TEST_REGISTER(81);
+    NTCCFG_TEST_REGISTER(82);
+    NTCCFG_TEST_REGISTER(83);
+    NTCCFG_TEST_REGISTER(84);
+    NTCCFG_TEST_REGISTER(85);
+    NTCCFG_TEST_REGISTER(86);
+    NTCCFG_TEST_REGISTER(87);
 }
 NTCCFG_TEST_DRIVER_END;
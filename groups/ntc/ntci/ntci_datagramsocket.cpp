@@ -34,6 +34,26 @@ ntsa::Error DatagramSocket::setZeroCopyThreshold(bsl::size_t value)
     return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
 }
 
+ntsa::Error DatagramSocket::receiveBatch(
+    const ntca::ReceiveOptions&       options,
+    const ntci::ReceiveBatchFunction& callback)
+{
+    NTCCFG_WARNING_UNUSED(options);
+    NTCCFG_WARNING_UNUSED(callback);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::receiveBatch(
+    const ntca::ReceiveOptions&       options,
+    const ntci::ReceiveBatchCallback& callback)
+{
+    NTCCFG_WARNING_UNUSED(options);
+    NTCCFG_WARNING_UNUSED(callback);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
 ntsa::Error DatagramSocket::timestampOutgoingData(bool enable)
 {
     NTCCFG_WARNING_UNUSED(enable);
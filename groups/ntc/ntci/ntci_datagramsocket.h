@@ -35,6 +35,7 @@ BSLS_IDENT("$Id: $")
 #include <ntci_datapool.h>
 #include <ntci_executor.h>
 #include <ntci_ratelimiter.h>
+#include <ntci_receivebatchcallback.h>
 #include <ntci_receivecallback.h>
 #include <ntci_receivecallbackfactory.h>
 #include <ntci_receiver.h>
@@ -747,6 +748,38 @@ class DatagramSocket : public ntsi::Descriptor,
     virtual ntsa::Error receive(const ntca::ReceiveOptions&  options,
                                 const ntci::ReceiveCallback& callback) = 0;
 
+    /// Dequeue up to the maximum number of messages defined by the specified
+    /// 'options' from the read queue and invoke the specified 'callback' once
+    /// with all of them, as soon as at least one message is available. The
+    /// total size of the messages in the batch is limited by the maximum size
+    /// defined by 'options', except that the first message is always
+    /// delivered. Each message is one datagram, and the context of the event
+    /// of each result identifies the endpoint from which the datagram was
+    /// sent. Return the error. Note that callbacks created by this object will
+    /// automatically be invoked on this object's strand unless an explicit
+    /// strand is specified at the time the callback is created. Note that the
+    /// default implementation of this function returns
+    /// 'ntsa::Error::e_NOT_IMPLEMENTED'.
+    virtual ntsa::Error receiveBatch(
+        const ntca::ReceiveOptions&       options,
+        const ntci::ReceiveBatchFunction& callback);
+
+    /// Dequeue up to the maximum number of messages defined by the specified
+    /// 'options' from the read queue and invoke the specified 'callback' once
+    /// with all of them, as soon as at least one message is available. The
+    /// total size of the messages in the batch is limited by the maximum size
+    /// defined by 'options', except that the first message is always
+    /// delivered. Each message is one datagram, and the context of the event
+    /// of each result identifies the endpoint from which the datagram was
+    /// sent. Return the error. Note that callbacks created by this object will
+    /// automatically be invoked on this object's strand unless an explicit
+    /// strand is specified at the time the callback is created. Note that the
+    /// default implementation of this function returns
+    /// 'ntsa::Error::e_NOT_IMPLEMENTED'.
+    virtual ntsa::Error receiveBatch(
+        const ntca::ReceiveOptions&       options,
+        const ntci::ReceiveBatchCallback& callback);
+
     /// Register the specified 'resolver' for this socket. Return the error.
     virtual ntsa::Error registerResolver(
         const bsl::shared_ptr<ntci::Resolver>& resolver) = 0;
@@ -25,5 +25,14 @@ Encryption::~Encryption()
 {
 }
 
+ntsa::Error Encryption::exportSessionKeys(ntsa::TlsSessionKey* transmitKey,
+                                          ntsa::TlsSessionKey* receiveKey)
+{
+    transmitKey->reset();
+    receiveKey->reset();
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -29,6 +29,7 @@ BSLS_IDENT("$Id: $")
 #include <ntsa_buffer.h>
 #include <ntsa_data.h>
 #include <ntsa_error.h>
+#include <ntsa_tlssessionkey.h>
 #include <bdlbb_blob.h>
 #include <bsl_functional.h>
 #include <bsl_memory.h>
@@ -98,6 +99,19 @@ class Encryption
     /// Initiate the shutdown of the session.
     virtual ntsa::Error shutdown() = 0;
 
+    /// Load into the specified 'transmitKey' and 'receiveKey' the keying
+    /// material of the outgoing and incoming directions of the session,
+    /// including the sequence number of the next record in each direction,
+    /// so that the encryption of the session may be continued by the
+    /// operating system. Return the error. Return e_WOULD_BLOCK if the
+    /// session holds a partially received record. The state of the session
+    /// is unchanged, so it may continue to be used if the keys cannot be
+    /// installed. The behavior is undefined unless the handshake is
+    /// finished and no plaintext or ciphertext remains buffered. Note that
+    /// the default implementation returns e_NOT_IMPLEMENTED.
+    virtual ntsa::Error exportSessionKeys(ntsa::TlsSessionKey* transmitKey,
+                                          ntsa::TlsSessionKey* receiveKey);
+
     /// Return true if plaintext data is ready to be read.
     virtual bool hasIncomingPlainText() const = 0;
 
@@ -18,13 +18,39 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(ntci_metric_cpp, "$Id$ $CSID$")
 
+#include <ntccfg_likely.h>
+
+#include <bslmt_threadutil.h>
 #include <bslma_allocator.h>
 #include <bslma_default.h>
+#include <bsls_alignmentutil.h>
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsl_new.h>
 
 namespace BloombergLP {
 namespace ntci {
 
+namespace {
+
+// The thread-specific storage key of the shard index assigned to each
+// thread, stored biased by one so that zero indicates no shard index has
+// been assigned.
+bslmt::ThreadUtil::Key s_shardIndexKey;
+
+// The next shard index assigned to a thread.
+bsls::AtomicUint s_nextShardIndex(0);
+
+struct Initializer {
+    Initializer()
+    {
+        int rc = bslmt::ThreadUtil::createKey(&s_shardIndexKey, 0);
+        BSLS_ASSERT_OPT(rc == 0);
+    }
+} s_initializer;
+
+}  // close unnamed namespace
+
 void Metric::load(ntci::MetricValue* result)
 {
     bsls::SpinLockGuard guard(&d_lock);
@@ -172,6 +198,205 @@ void Metric::collectSummary(bdld::DatumMutableArrayRef* array,
     }
 }
 
+MetricSharded::MetricSharded(bslma::Allocator* basicAllocator)
+: d_shard()
+, d_arena_p(0)
+, d_shardArray_p(0)
+, d_numShards(k_DEFAULT_SHARDS)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    this->initialize();
+}
+
+MetricSharded::MetricSharded(bsl::size_t       numShards,
+                             bslma::Allocator* basicAllocator)
+: d_shard()
+, d_arena_p(0)
+, d_shardArray_p(0)
+, d_numShards(1)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    while (d_numShards < numShards && d_numShards < k_MAX_SHARDS) {
+        d_numShards *= 2;
+    }
+
+    this->initialize();
+}
+
+void MetricSharded::initialize()
+{
+    if (d_numShards == 1) {
+        d_shardArray_p = reinterpret_cast<char*>(&d_shard);
+        return;
+    }
+
+    d_arena_p = d_allocator_p->allocate(
+        (d_numShards * k_SHARD_SIZE) + k_CACHE_LINE_SIZE);
+
+    d_shardArray_p =
+        static_cast<char*>(d_arena_p) +
+        bsls::AlignmentUtil::calculateAlignmentOffset(d_arena_p,
+                                                      k_CACHE_LINE_SIZE);
+
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        new (this->shard(i)) Shard();
+    }
+}
+
+MetricSharded::~MetricSharded()
+{
+    if (d_arena_p == 0) {
+        return;
+    }
+
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        this->shard(i)->~Shard();
+    }
+
+    d_allocator_p->deallocate(d_arena_p);
+}
+
+bsl::size_t MetricSharded::threadShardIndex()
+{
+    bsl::size_t result = reinterpret_cast<bsl::size_t>(
+        bslmt::ThreadUtil::getSpecific(s_shardIndexKey));
+
+    if (NTCCFG_UNLIKELY(result == 0)) {
+        result = (s_nextShardIndex++ % k_MAX_SHARDS) + 1;
+
+        int rc = bslmt::ThreadUtil::setSpecific(
+            s_shardIndexKey,
+            reinterpret_cast<const void*>(result));
+        BSLS_ASSERT_OPT(rc == 0);
+    }
+
+    return result - 1;
+}
+
+void MetricSharded::load(ntci::MetricValue* result)
+{
+    result->reset();
+
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        Shard* shard = this->shard(i);
+
+        bsls::SpinLockGuard guard(&shard->d_lock);
+
+        if (shard->d_value.count() > 0) {
+            result->merge(shard->d_value);
+            shard->d_value.reset();
+        }
+    }
+}
+
+void MetricSharded::collectCount(bdld::DatumMutableArrayRef* array,
+                                 bsl::size_t*                index)
+{
+    ntci::MetricValue value;
+    this->load(&value);
+
+    if (value.count() > 0) {
+        array->data()[(*index)++] =
+            bdld::Datum::createDouble(static_cast<double>(value.count()));
+    }
+    else {
+        array->data()[(*index)++] = bdld::Datum::createNull();
+    }
+}
+
+void MetricSharded::collectTotal(bdld::DatumMutableArrayRef* array,
+                                 bsl::size_t*                index)
+{
+    ntci::MetricValue value;
+    this->load(&value);
+
+    if (value.count() > 0) {
+        array->data()[(*index)++] = bdld::Datum::createDouble(value.total());
+    }
+    else {
+        array->data()[(*index)++] = bdld::Datum::createNull();
+    }
+}
+
+void MetricSharded::collectMin(bdld::DatumMutableArrayRef* array,
+                               bsl::size_t*                index)
+{
+    ntci::MetricValue value;
+    this->load(&value);
+
+    if (value.count() > 0) {
+        array->data()[(*index)++] = bdld::Datum::createDouble(value.minimum());
+    }
+    else {
+        array->data()[(*index)++] = bdld::Datum::createNull();
+    }
+}
+
+void MetricSharded::collectAvg(bdld::DatumMutableArrayRef* array,
+                               bsl::size_t*                index)
+{
+    ntci::MetricValue value;
+    this->load(&value);
+
+    if (value.count() > 0) {
+        array->data()[(*index)++] = bdld::Datum::createDouble(value.average());
+    }
+    else {
+        array->data()[(*index)++] = bdld::Datum::createNull();
+    }
+}
+
+void MetricSharded::collectMax(bdld::DatumMutableArrayRef* array,
+                               bsl::size_t*                index)
+{
+    ntci::MetricValue value;
+    this->load(&value);
+
+    if (value.count() > 0) {
+        array->data()[(*index)++] = bdld::Datum::createDouble(value.maximum());
+    }
+    else {
+        array->data()[(*index)++] = bdld::Datum::createNull();
+    }
+}
+
+void MetricSharded::collectLast(bdld::DatumMutableArrayRef* array,
+                                bsl::size_t*                index)
+{
+    ntci::MetricValue value;
+    this->load(&value);
+
+    if (value.count() > 0) {
+        array->data()[(*index)++] = bdld::Datum::createDouble(value.last());
+    }
+    else {
+        array->data()[(*index)++] = bdld::Datum::createNull();
+    }
+}
+
+void MetricSharded::collectSummary(bdld::DatumMutableArrayRef* array,
+                                   bsl::size_t*                index)
+{
+    ntci::MetricValue value;
+    this->load(&value);
+
+    if (value.count() > 0) {
+        array->data()[(*index)++] =
+            bdld::Datum::createDouble(static_cast<double>(value.count()));
+        array->data()[(*index)++] = bdld::Datum::createDouble(value.total());
+        array->data()[(*index)++] = bdld::Datum::createDouble(value.minimum());
+        array->data()[(*index)++] = bdld::Datum::createDouble(value.average());
+        array->data()[(*index)++] = bdld::Datum::createDouble(value.maximum());
+    }
+    else {
+        array->data()[(*index)++] = bdld::Datum::createNull();
+        array->data()[(*index)++] = bdld::Datum::createNull();
+        array->data()[(*index)++] = bdld::Datum::createNull();
+        array->data()[(*index)++] = bdld::Datum::createNull();
+        array->data()[(*index)++] = bdld::Datum::createNull();
+    }
+}
+
 void MetricTotal::load(double* result)
 {
     bsls::SpinLockGuard guard(&d_lock);
@@ -208,5 +433,208 @@ void MetricGauge::collectLast(bdld::DatumMutableArrayRef* array,
     array->data()[(*index)++] = bdld::Datum::createDouble(value);
 }
 
+void MetricHistogramValue::merge(const MetricHistogramValue& other)
+{
+    if (other.d_count == 0) {
+        return;
+    }
+
+    for (bsl::size_t i = 0; i < k_BUCKET_COUNT; ++i) {
+        d_bucketArray[i] += other.d_bucketArray[i];
+    }
+
+    d_count   += other.d_count;
+    d_total   += other.d_total;
+    d_minimum = bsl::min(d_minimum, other.d_minimum);
+    d_maximum = bsl::max(d_maximum, other.d_maximum);
+}
+
+double MetricHistogramValue::percentile(double fraction) const
+{
+    if (d_count == 0) {
+        return 0;
+    }
+
+    // Find the bucket that contains the value having the nearest rank that
+    // corresponds to the fraction, then estimate the value as the midpoint
+    // of that bucket, bounded by the range of values actually measured.
+
+    const double target = fraction * static_cast<double>(d_count);
+
+    bsl::uint64_t rank = static_cast<bsl::uint64_t>(target);
+    if (static_cast<double>(rank) < target) {
+        ++rank;
+    }
+
+    if (rank < 1) {
+        rank = 1;
+    }
+    else if (rank > d_count) {
+        rank = d_count;
+    }
+
+    bsl::uint64_t cumulative = 0;
+    for (bsl::size_t i = 0; i < k_BUCKET_COUNT; ++i) {
+        cumulative += d_bucketArray[i];
+        if (cumulative >= rank) {
+            const bsl::uint64_t lower =
+                MetricHistogramValue::bucketLowerBound(i);
+            const bsl::uint64_t upper =
+                MetricHistogramValue::bucketUpperBound(i);
+
+            bsl::uint64_t value = lower + ((upper - lower - 1) / 2);
+
+            value = bsl::max(value, d_minimum);
+            value = bsl::min(value, d_maximum);
+
+            return static_cast<double>(value);
+        }
+    }
+
+    return static_cast<double>(d_maximum);
+}
+
+MetricHistogram::MetricHistogram(double            scale,
+                                 bslma::Allocator* basicAllocator)
+: d_total(0)
+, d_minimum(bsl::numeric_limits<bsl::uint64_t>::max())
+, d_maximum(0)
+, d_bucketArray(0)
+, d_scale(scale)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+MetricHistogram::~MetricHistogram()
+{
+    bsls::AtomicUint64* bucketArray = d_bucketArray.load();
+    if (bucketArray != 0) {
+        d_allocator_p->deallocate(bucketArray);
+    }
+}
+
+bsls::AtomicUint64* MetricHistogram::allocateBuckets()
+{
+    const bsl::size_t size =
+        sizeof(bsls::AtomicUint64) * MetricHistogramValue::k_BUCKET_COUNT;
+
+    bsls::AtomicUint64* bucketArray =
+        static_cast<bsls::AtomicUint64*>(d_allocator_p->allocate(size));
+
+    for (bsl::size_t i = 0; i < MetricHistogramValue::k_BUCKET_COUNT; ++i) {
+        new (bucketArray + i) bsls::AtomicUint64(0);
+    }
+
+    bsls::AtomicUint64* previous = d_bucketArray.testAndSwap(0, bucketArray);
+    if (previous != 0) {
+        d_allocator_p->deallocate(bucketArray);
+        return previous;
+    }
+
+    return bucketArray;
+}
+
+void MetricHistogram::load(ntci::MetricHistogramValue* result)
+{
+    result->reset();
+
+    bsls::AtomicUint64* bucketArray = d_bucketArray.loadAcquire();
+    if (bucketArray == 0) {
+        return;
+    }
+
+    // Values are recorded by first incrementing their bucket then updating
+    // the range, so the range is swapped first then the buckets. A value
+    // recorded concurrently with this function is then either loaded
+    // entirely into this interval, loaded entirely into the next interval,
+    // or counted in this interval with its contribution to the total,
+    // minimum, and maximum loaded into the next interval. The range is
+    // always carried into the result, even when no count is loaded, so that
+    // it is reported by those who aggregate the results. The count is
+    // derived from the buckets so that the percentiles are consistent with
+    // the count.
+
+    const bsl::uint64_t total   = d_total.swap(0);
+    const bsl::uint64_t minimum =
+        d_minimum.swap(bsl::numeric_limits<bsl::uint64_t>::max());
+    const bsl::uint64_t maximum = d_maximum.swap(0);
+
+    for (bsl::size_t i = 0; i < MetricHistogramValue::k_BUCKET_COUNT; ++i) {
+        if (bucketArray[i].loadRelaxed() != 0) {
+            const bsl::uint64_t count = bucketArray[i].swap(0);
+            if (count != 0) {
+                result->updateBucket(i, count);
+            }
+        }
+    }
+
+    result->updateRange(total, minimum, maximum);
+}
+
+void MetricHistogram::collectSummary(bdld::DatumMutableArrayRef* array,
+                                     bsl::size_t*                index)
+{
+    ntci::MetricHistogramValue value;
+    this->load(&value);
+
+    bdld::Datum* data = array->data();
+
+    if (value.count() > 0) {
+        const double count   = static_cast<double>(value.count());
+        const double total   = d_scale * value.total();
+        const double minimum = d_scale * value.minimum();
+        const double average = d_scale * value.average();
+        const double maximum = d_scale * value.maximum();
+
+        data[(*index)++] = bdld::Datum::createDouble(count);
+        data[(*index)++] = bdld::Datum::createDouble(total);
+        data[(*index)++] = bdld::Datum::createDouble(minimum);
+        data[(*index)++] = bdld::Datum::createDouble(average);
+        data[(*index)++] = bdld::Datum::createDouble(maximum);
+    }
+    else {
+        for (bsl::size_t i = 0; i < 5; ++i) {
+            data[(*index)++] = bdld::Datum::createNull();
+        }
+    }
+}
+
+void MetricHistogram::collectHistogram(bdld::DatumMutableArrayRef* array,
+                                       bsl::size_t*                index)
+{
+    ntci::MetricHistogramValue value;
+    this->load(&value);
+
+    bdld::Datum* data = array->data();
+
+    if (value.count() > 0) {
+        const double count   = static_cast<double>(value.count());
+        const double total   = d_scale * value.total();
+        const double minimum = d_scale * value.minimum();
+        const double average = d_scale * value.average();
+        const double maximum = d_scale * value.maximum();
+
+        const double p50  = d_scale * value.percentile(0.50);
+        const double p90  = d_scale * value.percentile(0.90);
+        const double p99  = d_scale * value.percentile(0.99);
+        const double p999 = d_scale * value.percentile(0.999);
+
+        data[(*index)++] = bdld::Datum::createDouble(count);
+        data[(*index)++] = bdld::Datum::createDouble(total);
+        data[(*index)++] = bdld::Datum::createDouble(minimum);
+        data[(*index)++] = bdld::Datum::createDouble(average);
+        data[(*index)++] = bdld::Datum::createDouble(maximum);
+        data[(*index)++] = bdld::Datum::createDouble(p50);
+        data[(*index)++] = bdld::Datum::createDouble(p90);
+        data[(*index)++] = bdld::Datum::createDouble(p99);
+        data[(*index)++] = bdld::Datum::createDouble(p999);
+    }
+    else {
+        for (bsl::size_t i = 0; i < 9; ++i) {
+            data[(*index)++] = bdld::Datum::createNull();
+        }
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
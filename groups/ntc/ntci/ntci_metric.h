@@ -22,6 +22,8 @@ BSLS_IDENT("$Id: $")
 #include <ntccfg_platform.h>
 #include <ntci_monitorable.h>
 #include <ntcscm_version.h>
+#include <bslma_allocator.h>
+#include <bsls_atomic.h>
 #include <bsls_spinlock.h>
 #include <bsl_algorithm.h>
 #include <bsl_limits.h>
@@ -66,6 +68,11 @@ class MetricValue
     /// Update the snapshot with the specified measured 'value'.
     void update(double value);
 
+    /// Merge the values measured by the specified 'other' snapshot into this
+    /// snapshot. If 'other' has measured any values, its last value becomes
+    /// the last value of this snapshot.
+    void merge(const MetricValue& other);
+
     /// Number of times the metric has been collected.
     bsl::uint64_t count() const;
 
@@ -136,6 +143,137 @@ class Metric
     void collectSummary(bdld::DatumMutableArrayRef* array, bsl::size_t* index);
 };
 
+/// Provide a measurement defined by the total, minimum, average, and
+/// maximum of the recorded values, sharded by thread.
+///
+/// @details
+/// This class provides the same semantics as 'ntci::Metric', but records
+/// each value into one of a number of shards, each occupying its own cache
+/// lines, chosen by the recording thread. Each thread is assigned a shard
+/// round-robin the first time it records into any sharded metric, so threads
+/// recording concurrently contend neither on a lock nor on a cache line
+/// unless there are more threads than shards. The shards are aggregated only
+/// when the metric is loaded or collected. Use this class for metrics
+/// updated from many threads at once, e.g. metrics that aggregate the
+/// metrics of many sockets; a sharded metric having a single shard behaves
+/// as an 'ntci::Metric' and stores its shard inline, without allocating
+/// memory. The last value of a metric having more than one shard is the last
+/// value recorded into one of its shards, which is not necessarily the value
+/// recorded most recently across all threads: tracking the order of updates
+/// across shards would cost a timestamp on every update.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntci_metrics
+class MetricSharded
+{
+    /// Describe a shard of a sharded metric.
+    struct Shard {
+        bsls::SpinLock    d_lock;
+        ntci::MetricValue d_value;
+
+        /// Create a new shard having default values.
+        Shard();
+    };
+
+    enum {
+        // The assumed size of a cache line, in bytes.
+        k_CACHE_LINE_SIZE = 64,
+
+        // The size of each shard, padded to occupy whole cache lines.
+        k_SHARD_SIZE = ((sizeof(Shard) + k_CACHE_LINE_SIZE - 1) /
+                        k_CACHE_LINE_SIZE) *
+                       k_CACHE_LINE_SIZE
+    };
+
+    Shard             d_shard;
+    void*             d_arena_p;
+    char*             d_shardArray_p;
+    bsl::size_t       d_numShards;
+    bslma::Allocator* d_allocator_p;
+
+  private:
+    MetricSharded(const MetricSharded&) BSLS_KEYWORD_DELETED;
+    MetricSharded& operator=(const MetricSharded&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Allocate, align, and construct each shard, unless this metric has a
+    /// single shard, which is stored inline.
+    void initialize();
+
+    /// Return the shard at the specified 'shardIndex'.
+    Shard* shard(bsl::size_t shardIndex) const;
+
+    /// Return the index of the shard assigned to the calling thread, in the
+    /// range [0, k_MAX_SHARDS).
+    static bsl::size_t threadShardIndex();
+
+  public:
+    enum {
+        /// The default number of shards.
+        k_DEFAULT_SHARDS = 16,
+
+        /// The maximum number of shards.
+        k_MAX_SHARDS = 64
+    };
+
+    /// Create a new metric having default values sharded
+    /// 'k_DEFAULT_SHARDS' ways. Optionally specify a 'basicAllocator' used
+    /// to supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used.
+    explicit MetricSharded(bslma::Allocator* basicAllocator = 0);
+
+    /// Create a new metric having default values sharded the specified
+    /// 'numShards' ways, rounded up to the nearest power of two no greater
+    /// than 'k_MAX_SHARDS'. Optionally specify a 'basicAllocator' used to
+    /// supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used.
+    explicit MetricSharded(bsl::size_t       numShards,
+                           bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~MetricSharded();
+
+    /// Update the snapshot with the specified measured 'value'.
+    void update(double value);
+
+    /// Load the value of the metric aggregated across each shard into the
+    /// specified 'result' and reset each shard.
+    void load(ntci::MetricValue* result);
+
+    /// Load the count of measurements of the metric into the specified
+    /// 'array', starting at '*index' and modifying the indexes used.
+    void collectCount(bdld::DatumMutableArrayRef* array, bsl::size_t* index);
+
+    /// Load the total value of the metric into the specified 'array',
+    /// starting at '*index' and modifying the indexes used.
+    void collectTotal(bdld::DatumMutableArrayRef* array, bsl::size_t* index);
+
+    /// Load the minimum value of the metric into the specified 'array',
+    /// starting at '*index' and modifying the indexes used.
+    void collectMin(bdld::DatumMutableArrayRef* array, bsl::size_t* index);
+
+    /// Load the average value of the metric into the specified 'array',
+    /// starting at '*index' and modifying the indexes used.
+    void collectAvg(bdld::DatumMutableArrayRef* array, bsl::size_t* index);
+
+    /// Load the maximum value of the metric into the specified 'array',
+    /// starting at '*index' and modifying the indexes used.
+    void collectMax(bdld::DatumMutableArrayRef* array, bsl::size_t* index);
+
+    /// Load the last value of the metric into the specified 'array',
+    /// starting at '*index' and modifying the indexes used.
+    void collectLast(bdld::DatumMutableArrayRef* array, bsl::size_t* index);
+
+    /// Load the entire value of the metric into the specified 'array',
+    /// starting at '*index' and modifying the indexes used.
+    void collectSummary(bdld::DatumMutableArrayRef* array, bsl::size_t* index);
+
+    /// Return the number of shards.
+    bsl::size_t numShards() const;
+};
+
 /// Provide a measurement defined by the last recorded value.
 ///
 /// @par Thread Safety
@@ -200,6 +338,189 @@ class MetricTotal
     void collectTotal(bdld::DatumMutableArrayRef* array, bsl::size_t* index);
 };
 
+/// Describe a snapshot of the distribution of the values measured for a
+/// histogram metric.
+///
+/// @details
+/// Values are counted as non-negative integers in log-linear buckets: each
+/// range of values between successive powers of two is divided into
+/// 'k_SUB_BUCKET_COUNT' buckets of equal width, so any percentile is known to
+/// within 1/16 of its true value while the memory required is fixed,
+/// regardless of the number or range of values measured. Values greater than
+/// or equal to 2^'k_MAX_MAGNITUDE' are counted in the last bucket. Snapshots
+/// are merged by summing their buckets, so the distribution of a quantity
+/// measured separately by many sockets or threads may be computed exactly
+/// from the distributions measured by each.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntci_metrics
+class MetricHistogramValue
+{
+  public:
+    enum {
+        /// The number of bits of precision of each bucket.
+        k_SUB_BUCKET_BITS = 3,
+
+        /// The number of buckets between successive powers of two.
+        k_SUB_BUCKET_COUNT = 1 << k_SUB_BUCKET_BITS,
+
+        /// The base-2 logarithm of the smallest value counted in the last
+        /// bucket.
+        k_MAX_MAGNITUDE = 40,
+
+        /// The number of buckets.
+        k_BUCKET_COUNT =
+            k_SUB_BUCKET_COUNT * (k_MAX_MAGNITUDE - k_SUB_BUCKET_BITS + 1)
+    };
+
+  private:
+    bsl::uint64_t d_count;
+    bsl::uint64_t d_total;
+    bsl::uint64_t d_minimum;
+    bsl::uint64_t d_maximum;
+    bsl::uint64_t d_bucketArray[k_BUCKET_COUNT];
+
+  public:
+    /// Create a new histogram snapshot having no measured values.
+    MetricHistogramValue();
+
+    /// Reset the snapshot to have no measured values.
+    void reset();
+
+    /// Update the snapshot with the specified measured 'value'.
+    void update(bsl::uint64_t value);
+
+    /// Update the snapshot with the specified 'count' of measured values
+    /// counted in the bucket at the specified 'bucketIndex'. The behavior is
+    /// undefined unless 'bucketIndex < k_BUCKET_COUNT'. Note that this
+    /// function does not affect the total, minimum, or maximum values.
+    void updateBucket(bsl::size_t bucketIndex, bsl::uint64_t count);
+
+    /// Update the snapshot with the specified 'total', 'minimum', and
+    /// 'maximum' of measured values whose counts are updated separately.
+    void updateRange(bsl::uint64_t total,
+                     bsl::uint64_t minimum,
+                     bsl::uint64_t maximum);
+
+    /// Merge the values measured by the specified 'other' snapshot into this
+    /// snapshot.
+    void merge(const MetricHistogramValue& other);
+
+    /// Return the number of values measured.
+    bsl::uint64_t count() const;
+
+    /// Return the total of the values measured.
+    double total() const;
+
+    /// Return the minimum value measured.
+    double minimum() const;
+
+    /// Return the average value measured.
+    double average() const;
+
+    /// Return the maximum value measured.
+    double maximum() const;
+
+    /// Return the value below which the specified 'fraction' of the values
+    /// measured fall, e.g. 0.99 for the 99th percentile. Return 0 if no
+    /// values have been measured.
+    double percentile(double fraction) const;
+
+    /// Return the number of values counted in the bucket at the specified
+    /// 'bucketIndex'. The behavior is undefined unless
+    /// 'bucketIndex < k_BUCKET_COUNT'.
+    bsl::uint64_t bucketCount(bsl::size_t bucketIndex) const;
+
+    /// Return the index of the bucket that counts the specified 'value'.
+    static bsl::size_t bucketIndex(bsl::uint64_t value);
+
+    /// Return the smallest value counted in the bucket at the specified
+    /// 'bucketIndex'.
+    static bsl::uint64_t bucketLowerBound(bsl::size_t bucketIndex);
+
+    /// Return the smallest value greater than each value counted in the
+    /// bucket at the specified 'bucketIndex'.
+    static bsl::uint64_t bucketUpperBound(bsl::size_t bucketIndex);
+};
+
+/// Provide a measurement defined by the distribution of the recorded values.
+///
+/// @details
+/// Recording a value is lock-free and wait-free other than for the
+/// maintenance of the minimum and maximum. Values are recorded as
+/// non-negative integers, so measurements of time should be recorded at the
+/// desired resolution, e.g. in microseconds, and may be reported in other
+/// units by multiplying each collected value by a scale, e.g. 1e-6 to report
+/// microseconds as seconds. The buckets are allocated when the first value is
+/// recorded, so a histogram that never measures a value costs only a few
+/// words. Each collection loads and resets the distribution measured since
+/// the previous collection. See 'ntci::MetricHistogramValue' for the
+/// precision of the percentiles computed.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntci_metrics
+class MetricHistogram
+{
+    bsls::AtomicUint64                      d_total;
+    bsls::AtomicUint64                      d_minimum;
+    bsls::AtomicUint64                      d_maximum;
+    bsls::AtomicPointer<bsls::AtomicUint64> d_bucketArray;
+    double                                  d_scale;
+    bslma::Allocator*                       d_allocator_p;
+
+  private:
+    MetricHistogram(const MetricHistogram&) BSLS_KEYWORD_DELETED;
+    MetricHistogram& operator=(const MetricHistogram&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Return the buckets, allocating them if necessary.
+    bsls::AtomicUint64* buckets();
+
+    /// Allocate the buckets, unless already allocated by another thread, and
+    /// return them.
+    bsls::AtomicUint64* allocateBuckets();
+
+  public:
+    /// Create a new metric having default values. Optionally specify a
+    /// 'scale' by which each collected value is multiplied. If 'scale' is
+    /// not specified, collected values are reported as recorded. Optionally
+    /// specify a 'basicAllocator' used to supply memory. If 'basicAllocator'
+    /// is 0, the currently installed default allocator is used.
+    explicit MetricHistogram(double            scale          = 1.0,
+                             bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~MetricHistogram();
+
+    /// Update the distribution with the specified measured 'value'. Negative
+    /// values are recorded as zero and fractional values are truncated.
+    void update(double value);
+
+    /// Load the distribution measured since the last load or collection into
+    /// the specified 'result' and reset the distribution. Note that a value
+    /// updated concurrently with this function may be counted in 'result'
+    /// while its contribution to the total, minimum, and maximum is loaded
+    /// by the next call to this function, so 'result' may have a range but
+    /// no count.
+    void load(ntci::MetricHistogramValue* result);
+
+    /// Load the count, total, minimum, average, and maximum values of the
+    /// metric into the specified 'array', starting at '*index' and modifying
+    /// the indexes used.
+    void collectSummary(bdld::DatumMutableArrayRef* array, bsl::size_t* index);
+
+    /// Load the count, total, minimum, average, and maximum values of the
+    /// metric, followed by its 50th, 90th, 99th, and 99.9th percentiles, into
+    /// the specified 'array', starting at '*index' and modifying the indexes
+    /// used.
+    void collectHistogram(bdld::DatumMutableArrayRef* array,
+                          bsl::size_t*                index);
+};
+
 #define NTCI_METRIC_METADATA_COUNT(name)                                      \
     {                                                                         \
 #name ".count", ntci::Monitorable::e_SUM                              \
@@ -235,6 +556,35 @@ class MetricTotal
         NTCI_METRIC_METADATA_MIN(name), NTCI_METRIC_METADATA_AVG(name),       \
         NTCI_METRIC_METADATA_MAX(name)
 
+// Note that percentiles cannot be derived from the percentiles of the
+// constituent parts, so percentiles aggregated across monitorable objects
+// are conservatively aggregated as the maximum of each constituent part.
+
+#define NTCI_METRIC_METADATA_P50(name)                                        \
+    {                                                                         \
+#name ".p50", ntci::Monitorable::e_MAXIMUM                            \
+    }
+
+#define NTCI_METRIC_METADATA_P90(name)                                        \
+    {                                                                         \
+#name ".p90", ntci::Monitorable::e_MAXIMUM                            \
+    }
+
+#define NTCI_METRIC_METADATA_P99(name)                                        \
+    {                                                                         \
+#name ".p99", ntci::Monitorable::e_MAXIMUM                            \
+    }
+
+#define NTCI_METRIC_METADATA_P999(name)                                       \
+    {                                                                         \
+#name ".p999", ntci::Monitorable::e_MAXIMUM                           \
+    }
+
+#define NTCI_METRIC_METADATA_HISTOGRAM(name)                                  \
+    NTCI_METRIC_METADATA_SUMMARY(name), NTCI_METRIC_METADATA_P50(name),       \
+        NTCI_METRIC_METADATA_P90(name), NTCI_METRIC_METADATA_P99(name),       \
+        NTCI_METRIC_METADATA_P999(name)
+
 NTCCFG_INLINE
 MetricValue::MetricValue()
 : d_count(0)
@@ -301,6 +651,20 @@ double MetricValue::last() const
     return d_last;
 }
 
+NTCCFG_INLINE
+void MetricValue::merge(const MetricValue& other)
+{
+    if (other.d_count == 0) {
+        return;
+    }
+
+    d_count   += other.d_count;
+    d_total   += other.d_total;
+    d_minimum = bsl::min(d_minimum, other.d_minimum);
+    d_maximum = bsl::max(d_maximum, other.d_maximum);
+    d_last    = other.d_last;
+}
+
 NTCCFG_INLINE
 Metric::Metric()
 : d_lock(bsls::SpinLock::s_unlocked)
@@ -315,6 +679,39 @@ void Metric::update(double value)
     d_value.update(value);
 }
 
+NTCCFG_INLINE
+MetricSharded::Shard::Shard()
+: d_lock(bsls::SpinLock::s_unlocked)
+, d_value()
+{
+}
+
+NTCCFG_INLINE
+MetricSharded::Shard* MetricSharded::shard(bsl::size_t shardIndex) const
+{
+    return reinterpret_cast<Shard*>(d_shardArray_p +
+                                    (shardIndex * k_SHARD_SIZE));
+}
+
+NTCCFG_INLINE
+void MetricSharded::update(double value)
+{
+    Shard* shard = d_numShards == 1
+                       ? this->shard(0)
+                       : this->shard(MetricSharded::threadShardIndex() &
+                                     (d_numShards - 1));
+
+    bsls::SpinLockGuard guard(&shard->d_lock);
+
+    shard->d_value.update(value);
+}
+
+NTCCFG_INLINE
+bsl::size_t MetricSharded::numShards() const
+{
+    return d_numShards;
+}
+
 NTCCFG_INLINE
 MetricTotal::MetricTotal()
 : d_lock(bsls::SpinLock::s_unlocked)
@@ -353,6 +750,183 @@ bool MetricGauge::update(double value)
     return true;
 }
 
+NTCCFG_INLINE
+MetricHistogramValue::MetricHistogramValue()
+{
+    this->reset();
+}
+
+NTCCFG_INLINE
+void MetricHistogramValue::reset()
+{
+    d_count   = 0;
+    d_total   = 0;
+    d_minimum = bsl::numeric_limits<bsl::uint64_t>::max();
+    d_maximum = 0;
+
+    for (bsl::size_t i = 0; i < k_BUCKET_COUNT; ++i) {
+        d_bucketArray[i] = 0;
+    }
+}
+
+NTCCFG_INLINE
+void MetricHistogramValue::update(bsl::uint64_t value)
+{
+    d_count   += 1;
+    d_total   += value;
+    d_minimum = bsl::min(d_minimum, value);
+    d_maximum = bsl::max(d_maximum, value);
+
+    d_bucketArray[MetricHistogramValue::bucketIndex(value)] += 1;
+}
+
+NTCCFG_INLINE
+void MetricHistogramValue::updateBucket(bsl::size_t   bucketIndex,
+                                        bsl::uint64_t count)
+{
+    d_count                    += count;
+    d_bucketArray[bucketIndex] += count;
+}
+
+NTCCFG_INLINE
+void MetricHistogramValue::updateRange(bsl::uint64_t total,
+                                       bsl::uint64_t minimum,
+                                       bsl::uint64_t maximum)
+{
+    d_total   += total;
+    d_minimum = bsl::min(d_minimum, minimum);
+    d_maximum = bsl::max(d_maximum, maximum);
+}
+
+NTCCFG_INLINE
+bsl::uint64_t MetricHistogramValue::count() const
+{
+    return d_count;
+}
+
+NTCCFG_INLINE
+double MetricHistogramValue::total() const
+{
+    return static_cast<double>(d_total);
+}
+
+NTCCFG_INLINE
+double MetricHistogramValue::minimum() const
+{
+    return static_cast<double>(d_minimum);
+}
+
+NTCCFG_INLINE
+double MetricHistogramValue::average() const
+{
+    return static_cast<double>(d_total) / static_cast<double>(d_count);
+}
+
+NTCCFG_INLINE
+double MetricHistogramValue::maximum() const
+{
+    return static_cast<double>(d_maximum);
+}
+
+NTCCFG_INLINE
+bsl::uint64_t MetricHistogramValue::bucketCount(bsl::size_t bucketIndex) const
+{
+    return d_bucketArray[bucketIndex];
+}
+
+NTCCFG_INLINE
+bsl::size_t MetricHistogramValue::bucketIndex(bsl::uint64_t value)
+{
+    if (value < static_cast<bsl::uint64_t>(k_SUB_BUCKET_COUNT)) {
+        return static_cast<bsl::size_t>(value);
+    }
+
+    if (value >= (static_cast<bsl::uint64_t>(1) << k_MAX_MAGNITUDE)) {
+        return k_BUCKET_COUNT - 1;
+    }
+
+    bsl::size_t magnitude = k_SUB_BUCKET_BITS;
+    while ((value >> (magnitude + 1)) != 0) {
+        ++magnitude;
+    }
+
+    const bsl::size_t shift = magnitude - k_SUB_BUCKET_BITS;
+    const bsl::size_t subBucketIndex =
+        static_cast<bsl::size_t>(value >> shift) & (k_SUB_BUCKET_COUNT - 1);
+
+    return k_SUB_BUCKET_COUNT + (shift * k_SUB_BUCKET_COUNT) + subBucketIndex;
+}
+
+NTCCFG_INLINE
+bsl::uint64_t MetricHistogramValue::bucketLowerBound(bsl::size_t bucketIndex)
+{
+    if (bucketIndex < k_SUB_BUCKET_COUNT) {
+        return static_cast<bsl::uint64_t>(bucketIndex);
+    }
+
+    const bsl::size_t shift = (bucketIndex / k_SUB_BUCKET_COUNT) - 1;
+    const bsl::size_t subBucketIndex = bucketIndex % k_SUB_BUCKET_COUNT;
+
+    return static_cast<bsl::uint64_t>(k_SUB_BUCKET_COUNT + subBucketIndex)
+           << shift;
+}
+
+NTCCFG_INLINE
+bsl::uint64_t MetricHistogramValue::bucketUpperBound(bsl::size_t bucketIndex)
+{
+    if (bucketIndex < k_SUB_BUCKET_COUNT) {
+        return static_cast<bsl::uint64_t>(bucketIndex) + 1;
+    }
+
+    const bsl::size_t shift = (bucketIndex / k_SUB_BUCKET_COUNT) - 1;
+
+    return MetricHistogramValue::bucketLowerBound(bucketIndex) +
+           (static_cast<bsl::uint64_t>(1) << shift);
+}
+
+NTCCFG_INLINE
+bsls::AtomicUint64* MetricHistogram::buckets()
+{
+    bsls::AtomicUint64* bucketArray = d_bucketArray.loadAcquire();
+    if (bucketArray != 0) {
+        return bucketArray;
+    }
+
+    return this->allocateBuckets();
+}
+
+NTCCFG_INLINE
+void MetricHistogram::update(double value)
+{
+    const bsl::uint64_t sample =
+        value > 0 ? static_cast<bsl::uint64_t>(value) : 0;
+
+    bsls::AtomicUint64* bucketArray = this->buckets();
+
+    bucketArray[MetricHistogramValue::bucketIndex(sample)].addRelaxed(1);
+    d_total.addRelaxed(sample);
+
+    bsl::uint64_t minimum = d_minimum.loadRelaxed();
+    while (sample < minimum) {
+        const bsl::uint64_t previous =
+            d_minimum.testAndSwap(minimum, sample);
+        if (previous == minimum) {
+            break;
+        }
+        minimum = previous;
+    }
+
+    bsl::uint64_t maximum = d_maximum.loadRelaxed();
+    while (sample > maximum) {
+        const bsl::uint64_t previous =
+            d_maximum.testAndSwap(maximum, sample);
+        if (previous == maximum) {
+            break;
+        }
+        maximum = previous;
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
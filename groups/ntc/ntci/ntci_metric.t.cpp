@@ -16,6 +16,11 @@
 #include <ntci_metric.h>
 
 #include <ntccfg_test.h>
+#include <bdld_datum.h>
+#include <bdld_manageddatum.h>
+#include <bdlf_bind.h>
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
 #include <bslma_testallocator.h>
 
 using namespace BloombergLP;
@@ -29,10 +34,35 @@ using namespace BloombergLP;
 //-----------------------------------------------------------------------------
 
 // [ 1]
+// [ 2]
+// [ 3]
+// [ 4]
 //-----------------------------------------------------------------------------
 // [ 1]
+// [ 2]
+// [ 3]
+// [ 4]
 //-----------------------------------------------------------------------------
 
+namespace test {
+
+/// Wait on the specified 'barrier' then update the specified 'metric' with
+/// each value in the range [1, 'numValues'] multiplied by the specified
+/// 'scale'.
+void work(ntci::MetricSharded* metric,
+          bslmt::Barrier*      barrier,
+          bsl::size_t          numValues,
+          double               scale)
+{
+    barrier->wait();
+
+    for (bsl::size_t i = 1; i <= numValues; ++i) {
+        metric->update(static_cast<double>(i) * scale);
+    }
+}
+
+}  // close namespace test
+
 NTCCFG_TEST_CASE(1)
 {
     // Concern:
@@ -44,8 +74,256 @@ NTCCFG_TEST_CASE(1)
     NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
 
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: Histogram buckets partition the range of values and bound
+    // the relative error of each bucket.
+    // Plan:
+
+    typedef ntci::MetricHistogramValue Value;
+
+    NTCCFG_TEST_EQ(Value::bucketLowerBound(0), 0);
+
+    for (bsl::size_t i = 0; i < Value::k_BUCKET_COUNT; ++i) {
+        const bsl::uint64_t lower = Value::bucketLowerBound(i);
+        const bsl::uint64_t upper = Value::bucketUpperBound(i);
+
+        NTCCFG_TEST_LT(lower, upper);
+
+        NTCCFG_TEST_EQ(Value::bucketIndex(lower), i);
+        NTCCFG_TEST_EQ(Value::bucketIndex(upper - 1), i);
+
+        if (i + 1 < Value::k_BUCKET_COUNT) {
+            NTCCFG_TEST_EQ(Value::bucketLowerBound(i + 1), upper);
+        }
+
+        if (lower >= Value::k_SUB_BUCKET_COUNT) {
+            NTCCFG_TEST_LE((upper - lower) * Value::k_SUB_BUCKET_COUNT,
+                           lower);
+        }
+    }
+
+    const bsl::uint64_t maxValue = bsl::numeric_limits<bsl::uint64_t>::max();
+
+    NTCCFG_TEST_EQ(Value::bucketIndex(maxValue), Value::k_BUCKET_COUNT - 1);
+}
+
+NTCCFG_TEST_CASE(3)
+{
+    // Concern: Histogram percentiles, merging, collection, scaling, and
+    // lazy allocation of buckets.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        ntci::MetricHistogramValue value;
+
+        NTCCFG_TEST_EQ(value.count(), 0);
+        NTCCFG_TEST_EQ(value.percentile(0.5), 0);
+
+        for (bsl::uint64_t i = 1; i <= 1000; ++i) {
+            value.update(i);
+        }
+
+        NTCCFG_TEST_EQ(value.count(), 1000);
+        NTCCFG_TEST_EQ(value.total(), 500500);
+        NTCCFG_TEST_EQ(value.minimum(), 1);
+        NTCCFG_TEST_EQ(value.maximum(), 1000);
+
+        const double fractions[] = {0.5, 0.9, 0.99, 0.999};
+        for (bsl::size_t i = 0; i < sizeof fractions / sizeof fractions[0];
+             ++i)
+        {
+            const double expected = fractions[i] * 1000;
+            const double found    = value.percentile(fractions[i]);
+
+            NTCCFG_TEST_LE(found, expected * (1 + 1.0 / 16));
+            NTCCFG_TEST_GE(found, expected * (1 - 1.0 / 16));
+        }
+
+        NTCCFG_TEST_EQ(value.percentile(1.0), 1000);
+        NTCCFG_TEST_EQ(value.percentile(0.0), 1);
+
+        ntci::MetricHistogramValue other;
+        for (bsl::uint64_t i = 0; i < 1000; ++i) {
+            other.update(100000);
+        }
+
+        value.merge(other);
+
+        NTCCFG_TEST_EQ(value.count(), 2000);
+        NTCCFG_TEST_EQ(value.minimum(), 1);
+        NTCCFG_TEST_EQ(value.maximum(), 100000);
+        NTCCFG_TEST_LE(value.percentile(0.25), 500 * (1 + 1.0 / 16));
+        NTCCFG_TEST_EQ(value.percentile(0.75), 100000);
+
+        ntci::MetricHistogram histogram(1.0, &ta);
+
+        const bsl::int64_t numBlocksBefore = ta.numBlocksInUse();
+
+        ntci::MetricHistogramValue empty;
+        histogram.load(&empty);
+
+        NTCCFG_TEST_EQ(empty.count(), 0);
+        NTCCFG_TEST_EQ(ta.numBlocksInUse(), numBlocksBefore);
+
+        histogram.update(-1);
+
+        NTCCFG_TEST_EQ(ta.numBlocksInUse(), numBlocksBefore + 1);
+
+        histogram.update(10.9);
+        histogram.update(20);
+
+        ntci::MetricHistogramValue snapshot;
+        histogram.load(&snapshot);
+
+        NTCCFG_TEST_EQ(snapshot.count(), 3);
+        NTCCFG_TEST_EQ(snapshot.total(), 30);
+        NTCCFG_TEST_EQ(snapshot.minimum(), 0);
+        NTCCFG_TEST_EQ(snapshot.maximum(), 20);
+
+        histogram.load(&snapshot);
+        NTCCFG_TEST_EQ(snapshot.count(), 0);
+
+        for (bsl::size_t i = 0; i < 100; ++i) {
+            histogram.update(static_cast<double>(i));
+        }
+
+        bdld::DatumMutableArrayRef array;
+        bdld::Datum::createUninitializedArray(&array, 18, &ta);
+
+        bsl::size_t index = 0;
+        histogram.collectHistogram(&array, &index);
+        histogram.collectHistogram(&array, &index);
+
+        NTCCFG_TEST_EQ(index, 18);
+
+        NTCCFG_TEST_EQ(array.data()[0].theDouble(), 100);
+        NTCCFG_TEST_EQ(array.data()[2].theDouble(), 0);
+        NTCCFG_TEST_EQ(array.data()[4].theDouble(), 99);
+        NTCCFG_TEST_GE(array.data()[8].theDouble(),
+                       array.data()[7].theDouble());
+        NTCCFG_TEST_GE(array.data()[7].theDouble(),
+                       array.data()[6].theDouble());
+        NTCCFG_TEST_GE(array.data()[6].theDouble(),
+                       array.data()[5].theDouble());
+
+        for (bsl::size_t i = 9; i < 18; ++i) {
+            NTCCFG_TEST_TRUE(array.data()[i].isNull());
+        }
+
+        *array.length() = 18;
+
+        bdld::ManagedDatum managed(bdld::Datum::adoptArray(array), &ta);
+
+        ntci::MetricHistogram scaled(0.5, &ta);
+
+        scaled.update(2);
+        scaled.update(6);
+
+        bdld::DatumMutableArrayRef summary;
+        bdld::Datum::createUninitializedArray(&summary, 5, &ta);
+
+        index = 0;
+        scaled.collectSummary(&summary, &index);
+
+        NTCCFG_TEST_EQ(index, 5);
+
+        NTCCFG_TEST_EQ(summary.data()[0].theDouble(), 2);
+        NTCCFG_TEST_EQ(summary.data()[1].theDouble(), 4);
+        NTCCFG_TEST_EQ(summary.data()[2].theDouble(), 1);
+        NTCCFG_TEST_EQ(summary.data()[3].theDouble(), 2);
+        NTCCFG_TEST_EQ(summary.data()[4].theDouble(), 3);
+
+        *summary.length() = 5;
+
+        bdld::ManagedDatum managedSummary(bdld::Datum::adoptArray(summary),
+                                          &ta);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(4)
+{
+    // Concern: Sharded metrics aggregate the values recorded by each thread
+    // with the same semantics as unsharded metrics.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        ntci::MetricSharded single(1, &ta);
+        NTCCFG_TEST_EQ(single.numShards(), 1);
+        NTCCFG_TEST_EQ(ta.numBlocksInUse(), 0);
+
+        ntci::MetricSharded rounded(5, &ta);
+        NTCCFG_TEST_EQ(rounded.numShards(), 8);
+
+        ntci::MetricSharded clamped(1000, &ta);
+        NTCCFG_TEST_EQ(clamped.numShards(), ntci::MetricSharded::k_MAX_SHARDS);
+
+        ntci::MetricSharded metric(&ta);
+        NTCCFG_TEST_EQ(metric.numShards(),
+                       ntci::MetricSharded::k_DEFAULT_SHARDS);
+
+        ntci::MetricValue value;
+
+        metric.load(&value);
+        NTCCFG_TEST_EQ(value.count(), 0);
+
+        metric.update(3);
+        metric.update(1);
+        metric.update(2);
+
+        metric.load(&value);
+        NTCCFG_TEST_EQ(value.count(), 3);
+        NTCCFG_TEST_EQ(value.total(), 6);
+        NTCCFG_TEST_EQ(value.minimum(), 1);
+        NTCCFG_TEST_EQ(value.maximum(), 3);
+        NTCCFG_TEST_EQ(value.last(), 2);
+
+        metric.load(&value);
+        NTCCFG_TEST_EQ(value.count(), 0);
+
+        const bsl::size_t k_NUM_THREADS = 8;
+        const bsl::size_t k_NUM_VALUES  = 10000;
+
+        bslmt::Barrier barrier(k_NUM_THREADS);
+
+        bslmt::ThreadGroup threadGroup(&ta);
+        for (bsl::size_t i = 0; i < k_NUM_THREADS; ++i) {
+            threadGroup.addThread(bdlf::BindUtil::bind(
+                &test::work,
+                &metric,
+                &barrier,
+                k_NUM_VALUES,
+                static_cast<double>(i + 1)));
+        }
+
+        threadGroup.joinAll();
+
+        metric.load(&value);
+
+        NTCCFG_TEST_EQ(value.count(), k_NUM_THREADS * k_NUM_VALUES);
+        NTCCFG_TEST_EQ(value.total(),
+                       (k_NUM_VALUES * (k_NUM_VALUES + 1) / 2) *
+                           (k_NUM_THREADS * (k_NUM_THREADS + 1) / 2));
+        NTCCFG_TEST_EQ(value.minimum(), 1);
+        NTCCFG_TEST_EQ(value.maximum(),
+                       static_cast<double>(k_NUM_VALUES * k_NUM_THREADS));
+
+        metric.update(42);
+        metric.load(&value);
+        NTCCFG_TEST_EQ(value.count(), 1);
+        NTCCFG_TEST_EQ(value.last(), 42);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+    NTCCFG_TEST_REGISTER(3);
+    NTCCFG_TEST_REGISTER(4);
 }
 NTCCFG_TEST_DRIVER_END;
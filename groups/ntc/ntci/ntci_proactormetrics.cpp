@@ -25,5 +25,10 @@ ProactorMetrics::~ProactorMetrics()
 {
 }
 
+void ProactorMetrics::logTimerLag(const bsls::TimeInterval& lag)
+{
+    NTCCFG_WARNING_UNUSED(lag);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -71,6 +71,11 @@ class ProactorMetrics : public ntci::Monitorable
     /// Log the specified 'duration' in the function to process a readable
     /// socket.
     virtual void logErrorCallback(const bsls::TimeInterval& duration) = 0;
+
+    /// Log the specified 'lag' between the deadline of the earliest timer
+    /// due and the time the timer was announced by the proactor thread. Note
+    /// that the default implementation of this function has no effect.
+    virtual void logTimerLag(const bsls::TimeInterval& lag);
 };
 
 #if NTC_BUILD_WITH_METRICS
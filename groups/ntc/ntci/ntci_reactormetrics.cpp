@@ -25,5 +25,10 @@ ReactorMetrics::~ReactorMetrics()
 {
 }
 
+void ReactorMetrics::logTimerLag(const bsls::TimeInterval& lag)
+{
+    NTCCFG_WARNING_UNUSED(lag);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
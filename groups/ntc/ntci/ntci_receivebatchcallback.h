@@ -0,0 +1,59 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCI_RECEIVEBATCHCALLBACK
+#define INCLUDED_NTCI_RECEIVEBATCHCALLBACK
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntca_receiveevent.h>
+#include <ntccfg_platform.h>
+#include <ntci_callback.h>
+#include <ntci_receiveresult.h>
+#include <ntcscm_version.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ntci {
+class Receiver;
+}
+namespace ntci {
+
+/// Define a type alias for callback invoked on a optional
+/// strand with an optional cancelable authorization mechanism when a
+/// batch receive operation completes or fails. On completion, each result
+/// describes one message, in the order the messages were received, and the
+/// event describes the completion of the batch as a whole. On failure, the
+/// results are empty. Note that the receiver of each result is not set, to
+/// avoid the cost of copying it for each message; the receiver is the first
+/// argument to the callback.
+///
+/// @ingroup module_ntci_operation_receive
+typedef ntci::Callback<void(
+    const bsl::shared_ptr<ntci::Receiver>&  receiver,
+    const bsl::vector<ntci::ReceiveResult>& results,
+    const ntca::ReceiveEvent&               event)>
+    ReceiveBatchCallback;
+
+/// Define a type alias for function invoked when a batch receive
+/// operation completes or fails.
+///
+/// @ingroup module_ntci_operation_receive
+typedef ReceiveBatchCallback::FunctionType ReceiveBatchFunction;
+
+}  // end namespace ntci
+}  // end namespace BloombergLP
+#endif
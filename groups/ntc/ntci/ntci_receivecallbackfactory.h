@@ -21,6 +21,7 @@ BSLS_IDENT("$Id: $")
 
 #include <ntccfg_platform.h>
 #include <ntci_authorization.h>
+#include <ntci_receivebatchcallback.h>
 #include <ntci_receivecallback.h>
 #include <ntci_strand.h>
 #include <ntcscm_version.h>
@@ -85,6 +86,25 @@ class ReceiveCallbackFactory
         const bsl::shared_ptr<ntci::Strand>&        strand,
         bslma::Allocator*                           basicAllocator = 0);
 
+    /// Create a new batch receive callback to invoke the specified
+    /// 'function' with no cancellable authorization mechanism on this
+    /// object's strand. Optionally specify a  'basicAllocator' used to supply
+    /// memory. If 'basicAllocator' is 0, the currently installed default
+    /// allocator is used.
+    ntci::ReceiveBatchCallback createReceiveBatchCallback(
+        const ntci::ReceiveBatchFunction& function,
+        bslma::Allocator*                 basicAllocator = 0);
+
+    /// Create a new batch receive callback to invoke the specified
+    /// 'function' with no cancellable authorization mechanism on the
+    /// specified 'strand'. Optionally specify a  'basicAllocator' used to
+    /// supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used.
+    ntci::ReceiveBatchCallback createReceiveBatchCallback(
+        const ntci::ReceiveBatchFunction&    function,
+        const bsl::shared_ptr<ntci::Strand>& strand,
+        bslma::Allocator*                    basicAllocator = 0);
+
     /// Return the strand on which this object's functions should be called.
     virtual const bsl::shared_ptr<ntci::Strand>& strand() const = 0;
 };
@@ -131,6 +151,25 @@ ntci::ReceiveCallback ReceiveCallbackFactory::createReceiveCallback(
                                  basicAllocator);
 }
 
+NTCCFG_INLINE
+ntci::ReceiveBatchCallback ReceiveCallbackFactory::createReceiveBatchCallback(
+    const ntci::ReceiveBatchFunction& function,
+    bslma::Allocator*                 basicAllocator)
+{
+    return ntci::ReceiveBatchCallback(function,
+                                      this->strand(),
+                                      basicAllocator);
+}
+
+NTCCFG_INLINE
+ntci::ReceiveBatchCallback ReceiveCallbackFactory::createReceiveBatchCallback(
+    const ntci::ReceiveBatchFunction&    function,
+    const bsl::shared_ptr<ntci::Strand>& strand,
+    bslma::Allocator*                    basicAllocator)
+{
+    return ntci::ReceiveBatchCallback(function, strand, basicAllocator);
+}
+
 }  // end namespace ntci
 }  // end namespace BloombergLP
 #endif
@@ -0,0 +1,67 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCI_RECEIVEFRAMER
+#define INCLUDED_NTCI_RECEIVEFRAMER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntccfg_platform.h>
+#include <ntcscm_version.h>
+#include <ntsa_error.h>
+#include <bdlbb_blob.h>
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace ntci {
+
+/// Provide an interface to detect the boundaries of messages in a stream.
+///
+/// @details
+/// A stream socket consults its receive framer each time data is available
+/// in its read queue to determine whether the read queue begins with a
+/// complete message. When it does, the socket removes the entire message
+/// from the read queue, discards the prefix and suffix of the message
+/// identified by the framer, and delivers the remaining bytes to the user as
+/// a single blob.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntci_operation_receive
+class ReceiveFramer
+{
+  public:
+    /// Destroy this object.
+    virtual ~ReceiveFramer();
+
+    /// Load into the specified 'size' the number of bytes of the first
+    /// complete message at the front of the specified 'data', including its
+    /// framing, and load into the specified 'prefix' and 'suffix' the number
+    /// of bytes at the beginning and end, respectively, of that message that
+    /// should not be delivered to the user. Return the error. Note that an
+    /// error of 'ntsa::Error::e_WOULD_BLOCK' indicates that 'data' does not
+    /// yet contain a complete message, and any other error indicates that
+    /// 'data' is malformed and the stream cannot be framed.
+    virtual ntsa::Error frame(bsl::size_t*       size,
+                              bsl::size_t*       prefix,
+                              bsl::size_t*       suffix,
+                              const bdlbb::Blob& data) = 0;
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
@@ -34,6 +34,56 @@ ntsa::Error StreamSocket::setZeroCopyThreshold(bsl::size_t value)
     return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
 }
 
+ntsa::Error StreamSocket::setReceiveFramer(
+    const bsl::shared_ptr<ntci::ReceiveFramer>& framer)
+{
+    NTCCFG_WARNING_UNUSED(framer);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::receiveBatch(
+    const ntca::ReceiveOptions&       options,
+    const ntci::ReceiveBatchFunction& callback)
+{
+    NTCCFG_WARNING_UNUSED(options);
+    NTCCFG_WARNING_UNUSED(callback);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::receiveBatch(
+    const ntca::ReceiveOptions&       options,
+    const ntci::ReceiveBatchCallback& callback)
+{
+    NTCCFG_WARNING_UNUSED(options);
+    NTCCFG_WARNING_UNUSED(callback);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::receive(const ntca::ReceiveOptions&     options,
+                                  const ntsa::MutableBufferArray& buffers,
+                                  const ntci::ReceiveFunction&    callback)
+{
+    NTCCFG_WARNING_UNUSED(options);
+    NTCCFG_WARNING_UNUSED(buffers);
+    NTCCFG_WARNING_UNUSED(callback);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::receive(const ntca::ReceiveOptions&     options,
+                                  const ntsa::MutableBufferArray& buffers,
+                                  const ntci::ReceiveCallback&    callback)
+{
+    NTCCFG_WARNING_UNUSED(options);
+    NTCCFG_WARNING_UNUSED(buffers);
+    NTCCFG_WARNING_UNUSED(callback);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
 ntsa::Error StreamSocket::timestampOutgoingData(bool enable)
 {
     NTCCFG_WARNING_UNUSED(enable);
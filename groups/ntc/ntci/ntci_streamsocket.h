@@ -43,8 +43,10 @@ BSLS_IDENT("$Id: $")
 #include <ntci_executor.h>
 #include <ntci_listenersocket.h>
 #include <ntci_ratelimiter.h>
+#include <ntci_receivebatchcallback.h>
 #include <ntci_receivecallback.h>
 #include <ntci_receivecallbackfactory.h>
+#include <ntci_receiveframer.h>
 #include <ntci_receiver.h>
 #include <ntci_resolver.h>
 #include <ntci_sendcallback.h>
@@ -1424,6 +1426,74 @@ class StreamSocket : public ntsi::Descriptor,
     virtual ntsa::Error receive(const ntca::ReceiveOptions&  options,
                                 const ntci::ReceiveCallback& callback) = 0;
 
+    /// Dequeue up to the maximum number of messages defined by the specified
+    /// 'options' from the read queue and invoke the specified 'callback' once
+    /// with all of them, as soon as at least one message is available. The
+    /// total size of the messages in the batch is limited by the maximum size
+    /// defined by 'options', except that the first message is always
+    /// delivered. Each message is defined by the framer of the operation or of
+    /// this socket, or, when neither is defined, is all the data in the read
+    /// queue. Return the error. Note that callbacks created by this object
+    /// will automatically be invoked on this object's strand unless an
+    /// explicit strand is specified at the time the callback is created. Note
+    /// that the default implementation of this function returns
+    /// 'ntsa::Error::e_NOT_IMPLEMENTED'.
+    virtual ntsa::Error receiveBatch(
+        const ntca::ReceiveOptions&       options,
+        const ntci::ReceiveBatchFunction& callback);
+
+    /// Dequeue up to the maximum number of messages defined by the specified
+    /// 'options' from the read queue and invoke the specified 'callback' once
+    /// with all of them, as soon as at least one message is available. The
+    /// total size of the messages in the batch is limited by the maximum size
+    /// defined by 'options', except that the first message is always
+    /// delivered. Each message is defined by the framer of the operation or of
+    /// this socket, or, when neither is defined, is all the data in the read
+    /// queue. Return the error. Note that callbacks created by this object
+    /// will automatically be invoked on this object's strand unless an
+    /// explicit strand is specified at the time the callback is created. Note
+    /// that the default implementation of this function returns
+    /// 'ntsa::Error::e_NOT_IMPLEMENTED'.
+    virtual ntsa::Error receiveBatch(
+        const ntca::ReceiveOptions&       options,
+        const ntci::ReceiveBatchCallback& callback);
+
+    /// Dequeue received data according to the specified 'options' by
+    /// copying it into the memory referenced by the specified 'buffers',
+    /// then invoke the specified 'callback' with a null blob and an event
+    /// whose context describes the number of bytes received. If the read
+    /// queue is empty when the socket becomes readable, the data is copied
+    /// directly from the socket receive buffer into 'buffers', without first
+    /// being copied into the read queue. The maximum size of the operation
+    /// is limited to the capacity of 'buffers'. The memory referenced by
+    /// 'buffers' must remain valid until the 'callback' is invoked. Return
+    /// the error. Note that callbacks created by this object will
+    /// automatically be invoked on this object's strand unless an explicit
+    /// strand is specified at the time the callback is created. Note that
+    /// the default implementation of this function returns
+    /// 'ntsa::Error::e_NOT_IMPLEMENTED'.
+    virtual ntsa::Error receive(const ntca::ReceiveOptions&     options,
+                                const ntsa::MutableBufferArray& buffers,
+                                const ntci::ReceiveFunction&    callback);
+
+    /// Dequeue received data according to the specified 'options' by
+    /// copying it into the memory referenced by the specified 'buffers',
+    /// then invoke the specified 'callback' with a null blob and an event
+    /// whose context describes the number of bytes received. If the read
+    /// queue is empty when the socket becomes readable, the data is copied
+    /// directly from the socket receive buffer into 'buffers', without first
+    /// being copied into the read queue. The maximum size of the operation
+    /// is limited to the capacity of 'buffers'. The memory referenced by
+    /// 'buffers' must remain valid until the 'callback' is invoked. Return
+    /// the error. Note that callbacks created by this object will
+    /// automatically be invoked on this object's strand unless an explicit
+    /// strand is specified at the time the callback is created. Note that
+    /// the default implementation of this function returns
+    /// 'ntsa::Error::e_NOT_IMPLEMENTED'.
+    virtual ntsa::Error receive(const ntca::ReceiveOptions&     options,
+                                const ntsa::MutableBufferArray& buffers,
+                                const ntci::ReceiveCallback&    callback);
+
     /// Register the specified 'resolver' for this socket to be used when
     /// a domain name or service name needs to be resolved when binding
     /// or connecting. Return the error.
@@ -1467,6 +1537,14 @@ class StreamSocket : public ntsi::Descriptor,
     /// to attempt a zero-copy send to the specified 'value'. Return the error.
     virtual ntsa::Error setZeroCopyThreshold(bsl::size_t value);
 
+    /// Set the framer used to detect the boundaries of messages in the
+    /// incoming data when the options of a receive operation do not define
+    /// their own framer to the specified 'framer'. If 'framer' is null, the
+    /// incoming data is only framed according to the options of each receive
+    /// operation. Return the error.
+    virtual ntsa::Error setReceiveFramer(
+        const bsl::shared_ptr<ntci::ReceiveFramer>& framer);
+
     /// Set the write rate limiter to the specified 'rateLimiter'. Return
     /// the error.
     virtual ntsa::Error setWriteRateLimiter(
@@ -0,0 +1,414 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcm_openmetricspublisher.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntcm_openmetricspublisher_cpp, "$Id$ $CSID$")
+
+#include <bdlbb_blobutil.h>
+#include <bdld_datum.h>
+#include <bslmt_lockguard.h>
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bsls_assert.h>
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstring.h>
+#include <bsl_limits.h>
+
+namespace BloombergLP {
+namespace ntcm {
+
+namespace {
+
+/// The prefix of the name of each metric family.
+const char k_FAMILY_PREFIX[] = "ntf_";
+
+/// The marker that terminates each exposition.
+const char k_EOF[] = "# EOF\n";
+
+/// The initial capacity of the rendering buffers, in bytes.
+const bsl::size_t k_DEFAULT_CAPACITY = 64 * 1024;
+
+/// Append the specified 'length' number of bytes at the specified 'text' to
+/// the specified 'buffer'.
+void append(bsl::vector<char>* buffer, const char* text, bsl::size_t length)
+{
+    buffer->insert(buffer->end(), text, text + length);
+}
+
+/// Append the specified null-terminated 'text' to the specified 'buffer'.
+void append(bsl::vector<char>* buffer, const char* text)
+{
+    append(buffer, text, bsl::strlen(text));
+}
+
+/// Append the specified 'text' to the specified 'buffer' as a fragment of a
+/// metric family name: convert camel case to snake case and replace each
+/// character that is not valid in a metric name with an underscore,
+/// collapsing runs of such characters.
+void appendName(bsl::vector<char>* buffer, const char* text)
+{
+    char previous = 0;
+
+    for (const char* current = text; *current != 0; ++current) {
+        const char ch = *current;
+
+        if (ch >= 'A' && ch <= 'Z') {
+            if ((previous >= 'a' && previous <= 'z') ||
+                (previous >= '0' && previous <= '9'))
+            {
+                buffer->push_back('_');
+            }
+            buffer->push_back(static_cast<char>(ch - 'A' + 'a'));
+        }
+        else if ((ch >= 'a' && ch <= 'z') || (ch >= '0' && ch <= '9')) {
+            buffer->push_back(ch);
+        }
+        else if (!buffer->empty() && buffer->back() != '_') {
+            buffer->push_back('_');
+        }
+
+        previous = ch;
+    }
+}
+
+/// Append the specified 'text' to the specified 'buffer', escaping
+/// backslashes and newlines and, if the specified 'quoted' flag is true,
+/// double quotes.
+void appendEscaped(bsl::vector<char>* buffer, const char* text, bool quoted)
+{
+    for (const char* current = text; *current != 0; ++current) {
+        const char ch = *current;
+
+        if (ch == '\\') {
+            append(buffer, "\\\\", 2);
+        }
+        else if (ch == '\n') {
+            append(buffer, "\\n", 2);
+        }
+        else if (ch == '"' && quoted) {
+            append(buffer, "\\\"", 2);
+        }
+        else {
+            buffer->push_back(ch);
+        }
+    }
+}
+
+/// Append the specified 'value' to the specified 'buffer' formatted as an
+/// OpenMetrics number.
+void appendValue(bsl::vector<char>* buffer, double value)
+{
+    if (value != value) {
+        append(buffer, "NaN", 3);
+    }
+    else if (value == bsl::numeric_limits<double>::infinity()) {
+        append(buffer, "+Inf", 4);
+    }
+    else if (value == -bsl::numeric_limits<double>::infinity()) {
+        append(buffer, "-Inf", 4);
+    }
+    else {
+        char text[32];
+        int  length = bsl::snprintf(text, sizeof text, "%.15g", value);
+        if (length > 0) {
+            append(buffer, text, static_cast<bsl::size_t>(length));
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+class OpenMetricsPublisher::SampleSorter
+{
+    const char* d_arena_p;
+
+  public:
+    /// Create a new sample sorter for samples whose text is stored in the
+    /// specified 'arena'.
+    explicit SampleSorter(const char* arena)
+    : d_arena_p(arena)
+    {
+    }
+
+    /// Return true if the specified 'lhs' should be ordered before the
+    /// specified 'rhs', otherwise return false.
+    bool operator()(const Sample& lhs, const Sample& rhs) const
+    {
+        const bsl::size_t length = bsl::min(lhs.d_familyLength,
+                                            rhs.d_familyLength);
+
+        const int comparison =
+            bsl::memcmp(d_arena_p + lhs.d_familyOffset,
+                        d_arena_p + rhs.d_familyOffset,
+                        length);
+        if (comparison != 0) {
+            return comparison < 0;
+        }
+
+        if (lhs.d_familyLength != rhs.d_familyLength) {
+            return lhs.d_familyLength < rhs.d_familyLength;
+        }
+
+        return lhs.d_sequence < rhs.d_sequence;
+    }
+};
+
+void OpenMetricsPublisher::render()
+{
+    d_pending.clear();
+
+    if (!d_samples.empty()) {
+        bsl::sort(d_samples.begin(),
+                  d_samples.end(),
+                  SampleSorter(d_arena.data()));
+    }
+
+    const char* arena = d_arena.data();
+
+    const Sample* previous = 0;
+
+    for (SampleVector::const_iterator it = d_samples.begin();
+         it != d_samples.end();
+         ++it)
+    {
+        const Sample& sample = *it;
+
+        const char* family = arena + sample.d_familyOffset;
+
+        if (previous == 0 ||
+            previous->d_familyLength != sample.d_familyLength ||
+            bsl::memcmp(arena + previous->d_familyOffset,
+                        family,
+                        sample.d_familyLength) != 0)
+        {
+            append(&d_pending, "# TYPE ");
+            append(&d_pending, family, sample.d_familyLength);
+            append(&d_pending, " gauge\n");
+
+            if (sample.d_helpLength > 0) {
+                append(&d_pending, "# HELP ");
+                append(&d_pending, family, sample.d_familyLength);
+                d_pending.push_back(' ');
+                append(&d_pending,
+                       arena + sample.d_helpOffset,
+                       sample.d_helpLength);
+                d_pending.push_back('\n');
+            }
+
+            previous = &sample;
+        }
+
+        append(&d_pending, family, sample.d_familyLength);
+        d_pending.push_back('{');
+        append(&d_pending, arena + sample.d_labelOffset, sample.d_labelLength);
+        append(&d_pending, "} ");
+        appendValue(&d_pending, sample.d_value);
+        d_pending.push_back('\n');
+    }
+
+    append(&d_pending, k_EOF);
+
+    d_arena.clear();
+    d_samples.clear();
+}
+
+OpenMetricsPublisher::OpenMetricsPublisher(bslma::Allocator* basicAllocator)
+: d_mutex()
+, d_arena(basicAllocator)
+, d_samples(basicAllocator)
+, d_pending(basicAllocator)
+, d_currentMutex()
+, d_current(basicAllocator)
+, d_currentTime()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_arena.reserve(k_DEFAULT_CAPACITY);
+    d_pending.reserve(k_DEFAULT_CAPACITY);
+    d_current.reserve(k_DEFAULT_CAPACITY);
+
+    append(&d_current, k_EOF);
+}
+
+OpenMetricsPublisher::OpenMetricsPublisher(bsl::size_t       capacity,
+                                           bslma::Allocator* basicAllocator)
+: d_mutex()
+, d_arena(basicAllocator)
+, d_samples(basicAllocator)
+, d_pending(basicAllocator)
+, d_currentMutex()
+, d_current(basicAllocator)
+, d_currentTime()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_arena.reserve(capacity);
+    d_pending.reserve(capacity);
+    d_current.reserve(capacity);
+
+    append(&d_current, k_EOF);
+}
+
+OpenMetricsPublisher::~OpenMetricsPublisher()
+{
+}
+
+void OpenMetricsPublisher::publish(
+    const bsl::shared_ptr<ntci::Monitorable>& monitorable,
+    const bdld::Datum&                        statistics,
+    const bsls::TimeInterval&                 time,
+    bool                                      final)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    // Ensure the monitorable object reports its statistics as an array.
+
+    if (statistics.isArray()) {
+        // Render the labels shared by every sample measured by the
+        // monitorable object.
+
+        const bsl::size_t labelOffset = d_arena.size();
+
+        const char* objectName = monitorable->objectName();
+        if (objectName != 0 && objectName[0] != 0) {
+            append(&d_arena, "object=\"");
+            appendEscaped(&d_arena, objectName, true);
+            append(&d_arena, "\",");
+        }
+
+        {
+            char text[32];
+            int  length = bsl::snprintf(text,
+                                       sizeof text,
+                                       "id=\"%d\"",
+                                       monitorable->objectId().value());
+            if (length > 0) {
+                append(&d_arena, text, static_cast<bsl::size_t>(length));
+            }
+        }
+
+        const bsl::size_t labelLength = d_arena.size() - labelOffset;
+
+        // For each statistic retrieved from the monitorable object...
+
+        const bdld::DatumArrayRef array = statistics.theArray();
+
+        for (int fieldOrdinal = 0;
+             fieldOrdinal < static_cast<int>(array.length());
+             ++fieldOrdinal)
+        {
+            // Determine the datapoint value for this statistic, skipping
+            // nulls, which represent a statistic with no measured value
+            // during this interval.
+
+            const bdld::Datum& datum = array.data()[fieldOrdinal];
+
+            double value = 0.0;
+
+            if (datum.isDouble()) {
+                value = datum.theDouble();
+            }
+            else if (datum.isInteger64()) {
+                value = static_cast<double>(datum.theInteger64());
+            }
+            else if (datum.isInteger()) {
+                value = static_cast<double>(datum.theInteger());
+            }
+            else {
+                continue;
+            }
+
+            const char* fieldName = monitorable->getFieldName(fieldOrdinal);
+            if (fieldName == 0 || fieldName[0] == 0) {
+                continue;
+            }
+
+            Sample sample;
+
+            sample.d_familyOffset = d_arena.size();
+            append(&d_arena, k_FAMILY_PREFIX);
+
+            const char* fieldPrefix =
+                monitorable->getFieldPrefix(fieldOrdinal);
+            if (fieldPrefix != 0 && fieldPrefix[0] != 0) {
+                appendName(&d_arena, fieldPrefix);
+                if (d_arena.back() != '_') {
+                    d_arena.push_back('_');
+                }
+            }
+
+            appendName(&d_arena, fieldName);
+            if (d_arena.back() == '_') {
+                d_arena.pop_back();
+            }
+
+            sample.d_familyLength = d_arena.size() - sample.d_familyOffset;
+
+            sample.d_helpOffset = d_arena.size();
+
+            const char* fieldDescription =
+                monitorable->getFieldDescription(fieldOrdinal);
+            if (fieldDescription != 0) {
+                appendEscaped(&d_arena, fieldDescription, false);
+            }
+
+            sample.d_helpLength = d_arena.size() - sample.d_helpOffset;
+
+            sample.d_labelOffset = labelOffset;
+            sample.d_labelLength = labelLength;
+            sample.d_sequence    = d_samples.size();
+            sample.d_value       = value;
+
+            d_samples.push_back(sample);
+        }
+    }
+
+    if (final) {
+        this->render();
+
+        bslmt::LockGuard<bslmt::Mutex> currentGuard(&d_currentMutex);
+        d_current.swap(d_pending);
+        d_currentTime = time;
+    }
+}
+
+void OpenMetricsPublisher::load(bsl::string* result) const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_currentMutex);
+    result->assign(d_current.begin(), d_current.end());
+}
+
+void OpenMetricsPublisher::load(bdlbb::Blob* result) const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_currentMutex);
+    bdlbb::BlobUtil::append(result,
+                            d_current.data(),
+                            static_cast<int>(d_current.size()));
+}
+
+bsls::TimeInterval OpenMetricsPublisher::time() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_currentMutex);
+    return d_currentTime;
+}
+
+const char* OpenMetricsPublisher::contentType()
+{
+    return "application/openmetrics-text; version=1.0.0; charset=utf-8";
+}
+
+}  // close package namespace
+}  // close enterprise namespace
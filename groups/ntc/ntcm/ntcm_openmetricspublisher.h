@@ -0,0 +1,155 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCM_OPENMETRICSPUBLISHER
+#define INCLUDED_NTCM_OPENMETRICSPUBLISHER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntci_monitorable.h>
+#include <ntcscm_version.h>
+#include <bdlbb_blob.h>
+#include <bslmt_mutex.h>
+#include <bsls_keyword.h>
+#include <bsls_timeinterval.h>
+#include <bsl_cstddef.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ntcm {
+
+/// @internal @brief
+/// Provide a metrics publisher to the OpenMetrics text exposition format.
+///
+/// @details
+/// Each sample of statistics published to this object is rendered into the
+/// OpenMetrics text format, suitable for scraping by Prometheus or any other
+/// OpenMetrics-compatible collector. Statistics published between two
+/// consecutive samples marked 'final' are accumulated and then rendered as a
+/// single exposition, grouped by metric family, which atomically replaces the
+/// exposition previously rendered. The most recent exposition may be loaded
+/// at any time.
+///
+/// The name of each metric family is formed from the field prefix and field
+/// name of the statistic, converted to snake case, and prefixed by "ntf_".
+/// Each sample is labeled by the name and identifier of the monitorable
+/// object that measured it. Since monitorable objects report statistics
+/// measured over the collection interval, every metric family is exposed as a
+/// gauge.
+///
+/// All text is rendered into buffers owned by this object that are reused
+/// from one sample to the next, so once those buffers have grown to the size
+/// required by the set of registered monitorable objects, publication does
+/// not allocate memory.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntcm
+class OpenMetricsPublisher : public ntci::MonitorablePublisher
+{
+    /// Describe a single sample of a metric family, referring to text
+    /// stored in the arena of the publisher.
+    struct Sample {
+        bsl::size_t d_familyOffset;
+        bsl::size_t d_familyLength;
+        bsl::size_t d_labelOffset;
+        bsl::size_t d_labelLength;
+        bsl::size_t d_helpOffset;
+        bsl::size_t d_helpLength;
+        bsl::size_t d_sequence;
+        double      d_value;
+    };
+
+    /// Provide a function to order samples by metric family and then
+    /// by the order in which they were published.
+    class SampleSorter;
+
+    /// Define a type alias for a vector of samples.
+    typedef bsl::vector<Sample> SampleVector;
+
+    /// Define a type alias for a buffer of text.
+    typedef bsl::vector<char> Buffer;
+
+    bslmt::Mutex         d_mutex;
+    Buffer               d_arena;
+    SampleVector         d_samples;
+    Buffer               d_pending;
+    mutable bslmt::Mutex d_currentMutex;
+    Buffer               d_current;
+    bsls::TimeInterval   d_currentTime;
+    bslma::Allocator*    d_allocator_p;
+
+  private:
+    OpenMetricsPublisher(const OpenMetricsPublisher&) BSLS_KEYWORD_DELETED;
+    OpenMetricsPublisher& operator=(const OpenMetricsPublisher&)
+        BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Render the accumulated samples into the pending buffer.
+    void render();
+
+  public:
+    /// Create a new OpenMetrics publisher. Optionally specify a
+    /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0, the
+    /// currently installed default allocator is used.
+    explicit OpenMetricsPublisher(bslma::Allocator* basicAllocator = 0);
+
+    /// Create a new OpenMetrics publisher whose rendering buffers are
+    /// initially reserved to hold at least the specified 'capacity' number
+    /// of bytes. Optionally specify a 'basicAllocator' used to supply
+    /// memory. If 'basicAllocator' is 0, the currently installed default
+    /// allocator is used.
+    explicit OpenMetricsPublisher(bsl::size_t       capacity,
+                                  bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    virtual ~OpenMetricsPublisher();
+
+    /// Publish the specified 'statistics' collected from the specified
+    /// 'monitorable' object at the specified 'time'. If the specified
+    /// 'final' flag is true, these 'statistics' are the final statistics
+    /// collected during the same sample at the 'time'.
+    virtual void publish(const bsl::shared_ptr<ntci::Monitorable>& monitorable,
+                         const bdld::Datum&                        statistics,
+                         const bsls::TimeInterval&                 time,
+                         bool                                      final);
+
+    /// Load into the specified 'result' the most recently rendered
+    /// exposition. Note that the exposition is always terminated by the
+    /// "# EOF" marker, even if no sample has yet been completed.
+    void load(bsl::string* result) const;
+
+    /// Append to the specified 'result' the most recently rendered
+    /// exposition. Note that the exposition is always terminated by the
+    /// "# EOF" marker, even if no sample has yet been completed.
+    void load(bdlbb::Blob* result) const;
+
+    /// Return the time of the sample from which the most recent exposition
+    /// was rendered, or the default value if no sample has yet been
+    /// completed.
+    bsls::TimeInterval time() const;
+
+    /// Return the content type of the exposition, suitable for the value of
+    /// an HTTP "Content-Type" header.
+    static const char* contentType();
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
@@ -0,0 +1,344 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcm_openmetricspublisher.h>
+
+#include <ntccfg_test.h>
+
+#include <ntci_monitorable.h>
+
+#include <bdld_datum.h>
+#include <bdld_manageddatum.h>
+#include <bslma_testallocator.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_cstring.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+//
+//-----------------------------------------------------------------------------
+
+// [ 1]
+// [ 2]
+//-----------------------------------------------------------------------------
+// [ 1]
+// [ 2]
+//-----------------------------------------------------------------------------
+
+namespace test {
+
+/// This class implements the 'ntci::Monitorable' interface for use by this
+/// test driver.
+class Object : public ntci::Monitorable
+{
+    bsl::string d_name;
+    double      d_count;
+    double      d_latency;
+
+    static struct StatisticMetadata {
+        const char*                      prefix;
+        const char*                      name;
+        const char*                      description;
+        ntci::Monitorable::StatisticType type;
+    } STATISTICS[];
+
+  private:
+    Object(const Object&) BSLS_KEYWORD_DELETED;
+    Object& operator=(const Object&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new object having the specified 'name' that reports the
+    /// specified 'count' and 'latency'.
+    Object(const bsl::string& name, double count, double latency);
+
+    /// Destroy this object.
+    ~Object() BSLS_KEYWORD_OVERRIDE;
+
+    /// Load into the specified 'result' the array of statistics for this
+    /// object.
+    void getStats(bdld::ManagedDatum* result) BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the prefix corresponding to the field at the specified
+    /// 'ordinal' position, or 0 if no field at the 'ordinal' position
+    /// exists.
+    const char* getFieldPrefix(int ordinal) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the field name corresponding to the field at the specified
+    /// 'ordinal' position, or 0 if no field at the 'ordinal' position
+    /// exists.
+    const char* getFieldName(int ordinal) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the field description corresponding to the field at the
+    /// specified 'ordinal' position, or 0 if no field at the 'ordinal'
+    /// position exists.
+    const char* getFieldDescription(int ordinal) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the type of the statistic at the specified 'ordinal'
+    /// position, or e_AVERAGE if no field at the 'ordinal' position exists
+    /// or the type is unknown.
+    StatisticType getFieldType(int ordinal) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the flags that indicate which indexes to apply to the
+    /// statistics measured by this monitorable object.
+    int getFieldTags(int ordinal) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the ordinal of the specified 'fieldName', or a negative value
+    /// if no field identified by 'fieldName' exists.
+    int getFieldOrdinal(const char* fieldName) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the maximum number of elements in a datum resulting from
+    /// a call to 'getStats()'.
+    int numOrdinals() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the human-readable name of the monitorable object.
+    const char* objectName() const BSLS_KEYWORD_OVERRIDE;
+};
+
+Object::StatisticMetadata Object::STATISTICS[] = {
+    {"test.object",
+     "requestCount",
+     "Number of requests",
+     ntci::Monitorable::e_SUM},
+    {"test.object",
+     "latency.p99",
+     "Request latency\nin microseconds",
+     ntci::Monitorable::e_MAXIMUM},
+    {"test.object", "unmeasured", "Never measured", ntci::Monitorable::e_SUM}
+};
+
+Object::Object(const bsl::string& name, double count, double latency)
+: d_name(name)
+, d_count(count)
+, d_latency(latency)
+{
+}
+
+Object::~Object()
+{
+}
+
+void Object::getStats(bdld::ManagedDatum* result)
+{
+    bdld::DatumMutableArrayRef array;
+    bdld::Datum::createUninitializedArray(&array, 3, result->allocator());
+
+    array.data()[0] = bdld::Datum::createInteger64(
+        static_cast<bsls::Types::Int64>(d_count),
+        result->allocator());
+    array.data()[1] = bdld::Datum::createDouble(d_latency);
+    array.data()[2] = bdld::Datum::createNull();
+
+    *array.length() = 3;
+
+    result->adopt(bdld::Datum::adoptArray(array));
+}
+
+const char* Object::getFieldPrefix(int ordinal) const
+{
+    if (ordinal >= 0 && ordinal < numOrdinals()) {
+        return Object::STATISTICS[ordinal].prefix;
+    }
+
+    return 0;
+}
+
+const char* Object::getFieldName(int ordinal) const
+{
+    if (ordinal >= 0 && ordinal < numOrdinals()) {
+        return Object::STATISTICS[ordinal].name;
+    }
+
+    return 0;
+}
+
+const char* Object::getFieldDescription(int ordinal) const
+{
+    if (ordinal >= 0 && ordinal < numOrdinals()) {
+        return Object::STATISTICS[ordinal].description;
+    }
+
+    return 0;
+}
+
+ntci::Monitorable::StatisticType Object::getFieldType(int ordinal) const
+{
+    if (ordinal >= 0 && ordinal < numOrdinals()) {
+        return Object::STATISTICS[ordinal].type;
+    }
+
+    return ntci::Monitorable::e_AVERAGE;
+}
+
+int Object::getFieldTags(int ordinal) const
+{
+    NTCCFG_WARNING_UNUSED(ordinal);
+    return ntci::Monitorable::e_ANONYMOUS;
+}
+
+int Object::getFieldOrdinal(const char* fieldName) const
+{
+    for (int ordinal = 0; ordinal < numOrdinals(); ++ordinal) {
+        if (bsl::strcmp(Object::STATISTICS[ordinal].name, fieldName) == 0) {
+            return ordinal;
+        }
+    }
+
+    return -1;
+}
+
+int Object::numOrdinals() const
+{
+    return sizeof Object::STATISTICS / sizeof Object::STATISTICS[0];
+}
+
+const char* Object::objectName() const
+{
+    return d_name.c_str();
+}
+
+/// Publish the statistics of the specified 'objectA' and 'objectB' as a
+/// single sample to the specified 'publisher' at the specified 'time'.
+void publish(ntcm::OpenMetricsPublisher*               publisher,
+             const bsl::shared_ptr<ntci::Monitorable>& objectA,
+             const bsl::shared_ptr<ntci::Monitorable>& objectB,
+             const bsls::TimeInterval&                 time)
+{
+    bdld::ManagedDatum statisticsA;
+    objectA->getStats(&statisticsA);
+
+    bdld::ManagedDatum statisticsB;
+    objectB->getStats(&statisticsB);
+
+    publisher->publish(objectA, statisticsA.datum(), time, false);
+    publisher->publish(objectB, statisticsB.datum(), time, true);
+}
+
+}  // close namespace 'test'
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: Rendering statistics into the OpenMetrics text format.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        ntcm::OpenMetricsPublisher publisher(&ta);
+
+        bsl::string exposition;
+        publisher.load(&exposition);
+        NTCCFG_TEST_EQ(exposition, "# EOF\n");
+
+        bsl::shared_ptr<test::Object> objectA;
+        objectA.createInplace(&ta, "alpha", 1.0, 2.5);
+
+        bsl::shared_ptr<test::Object> objectB;
+        objectB.createInplace(&ta, "be\"ta", 3.0, 4.0);
+
+        test::publish(&publisher, objectA, objectB, bsls::TimeInterval(1));
+
+        NTCCFG_TEST_EQ(publisher.time(), bsls::TimeInterval(1));
+
+        bsl::string labelsA;
+        {
+            bsl::ostringstream ss;
+            ss << "{object=\"alpha\",id=\"" << objectA->objectId().value()
+               << "\"}";
+            labelsA = ss.str();
+        }
+
+        bsl::string labelsB;
+        {
+            bsl::ostringstream ss;
+            ss << "{object=\"be\\\"ta\",id=\"" << objectB->objectId().value()
+               << "\"}";
+            labelsB = ss.str();
+        }
+
+        bsl::string expected;
+        expected.append("# TYPE ntf_test_object_latency_p99 gauge\n");
+        expected.append("# HELP ntf_test_object_latency_p99 "
+                        "Request latency\\nin microseconds\n");
+        expected.append("ntf_test_object_latency_p99" + labelsA + " 2.5\n");
+        expected.append("ntf_test_object_latency_p99" + labelsB + " 4\n");
+        expected.append("# TYPE ntf_test_object_request_count gauge\n");
+        expected.append("# HELP ntf_test_object_request_count "
+                        "Number of requests\n");
+        expected.append("ntf_test_object_request_count" + labelsA + " 1\n");
+        expected.append("ntf_test_object_request_count" + labelsB + " 3\n");
+        expected.append("# EOF\n");
+
+        publisher.load(&exposition);
+        NTCCFG_TEST_EQ(exposition, expected);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: Rendering does not allocate memory once the rendering buffers
+    // have grown to their steady-state size.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        bslma::TestAllocator publisherAllocator;
+
+        ntcm::OpenMetricsPublisher publisher(0, &publisherAllocator);
+
+        bsl::shared_ptr<test::Object> objectA;
+        objectA.createInplace(&ta, "alpha", 1.0, 2.5);
+
+        bsl::shared_ptr<test::Object> objectB;
+        objectB.createInplace(&ta, "beta", 3.0, 4.0);
+
+        bsls::Types::Int64 numAllocationsAfterWarmup = 0;
+
+        const int k_NUM_ROUNDS = 4;
+
+        for (int round = 0; round < k_NUM_ROUNDS; ++round) {
+            test::publish(&publisher,
+                          objectA,
+                          objectB,
+                          bsls::TimeInterval(round));
+
+            if (round < 2) {
+                numAllocationsAfterWarmup =
+                    publisherAllocator.numAllocations();
+            }
+            else {
+                NTCCFG_TEST_EQ(publisherAllocator.numAllocations(),
+                               numAllocationsAfterWarmup);
+            }
+        }
+
+        NTCCFG_TEST_EQ(publisher.time(), bsls::TimeInterval(k_NUM_ROUNDS - 1));
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+}
+NTCCFG_TEST_DRIVER_END;
@@ -0,0 +1,441 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcm_openmetricsserver.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntcm_openmetricsserver_cpp, "$Id$ $CSID$")
+
+#include <ntccfg_bind.h>
+#include <ntci_log.h>
+#include <ntci_streamsocket.h>
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bslmt_lockguard.h>
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bsls_assert.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace ntcm {
+
+namespace {
+
+/// The default duration within which each connection must deliver its
+/// complete request, in seconds.
+const int k_DEFAULT_REQUEST_TIMEOUT_IN_SECONDS = 10;
+
+/// Provide a connection to an OpenMetrics server that serves a single
+/// request.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+class OpenMetricsSession : public ntccfg::Shared<OpenMetricsSession>
+{
+    enum {
+        /// The maximum size of the request line and headers, in bytes.
+        k_MAX_REQUEST_SIZE = 8192
+    };
+
+    bsl::shared_ptr<ntcm::OpenMetricsPublisher> d_publisher_sp;
+    bsl::shared_ptr<ntci::StreamSocket>          d_streamSocket_sp;
+    bsls::TimeInterval                           d_deadline;
+    char                                         d_request[k_MAX_REQUEST_SIZE];
+    bsl::size_t                                  d_requestSize;
+
+  private:
+    OpenMetricsSession(const OpenMetricsSession&) BSLS_KEYWORD_DELETED;
+    OpenMetricsSession& operator=(const OpenMetricsSession&)
+        BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Process the receipt of the specified 'data' by the specified
+    /// 'receiver' according to the specified 'event'.
+    void processReceive(const bsl::shared_ptr<ntci::Receiver>& receiver,
+                        const bsl::shared_ptr<bdlbb::Blob>&    data,
+                        const ntca::ReceiveEvent&              event);
+
+    /// Process the completion of the response by the specified 'sender'
+    /// according to the specified 'event'.
+    void processSend(const bsl::shared_ptr<ntci::Sender>& sender,
+                     const ntca::SendEvent&               event);
+
+    /// Return true if the request line and headers have been completely
+    /// received, otherwise return false.
+    bool isComplete() const;
+
+    /// Respond to the received request.
+    void respond();
+
+    /// Send a response having the specified 'status' line. If the specified
+    /// 'body' flag is true, include the most recent exposition as the body
+    /// of the response.
+    void send(const char* status, bool body);
+
+  public:
+    /// Create a new session serving a request received by the specified
+    /// 'streamSocket' with the most recent exposition rendered by the
+    /// specified 'publisher'. The request must be completely received by
+    /// the specified absolute 'deadline', otherwise the connection is closed.
+    OpenMetricsSession(
+        const bsl::shared_ptr<ntcm::OpenMetricsPublisher>& publisher,
+        const bsl::shared_ptr<ntci::StreamSocket>&         streamSocket,
+        const bsls::TimeInterval&                          deadline);
+
+    /// Destroy this object.
+    ~OpenMetricsSession();
+
+    /// Receive the next fragment of the request.
+    void receive();
+};
+
+void OpenMetricsSession::processReceive(
+    const bsl::shared_ptr<ntci::Receiver>& receiver,
+    const bsl::shared_ptr<bdlbb::Blob>&    data,
+    const ntca::ReceiveEvent&              event)
+{
+    NTCCFG_WARNING_UNUSED(receiver);
+
+    NTCI_LOG_CONTEXT();
+
+    if (event.type() == ntca::ReceiveEventType::e_ERROR) {
+        if (event.context().error() == ntsa::Error::e_WOULD_BLOCK) {
+            NTCI_LOG_STREAM_DEBUG
+                << "OpenMetrics session timed out receiving request from "
+                << d_streamSocket_sp->remoteEndpoint()
+                << NTCI_LOG_STREAM_END;
+        }
+
+        d_streamSocket_sp->close();
+        return;
+    }
+
+    bsl::size_t size = static_cast<bsl::size_t>(data->length());
+    if (size > k_MAX_REQUEST_SIZE - d_requestSize) {
+        size = k_MAX_REQUEST_SIZE - d_requestSize;
+    }
+
+    bdlbb::BlobUtil::copy(d_request + d_requestSize,
+                          *data,
+                          0,
+                          static_cast<int>(size));
+
+    d_requestSize += size;
+
+    if (this->isComplete()) {
+        this->respond();
+    }
+    else if (d_requestSize == k_MAX_REQUEST_SIZE) {
+        this->send("431 Request Header Fields Too Large", false);
+    }
+    else {
+        this->receive();
+    }
+}
+
+void OpenMetricsSession::processSend(
+    const bsl::shared_ptr<ntci::Sender>& sender,
+    const ntca::SendEvent&               event)
+{
+    NTCCFG_WARNING_UNUSED(sender);
+    NTCCFG_WARNING_UNUSED(event);
+
+    d_streamSocket_sp->close();
+}
+
+bool OpenMetricsSession::isComplete() const
+{
+    for (bsl::size_t i = 3; i < d_requestSize; ++i) {
+        if (d_request[i - 3] == '\r' && d_request[i - 2] == '\n' &&
+            d_request[i - 1] == '\r' && d_request[i] == '\n')
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void OpenMetricsSession::respond()
+{
+    // Parse the method and target from the request line, ignoring the
+    // query string, if any.
+
+    const char* const end = d_request + d_requestSize;
+
+    const char* method  = d_request;
+    const char* current = method;
+    while (current != end && *current != ' ') {
+        ++current;
+    }
+
+    const bsl::size_t methodLength =
+        static_cast<bsl::size_t>(current - method);
+
+    if (current != end) {
+        ++current;
+    }
+
+    const char* target = current;
+    while (current != end && *current != ' ' && *current != '?') {
+        ++current;
+    }
+
+    const bsl::size_t targetLength =
+        static_cast<bsl::size_t>(current - target);
+
+    if (methodLength != 3 || bsl::memcmp(method, "GET", 3) != 0) {
+        this->send("405 Method Not Allowed", false);
+    }
+    else if ((targetLength == 8 && bsl::memcmp(target, "/metrics", 8) == 0) ||
+             (targetLength == 1 && target[0] == '/'))
+    {
+        this->send("200 OK", true);
+    }
+    else {
+        this->send("404 Not Found", false);
+    }
+}
+
+void OpenMetricsSession::send(const char* status, bool body)
+{
+    bdlbb::Blob content(d_streamSocket_sp->outgoingBlobBufferFactory().get());
+    if (body) {
+        d_publisher_sp->load(&content);
+    }
+
+    char header[256];
+    int  headerLength =
+        bsl::snprintf(header,
+                      sizeof header,
+                      "HTTP/1.1 %s\r\n"
+                      "Content-Type: %s\r\n"
+                      "Content-Length: %d\r\n"
+                      "Connection: close\r\n"
+                      "\r\n",
+                      status,
+                      body ? ntcm::OpenMetricsPublisher::contentType()
+                           : "text/plain; charset=utf-8",
+                      content.length());
+
+    if (headerLength <= 0 ||
+        headerLength >= static_cast<int>(sizeof header))
+    {
+        d_streamSocket_sp->close();
+        return;
+    }
+
+    bdlbb::Blob response(d_streamSocket_sp->outgoingBlobBufferFactory().get());
+    bdlbb::BlobUtil::append(&response, header, headerLength);
+    bdlbb::BlobUtil::append(&response, content);
+
+    ntci::SendCallback sendCallback = d_streamSocket_sp->createSendCallback(
+        NTCCFG_BIND(&OpenMetricsSession::processSend,
+                    this->getSelf(this),
+                    NTCCFG_BIND_PLACEHOLDER_1,
+                    NTCCFG_BIND_PLACEHOLDER_2));
+
+    ntsa::Error error =
+        d_streamSocket_sp->send(response, ntca::SendOptions(), sendCallback);
+    if (error) {
+        d_streamSocket_sp->close();
+    }
+}
+
+OpenMetricsSession::OpenMetricsSession(
+    const bsl::shared_ptr<ntcm::OpenMetricsPublisher>& publisher,
+    const bsl::shared_ptr<ntci::StreamSocket>&         streamSocket,
+    const bsls::TimeInterval&                          deadline)
+: d_publisher_sp(publisher)
+, d_streamSocket_sp(streamSocket)
+, d_deadline(deadline)
+, d_requestSize(0)
+{
+}
+
+OpenMetricsSession::~OpenMetricsSession()
+{
+}
+
+void OpenMetricsSession::receive()
+{
+    ntca::ReceiveOptions options;
+    options.setMinSize(1);
+    options.setMaxSize(k_MAX_REQUEST_SIZE - d_requestSize);
+    options.setDeadline(d_deadline);
+
+    ntci::ReceiveCallback receiveCallback =
+        d_streamSocket_sp->createReceiveCallback(
+            NTCCFG_BIND(&OpenMetricsSession::processReceive,
+                        this->getSelf(this),
+                        NTCCFG_BIND_PLACEHOLDER_1,
+                        NTCCFG_BIND_PLACEHOLDER_2,
+                        NTCCFG_BIND_PLACEHOLDER_3));
+
+    ntsa::Error error =
+        d_streamSocket_sp->receive(options, receiveCallback);
+    if (error) {
+        d_streamSocket_sp->close();
+    }
+}
+
+}  // close unnamed namespace
+
+void OpenMetricsServer::processAccept(
+    const bsl::shared_ptr<ntci::Acceptor>&     acceptor,
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+    const ntca::AcceptEvent&                   event)
+{
+    NTCI_LOG_CONTEXT();
+
+    if (event.type() == ntca::AcceptEventType::e_ERROR) {
+        if (event.context().error() != ntsa::Error::e_EOF) {
+            NTCI_LOG_STREAM_DEBUG << "OpenMetrics server failed to accept: "
+                                  << event.context().error()
+                                  << NTCI_LOG_STREAM_END;
+        }
+        return;
+    }
+
+    NTCCFG_WARNING_UNUSED(acceptor);
+
+    bsl::shared_ptr<ntci::ListenerSocket> listenerSocket;
+    bsls::TimeInterval                    requestTimeout;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        listenerSocket = d_listenerSocket_sp;
+        requestTimeout = d_requestTimeout;
+    }
+
+    const bsls::TimeInterval deadline =
+        streamSocket->currentTime() + requestTimeout;
+
+    bsl::shared_ptr<OpenMetricsSession> session;
+    session.createInplace(d_allocator_p,
+                          d_publisher_sp,
+                          streamSocket,
+                          deadline);
+
+    session->receive();
+
+    if (listenerSocket) {
+        this->accept(listenerSocket);
+    }
+}
+
+void OpenMetricsServer::accept(
+    const bsl::shared_ptr<ntci::ListenerSocket>& listenerSocket)
+{
+    ntci::AcceptCallback acceptCallback =
+        listenerSocket->createAcceptCallback(
+            NTCCFG_BIND(&OpenMetricsServer::processAccept,
+                        this->getSelf(this),
+                        NTCCFG_BIND_PLACEHOLDER_1,
+                        NTCCFG_BIND_PLACEHOLDER_2,
+                        NTCCFG_BIND_PLACEHOLDER_3),
+            d_allocator_p);
+
+    listenerSocket->accept(ntca::AcceptOptions(), acceptCallback);
+}
+
+OpenMetricsServer::OpenMetricsServer(
+    const bsl::shared_ptr<ntcm::OpenMetricsPublisher>&  publisher,
+    const bsl::shared_ptr<ntci::ListenerSocketFactory>& factory,
+    bslma::Allocator*                                   basicAllocator)
+: d_mutex()
+, d_publisher_sp(publisher)
+, d_factory_sp(factory)
+, d_listenerSocket_sp()
+, d_requestTimeout(k_DEFAULT_REQUEST_TIMEOUT_IN_SECONDS, 0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+OpenMetricsServer::~OpenMetricsServer()
+{
+}
+
+ntsa::Error OpenMetricsServer::open(const ntsa::Endpoint& endpoint)
+{
+    ntsa::Error error;
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (d_listenerSocket_sp) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    ntca::ListenerSocketOptions options;
+    options.setTransport(endpoint.isIp() && endpoint.ip().host().isV6()
+                             ? ntsa::Transport::e_TCP_IPV6_STREAM
+                             : ntsa::Transport::e_TCP_IPV4_STREAM);
+    options.setSourceEndpoint(endpoint);
+    options.setReuseAddress(true);
+
+    bsl::shared_ptr<ntci::ListenerSocket> listenerSocket =
+        d_factory_sp->createListenerSocket(options, d_allocator_p);
+
+    error = listenerSocket->open();
+    if (error) {
+        return error;
+    }
+
+    error = listenerSocket->listen();
+    if (error) {
+        listenerSocket->close();
+        return error;
+    }
+
+    d_listenerSocket_sp = listenerSocket;
+
+    this->accept(listenerSocket);
+
+    return ntsa::Error();
+}
+
+void OpenMetricsServer::setRequestTimeout(const bsls::TimeInterval& timeout)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    d_requestTimeout = timeout;
+}
+
+void OpenMetricsServer::close()
+{
+    bsl::shared_ptr<ntci::ListenerSocket> listenerSocket;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        listenerSocket.swap(d_listenerSocket_sp);
+    }
+
+    if (listenerSocket) {
+        listenerSocket->close();
+    }
+}
+
+ntsa::Endpoint OpenMetricsServer::sourceEndpoint() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (d_listenerSocket_sp) {
+        return d_listenerSocket_sp->sourceEndpoint();
+    }
+
+    return ntsa::Endpoint();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,114 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCM_OPENMETRICSSERVER
+#define INCLUDED_NTCM_OPENMETRICSSERVER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntccfg_platform.h>
+#include <ntci_listenersocket.h>
+#include <ntci_listenersocketfactory.h>
+#include <ntcm_openmetricspublisher.h>
+#include <ntcscm_version.h>
+#include <ntsa_endpoint.h>
+#include <ntsa_error.h>
+#include <bslmt_mutex.h>
+#include <bsls_keyword.h>
+#include <bsls_timeinterval.h>
+#include <bsl_memory.h>
+
+namespace BloombergLP {
+namespace ntcm {
+
+/// @internal @brief
+/// Provide a minimal HTTP endpoint serving OpenMetrics expositions.
+///
+/// @details
+/// This class accepts connections on a listener socket created from a
+/// listener socket factory, typically the same 'ntci::Interface' whose
+/// sockets are being monitored, and answers each "GET /metrics" request with
+/// the most recent exposition rendered by an 'ntcm::OpenMetricsPublisher'.
+/// Each connection serves a single request and is closed once the response
+/// has been sent. Requests for any other path are answered with "404 Not
+/// Found", and requests using any other method are answered with "405 Method
+/// Not Allowed". A connection that does not deliver its complete request
+/// within the request timeout, ten seconds by default, is closed without a
+/// response. Objects of this class must be managed by a shared pointer.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntcm
+class OpenMetricsServer : public ntccfg::Shared<OpenMetricsServer>
+{
+    mutable bslmt::Mutex                         d_mutex;
+    bsl::shared_ptr<ntcm::OpenMetricsPublisher>  d_publisher_sp;
+    bsl::shared_ptr<ntci::ListenerSocketFactory> d_factory_sp;
+    bsl::shared_ptr<ntci::ListenerSocket>        d_listenerSocket_sp;
+    bsls::TimeInterval                           d_requestTimeout;
+    bslma::Allocator*                            d_allocator_p;
+
+  private:
+    OpenMetricsServer(const OpenMetricsServer&) BSLS_KEYWORD_DELETED;
+    OpenMetricsServer& operator=(const OpenMetricsServer&)
+        BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Process the acceptance of the specified 'streamSocket' by the
+    /// specified 'acceptor' according to the specified 'event'.
+    void processAccept(const bsl::shared_ptr<ntci::Acceptor>&     acceptor,
+                       const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+                       const ntca::AcceptEvent&                   event);
+
+    /// Accept the next connection to the specified 'listenerSocket'.
+    void accept(const bsl::shared_ptr<ntci::ListenerSocket>& listenerSocket);
+
+  public:
+    /// Create a new OpenMetrics server that serves the expositions rendered
+    /// by the specified 'publisher' through listener sockets created by the
+    /// specified 'factory'. Optionally specify a 'basicAllocator' used to
+    /// supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used.
+    OpenMetricsServer(
+        const bsl::shared_ptr<ntcm::OpenMetricsPublisher>&  publisher,
+        const bsl::shared_ptr<ntci::ListenerSocketFactory>& factory,
+        bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~OpenMetricsServer();
+
+    /// Listen for connections at the specified 'endpoint' and begin serving
+    /// requests. Return the error.
+    ntsa::Error open(const ntsa::Endpoint& endpoint);
+
+    /// Set the duration within which each connection must deliver its
+    /// complete request to the specified 'timeout'. Note that the timeout
+    /// applies only to connections accepted after this call.
+    void setRequestTimeout(const bsls::TimeInterval& timeout);
+
+    /// Stop accepting connections. Note that requests already accepted are
+    /// still served.
+    void close();
+
+    /// Return the endpoint at which this server is listening, or the
+    /// default value if this server is not open.
+    ntsa::Endpoint sourceEndpoint() const;
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
@@ -2096,7 +2096,8 @@ void Devpoll::run(ntci::Waiter waiter)
                     if (entry->announceError(event)) {
                         ++numErrors;
                     }
-                    NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END();
+                    NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END(
+                        descriptorHandle);
                 }
                 else {
                     if ((e.revents & POLLOUT) != 0) {
@@ -2108,7 +2109,8 @@ void Devpoll::run(ntci::Waiter waiter)
                         if (entry->announceWritable(event)) {
                             ++numWritable;
                         }
-                        NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END();
+                        NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END(
+                            descriptorHandle);
                     }
 
                     if (((e.revents & POLLIN) != 0) ||
@@ -2122,7 +2124,8 @@ void Devpoll::run(ntci::Waiter waiter)
                         if (entry->announceReadable(event)) {
                             ++numReadable;
                         }
-                        NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END();
+                        NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END(
+                            descriptorHandle);
                     }
                 }
 
@@ -2405,7 +2408,7 @@ void Devpoll::poll(ntci::Waiter waiter)
                 if (entry->announceError(event)) {
                     ++numErrors;
                 }
-                NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END();
+                NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END(descriptorHandle);
             }
             else {
                 if ((e.revents & POLLOUT) != 0) {
@@ -2417,7 +2420,8 @@ void Devpoll::poll(ntci::Waiter waiter)
                     if (entry->announceWritable(event)) {
                         ++numWritable;
                     }
-                    NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END();
+                    NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END(
+                        descriptorHandle);
                 }
 
                 if (((e.revents & POLLIN) != 0) ||
@@ -2431,7 +2435,8 @@ void Devpoll::poll(ntci::Waiter waiter)
                     if (entry->announceReadable(event)) {
                         ++numReadable;
                     }
-                    NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END();
+                    NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END(
+                        descriptorHandle);
                 }
             }
 
@@ -28,6 +28,7 @@ BSLS_IDENT_RCSID(ntco_epoll_cpp, "$Id$ $CSID$")
 #include <ntcm_monitorableregistry.h>
 #include <ntcm_monitorableutil.h>
 
+#include <ntccfg_tracepoint.h>
 #include <ntci_log.h>
 #include <ntci_mutex.h>
 #include <ntcs_async.h>
@@ -36,6 +37,7 @@ BSLS_IDENT_RCSID(ntco_epoll_cpp, "$Id$ $CSID$")
 #include <ntcs_controller.h>
 #include <ntcs_datapool.h>
 #include <ntcs_driver.h>
+#include <ntcs_flightrecorder.h>
 #include <ntcs_nomenclature.h>
 #include <ntcs_reactormetrics.h>
 #include <ntcs_registry.h>
@@ -2233,8 +2235,14 @@ void Epoll::run(ntci::Waiter waiter)
         enum { MAX_EVENTS = 128 };
         struct ::epoll_event results[MAX_EVENTS];
 
+        NTCS_FLIGHTRECORDER_WAIT_ENTER(wait);
+        NTCCFG_TRACEPOINT1(wait_enter, this);
+
         rc = ::epoll_wait(d_epoll, results, MAX_EVENTS, wait);
 
+        NTCS_FLIGHTRECORDER_WAIT_EXIT(rc > 0 ? rc : 0);
+        NTCCFG_TRACEPOINT2(wait_exit, this, rc);
+
         if (NTCCFG_LIKELY(rc > 0)) {
             NTCO_EPOLL_LOG_WAIT_RESULT_OR_TIMEOUT(rc, results);
 
@@ -2280,6 +2288,12 @@ void Epoll::run(ntci::Waiter waiter)
 
                 NTCO_EPOLL_LOG_EVENTS(descriptorHandle, e);
 
+                NTCS_FLIGHTRECORDER_POLL(
+                    descriptorHandle,
+                    (e.events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP)) != 0,
+                    (e.events & EPOLLOUT) != 0,
+                    (e.events & EPOLLERR) != 0);
+
                 if (NTCCFG_LIKELY(descriptorHandle !=
                                   d_controllerDescriptorHandle))
                 {
@@ -2324,7 +2338,8 @@ void Epoll::run(ntci::Waiter waiter)
                             if (entry->announceError(event)) {
                                 ++numErrors;
                             }
-                            NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END();
+                            NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END(
+                                descriptorHandle);
                         }
                     }
                     if (NTCCFG_LIKELY(!fatalSocketError)) {
@@ -2337,7 +2352,8 @@ void Epoll::run(ntci::Waiter waiter)
                             if (entry->announceWritable(event)) {
                                 ++numWritable;
                             }
-                            NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END();
+                            NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END(
+                                descriptorHandle);
                         }
 
                         if ((e.events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP)) !=
@@ -2351,7 +2367,8 @@ void Epoll::run(ntci::Waiter waiter)
                             if (entry->announceReadable(event)) {
                                 ++numReadable;
                             }
-                            NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END();
+                            NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END(
+                                descriptorHandle);
                         }
 
                         if (e.events == EPOLLHUP) {
@@ -2532,8 +2549,14 @@ void Epoll::poll(ntci::Waiter waiter)
     enum { MAX_EVENTS = 128 };
     struct ::epoll_event results[MAX_EVENTS];
 
+    NTCS_FLIGHTRECORDER_WAIT_ENTER(wait);
+    NTCCFG_TRACEPOINT1(wait_enter, this);
+
     rc = ::epoll_wait(d_epoll, results, MAX_EVENTS, wait);
 
+    NTCS_FLIGHTRECORDER_WAIT_EXIT(rc > 0 ? rc : 0);
+    NTCCFG_TRACEPOINT2(wait_exit, this, rc);
+
     if (NTCCFG_LIKELY(rc > 0)) {
         NTCO_EPOLL_LOG_WAIT_RESULT_OR_TIMEOUT(rc, results);
 
@@ -2578,6 +2601,12 @@ void Epoll::poll(ntci::Waiter waiter)
 
             NTCO_EPOLL_LOG_EVENTS(descriptorHandle, e);
 
+            NTCS_FLIGHTRECORDER_POLL(
+                descriptorHandle,
+                (e.events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP)) != 0,
+                (e.events & EPOLLOUT) != 0,
+                (e.events & EPOLLERR) != 0);
+
             if (NTCCFG_LIKELY(descriptorHandle !=
                               d_controllerDescriptorHandle))
             {
@@ -2621,7 +2650,8 @@ void Epoll::poll(ntci::Waiter waiter)
                         if (entry->announceError(event)) {
                             ++numErrors;
                         }
-                        NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END();
+                        NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END(
+                            descriptorHandle);
                     }
                 }
                 if (NTCCFG_LIKELY(!fatalSocketError)) {
@@ -2634,7 +2664,8 @@ void Epoll::poll(ntci::Waiter waiter)
                         if (entry->announceWritable(event)) {
                             ++numWritable;
                         }
-                        NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END();
+                        NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END(
+                            descriptorHandle);
                     }
 
                     if ((e.events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP)) != 0) {
@@ -2646,7 +2677,8 @@ void Epoll::poll(ntci::Waiter waiter)
                         if (entry->announceReadable(event)) {
                             ++numReadable;
                         }
-                        NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END();
+                        NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END(
+                            descriptorHandle);
                     }
 
                     if (e.events == EPOLLHUP) {
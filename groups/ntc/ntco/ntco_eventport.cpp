@@ -1878,7 +1878,8 @@ void EventPort::run(ntci::Waiter waiter)
                             if (entry->announceReadable(event)) {
                                 ++numReadable;
                             }
-                            NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END();
+                            NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END(
+                                descriptorHandle);
                         }
                         else {
                             ntca::ReactorEvent event;
@@ -1890,7 +1891,8 @@ void EventPort::run(ntci::Waiter waiter)
                             if (entry->announceError(event)) {
                                 ++numErrors;
                             }
-                            NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END();
+                            NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END(
+                                descriptorHandle);
                         }
                     }
                     else {
@@ -1903,7 +1905,8 @@ void EventPort::run(ntci::Waiter waiter)
                             if (entry->announceWritable(event)) {
                                 ++numWritable;
                             }
-                            NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END();
+                            NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END(
+                                descriptorHandle);
                         }
 
                         if (((event.portev_events & POLLIN) != 0) ||
@@ -1917,7 +1920,8 @@ void EventPort::run(ntci::Waiter waiter)
                             if (entry->announceReadable(event)) {
                                 ++numReadable;
                             }
-                            NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END();
+                            NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END(
+                                descriptorHandle);
                         }
                     }
 
@@ -2121,7 +2125,8 @@ void EventPort::poll(ntci::Waiter waiter)
                         if (entry->announceReadable(event)) {
                             ++numReadable;
                         }
-                        NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END();
+                        NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END(
+                            descriptorHandle);
                     }
                     else {
                         ntca::ReactorEvent event;
@@ -2133,7 +2138,8 @@ void EventPort::poll(ntci::Waiter waiter)
                         if (entry->announceError(event)) {
                             ++numErrors;
                         }
-                        NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END();
+                        NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END(
+                            descriptorHandle);
                     }
                 }
                 else {
@@ -2146,7 +2152,8 @@ void EventPort::poll(ntci::Waiter waiter)
                         if (entry->announceWritable(event)) {
                             ++numWritable;
                         }
-                        NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END();
+                        NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END(
+                            descriptorHandle);
                     }
 
                     if (((event.portev_events & POLLIN) != 0) ||
@@ -2160,7 +2167,8 @@ void EventPort::poll(ntci::Waiter waiter)
                         if (entry->announceReadable(event)) {
                             ++numReadable;
                         }
-                        NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END();
+                        NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END(
+                            descriptorHandle);
                     }
                 }
 
@@ -291,6 +291,11 @@ class Iocp : public ntci::Proactor,
     void flush();
     // Execute all pending jobs.
 
+    void complete(ntcs::Event* event, ntsa::Error error, DWORD numBytes);
+    // Complete the specified 'event' that has failed with the specified
+    // 'error', if any, or transferred the specified 'numBytes', by
+    // announcing its completion to the socket that initiated it.
+
     void wait(ntci::Waiter waiter);
     // Block the calling thread, identified by the specified 'waiter',
     // until any registered events for any descriptor in the polling set
@@ -759,6 +764,8 @@ void Iocp::wait(ntci::Waiter waiter)
 
     NTCI_LOG_CONTEXT();
 
+    NTCS_PROACTORMETRICS_GET_THREAD_LOCAL();
+
     ntsa::Error error;
 
     bslma::ManagedPtr<ntcs::Event> event;
@@ -826,6 +833,34 @@ void Iocp::wait(ntci::Waiter waiter)
         return;
     }
 
+    ntsa::Handle handle = ntsa::k_INVALID_HANDLE;
+    if (event->d_socket) {
+        handle = event->d_socket->handle();
+    }
+
+    if (event->d_type == ntcs::EventType::e_ACCEPT ||
+        event->d_type == ntcs::EventType::e_RECEIVE)
+    {
+        NTCS_PROACTORMETRICS_UPDATE_READ_CALLBACK_TIME_BEGIN();
+        this->complete(event.get(), error, numBytes);
+        NTCS_PROACTORMETRICS_UPDATE_READ_CALLBACK_TIME_END(handle);
+    }
+    else if (event->d_type == ntcs::EventType::e_CONNECT ||
+             event->d_type == ntcs::EventType::e_SEND)
+    {
+        NTCS_PROACTORMETRICS_UPDATE_WRITE_CALLBACK_TIME_BEGIN();
+        this->complete(event.get(), error, numBytes);
+        NTCS_PROACTORMETRICS_UPDATE_WRITE_CALLBACK_TIME_END(handle);
+    }
+    else {
+        NTCP_IOCP_LOG_EVENT_IGNORED(event);
+    }
+}
+
+void Iocp::complete(ntcs::Event* event, ntsa::Error error, DWORD numBytes)
+{
+    DWORD lastError = 0;
+
     if (event->d_type == ntcs::EventType::e_ACCEPT) {
         BSLS_ASSERT(event->d_socket.get() != 0);
         BSLS_ASSERT(event->d_target != ntsa::k_INVALID_HANDLE);
@@ -1013,10 +1048,6 @@ void Iocp::wait(ntci::Waiter waiter)
                                          context,
                                          event->d_socket->strand());
     }
-    else {
-        NTCP_IOCP_LOG_EVENT_IGNORED(event);
-        return;
-    }
 }
 
 bsl::shared_ptr<ntci::Proactor> Iocp::acquireProactor(
@@ -2512,6 +2543,11 @@ void Iocp::decrementLoad(const ntca::LoadBalancingOptions& options)
 
 void Iocp::run(ntci::Waiter waiter)
 {
+    Iocp::Result* result = static_cast<Iocp::Result*>(waiter);
+    NTCCFG_WARNING_UNUSED(result);
+
+    NTCS_PROACTORMETRICS_GET();
+
     while (d_run) {
         // Wait for an operation to complete or a timeout.
 
@@ -2535,6 +2571,11 @@ void Iocp::run(ntci::Waiter waiter)
 
 void Iocp::poll(ntci::Waiter waiter)
 {
+    Iocp::Result* result = static_cast<Iocp::Result*>(waiter);
+    NTCCFG_WARNING_UNUSED(result);
+
+    NTCS_PROACTORMETRICS_GET();
+
     // Wait for an operation to complete or a timeout.
 
     this->wait(waiter);
@@ -49,6 +49,7 @@ BSLS_IDENT_RCSID(ntco_ioring_cpp, "$Id$ $CSID$")
 #include <ntcm_monitorableregistry.h>
 #include <ntcm_monitorableutil.h>
 
+#include <ntccfg_tracepoint.h>
 #include <ntci_log.h>
 #include <ntci_mutex.h>
 #include <ntcs_async.h>
@@ -57,6 +58,7 @@ BSLS_IDENT_RCSID(ntco_ioring_cpp, "$Id$ $CSID$")
 #include <ntcs_datapool.h>
 #include <ntcs_driver.h>
 #include <ntcs_event.h>
+#include <ntcs_flightrecorder.h>
 #include <ntcs_nomenclature.h>
 #include <ntcs_proactordetachcontext.h>
 #include <ntcs_proactormetrics.h>
@@ -92,6 +94,7 @@ BSLS_IDENT_RCSID(ntco_ioring_cpp, "$Id$ $CSID$")
 #include <bsls_spinlock.h>
 #include <bsls_timeutil.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_functional.h>
 #include <bsl_iosfwd.h>
 #include <bsl_list.h>
@@ -111,6 +114,7 @@ BSLS_IDENT_RCSID(ntco_ioring_cpp, "$Id$ $CSID$")
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include <netinet/udp.h>
+#include <poll.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -404,6 +408,9 @@ struct IoRingOperation {
         // Initiate a no-op.
         e_NOP = 0,
 
+        // Poll a file descriptor for readiness.
+        e_POLL_ADD = 6,
+
         // Initiate a 'sendmsg' system call.
         e_SENDMSG = 9,
 
@@ -425,6 +432,9 @@ struct IoRingOperation {
         // Initiate a 'connect' system call.
         e_CONNECT = 16,
 
+        // Initiate a 'splice' system call.
+        e_SPLICE = 30,
+
         // Initiate a 'shutdown' system call.
         e_SHUTDOWN = 34,
 
@@ -837,6 +847,62 @@ struct IoRingSubmissionMode {
     static const char* toString(IoRingSubmissionMode::Value mode);
 };
 
+/// Describe a pipe through which files are spliced to sockets.
+///
+/// @par Thread Safety
+/// This struct is not thread safe.
+struct IoRingPipe {
+    /// The read end of the pipe.
+    int d_reader;
+
+    /// The write end of the pipe.
+    int d_writer;
+
+    /// The maximum number of bytes buffered by the pipe.
+    bsl::uint32_t d_capacity;
+};
+
+/// Describe the state of an operation to send a file to a socket, which is
+/// performed by splicing a portion of the file into a pipe then splicing the
+/// pipe into the socket until the pipe is empty. The state of each such
+/// operation is stored in the message arena of its event.
+///
+/// @par Thread Safety
+/// This struct is not thread safe.
+struct IoRingSplice {
+    /// Enumerate the phases of the operation.
+    enum Phase {
+        /// Splice the file into the pipe.
+        e_FILL = 1,
+
+        /// Splice the pipe into the socket.
+        e_DRAIN = 2,
+
+        /// Wait for the socket to become writable before splicing the
+        /// remaining contents of the pipe into the socket.
+        e_POLL = 3
+    };
+
+    /// The pipe.
+    ntco::IoRingPipe d_pipe;
+
+    /// The current phase.
+    bsl::uint32_t d_phase;
+
+    /// The file descriptor of the file.
+    int d_file;
+
+    /// The offset of the portion of the file being sent.
+    bsl::int64_t d_fileOffset;
+
+    /// The number of bytes spliced into the pipe but not yet spliced into
+    /// the socket.
+    bsl::uint64_t d_numBytesBuffered;
+
+    /// The number of bytes spliced into the socket.
+    bsl::uint64_t d_numBytesSent;
+};
+
 /// Describe an I/O ring submission entry.
 ///
 /// @par Thread Safety
@@ -1027,7 +1093,9 @@ class IoRingSubmission
     /// specified 'source' to the send buffer of the specified 'socket'
     /// identified by the specified 'handle' according to the specified
     /// 'options'. Load into the specified 'event' the event that indicates the
-    /// operation is complete. Return the error.
+    /// operation is complete. Return the error. The behavior is undefined
+    /// unless a pipe has been loaded into the splice state of the 'event'.
+    /// Note that at most the capacity of the pipe is sent by the operation.
     ntsa::Error prepareSend(
         ntcs::Event*                                 event,
         const bsl::shared_ptr<ntci::ProactorSocket>& socket,
@@ -1059,6 +1127,11 @@ class IoRingSubmission
         bdlbb::Blob*                                 destination,
         const ntsa::ReceiveOptions&                  options);
 
+    /// Prepare the submission to initiate the current phase of the operation
+    /// to send a file described by the splice state of the specified 'event'
+    /// to the socket identified by the specified 'handle'.
+    void prepareSplice(ntcs::Event* event, ntsa::Handle handle);
+
     /// Prepare the submission to cancel each operation associated with the
     /// specified 'handle'.
     void prepareCancellation(ntsa::Handle handle);
@@ -1517,6 +1590,62 @@ class IoRingContext : public ntcs::ProactorDetachContext
     ntsa::Handle handle() const;
 };
 
+/// Provide a pool of pipes through which files are spliced to sockets.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+class IoRingPipePool
+{
+    // Define a type alias for a vector of pipes.
+    typedef bsl::vector<ntco::IoRingPipe> PipeVector;
+
+    // Define a type alias for a mutex.
+    typedef ntci::Mutex Mutex;
+
+    // Define a type alias for a mutex lock guard.
+    typedef ntci::LockGuard LockGuard;
+
+    // The requested capacity of each pipe. Larger pipes splice more of a
+    // file per operation, but count towards the per-user limit of pages
+    // allocated to pipes, beyond which the kernel creates pipes having a
+    // capacity of only a single page.
+    enum { k_CAPACITY = 256 * 1024 };
+
+    // The maximum number of idle pipes retained by the pool.
+    enum { k_MAX_IDLE = 64 };
+
+    Mutex             d_mutex;
+    PipeVector        d_pipes;
+    bslma::Allocator* d_allocator_p;
+
+  private:
+    IoRingPipePool(const IoRingPipePool&) BSLS_KEYWORD_DELETED;
+    IoRingPipePool& operator=(const IoRingPipePool&) BSLS_KEYWORD_DELETED;
+
+  private:
+    // Close the specified 'pipe'.
+    static void close(const ntco::IoRingPipe& pipe);
+
+  public:
+    // Create a new pipe pool. Optionally specify a 'basicAllocator' used to
+    // supply memory. If 'basicAllocator' is 0, the currently installed
+    // default allocator is used.
+    explicit IoRingPipePool(bslma::Allocator* basicAllocator = 0);
+
+    // Destroy this object.
+    ~IoRingPipePool();
+
+    // Load into the specified 'result' an empty pipe, either reused from the
+    // pool or newly created. Return the error.
+    ntsa::Error acquire(ntco::IoRingPipe* result);
+
+    // Return the specified 'pipe' to the pool. If the specified 'reuse' flag
+    // is false, or the pool retains its maximum number of idle pipes, close
+    // the 'pipe' instead. The behavior is undefined unless the 'pipe' is
+    // empty or 'reuse' is false.
+    void release(const ntco::IoRingPipe& pipe, bool reuse);
+};
+
 /// Provide utiltities for implementing I/O ring drivers.
 ///
 /// @par Thread Safety
@@ -1566,6 +1695,8 @@ const char* IoRingOperation::toString(IoRingOperation::Value mode)
     switch (mode) {
     case IoRingOperation::e_NOP:
         return "NOP";
+    case IoRingOperation::e_POLL_ADD:
+        return "POLL_ADD";
     case IoRingOperation::e_SENDMSG:
         return "SENDMSG";
     case IoRingOperation::e_RECVMSG:
@@ -1580,6 +1711,8 @@ const char* IoRingOperation::toString(IoRingOperation::Value mode)
         return "ASYNC_CANCEL";
     case IoRingOperation::e_CONNECT:
         return "CONNECT";
+    case IoRingOperation::e_SPLICE:
+        return "SPLICE";
     case IoRingOperation::e_SHUTDOWN:
         return "SHUTDOWN";
     case IoRingOperation::e_SENDMSG_ZC:
@@ -1593,6 +1726,7 @@ int IoRingOperation::fromInt(Value* result, bsl::uint8_t number)
 {
     switch (number) {
     case IoRingOperation::e_NOP:
+    case IoRingOperation::e_POLL_ADD:
     case IoRingOperation::e_SENDMSG:
     case IoRingOperation::e_RECVMSG:
     case IoRingOperation::e_TIMEOUT:
@@ -1600,6 +1734,7 @@ int IoRingOperation::fromInt(Value* result, bsl::uint8_t number)
     case IoRingOperation::e_ACCEPT:
     case IoRingOperation::e_ASYNC_CANCEL:
     case IoRingOperation::e_CONNECT:
+    case IoRingOperation::e_SPLICE:
     case IoRingOperation::e_SHUTDOWN:
     case IoRingOperation::e_SENDMSG_ZC:
         *result = static_cast<IoRingOperation::Value>(number);
@@ -2131,7 +2266,6 @@ IoRingSubmission::IoRingSubmission()
     NTCCFG_WARNING_UNUSED(d_priority);
     NTCCFG_WARNING_UNUSED(d_index);
     NTCCFG_WARNING_UNUSED(d_personality);
-    NTCCFG_WARNING_UNUSED(d_splice);
     NTCCFG_WARNING_UNUSED(d_command);
 
     bsl::memset(this, 0, sizeof(IoRingSubmission));
@@ -3019,13 +3153,46 @@ ntsa::Error IoRingSubmission::prepareSend(
     const ntsa::File&                            source,
     const ntsa::SendOptions&                     options)
 {
-    NTCCFG_WARNING_UNUSED(event);
-    NTCCFG_WARNING_UNUSED(socket);
-    NTCCFG_WARNING_UNUSED(handle);
-    NTCCFG_WARNING_UNUSED(source);
-    NTCCFG_WARNING_UNUSED(options);
+    BSLS_ASSERT(event->d_status == ntcs::EventStatus::e_FREE);
+
+    if (!options.endpoint().isNull()) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
 
-    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+    if (!options.foreignHandle().isNull()) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    if (source.bytesRemaining() <= 0) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    ntco::IoRingSplice* splice = event->message<ntco::IoRingSplice>();
+
+    BSLS_ASSERT(splice->d_pipe.d_reader >= 0);
+    BSLS_ASSERT(splice->d_pipe.d_writer >= 0);
+    BSLS_ASSERT(splice->d_pipe.d_capacity > 0);
+
+    bsl::uint64_t size = static_cast<bsl::uint64_t>(source.bytesRemaining());
+    if (size > splice->d_pipe.d_capacity) {
+        size = splice->d_pipe.d_capacity;
+    }
+
+    splice->d_phase            = ntco::IoRingSplice::e_FILL;
+    splice->d_file             = source.descriptor();
+    splice->d_fileOffset       = source.position();
+    splice->d_numBytesBuffered = 0;
+    splice->d_numBytesSent     = 0;
+
+    event->d_type              = ntcs::EventType::e_SEND;
+    event->d_status            = ntcs::EventStatus::e_PENDING;
+    event->d_socket            = socket;
+    event->d_target            = splice->d_pipe.d_reader;
+    event->d_numBytesAttempted = static_cast<bsl::size_t>(size);
+
+    this->prepareSplice(event, handle);
+
+    return ntsa::Error();
 }
 
 ntsa::Error IoRingSubmission::prepareSend(
@@ -3174,6 +3341,56 @@ ntsa::Error IoRingSubmission::prepareReceive(
     return ntsa::Error();
 }
 
+void IoRingSubmission::prepareSplice(ntcs::Event* event, ntsa::Handle handle)
+{
+    const ntco::IoRingSplice* splice = event->message<ntco::IoRingSplice>();
+
+    // Splice operations interpret an offset of -1 as an instruction to
+    // read from or write to the current position of the file descriptor,
+    // which is required for pipes and sockets.
+
+    const bsl::uint64_t k_NO_OFFSET = static_cast<bsl::uint64_t>(-1);
+
+    d_event = reinterpret_cast<bsl::uint64_t>(event);
+
+    if (splice->d_phase == ntco::IoRingSplice::e_FILL) {
+        d_operation =
+            static_cast<bsl::uint8_t>(ntco::IoRingOperation::e_SPLICE);
+        d_handle  = splice->d_pipe.d_writer;
+        d_size    = k_NO_OFFSET;
+        d_address = static_cast<bsl::uint64_t>(splice->d_fileOffset);
+        d_count   = static_cast<bsl::uint32_t>(event->d_numBytesAttempted);
+        d_options = SPLICE_F_MOVE;
+        d_splice  = static_cast<bsl::uint32_t>(splice->d_file);
+    }
+    else if (splice->d_phase == ntco::IoRingSplice::e_DRAIN) {
+        d_operation =
+            static_cast<bsl::uint8_t>(ntco::IoRingOperation::e_SPLICE);
+        d_handle  = handle;
+        d_size    = k_NO_OFFSET;
+        d_address = k_NO_OFFSET;
+        d_count   = static_cast<bsl::uint32_t>(splice->d_numBytesBuffered);
+        d_options = SPLICE_F_MOVE;
+        d_splice  = static_cast<bsl::uint32_t>(splice->d_pipe.d_reader);
+    }
+    else {
+        BSLS_ASSERT(splice->d_phase == ntco::IoRingSplice::e_POLL);
+
+        // The kernel interprets the 32-bit poll events as two half-words
+        // swapped on big-endian platforms.
+
+        bsl::uint32_t events = POLLOUT;
+#if defined(BSLS_PLATFORM_IS_BIG_ENDIAN)
+        events = (events << 16) | (events >> 16);
+#endif
+
+        d_operation =
+            static_cast<bsl::uint8_t>(ntco::IoRingOperation::e_POLL_ADD);
+        d_handle  = handle;
+        d_options = events;
+    }
+}
+
 void IoRingSubmission::prepareCancellation(ntsa::Handle handle)
 {
     const bsl::uint32_t k_CANCEL_ALL = 1U << 0;
@@ -3904,6 +4121,8 @@ ntsa::Error IoRingDevice::submit(const ntco::IoRingSubmission& entry,
 {
     NTCI_LOG_CONTEXT();
 
+    NTCS_FLIGHTRECORDER_SUBMIT(entry.handle(), entry.operation());
+
     ntsa::Error error = d_submissionQueue.push(entry, mode);
     if (error) {
         NTCO_IORING_LOG_SUBMISSION_FAILED(entry, error);
@@ -4190,6 +4409,81 @@ ntsa::Handle IoRingContext::handle() const
     return d_handle;
 }
 
+void IoRingPipePool::close(const ntco::IoRingPipe& pipe)
+{
+    ::close(pipe.d_reader);
+    ::close(pipe.d_writer);
+}
+
+IoRingPipePool::IoRingPipePool(bslma::Allocator* basicAllocator)
+: d_mutex()
+, d_pipes(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+IoRingPipePool::~IoRingPipePool()
+{
+    for (PipeVector::const_iterator it = d_pipes.begin();
+         it != d_pipes.end();
+         ++it)
+    {
+        IoRingPipePool::close(*it);
+    }
+}
+
+ntsa::Error IoRingPipePool::acquire(ntco::IoRingPipe* result)
+{
+    {
+        LockGuard lock(&d_mutex);
+
+        if (!d_pipes.empty()) {
+            *result = d_pipes.back();
+            d_pipes.pop_back();
+            return ntsa::Error();
+        }
+    }
+
+    int descriptors[2];
+    int rc = ::pipe2(descriptors, O_CLOEXEC);
+    if (rc != 0) {
+        return ntsa::Error(errno);
+    }
+
+    // Attempt to enlarge the pipe, but tolerate failure since the pipe
+    // remains usable, albeit at its default capacity.
+
+    ::fcntl(descriptors[1], F_SETPIPE_SZ, static_cast<int>(k_CAPACITY));
+
+    rc = ::fcntl(descriptors[1], F_GETPIPE_SZ);
+    if (rc < 0) {
+        ntsa::Error error(errno);
+        ::close(descriptors[0]);
+        ::close(descriptors[1]);
+        return error;
+    }
+
+    result->d_reader   = descriptors[0];
+    result->d_writer   = descriptors[1];
+    result->d_capacity = static_cast<bsl::uint32_t>(rc);
+
+    return ntsa::Error();
+}
+
+void IoRingPipePool::release(const ntco::IoRingPipe& pipe, bool reuse)
+{
+    if (reuse) {
+        LockGuard lock(&d_mutex);
+
+        if (d_pipes.size() < static_cast<bsl::size_t>(k_MAX_IDLE)) {
+            d_pipes.push_back(pipe);
+            return;
+        }
+    }
+
+    IoRingPipePool::close(pipe);
+}
+
 int IoRingUtil::setup(bsl::size_t entries, ntco::IoRingConfig* parameters)
 {
     const long k_SYSTEM_CALL_SETUP = 425;
@@ -4480,6 +4774,7 @@ class IoRing : public ntci::Proactor,
     ntccfg::Object                         d_object;
     ntco::IoRingDevice                     d_device;
     ntcs::EventPool                        d_eventPool;
+    ntco::IoRingPipePool                   d_pipePool;
     mutable Mutex                          d_contextMapMutex;
     ContextMap                             d_contextMap;
     mutable Mutex                          d_waiterSetMutex;
@@ -4522,6 +4817,14 @@ class IoRing : public ntci::Proactor,
     // has previously registered the 'waiter'.
     void wait(ntci::Waiter waiter);
 
+    // Continue the operation to send a file described by the splice state of
+    // the specified 'event' according to the specified completed 'entry'.
+    // Return true if the next phase of the operation has been submitted,
+    // otherwise release the pipe of the operation and return false,
+    // indicating the operation is complete.
+    bool continueSplice(ntcs::Event*                  event,
+                        const ntco::IoRingCompletion& entry);
+
     // Acquire usage of the most suitable proactor selected according to
     // the specified load balancing 'options'.
     bsl::shared_ptr<ntci::Proactor> acquireProactor(
@@ -4891,6 +5194,14 @@ void IoRing::flush()
 
             bslma::ManagedPtr<ntcs::Event> event(entry.event(), &d_eventPool);
 
+            if (event->d_type == ntcs::EventType::e_SEND &&
+                event->d_target != ntsa::k_INVALID_HANDLE)
+            {
+                d_pipePool.release(
+                    event->message<ntco::IoRingSplice>()->d_pipe,
+                    false);
+            }
+
             if (event->d_socket) {
                 bsl::shared_ptr<ntco::IoRingContext> context =
                     bslstl::SharedPtrUtil::staticCast<ntco::IoRingContext>(
@@ -4913,12 +5224,97 @@ void IoRing::flush()
     }
 }
 
+bool IoRing::continueSplice(ntcs::Event*                  event,
+                            const ntco::IoRingCompletion& entry)
+{
+    ntco::IoRingSplice* splice = event->message<ntco::IoRingSplice>();
+
+    if (entry.hasSucceeded()) {
+        const bsl::size_t numBytes = entry.result();
+
+        if (splice->d_phase == ntco::IoRingSplice::e_FILL) {
+            splice->d_numBytesBuffered = numBytes;
+        }
+        else if (splice->d_phase == ntco::IoRingSplice::e_DRAIN) {
+            BSLS_ASSERT(numBytes <= splice->d_numBytesBuffered);
+            splice->d_numBytesBuffered -= numBytes;
+            splice->d_numBytesSent     += numBytes;
+        }
+    }
+
+    ntsa::Handle handle = ntsa::k_INVALID_HANDLE;
+    if (event->d_socket) {
+        handle = event->d_socket->handle();
+    }
+
+    bool proceed = false;
+
+    if (event->d_status == ntcs::EventStatus::e_PENDING &&
+        handle != ntsa::k_INVALID_HANDLE &&
+        (!event->d_context || event->d_context->state() ==
+                                  ntcs::ProactorDetachState::e_ATTACHED))
+    {
+        if (entry.hasFailed()) {
+            // Splicing into a non-blocking socket whose send buffer is full
+            // fails rather than waiting for capacity, so poll the socket for
+            // writability before splicing the remainder of the pipe.
+
+            if (splice->d_phase == ntco::IoRingSplice::e_DRAIN &&
+                entry.error() == ntsa::Error(ntsa::Error::e_WOULD_BLOCK))
+            {
+                splice->d_phase = ntco::IoRingSplice::e_POLL;
+                proceed         = true;
+            }
+        }
+        else if (splice->d_phase == ntco::IoRingSplice::e_FILL) {
+            splice->d_phase = ntco::IoRingSplice::e_DRAIN;
+            proceed         = splice->d_numBytesBuffered > 0;
+        }
+        else if (splice->d_phase == ntco::IoRingSplice::e_DRAIN) {
+            proceed = splice->d_numBytesBuffered > 0;
+        }
+        else {
+            splice->d_phase = ntco::IoRingSplice::e_DRAIN;
+            proceed         = true;
+        }
+    }
+
+    if (proceed) {
+        ntco::IoRingSubmission next;
+        next.prepareSplice(event, handle);
+
+        ntco::IoRingSubmissionMode::Value mode;
+        if (NTCCFG_LIKELY(isWaiter())) {
+            mode = NTCO_IORING_DEFAULT_SUBMISSION_MODE_SEND;
+        }
+        else {
+            mode = ntco::IoRingSubmissionMode::e_IMMEDIATE;
+        }
+
+        ntsa::Error error = d_device.submit(next, mode);
+        if (!error) {
+            return true;
+        }
+
+        event->d_error = error;
+    }
+
+    // Pipes that still buffer a portion of the file are closed rather than
+    // reused, which discards that portion.
+
+    d_pipePool.release(splice->d_pipe, splice->d_numBytesBuffered == 0);
+
+    return false;
+}
+
 void IoRing::wait(ntci::Waiter waiter)
 {
     NTCCFG_WARNING_UNUSED(waiter);
 
     NTCI_LOG_CONTEXT();
 
+    NTCS_PROACTORMETRICS_GET_THREAD_LOCAL();
+
     ntsa::Error error;
 
     if (NTCCFG_UNLIKELY(d_config.maxThreads().value() > 1)) {
@@ -4943,12 +5339,23 @@ void IoRing::wait(ntci::Waiter waiter)
     const bsl::size_t entryListCapacity =
         d_config.maxThreads().value() == 1 ? ENTRY_LIST_CAPACITY : 1;
 
+    NTCS_FLIGHTRECORDER_WAIT_ENTER(
+        earliestTimerDue.isNull()
+            ? -1
+            : bsl::max(bsls::Types::Int64(0),
+                       (earliestTimerDue.value() - d_chronology.currentTime())
+                           .totalMilliseconds()));
+    NTCCFG_TRACEPOINT1(wait_enter, this);
+
     bsl::size_t entryCount = d_device.wait(waiter,
                                            entryList,
                                            entryListCapacity,
                                            1,
                                            earliestTimerDue);
 
+    NTCS_FLIGHTRECORDER_WAIT_EXIT(entryCount);
+    NTCCFG_TRACEPOINT2(wait_exit, this, entryCount);
+
     if (NTCCFG_UNLIKELY(d_config.maxThreads().value() > 1)) {
         d_semaphore.post();
     }
@@ -4964,6 +5371,15 @@ void IoRing::wait(ntci::Waiter waiter)
 
         bslma::ManagedPtr<ntcs::Event> event(entry.event(), &d_eventPool);
 
+        if (NTCCFG_UNLIKELY(event->d_type == ntcs::EventType::e_SEND &&
+                            event->d_target != ntsa::k_INVALID_HANDLE))
+        {
+            if (this->continueSplice(event.get(), entry)) {
+                event.release();
+                continue;
+            }
+        }
+
         ntsa::Error eventError;
         if (entry.hasFailed()) {
             eventError     = entry.error();
@@ -4992,6 +5408,13 @@ void IoRing::wait(ntci::Waiter waiter)
             handle = event->d_socket->handle();
         }
 
+        NTCS_FLIGHTRECORDER_COMPLETE(
+            handle,
+            entry.hasFailed()
+                ? static_cast<bsls::Types::Int64>(entry.error().number())
+                : static_cast<bsls::Types::Int64>(entry.result()),
+            entry.hasFailed());
+
         if (NTCCFG_UNLIKELY(!d_device.supportsCancelByHandle())) {
             if (event->d_socket) {
                 bsl::shared_ptr<ntco::IoRingContext> context =
@@ -5025,6 +5448,8 @@ void IoRing::wait(ntci::Waiter waiter)
                 continue;
             }
 
+            NTCS_PROACTORMETRICS_UPDATE_READ_CALLBACK_TIME_BEGIN();
+
             if (eventError) {
                 ntcs::Dispatch::announceAccepted(
                     event->d_socket,
@@ -5044,6 +5469,8 @@ void IoRing::wait(ntci::Waiter waiter)
                                                  streamSocket,
                                                  event->d_socket->strand());
             }
+
+            NTCS_PROACTORMETRICS_UPDATE_READ_CALLBACK_TIME_END(handle);
         }
         else if (event->d_type == ntcs::EventType::e_CONNECT) {
             BSLS_ASSERT(event->d_socket);
@@ -5052,6 +5479,8 @@ void IoRing::wait(ntci::Waiter waiter)
                 continue;
             }
 
+            NTCS_PROACTORMETRICS_UPDATE_WRITE_CALLBACK_TIME_BEGIN();
+
             if (eventError) {
                 ntcs::Dispatch::announceConnected(event->d_socket,
                                                   eventError,
@@ -5084,6 +5513,8 @@ void IoRing::wait(ntci::Waiter waiter)
                     }
                 }
             }
+
+            NTCS_PROACTORMETRICS_UPDATE_WRITE_CALLBACK_TIME_END(handle);
         }
         else if (event->d_type == ntcs::EventType::e_SEND) {
             BSLS_ASSERT(event->d_socket);
@@ -5093,6 +5524,8 @@ void IoRing::wait(ntci::Waiter waiter)
                 continue;
             }
 
+            NTCS_PROACTORMETRICS_UPDATE_WRITE_CALLBACK_TIME_BEGIN();
+
             ntsa::SendContext context;
             context.setBytesSendable(event->d_numBytesAttempted);
 
@@ -5104,6 +5537,39 @@ void IoRing::wait(ntci::Waiter waiter)
                                              context,
                                              event->d_socket->strand());
             }
+            else if (event->d_target != ntsa::k_INVALID_HANDLE) {
+                const ntco::IoRingSplice* splice =
+                    event->message<ntco::IoRingSplice>();
+
+                bsl::size_t numBytes =
+                    static_cast<bsl::size_t>(splice->d_numBytesSent);
+
+                if (numBytes == 0) {
+                    // The file was exhausted before any of it was spliced,
+                    // or the next phase of the operation could not be
+                    // submitted.
+
+                    ntsa::Error error = event->d_error;
+                    if (!error) {
+                        error = ntsa::Error(ntsa::Error::e_EOF);
+                    }
+
+                    ntcs::Dispatch::announceSent(event->d_socket,
+                                                 error,
+                                                 context,
+                                                 event->d_socket->strand());
+                }
+                else {
+                    event->d_numBytesCompleted = numBytes;
+
+                    context.setBytesSent(numBytes);
+
+                    ntcs::Dispatch::announceSent(event->d_socket,
+                                                 ntsa::Error(),
+                                                 context,
+                                                 event->d_socket->strand());
+                }
+            }
             else {
                 bsl::size_t numBytes = entry.result();
 
@@ -5116,6 +5582,8 @@ void IoRing::wait(ntci::Waiter waiter)
                                              context,
                                              event->d_socket->strand());
             }
+
+            NTCS_PROACTORMETRICS_UPDATE_WRITE_CALLBACK_TIME_END(handle);
         }
         else if (event->d_type == ntcs::EventType::e_RECEIVE) {
             BSLS_ASSERT(event->d_socket);
@@ -5125,6 +5593,8 @@ void IoRing::wait(ntci::Waiter waiter)
                 continue;
             }
 
+            NTCS_PROACTORMETRICS_UPDATE_READ_CALLBACK_TIME_BEGIN();
+
             ntsa::ReceiveContext context;
             context.setBytesReceivable(event->d_numBytesAttempted);
 
@@ -5185,6 +5655,8 @@ void IoRing::wait(ntci::Waiter waiter)
                         event->d_socket->strand());
                 }
             }
+
+            NTCS_PROACTORMETRICS_UPDATE_READ_CALLBACK_TIME_END(handle);
         }
         else {
             NTCO_IORING_LOG_EVENT_IGNORED(event);
@@ -5256,6 +5728,7 @@ IoRing::IoRing(const ntca::ProactorConfig&        configuration,
 : d_object("ntco::IoRing")
 , d_device(NTCO_IORING_QUEUE_DEPTH, basicAllocator)
 , d_eventPool(basicAllocator)
+, d_pipePool(basicAllocator)
 , d_contextMapMutex()
 , d_contextMap(basicAllocator)
 , d_waiterSetMutex()
@@ -5730,9 +6203,30 @@ ntsa::Error IoRing::send(const bsl::shared_ptr<ntci::ProactorSocket>& socket,
         return ntsa::Error(ntsa::Error::e_INVALID);
     }
 
+    // Files are sent by splicing them through a pipe acquired for the
+    // duration of the operation.
+
+    const bool isFile = data.isFile();
+
+    if (NTCCFG_UNLIKELY(isFile)) {
+        if (!d_device.supportsOperation(ntco::IoRingOperation::e_SPLICE)) {
+            return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+        }
+
+        error = d_pipePool.acquire(
+            &event->message<ntco::IoRingSplice>()->d_pipe);
+        if (NTCCFG_UNLIKELY(error)) {
+            return error;
+        }
+    }
+
     ntco::IoRingSubmission entry;
     error = entry.prepareSend(event.get(), socket, handle, data, options);
     if (NTCCFG_UNLIKELY(error)) {
+        if (NTCCFG_UNLIKELY(isFile)) {
+            d_pipePool.release(event->message<ntco::IoRingSplice>()->d_pipe,
+                               true);
+        }
         return error;
     }
 
@@ -5755,6 +6249,10 @@ ntsa::Error IoRing::send(const bsl::shared_ptr<ntci::ProactorSocket>& socket,
         if (NTCCFG_UNLIKELY(!d_device.supportsCancelByHandle())) {
             context->completeEvent(event.get());
         }
+        if (NTCCFG_UNLIKELY(isFile)) {
+            d_pipePool.release(event->message<ntco::IoRingSplice>()->d_pipe,
+                               true);
+        }
         return error;
     }
 
@@ -5985,6 +6483,11 @@ void IoRing::decrementLoad(const ntca::LoadBalancingOptions& options)
 
 void IoRing::run(ntci::Waiter waiter)
 {
+    IoRingWaiter* result = static_cast<IoRingWaiter*>(waiter);
+    NTCCFG_WARNING_UNUSED(result);
+
+    NTCS_PROACTORMETRICS_GET();
+
     while (d_run) {
         // Wait for an operation to complete or a timeout.
 
@@ -6008,6 +6511,11 @@ void IoRing::run(ntci::Waiter waiter)
 
 void IoRing::poll(ntci::Waiter waiter)
 {
+    IoRingWaiter* result = static_cast<IoRingWaiter*>(waiter);
+    NTCCFG_WARNING_UNUSED(result);
+
+    NTCS_PROACTORMETRICS_GET();
+
     // Wait for an operation to complete or a timeout.
 
     this->wait(waiter);
@@ -23,7 +23,12 @@
 #include <ntci_log.h>
 #include <ntci_proactor.h>
 #include <ntci_proactorsocket.h>
+#include <ntsa_data.h>
+#include <ntsa_file.h>
+#include <ntsa_temporary.h>
 #include <ntsf_system.h>
+#include <ntsu_socketoptionutil.h>
+#include <ntsu_socketutil.h>
 #include <bdlb_guid.h>
 #include <bdlb_guidutil.h>
 #include <bdlbb_blob.h>
@@ -32,6 +37,7 @@
 #include <bdlf_bind.h>
 #include <bdlf_memfn.h>
 #include <bdlf_placeholder.h>
+#include <bdls_filesystemutil.h>
 #include <bslmt_barrier.h>
 #include <bslmt_latch.h>
 #include <bslmt_semaphore.h>
@@ -2351,12 +2357,490 @@ NTCCFG_TEST_CASE(4)
     NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
 
+namespace test {
+namespace case5 {
+
+class FileSender : public ntci::ProactorSocket,
+                   public ntccfg::Shared<FileSender>
+{
+    // Provide an implementation of a proactor socket that sends files for
+    // use by this test driver. Each completion is recorded in the order in
+    // which it is announced.
+
+    ntsa::Handle             d_handle;
+    bsl::vector<ntsa::Error> d_errors;
+    bsl::vector<bsl::size_t> d_bytesSent;
+    bool                     d_detached;
+
+  private:
+    FileSender(const FileSender&) BSLS_KEYWORD_DELETED;
+    FileSender& operator=(const FileSender&) BSLS_KEYWORD_DELETED;
+
+  private:
+    void processSocketSent(const ntsa::Error&       error,
+                           const ntsa::SendContext& context)
+        BSLS_KEYWORD_OVERRIDE;
+    // Process the completion of the transmission of data described by the
+    // specified 'context' or the specified 'error'.
+
+    void processSocketDetached() BSLS_KEYWORD_OVERRIDE;
+    // Process the completion of socket detachment.
+
+    bool isStream() const BSLS_KEYWORD_OVERRIDE;
+    // Return true if the proactor socket has stream semantics, otherwise
+    // return false.
+
+    ntsa::Handle handle() const BSLS_KEYWORD_OVERRIDE;
+    // Return the handle to the descriptor.
+
+  public:
+    explicit FileSender(ntsa::Handle      handle,
+                        bslma::Allocator* basicAllocator = 0);
+    // Create a new proactor socket that sends files through the specified
+    // 'handle'. Optionally specify a 'basicAllocator' used to supply
+    // memory. If 'basicAllocator' is 0, the currently installed default
+    // allocator is used.
+
+    ~FileSender() BSLS_KEYWORD_OVERRIDE;
+    // Destroy this object.
+
+    void close() BSLS_KEYWORD_OVERRIDE;
+    // Close the socket.
+
+    bsl::size_t numCompletions() const;
+    // Return the number of send operations that have completed.
+
+    ntsa::Error error(bsl::size_t index) const;
+    // Return the error of the send operation at the specified 'index' in
+    // the order of completion.
+
+    bsl::size_t bytesSent(bsl::size_t index) const;
+    // Return the number of bytes sent by the send operation at the
+    // specified 'index' in the order of completion.
+
+    bool isDetached() const;
+    // Return true if the socket has been detached from its proactor,
+    // otherwise return false.
+};
+
+void FileSender::processSocketSent(const ntsa::Error&       error,
+                                   const ntsa::SendContext& context)
+{
+    NTCCFG_TEST_LOG_DEBUG << "Proactor stream socket descriptor " << d_handle
+                          << " sent " << context.bytesSent() << "/"
+                          << context.bytesSendable()
+                          << " bytes: " << error << NTCCFG_TEST_LOG_END;
+
+    d_errors.push_back(error);
+    d_bytesSent.push_back(context.bytesSent());
+}
+
+void FileSender::processSocketDetached()
+{
+    d_detached = true;
+}
+
+bool FileSender::isStream() const
+{
+    return true;
+}
+
+ntsa::Handle FileSender::handle() const
+{
+    return d_handle;
+}
+
+FileSender::FileSender(ntsa::Handle handle, bslma::Allocator* basicAllocator)
+: d_handle(handle)
+, d_errors(basicAllocator)
+, d_bytesSent(basicAllocator)
+, d_detached(false)
+{
+}
+
+FileSender::~FileSender()
+{
+    this->close();
+}
+
+void FileSender::close()
+{
+    if (d_handle != ntsa::k_INVALID_HANDLE) {
+        ntsu::SocketUtil::close(d_handle);
+        d_handle = ntsa::k_INVALID_HANDLE;
+    }
+}
+
+bsl::size_t FileSender::numCompletions() const
+{
+    return d_errors.size();
+}
+
+ntsa::Error FileSender::error(bsl::size_t index) const
+{
+    return d_errors[index];
+}
+
+bsl::size_t FileSender::bytesSent(bsl::size_t index) const
+{
+    return d_bytesSent[index];
+}
+
+bool FileSender::isDetached() const
+{
+    return d_detached;
+}
+
+void receiveAll(ntsa::Handle socket, bsl::string* result, bsl::size_t size)
+{
+    // Append to the specified 'result' the specified 'size' bytes received
+    // from the specified blocking 'socket'.
+
+    char buffer[4096];
+
+    while (result->size() < size) {
+        ntsa::ReceiveContext context;
+        ntsa::Error          error =
+            ntsu::SocketUtil::receive(&context,
+                                      buffer,
+                                      sizeof buffer,
+                                      ntsa::ReceiveOptions(),
+                                      socket);
+        NTCCFG_TEST_OK(error);
+        NTCCFG_TEST_GT(context.bytesReceived(), 0);
+
+        if (error || context.bytesReceived() == 0) {
+            break;
+        }
+
+        result->append(buffer, context.bytesReceived());
+    }
+}
+
+ntsa::Error sendFile(bsl::size_t*                           result,
+                     const bsl::shared_ptr<ntci::Proactor>& proactor,
+                     ntci::Waiter                           waiter,
+                     const bsl::shared_ptr<FileSender>&     sender,
+                     bdls::FilesystemUtil::FileDescriptor   file,
+                     bsl::size_t                            fileSize,
+                     bsl::size_t                            position,
+                     bsl::size_t                            numBytes,
+                     bslma::Allocator*                      allocator)
+{
+    // Send the specified 'numBytes' of the specified 'file' having the
+    // specified 'fileSize' starting at the specified 'position' through the
+    // specified 'sender' attached to the specified 'proactor', polling the
+    // 'proactor' with the specified 'waiter' until the send operation
+    // completes. Load into the specified 'result' the number of bytes sent.
+    // Use the specified 'allocator' to supply memory. Return the error.
+
+    ntsa::File source(
+        file,
+        static_cast<bdls::FilesystemUtil::Offset>(position),
+        static_cast<bdls::FilesystemUtil::Offset>(fileSize));
+    source.setBytesRemaining(
+        static_cast<bdls::FilesystemUtil::Offset>(numBytes));
+
+    ntsa::Data data(source, allocator);
+
+    const bsl::size_t index = sender->numCompletions();
+
+    ntsa::Error error = proactor->send(sender, data, ntsa::SendOptions());
+    if (error) {
+        return error;
+    }
+
+    while (sender->numCompletions() == index) {
+        proactor->poll(waiter);
+    }
+
+    *result = sender->bytesSent(index);
+    return sender->error(index);
+}
+
+void execute(bslma::Allocator* allocator)
+{
+    ntsa::Error error;
+
+    // Create a file larger than the capacity of the pipes through which
+    // files are spliced. The value of each byte depends on its position, so
+    // that bytes sent out of order, or left over in a pipe from a previous
+    // splice, are detected.
+
+    const bsl::size_t k_FILE_SIZE = 1024 * 1024 + 123;
+
+    bsl::string content(allocator);
+    content.resize(k_FILE_SIZE);
+    for (bsl::size_t i = 0; i < k_FILE_SIZE; ++i) {
+        content[i] = static_cast<char>(i % 251);
+    }
+
+    ntsa::TemporaryFile tempFile(allocator);
+
+    error = tempFile.write(content);
+    NTCCFG_TEST_OK(error);
+
+    bdls::FilesystemUtil::FileDescriptor file =
+        bdls::FilesystemUtil::open(tempFile.path(),
+                                   bdls::FilesystemUtil::e_OPEN,
+                                   bdls::FilesystemUtil::e_READ_ONLY);
+    NTCCFG_TEST_NE(file, bdls::FilesystemUtil::k_INVALID_FD);
+
+    // Create the user.
+
+    bsl::shared_ptr<ntci::User> user;
+
+    // Create the proactor.
+
+    ntca::ProactorConfig proactorConfig;
+
+    proactorConfig.setMetricName("test");
+    proactorConfig.setMinThreads(1);
+    proactorConfig.setMaxThreads(1);
+
+    bsl::shared_ptr<ntco::IoRingFactory> proactorFactory;
+    proactorFactory.createInplace(allocator, allocator);
+
+    bsl::shared_ptr<ntci::Proactor> proactor =
+        proactorFactory->createProactor(proactorConfig, user, allocator);
+
+    // Register this thread as a thread that will wait on the proactor.
+
+    ntci::Waiter waiter = proactor->registerWaiter(ntca::WaiterOptions());
+
+    // Cancel a splice while it is in flight: shrink the socket buffers so
+    // that the splice stalls once they are full, since nothing is received
+    // by the peer.
+
+    {
+        ntsa::Handle client = ntsa::k_INVALID_HANDLE;
+        ntsa::Handle server = ntsa::k_INVALID_HANDLE;
+
+        error = ntsf::System::createStreamSocketPair(
+            &client,
+            &server,
+            ntsa::Transport::e_TCP_IPV4_STREAM);
+        NTCCFG_TEST_OK(error);
+
+        error = ntsu::SocketOptionUtil::setSendBufferSize(client, 4096);
+        NTCCFG_TEST_OK(error);
+
+        error = ntsu::SocketOptionUtil::setReceiveBufferSize(server, 4096);
+        NTCCFG_TEST_OK(error);
+
+        error = ntsu::SocketOptionUtil::setBlocking(client, false);
+        NTCCFG_TEST_OK(error);
+
+        bsl::shared_ptr<FileSender> sender;
+        sender.createInplace(allocator, client, allocator);
+
+        error = proactor->attachSocket(sender);
+        NTCCFG_TEST_OK(error);
+
+        ntsa::File source(
+            file,
+            0,
+            static_cast<bdls::FilesystemUtil::Offset>(k_FILE_SIZE));
+        source.setBytesRemaining(
+            static_cast<bdls::FilesystemUtil::Offset>(k_FILE_SIZE));
+
+        ntsa::Data data(source, allocator);
+
+        error = proactor->send(sender, data, ntsa::SendOptions());
+        NTCCFG_TEST_OK(error);
+
+        // Drive the splice until it stalls on the full socket buffers.
+
+        ntca::TimerOptions timerOptions;
+        timerOptions.setOneShot(true);
+        timerOptions.showEvent(ntca::TimerEventType::e_DEADLINE);
+        timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
+        timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
+
+        bsl::shared_ptr<test::case2::TimerSession> timerSession;
+        timerSession.createInplace(allocator, "timer", allocator);
+
+        bsl::shared_ptr<ntci::Timer> timer = proactor->createTimer(
+            timerOptions,
+            static_cast<bsl::shared_ptr<ntci::TimerSession> >(timerSession),
+            allocator);
+
+        timer->schedule(timer->currentTime() +
+                        bsls::TimeInterval(0, 100 * 1000 * 1000));
+
+        while (!timerSession->tryWait(ntca::TimerEventType::e_DEADLINE)) {
+            proactor->poll(waiter);
+        }
+
+        NTCCFG_TEST_EQ(sender->numCompletions(), 0);
+
+        // Cancel the splice and detach the socket.
+
+        error = proactor->cancel(sender);
+        NTCCFG_TEST_OK(error);
+
+        error = proactor->detachSocket(sender);
+        NTCCFG_TEST_OK(error);
+
+        while (!sender->isDetached()) {
+            proactor->poll(waiter);
+        }
+
+        // The cancelled splice is either not announced, or announced as
+        // cancelled.
+
+        NTCCFG_TEST_LE(sender->numCompletions(), 1);
+        if (sender->numCompletions() == 1) {
+            NTCCFG_TEST_EQ(sender->error(0), ntsa::Error::e_CANCELLED);
+        }
+
+        sender->close();
+        ntsu::SocketUtil::close(server);
+    }
+
+    // Send the file through a sequence of splices, each of which is limited
+    // to the capacity of the pipe, then send a region that extends beyond
+    // the end of the file, which is only partially sent, then a region that
+    // begins at the end of the file, which fails. Note that the pipe of the
+    // cancelled splice above still buffers a portion of the file, so it
+    // must not be reused by these splices.
+
+    {
+        ntsa::Handle client = ntsa::k_INVALID_HANDLE;
+        ntsa::Handle server = ntsa::k_INVALID_HANDLE;
+
+        error = ntsf::System::createStreamSocketPair(
+            &client,
+            &server,
+            ntsa::Transport::e_TCP_IPV4_STREAM);
+        NTCCFG_TEST_OK(error);
+
+        error = ntsu::SocketOptionUtil::setBlocking(client, false);
+        NTCCFG_TEST_OK(error);
+
+        bsl::shared_ptr<FileSender> sender;
+        sender.createInplace(allocator, client, allocator);
+
+        error = proactor->attachSocket(sender);
+        NTCCFG_TEST_OK(error);
+
+        const bsl::size_t k_PARTIAL_SIZE = 100;
+
+        bsl::string received(allocator);
+
+        bslmt::ThreadUtil::Handle thread = bslmt::ThreadUtil::invalidHandle();
+        bslmt::ThreadUtil::create(&thread,
+                                  NTCCFG_BIND(&receiveAll,
+                                              server,
+                                              &received,
+                                              k_FILE_SIZE + k_PARTIAL_SIZE));
+        NTCCFG_TEST_ASSERT(thread != bslmt::ThreadUtil::invalidHandle());
+
+        bsl::size_t position = 0;
+        bsl::size_t numSends = 0;
+
+        while (position < k_FILE_SIZE) {
+            bsl::size_t numBytesSent = 0;
+            error = sendFile(&numBytesSent,
+                             proactor,
+                             waiter,
+                             sender,
+                             file,
+                             k_FILE_SIZE,
+                             position,
+                             k_FILE_SIZE - position,
+                             allocator);
+            NTCCFG_TEST_OK(error);
+            NTCCFG_TEST_GT(numBytesSent, 0);
+
+            position += numBytesSent;
+            ++numSends;
+        }
+
+        NTCCFG_TEST_EQ(position, k_FILE_SIZE);
+        NTCCFG_TEST_GT(numSends, 1);
+
+        bsl::size_t numBytesSent = 0;
+        error = sendFile(&numBytesSent,
+                         proactor,
+                         waiter,
+                         sender,
+                         file,
+                         k_FILE_SIZE,
+                         k_FILE_SIZE - k_PARTIAL_SIZE,
+                         k_PARTIAL_SIZE * 10,
+                         allocator);
+        NTCCFG_TEST_OK(error);
+        NTCCFG_TEST_EQ(numBytesSent, k_PARTIAL_SIZE);
+
+        error = sendFile(&numBytesSent,
+                         proactor,
+                         waiter,
+                         sender,
+                         file,
+                         k_FILE_SIZE,
+                         k_FILE_SIZE,
+                         k_PARTIAL_SIZE,
+                         allocator);
+        NTCCFG_TEST_EQ(error, ntsa::Error::e_EOF);
+
+        bslmt::ThreadUtil::join(thread);
+
+        NTCCFG_TEST_EQ(received.size(), k_FILE_SIZE + k_PARTIAL_SIZE);
+        NTCCFG_TEST_TRUE(received.substr(0, k_FILE_SIZE) == content);
+        NTCCFG_TEST_TRUE(
+            received.substr(k_FILE_SIZE) ==
+            content.substr(k_FILE_SIZE - k_PARTIAL_SIZE));
+
+        error = proactor->detachSocket(sender);
+        NTCCFG_TEST_OK(error);
+
+        while (!sender->isDetached()) {
+            proactor->poll(waiter);
+        }
+
+        sender->close();
+        ntsu::SocketUtil::close(server);
+    }
+
+    // Deregister the waiter.
+
+    proactor->deregisterWaiter(waiter);
+
+    bdls::FilesystemUtil::close(file);
+}
+
+}  // close namespace case5
+}  // close namespace test
+
+NTCCFG_TEST_CASE(5)
+{
+    // Concern: Files are sent by splicing them through a pipe: a file larger
+    // than the pipe is sent by a sequence of splices, a region extending
+    // beyond the end of a file is partially sent, and a splice cancelled
+    // while in flight is abandoned without corrupting subsequent splices.
+
+    NTCI_LOG_CONTEXT();
+    NTCI_LOG_CONTEXT_GUARD_OWNER("test");
+
+    if (!ntco::IoRingFactory::isSupported()) {
+        return;
+    }
+
+    ntccfg::TestAllocator ta;
+    {
+        test::case5::execute(&ta);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
     NTCCFG_TEST_REGISTER(2);
     NTCCFG_TEST_REGISTER(3);
     NTCCFG_TEST_REGISTER(4);
+    NTCCFG_TEST_REGISTER(5);
 }
 NTCCFG_TEST_DRIVER_END;
 
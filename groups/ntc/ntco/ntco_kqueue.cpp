@@ -2033,7 +2033,8 @@ void Kqueue::run(ntci::Waiter waiter)
                         if (entry->announceError(event)) {
                             ++numErrors;
                         }
-                        NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END();
+                        NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END(
+                            descriptorHandle);
                     }
                     else {
                         if (e.filter == EVFILT_WRITE) {
@@ -2046,7 +2047,8 @@ void Kqueue::run(ntci::Waiter waiter)
                             if (entry->announceWritable(event)) {
                                 ++numWritable;
                             }
-                            NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END();
+                            NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END(
+                                descriptorHandle);
                         }
 
                         if (e.filter == EVFILT_READ) {
@@ -2059,7 +2061,8 @@ void Kqueue::run(ntci::Waiter waiter)
                             if (entry->announceReadable(event)) {
                                 ++numReadable;
                             }
-                            NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END();
+                            NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END(
+                                descriptorHandle);
                         }
                     }
                 }
@@ -2227,7 +2230,8 @@ void Kqueue::poll(ntci::Waiter waiter)
                     if (entry->announceError(event)) {
                         ++numErrors;
                     }
-                    NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END();
+                    NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END(
+                        descriptorHandle);
                 }
                 else {
                     if (e.filter == EVFILT_WRITE) {
@@ -2240,7 +2244,8 @@ void Kqueue::poll(ntci::Waiter waiter)
                         if (entry->announceWritable(event)) {
                             ++numWritable;
                         }
-                        NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END();
+                        NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END(
+                            descriptorHandle);
                     }
 
                     if (e.filter == EVFILT_READ) {
@@ -2253,7 +2258,8 @@ void Kqueue::poll(ntci::Waiter waiter)
                         if (entry->announceReadable(event)) {
                             ++numReadable;
                         }
-                        NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END();
+                        NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END(
+                            descriptorHandle);
                     }
                 }
             }
@@ -2244,7 +2244,8 @@ void Poll::run(ntci::Waiter waiter)
                         if (entry->announceError(event)) {
                             ++numErrors;
                         }
-                        NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END();
+                        NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END(
+                            descriptorHandle);
                     }
                 }
                 if (NTCCFG_LIKELY(!fatalSocketError)) {
@@ -2260,7 +2261,8 @@ void Poll::run(ntci::Waiter waiter)
                             if (entry->announceWritable(event)) {
                                 ++numWritable;
                             }
-                            NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END();
+                            NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END(
+                                descriptorHandle);
                         }
                     }
 
@@ -2276,7 +2278,8 @@ void Poll::run(ntci::Waiter waiter)
                             if (entry->announceReadable(event)) {
                                 ++numReadable;
                             }
-                            NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END();
+                            NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END(
+                                descriptorHandle);
                         }
                     }
                 }
@@ -2624,7 +2627,8 @@ void Poll::poll(ntci::Waiter waiter)
                     if (entry->announceError(event)) {
                         ++numErrors;
                     }
-                    NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END();
+                    NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END(
+                        descriptorHandle);
                 }
             }
             if (NTCCFG_LIKELY(!fatalSocketError)) {
@@ -2640,7 +2644,8 @@ void Poll::poll(ntci::Waiter waiter)
                         if (entry->announceWritable(event)) {
                             ++numWritable;
                         }
-                        NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END();
+                        NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END(
+                            descriptorHandle);
                     }
                 }
 
@@ -2656,7 +2661,8 @@ void Poll::poll(ntci::Waiter waiter)
                         if (entry->announceReadable(event)) {
                             ++numReadable;
                         }
-                        NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END();
+                        NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END(
+                            descriptorHandle);
                     }
                 }
             }
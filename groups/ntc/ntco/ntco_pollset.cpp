@@ -2154,7 +2154,8 @@ void Pollset::run(ntci::Waiter waiter)
                     if (entry->announceError(event)) {
                         ++numErrors;
                     }
-                    NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END();
+                    NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END(
+                        descriptorHandle);
                 }
                 else {
                     if ((e.revents & POLLOUT) != 0) {
@@ -2166,7 +2167,8 @@ void Pollset::run(ntci::Waiter waiter)
                         if (entry->announceWritable(event)) {
                             ++numWritable;
                         }
-                        NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END();
+                        NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END(
+                            descriptorHandle);
                     }
 
                     if (((e.revents & POLLIN) != 0) ||
@@ -2180,7 +2182,8 @@ void Pollset::run(ntci::Waiter waiter)
                         if (entry->announceReadable(event)) {
                             ++numReadable;
                         }
-                        NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END();
+                        NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END(
+                            descriptorHandle);
                     }
                 }
 
@@ -2485,7 +2488,7 @@ void Pollset::poll(ntci::Waiter waiter)
                 if (entry->announceError(event)) {
                     ++numErrors;
                 }
-                NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END();
+                NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END(descriptorHandle);
             }
             else {
                 if ((e.revents & POLLOUT) != 0) {
@@ -2497,7 +2500,8 @@ void Pollset::poll(ntci::Waiter waiter)
                     if (entry->announceWritable(event)) {
                         ++numWritable;
                     }
-                    NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END();
+                    NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END(
+                        descriptorHandle);
                 }
 
                 if (((e.revents & POLLIN) != 0) ||
@@ -2511,7 +2515,8 @@ void Pollset::poll(ntci::Waiter waiter)
                     if (entry->announceReadable(event)) {
                         ++numReadable;
                     }
-                    NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END();
+                    NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END(
+                        descriptorHandle);
                 }
             }
 
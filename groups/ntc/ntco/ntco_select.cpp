@@ -2199,7 +2199,8 @@ void Select::run(ntci::Waiter waiter)
                     if (entry->announceError(event)) {
                         ++numErrors;
                     }
-                    NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END();
+                    NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END(
+                        descriptorHandle);
                 }
                 else {
                     if (isWritable) {
@@ -2212,7 +2213,8 @@ void Select::run(ntci::Waiter waiter)
                             if (entry->announceWritable(event)) {
                                 ++numWritable;
                             }
-                            NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END();
+                            NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END(
+                                descriptorHandle);
                         }
                     }
 
@@ -2226,7 +2228,8 @@ void Select::run(ntci::Waiter waiter)
                             if (entry->announceReadable(event)) {
                                 ++numReadable;
                             }
-                            NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END();
+                            NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END(
+                                descriptorHandle);
                         }
                     }
                 }
@@ -2632,7 +2635,7 @@ void Select::poll(ntci::Waiter waiter)
                 if (entry->announceError(event)) {
                     ++numErrors;
                 }
-                NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END();
+                NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END(descriptorHandle);
             }
             else {
                 if (isWritable) {
@@ -2645,7 +2648,8 @@ void Select::poll(ntci::Waiter waiter)
                         if (entry->announceWritable(event)) {
                             ++numWritable;
                         }
-                        NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END();
+                        NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END(
+                            descriptorHandle);
                     }
                 }
 
@@ -2659,7 +2663,8 @@ void Select::poll(ntci::Waiter waiter)
                         if (entry->announceReadable(event)) {
                             ++numReadable;
                         }
-                        NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END();
+                        NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END(
+                            descriptorHandle);
                     }
                 }
             }
@@ -569,37 +569,10 @@ void DatagramSocket::privateCompleteReceive(
 
         BSLS_ASSERT(d_receiveQueue.hasEntry());
 
-        ntcq::ReceiveQueueEntry& entry = d_receiveQueue.frontEntry();
-
-        bdlb::NullableValue<ntsa::Endpoint> queuedEndpoint = entry.endpoint();
-        bsl::shared_ptr<bdlbb::Blob>        queuedData     = entry.data();
-
-        NTCS_METRICS_UPDATE_READ_QUEUE_DELAY(entry.delay());
-
-        d_receiveQueue.popEntry();
-
-        NTCP_DATAGRAMSOCKET_LOG_READ_QUEUE_DRAINED(d_receiveQueue.size());
-
-        NTCS_METRICS_UPDATE_READ_QUEUE_SIZE(d_receiveQueue.size());
-
-        ntca::ReceiveContext receiveContext;
-        receiveContext.setTransport(d_transport);
-        if (!queuedEndpoint.isNull()) {
-            receiveContext.setEndpoint(queuedEndpoint.value());
-        }
-
-        ntca::ReceiveEvent receiveEvent;
-        receiveEvent.setType(ntca::ReceiveEventType::e_COMPLETE);
-        receiveEvent.setContext(receiveContext);
-
-        ntcq::ReceiveCallbackQueueEntry::dispatch(callbackEntry,
-                                                  self,
-                                                  queuedData,
-                                                  receiveEvent,
-                                                  d_proactorStrand_sp,
-                                                  self,
-                                                  false,
-                                                  &d_mutex);
+        this->privateSatisfyReceive(self,
+                                    callbackEntry,
+                                    d_proactorStrand_sp,
+                                    false);
     }
 
     if (d_receiveQueue.authorizeLowWatermarkEvent()) {
@@ -651,6 +624,185 @@ void DatagramSocket::privateCompleteReceive(
     }
 }
 
+ntsa::Error DatagramSocket::privateReceive(
+    const bsl::shared_ptr<DatagramSocket>&                  self,
+    const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& callbackEntry)
+{
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_CONTEXT_GUARD_DESCRIPTOR(d_publicHandle);
+    NTCI_LOG_CONTEXT_GUARD_SOURCE_ENDPOINT(d_sourceEndpoint);
+
+    ntsa::Error error;
+
+    const ntca::ReceiveOptions& options = callbackEntry->options();
+
+    if (NTCCFG_UNLIKELY(!d_receiveQueue.hasEntry() &&
+                        !d_shutdownState.canReceive()))
+    {
+        return ntsa::Error(ntsa::Error::e_EOF);
+    }
+
+    if (NTCCFG_LIKELY(!d_receiveQueue.hasCallbackEntry() &&
+                      d_receiveQueue.hasEntry()))
+    {
+        bool receiveQueueHighWatermarkViolatedBefore =
+            d_receiveQueue.isHighWatermarkViolated();
+
+        const bool defer = !options.recurse();
+
+        this->privateSatisfyReceive(self,
+                                    callbackEntry,
+                                    ntci::Strand::unknown(),
+                                    defer);
+
+        bool receiveQueueHighWatermarkViolatedAfter =
+            d_receiveQueue.isHighWatermarkViolated();
+
+        if (receiveQueueHighWatermarkViolatedBefore &&
+            !receiveQueueHighWatermarkViolatedAfter)
+        {
+            this->privateRelaxFlowControl(self,
+                                          ntca::FlowControlType::e_RECEIVE,
+                                          true,
+                                          false);
+        }
+
+        error = ntsa::Error::e_OK;
+    }
+    else {
+        if (!options.deadline().isNull()) {
+            ntca::TimerOptions timerOptions;
+            timerOptions.setOneShot(true);
+            timerOptions.showEvent(ntca::TimerEventType::e_DEADLINE);
+            timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
+            timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
+
+            ntci::TimerCallback timerCallback = this->createTimerCallback(
+                bdlf::BindUtil::bind(
+                    &DatagramSocket::processReceiveDeadlineTimer,
+                    self,
+                    bdlf::PlaceHolders::_1,
+                    bdlf::PlaceHolders::_2,
+                    callbackEntry),
+                d_allocator_p);
+
+            bsl::shared_ptr<ntci::Timer> timer =
+                this->createTimer(timerOptions, timerCallback, d_allocator_p);
+
+            callbackEntry->setTimer(timer);
+
+            timer->schedule(options.deadline().value());
+        }
+
+        d_receiveQueue.pushCallbackEntry(callbackEntry);
+        error = ntsa::Error::e_WOULD_BLOCK;
+    }
+
+    BSLS_ASSERT(error == ntsa::Error::e_OK ||
+                error == ntsa::Error::e_WOULD_BLOCK);
+
+    if (error == ntsa::Error::e_WOULD_BLOCK) {
+        this->privateRelaxFlowControl(self,
+                                      ntca::FlowControlType::e_RECEIVE,
+                                      true,
+                                      false);
+        error = ntsa::Error::e_OK;
+    }
+
+    return error;
+}
+
+void DatagramSocket::privateSatisfyReceive(
+    const bsl::shared_ptr<DatagramSocket>&                  self,
+    const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& callbackEntry,
+    const bsl::shared_ptr<ntci::Strand>&                    strand,
+    bool                                                    defer)
+{
+    NTCI_LOG_CONTEXT();
+
+    const ntca::ReceiveOptions& options = callbackEntry->options();
+
+    bsl::vector<ntci::ReceiveResult> results(d_allocator_p);
+
+    bsl::size_t numBytesBatched = 0;
+
+    while (true) {
+        BSLS_ASSERT(d_receiveQueue.hasEntry());
+
+        ntcq::ReceiveQueueEntry& entry = d_receiveQueue.frontEntry();
+
+        bdlb::NullableValue<ntsa::Endpoint> endpoint = entry.endpoint();
+        bsl::shared_ptr<bdlbb::Blob>        data     = entry.data();
+
+        NTCS_METRICS_UPDATE_READ_QUEUE_DELAY(entry.delay());
+
+        d_receiveQueue.popEntry();
+
+        NTCP_DATAGRAMSOCKET_LOG_READ_QUEUE_DRAINED(d_receiveQueue.size());
+
+        NTCS_METRICS_UPDATE_READ_QUEUE_SIZE(d_receiveQueue.size());
+
+        ntca::ReceiveContext receiveContext;
+        receiveContext.setTransport(d_transport);
+        if (!endpoint.isNull()) {
+            receiveContext.setEndpoint(endpoint.value());
+        }
+
+        ntca::ReceiveEvent receiveEvent;
+        receiveEvent.setType(ntca::ReceiveEventType::e_COMPLETE);
+        receiveEvent.setContext(receiveContext);
+
+        if (NTCCFG_LIKELY(!callbackEntry->isBatch())) {
+            ntcq::ReceiveCallbackQueueEntry::dispatch(callbackEntry,
+                                                      self,
+                                                      data,
+                                                      receiveEvent,
+                                                      strand,
+                                                      self,
+                                                      defer,
+                                                      &d_mutex);
+            return;
+        }
+
+        numBytesBatched += static_cast<bsl::size_t>(data->length());
+
+        results.resize(results.size() + 1);
+        results.back().setData(data);
+        results.back().setEvent(receiveEvent);
+
+        if (results.size() >= options.maxMessages()) {
+            break;
+        }
+
+        if (!d_receiveQueue.hasEntry()) {
+            break;
+        }
+
+        if (numBytesBatched + d_receiveQueue.frontEntry().length() >
+            options.maxSize())
+        {
+            break;
+        }
+    }
+
+    ntca::ReceiveContext receiveContext;
+    receiveContext.setTransport(d_transport);
+
+    ntca::ReceiveEvent receiveEvent;
+    receiveEvent.setType(ntca::ReceiveEventType::e_COMPLETE);
+    receiveEvent.setContext(receiveContext);
+
+    ntcq::ReceiveCallbackQueueEntry::dispatch(callbackEntry,
+                                              self,
+                                              results,
+                                              receiveEvent,
+                                              strand,
+                                              self,
+                                              defer,
+                                              &d_mutex);
+}
+
 void DatagramSocket::privateFailReceive(
     const bsl::shared_ptr<DatagramSocket>& self,
     const ntsa::Error&                     error)
@@ -2976,118 +3128,35 @@ ntsa::Error DatagramSocket::receive(const ntca::ReceiveOptions&  options,
 
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
-    NTCI_LOG_CONTEXT();
-
-    NTCI_LOG_CONTEXT_GUARD_DESCRIPTOR(d_publicHandle);
-    NTCI_LOG_CONTEXT_GUARD_SOURCE_ENDPOINT(d_sourceEndpoint);
-
-    ntsa::Error error;
-
-    if (NTCCFG_UNLIKELY(!d_receiveQueue.hasEntry() &&
-                        !d_shutdownState.canReceive()))
-    {
-        return ntsa::Error(ntsa::Error::e_EOF);
-    }
-
     bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry> callbackEntry =
         d_receiveQueue.createCallbackEntry();
     callbackEntry->assign(callback, options);
 
-    if (NTCCFG_LIKELY(!d_receiveQueue.hasCallbackEntry() &&
-                      d_receiveQueue.hasEntry()))
-    {
-        bool receiveQueueHighWatermarkViolatedBefore =
-            d_receiveQueue.isHighWatermarkViolated();
-
-        ntcq::ReceiveQueueEntry& entry = d_receiveQueue.frontEntry();
-
-        bdlb::NullableValue<ntsa::Endpoint> endpoint = entry.endpoint();
-        bsl::shared_ptr<bdlbb::Blob>        data     = entry.data();
-
-        NTCS_METRICS_UPDATE_READ_QUEUE_DELAY(entry.delay());
-
-        d_receiveQueue.popEntry();
-
-        NTCP_DATAGRAMSOCKET_LOG_READ_QUEUE_DRAINED(d_receiveQueue.size());
-
-        NTCS_METRICS_UPDATE_READ_QUEUE_SIZE(d_receiveQueue.size());
-
-        ntca::ReceiveContext receiveContext;
-        receiveContext.setTransport(d_transport);
-        if (!endpoint.isNull()) {
-            receiveContext.setEndpoint(endpoint.value());
-        }
-
-        ntca::ReceiveEvent receiveEvent;
-        receiveEvent.setType(ntca::ReceiveEventType::e_COMPLETE);
-        receiveEvent.setContext(receiveContext);
-
-        const bool defer = !options.recurse();
-
-        ntcq::ReceiveCallbackQueueEntry::dispatch(callbackEntry,
-                                                  self,
-                                                  data,
-                                                  receiveEvent,
-                                                  ntci::Strand::unknown(),
-                                                  self,
-                                                  defer,
-                                                  &d_mutex);
-
-        bool receiveQueueHighWatermarkViolatedAfter =
-            d_receiveQueue.isHighWatermarkViolated();
-
-        if (receiveQueueHighWatermarkViolatedBefore &&
-            !receiveQueueHighWatermarkViolatedAfter)
-        {
-            this->privateRelaxFlowControl(self,
-                                          ntca::FlowControlType::e_RECEIVE,
-                                          true,
-                                          false);
-        }
-
-        error = ntsa::Error::e_OK;
-    }
-    else {
-        if (!options.deadline().isNull()) {
-            ntca::TimerOptions timerOptions;
-            timerOptions.setOneShot(true);
-            timerOptions.showEvent(ntca::TimerEventType::e_DEADLINE);
-            timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
-            timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
-
-            ntci::TimerCallback timerCallback = this->createTimerCallback(
-                bdlf::BindUtil::bind(
-                    &DatagramSocket::processReceiveDeadlineTimer,
-                    self,
-                    bdlf::PlaceHolders::_1,
-                    bdlf::PlaceHolders::_2,
-                    callbackEntry),
-                d_allocator_p);
-
-            bsl::shared_ptr<ntci::Timer> timer =
-                this->createTimer(timerOptions, timerCallback, d_allocator_p);
-
-            callbackEntry->setTimer(timer);
+    return this->privateReceive(self, callbackEntry);
+}
 
-            timer->schedule(options.deadline().value());
-        }
+ntsa::Error DatagramSocket::receiveBatch(
+    const ntca::ReceiveOptions&       options,
+    const ntci::ReceiveBatchFunction& callback)
+{
+    return this->receiveBatch(
+        options,
+        this->createReceiveBatchCallback(callback, d_allocator_p));
+}
 
-        d_receiveQueue.pushCallbackEntry(callbackEntry);
-        error = ntsa::Error::e_WOULD_BLOCK;
-    }
+ntsa::Error DatagramSocket::receiveBatch(
+    const ntca::ReceiveOptions&       options,
+    const ntci::ReceiveBatchCallback& callback)
+{
+    bsl::shared_ptr<DatagramSocket> self = this->getSelf(this);
 
-    BSLS_ASSERT(error == ntsa::Error::e_OK ||
-                error == ntsa::Error::e_WOULD_BLOCK);
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
-    if (error == ntsa::Error::e_WOULD_BLOCK) {
-        this->privateRelaxFlowControl(self,
-                                      ntca::FlowControlType::e_RECEIVE,
-                                      true,
-                                      false);
-        error = ntsa::Error::e_OK;
-    }
+    bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry> callbackEntry =
+        d_receiveQueue.createCallbackEntry();
+    callbackEntry->assign(callback, options);
 
-    return error;
+    return this->privateReceive(self, callbackEntry);
 }
 
 ntsa::Error DatagramSocket::registerResolver(
@@ -24,6 +24,7 @@ BSLS_IDENT("$Id: $")
 #include <ntci_interface.h>
 #include <ntci_proactorfactory.h>
 #include <ntcs_metrics.h>
+#include <ntcs_numautil.h>
 #include <ntcs_proactormetrics.h>
 #include <ntcs_reservation.h>
 #include <ntcs_user.h>
@@ -76,6 +77,12 @@ class Interface : public ntci::Interface,
     /// Define a type alias for a vector of proactors.
     typedef bsl::vector<bsl::shared_ptr<ntci::Proactor> > ProactorVector;
 
+    /// Define a type alias for a vector of NUMA nodes.
+    typedef bsl::vector<ntcs::NumaNode> NumaNodeVector;
+
+    /// Define a type alias for a vector of users.
+    typedef bsl::vector<bsl::shared_ptr<ntcs::User> > UserVector;
+
     ntccfg::Object d_object;
 
     mutable ntccfg::Mutex d_mutex;
@@ -96,6 +103,9 @@ class Interface : public ntci::Interface,
     bslmt::Semaphore d_threadSemaphore;
     bsl::size_t      d_threadWatermark;
 
+    NumaNodeVector d_numaNodeVector;
+    UserVector     d_numaUserVector;
+
     ntca::InterfaceConfig d_config;
     bslma::Allocator*     d_allocator_p;
 
@@ -111,6 +121,13 @@ class Interface : public ntci::Interface,
     /// Create a new resolver. Return the new resolver.
     bsl::shared_ptr<ntci::Resolver> createResolver();
 
+    /// Create one data pool for each NUMA node of the machine, each
+    /// supplying blob buffers of the same size as the data pool supplied at
+    /// construction, and a user of that data pool for each proactor driven
+    /// by threads bound to that node. Do nothing if dynamic load balancing
+    /// is enabled or the machine has a single NUMA node.
+    void initializeNuma();
+
     /// Add a new proactor. Return the new proactor.
     bsl::shared_ptr<ntci::Proactor> addProactor();
 
@@ -21,6 +21,7 @@ BSLS_IDENT_RCSID(ntcp_listenersocket_cpp, "$Id$ $CSID$")
 #include <ntcp_streamsocket.h>
 
 #include <ntccfg_limits.h>
+#include <ntccfg_tracepoint.h>
 #include <ntci_log.h>
 #include <ntci_monitorable.h>
 #include <ntcm_monitorableutil.h>
@@ -171,6 +172,11 @@ void ListenerSocket::processSocketAccepted(
         }
     }
     else {
+        NTCCFG_TRACEPOINT3(socket_accept,
+                           this,
+                           d_publicHandle,
+                           streamSocket->handle());
+
         this->privateCompleteAccept(self, streamSocket);
     }
 
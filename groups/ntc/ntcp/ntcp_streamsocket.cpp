@@ -30,6 +30,7 @@ BSLS_IDENT_RCSID(ntcp_streamsocket_cpp, "$Id$ $CSID$")
 #include <ntcs_blobutil.h>
 #include <ntcs_compat.h>
 #include <ntcs_dispatch.h>
+#include <ntcs_receiveframer.h>
 #include <ntcu_streamsocketsession.h>
 #include <ntcu_streamsocketutil.h>
 #include <ntsa_distinguishedname.h>
@@ -174,6 +175,13 @@ BSLS_IDENT_RCSID(ntcp_streamsocket_cpp, "$Id$ $CSID$")
                    "has filled the write queue up to %zu bytes",              \
                    size)
 
+#define NTCP_STREAMSOCKET_LOG_WRITE_QUEUE_CONFLATED(size, key)                \
+    NTCI_LOG_TRACE("Stream socket "                                           \
+                   "has replaced %zu bytes on the write queue having "        \
+                   "conflation key %llu",                                     \
+                   size,                                                      \
+                   static_cast<unsigned long long>(key))
+
 #define NTCP_STREAMSOCKET_LOG_WRITE_QUEUE_DRAINED(size)                       \
     NTCI_LOG_DEBUG("Stream socket "                                           \
                    "has drained the write queue down to %zu bytes",           \
@@ -513,8 +521,7 @@ void StreamSocket::processSendRateTimer(
 
 void StreamSocket::processSendDeadlineTimer(
     const bsl::shared_ptr<ntci::Timer>& timer,
-    const ntca::TimerEvent&             event,
-    bsl::uint64_t                       entryId)
+    const ntca::TimerEvent&             event)
 {
     NTCCFG_WARNING_UNUSED(timer);
 
@@ -531,30 +538,101 @@ void StreamSocket::processSendDeadlineTimer(
     NTCI_LOG_CONTEXT_GUARD_REMOTE_ENDPOINT(d_remoteEndpoint);
 
     if (event.type() == ntca::TimerEventType::e_DEADLINE) {
-        ntci::SendCallback callback;
-        bool becameEmpty = d_sendQueue.removeEntryId(&callback, entryId);
-        if (becameEmpty) {
-            this->privateApplyFlowControl(self,
-                                          ntca::FlowControlType::e_SEND,
-                                          ntca::FlowControlMode::e_IMMEDIATE,
-                                          false,
-                                          false);
+        d_sendDeadlineTimerArmed = false;
+        this->privateExpireSendQueue(self);
+    }
+}
+
+void StreamSocket::processTcpInfoTimer(
+    const bsl::shared_ptr<ntci::Timer>& timer,
+    const ntca::TimerEvent&             event)
+{
+    NTCCFG_WARNING_UNUSED(timer);
+
+    NTCCFG_OBJECT_GUARD(&d_object);
+
+    bsl::shared_ptr<StreamSocket> self = this->getSelf(this);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_CONTEXT_GUARD_DESCRIPTOR(d_publicHandle);
+    NTCI_LOG_CONTEXT_GUARD_SOURCE_ENDPOINT(d_sourceEndpoint);
+    NTCI_LOG_CONTEXT_GUARD_REMOTE_ENDPOINT(d_remoteEndpoint);
+
+    if (event.type() != ntca::TimerEventType::e_DEADLINE) {
+        return;
+    }
+
+    if (!d_socket_sp || !d_tcpInfoTimer_sp) {
+        return;
+    }
+
+    ntsa::TcpInfo tcpInfo;
+    ntsa::Error   error = d_socket_sp->getTcpInfo(&tcpInfo);
+    if (error) {
+        // The state of the TCP connection cannot be sampled on this
+        // platform or for this socket, so stop trying.
+
+        d_tcpInfoTimer_sp->close();
+        d_tcpInfoTimer_sp.reset();
+        return;
+    }
+
+    // The number of retransmitted segments reported by the operating system
+    // is the total over the lifetime of the connection, so record only the
+    // retransmissions that have occurred since the previous sample.
+
+    const bsl::uint32_t numRetransmissions =
+        tcpInfo.retransmittedSegments() - d_tcpRetransmittedSegments;
+
+    d_tcpRetransmittedSegments = tcpInfo.retransmittedSegments();
+
+    NTCS_METRICS_UPDATE_TCP_INFO(tcpInfo, numRetransmissions);
+
+    if (d_adaptiveWriteQueue) {
+        // Allow at least two bandwidth-delay products of data to accumulate
+        // in the write queue before announcing the high watermark, but never
+        // less than the high watermark configured by the user.
+
+        bsl::size_t highWatermark = d_sendQueueHighWatermark;
+
+        const bsl::uint64_t bandwidthDelayProduct =
+            tcpInfo.bandwidthDelayProduct();
+
+        if (bandwidthDelayProduct > 0) {
+            const bsl::uint64_t target = 2 * bandwidthDelayProduct;
+            if (target > highWatermark) {
+                highWatermark = static_cast<bsl::size_t>(target);
+            }
         }
 
-        if (callback) {
-            ntca::SendContext sendContext;
-            sendContext.setError(ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+        if (highWatermark != d_sendQueue.highWatermark()) {
+            d_sendQueue.setHighWatermark(highWatermark);
 
-            ntca::SendEvent sendEvent;
-            sendEvent.setType(ntca::SendEventType::e_ERROR);
-            sendEvent.setContext(sendContext);
+            if (d_sendQueue.authorizeHighWatermarkEvent()) {
+                NTCP_STREAMSOCKET_LOG_WRITE_QUEUE_HIGH_WATERMARK(
+                    d_sendQueue.highWatermark(),
+                    d_sendQueue.size());
 
-            callback.dispatch(self,
-                                                   sendEvent,
-                                                   d_proactorStrand_sp,
-                                                   self,
-                                                   false,
-                                                   &d_mutex);
+                if (d_session_sp) {
+                    ntca::WriteQueueEvent event;
+                    event.setType(
+                        ntca::WriteQueueEventType::e_HIGH_WATERMARK);
+                    event.setContext(d_sendQueue.context());
+
+                    ntcs::Dispatch::announceWriteQueueHighWatermark(
+                        d_session_sp,
+                        self,
+                        event,
+                        d_sessionStrand_sp,
+                        ntci::Strand::unknown(),
+                        self,
+                        false,
+                        &d_mutex);
+                }
+            }
         }
     }
 }
@@ -809,6 +887,8 @@ void StreamSocket::privateCompleteConnect(
 
     d_openState.set(ntcs::OpenState::e_CONNECTED);
 
+    this->privateStartTcpInfoSampling(self);
+
     ntci::ConnectCallback connectCallback = d_connectCallback;
     d_connectCallback.reset();
 
@@ -1253,85 +1333,54 @@ void StreamSocket::privateCompleteReceive(
 
     while (true) {
         bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry> callbackEntry;
-        error = d_receiveQueue.popCallbackEntry(&callbackEntry);
-        if (error) {
+        bsl::size_t                                      frameSize   = 0;
+        bsl::size_t                                      framePrefix = 0;
+        bsl::size_t                                      frameSuffix = 0;
+
+        error = d_receiveQueue.popCallbackEntry(&callbackEntry,
+                                                &frameSize,
+                                                &framePrefix,
+                                                &frameSuffix);
+        if (!callbackEntry) {
             break;
         }
 
-        BSLS_ASSERT(d_receiveQueue.hasEntry());
-        BSLS_ASSERT(d_receiveQueue.size() ==
-                    NTCCFG_WARNING_PROMOTE(bsl::size_t,
-                                           d_receiveQueue.data()->length()));
-        BSLS_ASSERT(d_receiveQueue.size() >=
-                    callbackEntry->options().minSize());
-
-        bsl::size_t numBytesRemaining = callbackEntry->options().maxSize();
-        bsl::size_t numBytesDequeued  = 0;
-
-        while (true) {
-            ntcq::ReceiveQueueEntry& entry = d_receiveQueue.frontEntry();
-
-            bsl::size_t numBytesToDequeue =
-                bsl::min(numBytesRemaining, entry.length());
-
-            numBytesDequeued += numBytesToDequeue;
-            BSLS_ASSERT(numBytesDequeued <=
-                        callbackEntry->options().maxSize());
-
-            BSLS_ASSERT(numBytesRemaining >= numBytesToDequeue);
-            numBytesRemaining -= numBytesToDequeue;
+        if (NTCCFG_UNLIKELY(error)) {
+            ntca::ReceiveContext receiveContext;
+            receiveContext.setError(error);
+            receiveContext.setTransport(d_transport);
+            receiveContext.setEndpoint(d_remoteEndpoint);
 
-            if (numBytesToDequeue == entry.length()) {
-                NTCS_METRICS_UPDATE_READ_QUEUE_DELAY(entry.delay());
+            ntca::ReceiveEvent receiveEvent;
+            receiveEvent.setType(ntca::ReceiveEventType::e_ERROR);
+            receiveEvent.setContext(receiveContext);
 
-                if (d_receiveQueue.popEntry()) {
-                    break;
-                }
-            }
-            else {
-                d_receiveQueue.popSize(numBytesToDequeue);
-                break;
-            }
+            ntcq::ReceiveCallbackQueueEntry::dispatch(
+                callbackEntry,
+                self,
+                bsl::shared_ptr<bdlbb::Blob>(),
+                receiveEvent,
+                d_proactorStrand_sp,
+                self,
+                false,
+                &d_mutex);
 
-            if (numBytesRemaining == 0) {
-                break;
-            }
+            continue;
         }
 
-        BSLS_ASSERT(numBytesDequeued >= callbackEntry->options().minSize());
-        BSLS_ASSERT(numBytesDequeued <= callbackEntry->options().maxSize());
-
-        bsl::shared_ptr<bdlbb::Blob> data =
-            d_dataPool_sp->createIncomingBlob();
-
-        ntcs::BlobUtil::append(data, d_receiveQueue.data(), numBytesDequeued);
-
-        ntcs::BlobUtil::pop(d_receiveQueue.data(), numBytesDequeued);
-
+        BSLS_ASSERT(d_receiveQueue.hasEntry());
         BSLS_ASSERT(d_receiveQueue.size() ==
                     NTCCFG_WARNING_PROMOTE(bsl::size_t,
                                            d_receiveQueue.data()->length()));
+        BSLS_ASSERT(d_receiveQueue.size() >= frameSize);
 
-        NTCP_STREAMSOCKET_LOG_READ_QUEUE_DRAINED(d_receiveQueue.size());
-
-        NTCS_METRICS_UPDATE_READ_QUEUE_SIZE(d_receiveQueue.size());
-
-        ntca::ReceiveContext receiveContext;
-        receiveContext.setTransport(d_transport);
-        receiveContext.setEndpoint(d_remoteEndpoint);
-
-        ntca::ReceiveEvent receiveEvent;
-        receiveEvent.setType(ntca::ReceiveEventType::e_COMPLETE);
-        receiveEvent.setContext(receiveContext);
-
-        ntcq::ReceiveCallbackQueueEntry::dispatch(callbackEntry,
-                                                  self,
-                                                  data,
-                                                  receiveEvent,
-                                                  d_proactorStrand_sp,
-                                                  self,
-                                                  false,
-                                                  &d_mutex);
+        this->privateSatisfyReceive(self,
+                                    callbackEntry,
+                                    frameSize,
+                                    framePrefix,
+                                    frameSuffix,
+                                    d_proactorStrand_sp,
+                                    false);
     }
 
     if (d_receiveQueue.authorizeLowWatermarkEvent()) {
@@ -1456,6 +1505,301 @@ void StreamSocket::privateCompleteReceive(
     }
 }
 
+ntsa::Error StreamSocket::privateReceive(
+    const bsl::shared_ptr<StreamSocket>&                    self,
+    const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& callbackEntry)
+{
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_CONTEXT_GUARD_DESCRIPTOR(d_publicHandle);
+    NTCI_LOG_CONTEXT_GUARD_SOURCE_ENDPOINT(d_sourceEndpoint);
+    NTCI_LOG_CONTEXT_GUARD_REMOTE_ENDPOINT(d_remoteEndpoint);
+
+    ntsa::Error error;
+
+    const ntca::ReceiveOptions& options = callbackEntry->options();
+
+    if (NTCCFG_UNLIKELY(!d_openState.canReceive())) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    if (NTCCFG_UNLIKELY(d_receiveQueue.size() == 0 &&
+                        !d_shutdownState.canReceive()))
+    {
+        return ntsa::Error(ntsa::Error::e_EOF);
+    }
+
+    bsl::size_t frameSize   = 0;
+    bsl::size_t framePrefix = 0;
+    bsl::size_t frameSuffix = 0;
+
+    if (NTCCFG_LIKELY(!d_receiveQueue.hasCallbackEntry())) {
+        error = d_receiveQueue.frame(&frameSize,
+                                     &framePrefix,
+                                     &frameSuffix,
+                                     options);
+        if (NTCCFG_UNLIKELY(error && error != ntsa::Error::e_WOULD_BLOCK)) {
+            return error;
+        }
+    }
+    else {
+        error = ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
+    }
+
+    if (NTCCFG_LIKELY(!error)) {
+        BSLS_ASSERT(d_receiveQueue.hasEntry());
+        BSLS_ASSERT(d_receiveQueue.size() ==
+                    NTCCFG_WARNING_PROMOTE(bsl::size_t,
+                                           d_receiveQueue.data()->length()));
+
+        bool receiveQueueHighWatermarkViolatedBefore =
+            d_receiveQueue.isHighWatermarkViolated();
+
+        const bool defer = !options.recurse();
+
+        this->privateSatisfyReceive(self,
+                                    callbackEntry,
+                                    frameSize,
+                                    framePrefix,
+                                    frameSuffix,
+                                    ntci::Strand::unknown(),
+                                    defer);
+
+        bool receiveQueueHighWatermarkViolatedAfter =
+            d_receiveQueue.isHighWatermarkViolated();
+
+        if (receiveQueueHighWatermarkViolatedBefore &&
+            !receiveQueueHighWatermarkViolatedAfter)
+        {
+            this->privateRelaxFlowControl(self,
+                                          ntca::FlowControlType::e_RECEIVE,
+                                          true,
+                                          false);
+        }
+
+        error = ntsa::Error::e_OK;
+    }
+    else {
+        if (!options.deadline().isNull()) {
+            ntca::TimerOptions timerOptions;
+            timerOptions.setOneShot(true);
+            timerOptions.showEvent(ntca::TimerEventType::e_DEADLINE);
+            timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
+            timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
+
+            ntci::TimerCallback timerCallback = this->createTimerCallback(
+                bdlf::BindUtil::bind(
+                    &StreamSocket::processReceiveDeadlineTimer,
+                    self,
+                    bdlf::PlaceHolders::_1,
+                    bdlf::PlaceHolders::_2,
+                    callbackEntry),
+                d_allocator_p);
+
+            bsl::shared_ptr<ntci::Timer> timer =
+                this->createTimer(timerOptions, timerCallback, d_allocator_p);
+
+            callbackEntry->setTimer(timer);
+
+            timer->schedule(options.deadline().value());
+        }
+
+        d_receiveQueue.pushCallbackEntry(callbackEntry);
+        error = ntsa::Error::e_WOULD_BLOCK;
+    }
+
+    BSLS_ASSERT(error == ntsa::Error::e_OK ||
+                error == ntsa::Error::e_WOULD_BLOCK);
+
+    if (error == ntsa::Error::e_WOULD_BLOCK) {
+        this->privateRelaxFlowControl(self,
+                                      ntca::FlowControlType::e_RECEIVE,
+                                      true,
+                                      false);
+        error = ntsa::Error::e_OK;
+    }
+
+    return error;
+}
+
+void StreamSocket::privateSatisfyReceive(
+    const bsl::shared_ptr<StreamSocket>&                    self,
+    const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& callbackEntry,
+    bsl::size_t                                             frameSize,
+    bsl::size_t                                             framePrefix,
+    bsl::size_t                                             frameSuffix,
+    const bsl::shared_ptr<ntci::Strand>&                    strand,
+    bool                                                    defer)
+{
+    ntca::ReceiveContext receiveContext;
+    receiveContext.setTransport(d_transport);
+    receiveContext.setEndpoint(d_remoteEndpoint);
+
+    ntca::ReceiveEvent receiveEvent;
+    receiveEvent.setType(ntca::ReceiveEventType::e_COMPLETE);
+    receiveEvent.setContext(receiveContext);
+
+    if (callbackEntry->hasBuffers()) {
+        const bsl::size_t size = frameSize - framePrefix - frameSuffix;
+
+        ntcs::BlobUtil::copy(callbackEntry->buffers(),
+                             *d_receiveQueue.data(),
+                             framePrefix,
+                             size);
+
+        this->privateDequeueReceiveData(0,
+                                        frameSize,
+                                        framePrefix,
+                                        frameSuffix);
+
+        receiveContext.setBytesReceived(size);
+        receiveEvent.setContext(receiveContext);
+
+        ntcq::ReceiveCallbackQueueEntry::dispatch(
+            callbackEntry,
+            self,
+            bsl::shared_ptr<bdlbb::Blob>(),
+            receiveEvent,
+            strand,
+            self,
+            defer,
+            &d_mutex);
+        return;
+    }
+
+    if (NTCCFG_LIKELY(!callbackEntry->isBatch())) {
+        bsl::shared_ptr<bdlbb::Blob> data =
+            d_dataPool_sp->createIncomingBlob();
+
+        this->privateDequeueReceiveData(data.get(),
+                                        frameSize,
+                                        framePrefix,
+                                        frameSuffix);
+
+        ntcq::ReceiveCallbackQueueEntry::dispatch(callbackEntry,
+                                                  self,
+                                                  data,
+                                                  receiveEvent,
+                                                  strand,
+                                                  self,
+                                                  defer,
+                                                  &d_mutex);
+        return;
+    }
+
+    const ntca::ReceiveOptions& options = callbackEntry->options();
+
+    bsl::vector<ntci::ReceiveResult> results(d_allocator_p);
+
+    bsl::size_t numBytesBatched = 0;
+
+    while (true) {
+        bsl::shared_ptr<bdlbb::Blob> data =
+            d_dataPool_sp->createIncomingBlob();
+
+        this->privateDequeueReceiveData(data.get(),
+                                        frameSize,
+                                        framePrefix,
+                                        frameSuffix);
+
+        numBytesBatched += frameSize - framePrefix - frameSuffix;
+
+        results.resize(results.size() + 1);
+        results.back().setData(data);
+        results.back().setEvent(receiveEvent);
+
+        if (results.size() >= options.maxMessages()) {
+            break;
+        }
+
+        ntsa::Error error = d_receiveQueue.frame(&frameSize,
+                                                 &framePrefix,
+                                                 &frameSuffix,
+                                                 options);
+        if (error) {
+            break;
+        }
+
+        if (numBytesBatched + (frameSize - framePrefix - frameSuffix) >
+            options.maxSize())
+        {
+            break;
+        }
+    }
+
+    ntcq::ReceiveCallbackQueueEntry::dispatch(callbackEntry,
+                                              self,
+                                              results,
+                                              receiveEvent,
+                                              strand,
+                                              self,
+                                              defer,
+                                              &d_mutex);
+}
+
+void StreamSocket::privateDequeueReceiveData(bdlbb::Blob* data,
+                                             bsl::size_t  frameSize,
+                                             bsl::size_t  framePrefix,
+                                             bsl::size_t  frameSuffix)
+{
+    NTCI_LOG_CONTEXT();
+
+    BSLS_ASSERT(d_receiveQueue.hasEntry());
+    BSLS_ASSERT(d_receiveQueue.size() >= frameSize);
+    BSLS_ASSERT(framePrefix + frameSuffix <= frameSize);
+
+    bsl::size_t numBytesRemaining = frameSize;
+    bsl::size_t numBytesDequeued  = 0;
+
+    while (NTCCFG_LIKELY(d_receiveQueue.hasEntry())) {
+        ntcq::ReceiveQueueEntry& entry = d_receiveQueue.frontEntry();
+
+        bsl::size_t numBytesToDequeue =
+            bsl::min(numBytesRemaining, entry.length());
+
+        numBytesDequeued += numBytesToDequeue;
+        BSLS_ASSERT(numBytesDequeued <= frameSize);
+
+        BSLS_ASSERT(numBytesRemaining >= numBytesToDequeue);
+        numBytesRemaining -= numBytesToDequeue;
+
+        if (numBytesToDequeue == entry.length()) {
+            NTCS_METRICS_UPDATE_READ_QUEUE_DELAY(entry.delay());
+
+            if (d_receiveQueue.popEntry()) {
+                break;
+            }
+        }
+        else {
+            d_receiveQueue.popSize(numBytesToDequeue);
+            break;
+        }
+
+        if (numBytesRemaining == 0) {
+            break;
+        }
+    }
+
+    BSLS_ASSERT(numBytesDequeued == frameSize);
+
+    if (data) {
+        ntcs::BlobUtil::append(data,
+                               d_receiveQueue.data(),
+                               framePrefix,
+                               numBytesDequeued - framePrefix - frameSuffix);
+    }
+
+    ntcs::BlobUtil::pop(d_receiveQueue.data(), numBytesDequeued);
+
+    BSLS_ASSERT(d_receiveQueue.size() ==
+                NTCCFG_WARNING_PROMOTE(bsl::size_t,
+                                       d_receiveQueue.data()->length()));
+
+    NTCP_STREAMSOCKET_LOG_READ_QUEUE_DRAINED(d_receiveQueue.size());
+
+    NTCS_METRICS_UPDATE_READ_QUEUE_SIZE(d_receiveQueue.size());
+}
+
 void StreamSocket::privateFailReceive(
     const bsl::shared_ptr<StreamSocket>& self,
     const ntsa::Error&                   error)
@@ -1487,6 +1831,18 @@ void StreamSocket::privateInitiateSend(
         }
     }
 
+    if (NTCCFG_UNLIKELY(d_sendDeadlineTimerArmed)) {
+        // Discard the entries whose deadline has elapsed before they are
+        // submitted to the proactor, rather than waiting for the timer.
+
+        bsls::TimeInterval deadline;
+        if (d_sendQueue.earliestDeadline(&deadline) &&
+            deadline <= this->currentTime())
+        {
+            this->privateExpireSendQueue(self);
+        }
+    }
+
     while (d_sendQueue.hasEntry()) {
         ntcq::SendQueueEntry& entry = d_sendQueue.frontEntry();
 
@@ -1537,9 +1893,10 @@ void StreamSocket::privateInitiateSend(
 
             if (hasDeadline) {
                 entry.setDeadline(bdlb::NullableValue<bsls::TimeInterval>());
-                entry.closeTimer();
             }
 
+            entry.setInProgress(true);
+
             d_sendPending = true;
             break;
         }
@@ -1550,6 +1907,182 @@ void StreamSocket::privateInitiateSend(
     }
 }
 
+void StreamSocket::privateScheduleSendDeadline(
+    const bsl::shared_ptr<StreamSocket>& self)
+{
+    bsls::TimeInterval deadline;
+    if (!d_sendQueue.earliestDeadline(&deadline)) {
+        return;
+    }
+
+    if (d_sendDeadlineTimerArmed && d_sendDeadlineTimerDue <= deadline) {
+        return;
+    }
+
+    if (NTCCFG_UNLIKELY(!d_sendDeadlineTimer_sp)) {
+        ntca::TimerOptions timerOptions;
+        timerOptions.showEvent(ntca::TimerEventType::e_DEADLINE);
+        timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
+        timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
+
+        ntci::TimerCallback timerCallback = this->createTimerCallback(
+            bdlf::MemFnUtil::memFn(&StreamSocket::processSendDeadlineTimer,
+                                   self),
+            d_allocator_p);
+
+        d_sendDeadlineTimer_sp =
+            this->createTimer(timerOptions, timerCallback, d_allocator_p);
+    }
+
+    d_sendDeadlineTimerDue   = deadline;
+    d_sendDeadlineTimerArmed = true;
+
+    d_sendDeadlineTimer_sp->schedule(deadline);
+}
+
+void StreamSocket::privateStartTcpInfoSampling(
+    const bsl::shared_ptr<StreamSocket>& self)
+{
+    if (d_options.tcpInfoInterval().isNull() || d_tcpInfoTimer_sp) {
+        return;
+    }
+
+    const bsls::TimeInterval interval = d_options.tcpInfoInterval().value();
+    if (interval <= bsls::TimeInterval()) {
+        return;
+    }
+
+    ntca::TimerOptions timerOptions;
+    timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
+    timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
+    timerOptions.setOneShot(false);
+
+    ntci::TimerCallback timerCallback = this->createTimerCallback(
+        bdlf::MemFnUtil::memFn(&StreamSocket::processTcpInfoTimer, self),
+        d_allocator_p);
+
+    d_tcpInfoTimer_sp =
+        this->createTimer(timerOptions, timerCallback, d_allocator_p);
+
+    d_tcpInfoTimer_sp->schedule(this->currentTime() + interval, interval);
+}
+
+void StreamSocket::privateExpireSendQueue(
+    const bsl::shared_ptr<StreamSocket>& self)
+{
+    bsl::vector<ntci::SendCallback> callbackVector;
+
+    bool becameEmpty =
+        d_sendQueue.removeExpired(&callbackVector, this->currentTime());
+
+    if (becameEmpty) {
+        this->privateApplyFlowControl(self,
+                                      ntca::FlowControlType::e_SEND,
+                                      ntca::FlowControlMode::e_IMMEDIATE,
+                                      false,
+                                      false);
+    }
+
+    if (!callbackVector.empty()) {
+        NTCS_METRICS_UPDATE_WRITE_QUEUE_SIZE(d_sendQueue.size());
+    }
+
+    this->privateScheduleSendDeadline(self);
+
+    for (bsl::size_t i = 0; i < callbackVector.size(); ++i) {
+        ntca::SendContext sendContext;
+        sendContext.setError(ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+
+        ntca::SendEvent sendEvent;
+        sendEvent.setType(ntca::SendEventType::e_ERROR);
+        sendEvent.setContext(sendContext);
+
+        callbackVector[i].dispatch(self,
+                                   sendEvent,
+                                   d_proactorStrand_sp,
+                                   self,
+                                   false,
+                                   &d_mutex);
+    }
+}
+
+bool StreamSocket::privateCanConflateSend(
+    bsl::size_t              size,
+    const ntca::SendOptions& options,
+    bsl::size_t              effectiveHighWatermark) const
+{
+    if (NTCCFG_LIKELY(options.conflationKey().isNull())) {
+        return false;
+    }
+
+    if (d_encryption_sp) {
+        return false;
+    }
+
+    bsl::size_t replacedSize = 0;
+    if (!d_sendQueue.conflationLength(&replacedSize,
+                                      options.conflationKey().value()))
+    {
+        return false;
+    }
+
+    // The replacement must not grow the write queue past the high
+    // watermark, or, if the write queue is already past the high watermark,
+    // must not grow it at all.
+
+    const bsl::size_t queueSize = d_sendQueue.size();
+    const bsl::size_t limit     = bsl::max(queueSize, effectiveHighWatermark);
+
+    return queueSize - replacedSize + size <= limit;
+}
+
+bool StreamSocket::privateConflateSend(
+    const bsl::shared_ptr<StreamSocket>& self,
+    const ntcq::SendQueueEntry&          entry)
+{
+    NTCI_LOG_CONTEXT();
+
+    // Records already encrypted by the encryption session must be sent in
+    // sequence, so they are never replaced.
+
+    if (d_encryption_sp) {
+        return false;
+    }
+
+    ntcq::SendQueueEntry replaced;
+    if (!d_sendQueue.conflateEntry(&replaced, entry)) {
+        return false;
+    }
+
+    NTCP_STREAMSOCKET_LOG_WRITE_QUEUE_CONFLATED(replaced.length(),
+                                                entry.conflationKey().value());
+
+    NTCS_METRICS_UPDATE_WRITE_QUEUE_CONFLATED(replaced.length());
+    NTCS_METRICS_UPDATE_WRITE_QUEUE_SIZE(d_sendQueue.size());
+
+    if (NTCCFG_UNLIKELY(!entry.deadline().isNull())) {
+        this->privateScheduleSendDeadline(self);
+    }
+
+    if (replaced.callback()) {
+        ntca::SendContext sendContext;
+        sendContext.setError(ntsa::Error(ntsa::Error::e_CANCELLED));
+
+        ntca::SendEvent sendEvent;
+        sendEvent.setType(ntca::SendEventType::e_ERROR);
+        sendEvent.setContext(sendContext);
+
+        replaced.callback().dispatch(self,
+                                     sendEvent,
+                                     d_proactorStrand_sp,
+                                     self,
+                                     true,
+                                     &d_mutex);
+    }
+
+    return true;
+}
+
 void StreamSocket::privateCompleteSend(
     const bsl::shared_ptr<StreamSocket>& self,
     bsl::size_t                          numBytesSent)
@@ -1958,6 +2491,18 @@ void StreamSocket::privateShutdownSequencePart2(
                 d_sendRateTimer_sp.reset();
             }
 
+            if (d_sendDeadlineTimer_sp) {
+                d_sendDeadlineTimer_sp->close();
+                d_sendDeadlineTimer_sp.reset();
+            }
+
+            d_sendDeadlineTimerArmed = false;
+
+            if (d_tcpInfoTimer_sp) {
+                d_tcpInfoTimer_sp->close();
+                d_tcpInfoTimer_sp.reset();
+            }
+
             announceWriteQueueDiscarded =
                 d_sendQueue.removeAll(&callbackVector);
         }
@@ -2575,31 +3120,23 @@ ntsa::Error StreamSocket::privateSendRaw(
     entry.setTimestamp(bsls::TimeUtil::getTimer());
 
     if (NTCCFG_UNLIKELY(!options.deadline().isNull())) {
-        ntca::TimerOptions timerOptions;
-        timerOptions.setOneShot(true);
-        timerOptions.showEvent(ntca::TimerEventType::e_DEADLINE);
-        timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
-        timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
-
-        ntci::TimerCallback timerCallback = this->createTimerCallback(
-            bdlf::BindUtil::bind(&StreamSocket::processSendDeadlineTimer,
-                                 self,
-                                 bdlf::PlaceHolders::_1,
-                                 bdlf::PlaceHolders::_2,
-                                 entry.id()),
-            d_allocator_p);
-
-        bsl::shared_ptr<ntci::Timer> timer =
-            this->createTimer(timerOptions, timerCallback, d_allocator_p);
-
         entry.setDeadline(options.deadline().value());
-        entry.setTimer(timer);
+    }
+
+    if (NTCCFG_UNLIKELY(!options.conflationKey().isNull())) {
+        entry.setConflationKey(options.conflationKey().value());
 
-        timer->schedule(options.deadline().value());
+        if (this->privateConflateSend(self, entry)) {
+            return ntsa::Error();
+        }
     }
 
     bool becameNonEmpty = d_sendQueue.pushEntry(entry);
 
+    if (NTCCFG_UNLIKELY(!entry.deadline().isNull())) {
+        this->privateScheduleSendDeadline(self);
+    }
+
     NTCP_STREAMSOCKET_LOG_WRITE_QUEUE_FILLED(d_sendQueue.size());
 
     NTCS_METRICS_UPDATE_WRITE_QUEUE_SIZE(d_sendQueue.size());
@@ -2638,31 +3175,23 @@ ntsa::Error StreamSocket::privateSendRaw(
     entry.setTimestamp(bsls::TimeUtil::getTimer());
 
     if (NTCCFG_UNLIKELY(!options.deadline().isNull())) {
-        ntca::TimerOptions timerOptions;
-        timerOptions.setOneShot(true);
-        timerOptions.showEvent(ntca::TimerEventType::e_DEADLINE);
-        timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
-        timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
-
-        ntci::TimerCallback timerCallback = this->createTimerCallback(
-            bdlf::BindUtil::bind(&StreamSocket::processSendDeadlineTimer,
-                                 self,
-                                 bdlf::PlaceHolders::_1,
-                                 bdlf::PlaceHolders::_2,
-                                 entry.id()),
-            d_allocator_p);
-
-        bsl::shared_ptr<ntci::Timer> timer =
-            this->createTimer(timerOptions, timerCallback, d_allocator_p);
-
         entry.setDeadline(options.deadline().value());
-        entry.setTimer(timer);
+    }
+
+    if (NTCCFG_UNLIKELY(!options.conflationKey().isNull())) {
+        entry.setConflationKey(options.conflationKey().value());
 
-        timer->schedule(options.deadline().value());
+        if (this->privateConflateSend(self, entry)) {
+            return ntsa::Error();
+        }
     }
 
     bool becameNonEmpty = d_sendQueue.pushEntry(entry);
 
+    if (NTCCFG_UNLIKELY(!entry.deadline().isNull())) {
+        this->privateScheduleSendDeadline(self);
+    }
+
     NTCP_STREAMSOCKET_LOG_WRITE_QUEUE_FILLED(d_sendQueue.size());
 
     NTCS_METRICS_UPDATE_WRITE_QUEUE_SIZE(d_sendQueue.size());
@@ -2704,31 +3233,23 @@ ntsa::Error StreamSocket::privateSendRaw(
     }
 
     if (NTCCFG_UNLIKELY(!options.deadline().isNull())) {
-        ntca::TimerOptions timerOptions;
-        timerOptions.setOneShot(true);
-        timerOptions.showEvent(ntca::TimerEventType::e_DEADLINE);
-        timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
-        timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
-
-        ntci::TimerCallback timerCallback = this->createTimerCallback(
-            bdlf::BindUtil::bind(&StreamSocket::processSendDeadlineTimer,
-                                 self,
-                                 bdlf::PlaceHolders::_1,
-                                 bdlf::PlaceHolders::_2,
-                                 entry.id()),
-            d_allocator_p);
-
-        bsl::shared_ptr<ntci::Timer> timer =
-            this->createTimer(timerOptions, timerCallback, d_allocator_p);
-
         entry.setDeadline(options.deadline().value());
-        entry.setTimer(timer);
+    }
+
+    if (NTCCFG_UNLIKELY(!options.conflationKey().isNull())) {
+        entry.setConflationKey(options.conflationKey().value());
 
-        timer->schedule(options.deadline().value());
+        if (this->privateConflateSend(self, entry)) {
+            return ntsa::Error();
+        }
     }
 
     bool becameNonEmpty = d_sendQueue.pushEntry(entry);
 
+    if (NTCCFG_UNLIKELY(!entry.deadline().isNull())) {
+        this->privateScheduleSendDeadline(self);
+    }
+
     NTCP_STREAMSOCKET_LOG_WRITE_QUEUE_FILLED(d_sendQueue.size());
 
     NTCS_METRICS_UPDATE_WRITE_QUEUE_SIZE(d_sendQueue.size());
@@ -2770,31 +3291,23 @@ ntsa::Error StreamSocket::privateSendRaw(
     }
 
     if (NTCCFG_UNLIKELY(!options.deadline().isNull())) {
-        ntca::TimerOptions timerOptions;
-        timerOptions.setOneShot(true);
-        timerOptions.showEvent(ntca::TimerEventType::e_DEADLINE);
-        timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
-        timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
-
-        ntci::TimerCallback timerCallback = this->createTimerCallback(
-            bdlf::BindUtil::bind(&StreamSocket::processSendDeadlineTimer,
-                                 self,
-                                 bdlf::PlaceHolders::_1,
-                                 bdlf::PlaceHolders::_2,
-                                 entry.id()),
-            d_allocator_p);
-
-        bsl::shared_ptr<ntci::Timer> timer =
-            this->createTimer(timerOptions, timerCallback, d_allocator_p);
-
         entry.setDeadline(options.deadline().value());
-        entry.setTimer(timer);
+    }
+
+    if (NTCCFG_UNLIKELY(!options.conflationKey().isNull())) {
+        entry.setConflationKey(options.conflationKey().value());
 
-        timer->schedule(options.deadline().value());
+        if (this->privateConflateSend(self, entry)) {
+            return ntsa::Error();
+        }
     }
 
     bool becameNonEmpty = d_sendQueue.pushEntry(entry);
 
+    if (NTCCFG_UNLIKELY(!entry.deadline().isNull())) {
+        this->privateScheduleSendDeadline(self);
+    }
+
     NTCP_STREAMSOCKET_LOG_WRITE_QUEUE_FILLED(d_sendQueue.size());
 
     NTCS_METRICS_UPDATE_WRITE_QUEUE_SIZE(d_sendQueue.size());
@@ -3055,6 +3568,8 @@ ntsa::Error StreamSocket::privateOpen(
     if (!d_remoteEndpoint.isUndefined()) {
         d_openState.set(ntcs::OpenState::e_CONNECTED);
 
+        this->privateStartTcpInfoSampling(self);
+
         ntcs::Dispatch::announceEstablished(d_manager_sp,
                                             self,
                                             d_managerStrand_sp,
@@ -3513,6 +4028,13 @@ StreamSocket::StreamSocket(
 , d_sendQueue(basicAllocator)
 , d_sendRateLimiter_sp()
 , d_sendRateTimer_sp()
+, d_sendDeadlineTimer_sp()
+, d_sendDeadlineTimerDue()
+, d_sendDeadlineTimerArmed(false)
+, d_adaptiveWriteQueue(false)
+, d_sendQueueHighWatermark(0)
+, d_tcpInfoTimer_sp()
+, d_tcpRetransmittedSegments(0)
 , d_sendPending(false)
 , d_sendGreedily(NTCCFG_DEFAULT_STREAM_SOCKET_WRITE_GREEDILY)
 , d_sendCount(0)
@@ -3566,6 +4088,12 @@ StreamSocket::StreamSocket(
         d_sendGreedily = d_options.sendGreedily().value();
     }
 
+    if (!d_options.adaptiveWriteQueue().isNull()) {
+        d_adaptiveWriteQueue = d_options.adaptiveWriteQueue().value();
+    }
+
+    d_sendQueueHighWatermark = d_sendQueue.highWatermark();
+
     if (!d_options.readQueueLowWatermark().isNull()) {
         d_receiveQueue.setLowWatermark(
             d_options.readQueueLowWatermark().value());
@@ -3576,6 +4104,13 @@ StreamSocket::StreamSocket(
             d_options.readQueueHighWatermark().value());
     }
 
+    if (!d_options.receiveFramer().isNull()) {
+        bsl::shared_ptr<ntcs::ReceiveFramer> receiveFramer;
+        receiveFramer.createInplace(d_allocator_p,
+                                    d_options.receiveFramer().value());
+        d_receiveQueue.setFramer(receiveFramer);
+    }
+
     if (!d_options.minIncomingStreamTransferSize().isNull()) {
         d_receiveFeedback.setMinimum(
             d_options.minIncomingStreamTransferSize().value());
@@ -4228,7 +4763,10 @@ ntsa::Error StreamSocket::send(const bdlbb::Blob&       data,
     }
 
     if (NTCCFG_UNLIKELY(
-            d_sendQueue.isHighWatermarkViolated(effectiveHighWatermark)))
+            d_sendQueue.isHighWatermarkViolated(effectiveHighWatermark)) &&
+        !this->privateCanConflateSend(static_cast<bsl::size_t>(data.length()),
+                                      options,
+                                      effectiveHighWatermark))
     {
         if (d_sendQueue.authorizeHighWatermarkEvent(effectiveHighWatermark)) {
             NTCP_STREAMSOCKET_LOG_WRITE_QUEUE_HIGH_WATERMARK(
@@ -4309,7 +4847,10 @@ ntsa::Error StreamSocket::send(const ntsa::Data&        data,
     }
 
     if (NTCCFG_UNLIKELY(
-            d_sendQueue.isHighWatermarkViolated(effectiveHighWatermark)))
+            d_sendQueue.isHighWatermarkViolated(effectiveHighWatermark)) &&
+        !this->privateCanConflateSend(data.size(),
+                                      options,
+                                      effectiveHighWatermark))
     {
         if (d_sendQueue.authorizeHighWatermarkEvent(effectiveHighWatermark)) {
             NTCP_STREAMSOCKET_LOG_WRITE_QUEUE_HIGH_WATERMARK(
@@ -4400,7 +4941,10 @@ ntsa::Error StreamSocket::send(const bdlbb::Blob&        data,
     }
 
     if (NTCCFG_UNLIKELY(
-            d_sendQueue.isHighWatermarkViolated(effectiveHighWatermark)))
+            d_sendQueue.isHighWatermarkViolated(effectiveHighWatermark)) &&
+        !this->privateCanConflateSend(static_cast<bsl::size_t>(data.length()),
+                                      options,
+                                      effectiveHighWatermark))
     {
         if (d_sendQueue.authorizeHighWatermarkEvent(effectiveHighWatermark)) {
             NTCP_STREAMSOCKET_LOG_WRITE_QUEUE_HIGH_WATERMARK(
@@ -4507,7 +5051,10 @@ ntsa::Error StreamSocket::send(const ntsa::Data&         data,
     }
 
     if (NTCCFG_UNLIKELY(
-            d_sendQueue.isHighWatermarkViolated(effectiveHighWatermark)))
+            d_sendQueue.isHighWatermarkViolated(effectiveHighWatermark)) &&
+        !this->privateCanConflateSend(data.size(),
+                                      options,
+                                      effectiveHighWatermark))
     {
         if (d_sendQueue.authorizeHighWatermarkEvent(effectiveHighWatermark)) {
             NTCP_STREAMSOCKET_LOG_WRITE_QUEUE_HIGH_WATERMARK(
@@ -4605,7 +5152,19 @@ ntsa::Error StreamSocket::receive(ntca::ReceiveContext*       context,
         return ntsa::Error(ntsa::Error::e_EOF);
     }
 
-    if (NTCCFG_LIKELY(d_receiveQueue.size() >= options.minSize())) {
+    bsl::size_t frameSize   = 0;
+    bsl::size_t framePrefix = 0;
+    bsl::size_t frameSuffix = 0;
+
+    error = d_receiveQueue.frame(&frameSize,
+                                 &framePrefix,
+                                 &frameSuffix,
+                                 options);
+    if (NTCCFG_UNLIKELY(error && error != ntsa::Error::e_WOULD_BLOCK)) {
+        return error;
+    }
+
+    if (NTCCFG_LIKELY(!error)) {
         BSLS_ASSERT(d_receiveQueue.hasEntry());
         BSLS_ASSERT(d_receiveQueue.size() ==
                     NTCCFG_WARNING_PROMOTE(bsl::size_t,
@@ -4614,55 +5173,13 @@ ntsa::Error StreamSocket::receive(ntca::ReceiveContext*       context,
         bool receiveQueueHighWatermarkViolatedBefore =
             d_receiveQueue.isHighWatermarkViolated();
 
-        bsl::size_t numBytesRemaining = options.maxSize();
-        bsl::size_t numBytesDequeued  = 0;
-
-        while (NTCCFG_LIKELY(d_receiveQueue.hasEntry())) {
-            ntcq::ReceiveQueueEntry& entry = d_receiveQueue.frontEntry();
-
-            bsl::size_t numBytesToDequeue =
-                bsl::min(numBytesRemaining, entry.length());
-
-            numBytesDequeued += numBytesToDequeue;
-            BSLS_ASSERT(numBytesDequeued <= options.maxSize());
-
-            BSLS_ASSERT(numBytesRemaining >= numBytesToDequeue);
-            numBytesRemaining -= numBytesToDequeue;
-
-            if (numBytesToDequeue == entry.length()) {
-                NTCS_METRICS_UPDATE_READ_QUEUE_DELAY(entry.delay());
-
-                if (d_receiveQueue.popEntry()) {
-                    break;
-                }
-            }
-            else {
-                d_receiveQueue.popSize(numBytesToDequeue);
-                break;
-            }
-
-            if (numBytesRemaining == 0) {
-                break;
-            }
-        }
-
-        BSLS_ASSERT(numBytesDequeued >= options.minSize());
-        BSLS_ASSERT(numBytesDequeued <= options.maxSize());
-
         context->setTransport(d_transport);
         context->setEndpoint(d_remoteEndpoint);
 
-        ntcs::BlobUtil::append(data, d_receiveQueue.data(), numBytesDequeued);
-
-        ntcs::BlobUtil::pop(d_receiveQueue.data(), numBytesDequeued);
-
-        BSLS_ASSERT(d_receiveQueue.size() ==
-                    NTCCFG_WARNING_PROMOTE(bsl::size_t,
-                                           d_receiveQueue.data()->length()));
-
-        NTCP_STREAMSOCKET_LOG_READ_QUEUE_DRAINED(d_receiveQueue.size());
-
-        NTCS_METRICS_UPDATE_READ_QUEUE_SIZE(d_receiveQueue.size());
+        this->privateDequeueReceiveData(data,
+                                        frameSize,
+                                        framePrefix,
+                                        frameSuffix);
 
         bool receiveQueueHighWatermarkViolatedAfter =
             d_receiveQueue.isHighWatermarkViolated();
@@ -4709,163 +5226,63 @@ ntsa::Error StreamSocket::receive(const ntca::ReceiveOptions&  options,
 
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
-    NTCI_LOG_CONTEXT();
-
-    NTCI_LOG_CONTEXT_GUARD_DESCRIPTOR(d_publicHandle);
-    NTCI_LOG_CONTEXT_GUARD_SOURCE_ENDPOINT(d_sourceEndpoint);
-    NTCI_LOG_CONTEXT_GUARD_REMOTE_ENDPOINT(d_remoteEndpoint);
-
-    ntsa::Error error;
-
-    if (NTCCFG_UNLIKELY(!d_openState.canReceive())) {
-        return ntsa::Error(ntsa::Error::e_INVALID);
-    }
-
-    if (NTCCFG_UNLIKELY(d_receiveQueue.size() == 0 &&
-                        !d_shutdownState.canReceive()))
-    {
-        return ntsa::Error(ntsa::Error::e_EOF);
-    }
-
     bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry> callbackEntry =
         d_receiveQueue.createCallbackEntry();
     callbackEntry->assign(callback, options);
 
-    if (NTCCFG_LIKELY(!d_receiveQueue.hasCallbackEntry() &&
-                      d_receiveQueue.size() >= options.minSize()))
-    {
-        BSLS_ASSERT(d_receiveQueue.hasEntry());
-        BSLS_ASSERT(d_receiveQueue.size() ==
-                    NTCCFG_WARNING_PROMOTE(bsl::size_t,
-                                           d_receiveQueue.data()->length()));
-
-        bool receiveQueueHighWatermarkViolatedBefore =
-            d_receiveQueue.isHighWatermarkViolated();
-
-        bsl::size_t numBytesRemaining = options.maxSize();
-        bsl::size_t numBytesDequeued  = 0;
-
-        while (NTCCFG_LIKELY(d_receiveQueue.hasEntry())) {
-            ntcq::ReceiveQueueEntry& entry = d_receiveQueue.frontEntry();
-
-            bsl::size_t numBytesToDequeue =
-                bsl::min(numBytesRemaining, entry.length());
-
-            numBytesDequeued += numBytesToDequeue;
-            BSLS_ASSERT(numBytesDequeued <= options.maxSize());
-
-            BSLS_ASSERT(numBytesRemaining >= numBytesToDequeue);
-            numBytesRemaining -= numBytesToDequeue;
-
-            if (numBytesToDequeue == entry.length()) {
-                NTCS_METRICS_UPDATE_READ_QUEUE_DELAY(entry.delay());
-
-                if (d_receiveQueue.popEntry()) {
-                    break;
-                }
-            }
-            else {
-                d_receiveQueue.popSize(numBytesToDequeue);
-                break;
-            }
-
-            if (numBytesRemaining == 0) {
-                break;
-            }
-        }
-
-        BSLS_ASSERT(numBytesDequeued >= options.minSize());
-        BSLS_ASSERT(numBytesDequeued <= options.maxSize());
-
-        bsl::shared_ptr<bdlbb::Blob> data =
-            d_dataPool_sp->createIncomingBlob();
-
-        ntcs::BlobUtil::append(data, d_receiveQueue.data(), numBytesDequeued);
-
-        ntcs::BlobUtil::pop(d_receiveQueue.data(), numBytesDequeued);
-
-        BSLS_ASSERT(d_receiveQueue.size() ==
-                    NTCCFG_WARNING_PROMOTE(bsl::size_t,
-                                           d_receiveQueue.data()->length()));
-
-        NTCP_STREAMSOCKET_LOG_READ_QUEUE_DRAINED(d_receiveQueue.size());
-
-        NTCS_METRICS_UPDATE_READ_QUEUE_SIZE(d_receiveQueue.size());
-
-        ntca::ReceiveContext receiveContext;
-        receiveContext.setTransport(d_transport);
-        receiveContext.setEndpoint(d_remoteEndpoint);
-
-        ntca::ReceiveEvent receiveEvent;
-        receiveEvent.setType(ntca::ReceiveEventType::e_COMPLETE);
-        receiveEvent.setContext(receiveContext);
-
-        const bool defer = !options.recurse();
+    return this->privateReceive(self, callbackEntry);
+}
 
-        ntcq::ReceiveCallbackQueueEntry::dispatch(callbackEntry,
-                                                  self,
-                                                  data,
-                                                  receiveEvent,
-                                                  ntci::Strand::unknown(),
-                                                  self,
-                                                  defer,
-                                                  &d_mutex);
+ntsa::Error StreamSocket::receive(const ntca::ReceiveOptions&     options,
+                                  const ntsa::MutableBufferArray& buffers,
+                                  const ntci::ReceiveFunction&    callback)
+{
+    return this->receive(options,
+                         buffers,
+                         this->createReceiveCallback(callback, d_allocator_p));
+}
 
-        bool receiveQueueHighWatermarkViolatedAfter =
-            d_receiveQueue.isHighWatermarkViolated();
+ntsa::Error StreamSocket::receive(const ntca::ReceiveOptions&     options,
+                                  const ntsa::MutableBufferArray& buffers,
+                                  const ntci::ReceiveCallback&    callback)
+{
+    bsl::shared_ptr<StreamSocket> self = this->getSelf(this);
 
-        if (receiveQueueHighWatermarkViolatedBefore &&
-            !receiveQueueHighWatermarkViolatedAfter)
-        {
-            this->privateRelaxFlowControl(self,
-                                          ntca::FlowControlType::e_RECEIVE,
-                                          true,
-                                          false);
-        }
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
-        error = ntsa::Error::e_OK;
+    if (buffers.numBytes() == 0 || options.minSize() > buffers.numBytes()) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
     }
-    else {
-        if (!options.deadline().isNull()) {
-            ntca::TimerOptions timerOptions;
-            timerOptions.setOneShot(true);
-            timerOptions.showEvent(ntca::TimerEventType::e_DEADLINE);
-            timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
-            timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
-
-            ntci::TimerCallback timerCallback = this->createTimerCallback(
-                bdlf::BindUtil::bind(
-                    &StreamSocket::processReceiveDeadlineTimer,
-                    self,
-                    bdlf::PlaceHolders::_1,
-                    bdlf::PlaceHolders::_2,
-                    callbackEntry),
-                d_allocator_p);
 
-            bsl::shared_ptr<ntci::Timer> timer =
-                this->createTimer(timerOptions, timerCallback, d_allocator_p);
+    bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry> callbackEntry =
+        d_receiveQueue.createCallbackEntry();
+    callbackEntry->assign(callback, buffers, options);
 
-            callbackEntry->setTimer(timer);
+    return this->privateReceive(self, callbackEntry);
+}
 
-            timer->schedule(options.deadline().value());
-        }
+ntsa::Error StreamSocket::receiveBatch(
+    const ntca::ReceiveOptions&       options,
+    const ntci::ReceiveBatchFunction& callback)
+{
+    return this->receiveBatch(
+        options,
+        this->createReceiveBatchCallback(callback, d_allocator_p));
+}
 
-        d_receiveQueue.pushCallbackEntry(callbackEntry);
-        error = ntsa::Error::e_WOULD_BLOCK;
-    }
+ntsa::Error StreamSocket::receiveBatch(
+    const ntca::ReceiveOptions&       options,
+    const ntci::ReceiveBatchCallback& callback)
+{
+    bsl::shared_ptr<StreamSocket> self = this->getSelf(this);
 
-    BSLS_ASSERT(error == ntsa::Error::e_OK ||
-                error == ntsa::Error::e_WOULD_BLOCK);
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
-    if (error == ntsa::Error::e_WOULD_BLOCK) {
-        this->privateRelaxFlowControl(self,
-                                      ntca::FlowControlType::e_RECEIVE,
-                                      true,
-                                      false);
-        error = ntsa::Error::e_OK;
-    }
+    bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry> callbackEntry =
+        d_receiveQueue.createCallbackEntry();
+    callbackEntry->assign(callback, options);
 
-    return error;
+    return this->privateReceive(self, callbackEntry);
 }
 
 ntsa::Error StreamSocket::registerResolver(
@@ -5005,6 +5422,16 @@ ntsa::Error StreamSocket::deregisterSession()
     return ntsa::Error();
 }
 
+ntsa::Error StreamSocket::setReceiveFramer(
+    const bsl::shared_ptr<ntci::ReceiveFramer>& framer)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    d_receiveQueue.setFramer(framer);
+
+    return ntsa::Error();
+}
+
 ntsa::Error StreamSocket::setWriteRateLimiter(
     const bsl::shared_ptr<ntci::RateLimiter>& rateLimiter)
 {
@@ -5087,6 +5514,7 @@ ntsa::Error StreamSocket::setWriteQueueHighWatermark(bsl::size_t highWatermark)
     NTCI_LOG_CONTEXT_GUARD_REMOTE_ENDPOINT(d_remoteEndpoint);
 
     d_sendQueue.setHighWatermark(highWatermark);
+    d_sendQueueHighWatermark = highWatermark;
 
     if (d_sendQueue.authorizeHighWatermarkEvent()) {
         NTCP_STREAMSOCKET_LOG_WRITE_QUEUE_HIGH_WATERMARK(
@@ -5128,6 +5556,7 @@ ntsa::Error StreamSocket::setWriteQueueWatermarks(bsl::size_t lowWatermark,
 
     d_sendQueue.setLowWatermark(lowWatermark);
     d_sendQueue.setHighWatermark(highWatermark);
+    d_sendQueueHighWatermark = highWatermark;
 
     if (d_sendQueue.authorizeLowWatermarkEvent()) {
         NTCP_STREAMSOCKET_LOG_WRITE_QUEUE_LOW_WATERMARK(
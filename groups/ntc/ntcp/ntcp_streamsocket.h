@@ -109,6 +109,13 @@ class StreamSocket : public ntci::StreamSocket,
     ntcq::SendQueue                            d_sendQueue;
     bsl::shared_ptr<ntci::RateLimiter>         d_sendRateLimiter_sp;
     bsl::shared_ptr<ntci::Timer>               d_sendRateTimer_sp;
+    bsl::shared_ptr<ntci::Timer>               d_sendDeadlineTimer_sp;
+    bsls::TimeInterval                         d_sendDeadlineTimerDue;
+    bool                                       d_sendDeadlineTimerArmed;
+    bool                                       d_adaptiveWriteQueue;
+    bsl::size_t                                d_sendQueueHighWatermark;
+    bsl::shared_ptr<ntci::Timer>               d_tcpInfoTimer_sp;
+    bsl::uint32_t                              d_tcpRetransmittedSegments;
     bool                                       d_sendPending;
     bool                                       d_sendGreedily;
     bsl::uint64_t                              d_sendCount;
@@ -187,12 +194,16 @@ class StreamSocket : public ntci::StreamSocket,
     void processSendRateTimer(const bsl::shared_ptr<ntci::Timer>& timer,
                               const ntca::TimerEvent&             event);
 
-    /// Fail the specified 'entryId' because the none of the entry's data
-    /// had begun to be copied to the socket send buffer within the
-    /// deadline.
+    /// Fail each entry on the write queue none of whose data had begun to
+    /// be copied to the socket send buffer within its deadline.
     void processSendDeadlineTimer(const bsl::shared_ptr<ntci::Timer>& timer,
-                                  const ntca::TimerEvent&             event,
-                                  bsl::uint64_t                       entryId);
+                                  const ntca::TimerEvent&             event);
+
+    /// Sample the state of the TCP connection, record it in the socket
+    /// metrics, and, if the write queue is adaptive, adjust the write queue
+    /// high watermark to the bandwidth-delay product of the connection.
+    void processTcpInfoTimer(const bsl::shared_ptr<ntci::Timer>& timer,
+                             const ntca::TimerEvent&             event);
 
     /// Attempt to copy from the read queue to the receive buffer after the
     /// read rate limiter estimates more data might be able to be received.
@@ -264,6 +275,40 @@ class StreamSocket : public ntci::StreamSocket,
     void privateCompleteReceiveRaw(const bsl::shared_ptr<StreamSocket>& self,
                                    bsl::size_t numBytesReceived);
 
+    /// Dequeue from the read queue according to the options of the specified
+    /// 'callbackEntry', or queue the 'callbackEntry' if the read queue does
+    /// not yet have sufficient data. Return the error.
+    ntsa::Error privateReceive(
+        const bsl::shared_ptr<StreamSocket>&                    self,
+        const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& callbackEntry);
+
+    /// Dequeue the message of the specified 'frameSize' having the specified
+    /// 'framePrefix' and 'frameSuffix' from the read queue and invoke the
+    /// callback of the specified 'callbackEntry' on the specified 'strand'
+    /// according to the specified 'defer' flag. If the 'callbackEntry' is a
+    /// batch, also dequeue each subsequent complete message, up to the
+    /// maximum number of messages and size of the batch, and invoke the
+    /// callback once with all of them. If the 'callbackEntry' has buffers,
+    /// copy the message into those buffers and invoke the callback with a
+    /// null blob.
+    void privateSatisfyReceive(
+        const bsl::shared_ptr<StreamSocket>&                    self,
+        const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& callbackEntry,
+        bsl::size_t                                             frameSize,
+        bsl::size_t                                             framePrefix,
+        bsl::size_t                                             frameSuffix,
+        const bsl::shared_ptr<ntci::Strand>&                    strand,
+        bool                                                    defer);
+
+    /// Dequeue the specified 'frameSize' number of bytes from the read queue
+    /// and append them to the specified 'data', less the specified
+    /// 'framePrefix' and 'frameSuffix'. If 'data' is null, discard the
+    /// bytes dequeued.
+    void privateDequeueReceiveData(bdlbb::Blob* data,
+                                   bsl::size_t  frameSize,
+                                   bsl::size_t  framePrefix,
+                                   bsl::size_t  frameSuffix);
+
     /// Process the failure of the reception of a message. The behavior is
     /// undefined unless 'd_mutex' is locked.
     void privateFailReceive(const bsl::shared_ptr<StreamSocket>& self,
@@ -273,6 +318,46 @@ class StreamSocket : public ntci::StreamSocket,
     /// queue, if allowed and necessary.
     void privateInitiateSend(const bsl::shared_ptr<StreamSocket>& self);
 
+    /// Arm the write queue deadline timer to expire at the earliest
+    /// deadline of the entries on the write queue, unless already armed to
+    /// expire no later than that deadline. The behavior is undefined unless
+    /// 'd_mutex' is locked.
+    void privateScheduleSendDeadline(
+        const bsl::shared_ptr<StreamSocket>& self);
+
+    /// Fail each entry on the write queue none of whose data has begun to
+    /// be copied to the socket send buffer within its deadline, then re-arm
+    /// the write queue deadline timer for the earliest remaining deadline,
+    /// if any. The behavior is undefined unless 'd_mutex' is locked.
+    void privateExpireSendQueue(const bsl::shared_ptr<StreamSocket>& self);
+
+    /// Replace the entry on the write queue having the same conflation key
+    /// as the specified 'entry' with 'entry', retaining its position on the
+    /// write queue, and fail the callback of the replaced entry, if any,
+    /// provided such an entry exists and none of its data has begun to be
+    /// copied to the socket send buffer. Return true if an entry was
+    /// replaced, otherwise return false. The behavior is undefined unless
+    /// 'd_mutex' is locked.
+    bool privateConflateSend(const bsl::shared_ptr<StreamSocket>& self,
+                             const ntcq::SendQueueEntry&          entry);
+
+    /// Return true if data having the specified 'size' sent according to
+    /// the specified 'options' would replace an entry on the write queue
+    /// having the same conflation key without growing the write queue past
+    /// the specified 'effectiveHighWatermark', or, if the write queue is
+    /// already past 'effectiveHighWatermark', without growing the write
+    /// queue at all, otherwise return false. The behavior is undefined
+    /// unless 'd_mutex' is locked.
+    bool privateCanConflateSend(
+        bsl::size_t              size,
+        const ntca::SendOptions& options,
+        bsl::size_t              effectiveHighWatermark) const;
+
+    /// Begin periodically sampling the state of the TCP connection, if
+    /// configured. The behavior is undefined unless 'd_mutex' is locked.
+    void privateStartTcpInfoSampling(
+        const bsl::shared_ptr<StreamSocket>& self);
+
     /// Process the completion of the transmission of raw or
     /// already-encrypted data at the head of the write queue according to
     /// the specified 'numBytesSent'. The behavior is undefined unless
@@ -1030,6 +1115,60 @@ class StreamSocket : public ntci::StreamSocket,
                         const ntci::ReceiveCallback& callback)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Dequeue received data according to the specified 'options' by
+    /// copying it into the memory referenced by the specified 'buffers',
+    /// then invoke the specified 'callback' with a null blob and an event
+    /// whose context describes the number of bytes received. The memory
+    /// referenced by 'buffers' must remain valid until the 'callback' is
+    /// invoked. Return the error. Note that callbacks created by this object
+    /// will automatically be invoked on this object's strand unless an
+    /// explicit strand is specified at the time the callback is created.
+    ntsa::Error receive(const ntca::ReceiveOptions&     options,
+                        const ntsa::MutableBufferArray& buffers,
+                        const ntci::ReceiveFunction&    callback)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Dequeue received data according to the specified 'options' by
+    /// copying it into the memory referenced by the specified 'buffers',
+    /// then invoke the specified 'callback' with a null blob and an event
+    /// whose context describes the number of bytes received. The memory
+    /// referenced by 'buffers' must remain valid until the 'callback' is
+    /// invoked. Return the error. Note that callbacks created by this object
+    /// will automatically be invoked on this object's strand unless an
+    /// explicit strand is specified at the time the callback is created.
+    ntsa::Error receive(const ntca::ReceiveOptions&     options,
+                        const ntsa::MutableBufferArray& buffers,
+                        const ntci::ReceiveCallback&    callback)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Dequeue up to the maximum number of messages defined by the specified
+    /// 'options' from the read queue and invoke the specified 'callback' once
+    /// with all of them, as soon as at least one message is available. The
+    /// total size of the messages in the batch is limited by the maximum size
+    /// defined by 'options', except that the first message is always
+    /// delivered. Each message is defined by the framer of the operation or of
+    /// this socket, or, when neither is defined, is all the data in the read
+    /// queue. Return the error. Note that callbacks created by this object
+    /// will automatically be invoked on this object's strand unless an
+    /// explicit strand is specified at the time the callback is created.
+    ntsa::Error receiveBatch(const ntca::ReceiveOptions&       options,
+                             const ntci::ReceiveBatchFunction& callback)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Dequeue up to the maximum number of messages defined by the specified
+    /// 'options' from the read queue and invoke the specified 'callback' once
+    /// with all of them, as soon as at least one message is available. The
+    /// total size of the messages in the batch is limited by the maximum size
+    /// defined by 'options', except that the first message is always
+    /// delivered. Each message is defined by the framer of the operation or of
+    /// this socket, or, when neither is defined, is all the data in the read
+    /// queue. Return the error. Note that callbacks created by this object
+    /// will automatically be invoked on this object's strand unless an
+    /// explicit strand is specified at the time the callback is created.
+    ntsa::Error receiveBatch(const ntca::ReceiveOptions&       options,
+                             const ntci::ReceiveBatchCallback& callback)
+        BSLS_KEYWORD_OVERRIDE;
+
     /// Register the specified 'resolver' for this socket. Return the error.
     ntsa::Error registerResolver(
         const bsl::shared_ptr<ntci::Resolver>& resolver) BSLS_KEYWORD_OVERRIDE;
@@ -1068,6 +1207,14 @@ class StreamSocket : public ntci::StreamSocket,
     /// Return the error.
     ntsa::Error deregisterSession() BSLS_KEYWORD_OVERRIDE;
 
+    /// Set the framer used to detect the boundaries of messages in the
+    /// incoming data when the options of a receive operation do not define
+    /// their own framer to the specified 'framer'. If 'framer' is null, the
+    /// incoming data is only framed according to the options of each receive
+    /// operation. Return the error.
+    ntsa::Error setReceiveFramer(const bsl::shared_ptr<ntci::ReceiveFramer>&
+                                     framer) BSLS_KEYWORD_OVERRIDE;
+
     /// Set the write rate limiter to the specified 'rateLimiter'. Return
     /// the error.
     ntsa::Error setWriteRateLimiter(const bsl::shared_ptr<ntci::RateLimiter>&
@@ -30,6 +30,7 @@ BSLS_IDENT_RCSID(ntcp_thread_cpp, "$Id$ $CSID$")
 #include <ntcs_datapool.h>
 #include <ntcs_metrics.h>
 #include <ntcs_nomenclature.h>
+#include <ntcs_numautil.h>
 #include <ntcs_proactormetrics.h>
 #include <ntcs_threadutil.h>
 
@@ -72,6 +73,16 @@ void* Thread::run(ntcp::Thread* thread)
     NTCI_LOG_CONTEXT_GUARD_OWNER(
         thread->d_config.metricName().value().c_str());
 
+    if (!thread->d_config.numaNode().isNull()) {
+        ntsa::Error error =
+            ntcs::NumaUtil::bind(thread->d_config.numaNode().value());
+        if (error) {
+            NTCI_LOG_WARN("Failed to bind thread to NUMA node %d: %s",
+                          (int)(thread->d_config.numaNode().value()),
+                          error.text().c_str());
+        }
+    }
+
     ntca::WaiterOptions waiterOptions;
 
     ntci::Waiter waiter = thread->d_proactor_sp->registerWaiter(waiterOptions);
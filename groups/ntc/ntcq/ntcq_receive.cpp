@@ -26,6 +26,7 @@ BSLS_IDENT_RCSID(ntcq_receive_cpp, "$Id$ $CSID$")
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 #include <bsls_assert.h>
+#include <bsl_algorithm.h>
 #include <bsl_limits.h>
 
 namespace BloombergLP {
@@ -36,7 +37,9 @@ ReceiveCallbackQueueEntry::ReceiveCallbackQueueEntry(
 : d_object("ntcq::ReceiveCallbackQueueEntry")
 , d_state()
 , d_callback(basicAllocator)
+, d_batchCallback(basicAllocator)
 , d_options()
+, d_buffers(basicAllocator)
 , d_timer_sp()
 {
 }
@@ -44,6 +47,7 @@ ReceiveCallbackQueueEntry::ReceiveCallbackQueueEntry(
 ReceiveCallbackQueueEntry::~ReceiveCallbackQueueEntry()
 {
     BSLS_ASSERT(!d_callback);
+    BSLS_ASSERT(!d_batchCallback);
     BSLS_ASSERT(!d_timer_sp);
 }
 
@@ -51,7 +55,9 @@ void ReceiveCallbackQueueEntry::clear()
 {
     d_state.reset();
     d_callback.reset();
+    d_batchCallback.reset();
     d_options.reset();
+    d_buffers.clear();
     if (d_timer_sp) {
         d_timer_sp->close();
         d_timer_sp.reset();
@@ -74,6 +80,29 @@ void ReceiveCallbackQueueEntry::dispatch(
             entry->d_timer_sp.reset();
         }
 
+        if (NTCCFG_UNLIKELY(entry->d_batchCallback)) {
+            ntci::ReceiveBatchCallback batchCallback = entry->d_batchCallback;
+            entry->d_batchCallback.reset();
+
+            bsl::vector<ntci::ReceiveResult> results;
+            if (data) {
+                ntci::ReceiveResult result;
+                result.setData(data);
+                result.setEvent(event);
+
+                results.push_back(result);
+            }
+
+            batchCallback.dispatch(receiver,
+                                   results,
+                                   event,
+                                   strand,
+                                   executor,
+                                   defer,
+                                   mutex);
+            return;
+        }
+
         ntci::ReceiveCallback callback = entry->d_callback;
         entry->d_callback.reset();
 
@@ -89,6 +118,37 @@ void ReceiveCallbackQueueEntry::dispatch(
     }
 }
 
+void ReceiveCallbackQueueEntry::dispatch(
+    const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& entry,
+    const bsl::shared_ptr<ntci::Receiver>&                  receiver,
+    const bsl::vector<ntci::ReceiveResult>&                 results,
+    const ntca::ReceiveEvent&                               event,
+    const bsl::shared_ptr<ntci::Strand>&                    strand,
+    const bsl::shared_ptr<ntci::Executor>&                  executor,
+    bool                                                    defer,
+    bslmt::Mutex*                                           mutex)
+{
+    if (NTCCFG_LIKELY(entry->d_state.finish())) {
+        if (entry->d_timer_sp) {
+            entry->d_timer_sp->close();
+            entry->d_timer_sp.reset();
+        }
+
+        ntci::ReceiveBatchCallback batchCallback = entry->d_batchCallback;
+        entry->d_batchCallback.reset();
+
+        if (batchCallback) {
+            batchCallback.dispatch(receiver,
+                                   results,
+                                   event,
+                                   strand,
+                                   executor,
+                                   defer,
+                                   mutex);
+        }
+    }
+}
+
 void ReceiveCallbackQueueEntryPool::construct(void*             address,
                                               bslma::Allocator* allocator)
 {
@@ -130,6 +190,9 @@ ReceiveQueue::ReceiveQueue(bslma::Allocator* basicAllocator)
 , d_watermarkLowWanted(true)
 , d_watermarkHigh(NTCCFG_DEFAULT_STREAM_SOCKET_READ_QUEUE_HIGH_WATERMARK)
 , d_watermarkHighWanted(true)
+, d_framer_sp()
+, d_builtinFramer_p(0)
+, d_optionsFramer()
 , d_callbackQueue(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
@@ -141,5 +204,97 @@ ReceiveQueue::~ReceiveQueue()
 {
 }
 
+ntsa::Error ReceiveQueue::popCallbackEntry(
+    bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>* result,
+    bsl::size_t*                                      size,
+    bsl::size_t*                                      prefix,
+    bsl::size_t*                                      suffix)
+{
+    ntsa::Error error;
+
+    if (d_callbackQueue.empty()) {
+        return ntsa::Error::invalid();
+    }
+
+    if (d_entryList.empty()) {
+        return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
+    }
+
+    error = this->frame(size,
+                        prefix,
+                        suffix,
+                        d_callbackQueue.front()->options());
+    if (error == ntsa::Error::e_WOULD_BLOCK) {
+        return error;
+    }
+
+    d_callbackQueue.pop(result);
+
+    return error;
+}
+
+ntsa::Error ReceiveQueue::frame(bsl::size_t*                size,
+                                bsl::size_t*                prefix,
+                                bsl::size_t*                suffix,
+                                const ntca::ReceiveOptions& options) const
+{
+    ntsa::Error error;
+
+    *size   = 0;
+    *prefix = 0;
+    *suffix = 0;
+
+    if (d_entryList.empty()) {
+        return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
+    }
+
+    if (NTCCFG_LIKELY(options.framer().isNull() && !d_framer_sp)) {
+        if (d_size < options.minSize()) {
+            return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
+        }
+
+        *size = bsl::min(d_size, options.maxSize());
+        return ntsa::Error();
+    }
+
+    BSLS_ASSERT(d_data_sp);
+    BSLS_ASSERT(d_size == static_cast<bsl::size_t>(d_data_sp->length()));
+
+    if (!options.framer().isNull()) {
+        if (d_optionsFramer.configuration() != options.framer().value()) {
+            d_optionsFramer.setConfiguration(options.framer().value());
+        }
+
+        error = d_optionsFramer.frame(size,
+                                      prefix,
+                                      suffix,
+                                      *d_data_sp,
+                                      options.maxSize());
+    }
+    else if (d_builtinFramer_p) {
+        error = d_builtinFramer_p->frame(size,
+                                         prefix,
+                                         suffix,
+                                         *d_data_sp,
+                                         options.maxSize());
+    }
+    else {
+        error = d_framer_sp->frame(size, prefix, suffix, *d_data_sp);
+    }
+
+    if (error) {
+        return error;
+    }
+
+    BSLS_ASSERT(*size <= d_size);
+    BSLS_ASSERT(*prefix + *suffix <= *size);
+
+    if (*size - *prefix - *suffix > options.maxSize()) {
+        return ntsa::Error(ntsa::Error::e_LIMIT);
+    }
+
+    return ntsa::Error();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -23,14 +23,19 @@ BSLS_IDENT("$Id: $")
 #include <ntca_receiveoptions.h>
 #include <ntccfg_limits.h>
 #include <ntccfg_platform.h>
+#include <ntccfg_tracepoint.h>
 #include <ntci_log.h>
+#include <ntci_receivebatchcallback.h>
 #include <ntci_receivecallback.h>
+#include <ntci_receiveframer.h>
 #include <ntci_receiver.h>
 #include <ntci_strand.h>
 #include <ntci_timer.h>
 #include <ntcs_callbackstate.h>
+#include <ntcs_receiveframer.h>
 #include <ntcs_watermarkutil.h>
 #include <ntcscm_version.h>
+#include <ntsa_buffer.h>
 #include <ntsa_error.h>
 #include <bdlb_nullablevalue.h>
 #include <bdlbb_blob.h>
@@ -60,7 +65,9 @@ class ReceiveCallbackQueueEntry
     ntccfg::Object               d_object;
     ntcs::CallbackState          d_state;
     ntci::ReceiveCallback        d_callback;
+    ntci::ReceiveBatchCallback   d_batchCallback;
     ntca::ReceiveOptions         d_options;
+    ntsa::MutableBufferArray     d_buffers;
     bsl::shared_ptr<ntci::Timer> d_timer_sp;
 
   private:
@@ -87,6 +94,19 @@ class ReceiveCallbackQueueEntry
     void assign(const ntci::ReceiveCallback& callback,
                 const ntca::ReceiveOptions&  options);
 
+    /// Assign the specified batch 'callback' to be invoked with one or more
+    /// messages once the specified 'options' are met.
+    void assign(const ntci::ReceiveBatchCallback& callback,
+                const ntca::ReceiveOptions&       options);
+
+    /// Assign the specified 'callback' to be invoked once data has been
+    /// copied into the memory referenced by the specified 'buffers' according
+    /// to the specified 'options'. The maximum size of the operation is
+    /// limited to the capacity of 'buffers'.
+    void assign(const ntci::ReceiveCallback&    callback,
+                const ntsa::MutableBufferArray& buffers,
+                const ntca::ReceiveOptions&     options);
+
     /// Set the timer to the specified 'timer'.
     void setTimer(const bsl::shared_ptr<ntci::Timer>& timer);
 
@@ -96,18 +116,51 @@ class ReceiveCallbackQueueEntry
     /// Return the criteria to invoke the callback.
     const ntca::ReceiveOptions& options() const;
 
+    /// Return the buffers into which received data is copied, which is
+    /// empty unless the caller supplied buffers to the operation.
+    const ntsa::MutableBufferArray& buffers() const;
+
+    /// Return true if the callback of this entry is a batch callback,
+    /// otherwise return false.
+    bool isBatch() const;
+
+    /// Return true if received data is copied into the buffers supplied to
+    /// the operation, otherwise return false.
+    bool hasBuffers() const;
+
     /// Invoke the callback of the specified 'entry' for the specified
-    /// 'receiver', 'data', and 'event'. If the specified 'defer' flag
+    /// 'receiver', 'data', and 'event'. If the callback of 'entry' is a
+    /// batch callback, invoke it with a single result describing 'data' and
+    /// 'event', or with no results if 'data' is null. If the specified
+    /// 'defer' flag is false and the requirements of the strand of the
+    /// specified 'entry' permits the callback to be invoked immediately by
+    /// the 'strand', unlock the specified 'mutex', invoke the callback, then
+    /// relock the 'mutex'. Otherwise, enqueue the invocation of the callback
+    /// to be executed on the strand of the 'entry', if defined, or by the
+    /// specified 'executor' otherwise.
+    static void dispatch(
+        const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& entry,
+        const bsl::shared_ptr<ntci::Receiver>&                  receiver,
+        const bsl::shared_ptr<bdlbb::Blob>&                     data,
+        const ntca::ReceiveEvent&                               event,
+        const bsl::shared_ptr<ntci::Strand>&                    strand,
+        const bsl::shared_ptr<ntci::Executor>&                  executor,
+        bool                                                    defer,
+        bslmt::Mutex*                                           mutex);
+
+    /// Invoke the batch callback of the specified 'entry' for the specified
+    /// 'receiver', 'results', and 'event'. If the specified 'defer' flag
     /// is false and the requirements of the strand of the specified 'entry'
     /// permits the callback to be invoked immediately by the 'strand',
     /// unlock the specified 'mutex', invoke the callback, then relock the
     /// 'mutex'. Otherwise, enqueue the invocation of the callback to be
     /// executed on the strand of the 'entry', if defined, or by the
-    /// specified 'executor' otherwise.
+    /// specified 'executor' otherwise. Note that no callback is invoked if
+    /// the callback of 'entry' is not a batch callback.
     static void dispatch(
         const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& entry,
         const bsl::shared_ptr<ntci::Receiver>&                  receiver,
-        const bsl::shared_ptr<bdlbb::Blob>&                     data,
+        const bsl::vector<ntci::ReceiveResult>&                 results,
         const ntca::ReceiveEvent&                               event,
         const bsl::shared_ptr<ntci::Strand>&                    strand,
         const bsl::shared_ptr<ntci::Executor>&                  executor,
@@ -222,6 +275,10 @@ class ReceiveCallbackQueue
     ntsa::Error pop(bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>* result,
                     bsl::size_t numBytesAvailable);
 
+    /// Pop the entry at the front of the queue regardless of its criteria
+    /// and load it into the specified 'result'. Return the error.
+    ntsa::Error pop(bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>* result);
+
     /// Remove the specified 'entry' from the queue, if found. Return the
     /// error.
     ntsa::Error remove(
@@ -238,6 +295,10 @@ class ReceiveCallbackQueue
         bsl::vector<bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry> >*
             result);
 
+    /// Return the entry at the front of the queue. The behavior is
+    /// undefined if the queue is empty.
+    const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& front() const;
+
     /// Return the number of callbacks in the queue.
     bsl::size_t size() const;
 
@@ -425,20 +486,28 @@ class ReceiveQueue
     /// the read queue.
     typedef bsl::list<ReceiveQueueEntry> EntryList;
 
-    EntryList                    d_entryList;
-    bsl::shared_ptr<bdlbb::Blob> d_data_sp;
-    bsl::size_t                  d_size;
-    bsl::size_t                  d_watermarkLow;
-    bool                         d_watermarkLowWanted;
-    bsl::size_t                  d_watermarkHigh;
-    bool                         d_watermarkHighWanted;
-    ReceiveCallbackQueue         d_callbackQueue;
-    bslma::Allocator*            d_allocator_p;
+    EntryList                            d_entryList;
+    bsl::shared_ptr<bdlbb::Blob>         d_data_sp;
+    bsl::size_t                          d_size;
+    bsl::size_t                          d_watermarkLow;
+    bool                                 d_watermarkLowWanted;
+    bsl::size_t                          d_watermarkHigh;
+    bool                                 d_watermarkHighWanted;
+    bsl::shared_ptr<ntci::ReceiveFramer> d_framer_sp;
+    ntcs::ReceiveFramer*                 d_builtinFramer_p;
+    mutable ntcs::ReceiveFramer          d_optionsFramer;
+    ReceiveCallbackQueue                 d_callbackQueue;
+    bslma::Allocator*                    d_allocator_p;
 
   private:
     ReceiveQueue(const ReceiveQueue&) BSLS_KEYWORD_DELETED;
     ReceiveQueue& operator=(const ReceiveQueue&) BSLS_KEYWORD_DELETED;
 
+  private:
+    /// Make the built-in framers rescan the queue from its front, since
+    /// data has been removed from it.
+    void resetFramers();
+
   public:
     /// Create a new receive from message queue. Optionally specify a
     /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
@@ -480,6 +549,20 @@ class ReceiveQueue
     ntsa::Error popCallbackEntry(
         bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>* result);
 
+    /// Pop the callback entry at the front of the queue if the data in the
+    /// queue can be framed according to its options, load it into the
+    /// specified 'result', and load into the specified 'size', 'prefix',
+    /// and 'suffix' the framing of the data to dequeue for it, as described
+    /// by 'frame()'. Return the error. Note that if the data in the queue is
+    /// malformed, the callback entry is popped and the framing error is
+    /// returned, and if the data in the queue is insufficient, the callback
+    /// entry is not popped and 'ntsa::Error::e_WOULD_BLOCK' is returned.
+    ntsa::Error popCallbackEntry(
+        bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>* result,
+        bsl::size_t*                                      size,
+        bsl::size_t*                                      prefix,
+        bsl::size_t*                                      suffix);
+
     /// Pop all callback entries into the specified 'result'.
     void popAllCallbackEntries(
         bsl::vector<bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry> >*
@@ -505,6 +588,22 @@ class ReceiveQueue
     /// Set the high watermark to the specified 'highWatermark'.
     void setHighWatermark(bsl::size_t highWatermark);
 
+    /// Set the framer used to detect the boundaries of messages in the
+    /// queue, when the options of a receive operation do not define their
+    /// own framer, to the specified 'framer'. If 'framer' is null, the data
+    /// in the queue is only framed according to the options of each receive
+    /// operation.
+    void setFramer(const bsl::shared_ptr<ntci::ReceiveFramer>& framer);
+
+    /// Set the framer used to detect the boundaries of messages in the
+    /// queue, when the options of a receive operation do not define their
+    /// own framer, to the specified built-in 'framer'. The 'framer' resumes
+    /// each scan of the queue where its previous scan stopped, and fails as
+    /// soon as the message at the front of the queue is known to be larger
+    /// than the maximum size defined by the options of a receive operation.
+    /// The behavior is undefined unless 'framer' is used by no other queue.
+    void setFramer(const bsl::shared_ptr<ntcs::ReceiveFramer>& framer);
+
     /// Return true if the queue has been filled to greater than or equal
     /// to the low watermark, otherwise return false.
     bool authorizeLowWatermarkEvent();
@@ -522,6 +621,30 @@ class ReceiveQueue
     /// Return the high watermark.
     bsl::size_t highWatermark() const;
 
+    /// Return the framer used to detect the boundaries of messages in the
+    /// queue, if any.
+    const bsl::shared_ptr<ntci::ReceiveFramer>& framer() const;
+
+    /// Load into the specified 'size' the number of bytes at the front of
+    /// the queue to dequeue to satisfy a receive operation having the
+    /// specified 'options', and load into the specified 'prefix' and
+    /// 'suffix' the number of bytes at the beginning and end, respectively,
+    /// of those bytes that should not be delivered to the user. Return the
+    /// error. If a framer is defined by 'options', or otherwise by this
+    /// object, the result describes exactly one complete message, and the
+    /// operation fails with 'ntsa::Error::e_LIMIT' if that message, less
+    /// its prefix and suffix, is larger than the maximum size defined by
+    /// 'options'; built-in framers detect such a message as soon as its size
+    /// is known, before the entire message is received. Otherwise the result
+    /// describes all the data in the queue, up to the maximum size defined
+    /// by 'options', and the operation fails with
+    /// 'ntsa::Error::e_WOULD_BLOCK' if the queue has less data than the
+    /// minimum size defined by 'options'.
+    ntsa::Error frame(bsl::size_t*                size,
+                      bsl::size_t*                prefix,
+                      bsl::size_t*                suffix,
+                      const ntca::ReceiveOptions& options) const;
+
     /// Return the number of bytes on the queue.
     bsl::size_t size() const;
 
@@ -534,6 +657,11 @@ class ReceiveQueue
     /// false otherwise.
     bool hasCallbackEntry() const;
 
+    /// Return the callback entry at the front of the callback queue. The
+    /// behavior is undefined unless 'hasCallbackEntry()' is true.
+    const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>&
+    frontCallbackEntry() const;
+
     /// Return true if the low watermark is satisfied, otherwise return
     /// false.
     bool isLowWatermarkSatisfied() const;
@@ -554,6 +682,30 @@ void ReceiveCallbackQueueEntry::assign(const ntci::ReceiveCallback& callback,
     d_options  = options;
 }
 
+NTCCFG_INLINE
+void ReceiveCallbackQueueEntry::assign(
+    const ntci::ReceiveBatchCallback& callback,
+    const ntca::ReceiveOptions&       options)
+{
+    d_batchCallback = callback;
+    d_options       = options;
+}
+
+NTCCFG_INLINE
+void ReceiveCallbackQueueEntry::assign(
+    const ntci::ReceiveCallback&    callback,
+    const ntsa::MutableBufferArray& buffers,
+    const ntca::ReceiveOptions&     options)
+{
+    d_callback = callback;
+    d_buffers  = buffers;
+    d_options  = options;
+
+    if (d_options.maxSize() > d_buffers.numBytes()) {
+        d_options.setMaxSize(d_buffers.numBytes());
+    }
+}
+
 NTCCFG_INLINE
 void ReceiveCallbackQueueEntry::setTimer(
     const bsl::shared_ptr<ntci::Timer>& timer)
@@ -576,6 +728,24 @@ const ntca::ReceiveOptions& ReceiveCallbackQueueEntry::options() const
     return d_options;
 }
 
+NTCCFG_INLINE
+const ntsa::MutableBufferArray& ReceiveCallbackQueueEntry::buffers() const
+{
+    return d_buffers;
+}
+
+NTCCFG_INLINE
+bool ReceiveCallbackQueueEntry::isBatch() const
+{
+    return static_cast<bool>(d_batchCallback);
+}
+
+NTCCFG_INLINE
+bool ReceiveCallbackQueueEntry::hasBuffers() const
+{
+    return d_buffers.numBuffers() != 0;
+}
+
 NTCCFG_INLINE
 bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry> ReceiveCallbackQueueEntryPool::
     create()
@@ -629,6 +799,20 @@ ntsa::Error ReceiveCallbackQueue::pop(
     }
 }
 
+NTCCFG_INLINE
+ntsa::Error ReceiveCallbackQueue::pop(
+    bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>* result)
+{
+    if (!d_entryList.empty()) {
+        *result = d_entryList.front();
+        d_entryList.pop_front();
+        return ntsa::Error();
+    }
+    else {
+        return ntsa::Error::invalid();
+    }
+}
+
 NTCCFG_INLINE
 ntsa::Error ReceiveCallbackQueue::remove(
     const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& entry)
@@ -678,6 +862,14 @@ void ReceiveCallbackQueue::removeAll(
     d_entryList.clear();
 }
 
+NTCCFG_INLINE
+const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& ReceiveCallbackQueue::
+    front() const
+{
+    BSLS_ASSERT(!d_entryList.empty());
+    return d_entryList.front();
+}
+
 NTCCFG_INLINE
 bsl::size_t ReceiveCallbackQueue::size() const
 {
@@ -894,6 +1086,16 @@ bsl::size_t ReceiveFeedback::decreaseFactor() const
     return d_decreaseFactor;
 }
 
+NTCCFG_INLINE
+void ReceiveQueue::resetFramers()
+{
+    d_optionsFramer.reset();
+
+    if (d_builtinFramer_p) {
+        d_builtinFramer_p->reset();
+    }
+}
+
 NTCCFG_INLINE
 bool ReceiveQueue::pushEntry(const ReceiveQueueEntry& entry)
 {
@@ -902,6 +1104,8 @@ bool ReceiveQueue::pushEntry(const ReceiveQueueEntry& entry)
     BSLS_ASSERT(entry.length() > 0);
     d_size += entry.length();
 
+    NTCCFG_TRACEPOINT3(receive_queue_push, this, entry.length(), d_size);
+
     return d_entryList.size() == 1;
 }
 
@@ -920,8 +1124,15 @@ bool ReceiveQueue::popEntry()
         BSLS_ASSERT(entry.length() > 0);
         BSLS_ASSERT(d_size >= entry.length());
         d_size -= entry.length();
+
+        NTCCFG_TRACEPOINT3(receive_queue_pop,
+                           this,
+                           entry.length(),
+                           entry.timestamp());
     }
 
+    this->resetFramers();
+
     if (d_size < d_watermarkLow) {
         d_watermarkLowWanted  = true;
         d_watermarkHighWanted = true;
@@ -944,6 +1155,8 @@ void ReceiveQueue::popSize(bsl::size_t numBytes)
     BSLS_ASSERT(d_size >= numBytes);
     d_size -= numBytes;
 
+    this->resetFramers();
+
     if (d_size < d_watermarkLow) {
         d_watermarkLowWanted  = true;
         d_watermarkHighWanted = true;
@@ -1001,6 +1214,7 @@ NTCCFG_INLINE
 void ReceiveQueue::setData(const bsl::shared_ptr<bdlbb::Blob>& data)
 {
     d_data_sp = data;
+    this->resetFramers();
 }
 
 NTCCFG_INLINE
@@ -1022,6 +1236,26 @@ void ReceiveQueue::setHighWatermark(bsl::size_t highWatermark)
                                                          &d_watermarkHigh);
 }
 
+NTCCFG_INLINE
+void ReceiveQueue::setFramer(
+    const bsl::shared_ptr<ntci::ReceiveFramer>& framer)
+{
+    d_framer_sp       = framer;
+    d_builtinFramer_p = 0;
+}
+
+NTCCFG_INLINE
+void ReceiveQueue::setFramer(
+    const bsl::shared_ptr<ntcs::ReceiveFramer>& framer)
+{
+    d_framer_sp       = framer;
+    d_builtinFramer_p = framer.get();
+
+    if (d_builtinFramer_p) {
+        d_builtinFramer_p->reset();
+    }
+}
+
 NTCCFG_INLINE
 bool ReceiveQueue::authorizeLowWatermarkEvent()
 {
@@ -1072,6 +1306,12 @@ bsl::size_t ReceiveQueue::highWatermark() const
     return d_watermarkHigh;
 }
 
+NTCCFG_INLINE
+const bsl::shared_ptr<ntci::ReceiveFramer>& ReceiveQueue::framer() const
+{
+    return d_framer_sp;
+}
+
 NTCCFG_INLINE
 bsl::size_t ReceiveQueue::size() const
 {
@@ -1090,6 +1330,13 @@ bool ReceiveQueue::hasCallbackEntry() const
     return !d_callbackQueue.empty();
 }
 
+NTCCFG_INLINE
+const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& ReceiveQueue::
+    frontCallbackEntry() const
+{
+    return d_callbackQueue.front();
+}
+
 NTCCFG_INLINE
 bool ReceiveQueue::isLowWatermarkSatisfied() const
 {
@@ -17,10 +17,14 @@
 
 #include <ntccfg_bind.h>
 #include <ntccfg_test.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
 #include <bdlf_bind.h>
 #include <bdlf_placeholder.h>
 #include <bslma_allocator.h>
 #include <bslma_default.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
 #include <bsls_assert.h>
 
 using namespace BloombergLP;
@@ -34,8 +38,14 @@ using namespace BloombergLP;
 //-----------------------------------------------------------------------------
 
 // [ 1]
+// [ 5]
+// [ 6]
+// [ 7]
 //-----------------------------------------------------------------------------
 // [ 1]
+// [ 5]
+// [ 6]
+// [ 7]
 //-----------------------------------------------------------------------------
 
 namespace test {
@@ -168,6 +178,18 @@ void processCancelled(bsls::AtomicUint*                   numInvoked,
     ++(*numInvoked);
 }
 
+void processBatch(bsl::vector<ntci::ReceiveResult>*       result,
+                  const bsl::shared_ptr<ntci::Receiver>&  receiver,
+                  const bsl::vector<ntci::ReceiveResult>& results,
+                  const ntca::ReceiveEvent&               event)
+{
+    NTCCFG_WARNING_UNUSED(receiver);
+
+    NTCCFG_TEST_EQ(event.type(), ntca::ReceiveEventType::e_COMPLETE);
+
+    *result = results;
+}
+
 #if 0
 bool complete(const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& entry)
 {
@@ -813,11 +835,308 @@ NTCCFG_TEST_CASE(4)
 #endif
 }
 
+NTCCFG_TEST_CASE(5)
+{
+    // Concern: The data at the front of the queue is framed according to
+    // the receive options, or otherwise the framer of the queue.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+        bsl::size_t size   = 0;
+        bsl::size_t prefix = 0;
+        bsl::size_t suffix = 0;
+
+        bdlbb::PooledBlobBufferFactory blobBufferFactory(4, &ta);
+
+        bsl::shared_ptr<bdlbb::Blob> data;
+        data.createInplace(&ta, &blobBufferFactory, &ta);
+
+        bdlbb::BlobUtil::append(data.get(), "\x03" "abc" "\x02" "de", 7);
+
+        ntcq::ReceiveQueue queue(&ta);
+        queue.setData(data);
+
+        ntcq::ReceiveQueueEntry entry;
+        entry.setLength(7);
+        queue.pushEntry(entry);
+
+        ntca::ReceiveFramer framer;
+        framer.setType(ntca::ReceiveFramerType::e_LENGTH);
+        framer.setLengthSize(1);
+        framer.setStrip(1);
+
+        // Without a framer, all the data up to the maximum size is framed.
+
+        {
+            ntca::ReceiveOptions options;
+            options.setMinSize(1);
+            options.setMaxSize(5);
+
+            error = queue.frame(&size, &prefix, &suffix, options);
+            NTCCFG_TEST_OK(error);
+            NTCCFG_TEST_EQ(size, 5);
+            NTCCFG_TEST_EQ(prefix, 0);
+            NTCCFG_TEST_EQ(suffix, 0);
+        }
+
+        // The framer defined by the options frames exactly one message.
+
+        {
+            ntca::ReceiveOptions options;
+            options.setFramer(framer);
+
+            error = queue.frame(&size, &prefix, &suffix, options);
+            NTCCFG_TEST_OK(error);
+            NTCCFG_TEST_EQ(size, 4);
+            NTCCFG_TEST_EQ(prefix, 1);
+            NTCCFG_TEST_EQ(suffix, 0);
+        }
+
+        // A message larger than the maximum size is rejected.
+
+        {
+            ntca::ReceiveOptions options;
+            options.setFramer(framer);
+            options.setMaxSize(2);
+
+            error = queue.frame(&size, &prefix, &suffix, options);
+            NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_LIMIT));
+        }
+
+        // The framer of the queue applies when the options define none.
+
+        {
+            bsl::shared_ptr<ntcs::ReceiveFramer> queueFramer;
+            queueFramer.createInplace(&ta, framer);
+
+            queue.setFramer(queueFramer);
+
+            ntca::ReceiveOptions options;
+
+            error = queue.frame(&size, &prefix, &suffix, options);
+            NTCCFG_TEST_OK(error);
+            NTCCFG_TEST_EQ(size, 4);
+            NTCCFG_TEST_EQ(prefix, 1);
+            NTCCFG_TEST_EQ(suffix, 0);
+
+            // The maximum size defined by the options bounds the message
+            // framed by the framer of the queue.
+
+            options.setMaxSize(2);
+
+            error = queue.frame(&size, &prefix, &suffix, options);
+            NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_LIMIT));
+
+            queue.setFramer(bsl::shared_ptr<ntci::ReceiveFramer>());
+        }
+
+        // A message declared larger than the maximum size is rejected before
+        // it is entirely received.
+
+        {
+            bsl::shared_ptr<bdlbb::Blob> partial;
+            partial.createInplace(&ta, &blobBufferFactory, &ta);
+
+            bdlbb::BlobUtil::append(partial.get(), "\x09" "ab", 3);
+
+            ntcq::ReceiveQueue partialQueue(&ta);
+            partialQueue.setData(partial);
+
+            ntcq::ReceiveQueueEntry partialEntry;
+            partialEntry.setLength(3);
+            partialQueue.pushEntry(partialEntry);
+
+            ntca::ReceiveOptions options;
+            options.setFramer(framer);
+
+            error = partialQueue.frame(&size, &prefix, &suffix, options);
+            NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+
+            options.setMaxSize(8);
+
+            error = partialQueue.frame(&size, &prefix, &suffix, options);
+            NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_LIMIT));
+
+            partialQueue.popEntry();
+        }
+
+        queue.popEntry();
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(6)
+{
+    // Concern: A batch entry invokes its callback exactly once with every
+    // result, and a batch entry completed with a single blob invokes its
+    // callback with one result.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        typedef ntcq::ReceiveCallbackQueueEntry Entry;
+
+        bdlbb::PooledBlobBufferFactory blobBufferFactory(4, &ta);
+
+        bsl::shared_ptr<ntci::Strand>   strand;
+        bsl::shared_ptr<ntci::Executor> executor;
+        bsl::shared_ptr<ntci::Receiver> receiver;
+
+        bslmt::Mutex                   mutex;
+        bslmt::LockGuard<bslmt::Mutex> guard(&mutex);
+
+        ntca::ReceiveEvent event;
+        event.setType(ntca::ReceiveEventType::e_COMPLETE);
+
+        ntca::ReceiveOptions options;
+        options.setMaxMessages(2);
+
+        bsl::vector<ntci::ReceiveResult> results(&ta);
+
+        for (bsl::size_t i = 0; i < 2; ++i) {
+            bsl::shared_ptr<bdlbb::Blob> data;
+            data.createInplace(&ta, &blobBufferFactory, &ta);
+
+            bdlbb::BlobUtil::append(data.get(), "abc", 3);
+
+            ntci::ReceiveResult result(&ta);
+            result.setData(data);
+            result.setEvent(event);
+
+            results.push_back(result);
+        }
+
+        {
+            bsl::shared_ptr<Entry> entry;
+            entry.createInplace(&ta, &ta);
+
+            bsl::vector<ntci::ReceiveResult> result(&ta);
+
+            entry->assign(ntci::ReceiveBatchCallback(
+                              NTCCFG_BIND(&test::processBatch,
+                                          &result,
+                                          NTCCFG_BIND_PLACEHOLDER_1,
+                                          NTCCFG_BIND_PLACEHOLDER_2,
+                                          NTCCFG_BIND_PLACEHOLDER_3),
+                              &ta),
+                          options);
+
+            NTCCFG_TEST_TRUE(entry->isBatch());
+            NTCCFG_TEST_EQ(entry->options().maxMessages(), 2);
+
+            Entry::dispatch(entry,
+                            receiver,
+                            results,
+                            event,
+                            strand,
+                            executor,
+                            false,
+                            &mutex);
+
+            NTCCFG_TEST_EQ(result.size(), 2);
+            NTCCFG_TEST_EQ(result[0].data(), results[0].data());
+            NTCCFG_TEST_EQ(result[1].data(), results[1].data());
+
+            NTCCFG_TEST_FALSE(entry->isBatch());
+        }
+
+        {
+            bsl::shared_ptr<Entry> entry;
+            entry.createInplace(&ta, &ta);
+
+            bsl::vector<ntci::ReceiveResult> result(&ta);
+
+            entry->assign(ntci::ReceiveBatchCallback(
+                              NTCCFG_BIND(&test::processBatch,
+                                          &result,
+                                          NTCCFG_BIND_PLACEHOLDER_1,
+                                          NTCCFG_BIND_PLACEHOLDER_2,
+                                          NTCCFG_BIND_PLACEHOLDER_3),
+                              &ta),
+                          options);
+
+            Entry::dispatch(entry,
+                            receiver,
+                            results[0].data(),
+                            event,
+                            strand,
+                            executor,
+                            false,
+                            &mutex);
+
+            NTCCFG_TEST_EQ(result.size(), 1);
+            NTCCFG_TEST_EQ(result[0].data(), results[0].data());
+        }
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(7)
+{
+    // Concern: An entry assigned caller-supplied buffers limits the maximum
+    // size of the operation to the capacity of those buffers, and the
+    // queue exposes the entry at its front.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        ntcq::ReceiveQueue queue(&ta);
+
+        char storage1[4];
+        char storage2[6];
+
+        ntsa::MutableBufferArray buffers(&ta);
+        buffers.append(storage1, sizeof storage1);
+        buffers.append(storage2, sizeof storage2);
+
+        ntca::ReceiveOptions options;
+        options.setMinSize(1);
+        options.setMaxSize(1024);
+
+        bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry> entry =
+            queue.createCallbackEntry();
+
+        NTCCFG_TEST_FALSE(entry->hasBuffers());
+
+        entry->assign(ntci::ReceiveCallback(&ta), buffers, options);
+
+        NTCCFG_TEST_TRUE(entry->hasBuffers());
+        NTCCFG_TEST_FALSE(entry->isBatch());
+        NTCCFG_TEST_EQ(entry->buffers().numBuffers(), 2);
+        NTCCFG_TEST_EQ(entry->options().minSize(), 1);
+        NTCCFG_TEST_EQ(entry->options().maxSize(), 10);
+
+        options.setMaxSize(8);
+        entry->assign(ntci::ReceiveCallback(&ta), buffers, options);
+
+        NTCCFG_TEST_EQ(entry->options().maxSize(), 8);
+
+        NTCCFG_TEST_FALSE(queue.hasCallbackEntry());
+
+        queue.pushCallbackEntry(entry);
+
+        NTCCFG_TEST_TRUE(queue.hasCallbackEntry());
+        NTCCFG_TEST_EQ(queue.frontCallbackEntry(), entry);
+
+        queue.removeCallbackEntry(entry);
+
+        NTCCFG_TEST_FALSE(queue.hasCallbackEntry());
+
+        entry.reset();
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
     NTCCFG_TEST_REGISTER(2);
     NTCCFG_TEST_REGISTER(3);
     NTCCFG_TEST_REGISTER(4);
+    NTCCFG_TEST_REGISTER(5);
+    NTCCFG_TEST_REGISTER(6);
+    NTCCFG_TEST_REGISTER(7);
 }
 NTCCFG_TEST_DRIVER_END;
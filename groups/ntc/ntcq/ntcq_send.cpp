@@ -256,7 +256,14 @@ bool SendQueueEntry::batchNext(ntsa::ConstBufferArray*  result,
 }
 
 SendQueue::SendQueue(bslma::Allocator* basicAllocator)
-: d_entryList(basicAllocator)
+: d_nodePool(sizeof(EntryNode), basicAllocator)
+, d_nodeFree_p(0)
+, d_head_p(0)
+, d_tail_p(0)
+, d_entryCount(0)
+, d_deadlineHead_p(0)
+, d_deadlineTail_p(0)
+, d_conflationMap(basicAllocator)
 , d_data_sp()
 , d_size(0)
 , d_watermarkLow(NTCCFG_DEFAULT_STREAM_SOCKET_WRITE_QUEUE_LOW_WATERMARK)
@@ -272,6 +279,26 @@ SendQueue::SendQueue(bslma::Allocator* basicAllocator)
 
 SendQueue::~SendQueue()
 {
+    EntryNode* node = d_head_p;
+    while (node != 0) {
+        EntryNode* next = node->d_next_p;
+        node->~EntryNode();
+        node = next;
+    }
+
+    node = d_nodeFree_p;
+    while (node != 0) {
+        EntryNode* next = node->d_next_p;
+        node->~EntryNode();
+        node = next;
+    }
+
+    d_head_p     = 0;
+    d_tail_p     = 0;
+    d_nodeFree_p = 0;
+    d_entryCount = 0;
+
+    d_nodePool.release();
 }
 
 bool SendQueue::batchNext(ntsa::ConstBufferArray*  result,
@@ -279,7 +306,7 @@ bool SendQueue::batchNext(ntsa::ConstBufferArray*  result,
 {
     result->clear();
 
-    if (d_entryList.size() < 2) {
+    if (d_entryCount < 2) {
         return false;
     }
 
@@ -288,20 +315,19 @@ bool SendQueue::batchNext(ntsa::ConstBufferArray*  result,
         effectiveOptions.setMaxBuffers(ntsu::SocketUtil::maxBuffersPerSend());
     }
 
-    EntryList::const_iterator current = d_entryList.begin();
-    EntryList::const_iterator end     = d_entryList.end();
+    const EntryNode* current = d_head_p;
 
     while (true) {
-        if (current == end) {
+        if (current == 0) {
             break;
         }
 
-        const SendQueueEntry& entry = *current;
+        const SendQueueEntry& entry = current->d_entry;
         if (!entry.batchNext(result, effectiveOptions)) {
             break;
         }
 
-        ++current;
+        current = current->d_next_p;
     }
 
     if (result->numBuffers() == 0) {
@@ -311,5 +337,18 @@ bool SendQueue::batchNext(ntsa::ConstBufferArray*  result,
     return true;
 }
 
+bsl::size_t SendQueue::numEntriesAvailable() const
+{
+    bsl::size_t result = 0;
+
+    for (const EntryNode* node = d_nodeFree_p; node != 0;
+         node                  = node->d_next_p)
+    {
+        ++result;
+    }
+
+    return result;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -22,6 +22,7 @@ BSLS_IDENT("$Id: $")
 #include <ntca_sendoptions.h>
 #include <ntca_writequeuecontext.h>
 #include <ntccfg_platform.h>
+#include <ntccfg_tracepoint.h>
 #include <ntci_log.h>
 #include <ntci_sendcallback.h>
 #include <ntci_sender.h>
@@ -35,12 +36,13 @@ BSLS_IDENT("$Id: $")
 #include <ntsa_sendoptions.h>
 #include <bdlb_nullablevalue.h>
 #include <bdlcc_sharedobjectpool.h>
+#include <bdlma_pool.h>
 #include <bsls_timeinterval.h>
 #include <bsls_timeutil.h>
 #include <bsl_functional.h>
-#include <bsl_list.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
+#include <bsl_unordered_map.h>
 #include <bsl_vector.h>
 
 namespace BloombergLP {
@@ -110,6 +112,7 @@ class SendQueueEntry
     bsl::size_t                             d_length;
     bsl::int64_t                            d_timestamp;
     bdlb::NullableValue<bsls::TimeInterval> d_deadline;
+    bdlb::NullableValue<bsl::uint64_t>      d_conflationKey;
     bsl::shared_ptr<ntci::Timer>            d_timer_sp;
     ntci::SendCallback                      d_callback;
     bool                                    d_inProgress;
@@ -204,6 +207,15 @@ class SendQueueEntry
     /// Destroy this object.
     ~SendQueueEntry();
 
+    /// Assign the value of the specified 'other' object to this object.
+    /// Return a reference to this modifiable object.
+    SendQueueEntry& operator=(const SendQueueEntry& other);
+
+    /// Reset the value of this object to its value upon default
+    /// construction. Note that the memory supplied to this object by its
+    /// allocator is retained.
+    void reset();
+
     /// Set the identifier used to internally time-out the queue entry to
     /// the specified 'id'.
     void setId(bsl::uint64_t id);
@@ -239,6 +251,16 @@ class SendQueueEntry
     /// specified 'value'.
     void setDeadline(const bdlb::NullableValue<bsls::TimeInterval>& value);
 
+    /// Set the key that identifies the topic of the data, such that a
+    /// subsequent entry with the same key may replace this entry while it
+    /// remains unsent, to the specified 'value'.
+    void setConflationKey(bsl::uint64_t value);
+
+    /// Set the key that identifies the topic of the data, such that a
+    /// subsequent entry with the same key may replace this entry while it
+    /// remains unsent, to the specified 'value'.
+    void setConflationKey(const bdlb::NullableValue<bsl::uint64_t>& value);
+
     /// Set the timer to the specified 'timer'.
     void setTimer(const bsl::shared_ptr<ntci::Timer>& timer);
 
@@ -290,6 +312,9 @@ class SendQueueEntry
     /// Return the deadline within which the data must be sent.
     const bdlb::NullableValue<bsls::TimeInterval>& deadline() const;
 
+    /// Return the key that identifies the topic of the data.
+    const bdlb::NullableValue<bsl::uint64_t>& conflationKey() const;
+
     /// Return the duration from the timestamp until now.
     bsls::TimeInterval delay() const;
 
@@ -317,30 +342,94 @@ class SendQueueEntry
 /// @internal @brief
 /// Provide a send queue.
 ///
+/// @details
+/// Entries are stored in an intrusive, doubly-linked list of nodes allocated
+/// from a pool owned by the queue. Nodes removed from the queue are reset
+/// and recycled through a free list rather than deallocated, so once the
+/// queue has grown to its steady-state depth, pushing and popping entries
+/// does not allocate memory. The nodes of entries having a deadline are also
+/// linked, in order of their deadlines, into a second intrusive list, so
+/// that expired entries are found without scanning entries that have no
+/// deadline or whose deadline has not elapsed. The nodes of entries having a
+/// conflation key that may still be replaced are indexed by that key.
+///
 /// @par Thread Safety
 /// This class is not thread safe.
 ///
 /// @ingroup module_ntcq
 class SendQueue
 {
-    /// This typedef defines a linked list of structures that describe
-    /// the write queue.
-    typedef bsl::list<SendQueueEntry> EntryList;
+    /// This struct describes a node in the intrusive list of entries.
+    struct EntryNode {
+        explicit EntryNode(bslma::Allocator* basicAllocator)
+        : d_entry(basicAllocator)
+        , d_prev_p(0)
+        , d_next_p(0)
+        , d_deadline()
+        , d_deadlinePrev_p(0)
+        , d_deadlineNext_p(0)
+        , d_deadlineLinked(false)
+        {
+        }
 
-    EntryList                        d_entryList;
-    bsl::shared_ptr<bdlbb::Blob>     d_data_sp;
-    bsl::size_t                      d_size;
-    bsl::size_t                      d_watermarkLow;
-    bool                             d_watermarkLowWanted;
-    bsl::size_t                      d_watermarkHigh;
-    bool                             d_watermarkHighWanted;
-    bsl::uint64_t                    d_nextEntryId;
-    bslma::Allocator*                d_allocator_p;
+        SendQueueEntry     d_entry;
+        EntryNode*         d_prev_p;
+        EntryNode*         d_next_p;
+        bsls::TimeInterval d_deadline;
+        EntryNode*         d_deadlinePrev_p;
+        EntryNode*         d_deadlineNext_p;
+        bool               d_deadlineLinked;
+    };
+
+    /// This typedef defines a map of conflation keys to the node of the
+    /// entry having that key which may be replaced.
+    typedef bsl::unordered_map<bsl::uint64_t, EntryNode*> ConflationMap;
+
+    bdlma::Pool                             d_nodePool;
+    EntryNode*                              d_nodeFree_p;
+    EntryNode*                              d_head_p;
+    EntryNode*                              d_tail_p;
+    bsl::size_t                             d_entryCount;
+    EntryNode*                              d_deadlineHead_p;
+    EntryNode*                              d_deadlineTail_p;
+    ConflationMap                           d_conflationMap;
+    bsl::shared_ptr<bdlbb::Blob>            d_data_sp;
+    bsl::size_t                             d_size;
+    bsl::size_t                             d_watermarkLow;
+    bool                                    d_watermarkLowWanted;
+    bsl::size_t                             d_watermarkHigh;
+    bool                                    d_watermarkHighWanted;
+    bsl::uint64_t                           d_nextEntryId;
+    bslma::Allocator*                       d_allocator_p;
 
   private:
     SendQueue(const SendQueue&) BSLS_KEYWORD_DELETED;
     SendQueue& operator=(const SendQueue&) BSLS_KEYWORD_DELETED;
 
+    /// Return a node from the free list, or a newly-allocated node if the
+    /// free list is empty.
+    EntryNode* privateNodeAcquire();
+
+    /// Reset the specified 'node' and return it to the free list.
+    void privateNodeRelease(EntryNode* node);
+
+    /// Unlink the specified 'node' from the list of entries, reset it, and
+    /// return it to the free list.
+    void privateNodeRemove(EntryNode* node);
+
+    /// Link the specified 'node' into the list of entries ordered by
+    /// deadline, if the entry of 'node' has a deadline, after any node
+    /// having the same or an earlier deadline.
+    void privateDeadlineLink(EntryNode* node);
+
+    /// Unlink the specified 'node' from the list of entries ordered by
+    /// deadline, if linked.
+    void privateDeadlineUnlink(EntryNode* node);
+
+    /// Remove the specified 'node' from the index of entries by conflation
+    /// key, if indexed.
+    void privateConflationUnlink(EntryNode* node);
+
   public:
     /// Create a new send to message queue. Optionally specify a
     /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
@@ -389,6 +478,26 @@ class SendQueue
         ntci::SendCallback*    result,
         const ntca::SendToken& token);
 
+    /// Replace the contents of the most recently pushed entry having the
+    /// same conflation key as the specified 'entry' with 'entry', retaining
+    /// the position of the replaced entry in the queue, and load the
+    /// replaced entry into the specified 'result', if such an entry exists
+    /// and has not already had any portion of its data copied to the socket
+    /// send buffer. Return true if an entry was replaced, otherwise return
+    /// false. The behavior is undefined unless the conflation key of
+    /// 'entry' is defined and 'entry' has not had any portion of its data
+    /// copied to the socket send buffer.
+    bool conflateEntry(SendQueueEntry* result, const SendQueueEntry& entry);
+
+    /// Remove each entry having a deadline at or before the specified 'now'
+    /// that has not already had any portion of its data copied to the
+    /// socket send buffer, and append its callback, if any, to the
+    /// specified 'result'. Return true if queue becomes empty as a result
+    /// of this operation, otherwise return false. Note that only the entries
+    /// whose deadline has elapsed are visited.
+    bool removeExpired(bsl::vector<ntci::SendCallback>* result,
+                       const bsls::TimeInterval&        now);
+
     /// Load into the specified 'result' any pending callback entries and
     /// clear the queue. Return true if the queue was non-empty, and false
     /// otherwise.
@@ -438,11 +547,32 @@ class SendQueue
     /// Return the number of bytes on the queue.
     bsl::size_t size() const;
 
+    /// Load into the specified 'result' the length of the entry that would
+    /// be replaced by 'conflateEntry' given an entry having the specified
+    /// conflation 'key'. Return true if such an entry exists, otherwise
+    /// return false.
+    bool conflationLength(bsl::size_t* result, bsl::uint64_t key) const;
+
+    /// Load into the specified 'result' the earliest deadline of the entries
+    /// on the queue. Return true if any entry on the queue has a deadline,
+    /// otherwise return false. Note that 'result' may be earlier than the
+    /// deadline of any entry remaining on the queue if the deadline of the
+    /// front entry has been reset through 'frontEntry', until the next call
+    /// to 'removeExpired'.
+    bool earliestDeadline(bsls::TimeInterval* result) const;
+
     /// Return true if there are entries on the queue, and false otherwise.
     /// Note that the queue may have entries but still have a zero size
     /// when the sole remaining entry is a shutdown entry.
     bool hasEntry() const;
 
+    /// Return the number of entries on the queue.
+    bsl::size_t numEntries() const;
+
+    /// Return the number of previously-allocated entries available for
+    /// re-use.
+    bsl::size_t numEntriesAvailable() const;
+
     /// Return true if the low watermark is satisfied, otherwise return
     /// false.
     bool isLowWatermarkSatisfied() const;
@@ -510,6 +640,7 @@ SendQueueEntry::SendQueueEntry(bslma::Allocator* basicAllocator)
 , d_length(0)
 , d_timestamp(0)
 , d_deadline()
+, d_conflationKey()
 , d_timer_sp()
 , d_callback(basicAllocator)
 , d_inProgress(false)
@@ -527,6 +658,7 @@ SendQueueEntry::SendQueueEntry(const SendQueueEntry& original,
 , d_length(original.d_length)
 , d_timestamp(original.d_timestamp)
 , d_deadline(original.d_deadline)
+, d_conflationKey(original.d_conflationKey)
 , d_timer_sp(original.d_timer_sp)
 , d_callback(original.d_callback, basicAllocator)
 , d_inProgress(original.d_inProgress)
@@ -539,6 +671,44 @@ SendQueueEntry::~SendQueueEntry()
 {
 }
 
+NTCCFG_INLINE
+SendQueueEntry& SendQueueEntry::operator=(const SendQueueEntry& other)
+{
+    if (this != &other) {
+        d_id            = other.d_id;
+        d_token         = other.d_token;
+        d_endpoint      = other.d_endpoint;
+        d_data_sp       = other.d_data_sp;
+        d_length        = other.d_length;
+        d_timestamp     = other.d_timestamp;
+        d_deadline      = other.d_deadline;
+        d_conflationKey = other.d_conflationKey;
+        d_timer_sp      = other.d_timer_sp;
+        d_callback      = other.d_callback;
+        d_inProgress    = other.d_inProgress;
+        d_zeroCopy      = other.d_zeroCopy;
+    }
+
+    return *this;
+}
+
+NTCCFG_INLINE
+void SendQueueEntry::reset()
+{
+    d_id = 0;
+    d_token.reset();
+    d_endpoint.reset();
+    d_data_sp.reset();
+    d_length    = 0;
+    d_timestamp = 0;
+    d_deadline.reset();
+    d_conflationKey.reset();
+    d_timer_sp.reset();
+    d_callback.reset();
+    d_inProgress = false;
+    d_zeroCopy   = false;
+}
+
 NTCCFG_INLINE
 void SendQueueEntry::setId(bsl::uint64_t id)
 {
@@ -602,6 +772,19 @@ void SendQueueEntry::setDeadline(
     d_deadline = value;
 }
 
+NTCCFG_INLINE
+void SendQueueEntry::setConflationKey(bsl::uint64_t value)
+{
+    d_conflationKey = value;
+}
+
+NTCCFG_INLINE
+void SendQueueEntry::setConflationKey(
+    const bdlb::NullableValue<bsl::uint64_t>& value)
+{
+    d_conflationKey = value;
+}
+
 NTCCFG_INLINE
 void SendQueueEntry::setTimer(const bsl::shared_ptr<ntci::Timer>& timer)
 {
@@ -684,6 +867,13 @@ const bdlb::NullableValue<bsls::TimeInterval>& SendQueueEntry::deadline() const
     return d_deadline;
 }
 
+NTCCFG_INLINE
+const bdlb::NullableValue<bsl::uint64_t>& SendQueueEntry::conflationKey()
+    const
+{
+    return d_conflationKey;
+}
+
 NTCCFG_INLINE
 bsls::TimeInterval SendQueueEntry::delay() const
 {
@@ -731,6 +921,146 @@ bool SendQueueEntry::isBatchable() const
     return true;
 }
 
+NTCCFG_INLINE
+SendQueue::EntryNode* SendQueue::privateNodeAcquire()
+{
+    EntryNode* node;
+
+    if (NTCCFG_LIKELY(d_nodeFree_p)) {
+        node           = d_nodeFree_p;
+        d_nodeFree_p   = node->d_next_p;
+        node->d_next_p = 0;
+    }
+    else {
+        node = new (d_nodePool.allocate()) EntryNode(d_allocator_p);
+    }
+
+    return node;
+}
+
+NTCCFG_INLINE
+void SendQueue::privateNodeRelease(EntryNode* node)
+{
+    BSLS_ASSERT(!node->d_deadlineLinked);
+
+    node->d_entry.reset();
+
+    node->d_prev_p = 0;
+    node->d_next_p = d_nodeFree_p;
+    d_nodeFree_p   = node;
+}
+
+NTCCFG_INLINE
+void SendQueue::privateNodeRemove(EntryNode* node)
+{
+    BSLS_ASSERT(d_entryCount > 0);
+
+    if (node->d_prev_p) {
+        node->d_prev_p->d_next_p = node->d_next_p;
+    }
+    else {
+        d_head_p = node->d_next_p;
+    }
+
+    if (node->d_next_p) {
+        node->d_next_p->d_prev_p = node->d_prev_p;
+    }
+    else {
+        d_tail_p = node->d_prev_p;
+    }
+
+    --d_entryCount;
+
+    this->privateDeadlineUnlink(node);
+    this->privateConflationUnlink(node);
+    this->privateNodeRelease(node);
+}
+
+NTCCFG_INLINE
+void SendQueue::privateDeadlineLink(EntryNode* node)
+{
+    BSLS_ASSERT(!node->d_deadlineLinked);
+
+    if (NTCCFG_LIKELY(node->d_entry.deadline().isNull())) {
+        return;
+    }
+
+    node->d_deadline = node->d_entry.deadline().value();
+
+    // Deadlines are typically computed by adding a constant timeout to the
+    // current time, so search for the insertion point from the latest
+    // deadline.
+
+    EntryNode* prev = d_deadlineTail_p;
+    while (prev != 0 && node->d_deadline < prev->d_deadline) {
+        prev = prev->d_deadlinePrev_p;
+    }
+
+    EntryNode* next = prev ? prev->d_deadlineNext_p : d_deadlineHead_p;
+
+    node->d_deadlinePrev_p = prev;
+    node->d_deadlineNext_p = next;
+
+    if (prev) {
+        prev->d_deadlineNext_p = node;
+    }
+    else {
+        d_deadlineHead_p = node;
+    }
+
+    if (next) {
+        next->d_deadlinePrev_p = node;
+    }
+    else {
+        d_deadlineTail_p = node;
+    }
+
+    node->d_deadlineLinked = true;
+}
+
+NTCCFG_INLINE
+void SendQueue::privateDeadlineUnlink(EntryNode* node)
+{
+    if (NTCCFG_LIKELY(!node->d_deadlineLinked)) {
+        return;
+    }
+
+    if (node->d_deadlinePrev_p) {
+        node->d_deadlinePrev_p->d_deadlineNext_p = node->d_deadlineNext_p;
+    }
+    else {
+        d_deadlineHead_p = node->d_deadlineNext_p;
+    }
+
+    if (node->d_deadlineNext_p) {
+        node->d_deadlineNext_p->d_deadlinePrev_p = node->d_deadlinePrev_p;
+    }
+    else {
+        d_deadlineTail_p = node->d_deadlinePrev_p;
+    }
+
+    node->d_deadline       = bsls::TimeInterval();
+    node->d_deadlinePrev_p = 0;
+    node->d_deadlineNext_p = 0;
+    node->d_deadlineLinked = false;
+}
+
+NTCCFG_INLINE
+void SendQueue::privateConflationUnlink(EntryNode* node)
+{
+    const bdlb::NullableValue<bsl::uint64_t>& key =
+        node->d_entry.conflationKey();
+
+    if (NTCCFG_LIKELY(key.isNull())) {
+        return;
+    }
+
+    ConflationMap::iterator it = d_conflationMap.find(key.value());
+    if (it != d_conflationMap.end() && it->second == node) {
+        d_conflationMap.erase(it);
+    }
+}
+
 NTCCFG_INLINE
 bsl::uint64_t SendQueue::generateEntryId()
 {
@@ -740,7 +1070,27 @@ bsl::uint64_t SendQueue::generateEntryId()
 NTCCFG_INLINE
 bool SendQueue::pushEntry(const SendQueueEntry& entry)
 {
-    d_entryList.push_back(entry);
+    EntryNode* node = this->privateNodeAcquire();
+
+    node->d_entry  = entry;
+    node->d_prev_p = d_tail_p;
+    node->d_next_p = 0;
+
+    if (d_tail_p) {
+        d_tail_p->d_next_p = node;
+    }
+    else {
+        d_head_p = node;
+    }
+
+    d_tail_p = node;
+    ++d_entryCount;
+
+    this->privateDeadlineLink(node);
+
+    if (NTCCFG_UNLIKELY(!entry.conflationKey().isNull())) {
+        d_conflationMap[entry.conflationKey().value()] = node;
+    }
 
     if (entry.data()) {
         BSLS_ASSERT(entry.length() > 0);
@@ -749,20 +1099,25 @@ bool SendQueue::pushEntry(const SendQueueEntry& entry)
         d_size += entry.length();
     }
 
-    return d_entryList.size() == 1;
+    NTCCFG_TRACEPOINT3(send_queue_push, this, entry.length(), d_size);
+
+    return d_entryCount == 1;
 }
 
 NTCCFG_INLINE
 SendQueueEntry& SendQueue::frontEntry()
 {
-    return d_entryList.front();
+    BSLS_ASSERT(d_head_p);
+    return d_head_p->d_entry;
 }
 
 NTCCFG_INLINE
 bool SendQueue::popEntry()
 {
+    BSLS_ASSERT(d_head_p);
+
     {
-        SendQueueEntry& entry = d_entryList.front();
+        SendQueueEntry& entry = d_head_p->d_entry;
 
         entry.closeTimer();
 
@@ -772,18 +1127,23 @@ bool SendQueue::popEntry()
             BSLS_ASSERT(d_size >= entry.length());
             d_size -= entry.length();
         }
+
+        NTCCFG_TRACEPOINT3(send_queue_pop,
+                           this,
+                           entry.length(),
+                           entry.timestamp());
     }
 
-    d_entryList.pop_front();
-    return d_entryList.empty();
+    this->privateNodeRemove(d_head_p);
+    return d_entryCount == 0;
 }
 
 NTCCFG_INLINE
 void SendQueue::popSize(bsl::size_t numBytes)
 {
-    BSLS_ASSERT(!d_entryList.empty());
+    BSLS_ASSERT(d_head_p);
 
-    SendQueueEntry& entry = d_entryList.front();
+    SendQueueEntry& entry = d_head_p->d_entry;
 
     entry.closeTimer();
 
@@ -793,6 +1153,12 @@ void SendQueue::popSize(bsl::size_t numBytes)
     ntsa::DataUtil::pop(entry.data().get(), numBytes);
     entry.setInProgress(true);
 
+    // An entry partially copied to the socket send buffer never expires and
+    // is never replaced.
+
+    this->privateDeadlineUnlink(d_head_p);
+    this->privateConflationUnlink(d_head_p);
+
     BSLS_ASSERT(entry.length() >= numBytes);
     entry.setLength(entry.length() - numBytes);
 
@@ -809,10 +1175,8 @@ bool SendQueue::removeEntryId(
 {
     result->reset();
 
-    for (EntryList::iterator it = d_entryList.begin(); it != d_entryList.end();
-         ++it)
-    {
-        ntcq::SendQueueEntry& entry = *it;
+    for (EntryNode* node = d_head_p; node != 0; node = node->d_next_p) {
+        ntcq::SendQueueEntry& entry = node->d_entry;
 
         if (entry.id() == id) {
             if (!entry.deadline().isNull()) {
@@ -830,14 +1194,14 @@ bool SendQueue::removeEntryId(
                         *result = entry.callback();
                     }
 
-                    d_entryList.erase(it);
+                    this->privateNodeRemove(node);
                 }
             }
             break;
         }
     }
 
-    return d_entryList.empty();
+    return d_entryCount == 0;
 }
 
 NTCCFG_INLINE
@@ -847,10 +1211,8 @@ bool SendQueue::removeEntryToken(
 {
     result->reset();
 
-    for (EntryList::iterator it = d_entryList.begin(); it != d_entryList.end();
-         ++it)
-    {
-        ntcq::SendQueueEntry& entry = *it;
+    for (EntryNode* node = d_head_p; node != 0; node = node->d_next_p) {
+        ntcq::SendQueueEntry& entry = node->d_entry;
 
         if (!entry.token().isNull()) {
             if (entry.token().value() == token) {
@@ -868,36 +1230,140 @@ bool SendQueue::removeEntryToken(
                         *result = entry.callback();
                     }
 
-                    d_entryList.erase(it);
+                    this->privateNodeRemove(node);
                 }
                 break;
             }
         }
     }
 
-    return d_entryList.empty();
+    return d_entryCount == 0;
+}
+
+NTCCFG_INLINE
+bool SendQueue::conflateEntry(SendQueueEntry*       result,
+                              const SendQueueEntry& entry)
+{
+    BSLS_ASSERT(!entry.conflationKey().isNull());
+    BSLS_ASSERT(!entry.inProgress());
+
+    ConflationMap::iterator it =
+        d_conflationMap.find(entry.conflationKey().value());
+    if (it == d_conflationMap.end()) {
+        return false;
+    }
+
+    EntryNode*            node    = it->second;
+    ntcq::SendQueueEntry& current = node->d_entry;
+
+    BSLS_ASSERT(!current.inProgress());
+
+    current.closeTimer();
+
+    if (current.data()) {
+        BSLS_ASSERT(current.length() > 0);
+        BSLS_ASSERT(current.length() == current.data()->size());
+        BSLS_ASSERT(d_size >= current.length());
+        d_size -= current.length();
+    }
+
+    *result = current;
+    current = entry;
+
+    if (entry.data()) {
+        BSLS_ASSERT(entry.length() > 0);
+        BSLS_ASSERT(entry.length() == entry.data()->size());
+
+        d_size += entry.length();
+    }
+
+    this->privateDeadlineUnlink(node);
+    this->privateDeadlineLink(node);
+
+    NTCCFG_TRACEPOINT3(send_queue_push, this, entry.length(), d_size);
+
+    return true;
+}
+
+NTCCFG_INLINE
+bool SendQueue::removeExpired(bsl::vector<ntci::SendCallback>* result,
+                              const bsls::TimeInterval&        now)
+{
+    if (d_deadlineHead_p == 0) {
+        return false;
+    }
+
+    if (now < d_deadlineHead_p->d_deadline) {
+        return false;
+    }
+
+    const bool nonEmpty = d_entryCount != 0;
+
+    while (d_deadlineHead_p != 0 && d_deadlineHead_p->d_deadline <= now) {
+        EntryNode* node = d_deadlineHead_p;
+
+        ntcq::SendQueueEntry& entry = node->d_entry;
+
+        // The deadline of the front entry may have been reset once its data
+        // began to be copied to the socket send buffer.
+
+        if (entry.deadline().isNull() || entry.inProgress()) {
+            this->privateDeadlineUnlink(node);
+            continue;
+        }
+
+        if (entry.data()) {
+            BSLS_ASSERT(entry.length() > 0);
+            BSLS_ASSERT(entry.length() == entry.data()->size());
+            BSLS_ASSERT(d_size >= entry.length());
+            d_size -= entry.length();
+        }
+
+        entry.closeTimer();
+
+        if (entry.callback()) {
+            result->push_back(entry.callback());
+        }
+
+        this->privateNodeRemove(node);
+    }
+
+    return nonEmpty && d_entryCount == 0;
 }
 
 NTCCFG_INLINE
 bool SendQueue::removeAll(
     bsl::vector<ntci::SendCallback>* result)
 {
-    bool nonEmpty = !d_entryList.empty();
+    bool nonEmpty = d_entryCount != 0;
 
-    for (EntryList::iterator it = d_entryList.begin(); it != d_entryList.end();
-         ++it)
-    {
-        ntcq::SendQueueEntry& entry = *it;
+    EntryNode* node = d_head_p;
+    while (node != 0) {
+        EntryNode* next = node->d_next_p;
+
+        ntcq::SendQueueEntry& entry = node->d_entry;
 
         entry.closeTimer();
 
         if (entry.callback()) {
             result->push_back(entry.callback());
         }
+
+        this->privateDeadlineUnlink(node);
+        this->privateNodeRelease(node);
+
+        node = next;
     }
 
-    d_entryList.clear();
-    d_size = 0;
+    d_head_p     = 0;
+    d_tail_p     = 0;
+    d_entryCount = 0;
+    d_size       = 0;
+
+    BSLS_ASSERT(d_deadlineHead_p == 0);
+    BSLS_ASSERT(d_deadlineTail_p == 0);
+
+    d_conflationMap.clear();
 
     return nonEmpty;
 }
@@ -1001,10 +1467,39 @@ bsl::size_t SendQueue::size() const
     return d_size;
 }
 
+NTCCFG_INLINE
+bool SendQueue::conflationLength(bsl::size_t* result, bsl::uint64_t key) const
+{
+    ConflationMap::const_iterator it = d_conflationMap.find(key);
+    if (it == d_conflationMap.end()) {
+        return false;
+    }
+
+    *result = it->second->d_entry.length();
+    return true;
+}
+
+NTCCFG_INLINE
+bool SendQueue::earliestDeadline(bsls::TimeInterval* result) const
+{
+    if (d_deadlineHead_p == 0) {
+        return false;
+    }
+
+    *result = d_deadlineHead_p->d_deadline;
+    return true;
+}
+
 NTCCFG_INLINE
 bool SendQueue::hasEntry() const
 {
-    return !d_entryList.empty();
+    return d_head_p != 0;
+}
+
+NTCCFG_INLINE
+bsl::size_t SendQueue::numEntries() const
+{
+    return d_entryCount;
 }
 
 NTCCFG_INLINE
@@ -29,6 +29,7 @@
 #include <bdlf_placeholder.h>
 #include <bslma_allocator.h>
 #include <bslma_default.h>
+#include <bslma_testallocator.h>
 #include <bsls_assert.h>
 
 using namespace BloombergLP;
@@ -634,6 +635,390 @@ NTCCFG_TEST_CASE(6)
     NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
 
+NTCCFG_TEST_CASE(7)
+{
+    // Concern: Pushing and popping entries performs no memory allocation once
+    // the queue has grown to its steady-state depth.
+
+    ntccfg::TestAllocator ta;
+    {
+        const bsl::size_t k_BLOB_BUFFER_SIZE = 32;
+        const bsl::size_t k_MESSAGE_SIZE     = 1024;
+        const bsl::size_t k_QUEUE_DEPTH      = 64;
+        const bsl::size_t k_NUM_ROUNDS       = 100;
+
+        bdlbb::SimpleBlobBufferFactory blobBufferFactory(k_BLOB_BUFFER_SIZE,
+                                                         &ta);
+
+        bsl::shared_ptr<ntsa::Data> data;
+        data.createInplace(&ta, &blobBufferFactory, &ta);
+        ntsd::DataUtil::generateData(data.get(), k_MESSAGE_SIZE);
+
+        bsls::AtomicUint numInvoked(0);
+
+        ntci::SendCallback callback(
+            NTCCFG_BIND(&test::EventUtil::processComplete,
+                        &numInvoked,
+                        NTCCFG_BIND_PLACEHOLDER_1,
+                        NTCCFG_BIND_PLACEHOLDER_2),
+            &ta);
+
+        bslma::TestAllocator queueAllocator;
+
+        ntcq::SendQueue sendQueue(&queueAllocator);
+
+        bsl::int64_t numAllocationsAfterWarmup = 0;
+
+        for (bsl::size_t round = 0; round < k_NUM_ROUNDS; ++round) {
+            for (bsl::size_t i = 0; i < k_QUEUE_DEPTH; ++i) {
+                ntcq::SendQueueEntry sendQueueEntry(&queueAllocator);
+                sendQueueEntry.setId(sendQueue.generateEntryId());
+                sendQueueEntry.setData(data);
+                sendQueueEntry.setLength(data->size());
+                sendQueueEntry.setCallback(callback);
+
+                sendQueue.pushEntry(sendQueueEntry);
+            }
+
+            NTCCFG_TEST_EQ(sendQueue.numEntries(), k_QUEUE_DEPTH);
+            NTCCFG_TEST_EQ(sendQueue.size(), k_QUEUE_DEPTH * k_MESSAGE_SIZE);
+
+            for (bsl::size_t i = 0; i < k_QUEUE_DEPTH; ++i) {
+                NTCCFG_TEST_TRUE(sendQueue.hasEntry());
+                NTCCFG_TEST_TRUE(sendQueue.frontEntry().callback());
+
+                bool becameEmpty = sendQueue.popEntry();
+                NTCCFG_TEST_EQ(becameEmpty, i == k_QUEUE_DEPTH - 1);
+            }
+
+            NTCCFG_TEST_FALSE(sendQueue.hasEntry());
+            NTCCFG_TEST_EQ(sendQueue.size(), 0);
+            NTCCFG_TEST_EQ(sendQueue.numEntriesAvailable(), k_QUEUE_DEPTH);
+
+            if (round == 0) {
+                numAllocationsAfterWarmup = queueAllocator.numAllocations();
+            }
+            else {
+                NTCCFG_TEST_EQ(queueAllocator.numAllocations(),
+                               numAllocationsAfterWarmup);
+            }
+        }
+
+        NTCCFG_TEST_EQ(data.use_count(), 1);
+        NTCCFG_TEST_EQ(numInvoked, 0);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(8)
+{
+    // Concern: Entries whose deadline has elapsed are removed, and the
+    // earliest remaining deadline is tracked.
+
+    ntccfg::TestAllocator ta;
+    {
+        const bsl::size_t k_BLOB_BUFFER_SIZE = 32;
+        const bsl::size_t k_MESSAGE_SIZE     = 100;
+
+        bdlbb::SimpleBlobBufferFactory blobBufferFactory(k_BLOB_BUFFER_SIZE,
+                                                         &ta);
+
+        bsl::shared_ptr<ntsa::Data> data;
+        data.createInplace(&ta, &blobBufferFactory, &ta);
+        ntsd::DataUtil::generateData(data.get(), k_MESSAGE_SIZE);
+
+        bsls::AtomicUint numInvoked(0);
+
+        ntci::SendCallback callback(
+            NTCCFG_BIND(&test::EventUtil::processComplete,
+                        &numInvoked,
+                        NTCCFG_BIND_PLACEHOLDER_1,
+                        NTCCFG_BIND_PLACEHOLDER_2),
+            &ta);
+
+        ntcq::SendQueue sendQueue(&ta);
+
+        bsls::TimeInterval deadline;
+        NTCCFG_TEST_FALSE(sendQueue.earliestDeadline(&deadline));
+
+        // Push entries with deadlines at 3, none, 1, and 2 seconds.
+
+        const int DEADLINE[] = {3, 0, 1, 2};
+
+        for (bsl::size_t i = 0; i < sizeof DEADLINE / sizeof DEADLINE[0];
+             ++i)
+        {
+            bsl::shared_ptr<ntsa::Data> entryData;
+            entryData.createInplace(&ta, *data, &ta);
+
+            ntcq::SendQueueEntry sendQueueEntry(&ta);
+            sendQueueEntry.setId(sendQueue.generateEntryId());
+            sendQueueEntry.setData(entryData);
+            sendQueueEntry.setLength(entryData->size());
+            sendQueueEntry.setCallback(callback);
+
+            if (DEADLINE[i] != 0) {
+                sendQueueEntry.setDeadline(bsls::TimeInterval(DEADLINE[i]));
+            }
+
+            sendQueue.pushEntry(sendQueueEntry);
+        }
+
+        NTCCFG_TEST_TRUE(sendQueue.earliestDeadline(&deadline));
+        NTCCFG_TEST_EQ(deadline, bsls::TimeInterval(1));
+
+        bsl::vector<ntci::SendCallback> callbackVector(&ta);
+
+        bool becameEmpty = false;
+
+        becameEmpty = sendQueue.removeExpired(
+            &callbackVector,
+            bsls::TimeInterval(0, 500 * 1000 * 1000));
+        NTCCFG_TEST_FALSE(becameEmpty);
+        NTCCFG_TEST_EQ(callbackVector.size(), 0);
+        NTCCFG_TEST_EQ(sendQueue.numEntries(), 4);
+
+        becameEmpty = sendQueue.removeExpired(&callbackVector,
+                                              bsls::TimeInterval(2));
+        NTCCFG_TEST_FALSE(becameEmpty);
+        NTCCFG_TEST_EQ(callbackVector.size(), 2);
+        NTCCFG_TEST_EQ(sendQueue.numEntries(), 2);
+        NTCCFG_TEST_EQ(sendQueue.size(), 2 * k_MESSAGE_SIZE);
+
+        NTCCFG_TEST_TRUE(sendQueue.earliestDeadline(&deadline));
+        NTCCFG_TEST_EQ(deadline, bsls::TimeInterval(3));
+
+        // An entry partially copied to the socket send buffer is never
+        // removed.
+
+        sendQueue.popSize(1);
+
+        becameEmpty = sendQueue.removeExpired(&callbackVector,
+                                              bsls::TimeInterval(10));
+        NTCCFG_TEST_FALSE(becameEmpty);
+        NTCCFG_TEST_EQ(callbackVector.size(), 2);
+        NTCCFG_TEST_EQ(sendQueue.numEntries(), 2);
+        NTCCFG_TEST_FALSE(sendQueue.earliestDeadline(&deadline));
+
+        sendQueue.popEntry();
+        sendQueue.popEntry();
+
+        NTCCFG_TEST_FALSE(sendQueue.hasEntry());
+        NTCCFG_TEST_EQ(numInvoked, 0);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(9)
+{
+    // Concern: An unsent entry is replaced in place by a subsequent entry
+    // having the same conflation key.
+
+    ntccfg::TestAllocator ta;
+    {
+        const bsl::size_t k_BLOB_BUFFER_SIZE = 32;
+
+        bdlbb::SimpleBlobBufferFactory blobBufferFactory(k_BLOB_BUFFER_SIZE,
+                                                         &ta);
+
+        ntcq::SendQueue sendQueue(&ta);
+
+        // Push entries of 100, 200, and 300 bytes keyed by topics 1, 2,
+        // and none, respectively.
+
+        const bsl::size_t SIZE[] = {100, 200, 300};
+        const int         KEY[]  = {1, 2, 0};
+
+        for (bsl::size_t i = 0; i < sizeof SIZE / sizeof SIZE[0]; ++i) {
+            bsl::shared_ptr<ntsa::Data> entryData;
+            entryData.createInplace(&ta, &blobBufferFactory, &ta);
+            ntsd::DataUtil::generateData(entryData.get(), SIZE[i]);
+
+            ntcq::SendQueueEntry sendQueueEntry(&ta);
+            sendQueueEntry.setId(sendQueue.generateEntryId());
+            sendQueueEntry.setData(entryData);
+            sendQueueEntry.setLength(entryData->size());
+
+            if (KEY[i] != 0) {
+                sendQueueEntry.setConflationKey(KEY[i]);
+            }
+
+            sendQueue.pushEntry(sendQueueEntry);
+        }
+
+        NTCCFG_TEST_EQ(sendQueue.numEntries(), 3);
+        NTCCFG_TEST_EQ(sendQueue.size(), 600);
+
+        bsl::size_t conflationLength = 0;
+
+        NTCCFG_TEST_TRUE(sendQueue.conflationLength(&conflationLength, 1));
+        NTCCFG_TEST_EQ(conflationLength, 100);
+
+        NTCCFG_TEST_FALSE(sendQueue.conflationLength(&conflationLength, 3));
+
+        bsl::shared_ptr<ntsa::Data> data;
+        data.createInplace(&ta, &blobBufferFactory, &ta);
+        ntsd::DataUtil::generateData(data.get(), 50);
+
+        ntcq::SendQueueEntry replacement(&ta);
+        replacement.setId(sendQueue.generateEntryId());
+        replacement.setData(data);
+        replacement.setLength(data->size());
+
+        ntcq::SendQueueEntry replaced(&ta);
+
+        // An entry with an unknown key is not conflated.
+
+        replacement.setConflationKey(3);
+        NTCCFG_TEST_FALSE(sendQueue.conflateEntry(&replaced, replacement));
+        NTCCFG_TEST_EQ(sendQueue.numEntries(), 3);
+        NTCCFG_TEST_EQ(sendQueue.size(), 600);
+
+        // An entry with a known key replaces the queued entry without
+        // changing its position.
+
+        replacement.setConflationKey(2);
+        NTCCFG_TEST_TRUE(sendQueue.conflateEntry(&replaced, replacement));
+        NTCCFG_TEST_EQ(replaced.length(), 200);
+        NTCCFG_TEST_EQ(sendQueue.numEntries(), 3);
+        NTCCFG_TEST_EQ(sendQueue.size(), 450);
+
+        NTCCFG_TEST_TRUE(sendQueue.conflationLength(&conflationLength, 2));
+        NTCCFG_TEST_EQ(conflationLength, 50);
+
+        NTCCFG_TEST_EQ(sendQueue.frontEntry().length(), 100);
+        sendQueue.popEntry();
+
+        NTCCFG_TEST_FALSE(sendQueue.conflationLength(&conflationLength, 1));
+        NTCCFG_TEST_EQ(sendQueue.frontEntry().length(), 50);
+        NTCCFG_TEST_EQ(sendQueue.frontEntry().id(), replacement.id());
+
+        // An entry partially copied to the socket send buffer is never
+        // replaced.
+
+        sendQueue.popSize(1);
+        NTCCFG_TEST_FALSE(sendQueue.conflationLength(&conflationLength, 2));
+        NTCCFG_TEST_FALSE(sendQueue.conflateEntry(&replaced, replacement));
+        NTCCFG_TEST_EQ(sendQueue.numEntries(), 2);
+        NTCCFG_TEST_EQ(sendQueue.size(), 349);
+
+        sendQueue.popEntry();
+        sendQueue.popEntry();
+
+        NTCCFG_TEST_FALSE(sendQueue.hasEntry());
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(10)
+{
+    // Concern: Entries expire in order of their deadlines, regardless of
+    // their position in the queue, and the deadlines of entries replaced by
+    // conflation or reset at the front of the queue are honored.
+
+    ntccfg::TestAllocator ta;
+    {
+        const bsl::size_t k_BLOB_BUFFER_SIZE = 32;
+        const bsl::size_t k_MESSAGE_SIZE     = 10;
+
+        bdlbb::SimpleBlobBufferFactory blobBufferFactory(k_BLOB_BUFFER_SIZE,
+                                                         &ta);
+
+        ntcq::SendQueue sendQueue(&ta);
+
+        // Push entries with deadlines at 5, 1, none, 3, 2, and 3 seconds,
+        // keying the entry whose deadline is at 1 second by topic 7.
+
+        const int DEADLINE[] = {5, 1, 0, 3, 2, 3};
+
+        for (bsl::size_t i = 0; i < sizeof DEADLINE / sizeof DEADLINE[0];
+             ++i)
+        {
+            bsl::shared_ptr<ntsa::Data> entryData;
+            entryData.createInplace(&ta, &blobBufferFactory, &ta);
+            ntsd::DataUtil::generateData(entryData.get(), k_MESSAGE_SIZE);
+
+            ntcq::SendQueueEntry sendQueueEntry(&ta);
+            sendQueueEntry.setId(sendQueue.generateEntryId());
+            sendQueueEntry.setData(entryData);
+            sendQueueEntry.setLength(entryData->size());
+
+            if (DEADLINE[i] != 0) {
+                sendQueueEntry.setDeadline(bsls::TimeInterval(DEADLINE[i]));
+            }
+
+            if (DEADLINE[i] == 1) {
+                sendQueueEntry.setConflationKey(7);
+            }
+
+            sendQueue.pushEntry(sendQueueEntry);
+        }
+
+        bsls::TimeInterval deadline;
+        NTCCFG_TEST_TRUE(sendQueue.earliestDeadline(&deadline));
+        NTCCFG_TEST_EQ(deadline, bsls::TimeInterval(1));
+
+        // Replace the entry keyed by topic 7 with an entry having no
+        // deadline.
+
+        {
+            bsl::shared_ptr<ntsa::Data> entryData;
+            entryData.createInplace(&ta, &blobBufferFactory, &ta);
+            ntsd::DataUtil::generateData(entryData.get(), k_MESSAGE_SIZE);
+
+            ntcq::SendQueueEntry replacement(&ta);
+            replacement.setId(sendQueue.generateEntryId());
+            replacement.setData(entryData);
+            replacement.setLength(entryData->size());
+            replacement.setConflationKey(7);
+
+            ntcq::SendQueueEntry replaced(&ta);
+            NTCCFG_TEST_TRUE(
+                sendQueue.conflateEntry(&replaced, replacement));
+        }
+
+        NTCCFG_TEST_TRUE(sendQueue.earliestDeadline(&deadline));
+        NTCCFG_TEST_EQ(deadline, bsls::TimeInterval(2));
+
+        bsl::vector<ntci::SendCallback> callbackVector(&ta);
+
+        bool becameEmpty = false;
+
+        becameEmpty =
+            sendQueue.removeExpired(&callbackVector, bsls::TimeInterval(2));
+        NTCCFG_TEST_FALSE(becameEmpty);
+        NTCCFG_TEST_EQ(sendQueue.numEntries(), 5);
+
+        becameEmpty =
+            sendQueue.removeExpired(&callbackVector, bsls::TimeInterval(3));
+        NTCCFG_TEST_FALSE(becameEmpty);
+        NTCCFG_TEST_EQ(sendQueue.numEntries(), 3);
+        NTCCFG_TEST_EQ(sendQueue.size(), 3 * k_MESSAGE_SIZE);
+
+        NTCCFG_TEST_TRUE(sendQueue.earliestDeadline(&deadline));
+        NTCCFG_TEST_EQ(deadline, bsls::TimeInterval(5));
+
+        // An entry whose deadline is reset once its data begins to be
+        // copied to the socket send buffer never expires.
+
+        sendQueue.frontEntry().setDeadline(
+            bdlb::NullableValue<bsls::TimeInterval>());
+
+        becameEmpty =
+            sendQueue.removeExpired(&callbackVector, bsls::TimeInterval(10));
+        NTCCFG_TEST_FALSE(becameEmpty);
+        NTCCFG_TEST_EQ(sendQueue.numEntries(), 3);
+        NTCCFG_TEST_FALSE(sendQueue.earliestDeadline(&deadline));
+
+        sendQueue.popEntry();
+        sendQueue.popEntry();
+        sendQueue.popEntry();
+
+        NTCCFG_TEST_FALSE(sendQueue.hasEntry());
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
@@ -642,5 +1027,9 @@ NTCCFG_TEST_DRIVER
     NTCCFG_TEST_REGISTER(4);
     NTCCFG_TEST_REGISTER(5);
     NTCCFG_TEST_REGISTER(6);
+    NTCCFG_TEST_REGISTER(7);
+    NTCCFG_TEST_REGISTER(8);
+    NTCCFG_TEST_REGISTER(9);
+    NTCCFG_TEST_REGISTER(10);
 }
 NTCCFG_TEST_DRIVER_END;
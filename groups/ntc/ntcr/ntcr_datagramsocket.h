@@ -168,6 +168,25 @@ class DatagramSocket : public ntci::DatagramSocket,
         const ntca::TimerEvent&                                 event,
         const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& entry);
 
+    /// Dequeue from the read queue according to the options of the specified
+    /// 'callbackEntry', or queue the 'callbackEntry' if the read queue does
+    /// not yet have sufficient data. Return the error.
+    ntsa::Error privateReceive(
+        const bsl::shared_ptr<DatagramSocket>&                  self,
+        const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& callbackEntry);
+
+    /// Dequeue the datagram at the front of the read queue and invoke the
+    /// callback of the specified 'callbackEntry' on the specified 'strand'
+    /// according to the specified 'defer' flag. If the 'callbackEntry' is a
+    /// batch, also dequeue each subsequent datagram, up to the maximum
+    /// number of messages and size of the batch, and invoke the callback
+    /// once with all of them.
+    void privateSatisfyReceive(
+        const bsl::shared_ptr<DatagramSocket>&                  self,
+        const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& callbackEntry,
+        const bsl::shared_ptr<ntci::Strand>&                    strand,
+        bool                                                    defer);
+
     /// Process the readability of the socket by performing one read
     /// iteration. The behavior is undefined unless 'd_mutex' is locked.
     ntsa::Error privateSocketReadableIteration(
@@ -830,6 +849,34 @@ class DatagramSocket : public ntci::DatagramSocket,
                         const ntci::ReceiveCallback& callback)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Dequeue up to the maximum number of datagrams defined by the
+    /// specified 'options' from the read queue and invoke the specified
+    /// 'callback' once with all of them, as soon as at least one datagram is
+    /// available. The total size of the datagrams in the batch is limited by
+    /// the maximum size defined by 'options', except that the first datagram
+    /// is always delivered. The event of each result describes the endpoint
+    /// from which that datagram was received. Return the error. Note that
+    /// callbacks created by this object will automatically be invoked on
+    /// this object's strand unless an explicit strand is specified at the
+    /// time the callback is created.
+    ntsa::Error receiveBatch(const ntca::ReceiveOptions&       options,
+                             const ntci::ReceiveBatchFunction& callback)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Dequeue up to the maximum number of datagrams defined by the
+    /// specified 'options' from the read queue and invoke the specified
+    /// 'callback' once with all of them, as soon as at least one datagram is
+    /// available. The total size of the datagrams in the batch is limited by
+    /// the maximum size defined by 'options', except that the first datagram
+    /// is always delivered. The event of each result describes the endpoint
+    /// from which that datagram was received. Return the error. Note that
+    /// callbacks created by this object will automatically be invoked on
+    /// this object's strand unless an explicit strand is specified at the
+    /// time the callback is created.
+    ntsa::Error receiveBatch(const ntca::ReceiveOptions&       options,
+                             const ntci::ReceiveBatchCallback& callback)
+        BSLS_KEYWORD_OVERRIDE;
+
     /// Register the specified 'resolver' for this socket. Return the error.
     ntsa::Error registerResolver(
         const bsl::shared_ptr<ntci::Resolver>& resolver) BSLS_KEYWORD_OVERRIDE;
@@ -27,6 +27,8 @@ BSLS_IDENT_RCSID(ntcr_interface_cpp, "$Id$ $CSID$")
 #include <ntcr_listenersocket.h>
 #include <ntcr_streamsocket.h>
 #include <ntcs_compat.h>
+#include <ntcs_datapool.h>
+#include <ntcs_numautil.h>
 #include <ntcs_plugin.h>
 #include <ntcs_ratelimiter.h>
 #include <ntcs_strand.h>
@@ -102,6 +104,15 @@ void* Interface::run(void* context)
         metricName = ss.str();
     }
 
+    if (runner->d_numaNode_p != 0) {
+        ntsa::Error error = ntcs::NumaUtil::bind(*runner->d_numaNode_p);
+        if (error) {
+            NTCI_LOG_WARN("Failed to bind thread to NUMA node %d: %s",
+                          (int)(runner->d_numaNode_p->d_nodeIndex),
+                          error.text().c_str());
+        }
+    }
+
     ntca::WaiterOptions waiterOptions;
     waiterOptions.setMetricName(metricName);
     waiterOptions.setThreadHandle(bslmt::ThreadUtil::self());
@@ -143,9 +154,85 @@ bsl::shared_ptr<ntci::Resolver> Interface::createResolver()
 
     d_user_sp->setResolver(resolver);
 
+    for (UserVector::iterator it = d_numaUserVector.begin();
+         it != d_numaUserVector.end();
+         ++it)
+    {
+        (*it)->setResolver(resolver);
+    }
+
     return resolver;
 }
 
+void Interface::initializeNuma()
+{
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_CONTEXT_GUARD_OWNER(d_config.metricName().c_str());
+
+    BSLS_ASSERT_OPT(!d_config.dynamicLoadBalancing().isNull());
+    if (d_config.dynamicLoadBalancing().value()) {
+        NTCI_LOG_DEBUG("NUMA awareness is ignored when dynamic load "
+                       "balancing is enabled");
+        return;
+    }
+
+    NumaNodeVector numaNodeVector(d_allocator_p);
+    ntcs::NumaUtil::discover(&numaNodeVector);
+
+    if (numaNodeVector.size() < 2) {
+        NTCI_LOG_DEBUG("NUMA awareness is ignored on a machine having a "
+                       "single NUMA node");
+        return;
+    }
+
+    // The memory backing each blob buffer is allocated, and first touched,
+    // by a thread bound to the node whose data pool supplies it, so the
+    // operating system places that memory local to the node.
+
+    bsl::size_t incomingBlobBufferSize = 0;
+    {
+        bdlbb::BlobBuffer blobBuffer;
+        d_dataPool_sp->createIncomingBlobBuffer(&blobBuffer);
+        incomingBlobBufferSize = static_cast<bsl::size_t>(blobBuffer.size());
+    }
+
+    bsl::size_t outgoingBlobBufferSize = 0;
+    {
+        bdlbb::BlobBuffer blobBuffer;
+        d_dataPool_sp->createOutgoingBlobBuffer(&blobBuffer);
+        outgoingBlobBufferSize = static_cast<bsl::size_t>(blobBuffer.size());
+    }
+
+    for (bsl::size_t i = 0; i < numaNodeVector.size(); ++i) {
+        bsl::shared_ptr<ntcs::DataPool> dataPool;
+        dataPool.createInplace(d_allocator_p,
+                               incomingBlobBufferSize,
+                               outgoingBlobBufferSize,
+                               d_allocator_p);
+
+        bsl::shared_ptr<ntcs::User> user;
+        user.createInplace(d_allocator_p, d_allocator_p);
+
+        user->setDataPool(dataPool);
+
+        if (d_reactorMetrics_sp) {
+            user->setReactorMetrics(d_reactorMetrics_sp);
+        }
+
+        if (d_connectionLimiter_sp) {
+            user->setConnectionLimiter(d_connectionLimiter_sp);
+        }
+
+        d_numaUserVector.push_back(user);
+    }
+
+    d_numaNodeVector.swap(numaNodeVector);
+
+    NTCI_LOG_DEBUG("Interface is NUMA aware across %d nodes",
+                   (int)(d_numaNodeVector.size()));
+}
+
 bsl::shared_ptr<ntci::Reactor> Interface::addReactor()
 {
     bsl::size_t minThreads = 1;
@@ -216,9 +303,16 @@ bsl::shared_ptr<ntci::Reactor> Interface::addReactor()
         reactorConfig.setOneShot(false);
     }
 
+    bsl::shared_ptr<ntcs::User> user = d_user_sp;
+    if (!d_numaUserVector.empty()) {
+        const bsl::size_t numaNodeIndex =
+            d_reactorVector.size() % d_numaUserVector.size();
+        user = d_numaUserVector[numaNodeIndex];
+    }
+
     bsl::shared_ptr<ntci::Reactor> reactor =
         d_reactorFactory_sp->createReactor(reactorConfig,
-                                           d_user_sp,
+                                           user,
                                            d_allocator_p);
 
     d_reactorVector.push_back(reactor);
@@ -303,6 +397,11 @@ ntsa::Error Interface::addThread()
     runner.d_threadName  = threadName;
     runner.d_threadIndex = threadIndex;
 
+    if (!d_numaNodeVector.empty()) {
+        runner.d_numaNode_p =
+            &d_numaNodeVector[threadIndex % d_numaNodeVector.size()];
+    }
+
     bslmt::ThreadUtil::ThreadFunction threadFunction =
         (bslmt::ThreadUtil::ThreadFunction)(&ntcr::Interface::run);
     void* threadUserData = &runner;
@@ -480,6 +579,8 @@ Interface::Interface(
 , d_threadMap(basicAllocator)
 , d_threadSemaphore()
 , d_threadWatermark(0)
+, d_numaNodeVector(basicAllocator)
+, d_numaUserVector(basicAllocator)
 , d_config(configuration, basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
@@ -525,6 +626,10 @@ Interface::Interface(
         d_connectionLimiter_sp = connectionLimiter;
         d_user_sp->setConnectionLimiter(d_connectionLimiter_sp);
     }
+
+    if (d_config.numaAware().valueOr(false)) {
+        this->initializeNuma();
+    }
 }
 
 Interface::~Interface()
@@ -534,6 +639,7 @@ Interface::~Interface()
 
     d_resolver_sp.reset();
     d_user_sp.reset();
+    d_numaUserVector.clear();
 
     d_threadMap.clear();
     d_threadVector.clear();
@@ -21,6 +21,7 @@ BSLS_IDENT_RCSID(ntcr_listenersocket_cpp, "$Id$ $CSID$")
 #include <ntcr_streamsocket.h>
 
 #include <ntccfg_limits.h>
+#include <ntccfg_tracepoint.h>
 #include <ntci_log.h>
 #include <ntci_monitorable.h>
 #include <ntcm_monitorableutil.h>
@@ -1168,6 +1169,11 @@ ntsa::Error ListenerSocket::privateDequeueBacklog(
         }
     }
 
+    NTCCFG_TRACEPOINT3(socket_accept,
+                       this,
+                       d_publicHandle,
+                       streamSocketBase->handle());
+
     ntca::StreamSocketOptions streamSocketOptions;
     ntcs::Compat::convert(&streamSocketOptions, d_options);
 
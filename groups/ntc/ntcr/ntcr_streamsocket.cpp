@@ -19,6 +19,7 @@
 BSLS_IDENT_RCSID(ntcr_streamsocket_cpp, "$Id$ $CSID$")
 
 #include <ntccfg_limits.h>
+#include <ntccfg_tracepoint.h>
 #include <ntci_encryption.h>
 #include <ntci_encryptioncertificate.h>
 #include <ntci_log.h>
@@ -29,11 +30,13 @@ BSLS_IDENT_RCSID(ntcr_streamsocket_cpp, "$Id$ $CSID$")
 #include <ntcs_blobutil.h>
 #include <ntcs_compat.h>
 #include <ntcs_dispatch.h>
+#include <ntcs_receiveframer.h>
 #include <ntcu_streamsocketsession.h>
 #include <ntcu_streamsocketutil.h>
 #include <ntsa_data.h>
 #include <ntsa_distinguishedname.h>
 #include <ntsa_error.h>
+#include <ntsa_tlssessionkey.h>
 #include <ntsf_system.h>
 #include <ntsi_streamsocket.h>
 #include <ntsu_socketoptionutil.h>
@@ -89,6 +92,13 @@ BSLS_IDENT_RCSID(ntcr_streamsocket_cpp, "$Id$ $CSID$")
 #define NTCR_STREAMSOCKET_LOG_ENCRYPTION_UPGRADE_FAILED(details)              \
     NTCI_LOG_DEBUG("Encryption upgrade failed: %s", details.c_str())
 
+#define NTCR_STREAMSOCKET_LOG_ENCRYPTION_OFFLOAD_COMPLETE()                   \
+    NTCI_LOG_DEBUG("Encryption offloaded to the operating system")
+
+#define NTCR_STREAMSOCKET_LOG_ENCRYPTION_OFFLOAD_UNAVAILABLE(error)           \
+    NTCI_LOG_DEBUG("Encryption offload unavailable: %s",                      \
+                   (error).text().c_str())
+
 #define NTCR_STREAMSOCKET_LOG_RECEIVE_BUFFER_THROTTLE_APPLIED(timeToSubmit)   \
     NTCI_LOG_TRACE("Stream socket receive buffer throttle applied for %d "    \
                    "milliseconds",                                            \
@@ -209,6 +219,13 @@ BSLS_IDENT_RCSID(ntcr_streamsocket_cpp, "$Id$ $CSID$")
                                        100.0),                                \
                    highWatermark)
 
+#define NTCR_STREAMSOCKET_LOG_WRITE_QUEUE_CONFLATED(size, key)                \
+    NTCI_LOG_TRACE("Stream socket "                                           \
+                   "has replaced %zu bytes on the write queue having "        \
+                   "conflation key %llu",                                     \
+                   size,                                                      \
+                   static_cast<unsigned long long>(key))
+
 #define NTCR_STREAMSOCKET_LOG_WRITE_QUEUE_DRAINED(size, highWatermark)        \
     NTCI_LOG_TRACE("Stream socket "                                           \
                    "has drained the write queue down to %zu bytes (%.1f%% "   \
@@ -340,7 +357,15 @@ void StreamSocket::processSocketReadable(const ntca::ReactorEvent& event)
     while (true) {
         ++numIterations;
 
+        NTCCFG_TRACEPOINT2(socket_readable_enter, this, d_publicHandle);
+
         error = this->privateSocketReadableIteration(self);
+
+        NTCCFG_TRACEPOINT3(socket_readable_exit,
+                           this,
+                           d_publicHandle,
+                           error.number());
+
         if (error) {
             break;
         }
@@ -403,7 +428,15 @@ void StreamSocket::processSocketWritable(const ntca::ReactorEvent& event)
     while (d_sendQueue.hasEntry()) {
         ++numIterations;
 
+        NTCCFG_TRACEPOINT2(socket_writable_enter, this, d_publicHandle);
+
         error = this->privateSocketWritableIteration(self);
+
+        NTCCFG_TRACEPOINT3(socket_writable_exit,
+                           this,
+                           d_publicHandle,
+                           error.number());
+
         if (error) {
             break;
         }
@@ -417,6 +450,12 @@ void StreamSocket::processSocketWritable(const ntca::ReactorEvent& event)
         }
     }
 
+    if (NTCCFG_UNLIKELY(d_encryptionOffloadPending) &&
+        (!error || error == ntsa::Error::e_WOULD_BLOCK))
+    {
+        error = this->privateOffloadEncryption(self);
+    }
+
     if (numIterations > 0) {
         NTCS_METRICS_UPDATE_SEND_ITERATIONS(numIterations);
     }
@@ -650,10 +689,9 @@ void StreamSocket::processSendRateTimer(
     }
 }
 
-void StreamSocket::processSendDeadlineTimer(
+void StreamSocket::processSendCoalescingTimer(
     const bsl::shared_ptr<ntci::Timer>& timer,
-    const ntca::TimerEvent&             event,
-    bsl::uint64_t                       entryId)
+    const ntca::TimerEvent&             event)
 {
     NTCCFG_WARNING_UNUSED(timer);
 
@@ -670,34 +708,155 @@ void StreamSocket::processSendDeadlineTimer(
     NTCI_LOG_CONTEXT_GUARD_REMOTE_ENDPOINT(d_remoteEndpoint);
 
     if (event.type() == ntca::TimerEventType::e_DEADLINE) {
-        ntci::SendCallback callback;
-        bool becameEmpty = d_sendQueue.removeEntryId(&callback, entryId);
-        if (becameEmpty) {
-            this->privateApplyFlowControl(self,
-                                          ntca::FlowControlType::e_SEND,
-                                          ntca::FlowControlMode::e_IMMEDIATE,
-                                          false,
-                                          false);
+        if (d_sendCoalescingPending) {
+            this->privateFlushSend(self);
         }
+    }
+}
 
-        if (callback) {
-            ntca::SendContext sendContext;
-            sendContext.setError(ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+void StreamSocket::processSendCoalescingDeferred()
+{
+    NTCCFG_OBJECT_GUARD(&d_object);
 
-            ntca::SendEvent sendEvent;
-            sendEvent.setType(ntca::SendEventType::e_ERROR);
-            sendEvent.setContext(sendContext);
+    bsl::shared_ptr<StreamSocket> self = this->getSelf(this);
 
-            callback.dispatch(self,
-                                               sendEvent,
-                                               d_reactorStrand_sp,
-                                               self,
-                                               false,
-                                               &d_mutex);
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_CONTEXT_GUARD_DESCRIPTOR(d_publicHandle);
+    NTCI_LOG_CONTEXT_GUARD_SOURCE_ENDPOINT(d_sourceEndpoint);
+    NTCI_LOG_CONTEXT_GUARD_REMOTE_ENDPOINT(d_remoteEndpoint);
+
+    if (d_sendCoalescingPending) {
+        this->privateFlushSend(self);
+    }
+}
+
+void StreamSocket::processTcpInfoTimer(
+    const bsl::shared_ptr<ntci::Timer>& timer,
+    const ntca::TimerEvent&             event)
+{
+    NTCCFG_WARNING_UNUSED(timer);
+
+    NTCCFG_OBJECT_GUARD(&d_object);
+
+    bsl::shared_ptr<StreamSocket> self = this->getSelf(this);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_CONTEXT_GUARD_DESCRIPTOR(d_publicHandle);
+    NTCI_LOG_CONTEXT_GUARD_SOURCE_ENDPOINT(d_sourceEndpoint);
+    NTCI_LOG_CONTEXT_GUARD_REMOTE_ENDPOINT(d_remoteEndpoint);
+
+    if (event.type() != ntca::TimerEventType::e_DEADLINE) {
+        return;
+    }
+
+    if (!d_socket_sp || !d_tcpInfoTimer_sp) {
+        return;
+    }
+
+    ntsa::TcpInfo tcpInfo;
+    ntsa::Error   error = d_socket_sp->getTcpInfo(&tcpInfo);
+    if (error) {
+        // The state of the TCP connection cannot be sampled on this
+        // platform or for this socket, so stop trying.
+
+        d_tcpInfoTimer_sp->close();
+        d_tcpInfoTimer_sp.reset();
+        return;
+    }
+
+    // The number of retransmitted segments reported by the operating system
+    // is the total over the lifetime of the connection, so record only the
+    // retransmissions that have occurred since the previous sample.
+
+    const bsl::uint32_t numRetransmissions =
+        tcpInfo.retransmittedSegments() - d_tcpRetransmittedSegments;
+
+    d_tcpRetransmittedSegments = tcpInfo.retransmittedSegments();
+
+    NTCS_METRICS_UPDATE_TCP_INFO(tcpInfo, numRetransmissions);
+
+    if (d_adaptiveWriteQueue) {
+        // Allow at least two bandwidth-delay products of data to accumulate
+        // in the write queue before announcing the high watermark, so the
+        // user may keep the connection saturated while the write queue
+        // drains, but never less than the high watermark configured by the
+        // user.
+
+        bsl::size_t highWatermark = d_sendQueueHighWatermark;
+
+        const bsl::uint64_t bandwidthDelayProduct =
+            tcpInfo.bandwidthDelayProduct();
+
+        if (bandwidthDelayProduct > 0) {
+            const bsl::uint64_t target = 2 * bandwidthDelayProduct;
+            if (target > highWatermark) {
+                highWatermark = static_cast<bsl::size_t>(target);
+            }
+        }
+
+        if (highWatermark != d_sendQueue.highWatermark()) {
+            d_sendQueue.setHighWatermark(highWatermark);
+
+            // Lowering the high watermark may leave the write queue at or
+            // above it, so announce the high watermark as would be done if
+            // the user set the same high watermark explicitly.
+
+            if (d_sendQueue.authorizeHighWatermarkEvent()) {
+                NTCR_STREAMSOCKET_LOG_WRITE_QUEUE_HIGH_WATERMARK(
+                    d_sendQueue.highWatermark(),
+                    d_sendQueue.size());
+
+                if (d_session_sp) {
+                    ntca::WriteQueueEvent event;
+                    event.setType(
+                        ntca::WriteQueueEventType::e_HIGH_WATERMARK);
+                    event.setContext(d_sendQueue.context());
+
+                    ntcs::Dispatch::announceWriteQueueHighWatermark(
+                        d_session_sp,
+                        self,
+                        event,
+                        d_sessionStrand_sp,
+                        ntci::Strand::unknown(),
+                        self,
+                        false,
+                        &d_mutex);
+                }
+            }
         }
     }
 }
 
+void StreamSocket::processSendDeadlineTimer(
+    const bsl::shared_ptr<ntci::Timer>& timer,
+    const ntca::TimerEvent&             event)
+{
+    NTCCFG_WARNING_UNUSED(timer);
+
+    NTCCFG_OBJECT_GUARD(&d_object);
+
+    bsl::shared_ptr<StreamSocket> self = this->getSelf(this);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_CONTEXT_GUARD_DESCRIPTOR(d_publicHandle);
+    NTCI_LOG_CONTEXT_GUARD_SOURCE_ENDPOINT(d_sourceEndpoint);
+    NTCI_LOG_CONTEXT_GUARD_REMOTE_ENDPOINT(d_remoteEndpoint);
+
+    if (event.type() == ntca::TimerEventType::e_DEADLINE) {
+        d_sendDeadlineTimerArmed = false;
+        this->privateExpireSendQueue(self);
+    }
+}
+
 void StreamSocket::processReceiveRateTimer(
     const bsl::shared_ptr<ntci::Timer>& timer,
     const ntca::TimerEvent&             event)
@@ -803,6 +962,12 @@ void StreamSocket::privateEncryptionHandshake(
 
         d_upgradeInProgress = false;
 
+        if (!d_options.encryptionOffload().isNull() &&
+            d_options.encryptionOffload().value())
+        {
+            d_encryptionOffloadPending = true;
+        }
+
         ntci::UpgradeCallback upgradeCallback = d_upgradeCallback;
         d_upgradeCallback.reset();
 
@@ -833,134 +998,468 @@ void StreamSocket::privateEncryptionHandshake(
     }
 }
 
-ntsa::Error StreamSocket::privateSocketReadableIteration(
-    const bsl::shared_ptr<StreamSocket>& self)
+ntsa::Error StreamSocket::privateReceive(
+    const bsl::shared_ptr<StreamSocket>&                    self,
+    const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& callbackEntry)
 {
     NTCI_LOG_CONTEXT();
 
+    NTCI_LOG_CONTEXT_GUARD_DESCRIPTOR(d_publicHandle);
+    NTCI_LOG_CONTEXT_GUARD_SOURCE_ENDPOINT(d_sourceEndpoint);
+    NTCI_LOG_CONTEXT_GUARD_REMOTE_ENDPOINT(d_remoteEndpoint);
+
     ntsa::Error error;
 
-    if (d_receiveQueue.isHighWatermarkViolated()) {
-        return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
-    }
+    const ntca::ReceiveOptions& options = callbackEntry->options();
 
-    ntsa::ReceiveContext context;
-    error = this->privateDequeueReceiveBuffer(self,
-                                              &context,
-                                              d_receiveQueue.data().get());
-    if (NTCCFG_UNLIKELY(error)) {
-        return error;
+    if (NTCCFG_UNLIKELY(!d_openState.canReceive())) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
     }
 
+    if (NTCCFG_UNLIKELY(d_receiveQueue.size() == 0 &&
+                        !d_shutdownState.canReceive()))
     {
-        ntcq::ReceiveQueueEntry entry;
-        entry.setLength(context.bytesReceived());
-        entry.setTimestamp(bsls::TimeUtil::getTimer());
-
-        d_receiveQueue.pushEntry(entry);
+        return ntsa::Error(ntsa::Error::e_EOF);
     }
 
-    NTCR_STREAMSOCKET_LOG_READ_QUEUE_FILLED(d_receiveQueue.size());
-
-    NTCS_METRICS_UPDATE_READ_QUEUE_SIZE(d_receiveQueue.size());
+    bsl::size_t frameSize   = 0;
+    bsl::size_t framePrefix = 0;
+    bsl::size_t frameSuffix = 0;
 
-    while (true) {
-        bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry> callbackEntry;
-        error = d_receiveQueue.popCallbackEntry(&callbackEntry);
-        if (error) {
-            break;
+    if (NTCCFG_LIKELY(!d_receiveQueue.hasCallbackEntry())) {
+        error = d_receiveQueue.frame(&frameSize,
+                                     &framePrefix,
+                                     &frameSuffix,
+                                     options);
+        if (NTCCFG_UNLIKELY(error && error != ntsa::Error::e_WOULD_BLOCK)) {
+            return error;
         }
+    }
+    else {
+        error = ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
+    }
 
+    if (NTCCFG_LIKELY(!error)) {
         BSLS_ASSERT(d_receiveQueue.hasEntry());
         BSLS_ASSERT(d_receiveQueue.size() ==
                     NTCCFG_WARNING_PROMOTE(bsl::size_t,
                                            d_receiveQueue.data()->length()));
-        BSLS_ASSERT(d_receiveQueue.size() >=
-                    callbackEntry->options().minSize());
 
-        bsl::size_t numBytesRemaining = callbackEntry->options().maxSize();
-        bsl::size_t numBytesDequeued  = 0;
+        bool receiveQueueHighWatermarkViolatedBefore =
+            d_receiveQueue.isHighWatermarkViolated();
 
-        while (true) {
-            ntcq::ReceiveQueueEntry& entry = d_receiveQueue.frontEntry();
+        const bool defer = !options.recurse();
 
-            bsl::size_t numBytesToDequeue =
-                bsl::min(numBytesRemaining, entry.length());
+        this->privateSatisfyReceive(self,
+                                    callbackEntry,
+                                    frameSize,
+                                    framePrefix,
+                                    frameSuffix,
+                                    ntci::Strand::unknown(),
+                                    defer);
 
-            numBytesDequeued += numBytesToDequeue;
-            BSLS_ASSERT(numBytesDequeued <=
-                        callbackEntry->options().maxSize());
+        bool receiveQueueHighWatermarkViolatedAfter =
+            d_receiveQueue.isHighWatermarkViolated();
 
-            BSLS_ASSERT(numBytesRemaining >= numBytesToDequeue);
-            numBytesRemaining -= numBytesToDequeue;
+        if (receiveQueueHighWatermarkViolatedBefore &&
+            !receiveQueueHighWatermarkViolatedAfter)
+        {
+            this->privateRelaxFlowControl(self,
+                                          ntca::FlowControlType::e_RECEIVE,
+                                          true,
+                                          false);
+        }
 
-            if (numBytesToDequeue == entry.length()) {
-                NTCS_METRICS_UPDATE_READ_QUEUE_DELAY(entry.delay());
+        error = ntsa::Error::e_OK;
+    }
+    else {
+        if (!options.deadline().isNull()) {
+            ntca::TimerOptions timerOptions;
+            timerOptions.setOneShot(true);
+            timerOptions.showEvent(ntca::TimerEventType::e_DEADLINE);
+            timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
+            timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
 
-                if (d_receiveQueue.popEntry()) {
-                    break;
-                }
-            }
-            else {
-                d_receiveQueue.popSize(numBytesToDequeue);
-                break;
-            }
+            ntci::TimerCallback timerCallback = this->createTimerCallback(
+                bdlf::BindUtil::bind(
+                    &StreamSocket::processReceiveDeadlineTimer,
+                    self,
+                    bdlf::PlaceHolders::_1,
+                    bdlf::PlaceHolders::_2,
+                    callbackEntry),
+                d_allocator_p);
 
-            if (numBytesRemaining == 0) {
-                break;
-            }
+            bsl::shared_ptr<ntci::Timer> timer =
+                this->createTimer(timerOptions, timerCallback, d_allocator_p);
+
+            callbackEntry->setTimer(timer);
+
+            timer->schedule(options.deadline().value());
         }
 
-        BSLS_ASSERT(numBytesDequeued >= callbackEntry->options().minSize());
-        BSLS_ASSERT(numBytesDequeued <= callbackEntry->options().maxSize());
+        d_receiveQueue.pushCallbackEntry(callbackEntry);
+        error = ntsa::Error::e_WOULD_BLOCK;
+    }
 
-        bsl::shared_ptr<bdlbb::Blob> data =
-            d_dataPool_sp->createIncomingBlob();
+    BSLS_ASSERT(error == ntsa::Error::e_OK ||
+                error == ntsa::Error::e_WOULD_BLOCK);
 
-        ntcs::BlobUtil::append(data, d_receiveQueue.data(), numBytesDequeued);
+    if (error == ntsa::Error::e_WOULD_BLOCK) {
+        this->privateRelaxFlowControl(self,
+                                      ntca::FlowControlType::e_RECEIVE,
+                                      true,
+                                      false);
+        error = ntsa::Error::e_OK;
+    }
 
-        ntcs::BlobUtil::pop(d_receiveQueue.data(), numBytesDequeued);
+    return error;
+}
 
-        BSLS_ASSERT(d_receiveQueue.size() ==
-                    NTCCFG_WARNING_PROMOTE(bsl::size_t,
-                                           d_receiveQueue.data()->length()));
+void StreamSocket::privateSatisfyReceive(
+    const bsl::shared_ptr<StreamSocket>&                    self,
+    const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& callbackEntry,
+    bsl::size_t                                             frameSize,
+    bsl::size_t                                             framePrefix,
+    bsl::size_t                                             frameSuffix,
+    const bsl::shared_ptr<ntci::Strand>&                    strand,
+    bool                                                    defer)
+{
+    ntca::ReceiveContext receiveContext;
+    receiveContext.setTransport(d_transport);
+    receiveContext.setEndpoint(d_remoteEndpoint);
 
-        NTCR_STREAMSOCKET_LOG_READ_QUEUE_DRAINED(d_receiveQueue.size());
+    ntca::ReceiveEvent receiveEvent;
+    receiveEvent.setType(ntca::ReceiveEventType::e_COMPLETE);
+    receiveEvent.setContext(receiveContext);
 
-        NTCS_METRICS_UPDATE_READ_QUEUE_SIZE(d_receiveQueue.size());
+    if (callbackEntry->hasBuffers()) {
+        const bsl::size_t size = frameSize - framePrefix - frameSuffix;
 
-        ntca::ReceiveContext receiveContext;
-        receiveContext.setTransport(d_transport);
-        receiveContext.setEndpoint(d_remoteEndpoint);
+        ntcs::BlobUtil::copy(callbackEntry->buffers(),
+                             *d_receiveQueue.data(),
+                             framePrefix,
+                             size);
 
-        ntca::ReceiveEvent receiveEvent;
-        receiveEvent.setType(ntca::ReceiveEventType::e_COMPLETE);
+        this->privateDequeueReceiveData(0,
+                                        frameSize,
+                                        framePrefix,
+                                        frameSuffix);
+
+        receiveContext.setBytesReceived(size);
         receiveEvent.setContext(receiveContext);
 
+        ntcq::ReceiveCallbackQueueEntry::dispatch(
+            callbackEntry,
+            self,
+            bsl::shared_ptr<bdlbb::Blob>(),
+            receiveEvent,
+            strand,
+            self,
+            defer,
+            &d_mutex);
+        return;
+    }
+
+    if (NTCCFG_LIKELY(!callbackEntry->isBatch())) {
+        bsl::shared_ptr<bdlbb::Blob> data =
+            d_dataPool_sp->createIncomingBlob();
+
+        this->privateDequeueReceiveData(data.get(),
+                                       frameSize,
+                                       framePrefix,
+                                        frameSuffix);
+
         ntcq::ReceiveCallbackQueueEntry::dispatch(callbackEntry,
                                                   self,
                                                   data,
                                                   receiveEvent,
-                                                  d_reactorStrand_sp,
+                                                  strand,
                                                   self,
-                                                  false,
+                                                  defer,
                                                   &d_mutex);
+        return;
     }
 
-    if (d_receiveQueue.authorizeLowWatermarkEvent()) {
-        NTCR_STREAMSOCKET_LOG_READ_QUEUE_LOW_WATERMARK(
-            d_receiveQueue.lowWatermark(),
-            d_receiveQueue.size());
+    const ntca::ReceiveOptions& options = callbackEntry->options();
 
-        if (d_session_sp) {
-            ntca::ReadQueueEvent event;
-            event.setType(ntca::ReadQueueEventType::e_LOW_WATERMARK);
-            event.setContext(d_receiveQueue.context());
+    bsl::vector<ntci::ReceiveResult> results(d_allocator_p);
 
-            ntcs::Dispatch::announceReadQueueLowWatermark(d_session_sp,
-                                                          self,
-                                                          event,
-                                                          d_sessionStrand_sp,
+    bsl::size_t numBytesBatched = 0;
+
+    while (true) {
+        bsl::shared_ptr<bdlbb::Blob> data =
+            d_dataPool_sp->createIncomingBlob();
+
+        this->privateDequeueReceiveData(data.get(),
+                                       frameSize,
+                                       framePrefix,
+                                        frameSuffix);
+
+        numBytesBatched += frameSize - framePrefix - frameSuffix;
+
+        results.resize(results.size() + 1);
+        results.back().setData(data);
+        results.back().setEvent(receiveEvent);
+
+        if (results.size() >= options.maxMessages()) {
+            break;
+        }
+
+        ntsa::Error error = d_receiveQueue.frame(&frameSize,
+                                                 &framePrefix,
+                                                 &frameSuffix,
+                                                 options);
+        if (error) {
+            break;
+        }
+
+        if (numBytesBatched + (frameSize - framePrefix - frameSuffix) >
+            options.maxSize())
+        {
+            break;
+        }
+    }
+
+    ntcq::ReceiveCallbackQueueEntry::dispatch(callbackEntry,
+                                              self,
+                                              results,
+                                              receiveEvent,
+                                              strand,
+                                              self,
+                                              defer,
+                                              &d_mutex);
+}
+
+void StreamSocket::privateDequeueReceiveData(bdlbb::Blob* data,
+                                             bsl::size_t  frameSize,
+                                             bsl::size_t  framePrefix,
+                                             bsl::size_t  frameSuffix)
+{
+    NTCI_LOG_CONTEXT();
+
+    BSLS_ASSERT(d_receiveQueue.hasEntry());
+    BSLS_ASSERT(d_receiveQueue.size() >= frameSize);
+    BSLS_ASSERT(framePrefix + frameSuffix <= frameSize);
+
+    bsl::size_t numBytesRemaining = frameSize;
+    bsl::size_t numBytesDequeued  = 0;
+
+    while (NTCCFG_LIKELY(d_receiveQueue.hasEntry())) {
+        ntcq::ReceiveQueueEntry& entry = d_receiveQueue.frontEntry();
+
+        bsl::size_t numBytesToDequeue =
+            bsl::min(numBytesRemaining, entry.length());
+
+        numBytesDequeued += numBytesToDequeue;
+        BSLS_ASSERT(numBytesDequeued <= frameSize);
+
+        BSLS_ASSERT(numBytesRemaining >= numBytesToDequeue);
+        numBytesRemaining -= numBytesToDequeue;
+
+        if (numBytesToDequeue == entry.length()) {
+            NTCS_METRICS_UPDATE_READ_QUEUE_DELAY(entry.delay());
+
+            if (d_receiveQueue.popEntry()) {
+                break;
+            }
+        }
+        else {
+            d_receiveQueue.popSize(numBytesToDequeue);
+            break;
+        }
+
+        if (numBytesRemaining == 0) {
+            break;
+        }
+    }
+
+    BSLS_ASSERT(numBytesDequeued == frameSize);
+
+    if (data) {
+        ntcs::BlobUtil::append(data,
+                               d_receiveQueue.data(),
+                               framePrefix,
+                               numBytesDequeued - framePrefix - frameSuffix);
+    }
+
+    ntcs::BlobUtil::pop(d_receiveQueue.data(), numBytesDequeued);
+
+    BSLS_ASSERT(d_receiveQueue.size() ==
+                NTCCFG_WARNING_PROMOTE(bsl::size_t,
+                                       d_receiveQueue.data()->length()));
+
+    NTCR_STREAMSOCKET_LOG_READ_QUEUE_DRAINED(d_receiveQueue.size());
+
+    NTCS_METRICS_UPDATE_READ_QUEUE_SIZE(d_receiveQueue.size());
+}
+
+bool StreamSocket::privateCanReceiveDirect() const
+{
+    if (d_receiveQueue.hasEntry() || !d_receiveQueue.hasCallbackEntry()) {
+        return false;
+    }
+
+    if (d_encryption_sp || d_receiveQueue.framer()) {
+        return false;
+    }
+
+    const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& callbackEntry =
+        d_receiveQueue.frontCallbackEntry();
+
+    if (!callbackEntry->hasBuffers()) {
+        return false;
+    }
+
+    const ntca::ReceiveOptions& options = callbackEntry->options();
+
+    return options.framer().isNull() &&
+           options.maxSize() == callbackEntry->buffers().numBytes();
+}
+
+ntsa::Error StreamSocket::privateSocketReadableIteration(
+    const bsl::shared_ptr<StreamSocket>& self)
+{
+    NTCI_LOG_CONTEXT();
+
+    ntsa::Error error;
+
+    if (d_receiveQueue.isHighWatermarkViolated()) {
+        return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
+    }
+
+    ntsa::ReceiveContext context;
+
+    if (NTCCFG_UNLIKELY(this->privateCanReceiveDirect())) {
+        bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry> callbackEntry =
+            d_receiveQueue.frontCallbackEntry();
+
+        error = this->privateDequeueReceiveBufferRaw(self,
+                                                     &context,
+                                                     callbackEntry->buffers());
+        if (NTCCFG_UNLIKELY(error)) {
+            return error;
+        }
+
+        if (context.bytesReceived() >= callbackEntry->options().minSize()) {
+            d_receiveQueue.removeCallbackEntry(callbackEntry);
+
+            ntca::ReceiveContext receiveContext;
+            receiveContext.setTransport(d_transport);
+            receiveContext.setEndpoint(d_remoteEndpoint);
+            receiveContext.setBytesReceived(context.bytesReceived());
+
+            ntca::ReceiveEvent receiveEvent;
+            receiveEvent.setType(ntca::ReceiveEventType::e_COMPLETE);
+            receiveEvent.setContext(receiveContext);
+
+            ntcq::ReceiveCallbackQueueEntry::dispatch(
+                callbackEntry,
+                self,
+                bsl::shared_ptr<bdlbb::Blob>(),
+                receiveEvent,
+                d_reactorStrand_sp,
+                self,
+                false,
+                &d_mutex);
+
+            return ntsa::Error();
+        }
+
+        // The data received is insufficient to satisfy the operation, so
+        // move it to the read queue to be copied into the buffers once the
+        // rest of the data required has been received.
+
+        ntcs::BlobUtil::append(d_receiveQueue.data().get(),
+                               callbackEntry->buffers(),
+                               context.bytesReceived());
+    }
+    else {
+        error = this->privateDequeueReceiveBuffer(self,
+                                                  &context,
+                                                  d_receiveQueue.data().get());
+        if (NTCCFG_UNLIKELY(error)) {
+            return error;
+        }
+    }
+
+    {
+        ntcq::ReceiveQueueEntry entry;
+        entry.setLength(context.bytesReceived());
+        entry.setTimestamp(bsls::TimeUtil::getTimer());
+
+        d_receiveQueue.pushEntry(entry);
+    }
+
+    NTCR_STREAMSOCKET_LOG_READ_QUEUE_FILLED(d_receiveQueue.size());
+
+    NTCS_METRICS_UPDATE_READ_QUEUE_SIZE(d_receiveQueue.size());
+
+    while (true) {
+        bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry> callbackEntry;
+        bsl::size_t                                      frameSize   = 0;
+        bsl::size_t                                      framePrefix = 0;
+        bsl::size_t                                      frameSuffix = 0;
+
+        error = d_receiveQueue.popCallbackEntry(&callbackEntry,
+                                                &frameSize,
+                                                &framePrefix,
+                                                &frameSuffix);
+        if (!callbackEntry) {
+            break;
+        }
+
+        if (NTCCFG_UNLIKELY(error)) {
+            ntca::ReceiveContext receiveContext;
+            receiveContext.setError(error);
+            receiveContext.setTransport(d_transport);
+            receiveContext.setEndpoint(d_remoteEndpoint);
+
+            ntca::ReceiveEvent receiveEvent;
+            receiveEvent.setType(ntca::ReceiveEventType::e_ERROR);
+            receiveEvent.setContext(receiveContext);
+
+            ntcq::ReceiveCallbackQueueEntry::dispatch(
+                callbackEntry,
+                self,
+                bsl::shared_ptr<bdlbb::Blob>(),
+                receiveEvent,
+                d_reactorStrand_sp,
+                self,
+                false,
+                &d_mutex);
+
+            continue;
+        }
+
+        BSLS_ASSERT(d_receiveQueue.hasEntry());
+        BSLS_ASSERT(d_receiveQueue.size() ==
+                    NTCCFG_WARNING_PROMOTE(bsl::size_t,
+                                           d_receiveQueue.data()->length()));
+        BSLS_ASSERT(d_receiveQueue.size() >= frameSize);
+
+        this->privateSatisfyReceive(self,
+                                    callbackEntry,
+                                    frameSize,
+                                    framePrefix,
+                                    frameSuffix,
+                                    d_reactorStrand_sp,
+                                    false);
+    }
+
+    if (d_receiveQueue.authorizeLowWatermarkEvent()) {
+        NTCR_STREAMSOCKET_LOG_READ_QUEUE_LOW_WATERMARK(
+            d_receiveQueue.lowWatermark(),
+            d_receiveQueue.size());
+
+        if (d_session_sp) {
+            ntca::ReadQueueEvent event;
+            event.setType(ntca::ReadQueueEventType::e_LOW_WATERMARK);
+            event.setContext(d_receiveQueue.context());
+
+            ntcs::Dispatch::announceReadQueueLowWatermark(d_session_sp,
+                                                          self,
+                                                          event,
+                                                          d_sessionStrand_sp,
                                                           d_reactorStrand_sp,
                                                           self,
                                                           false,
@@ -995,185 +1494,547 @@ ntsa::Error StreamSocket::privateSocketReadableIteration(
         }
     }
 
-    return ntsa::Error();
+    return ntsa::Error();
+}
+
+ntsa::Error StreamSocket::privateSocketWritableConnection(
+    const bsl::shared_ptr<StreamSocket>& self)
+{
+    NTCI_LOG_CONTEXT();
+
+    ntsa::Error error;
+
+    if (!d_connectInProgress) {
+        return ntsa::Error::invalid();
+    }
+
+    ntsa::Error lastError;
+    d_socket_sp->getLastError(&lastError);
+    if (!lastError) {
+        lastError = ntsa::Error::invalid();
+    }
+
+    error = d_socket_sp->remoteEndpoint(&d_remoteEndpoint);
+    if (NTCCFG_UNLIKELY(error)) {
+        if (lastError == ntsa::Error::invalid()) {
+            lastError = error;
+        }
+
+        this->privateFailConnect(self, lastError, false, false);
+        return lastError;
+    }
+
+    error = d_socket_sp->sourceEndpoint(&d_sourceEndpoint);
+    if (NTCCFG_UNLIKELY(error)) {
+        NTCS_METRICS_UPDATE_CONNECT_FAILURE();
+
+        if (lastError == ntsa::Error::invalid()) {
+            lastError = error;
+        }
+
+        this->privateFailConnect(self, lastError, false, false);
+        return lastError;
+    }
+
+    {
+        bsl::size_t sendBufferSize;
+
+        ntsa::SocketOption option;
+        error =
+            d_socket_sp->getOption(&option,
+                                   ntsa::SocketOptionType::e_SEND_BUFFER_SIZE);
+        if (!error) {
+            sendBufferSize = option.sendBufferSize();
+        }
+        else {
+            sendBufferSize = 0;
+        }
+
+        this->privateUpdateMaxBytesPerSend(sendBufferSize);
+    }
+
+    {
+        bsl::size_t receiveBufferSize;
+
+        ntsa::SocketOption option;
+        error = d_socket_sp->getOption(
+            &option,
+            ntsa::SocketOptionType::e_RECEIVE_BUFFER_SIZE);
+        if (!error) {
+            receiveBufferSize = option.receiveBufferSize();
+        }
+        else {
+            receiveBufferSize = 0;
+        }
+
+        if (receiveBufferSize > 0) {
+            d_receiveOptions.setMaxBytes(receiveBufferSize);
+        }
+    }
+
+    d_sendOptions.setMaxBuffers(d_socket_sp->maxBuffersPerSend());
+    d_receiveOptions.setMaxBuffers(d_socket_sp->maxBuffersPerReceive());
+
+    NTCS_METRICS_UPDATE_CONNECT_COMPLETE();
+
+    NTCI_LOG_CONTEXT_GUARD_SOURCE_ENDPOINT(d_sourceEndpoint);
+    NTCI_LOG_CONTEXT_GUARD_REMOTE_ENDPOINT(d_remoteEndpoint);
+
+    bsls::TimeInterval now = this->currentTime();
+
+    bsls::TimeInterval connectLatency;
+    if (now > d_connectStartTime) {
+        connectLatency = now - d_connectStartTime;
+    }
+
+    d_connectContext.setError(ntsa::Error());
+    d_connectContext.setAttemptsRemaining(0);
+    d_connectContext.setLatency(connectLatency);
+
+    if (d_connectContext.name().isNull()) {
+        if (!d_connectName.empty()) {
+            d_connectContext.setName(d_connectName);
+        }
+    }
+
+    if (d_connectContext.endpoint().isUndefined()) {
+        if (!d_connectEndpoint.isUndefined()) {
+            d_connectContext.setEndpoint(d_connectEndpoint);
+        }
+    }
+
+    d_connectOptions.setRetryCount(0);
+    d_connectInProgress = false;
+
+    d_openState.set(ntcs::OpenState::e_CONNECTED);
+
+    if (d_options.timestampOutgoingData().value_or(false)) {
+        ntsa::Error error = this->privateTimestampOutgoingData(self, true);
+        if (error) {
+            NTCR_STREAMSOCKET_LOG_TIMESTAMP_PROCESSING_ERROR();
+        }
+    }
+
+    this->privateStartTcpInfoSampling(self);
+
+    ntci::ConnectCallback connectCallback = d_connectCallback;
+    d_connectCallback.reset();
+
+    ntca::ConnectContext connectContext = d_connectContext;
+    d_connectContext.reset();
+
+    ntca::ConnectEvent connectEvent;
+    connectEvent.setType(ntca::ConnectEventType::e_COMPLETE);
+    connectEvent.setContext(connectContext);
+
+    if (d_connectDeadlineTimer_sp) {
+        d_connectDeadlineTimer_sp->close();
+        d_connectDeadlineTimer_sp.reset();
+    }
+
+    if (d_connectRetryTimer_sp) {
+        d_connectRetryTimer_sp->close();
+        d_connectRetryTimer_sp.reset();
+    }
+
+    {
+        ntcs::ObserverRef<ntci::Reactor> reactorRef(&d_reactor);
+        if (reactorRef) {
+            reactorRef->hideWritable(self);
+        }
+    }
+
+    NTCI_LOG_DEBUG("Connection attempt succeeded");
+
+    if (connectCallback) {
+        connectCallback.dispatch(self,
+                                 connectEvent,
+                                 d_reactorStrand_sp,
+                                 self,
+                                 false,
+                                 &d_mutex);
+    }
+
+    if (d_openState.value() != ntcs::OpenState::e_CONNECTED) {
+        return ntsa::Error(ntsa::Error::e_CONNECTION_DEAD);
+    }
+
+    ntcs::Dispatch::announceEstablished(d_manager_sp,
+                                        self,
+                                        d_managerStrand_sp,
+                                        d_reactorStrand_sp,
+                                        self,
+                                        false,
+                                        &d_mutex);
+
+    return ntsa::Error();
+}
+
+void StreamSocket::privateScheduleFlushSend(
+    const bsl::shared_ptr<StreamSocket>& self)
+{
+    if (d_sendCoalescingPending) {
+        return;
+    }
+
+    d_sendCoalescingPending = true;
+
+    if (d_sendCoalescingWindow <= bsls::TimeInterval()) {
+        this->execute(NTCCFG_BIND(&StreamSocket::processSendCoalescingDeferred,
+                                  self));
+        return;
+    }
+
+    if (NTCCFG_UNLIKELY(!d_sendCoalescingTimer_sp)) {
+        ntca::TimerOptions timerOptions;
+        timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
+        timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
+
+        ntci::TimerCallback timerCallback = this->createTimerCallback(
+            bdlf::MemFnUtil::memFn(&StreamSocket::processSendCoalescingTimer,
+                                   self),
+            d_allocator_p);
+
+        d_sendCoalescingTimer_sp =
+            this->createTimer(timerOptions, timerCallback, d_allocator_p);
+    }
+
+    d_sendCoalescingTimer_sp->schedule(this->currentTime() +
+                                       d_sendCoalescingWindow);
+}
+
+void StreamSocket::privateScheduleSendDeadline(
+    const bsl::shared_ptr<StreamSocket>& self)
+{
+    bsls::TimeInterval deadline;
+    if (!d_sendQueue.earliestDeadline(&deadline)) {
+        return;
+    }
+
+    if (d_sendDeadlineTimerArmed && d_sendDeadlineTimerDue <= deadline) {
+        return;
+    }
+
+    // A single timer serves every entry on the write queue, so sends that
+    // each carry a deadline do not each create and schedule a timer.
+
+    if (NTCCFG_UNLIKELY(!d_sendDeadlineTimer_sp)) {
+        ntca::TimerOptions timerOptions;
+        timerOptions.showEvent(ntca::TimerEventType::e_DEADLINE);
+        timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
+        timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
+
+        ntci::TimerCallback timerCallback = this->createTimerCallback(
+            bdlf::MemFnUtil::memFn(&StreamSocket::processSendDeadlineTimer,
+                                   self),
+            d_allocator_p);
+
+        d_sendDeadlineTimer_sp =
+            this->createTimer(timerOptions, timerCallback, d_allocator_p);
+    }
+
+    d_sendDeadlineTimerDue   = deadline;
+    d_sendDeadlineTimerArmed = true;
+
+    d_sendDeadlineTimer_sp->schedule(deadline);
+}
+
+void StreamSocket::privateExpireSendQueue(
+    const bsl::shared_ptr<StreamSocket>& self)
+{
+    bsl::vector<ntci::SendCallback> callbackVector;
+
+    bool becameEmpty =
+        d_sendQueue.removeExpired(&callbackVector, this->currentTime());
+
+    if (becameEmpty) {
+        this->privateApplyFlowControl(self,
+                                      ntca::FlowControlType::e_SEND,
+                                      ntca::FlowControlMode::e_IMMEDIATE,
+                                      false,
+                                      false);
+    }
+
+    if (!callbackVector.empty()) {
+        NTCS_METRICS_UPDATE_WRITE_QUEUE_SIZE(d_sendQueue.size());
+    }
+
+    this->privateScheduleSendDeadline(self);
+
+    for (bsl::size_t i = 0; i < callbackVector.size(); ++i) {
+        ntca::SendContext sendContext;
+        sendContext.setError(ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+
+        ntca::SendEvent sendEvent;
+        sendEvent.setType(ntca::SendEventType::e_ERROR);
+        sendEvent.setContext(sendContext);
+
+        callbackVector[i].dispatch(self,
+                                   sendEvent,
+                                   d_reactorStrand_sp,
+                                   self,
+                                   false,
+                                   &d_mutex);
+    }
+}
+
+bool StreamSocket::privateCanConflateSend(
+    bsl::size_t              size,
+    const ntca::SendOptions& options,
+    bsl::size_t              effectiveHighWatermark) const
+{
+    if (NTCCFG_LIKELY(options.conflationKey().isNull())) {
+        return false;
+    }
+
+    if (d_encryption_sp && !d_encryptionOffloaded) {
+        return false;
+    }
+
+    bsl::size_t replacedSize = 0;
+    if (!d_sendQueue.conflationLength(&replacedSize,
+                                      options.conflationKey().value()))
+    {
+        return false;
+    }
+
+    // The replacement must not grow the write queue past the high
+    // watermark, or, if the write queue is already past the high watermark,
+    // must not grow it at all.
+
+    const bsl::size_t queueSize = d_sendQueue.size();
+    const bsl::size_t limit     = bsl::max(queueSize, effectiveHighWatermark);
+
+    return queueSize - replacedSize + size <= limit;
 }
 
-ntsa::Error StreamSocket::privateSocketWritableConnection(
-    const bsl::shared_ptr<StreamSocket>& self)
+bool StreamSocket::privateConflateSend(
+    const bsl::shared_ptr<StreamSocket>& self,
+    const ntcq::SendQueueEntry&          entry)
 {
     NTCI_LOG_CONTEXT();
 
-    ntsa::Error error;
+    // Records already encrypted by the encryption session must be sent in
+    // sequence, so they are never replaced.
 
-    if (!d_connectInProgress) {
-        return ntsa::Error::invalid();
+    if (d_encryption_sp && !d_encryptionOffloaded) {
+        return false;
     }
 
-    ntsa::Error lastError;
-    d_socket_sp->getLastError(&lastError);
-    if (!lastError) {
-        lastError = ntsa::Error::invalid();
+    ntcq::SendQueueEntry replaced;
+    if (!d_sendQueue.conflateEntry(&replaced, entry)) {
+        return false;
     }
 
-    error = d_socket_sp->remoteEndpoint(&d_remoteEndpoint);
-    if (NTCCFG_UNLIKELY(error)) {
-        if (lastError == ntsa::Error::invalid()) {
-            lastError = error;
-        }
+    NTCR_STREAMSOCKET_LOG_WRITE_QUEUE_CONFLATED(replaced.length(),
+                                                entry.conflationKey().value());
 
-        this->privateFailConnect(self, lastError, false, false);
-        return lastError;
+    NTCS_METRICS_UPDATE_WRITE_QUEUE_CONFLATED(replaced.length());
+    NTCS_METRICS_UPDATE_WRITE_QUEUE_SIZE(d_sendQueue.size());
+
+    if (NTCCFG_UNLIKELY(!entry.deadline().isNull())) {
+        this->privateScheduleSendDeadline(self);
     }
 
-    error = d_socket_sp->sourceEndpoint(&d_sourceEndpoint);
-    if (NTCCFG_UNLIKELY(error)) {
-        NTCS_METRICS_UPDATE_CONNECT_FAILURE();
+    if (replaced.callback()) {
+        ntca::SendContext sendContext;
+        sendContext.setError(ntsa::Error(ntsa::Error::e_CANCELLED));
 
-        if (lastError == ntsa::Error::invalid()) {
-            lastError = error;
-        }
+        ntca::SendEvent sendEvent;
+        sendEvent.setType(ntca::SendEventType::e_ERROR);
+        sendEvent.setContext(sendContext);
 
-        this->privateFailConnect(self, lastError, false, false);
-        return lastError;
+        replaced.callback().dispatch(self,
+                                     sendEvent,
+                                     d_reactorStrand_sp,
+                                     self,
+                                     true,
+                                     &d_mutex);
     }
 
-    {
-        bsl::size_t sendBufferSize;
+    return true;
+}
 
-        ntsa::SocketOption option;
-        error =
-            d_socket_sp->getOption(&option,
-                                   ntsa::SocketOptionType::e_SEND_BUFFER_SIZE);
-        if (!error) {
-            sendBufferSize = option.sendBufferSize();
-        }
-        else {
-            sendBufferSize = 0;
-        }
+void StreamSocket::privateFlushSend(const bsl::shared_ptr<StreamSocket>& self)
+{
+    d_sendCoalescingPending = false;
 
-        if (sendBufferSize > 0) {
-            d_sendOptions.setMaxBytes(sendBufferSize * 2);
-        }
+    if (!d_sendQueue.hasEntry()) {
+        return;
     }
 
-    {
-        bsl::size_t receiveBufferSize;
+    if (!d_shutdownState.canSend() || d_flowControlState.lockSend()) {
+        return;
+    }
 
-        ntsa::SocketOption option;
-        error = d_socket_sp->getOption(
-            &option,
-            ntsa::SocketOptionType::e_RECEIVE_BUFFER_SIZE);
-        if (!error) {
-            receiveBufferSize = option.receiveBufferSize();
-        }
-        else {
-            receiveBufferSize = 0;
+    ntsa::Error error;
+
+    while (d_sendQueue.hasEntry()) {
+        error = this->privateSocketWritableIteration(self);
+        if (error) {
+            break;
         }
 
-        if (receiveBufferSize > 0) {
-            d_receiveOptions.setMaxBytes(receiveBufferSize);
+        if (!d_shutdownState.canSend()) {
+            break;
         }
     }
 
-    d_sendOptions.setMaxBuffers(d_socket_sp->maxBuffersPerSend());
-    d_receiveOptions.setMaxBuffers(d_socket_sp->maxBuffersPerReceive());
-
-    NTCS_METRICS_UPDATE_CONNECT_COMPLETE();
+    if (error && error != ntsa::Error::e_WOULD_BLOCK) {
+        this->privateFail(self, error);
+        return;
+    }
 
-    NTCI_LOG_CONTEXT_GUARD_SOURCE_ENDPOINT(d_sourceEndpoint);
-    NTCI_LOG_CONTEXT_GUARD_REMOTE_ENDPOINT(d_remoteEndpoint);
+    if (d_sendQueue.hasEntry()) {
+        this->privateRelaxFlowControl(self,
+                                      ntca::FlowControlType::e_SEND,
+                                      true,
+                                      false);
+    }
+}
 
-    bsls::TimeInterval now = this->currentTime();
+void StreamSocket::privateStartTcpInfoSampling(
+    const bsl::shared_ptr<StreamSocket>& self)
+{
+    if (d_options.tcpInfoInterval().isNull() || d_tcpInfoTimer_sp) {
+        return;
+    }
 
-    bsls::TimeInterval connectLatency;
-    if (now > d_connectStartTime) {
-        connectLatency = now - d_connectStartTime;
+    const bsls::TimeInterval interval = d_options.tcpInfoInterval().value();
+    if (interval <= bsls::TimeInterval()) {
+        return;
     }
 
-    d_connectContext.setError(ntsa::Error());
-    d_connectContext.setAttemptsRemaining(0);
-    d_connectContext.setLatency(connectLatency);
+    ntca::TimerOptions timerOptions;
+    timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
+    timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
+    timerOptions.setOneShot(false);
 
-    if (d_connectContext.name().isNull()) {
-        if (!d_connectName.empty()) {
-            d_connectContext.setName(d_connectName);
-        }
+    ntci::TimerCallback timerCallback = this->createTimerCallback(
+        bdlf::MemFnUtil::memFn(&StreamSocket::processTcpInfoTimer, self),
+        d_allocator_p);
+
+    d_tcpInfoTimer_sp =
+        this->createTimer(timerOptions, timerCallback, d_allocator_p);
+
+    d_tcpInfoTimer_sp->schedule(this->currentTime() + interval, interval);
+}
+
+ntsa::Error StreamSocket::privateOffloadEncryption(
+    const bsl::shared_ptr<StreamSocket>& self)
+{
+    NTCCFG_WARNING_UNUSED(self);
+
+    NTCI_LOG_CONTEXT();
+
+    if (!d_encryption_sp || d_encryption_sp->isShutdownSent() ||
+        d_encryption_sp->isShutdownReceived())
+    {
+        d_encryptionOffloadPending = false;
+        return ntsa::Error();
     }
 
-    if (d_connectContext.endpoint().isUndefined()) {
-        if (!d_connectEndpoint.isUndefined()) {
-            d_connectContext.setEndpoint(d_connectEndpoint);
-        }
+    // Any ciphertext already produced by the encryption session must be
+    // copied to the socket send buffer before the operating system takes
+    // over the encryption of outgoing records, otherwise that data would be
+    // encrypted twice.
+
+    if (d_encryption_sp->hasOutgoingCipherText() || d_sendQueue.hasEntry()) {
+        return ntsa::Error();
     }
 
-    d_connectOptions.setRetryCount(0);
-    d_connectInProgress = false;
+    ntsa::Error error;
 
-    d_openState.set(ntcs::OpenState::e_CONNECTED);
+    ntsa::TlsSessionKey transmitKey;
+    ntsa::TlsSessionKey receiveKey;
 
-    if (d_options.timestampOutgoingData().value_or(false)) {
-        ntsa::Error error = this->privateTimestampOutgoingData(self, true);
-        if (error) {
-            NTCR_STREAMSOCKET_LOG_TIMESTAMP_PROCESSING_ERROR();
+    error = d_encryption_sp->exportSessionKeys(&transmitKey, &receiveKey);
+    if (error) {
+        if (error == ntsa::Error::e_WOULD_BLOCK) {
+            // The encryption session holds a partial record; try again once
+            // more data is received.
+
+            return ntsa::Error();
         }
-    }
 
-    ntci::ConnectCallback connectCallback = d_connectCallback;
-    d_connectCallback.reset();
+        NTCR_STREAMSOCKET_LOG_ENCRYPTION_OFFLOAD_UNAVAILABLE(error);
+        d_encryptionOffloadPending = false;
+        return ntsa::Error();
+    }
 
-    ntca::ConnectContext connectContext = d_connectContext;
-    d_connectContext.reset();
+    // Offload only the encryption of outgoing records. Incoming records
+    // continue to be decrypted by the encryption session, since the
+    // operating system fails to receive records other than application data,
+    // such as a TLS 1.3 NewSessionTicket, unless each is received with
+    // control messages.
 
-    ntca::ConnectEvent connectEvent;
-    connectEvent.setType(ntca::ConnectEventType::e_COMPLETE);
-    connectEvent.setContext(connectContext);
+    error = d_socket_sp->setTlsTransmitOffload(transmitKey);
 
-    if (d_connectDeadlineTimer_sp) {
-        d_connectDeadlineTimer_sp->close();
-        d_connectDeadlineTimer_sp.reset();
-    }
+    transmitKey.reset();
+    receiveKey.reset();
 
-    if (d_connectRetryTimer_sp) {
-        d_connectRetryTimer_sp->close();
-        d_connectRetryTimer_sp.reset();
-    }
+    if (error) {
+        NTCR_STREAMSOCKET_LOG_ENCRYPTION_OFFLOAD_UNAVAILABLE(error);
+        d_encryptionOffloadPending = false;
 
-    {
-        ntcs::ObserverRef<ntci::Reactor> reactorRef(&d_reactor);
-        if (reactorRef) {
-            reactorRef->hideWritable(self);
+        if (error == ntsa::Error::e_NOT_IMPLEMENTED ||
+            error == ntsa::Error::e_INVALID)
+        {
+            return ntsa::Error();
         }
+
+        return error;
     }
 
-    NTCI_LOG_DEBUG("Connection attempt succeeded");
+    // The operating system now encrypts each outgoing record, so send
+    // plaintext directly, which also permits zero-copy and file
+    // transmission.
 
-    if (connectCallback) {
-        connectCallback.dispatch(self,
-                                 connectEvent,
-                                 d_reactorStrand_sp,
-                                 self,
-                                 false,
-                                 &d_mutex);
-    }
+    d_encryptionOffloaded      = true;
+    d_encryptionOffloadPending = false;
 
-    if (d_openState.value() != ntcs::OpenState::e_CONNECTED) {
-        return ntsa::Error(ntsa::Error::e_CONNECTION_DEAD);
+    NTCR_STREAMSOCKET_LOG_ENCRYPTION_OFFLOAD_COMPLETE();
+
+    return ntsa::Error();
+}
+
+void StreamSocket::privateUpdateMaxBytesPerSend(bsl::size_t sendBufferSize)
+{
+    bsl::size_t maxBytes = d_sendOptions.maxBytes();
+
+    if (sendBufferSize > 0) {
+        maxBytes = sendBufferSize * 2;
     }
 
-    ntcs::Dispatch::announceEstablished(d_manager_sp,
-                                        self,
-                                        d_managerStrand_sp,
-                                        d_reactorStrand_sp,
-                                        self,
-                                        false,
-                                        &d_mutex);
+    // When the unsent low watermark is set the operating system indicates
+    // the socket is writable only once the data buffered but not yet sent
+    // falls below that watermark. Copy no more than that watermark to the
+    // send buffer at a time so the remaining data stays on the write queue.
 
-    return ntsa::Error();
+    if (d_unsentLowWatermark > 0) {
+        if (maxBytes == 0 || maxBytes > d_unsentLowWatermark) {
+            maxBytes = d_unsentLowWatermark;
+        }
+    }
+
+    d_sendOptions.setMaxBytes(maxBytes);
 }
 
 ntsa::Error StreamSocket::privateSocketWritableIteration(
     const bsl::shared_ptr<StreamSocket>& self)
 {
+    if (NTCCFG_UNLIKELY(d_sendDeadlineTimerArmed)) {
+        // Discard the entries whose deadline has elapsed before they reach
+        // the socket send buffer, rather than waiting for the timer.
+
+        bsls::TimeInterval deadline;
+        if (d_sendQueue.earliestDeadline(&deadline) &&
+            deadline <= this->currentTime())
+        {
+            this->privateExpireSendQueue(self);
+        }
+    }
+
     if (!d_sendQueue.hasEntry()) {
         return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
     }
@@ -1181,6 +2042,21 @@ ntsa::Error StreamSocket::privateSocketWritableIteration(
     if (d_sendQueue.batchNext(&d_sendData_sp->constBufferArray(),
                               d_sendOptions))
     {
+        if (NTCCFG_UNLIKELY(d_sendCoalescing)) {
+            // Hint that more data immediately follows this batch when the
+            // batch does not cover the entire write queue, so that the
+            // last segment of this batch may be filled by the next.
+
+            d_sendOptions.setMore(d_sendData_sp->size() < d_sendQueue.size());
+
+            ntsa::Error error =
+                this->privateSocketWritableIterationBatch(self);
+
+            d_sendOptions.setMore(false);
+
+            return error;
+        }
+
         return this->privateSocketWritableIterationBatch(self);
     }
     else {
@@ -2044,6 +2920,25 @@ void StreamSocket::privateShutdownSequenceComplete(
                 d_sendRateTimer_sp.reset();
             }
 
+            if (d_sendCoalescingTimer_sp) {
+                d_sendCoalescingTimer_sp->close();
+                d_sendCoalescingTimer_sp.reset();
+            }
+
+            if (d_sendDeadlineTimer_sp) {
+                d_sendDeadlineTimer_sp->close();
+                d_sendDeadlineTimer_sp.reset();
+            }
+
+            d_sendDeadlineTimerArmed = false;
+
+            if (d_tcpInfoTimer_sp) {
+                d_tcpInfoTimer_sp->close();
+                d_tcpInfoTimer_sp.reset();
+            }
+
+            d_sendCoalescingPending = false;
+
             d_zeroCopyQueue.clear(&callbackVector);
 
             announceWriteQueueDiscarded =
@@ -2700,9 +3595,7 @@ ntsa::Error StreamSocket::privateEnqueueSendBuffer(
                 sendBufferSize = 0;
             }
 
-            if (sendBufferSize > 0) {
-                d_sendOptions.setMaxBytes(sendBufferSize * 2);
-            }
+            this->privateUpdateMaxBytesPerSend(sendBufferSize);
         }
     }
 #endif
@@ -2800,9 +3693,7 @@ ntsa::Error StreamSocket::privateEnqueueSendBuffer(
                 sendBufferSize = 0;
             }
 
-            if (sendBufferSize > 0) {
-                d_sendOptions.setMaxBytes(sendBufferSize * 2);
-            }
+            this->privateUpdateMaxBytesPerSend(sendBufferSize);
         }
     }
 #endif
@@ -2944,7 +3835,12 @@ ntsa::Error StreamSocket::privateDequeueReceiveBuffer(
         context->setBytesReceived(numBytesReceived);
 
         if (d_encryption_sp->isShutdownReceived()) {
-            if (!d_encryption_sp->isShutdownSent()) {
+            // A TLS alert cannot be sent once the encryption of outgoing
+            // records is offloaded, so the shutdown of an offloaded session
+            // is only announced.
+
+            if (!d_encryption_sp->isShutdownSent() && !d_encryptionOffloaded)
+            {
                 error = d_encryption_sp->shutdown();
                 if (error) {
                     return error;
@@ -2971,6 +3867,15 @@ ntsa::Error StreamSocket::privateDequeueReceiveBuffer(
         }
 
         if (NTCCFG_UNLIKELY(d_encryption_sp->hasOutgoingCipherText())) {
+            if (NTCCFG_UNLIKELY(d_encryptionOffloaded)) {
+                // The encryption session has produced a record in response
+                // to an incoming record, such as a TLS 1.3 KeyUpdate, but
+                // its outgoing record sequence no longer matches that of
+                // the operating system.
+
+                return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+            }
+
             bdlbb::Blob cipherData(d_outgoingBufferFactory_sp.get());
 
             while (NTCCFG_UNLIKELY(d_encryption_sp->hasOutgoingCipherText())) {
@@ -3016,21 +3921,49 @@ ntsa::Error StreamSocket::privateDequeueReceiveBuffer(
             }
         }
 
+        if (NTCCFG_UNLIKELY(d_encryptionOffloadPending)) {
+            error = this->privateOffloadEncryption(self);
+            if (error) {
+                return error;
+            }
+        }
+
         if (numBytesReceived == 0) {
             return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
         }
-
-        return ntsa::Error();
+
+        return ntsa::Error();
+    }
+}
+
+ntsa::Error StreamSocket::privateDequeueReceiveBufferRaw(
+    const bsl::shared_ptr<StreamSocket>& self,
+    ntsa::ReceiveContext*                context,
+    bdlbb::Blob*                         data)
+{
+    ntsa::Error error;
+
+    if (!d_socket_sp) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    if (NTCCFG_UNLIKELY(d_receiveRateLimiter_sp)) {
+        error = this->privateThrottleReceiveBuffer(self);
+        if (error) {
+            return error;
+        }
     }
+
+    error = d_socket_sp->receive(context, data, d_receiveOptions);
+
+    return this->privateDequeueReceiveBufferRawResult(self, context, error);
 }
 
 ntsa::Error StreamSocket::privateDequeueReceiveBufferRaw(
     const bsl::shared_ptr<StreamSocket>& self,
     ntsa::ReceiveContext*                context,
-    bdlbb::Blob*                         data)
+    const ntsa::MutableBufferArray&      buffers)
 {
-    NTCI_LOG_CONTEXT();
-
     ntsa::Error error;
 
     if (!d_socket_sp) {
@@ -3044,7 +3977,28 @@ ntsa::Error StreamSocket::privateDequeueReceiveBufferRaw(
         }
     }
 
-    error = d_socket_sp->receive(context, data, d_receiveOptions);
+    // Refer to the buffer descriptors of 'buffers' rather than copying them,
+    // which would otherwise allocate on each readable event. The socket only
+    // writes into the memory the descriptors reference, never to the
+    // descriptors themselves.
+
+    BSLS_ASSERT(buffers.numBuffers() > 0);
+
+    ntsa::Data data(ntsa::MutableBufferPtrArray(
+        const_cast<ntsa::MutableBuffer*>(&buffers.buffer(0)),
+        buffers.numBuffers()));
+
+    error = d_socket_sp->receive(context, &data, d_receiveOptions);
+
+    return this->privateDequeueReceiveBufferRawResult(self, context, error);
+}
+
+ntsa::Error StreamSocket::privateDequeueReceiveBufferRawResult(
+    const bsl::shared_ptr<StreamSocket>& self,
+    ntsa::ReceiveContext*                context,
+    const ntsa::Error&                   error)
+{
+    NTCI_LOG_CONTEXT();
 
     if (d_receiveOptions.wantTimestamp()) {
         const bdlb::NullableValue<bsls::TimeInterval>& softwareTs =
@@ -3177,7 +4131,9 @@ ntsa::Error StreamSocket::privateSendRaw(
     ntsa::Error       error;
     ntsa::SendContext context;
 
-    if (NTCCFG_LIKELY(!d_sendQueue.hasEntry())) {
+    const bool coalesce = d_sendCoalescing && !options.flush();
+
+    if (NTCCFG_LIKELY(!d_sendQueue.hasEntry() && !coalesce)) {
         error = this->privateEnqueueSendBuffer(self, &context, data);
         if (NTCCFG_UNLIKELY(error)) {
             if (NTCCFG_UNLIKELY(error != ntsa::Error::e_WOULD_BLOCK)) {
@@ -3245,38 +4201,38 @@ ntsa::Error StreamSocket::privateSendRaw(
 
     if (NTCCFG_UNLIKELY(!options.deadline().isNull())) {
         if (context.bytesSent() == 0) {
-            ntca::TimerOptions timerOptions;
-            timerOptions.setOneShot(true);
-            timerOptions.showEvent(ntca::TimerEventType::e_DEADLINE);
-            timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
-            timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
-
-            ntci::TimerCallback timerCallback = this->createTimerCallback(
-                bdlf::BindUtil::bind(&StreamSocket::processSendDeadlineTimer,
-                                     self,
-                                     bdlf::PlaceHolders::_1,
-                                     bdlf::PlaceHolders::_2,
-                                     entry.id()),
-                d_allocator_p);
-
-            bsl::shared_ptr<ntci::Timer> timer =
-                this->createTimer(timerOptions, timerCallback, d_allocator_p);
-
             entry.setDeadline(options.deadline().value());
-            entry.setTimer(timer);
+        }
+    }
 
-            timer->schedule(options.deadline().value());
+    if (NTCCFG_UNLIKELY(!options.conflationKey().isNull())) {
+        if (context.bytesSent() == 0) {
+            entry.setConflationKey(options.conflationKey().value());
+
+            if (this->privateConflateSend(self, entry)) {
+                return ntsa::Error();
+            }
         }
     }
 
     bool becameNonEmpty = d_sendQueue.pushEntry(entry);
 
+    if (NTCCFG_UNLIKELY(!entry.deadline().isNull())) {
+        this->privateScheduleSendDeadline(self);
+    }
+
     NTCR_STREAMSOCKET_LOG_WRITE_QUEUE_FILLED(d_sendQueue.size(),
                                              d_sendQueue.highWatermark());
 
     NTCS_METRICS_UPDATE_WRITE_QUEUE_SIZE(d_sendQueue.size());
 
-    if (becameNonEmpty) {
+    if (NTCCFG_UNLIKELY(coalesce)) {
+        this->privateScheduleFlushSend(self);
+    }
+    else if (NTCCFG_UNLIKELY(d_sendCoalescingPending)) {
+        this->privateFlushSend(self);
+    }
+    else if (becameNonEmpty) {
         this->privateRelaxFlowControl(self,
                                       ntca::FlowControlType::e_SEND,
                                       true,
@@ -3298,7 +4254,9 @@ ntsa::Error StreamSocket::privateSendRaw(
     ntsa::Error       error;
     ntsa::SendContext context;
 
-    if (NTCCFG_LIKELY(!d_sendQueue.hasEntry())) {
+    const bool coalesce = d_sendCoalescing && !options.flush();
+
+    if (NTCCFG_LIKELY(!d_sendQueue.hasEntry() && !coalesce)) {
         error = this->privateEnqueueSendBuffer(self, &context, data);
         if (NTCCFG_UNLIKELY(error)) {
             if (NTCCFG_UNLIKELY(error != ntsa::Error::e_WOULD_BLOCK)) {
@@ -3369,38 +4327,38 @@ ntsa::Error StreamSocket::privateSendRaw(
 
     if (NTCCFG_UNLIKELY(!options.deadline().isNull())) {
         if (context.bytesSent() == 0) {
-            ntca::TimerOptions timerOptions;
-            timerOptions.setOneShot(true);
-            timerOptions.showEvent(ntca::TimerEventType::e_DEADLINE);
-            timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
-            timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
-
-            ntci::TimerCallback timerCallback = this->createTimerCallback(
-                bdlf::BindUtil::bind(&StreamSocket::processSendDeadlineTimer,
-                                     self,
-                                     bdlf::PlaceHolders::_1,
-                                     bdlf::PlaceHolders::_2,
-                                     entry.id()),
-                d_allocator_p);
-
-            bsl::shared_ptr<ntci::Timer> timer =
-                this->createTimer(timerOptions, timerCallback, d_allocator_p);
-
             entry.setDeadline(options.deadline().value());
-            entry.setTimer(timer);
+        }
+    }
 
-            timer->schedule(options.deadline().value());
+    if (NTCCFG_UNLIKELY(!options.conflationKey().isNull())) {
+        if (context.bytesSent() == 0) {
+            entry.setConflationKey(options.conflationKey().value());
+
+            if (this->privateConflateSend(self, entry)) {
+                return ntsa::Error();
+            }
         }
     }
 
     bool becameNonEmpty = d_sendQueue.pushEntry(entry);
 
+    if (NTCCFG_UNLIKELY(!entry.deadline().isNull())) {
+        this->privateScheduleSendDeadline(self);
+    }
+
     NTCR_STREAMSOCKET_LOG_WRITE_QUEUE_FILLED(d_sendQueue.size(),
                                              d_sendQueue.highWatermark());
 
     NTCS_METRICS_UPDATE_WRITE_QUEUE_SIZE(d_sendQueue.size());
 
-    if (becameNonEmpty) {
+    if (NTCCFG_UNLIKELY(coalesce)) {
+        this->privateScheduleFlushSend(self);
+    }
+    else if (NTCCFG_UNLIKELY(d_sendCoalescingPending)) {
+        this->privateFlushSend(self);
+    }
+    else if (becameNonEmpty) {
         this->privateRelaxFlowControl(self,
                                       ntca::FlowControlType::e_SEND,
                                       true,
@@ -3717,9 +4675,7 @@ ntsa::Error StreamSocket::privateOpen(
             sendBufferSize = 0;
         }
 
-        if (sendBufferSize > 0) {
-            d_sendOptions.setMaxBytes(sendBufferSize * 2);
-        }
+        this->privateUpdateMaxBytesPerSend(sendBufferSize);
     }
 
     {
@@ -3787,6 +4743,8 @@ ntsa::Error StreamSocket::privateOpen(
             }
         }
 
+        this->privateStartTcpInfoSampling(self);
+
         ntcs::Dispatch::announceEstablished(d_manager_sp,
                                             self,
                                             d_managerStrand_sp,
@@ -4463,6 +5421,18 @@ StreamSocket::StreamSocket(
 , d_sendRateLimiter_sp()
 , d_sendRateTimer_sp()
 , d_sendGreedily(NTCCFG_DEFAULT_STREAM_SOCKET_WRITE_GREEDILY)
+, d_sendCoalescing(false)
+, d_sendCoalescingWindow()
+, d_sendCoalescingPending(false)
+, d_sendCoalescingTimer_sp()
+, d_sendDeadlineTimer_sp()
+, d_sendDeadlineTimerDue()
+, d_sendDeadlineTimerArmed(false)
+, d_adaptiveWriteQueue(false)
+, d_sendQueueHighWatermark(0)
+, d_unsentLowWatermark(0)
+, d_tcpInfoTimer_sp()
+, d_tcpRetransmittedSegments(0)
 , d_sendComplete(basicAllocator)
 , d_sendCounter(0)
 , d_sendData_sp()
@@ -4486,6 +5456,8 @@ StreamSocket::StreamSocket(
 , d_upgradeCallback(basicAllocator)
 , d_upgradeTimer_sp()
 , d_upgradeInProgress(false)
+, d_encryptionOffloadPending(false)
+, d_encryptionOffloaded(false)
 , d_timestampOutgoingData(false)
 , d_timestampIncomingData(false)
 , d_timestampCorrelator(ntsa::TransportMode::e_STREAM,
@@ -4531,6 +5503,26 @@ StreamSocket::StreamSocket(
         d_sendGreedily = d_options.sendGreedily().value();
     }
 
+    if (!d_options.sendCoalescing().isNull()) {
+        d_sendCoalescing = d_options.sendCoalescing().value();
+    }
+
+    if (!d_options.sendCoalescingWindow().isNull()) {
+        d_sendCoalescingWindow = d_options.sendCoalescingWindow().value();
+    }
+
+    if (!d_options.adaptiveWriteQueue().isNull()) {
+        d_adaptiveWriteQueue = d_options.adaptiveWriteQueue().value();
+    }
+
+    d_sendQueueHighWatermark = d_sendQueue.highWatermark();
+
+#if defined(BSLS_PLATFORM_OS_LINUX) || defined(BSLS_PLATFORM_OS_DARWIN)
+    if (!d_options.unsentLowWatermark().isNull()) {
+        d_unsentLowWatermark = d_options.unsentLowWatermark().value();
+    }
+#endif
+
     if (!d_options.readQueueLowWatermark().isNull()) {
         d_receiveQueue.setLowWatermark(
             d_options.readQueueLowWatermark().value());
@@ -4541,6 +5533,13 @@ StreamSocket::StreamSocket(
             d_options.readQueueHighWatermark().value());
     }
 
+    if (!d_options.receiveFramer().isNull()) {
+        bsl::shared_ptr<ntcs::ReceiveFramer> receiveFramer;
+        receiveFramer.createInplace(d_allocator_p,
+                                    d_options.receiveFramer().value());
+        d_receiveQueue.setFramer(receiveFramer);
+    }
+
     if (!d_options.minIncomingStreamTransferSize().isNull()) {
         d_receiveFeedback.setMinimum(
             d_options.minIncomingStreamTransferSize().value());
@@ -5228,7 +6227,10 @@ ntsa::Error StreamSocket::send(const bdlbb::Blob&        data,
     }
 
     if (NTCCFG_UNLIKELY(
-            d_sendQueue.isHighWatermarkViolated(effectiveHighWatermark)))
+            d_sendQueue.isHighWatermarkViolated(effectiveHighWatermark)) &&
+        !this->privateCanConflateSend(static_cast<bsl::size_t>(data.length()),
+                                      options,
+                                      effectiveHighWatermark))
     {
         if (d_sendQueue.authorizeHighWatermarkEvent(effectiveHighWatermark)) {
             NTCR_STREAMSOCKET_LOG_WRITE_QUEUE_HIGH_WATERMARK(
@@ -5255,7 +6257,7 @@ ntsa::Error StreamSocket::send(const bdlbb::Blob&        data,
         return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
     }
 
-    if (NTCCFG_LIKELY(!d_encryption_sp)) {
+    if (NTCCFG_LIKELY(!d_encryption_sp || d_encryptionOffloaded)) {
         return this->privateSendRaw(self, data, state, options, callback);
     }
     else {
@@ -5302,7 +6304,10 @@ ntsa::Error StreamSocket::send(const ntsa::Data&         data,
     }
 
     if (NTCCFG_UNLIKELY(
-            d_sendQueue.isHighWatermarkViolated(effectiveHighWatermark)))
+            d_sendQueue.isHighWatermarkViolated(effectiveHighWatermark)) &&
+        !this->privateCanConflateSend(data.size(),
+                                      options,
+                                      effectiveHighWatermark))
     {
         if (d_sendQueue.authorizeHighWatermarkEvent(effectiveHighWatermark)) {
             NTCR_STREAMSOCKET_LOG_WRITE_QUEUE_HIGH_WATERMARK(
@@ -5329,7 +6334,7 @@ ntsa::Error StreamSocket::send(const ntsa::Data&         data,
         return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
     }
 
-    if (NTCCFG_LIKELY(!d_encryption_sp)) {
+    if (NTCCFG_LIKELY(!d_encryption_sp || d_encryptionOffloaded)) {
         return this->privateSendRaw(self, data, state, options, callback);
     }
     else {
@@ -5364,7 +6369,19 @@ ntsa::Error StreamSocket::receive(ntca::ReceiveContext*       context,
         return ntsa::Error(ntsa::Error::e_EOF);
     }
 
-    if (NTCCFG_LIKELY(d_receiveQueue.size() >= options.minSize())) {
+    bsl::size_t frameSize   = 0;
+    bsl::size_t framePrefix = 0;
+    bsl::size_t frameSuffix = 0;
+
+    error = d_receiveQueue.frame(&frameSize,
+                                 &framePrefix,
+                                 &frameSuffix,
+                                 options);
+    if (NTCCFG_UNLIKELY(error && error != ntsa::Error::e_WOULD_BLOCK)) {
+        return error;
+    }
+
+    if (NTCCFG_LIKELY(!error)) {
         BSLS_ASSERT(d_receiveQueue.hasEntry());
         BSLS_ASSERT(d_receiveQueue.size() ==
                     NTCCFG_WARNING_PROMOTE(bsl::size_t,
@@ -5373,55 +6390,13 @@ ntsa::Error StreamSocket::receive(ntca::ReceiveContext*       context,
         bool receiveQueueHighWatermarkViolatedBefore =
             d_receiveQueue.isHighWatermarkViolated();
 
-        bsl::size_t numBytesRemaining = options.maxSize();
-        bsl::size_t numBytesDequeued  = 0;
-
-        while (NTCCFG_LIKELY(d_receiveQueue.hasEntry())) {
-            ntcq::ReceiveQueueEntry& entry = d_receiveQueue.frontEntry();
-
-            bsl::size_t numBytesToDequeue =
-                bsl::min(numBytesRemaining, entry.length());
-
-            numBytesDequeued += numBytesToDequeue;
-            BSLS_ASSERT(numBytesDequeued <= options.maxSize());
-
-            BSLS_ASSERT(numBytesRemaining >= numBytesToDequeue);
-            numBytesRemaining -= numBytesToDequeue;
-
-            if (numBytesToDequeue == entry.length()) {
-                NTCS_METRICS_UPDATE_READ_QUEUE_DELAY(entry.delay());
-
-                if (d_receiveQueue.popEntry()) {
-                    break;
-                }
-            }
-            else {
-                d_receiveQueue.popSize(numBytesToDequeue);
-                break;
-            }
-
-            if (numBytesRemaining == 0) {
-                break;
-            }
-        }
-
-        BSLS_ASSERT(numBytesDequeued >= options.minSize());
-        BSLS_ASSERT(numBytesDequeued <= options.maxSize());
-
         context->setTransport(d_transport);
         context->setEndpoint(d_remoteEndpoint);
 
-        ntcs::BlobUtil::append(data, d_receiveQueue.data(), numBytesDequeued);
-
-        ntcs::BlobUtil::pop(d_receiveQueue.data(), numBytesDequeued);
-
-        BSLS_ASSERT(d_receiveQueue.size() ==
-                    NTCCFG_WARNING_PROMOTE(bsl::size_t,
-                                           d_receiveQueue.data()->length()));
-
-        NTCR_STREAMSOCKET_LOG_READ_QUEUE_DRAINED(d_receiveQueue.size());
-
-        NTCS_METRICS_UPDATE_READ_QUEUE_SIZE(d_receiveQueue.size());
+        this->privateDequeueReceiveData(data,
+                                        frameSize,
+                                        framePrefix,
+                                        frameSuffix);
 
         bool receiveQueueHighWatermarkViolatedAfter =
             d_receiveQueue.isHighWatermarkViolated();
@@ -5468,163 +6443,63 @@ ntsa::Error StreamSocket::receive(const ntca::ReceiveOptions&  options,
 
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
-    NTCI_LOG_CONTEXT();
-
-    NTCI_LOG_CONTEXT_GUARD_DESCRIPTOR(d_publicHandle);
-    NTCI_LOG_CONTEXT_GUARD_SOURCE_ENDPOINT(d_sourceEndpoint);
-    NTCI_LOG_CONTEXT_GUARD_REMOTE_ENDPOINT(d_remoteEndpoint);
-
-    ntsa::Error error;
-
-    if (NTCCFG_UNLIKELY(!d_openState.canReceive())) {
-        return ntsa::Error(ntsa::Error::e_INVALID);
-    }
-
-    if (NTCCFG_UNLIKELY(d_receiveQueue.size() == 0 &&
-                        !d_shutdownState.canReceive()))
-    {
-        return ntsa::Error(ntsa::Error::e_EOF);
-    }
-
     bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry> callbackEntry =
         d_receiveQueue.createCallbackEntry();
     callbackEntry->assign(callback, options);
 
-    if (NTCCFG_LIKELY(!d_receiveQueue.hasCallbackEntry() &&
-                      d_receiveQueue.size() >= options.minSize()))
-    {
-        BSLS_ASSERT(d_receiveQueue.hasEntry());
-        BSLS_ASSERT(d_receiveQueue.size() ==
-                    NTCCFG_WARNING_PROMOTE(bsl::size_t,
-                                           d_receiveQueue.data()->length()));
-
-        bool receiveQueueHighWatermarkViolatedBefore =
-            d_receiveQueue.isHighWatermarkViolated();
-
-        bsl::size_t numBytesRemaining = options.maxSize();
-        bsl::size_t numBytesDequeued  = 0;
-
-        while (NTCCFG_LIKELY(d_receiveQueue.hasEntry())) {
-            ntcq::ReceiveQueueEntry& entry = d_receiveQueue.frontEntry();
-
-            bsl::size_t numBytesToDequeue =
-                bsl::min(numBytesRemaining, entry.length());
-
-            numBytesDequeued += numBytesToDequeue;
-            BSLS_ASSERT(numBytesDequeued <= options.maxSize());
-
-            BSLS_ASSERT(numBytesRemaining >= numBytesToDequeue);
-            numBytesRemaining -= numBytesToDequeue;
-
-            if (numBytesToDequeue == entry.length()) {
-                NTCS_METRICS_UPDATE_READ_QUEUE_DELAY(entry.delay());
-
-                if (d_receiveQueue.popEntry()) {
-                    break;
-                }
-            }
-            else {
-                d_receiveQueue.popSize(numBytesToDequeue);
-                break;
-            }
-
-            if (numBytesRemaining == 0) {
-                break;
-            }
-        }
-
-        BSLS_ASSERT(numBytesDequeued >= options.minSize());
-        BSLS_ASSERT(numBytesDequeued <= options.maxSize());
-
-        bsl::shared_ptr<bdlbb::Blob> data =
-            d_dataPool_sp->createIncomingBlob();
-
-        ntcs::BlobUtil::append(data, d_receiveQueue.data(), numBytesDequeued);
-
-        ntcs::BlobUtil::pop(d_receiveQueue.data(), numBytesDequeued);
-
-        BSLS_ASSERT(d_receiveQueue.size() ==
-                    NTCCFG_WARNING_PROMOTE(bsl::size_t,
-                                           d_receiveQueue.data()->length()));
-
-        NTCR_STREAMSOCKET_LOG_READ_QUEUE_DRAINED(d_receiveQueue.size());
-
-        NTCS_METRICS_UPDATE_READ_QUEUE_SIZE(d_receiveQueue.size());
-
-        ntca::ReceiveContext receiveContext;
-        receiveContext.setTransport(d_transport);
-        receiveContext.setEndpoint(d_remoteEndpoint);
-
-        ntca::ReceiveEvent receiveEvent;
-        receiveEvent.setType(ntca::ReceiveEventType::e_COMPLETE);
-        receiveEvent.setContext(receiveContext);
-
-        const bool defer = !options.recurse();
+    return this->privateReceive(self, callbackEntry);
+}
 
-        ntcq::ReceiveCallbackQueueEntry::dispatch(callbackEntry,
-                                                  self,
-                                                  data,
-                                                  receiveEvent,
-                                                  ntci::Strand::unknown(),
-                                                  self,
-                                                  defer,
-                                                  &d_mutex);
+ntsa::Error StreamSocket::receive(const ntca::ReceiveOptions&     options,
+                                  const ntsa::MutableBufferArray& buffers,
+                                  const ntci::ReceiveFunction&    callback)
+{
+    return this->receive(options,
+                         buffers,
+                         this->createReceiveCallback(callback, d_allocator_p));
+}
 
-        bool receiveQueueHighWatermarkViolatedAfter =
-            d_receiveQueue.isHighWatermarkViolated();
+ntsa::Error StreamSocket::receive(const ntca::ReceiveOptions&     options,
+                                  const ntsa::MutableBufferArray& buffers,
+                                  const ntci::ReceiveCallback&    callback)
+{
+    bsl::shared_ptr<StreamSocket> self = this->getSelf(this);
 
-        if (receiveQueueHighWatermarkViolatedBefore &&
-            !receiveQueueHighWatermarkViolatedAfter)
-        {
-            this->privateRelaxFlowControl(self,
-                                          ntca::FlowControlType::e_RECEIVE,
-                                          true,
-                                          false);
-        }
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
-        error = ntsa::Error::e_OK;
+    if (buffers.numBytes() == 0 || options.minSize() > buffers.numBytes()) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
     }
-    else {
-        if (!options.deadline().isNull()) {
-            ntca::TimerOptions timerOptions;
-            timerOptions.setOneShot(true);
-            timerOptions.showEvent(ntca::TimerEventType::e_DEADLINE);
-            timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
-            timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
 
-            ntci::TimerCallback timerCallback = this->createTimerCallback(
-                bdlf::BindUtil::bind(
-                    &StreamSocket::processReceiveDeadlineTimer,
-                    self,
-                    bdlf::PlaceHolders::_1,
-                    bdlf::PlaceHolders::_2,
-                    callbackEntry),
-                d_allocator_p);
-
-            bsl::shared_ptr<ntci::Timer> timer =
-                this->createTimer(timerOptions, timerCallback, d_allocator_p);
+    bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry> callbackEntry =
+        d_receiveQueue.createCallbackEntry();
+    callbackEntry->assign(callback, buffers, options);
 
-            callbackEntry->setTimer(timer);
+    return this->privateReceive(self, callbackEntry);
+}
 
-            timer->schedule(options.deadline().value());
-        }
+ntsa::Error StreamSocket::receiveBatch(
+    const ntca::ReceiveOptions&       options,
+    const ntci::ReceiveBatchFunction& callback)
+{
+    return this->receiveBatch(
+        options,
+        this->createReceiveBatchCallback(callback, d_allocator_p));
+}
 
-        d_receiveQueue.pushCallbackEntry(callbackEntry);
-        error = ntsa::Error::e_WOULD_BLOCK;
-    }
+ntsa::Error StreamSocket::receiveBatch(
+    const ntca::ReceiveOptions&       options,
+    const ntci::ReceiveBatchCallback& callback)
+{
+    bsl::shared_ptr<StreamSocket> self = this->getSelf(this);
 
-    BSLS_ASSERT(error == ntsa::Error::e_OK ||
-                error == ntsa::Error::e_WOULD_BLOCK);
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
-    if (error == ntsa::Error::e_WOULD_BLOCK) {
-        this->privateRelaxFlowControl(self,
-                                      ntca::FlowControlType::e_RECEIVE,
-                                      true,
-                                      false);
-        error = ntsa::Error::e_OK;
-    }
+    bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry> callbackEntry =
+        d_receiveQueue.createCallbackEntry();
+    callbackEntry->assign(callback, options);
 
-    return error;
+    return this->privateReceive(self, callbackEntry);
 }
 
 ntsa::Error StreamSocket::registerResolver(
@@ -5798,6 +6673,16 @@ ntsa::Error StreamSocket::setZeroCopyThreshold(bsl::size_t value)
     return ntsa::Error();
 }
 
+ntsa::Error StreamSocket::setReceiveFramer(
+    const bsl::shared_ptr<ntci::ReceiveFramer>& framer)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    d_receiveQueue.setFramer(framer);
+
+    return ntsa::Error();
+}
+
 ntsa::Error StreamSocket::setWriteRateLimiter(
     const bsl::shared_ptr<ntci::RateLimiter>& rateLimiter)
 {
@@ -5880,6 +6765,7 @@ ntsa::Error StreamSocket::setWriteQueueHighWatermark(bsl::size_t highWatermark)
     NTCI_LOG_CONTEXT_GUARD_REMOTE_ENDPOINT(d_remoteEndpoint);
 
     d_sendQueue.setHighWatermark(highWatermark);
+    d_sendQueueHighWatermark = highWatermark;
 
     if (d_sendQueue.authorizeHighWatermarkEvent()) {
         NTCR_STREAMSOCKET_LOG_WRITE_QUEUE_HIGH_WATERMARK(
@@ -5921,6 +6807,7 @@ ntsa::Error StreamSocket::setWriteQueueWatermarks(bsl::size_t lowWatermark,
 
     d_sendQueue.setLowWatermark(lowWatermark);
     d_sendQueue.setHighWatermark(highWatermark);
+    d_sendQueueHighWatermark = highWatermark;
 
     if (d_sendQueue.authorizeLowWatermarkEvent()) {
         NTCR_STREAMSOCKET_LOG_WRITE_QUEUE_LOW_WATERMARK(
@@ -6285,7 +7172,7 @@ ntsa::Error StreamSocket::cancel(const ntca::SendToken& token)
 
         callback.dispatch(self,
                                            sendEvent,
-                                           d_reactorStrand_sp,
+                          d_reactorStrand_sp,
                                            self,
                                            true,
                                            &d_mutex);
@@ -6353,6 +7240,13 @@ ntsa::Error StreamSocket::downgrade()
         return ntsa::Error::invalid();
     }
 
+    // Sending close_notify once the encryption of outgoing records is
+    // offloaded requires control messages that specify the record type.
+
+    if (d_encryptionOffloaded) {
+        return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+    }
+
     if (d_encryption_sp->isShutdownSent()) {
         return ntsa::Error();
     }
@@ -47,6 +47,7 @@ BSLS_IDENT("$Id: $")
 #include <ntcscm_version.h>
 #include <ntcu_timestampcorrelator.h>
 #include <ntsa_buffer.h>
+#include <ntsa_data.h>
 #include <ntsa_endpoint.h>
 #include <ntsa_error.h>
 #include <ntsa_shutdownmode.h>
@@ -115,6 +116,18 @@ class StreamSocket : public ntci::StreamSocket,
     bsl::shared_ptr<ntci::RateLimiter>         d_sendRateLimiter_sp;
     bsl::shared_ptr<ntci::Timer>               d_sendRateTimer_sp;
     bool                                       d_sendGreedily;
+    bool                                       d_sendCoalescing;
+    bsls::TimeInterval                         d_sendCoalescingWindow;
+    bool                                       d_sendCoalescingPending;
+    bsl::shared_ptr<ntci::Timer>               d_sendCoalescingTimer_sp;
+    bsl::shared_ptr<ntci::Timer>               d_sendDeadlineTimer_sp;
+    bsls::TimeInterval                         d_sendDeadlineTimerDue;
+    bool                                       d_sendDeadlineTimerArmed;
+    bool                                       d_adaptiveWriteQueue;
+    bsl::size_t                                d_sendQueueHighWatermark;
+    bsl::size_t                                d_unsentLowWatermark;
+    bsl::shared_ptr<ntci::Timer>               d_tcpInfoTimer_sp;
+    bsl::uint32_t                              d_tcpRetransmittedSegments;
     ntci::SendCallback                         d_sendComplete;
     ntcq::SendCounter                          d_sendCounter;
     bsl::shared_ptr<ntsa::Data>                d_sendData_sp;
@@ -138,6 +151,8 @@ class StreamSocket : public ntci::StreamSocket,
     ntci::UpgradeCallback                      d_upgradeCallback;
     bsl::shared_ptr<ntci::Timer>               d_upgradeTimer_sp;
     bool                                       d_upgradeInProgress;
+    bool                                       d_encryptionOffloadPending;
+    bool                                       d_encryptionOffloaded;
     bool                                       d_timestampOutgoingData;
     bool                                       d_timestampIncomingData;
     ntcu::TimestampCorrelator                  d_timestampCorrelator;
@@ -190,12 +205,26 @@ class StreamSocket : public ntci::StreamSocket,
     void processSendRateTimer(const bsl::shared_ptr<ntci::Timer>& timer,
                               const ntca::TimerEvent&             event);
 
-    /// Fail the specified 'entryId' because the none of the entry's data
-    /// had begun to be copied to the socket send buffer within the
-    /// deadline.
+    /// Copy the data coalesced on the write queue to the send buffer after
+    /// the send coalescing window has elapsed.
+    void processSendCoalescingTimer(const bsl::shared_ptr<ntci::Timer>& timer,
+                                    const ntca::TimerEvent&             event);
+
+    /// Copy the data coalesced on the write queue to the send buffer after
+    /// the reactor has finished processing the events of the iteration
+    /// during which the data was sent.
+    void processSendCoalescingDeferred();
+
+    /// Sample the state of the TCP connection, record it in the socket
+    /// metrics, and, if the write queue is adaptive, adjust the write queue
+    /// high watermark to the bandwidth-delay product of the connection.
+    void processTcpInfoTimer(const bsl::shared_ptr<ntci::Timer>& timer,
+                             const ntca::TimerEvent&             event);
+
+    /// Fail each entry on the write queue none of whose data had begun to
+    /// be copied to the socket send buffer within its deadline.
     void processSendDeadlineTimer(const bsl::shared_ptr<ntci::Timer>& timer,
-                                  const ntca::TimerEvent&             event,
-                                  bsl::uint64_t                       entryId);
+                                  const ntca::TimerEvent&             event);
 
     /// Attempt to copy from the read queue to the receive buffer after the
     /// read rate limiter estimates more data might be able to be received.
@@ -218,6 +247,45 @@ class StreamSocket : public ntci::StreamSocket,
         const bsl::shared_ptr<ntci::EncryptionCertificate>& certificate,
         const bsl::string&                                  details);
 
+    /// Dequeue from the read queue according to the options of the specified
+    /// 'callbackEntry', or queue the 'callbackEntry' if the read queue does
+    /// not yet have sufficient data. Return the error.
+    ntsa::Error privateReceive(
+        const bsl::shared_ptr<StreamSocket>&                    self,
+        const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& callbackEntry);
+
+    /// Dequeue the message of the specified 'frameSize' having the specified
+    /// 'framePrefix' and 'frameSuffix' from the read queue and invoke the
+    /// callback of the specified 'callbackEntry' on the specified 'strand'
+    /// according to the specified 'defer' flag. If the 'callbackEntry' is a
+    /// batch, also dequeue each subsequent complete message, up to the
+    /// maximum number of messages and size of the batch, and invoke the
+    /// callback once with all of them. If the 'callbackEntry' has buffers,
+    /// copy the message into those buffers and invoke the callback with a
+    /// null blob.
+    void privateSatisfyReceive(
+        const bsl::shared_ptr<StreamSocket>&                    self,
+        const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& callbackEntry,
+        bsl::size_t                                             frameSize,
+        bsl::size_t                                             framePrefix,
+        bsl::size_t                                             frameSuffix,
+        const bsl::shared_ptr<ntci::Strand>&                    strand,
+        bool                                                    defer);
+
+    /// Dequeue the specified 'frameSize' number of bytes from the read queue
+    /// and append them to the specified 'data', less the specified
+    /// 'framePrefix' and 'frameSuffix'. If 'data' is null, discard the
+    /// bytes dequeued.
+    void privateDequeueReceiveData(bdlbb::Blob* data,
+                                   bsl::size_t  frameSize,
+                                   bsl::size_t  framePrefix,
+                                   bsl::size_t  frameSuffix);
+
+    /// Return true if the data next readable from the socket may be read
+    /// directly into the buffers of the callback entry at the front of the
+    /// callback queue, bypassing the read queue, otherwise return false.
+    bool privateCanReceiveDirect() const;
+
     /// Process the readability of the socket by performing one read
     /// iteration.
     ntsa::Error privateSocketReadableIteration(
@@ -228,6 +296,74 @@ class StreamSocket : public ntci::StreamSocket,
     ntsa::Error privateSocketWritableConnection(
         const bsl::shared_ptr<StreamSocket>& self);
 
+    /// Schedule the data coalesced on the write queue to be copied to the
+    /// send buffer at the end of the send coalescing window, unless such a
+    /// copy is already scheduled. The behavior is undefined unless
+    /// 'd_mutex' is locked.
+    void privateScheduleFlushSend(const bsl::shared_ptr<StreamSocket>& self);
+
+    /// Copy the data coalesced on the write queue to the send buffer
+    /// immediately, then enable interest in the writability of the socket
+    /// if any data remains on the write queue. The behavior is undefined
+    /// unless 'd_mutex' is locked.
+    void privateFlushSend(const bsl::shared_ptr<StreamSocket>& self);
+
+    /// Arm the write queue deadline timer to expire at the earliest
+    /// deadline of the entries on the write queue, unless already armed to
+    /// expire no later than that deadline. The behavior is undefined unless
+    /// 'd_mutex' is locked.
+    void privateScheduleSendDeadline(
+        const bsl::shared_ptr<StreamSocket>& self);
+
+    /// Fail each entry on the write queue none of whose data has begun to
+    /// be copied to the socket send buffer within its deadline, then re-arm
+    /// the write queue deadline timer for the earliest remaining deadline,
+    /// if any. The behavior is undefined unless 'd_mutex' is locked.
+    void privateExpireSendQueue(const bsl::shared_ptr<StreamSocket>& self);
+
+    /// Replace the entry on the write queue having the same conflation key
+    /// as the specified 'entry' with 'entry', retaining its position on the
+    /// write queue, and fail the callback of the replaced entry, if any,
+    /// provided such an entry exists and none of its data has begun to be
+    /// copied to the socket send buffer. Return true if an entry was
+    /// replaced, otherwise return false. The behavior is undefined unless
+    /// 'd_mutex' is locked.
+    bool privateConflateSend(const bsl::shared_ptr<StreamSocket>& self,
+                             const ntcq::SendQueueEntry&          entry);
+
+    /// Return true if data having the specified 'size' sent according to
+    /// the specified 'options' would replace an entry on the write queue
+    /// having the same conflation key without growing the write queue past
+    /// the specified 'effectiveHighWatermark', or, if the write queue is
+    /// already past 'effectiveHighWatermark', without growing the write
+    /// queue at all, otherwise return false. The behavior is undefined
+    /// unless 'd_mutex' is locked.
+    bool privateCanConflateSend(
+        bsl::size_t              size,
+        const ntca::SendOptions& options,
+        bsl::size_t              effectiveHighWatermark) const;
+
+    /// Begin periodically sampling the state of the TCP connection, if
+    /// configured. The behavior is undefined unless 'd_mutex' is locked.
+    void privateStartTcpInfoSampling(
+        const bsl::shared_ptr<StreamSocket>& self);
+
+    /// Set the maximum number of bytes copied to the socket send buffer by
+    /// each write iteration to twice the specified 'sendBufferSize', if
+    /// non-zero, but no more than the unsent low watermark, if any. The
+    /// behavior is undefined unless 'd_mutex' is locked.
+    void privateUpdateMaxBytesPerSend(bsl::size_t sendBufferSize);
+
+    /// Offload the encryption of the records sent by the established
+    /// encryption session to the operating system, if pending and no
+    /// outgoing data remains buffered in the encryption session or on the
+    /// write queue. Return the error. If the operating system does not
+    /// support the offload, the encryption session continues to be used.
+    /// Note that incoming records continue to be decrypted by the encryption
+    /// session. The behavior is undefined unless 'd_mutex' is locked.
+    ntsa::Error privateOffloadEncryption(
+        const bsl::shared_ptr<StreamSocket>& self);
+
     /// Process the writability of the socket by performing one write
     /// iteration.
     ntsa::Error privateSocketWritableIteration(
@@ -393,6 +529,21 @@ class StreamSocket : public ntci::StreamSocket,
         ntsa::ReceiveContext*                context,
         bdlbb::Blob*                         data);
 
+    /// Dequeue raw data from the socket receive buffer. Copy the data
+    /// dequeued into the memory referenced by the specified 'buffers'.
+    /// Return the error.
+    ntsa::Error privateDequeueReceiveBufferRaw(
+        const bsl::shared_ptr<StreamSocket>& self,
+        ntsa::ReceiveContext*                context,
+        const ntsa::MutableBufferArray&      buffers);
+
+    /// Process the specified 'error' and 'context' resulting from dequeuing
+    /// raw data from the socket receive buffer. Return the error.
+    ntsa::Error privateDequeueReceiveBufferRawResult(
+        const bsl::shared_ptr<StreamSocket>& self,
+        ntsa::ReceiveContext*                context,
+        const ntsa::Error&                   error);
+
     /// Rearm the interest in the writability of the socket in the reactor,
     /// if necessary.
     void privateRearmAfterSend(const bsl::shared_ptr<StreamSocket>& self);
@@ -1087,6 +1238,64 @@ class StreamSocket : public ntci::StreamSocket,
                         const ntci::ReceiveCallback& callback)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Dequeue received data according to the specified 'options' by
+    /// copying it into the memory referenced by the specified 'buffers',
+    /// then invoke the specified 'callback' with a null blob and an event
+    /// whose context describes the number of bytes received. If the
+    /// read queue is empty when the socket becomes readable, the data is
+    /// read directly from the socket receive buffer into 'buffers'. The
+    /// memory referenced by 'buffers' must remain valid until the 'callback'
+    /// is invoked. Return the error. Note that callbacks created by this
+    /// object will automatically be invoked on this object's strand unless
+    /// an explicit strand is specified at the time the callback is created.
+    ntsa::Error receive(const ntca::ReceiveOptions&     options,
+                        const ntsa::MutableBufferArray& buffers,
+                        const ntci::ReceiveFunction&    callback)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Dequeue received data according to the specified 'options' by
+    /// copying it into the memory referenced by the specified 'buffers',
+    /// then invoke the specified 'callback' with a null blob and an event
+    /// whose context describes the number of bytes received. If the
+    /// read queue is empty when the socket becomes readable, the data is
+    /// read directly from the socket receive buffer into 'buffers'. The
+    /// memory referenced by 'buffers' must remain valid until the 'callback'
+    /// is invoked. Return the error. Note that callbacks created by this
+    /// object will automatically be invoked on this object's strand unless
+    /// an explicit strand is specified at the time the callback is created.
+    ntsa::Error receive(const ntca::ReceiveOptions&     options,
+                        const ntsa::MutableBufferArray& buffers,
+                        const ntci::ReceiveCallback&    callback)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Dequeue up to the maximum number of messages defined by the specified
+    /// 'options' from the read queue and invoke the specified 'callback' once
+    /// with all of them, as soon as at least one message is available. The
+    /// total size of the messages in the batch is limited by the maximum size
+    /// defined by 'options', except that the first message is always
+    /// delivered. Each message is defined by the framer of the operation or of
+    /// this socket, or, when neither is defined, is all the data in the read
+    /// queue. Return the error. Note that callbacks created by this object
+    /// will automatically be invoked on this object's strand unless an
+    /// explicit strand is specified at the time the callback is created.
+    ntsa::Error receiveBatch(const ntca::ReceiveOptions&       options,
+                             const ntci::ReceiveBatchFunction& callback)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Dequeue up to the maximum number of messages defined by the specified
+    /// 'options' from the read queue and invoke the specified 'callback' once
+    /// with all of them, as soon as at least one message is available. The
+    /// total size of the messages in the batch is limited by the maximum size
+    /// defined by 'options', except that the first message is always
+    /// delivered. Each message is defined by the framer of the operation or of
+    /// this socket, or, when neither is defined, is all the data in the read
+    /// queue. Return the error. Note that callbacks created by this object
+    /// will automatically be invoked on this object's strand unless an
+    /// explicit strand is specified at the time the callback is created.
+    ntsa::Error receiveBatch(const ntca::ReceiveOptions&       options,
+                             const ntci::ReceiveBatchCallback& callback)
+        BSLS_KEYWORD_OVERRIDE;
+
     /// Register the specified 'resolver' for this socket. Return the error.
     ntsa::Error registerResolver(
         const bsl::shared_ptr<ntci::Resolver>& resolver) BSLS_KEYWORD_OVERRIDE;
@@ -1129,6 +1338,14 @@ class StreamSocket : public ntci::StreamSocket,
     /// to attempt a zero-copy send to the specified 'value'. Return the error.
     ntsa::Error setZeroCopyThreshold(bsl::size_t value) BSLS_KEYWORD_OVERRIDE;
 
+    /// Set the framer used to detect the boundaries of messages in the
+    /// incoming data when the options of a receive operation do not define
+    /// their own framer to the specified 'framer'. If 'framer' is null, the
+    /// incoming data is only framed according to the options of each receive
+    /// operation. Return the error.
+    ntsa::Error setReceiveFramer(const bsl::shared_ptr<ntci::ReceiveFramer>&
+                                     framer) BSLS_KEYWORD_OVERRIDE;
+
     /// Set the write rate limiter to the specified 'rateLimiter'. Return
     /// the error.
     ntsa::Error setWriteRateLimiter(const bsl::shared_ptr<ntci::RateLimiter>&
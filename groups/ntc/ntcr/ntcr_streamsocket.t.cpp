@@ -1157,19 +1157,26 @@ void StreamSocketManager::run()
             NTCCFG_TEST_EQ(d.type(), bdld::Datum::e_ARRAY);
             bdld::DatumArrayRef statsArray = d.theArray();
 
-            const int baseTxDelayBeforeSchedIndex = 90;
-            const int baseTxDelayInSoftwareIndex  = 95;
-            const int baseTxDelayIndex            = 100;
-            const int baseTxDelayBeforeAckIndex   = 105;
-            const int baseRxDelayInHardwareIndex  = 110;
-            const int baseRxDelayIndex            = 115;
+            const int baseTxDelayBeforeSchedIndex =
+                (*it)->getFieldOrdinal("txDelayBeforeScheduling.count");
+            const int baseTxDelayInSoftwareIndex =
+                (*it)->getFieldOrdinal("txDelayInSoftware.count");
+            const int baseTxDelayIndex =
+                (*it)->getFieldOrdinal("txDelay.count");
+            const int baseTxDelayBeforeAckIndex =
+                (*it)->getFieldOrdinal("txDelayBeforeAcknowledgement.count");
+            const int baseRxDelayInHardwareIndex =
+                (*it)->getFieldOrdinal("rxDelayInHardware.count");
+            const int baseRxDelayIndex =
+                (*it)->getFieldOrdinal("rxDelay.count");
 
             const int countOffset = 0;
             const int totalOffset = 1;
             const int minOffset   = 2;
             const int avgOffset   = 3;
             const int maxOffset   = 4;
-            const int total       = maxOffset + 1;
+            const int p999Offset  = 8;
+            const int total       = p999Offset + 1;
 
             /// due to multithreaded nature of the tests it's hard to predict
             /// the exact amount of TX timestamps received. The implementation
@@ -18,8 +18,69 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(ntcs_blobutil_cpp, "$Id$ $CSID$")
 
+#include <bsls_assert.h>
+#include <bsl_algorithm.h>
+
 namespace BloombergLP {
 namespace ntcs {
 
+void BlobUtil::append(bdlbb::Blob*                    destination,
+                      const ntsa::MutableBufferArray& source,
+                      bsl::size_t                     size)
+{
+    BSLS_ASSERT(size <= source.numBytes());
+
+    bsl::size_t numBytesRemaining = size;
+
+    for (bsl::size_t i = 0; i < source.numBuffers(); ++i) {
+        if (numBytesRemaining == 0) {
+            break;
+        }
+
+        const ntsa::MutableBuffer& buffer = source.buffer(i);
+
+        const bsl::size_t numBytesToAppend =
+            bsl::min(buffer.size(), numBytesRemaining);
+
+        bdlbb::BlobUtil::append(
+            destination,
+            static_cast<const char*>(buffer.data()),
+            NTCCFG_WARNING_NARROW(int, numBytesToAppend));
+
+        numBytesRemaining -= numBytesToAppend;
+    }
+}
+
+void BlobUtil::copy(const ntsa::MutableBufferArray& destination,
+                    const bdlbb::Blob&              source,
+                    bsl::size_t                     offset,
+                    bsl::size_t                     size)
+{
+    BSLS_ASSERT(size <= destination.numBytes());
+    BSLS_ASSERT(offset + size <= static_cast<bsl::size_t>(source.length()));
+
+    bsl::size_t position          = offset;
+    bsl::size_t numBytesRemaining = size;
+
+    for (bsl::size_t i = 0; i < destination.numBuffers(); ++i) {
+        if (numBytesRemaining == 0) {
+            break;
+        }
+
+        const ntsa::MutableBuffer& buffer = destination.buffer(i);
+
+        const bsl::size_t numBytesToCopy =
+            bsl::min(buffer.size(), numBytesRemaining);
+
+        bdlbb::BlobUtil::copy(static_cast<char*>(buffer.data()),
+                              source,
+                              NTCCFG_WARNING_NARROW(int, position),
+                              NTCCFG_WARNING_NARROW(int, numBytesToCopy));
+
+        position          += numBytesToCopy;
+        numBytesRemaining -= numBytesToCopy;
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
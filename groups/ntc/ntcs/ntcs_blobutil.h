@@ -21,6 +21,7 @@ BSLS_IDENT("$Id: $")
 
 #include <ntccfg_platform.h>
 #include <ntcscm_version.h>
+#include <ntsa_buffer.h>
 #include <ntsa_error.h>
 #include <bdlbb_blob.h>
 #include <bdlbb_blobutil.h>
@@ -107,6 +108,40 @@ struct BlobUtil {
                        const bsl::shared_ptr<bdlbb::Blob>& source,
                        bsl::size_t                         size);
 
+    /// Append the specified 'size' number of bytes starting at the specified
+    /// 'offset' in the specified 'source' blob to the specified 'destination'
+    /// blob.
+    static void append(bdlbb::Blob*                        destination,
+                       const bsl::shared_ptr<bdlbb::Blob>& source,
+                       bsl::size_t                         offset,
+                       bsl::size_t                         size);
+
+    /// Append the specified 'size' number of bytes starting at the specified
+    /// 'offset' in the specified 'source' blob to the specified 'destination'
+    /// blob.
+    static void append(const bsl::shared_ptr<bdlbb::Blob>& destination,
+                       const bsl::shared_ptr<bdlbb::Blob>& source,
+                       bsl::size_t                         offset,
+                       bsl::size_t                         size);
+
+    /// Append the specified 'size' number of bytes from the start of the
+    /// memory referenced by the specified 'source' buffers to the specified
+    /// 'destination' blob. The behavior is undefined unless 'size' is less
+    /// than or equal to 'source.numBytes()'.
+    static void append(bdlbb::Blob*                    destination,
+                       const ntsa::MutableBufferArray& source,
+                       bsl::size_t                     size);
+
+    /// Copy the specified 'size' number of bytes starting at the specified
+    /// 'offset' in the specified 'source' blob into the memory referenced by
+    /// the specified 'destination' buffers, in order. The behavior is
+    /// undefined unless 'size' is less than or equal to
+    /// 'destination.numBytes()'.
+    static void copy(const ntsa::MutableBufferArray& destination,
+                     const bdlbb::Blob&              source,
+                     bsl::size_t                     offset,
+                     bsl::size_t                     size);
+
     /// Pop the specified 'size' number of bytes from the specified 'blob'.
     static void pop(bdlbb::Blob* blob, bsl::size_t size);
 
@@ -217,6 +252,30 @@ void BlobUtil::append(const bsl::shared_ptr<bdlbb::Blob>& destination,
                             NTCCFG_WARNING_NARROW(int, size));
 }
 
+NTCCFG_INLINE
+void BlobUtil::append(bdlbb::Blob*                        destination,
+                      const bsl::shared_ptr<bdlbb::Blob>& source,
+                      bsl::size_t                         offset,
+                      bsl::size_t                         size)
+{
+    bdlbb::BlobUtil::append(destination,
+                            *source,
+                            NTCCFG_WARNING_NARROW(int, offset),
+                            NTCCFG_WARNING_NARROW(int, size));
+}
+
+NTCCFG_INLINE
+void BlobUtil::append(const bsl::shared_ptr<bdlbb::Blob>& destination,
+                      const bsl::shared_ptr<bdlbb::Blob>& source,
+                      bsl::size_t                         offset,
+                      bsl::size_t                         size)
+{
+    bdlbb::BlobUtil::append(destination.get(),
+                            *source,
+                            NTCCFG_WARNING_NARROW(int, offset),
+                            NTCCFG_WARNING_NARROW(int, size));
+}
+
 NTCCFG_INLINE
 void BlobUtil::pop(bdlbb::Blob* blob, bsl::size_t size)
 {
@@ -20,8 +20,14 @@ BSLS_IDENT_RCSID(ntcs_chronology_cpp, "$Id$ $CSID$")
 
 #include <ntca_timerevent.h>
 #include <ntccfg_bind.h>
+#include <ntccfg_tracepoint.h>
 #include <ntci_log.h>
+#include <ntcs_chronologymetrics.h>
 #include <ntcs_dispatch.h>
+#include <ntcs_flightrecorder.h>
+#include <ntcs_proactormetrics.h>
+#include <ntcs_reactormetrics.h>
+#include <ntcs_watchdog.h>
 #include <ntsa_error.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_datetime.h>
@@ -31,6 +37,7 @@ BSLS_IDENT_RCSID(ntcs_chronology_cpp, "$Id$ $CSID$")
 #include <bslmt_lockguard.h>
 #include <bsls_assert.h>
 #include <bsls_log.h>
+#include <bsls_timeutil.h>
 #include <bsl_limits.h>
 #include <bsl_utility.h>
 
@@ -72,6 +79,64 @@ BSLS_IDENT_RCSID(ntcs_chronology_cpp, "$Id$ $CSID$")
 namespace BloombergLP {
 namespace ntcs {
 
+namespace {
+
+/// Log to the specified 'metrics' the delay since the specified
+/// 'functorsDueTime', in nanoseconds since an arbitrary epoch, at which the
+/// oldest of a batch of deferred functions was deferred. Note that the
+/// 'functorsDueTime' is zero if the functions were deferred while the
+/// metrics were disabled, in which case nothing is logged.
+void logDeferDelay(ntcs::ChronologyMetrics* metrics,
+                   bsls::Types::Int64       functorsDueTime)
+{
+    if (functorsDueTime != 0) {
+        bsls::TimeInterval delay;
+        delay.setTotalNanoseconds(bsls::TimeUtil::getTimer() -
+                                  functorsDueTime);
+        if (delay < bsls::TimeInterval()) {
+            delay = bsls::TimeInterval();
+        }
+
+        metrics->logDeferDelay(delay);
+    }
+}
+
+/// Log the specified 'lag' of the event loop driven by the calling thread
+/// to the metrics of the reactor or proactor driven by the calling thread,
+/// if any.
+void logTimerLag(const bsls::TimeInterval& lag)
+{
+    ntci::ReactorMetrics* reactorMetrics =
+        ntcs::ReactorMetrics::getThreadLocal();
+    if (reactorMetrics) {
+        reactorMetrics->logTimerLag(lag);
+    }
+    else {
+        ntci::ProactorMetrics* proactorMetrics =
+            ntcs::ProactorMetrics::getThreadLocal();
+        if (proactorMetrics) {
+            proactorMetrics->logTimerLag(lag);
+        }
+    }
+}
+
+/// Report that the callback to process the specified 'operation' stalled
+/// the calling thread if the time elapsed since the specified 'startTime',
+/// in nanoseconds since an arbitrary epoch, exceeds the stall threshold.
+void checkStall(const char* operation, bsls::Types::Int64 startTime)
+{
+    bsls::TimeInterval duration;
+    duration.setTotalNanoseconds(bsls::TimeUtil::getTimer() - startTime);
+
+    if (NTCCFG_UNLIKELY(ntcs::Watchdog::isStalled(duration))) {
+        ntcs::Watchdog::reportStall(operation,
+                                    ntsa::k_INVALID_HANDLE,
+                                    duration);
+    }
+}
+
+}  // close unnamed namespace
+
 NTCCFG_INLINE_NEVER
 void Chronology::Timer::autoClose(
     const bsl::shared_ptr<ntci::Timer>&        timer,
@@ -808,6 +873,33 @@ Chronology::TimerNode* Chronology::privateNodeAllocate()
     return node;
 }
 
+void Chronology::privateFunctorExecute(FunctorQueue* functorsDue)
+{
+    if (NTCCFG_UNLIKELY(ntcs::Watchdog::isEnabled())) {
+        const bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+        functorsDue->execute();
+        checkStall("deferred functions", startTime);
+    }
+    else {
+        functorsDue->execute();
+    }
+
+    if (functorsDue == &d_functorQueueExecuted) {
+        // Leave the nodes used by the deferred functors aside to be
+        // returned to the queue the next time the mutex is locked, rather
+        // than locking the mutex again just to return them now.
+
+        d_functorQueueExecuting = false;
+    }
+    else {
+        // Another thread was executing deferred functors when these were
+        // popped, so return their nodes to the queue directly.
+
+        LockGuard lock(&d_mutex);
+        d_functorQueue.reclaim(functorsDue);
+    }
+}
+
 bsl::string Chronology::convertToDateTime(Microseconds timeInMicroseconds)
 {
     bsls::TimeInterval timeInterval;
@@ -842,6 +934,9 @@ Chronology::Chronology(ntcs::Driver* driver, bslma::Allocator* basicAllocator)
 , d_functorQueueAllocator_p(&d_functorQueuePool)
 , d_functorQueue(d_functorQueueAllocator_p)
 , d_functorQueueEmpty(true)
+, d_functorQueueTime(0)
+, d_functorQueueExecuted(d_functorQueueAllocator_p)
+, d_functorQueueExecuting(false)
 {
 }
 
@@ -864,6 +959,9 @@ Chronology::Chronology(const bsl::shared_ptr<ntcs::Driver>& driver,
 , d_functorQueueAllocator_p(&d_functorQueuePool)
 , d_functorQueue(d_functorQueueAllocator_p)
 , d_functorQueueEmpty(true)
+, d_functorQueueTime(0)
+, d_functorQueueExecuted(d_functorQueueAllocator_p)
+, d_functorQueueExecuting(false)
 {
 }
 
@@ -884,8 +982,9 @@ void Chronology::clear()
     {
         LockGuard lock(&d_mutex);
 
-        d_functorQueue.swap(functorQueue);
+        functorQueue.splice(&d_functorQueue);
         d_functorQueueEmpty = true;
+        d_functorQueueTime  = 0;
 
         if (!d_deadlineMap.isEmpty()) {
             DeadlineMap::Pair* p = d_deadlineMap.front();
@@ -917,8 +1016,9 @@ void Chronology::clearFunctions()
     {
         LockGuard lock(&d_mutex);
 
-        d_functorQueue.swap(functorQueue);
+        functorQueue.splice(&d_functorQueue);
         d_functorQueueEmpty = true;
+        d_functorQueueTime  = 0;
     }
 
     functorQueue.clear();
@@ -1041,18 +1141,33 @@ void Chronology::announce()
 
     bsls::TimeInterval now;
 
-    bdlb::NullableValue<FunctorQueue> functorsDue(d_functorQueueAllocator_p);
+    FunctorQueue       functorsDeferred(d_functorQueueAllocator_p);
+    FunctorQueue*      functorsDue     = &functorsDeferred;
+    bsls::Types::Int64 functorsDueTime = 0;
+
+    // The deadline map pool is not thread safe and is only accessed while
+    // the mutex is locked, but the memory for due timers is released after
+    // the mutex is unlocked, so supply it from the general allocator.
 
-    bdlma::LocalSequentialAllocator<256> timersDueAllocator(
-        d_deadlineMapAllocator_p);
+    bdlma::LocalSequentialAllocator<256> timersDueAllocator(d_allocator_p);
     DueVector timersDue(&timersDueAllocator);
 
     {
         LockGuard lock(&d_mutex);
 
+        this->privateFunctorReclaim();
+
         if (NTCCFG_UNLIKELY(!d_functorQueue.empty())) {
-            functorsDue.makeValue().swap(d_functorQueue);
+            if (!d_functorQueueExecuting) {
+                d_functorQueueExecuting = true;
+                functorsDue             = &d_functorQueueExecuted;
+            }
+
+            functorsDue->splice(&d_functorQueue);
             d_functorQueueEmpty = true;
+
+            functorsDueTime    = d_functorQueueTime;
+            d_functorQueueTime = 0;
         }
 
         if (!d_deadlineMap.isEmpty()) {
@@ -1144,21 +1259,20 @@ void Chronology::announce()
         }
     }
 
-    if (!functorsDue.isNull()) {
-        FunctorQueue::iterator it = functorsDue.value().begin();
-        FunctorQueue::iterator et = functorsDue.value().end();
+    ntcs::ChronologyMetrics* metrics = ntcs::ChronologyMetrics::getEnabled();
 
-        while (it != et) {
-            Functor& functor = *it;
-            functor();
-            functor = Functor();
-            ++it;
+    if (!functorsDue->empty()) {
+        if (NTCCFG_UNLIKELY(metrics)) {
+            ntcs::logDeferDelay(metrics, functorsDueTime);
         }
 
-        functorsDue.value().clear();
+        this->privateFunctorExecute(functorsDue);
     }
 
     if (!timersDue.empty()) {
+        const bool         watched        = ntcs::Watchdog::isEnabled();
+        bsls::Types::Int64 timerStartTime = 0;
+
         DueVector::iterator it = timersDue.begin();
         DueVector::iterator et = timersDue.end();
 
@@ -1168,12 +1282,48 @@ void Chronology::announce()
             TimerRep* timerRep = dueEntry.d_node_p->d_storage.address();
             Timer*    timer    = timerRep->getObject();
 
+            // Compute the lateness of the timer once and share it with each
+            // observer of the timer firing. Note that the current time has
+            // already been read, so this requires no additional reads of the
+            // clock.
+
+            bsls::TimeInterval lateness = now - dueEntry.d_deadline;
+            if (lateness < bsls::TimeInterval()) {
+                lateness = bsls::TimeInterval();
+            }
+
+            // Due timers are popped in deadline order, so the lag of the
+            // event loop is the lateness of the first due timer.
+
+            if (it == timersDue.begin()) {
+                ntcs::logTimerLag(lateness);
+            }
+
+            NTCS_FLIGHTRECORDER_TIMER(lateness);
+
+            NTCCFG_TRACEPOINT3(timer_fire,
+                               timer,
+                               lateness.totalNanoseconds(),
+                               dueEntry.d_recurring);
+
+            if (NTCCFG_UNLIKELY(metrics)) {
+                metrics->logTimerLateness(lateness, dueEntry.d_recurring);
+            }
+
+            if (NTCCFG_UNLIKELY(watched)) {
+                timerStartTime = bsls::TimeUtil::getTimer();
+            }
+
             timer->arrive(bsl::shared_ptr<ntci::Timer>(
                               static_cast<ntci::Timer*>(timer),
                               static_cast<bslma::SharedPtrRep*>(timerRep)),
                           now,
                           dueEntry.d_deadline);
 
+            if (NTCCFG_UNLIKELY(watched)) {
+                checkStall("timer", timerStartTime);
+            }
+
             ++it;
         }
 
@@ -1183,27 +1333,37 @@ void Chronology::announce()
 
 void Chronology::drain()
 {
-    bdlb::NullableValue<FunctorQueue> functorsDue(d_functorQueueAllocator_p);
+    FunctorQueue       functorsDeferred(d_functorQueueAllocator_p);
+    FunctorQueue*      functorsDue     = &functorsDeferred;
+    bsls::Types::Int64 functorsDueTime = 0;
 
     {
         LockGuard lock(&d_mutex);
 
+        this->privateFunctorReclaim();
+
         if (!d_functorQueue.empty()) {
-            functorsDue.makeValue().swap(d_functorQueue);
+            if (!d_functorQueueExecuting) {
+                d_functorQueueExecuting = true;
+                functorsDue             = &d_functorQueueExecuted;
+            }
+
+            functorsDue->splice(&d_functorQueue);
             d_functorQueueEmpty = true;
+
+            functorsDueTime    = d_functorQueueTime;
+            d_functorQueueTime = 0;
         }
     }
 
-    if (!functorsDue.isNull()) {
-        FunctorQueue::iterator it = functorsDue.value().begin();
-        FunctorQueue::iterator et = functorsDue.value().end();
-
-        while (it != et) {
-            Functor& functor = *it;
-            functor();
-            functor = Functor();
-            ++it;
+    if (!functorsDue->empty()) {
+        ntcs::ChronologyMetrics* metrics =
+            ntcs::ChronologyMetrics::getEnabled();
+        if (NTCCFG_UNLIKELY(metrics)) {
+            ntcs::logDeferDelay(metrics, functorsDueTime);
         }
+
+        this->privateFunctorExecute(functorsDue);
     }
 }
 
@@ -20,23 +20,28 @@
 BSLS_IDENT("$Id: $")
 
 #include <ntca_timeroptions.h>
+#include <ntccfg_inplacefunction.h>
 #include <ntccfg_platform.h>
 #include <ntci_executor.h>
 #include <ntci_mutex.h>
 #include <ntci_timer.h>
 #include <ntci_timercallback.h>
 #include <ntci_timersession.h>
+#include <ntcs_chronologymetrics.h>
 #include <ntcs_driver.h>
 #include <ntcs_skiplist.h>
 #include <ntcscm_version.h>
 #include <bdlb_nullablevalue.h>
 #include <bdlma_concurrentmultipoolallocator.h>
+#include <bdlma_multipoolallocator.h>
 #include <bdlma_pool.h>
 #include <bslmt_lockguard.h>
 #include <bslmt_mutex.h>
 #include <bsls_atomic.h>
 #include <bsls_spinlock.h>
 #include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
 #include <bsl_functional.h>
 #include <bsl_map.h>
 #include <bsl_memory.h>
@@ -48,10 +53,6 @@ BSLS_IDENT("$Id: $")
 // red/black tree.
 #define NTCS_CHRONOLOGY_USE_TIMER_MAP_UNORDERED 0
 
-// Define and set to 1 to use a contiguous vector for the function queue.
-// Undefine or set to 0 to use a linked list.
-#define NTCS_CHRONOLOGY_USE_FUNCTOR_QUEUE_VECTOR 1
-
 // Define and set to 1 to use a custom mutex implementation that directly
 // makes futex system calls on Linux, and devolves to 'bslmt::Mutex' on
 // other platforms. Undefine or set to 0 to use 'bslmt::Mutex'.
@@ -134,13 +135,11 @@ class Chronology
     /// This typedef defines a functor.
     typedef ntci::Executor::Functor Functor;
 
-#if NTCS_CHRONOLOGY_USE_FUNCTOR_QUEUE_VECTOR
-    /// This typedef defines a sequence of functors.
-    typedef bsl::vector<Functor> FunctorQueue;
-#else
-    typedef ntci::Executor::FunctorSequence FunctorQueue;
-    // This typedef defines a sequence of functors.
-#endif
+    /// This typedef defines a sequence of functors. Functors whose
+    /// targets fit in the inline buffer of an 'ntccfg::InplaceFunction' are
+    /// deferred without allocating memory once the queue has reached its
+    /// steady-state depth.
+    typedef ntccfg::InplaceFunctionQueue FunctorQueue;
 
     /// Provide an implementation of the 'ntci::Timer' interface
     /// using an 'ntcs::Chronology' object.
@@ -422,7 +421,7 @@ class Chronology
     bsl::vector<TimerNode*>             d_nodeArray;
     TimerNode*                          d_nodeFree_p;
     bsl::size_t                         d_nodeCount;
-    bdlma::ConcurrentMultipoolAllocator d_deadlineMapPool;
+    bdlma::MultipoolAllocator           d_deadlineMapPool;
     bslma::Allocator*                   d_deadlineMapAllocator_p;
     DeadlineMap                         d_deadlineMap;
     bsls::AtomicBool                    d_deadlineMapEmpty;
@@ -431,6 +430,9 @@ class Chronology
     bslma::Allocator*                   d_functorQueueAllocator_p;
     FunctorQueue                        d_functorQueue;
     bsls::AtomicBool                    d_functorQueueEmpty;
+    bsls::Types::Int64                  d_functorQueueTime;
+    FunctorQueue                        d_functorQueueExecuted;
+    bsls::AtomicBool                    d_functorQueueExecuting;
 
   private:
     Chronology(const Chronology&) BSLS_KEYWORD_DELETED;
@@ -444,6 +446,20 @@ class Chronology
     /// 'd_mutex' is locked.
     TimerNode* privateNodeAllocate();
 
+    /// Return the nodes used by the last batch of deferred functions
+    /// executed from 'd_functorQueueExecuted' to 'd_functorQueue', so they
+    /// are re-used by subsequent calls to 'defer', unless that batch is
+    /// still executing. The behavior is undefined unless 'd_mutex' is
+    /// locked.
+    void privateFunctorReclaim();
+
+    /// Execute the specified 'functorsDue' then arrange for the nodes they
+    /// used to be returned to 'd_functorQueue'. The behavior is undefined
+    /// unless 'd_mutex' is not locked and 'functorsDue' is either
+    /// 'd_functorQueueExecuted', claimed by the calling thread, or a queue
+    /// local to the calling thread.
+    void privateFunctorExecute(FunctorQueue* functorsDue);
+
     /// Return the description of the specified 'timeInMicroseconds' from
     /// the Unix epoch in a date/time format.
     static bsl::string convertToDateTime(Microseconds timeInMicroseconds);
@@ -519,6 +535,12 @@ class Chronology
     /// Push the specified 'functor' on the queue.
     void defer(const ntci::Executor::Functor& functor);
 
+    /// Push the specified 'functor' on the queue. Note that 'functor' is
+    /// copied directly into the storage of the queue, inline if it fits,
+    /// rather than first into an 'ntci::Executor::Functor'.
+    template <typename FUNCTION>
+    void defer(const FUNCTION& functor);
+
     /// Atomically push the specified 'functorSequence' immediately followed
     /// by the specified 'functor', then clear the 'functorSequence'.
     void defer(ntci::Executor::FunctorSequence* functorSequence,
@@ -572,43 +594,71 @@ class Chronology
 };
 
 NTCCFG_INLINE
-void Chronology::defer(const ntci::Executor::Functor& functor)
+void Chronology::privateFunctorReclaim()
+{
+    if (!d_functorQueueExecuting &&
+        d_functorQueueExecuted.numAvailable() != 0)
+    {
+        d_functorQueue.reclaim(&d_functorQueueExecuted);
+    }
+}
+
+template <typename FUNCTION>
+NTCCFG_INLINE void Chronology::defer(const FUNCTION& functor)
 {
     LockGuard lock(&d_mutex);
 
+    this->privateFunctorReclaim();
+
     bool wasEmpty = d_functorQueue.empty();
-    d_functorQueue.push_back(functor);
+    d_functorQueue.push(functor);
 
     if (wasEmpty) {
         d_functorQueueEmpty = false;
+
+        if (NTCCFG_UNLIKELY(ntcs::ChronologyMetrics::getEnabled())) {
+            d_functorQueueTime = bsls::TimeUtil::getTimer();
+        }
     }
 }
 
+NTCCFG_INLINE
+void Chronology::defer(const ntci::Executor::Functor& functor)
+{
+    this->defer<ntci::Executor::Functor>(functor);
+}
+
 NTCCFG_INLINE
 void Chronology::defer(ntci::Executor::FunctorSequence* functorSequence,
                        const ntci::Executor::Functor&   functor)
 {
     LockGuard lock(&d_mutex);
 
-#if NTCS_CHRONOLOGY_USE_FUNCTOR_QUEUE_VECTOR
+    this->privateFunctorReclaim();
 
-    d_functorQueue.insert(d_functorQueue.end(),
-                          functorSequence->begin(),
-                          functorSequence->end());
-    if (functor) {
-        d_functorQueue.push_back(functor);
+    bool wasEmpty = d_functorQueue.empty();
+
+    for (ntci::Executor::FunctorSequence::iterator it =
+             functorSequence->begin();
+         it != functorSequence->end();
+         ++it)
+    {
+        d_functorQueue.adopt(&*it);
     }
-    d_functorQueueEmpty = d_functorQueue.empty();
 
-#else
+    functorSequence->clear();
 
-    d_functorQueue.splice(d_functorQueue.end(), *functorSequence);
     if (functor) {
-        d_functorQueue.push_back(functor);
+        d_functorQueue.push(functor);
     }
+
     d_functorQueueEmpty = d_functorQueue.empty();
 
-#endif
+    if (wasEmpty && !d_functorQueueEmpty) {
+        if (NTCCFG_UNLIKELY(ntcs::ChronologyMetrics::getEnabled())) {
+            d_functorQueueTime = bsls::TimeUtil::getTimer();
+        }
+    }
 }
 
 NTCCFG_INLINE
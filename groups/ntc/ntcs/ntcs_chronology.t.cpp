@@ -3159,6 +3159,62 @@ NTCCFG_TEST_CASE(36)
     }
 }
 
+NTCCFG_TEST_CASE(37)
+{
+    // Concern: Deferring functions whose targets fit in the inline buffer
+    // of an 'ntccfg::InplaceFunction' does not allocate memory once the
+    // chronology has reached its steady-state number of deferred functions.
+
+    ntccfg::TestAllocator ta;
+    {
+        NTCI_LOG_CONTEXT();
+
+        const int k_NUM_DEFERRED = 64;
+        const int k_NUM_ROUNDS   = 100;
+
+        bslma::TestAllocator chronologyAllocator;
+
+        bsl::shared_ptr<test::DriverMock> driver;
+        driver.createInplace(&ta);
+
+        bsl::shared_ptr<ntcs::Chronology> chronology;
+        chronology.createInplace(&ta, driver, &chronologyAllocator);
+
+        int                           callCounter = 0;
+        const ntci::Executor::Functor f =
+            NTCCFG_BIND(&test::TestSuite::incrementCallback,
+                        bsl::ref(callCounter));
+
+        bsls::Types::Int64 numAllocationsAfterWarmup = 0;
+
+        for (int round = 0; round < k_NUM_ROUNDS; ++round) {
+            for (int i = 0; i < k_NUM_DEFERRED; ++i) {
+                chronology->defer(f);
+            }
+
+            NTCCFG_TEST_EQ(chronology->numDeferred(), k_NUM_DEFERRED);
+
+            chronology->announce();
+
+            NTCCFG_TEST_EQ(chronology->numDeferred(), 0);
+
+            if (round == 0) {
+                numAllocationsAfterWarmup =
+                    chronologyAllocator.numAllocations();
+            }
+            else {
+                NTCCFG_TEST_EQ(chronologyAllocator.numAllocations(),
+                               numAllocationsAfterWarmup);
+            }
+        }
+
+        NTCCFG_TEST_EQ(callCounter, k_NUM_DEFERRED * k_NUM_ROUNDS);
+
+        chronology->clear();
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
@@ -3199,5 +3255,6 @@ NTCCFG_TEST_DRIVER
     NTCCFG_TEST_REGISTER(34);
     NTCCFG_TEST_REGISTER(35);
     NTCCFG_TEST_REGISTER(36);
+    NTCCFG_TEST_REGISTER(37);
 }
 NTCCFG_TEST_DRIVER_END;
@@ -0,0 +1,200 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_chronologymetrics.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntcs_chronologymetrics_cpp, "$Id$ $CSID$")
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslmt_once.h>
+#include <bsls_assert.h>
+#include <bsl_cstring.h>
+#include <bsl_new.h>
+
+namespace BloombergLP {
+namespace ntcs {
+
+namespace {
+
+/// The process-wide metrics, which are never destroyed so that they may be
+/// updated by chronologies during process exit.
+bsl::shared_ptr<ntcs::ChronologyMetrics>* s_global_p;
+
+}  // close unnamed namespace
+
+const ntci::MetricMetadata ChronologyMetrics::STATISTICS[] = {
+    NTCI_METRIC_METADATA_HISTOGRAM(oneShotTimerLateness),
+    NTCI_METRIC_METADATA_HISTOGRAM(recurringTimerLateness),
+    NTCI_METRIC_METADATA_HISTOGRAM(deferDelay)
+};
+
+bsls::AtomicPointer<ChronologyMetrics> ChronologyMetrics::s_enabled_p;
+
+ChronologyMetrics::ChronologyMetrics(const bslstl::StringRef& prefix,
+                                     const bslstl::StringRef& objectName,
+                                     bslma::Allocator*        basicAllocator)
+: d_oneShotTimerLateness(1.0, basicAllocator)
+, d_recurringTimerLateness(1.0, basicAllocator)
+, d_deferDelay(1.0, basicAllocator)
+, d_prefix(prefix, basicAllocator)
+, d_objectName(objectName, basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+ChronologyMetrics::~ChronologyMetrics()
+{
+}
+
+void ChronologyMetrics::logTimerLateness(const bsls::TimeInterval& lateness,
+                                         bool                      recurring)
+{
+    const double value = static_cast<double>(lateness.totalMicroseconds());
+
+    if (recurring) {
+        d_recurringTimerLateness.update(value);
+    }
+    else {
+        d_oneShotTimerLateness.update(value);
+    }
+}
+
+void ChronologyMetrics::logDeferDelay(const bsls::TimeInterval& delay)
+{
+    d_deferDelay.update(static_cast<double>(delay.totalMicroseconds()));
+}
+
+void ChronologyMetrics::getStats(bdld::ManagedDatum* result)
+{
+    bdld::DatumMutableArrayRef array;
+    bdld::Datum::createUninitializedArray(&array,
+                                          numOrdinals(),
+                                          result->allocator());
+
+    bsl::size_t index = 0;
+
+    d_oneShotTimerLateness.collectHistogram(&array, &index);
+
+    d_recurringTimerLateness.collectHistogram(&array, &index);
+
+    d_deferDelay.collectHistogram(&array, &index);
+
+    *array.length() = numOrdinals();
+
+    result->adopt(bdld::Datum::adoptArray(array));
+}
+
+const char* ChronologyMetrics::getFieldPrefix(int ordinal) const
+{
+    NTCCFG_WARNING_UNUSED(ordinal);
+
+    return d_prefix.c_str();
+}
+
+const char* ChronologyMetrics::getFieldName(int ordinal) const
+{
+    if (ordinal < numOrdinals()) {
+        return ChronologyMetrics::STATISTICS[ordinal].d_name;
+    }
+    else {
+        return 0;
+    }
+}
+
+const char* ChronologyMetrics::getFieldDescription(int ordinal) const
+{
+    NTCCFG_WARNING_UNUSED(ordinal);
+
+    return "";
+}
+
+ntci::Monitorable::StatisticType ChronologyMetrics::getFieldType(
+    int ordinal) const
+{
+    if (ordinal < numOrdinals()) {
+        return ChronologyMetrics::STATISTICS[ordinal].d_type;
+    }
+    else {
+        return ntci::Monitorable::e_AVERAGE;
+    }
+}
+
+int ChronologyMetrics::getFieldTags(int ordinal) const
+{
+    NTCCFG_WARNING_UNUSED(ordinal);
+
+    return ntci::Monitorable::e_ANONYMOUS;
+}
+
+int ChronologyMetrics::getFieldOrdinal(const char* fieldName) const
+{
+    int result = 0;
+
+    for (int ordinal = 0; ordinal < numOrdinals(); ++ordinal) {
+        if (bsl::strcmp(ChronologyMetrics::STATISTICS[ordinal].d_name,
+                        fieldName) == 0)
+        {
+            result = ordinal;
+        }
+    }
+
+    return result;
+}
+
+int ChronologyMetrics::numOrdinals() const
+{
+    return sizeof ChronologyMetrics::STATISTICS /
+           sizeof ChronologyMetrics::STATISTICS[0];
+}
+
+const char* ChronologyMetrics::objectName() const
+{
+    return d_objectName.c_str();
+}
+
+bsl::shared_ptr<ntcs::ChronologyMetrics> ChronologyMetrics::global()
+{
+    // We use a new delete allocator instead of the global allocator here
+    // because the process-wide metrics are intentionally never freed.
+
+    BSLMT_ONCE_DO
+    {
+        bslma::Allocator* allocator = &bslma::NewDeleteAllocator::singleton();
+
+        bsl::shared_ptr<ntcs::ChronologyMetrics> metrics;
+        metrics.createInplace(allocator, "chronology", "global", allocator);
+
+        s_global_p = new (*allocator)
+            bsl::shared_ptr<ntcs::ChronologyMetrics>(metrics);
+    }
+
+    return *s_global_p;
+}
+
+void ChronologyMetrics::enable()
+{
+    s_enabled_p.storeRelease(ChronologyMetrics::global().get());
+}
+
+void ChronologyMetrics::disable()
+{
+    s_enabled_p.storeRelease(0);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
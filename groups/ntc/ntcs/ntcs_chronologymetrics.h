@@ -0,0 +1,167 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCS_CHRONOLOGYMETRICS
+#define INCLUDED_NTCS_CHRONOLOGYMETRICS
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntccfg_platform.h>
+#include <ntci_metric.h>
+#include <ntci_monitorable.h>
+#include <ntcscm_version.h>
+#include <bsls_atomic.h>
+#include <bsls_timeinterval.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+
+namespace BloombergLP {
+namespace ntcs {
+
+/// @internal @brief
+/// Provide metrics for the scheduling delay of timers and deferred functions.
+///
+/// @details
+/// This class measures the lateness of each timer, that is, the time elapsed
+/// between the deadline of the timer and the moment the timer is announced,
+/// separately for one-shot and recurring timers, and the queueing delay of
+/// deferred functions, that is, the time elapsed between the moment a
+/// function is deferred onto an empty queue and the moment the queue is
+/// executed. Note that the queueing delay is sampled once per batch of
+/// deferred functions executed together, and measures the delay of the
+/// oldest function in the batch: functions deferred onto a non-empty queue
+/// wait no longer than the oldest, so each sample is the worst delay of its
+/// batch, and the number of samples counts batches rather than functions.
+/// All measurements are recorded in microseconds into histograms
+/// whose percentiles describe how long work waits for a thread, which guides
+/// the sizing of thread pools.
+///
+/// A single, process-wide instance is updated by every chronology while it
+/// is enabled. Chronologies perform no additional work while it is
+/// disabled, which is the default.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntcs
+class ChronologyMetrics : public ntci::Monitorable,
+                          public ntccfg::Shared<ChronologyMetrics>
+{
+    ntci::MetricHistogram d_oneShotTimerLateness;
+    ntci::MetricHistogram d_recurringTimerLateness;
+    ntci::MetricHistogram d_deferDelay;
+    bsl::string           d_prefix;
+    bsl::string           d_objectName;
+    bslma::Allocator*     d_allocator_p;
+
+    static const struct ntci::MetricMetadata STATISTICS[];
+
+    static bsls::AtomicPointer<ChronologyMetrics> s_enabled_p;
+
+  private:
+    ChronologyMetrics(const ChronologyMetrics&) BSLS_KEYWORD_DELETED;
+    ChronologyMetrics& operator=(const ChronologyMetrics&)
+        BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create new metrics for the specified 'objectName' whose field names
+    /// have the specified 'prefix'. Optionally specify a 'basicAllocator'
+    /// used to supply memory. If 'basicAllocator' is 0, the currently
+    /// installed default allocator is used.
+    ChronologyMetrics(const bslstl::StringRef& prefix,
+                      const bslstl::StringRef& objectName,
+                      bslma::Allocator*        basicAllocator = 0);
+
+    /// Destroy this object.
+    ~ChronologyMetrics() BSLS_KEYWORD_OVERRIDE;
+
+    /// Log the announcement of a timer the specified 'lateness' after its
+    /// deadline. The specified 'recurring' flag indicates whether the timer
+    /// is recurring or one-shot.
+    void logTimerLateness(const bsls::TimeInterval& lateness, bool recurring);
+
+    /// Log the execution of a batch of deferred functions the specified
+    /// 'delay' after the oldest function in the batch was deferred. Note
+    /// that this function is called once per batch, not once per function.
+    void logDeferDelay(const bsls::TimeInterval& delay);
+
+    /// Load into the specified 'result' the array of statistics for this
+    /// object. Note that 'result->theArray().length()' is expected to have
+    /// the same value each time this function returns.
+    void getStats(bdld::ManagedDatum* result) BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the prefix corresponding to the field at the specified
+    /// 'ordinal' position, or 0 if no field at the 'ordinal' position
+    /// exists.
+    const char* getFieldPrefix(int ordinal) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the field name corresponding to the field at the specified
+    /// 'ordinal' position, or 0 if no field at the 'ordinal' position
+    /// exists.
+    const char* getFieldName(int ordinal) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the field description corresponding to the field at the
+    /// specified 'ordinal' position, or 0 if no field at the 'ordinal'
+    /// position exists.
+    const char* getFieldDescription(int ordinal) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the type of the statistic at the specified 'ordinal'
+    /// position, or e_AVERAGE if no field at the 'ordinal' position exists
+    /// or the type is unknown.
+    ntci::Monitorable::StatisticType getFieldType(int ordinal) const
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the flags that indicate which indexes to apply to the
+    /// statistics measured by this monitorable object.
+    int getFieldTags(int ordinal) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the ordinal of the specified 'fieldName', or a negative value
+    /// if no field identified by 'fieldName' exists.
+    int getFieldOrdinal(const char* fieldName) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the maximum number of elements in a datum resulting from
+    /// a call to 'getStats()'.
+    int numOrdinals() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the human-readable name of the monitorable object, or 0 or
+    /// the empty string if no such human-readable name has been assigned to
+    /// the monitorable object.
+    const char* objectName() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the process-wide metrics updated by every chronology. Note
+    /// that the process-wide metrics are never destroyed.
+    static bsl::shared_ptr<ntcs::ChronologyMetrics> global();
+
+    /// Begin updating the process-wide metrics from every chronology.
+    static void enable();
+
+    /// Stop updating the process-wide metrics from every chronology.
+    static void disable();
+
+    /// Return the process-wide metrics if they are enabled, otherwise return
+    /// 0.
+    static ntcs::ChronologyMetrics* getEnabled();
+};
+
+NTCCFG_INLINE
+ntcs::ChronologyMetrics* ChronologyMetrics::getEnabled()
+{
+    return s_enabled_p.loadAcquire();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
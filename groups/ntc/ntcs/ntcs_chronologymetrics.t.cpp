@@ -0,0 +1,135 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_chronologymetrics.h>
+
+#include <ntccfg_test.h>
+
+#include <bdld_datum.h>
+#include <bdld_manageddatum.h>
+#include <bsls_timeinterval.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+//
+//-----------------------------------------------------------------------------
+
+// [ 1]
+// [ 2]
+//-----------------------------------------------------------------------------
+// [ 1]
+// [ 2]
+//-----------------------------------------------------------------------------
+
+namespace test {
+
+/// The number of fields describing each histogram.
+const int k_HISTOGRAM_FIELDS = 9;
+
+/// The ordinal of the first field of each histogram.
+const int k_ONE_SHOT_TIMER_LATENESS   = 0 * k_HISTOGRAM_FIELDS;
+const int k_RECURRING_TIMER_LATENESS  = 1 * k_HISTOGRAM_FIELDS;
+const int k_DEFER_DELAY               = 2 * k_HISTOGRAM_FIELDS;
+
+}  // close namespace 'test'
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: Timer lateness is recorded separately for one-shot and
+    // recurring timers, and the statistics are reset when collected.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        ntcs::ChronologyMetrics metrics("chronology", "test", &ta);
+
+        NTCCFG_TEST_EQ(metrics.numOrdinals(), 3 * test::k_HISTOGRAM_FIELDS);
+
+        NTCCFG_TEST_EQ(
+            bsl::string(metrics.getFieldName(test::k_ONE_SHOT_TIMER_LATENESS)),
+            "oneShotTimerLateness.count");
+
+        metrics.logTimerLateness(bsls::TimeInterval(0, 1000), false);
+        metrics.logTimerLateness(bsls::TimeInterval(0, 3000), false);
+        metrics.logTimerLateness(bsls::TimeInterval(0, 5000), true);
+        metrics.logDeferDelay(bsls::TimeInterval(0, 7000));
+
+        {
+            bdld::ManagedDatum stats(&ta);
+            metrics.getStats(&stats);
+
+            const bdld::Datum datum = stats.datum();
+            NTCCFG_TEST_TRUE(datum.isArray());
+            NTCCFG_TEST_EQ(datum.theArray().length(),
+                           static_cast<bsl::size_t>(metrics.numOrdinals()));
+
+            const bdld::DatumArrayRef array = datum.theArray();
+
+            NTCCFG_TEST_EQ(
+                array[test::k_ONE_SHOT_TIMER_LATENESS].theDouble(),
+                2.0);
+            NTCCFG_TEST_EQ(
+                array[test::k_RECURRING_TIMER_LATENESS].theDouble(),
+                1.0);
+            NTCCFG_TEST_EQ(array[test::k_DEFER_DELAY].theDouble(), 1.0);
+        }
+
+        {
+            bdld::ManagedDatum stats(&ta);
+            metrics.getStats(&stats);
+
+            const bdld::DatumArrayRef array = stats.datum().theArray();
+
+            NTCCFG_TEST_TRUE(array[test::k_ONE_SHOT_TIMER_LATENESS].isNull());
+            NTCCFG_TEST_TRUE(
+                array[test::k_RECURRING_TIMER_LATENESS].isNull());
+            NTCCFG_TEST_TRUE(array[test::k_DEFER_DELAY].isNull());
+        }
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: The process-wide metrics are only returned while enabled.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        NTCCFG_TEST_TRUE(ntcs::ChronologyMetrics::getEnabled() == 0);
+
+        ntcs::ChronologyMetrics::enable();
+
+        NTCCFG_TEST_TRUE(ntcs::ChronologyMetrics::getEnabled() ==
+                         ntcs::ChronologyMetrics::global().get());
+
+        ntcs::ChronologyMetrics::disable();
+
+        NTCCFG_TEST_TRUE(ntcs::ChronologyMetrics::getEnabled() == 0);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+}
+NTCCFG_TEST_DRIVER_END;
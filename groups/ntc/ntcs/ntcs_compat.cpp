@@ -118,6 +118,15 @@ void Compat::sanitize(ntca::InterfaceConfig* config)
     }
 #endif
 
+    if (config->numaAware().isNull()) {
+        bool numaAwareOverride;
+        if (ntccfg::Tune::configure(&numaAwareOverride, "NTC_NUMA_AWARE")) {
+            config->setNumaAware(numaAwareOverride);
+            NTCI_LOG_WARN("Using NUMA awareness override '%d'",
+                          (int)(numaAwareOverride));
+        }
+    }
+
     if (config->driverMetrics().isNull()) {
         bool driverMetrics;
         if (ntccfg::Tune::configure(&driverMetrics, "NTC_DRIVER_METRICS")) {
@@ -332,6 +341,35 @@ void Compat::convert(ntca::StreamSocketOptions*         result,
         result->setZeroCopyThreshold(options.zeroCopyThreshold().value());
     }
 
+    if (!options.receiveFramer().isNull()) {
+        result->setReceiveFramer(options.receiveFramer().value());
+    }
+
+    if (!options.sendCoalescing().isNull()) {
+        result->setSendCoalescing(options.sendCoalescing().value());
+    }
+
+    if (!options.sendCoalescingWindow().isNull()) {
+        result->setSendCoalescingWindow(
+            options.sendCoalescingWindow().value());
+    }
+
+    if (!options.tcpInfoInterval().isNull()) {
+        result->setTcpInfoInterval(options.tcpInfoInterval().value());
+    }
+
+    if (!options.adaptiveWriteQueue().isNull()) {
+        result->setAdaptiveWriteQueue(options.adaptiveWriteQueue().value());
+    }
+
+    if (!options.unsentLowWatermark().isNull()) {
+        result->setUnsentLowWatermark(options.unsentLowWatermark().value());
+    }
+
+    if (!options.encryptionOffload().isNull()) {
+        result->setEncryptionOffload(options.encryptionOffload().value());
+    }
+
     result->setLoadBalancingOptions(options.loadBalancingOptions());
 }
 
@@ -462,6 +500,35 @@ void Compat::convert(ntca::ListenerSocketOptions*     result,
         result->setZeroCopyThreshold(options.zeroCopyThreshold().value());
     }
 
+    if (!options.receiveFramer().isNull()) {
+        result->setReceiveFramer(options.receiveFramer().value());
+    }
+
+    if (!options.sendCoalescing().isNull()) {
+        result->setSendCoalescing(options.sendCoalescing().value());
+    }
+
+    if (!options.sendCoalescingWindow().isNull()) {
+        result->setSendCoalescingWindow(
+            options.sendCoalescingWindow().value());
+    }
+
+    if (!options.tcpInfoInterval().isNull()) {
+        result->setTcpInfoInterval(options.tcpInfoInterval().value());
+    }
+
+    if (!options.adaptiveWriteQueue().isNull()) {
+        result->setAdaptiveWriteQueue(options.adaptiveWriteQueue().value());
+    }
+
+    if (!options.unsentLowWatermark().isNull()) {
+        result->setUnsentLowWatermark(options.unsentLowWatermark().value());
+    }
+
+    if (!options.encryptionOffload().isNull()) {
+        result->setEncryptionOffload(options.encryptionOffload().value());
+    }
+
     result->setLoadBalancingOptions(options.loadBalancingOptions());
 }
 
@@ -1759,6 +1826,21 @@ ntsa::Error Compat::configure(
         }
     }
 
+    if (!options.unsentLowWatermark().isNull()) {
+        ntsa::SocketOption option;
+        option.makeUnsentLowWatermark(options.unsentLowWatermark().value());
+
+        error = socket->setOption(option);
+        if (error) {
+            BSLS_LOG_DEBUG("Failed to set socket option: "
+                           "unsent low watermark: %s",
+                           error.text().c_str());
+            if (error != ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED)) {
+                return error;
+            }
+        }
+    }
+
     if (!options.receiveBufferLowWatermark().isNull()) {
         ntsa::SocketOption option;
         option.makeReceiveBufferLowWatermark(
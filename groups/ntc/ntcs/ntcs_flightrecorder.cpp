@@ -0,0 +1,690 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_flightrecorder.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntcs_flightrecorder_cpp, "$Id$ $CSID$")
+
+#include <ntccfg_tune.h>
+#include <bdls_filedescriptorguard.h>
+#include <bdls_filesystemutil.h>
+#include <bslma_default.h>
+#include <bslmt_threadutil.h>
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeutil.h>
+#include <bsl_cstring.h>
+#include <bsl_new.h>
+#include <bsl_ostream.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <errno.h>
+#include <signal.h>
+#endif
+
+namespace BloombergLP {
+namespace ntcs {
+
+namespace {
+
+/// The magic number that begins each file written by the flight recorder.
+const char k_MAGIC[8] = {'N', 'T', 'C', 'F', 'L', 'I', 'T', 'E'};
+
+/// The version of the format of each file written by the flight recorder.
+const bsl::uint32_t k_VERSION = 1;
+
+/// The maximum number of events staged at a time while dumping.
+const bsl::size_t k_CHUNK_CAPACITY = 64;
+
+/// The maximum number of attempts to copy a consistent chunk of events from
+/// a ring buffer while its owner is writing.
+const bsl::size_t k_MAX_READ_ATTEMPTS = 1024;
+
+/// The maximum length of a thread name retained for each ring buffer.
+const bsl::size_t k_THREAD_NAME_CAPACITY = 16;
+
+/// Describe the header of each file written by the flight recorder.
+struct FileHeader {
+    char               d_magic[8];
+    bsl::uint32_t      d_version;
+    bsl::uint32_t      d_eventSize;
+    bsls::Types::Int64 d_monotonicTime;
+    bsls::Types::Int64 d_realTime;
+};
+
+/// Describe the header of the events of each thread in each file written
+/// by the flight recorder.
+struct JournalHeader {
+    bsls::Types::Uint64 d_threadId;
+    char                d_threadName[k_THREAD_NAME_CAPACITY];
+    bsls::Types::Uint64 d_numEvents;
+};
+
+/// Provide the ring buffer of events recorded by a thread. Each ring buffer
+/// is written only by the thread that owns it, and is never deallocated so
+/// that it may be read at any time, including from a signal handler. When
+/// a thread exits its ring buffer is released and may be claimed by a
+/// subsequent thread.
+struct Ring {
+    /// The next ring buffer in the list of all ring buffers.
+    Ring* d_next_p;
+
+    /// The flag indicating the ring buffer is owned by a thread.
+    bsls::AtomicInt d_owned;
+
+    /// The number of events ever written to the ring buffer.
+    bsls::AtomicUint64 d_position;
+
+    /// The sequence number of the ring buffer, which is odd while an event
+    /// is being written and even otherwise.
+    bsls::AtomicUint64 d_sequence;
+
+    /// The position of the first event written by the current owner.
+    bsls::AtomicUint64 d_origin;
+
+    /// The identifier of the thread that owns the ring buffer.
+    bsls::AtomicUint64 d_threadId;
+
+    /// The name of the thread that owns the ring buffer.
+    char d_threadName[k_THREAD_NAME_CAPACITY];
+
+    /// The events.
+    FlightRecorderEvent d_events[FlightRecorder::k_CAPACITY];
+};
+
+/// The head of the list of all ring buffers.
+bsls::AtomicPointer<Ring> s_head;
+
+/// The thread-local storage key of the ring buffer of each thread.
+bslmt::ThreadUtil::Key s_key;
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+
+/// The path to the file written when the process crashes.
+char s_crashPath[4096];
+
+/// The signals that indicate a crash.
+const int k_CRASH_SIGNALS[] = {SIGSEGV, SIGBUS, SIGILL, SIGFPE, SIGABRT};
+
+/// Write the events retained by each thread to the crash file then re-raise
+/// the specified 'signal' with its default disposition.
+void handleCrash(int signal)
+{
+    FlightRecorder::dump(s_crashPath);
+    ::raise(signal);
+}
+
+#endif
+
+/// Release the specified 'key', the ring buffer of an exiting thread.
+void releaseRing(void* key)
+{
+    if (key) {
+        Ring* ring = static_cast<Ring*>(key);
+        ring->d_owned.storeRelease(0);
+    }
+}
+
+/// Claim a ring buffer for the calling thread, either by re-using a ring
+/// buffer released by an exited thread or by allocating a new one. Return
+/// the ring buffer.
+Ring* claimRing()
+{
+    Ring* ring = 0;
+
+    for (Ring* current = s_head.loadAcquire(); current != 0;
+         current       = current->d_next_p)
+    {
+        if (current->d_owned.testAndSwap(0, 1) == 0) {
+            ring = current;
+            break;
+        }
+    }
+
+    bool isNew = false;
+
+    if (ring == 0) {
+        bslma::Allocator* allocator = bslma::Default::globalAllocator();
+
+        void* arena = allocator->allocate(sizeof(Ring));
+        bsl::memset(arena, 0, sizeof(Ring));
+
+        ring = new (arena) Ring();
+        ring->d_owned.storeRelaxed(1);
+
+        isNew = true;
+    }
+
+    bsl::string threadName;
+    bslmt::ThreadUtil::getThreadName(&threadName);
+
+    bsl::memset(ring->d_threadName, 0, k_THREAD_NAME_CAPACITY);
+    bsl::strncpy(ring->d_threadName,
+                 threadName.c_str(),
+                 k_THREAD_NAME_CAPACITY - 1);
+
+    ring->d_threadId.storeRelease(bslmt::ThreadUtil::selfIdAsUint64());
+    ring->d_origin.storeRelease(ring->d_position.loadRelaxed());
+
+    if (isNew) {
+        Ring* head = s_head.loadRelaxed();
+        while (true) {
+            ring->d_next_p = head;
+            Ring* previous = s_head.testAndSwap(head, ring);
+            if (previous == head) {
+                break;
+            }
+            head = previous;
+        }
+    }
+
+    bslmt::ThreadUtil::setSpecific(s_key, ring);
+
+    return ring;
+}
+
+/// Write the specified 'size' bytes of the specified 'data' to the
+/// specified 'file'. Return true on success, and false otherwise.
+bool writeAll(bdls::FilesystemUtil::FileDescriptor file,
+              const void*                          data,
+              bsl::size_t                          size)
+{
+    const char* position = static_cast<const char*>(data);
+    while (size > 0) {
+        int rc = bdls::FilesystemUtil::write(file,
+                                             position,
+                                             static_cast<int>(size));
+        if (rc <= 0) {
+            return false;
+        }
+
+        position += rc;
+        size     -= static_cast<bsl::size_t>(rc);
+    }
+
+    return true;
+}
+
+/// Read the specified 'size' bytes from the specified 'file' into the
+/// specified 'data'. Return 0 on success, 1 if the end of the file is
+/// reached before any bytes are read, and -1 otherwise.
+int readAll(bdls::FilesystemUtil::FileDescriptor file,
+            void*                                data,
+            bsl::size_t                          size)
+{
+    char*             position = static_cast<char*>(data);
+    const bsl::size_t total    = size;
+
+    while (size > 0) {
+        int rc = bdls::FilesystemUtil::read(file,
+                                            position,
+                                            static_cast<int>(size));
+        if (rc < 0) {
+            return -1;
+        }
+
+        if (rc == 0) {
+            return size == total ? 1 : -1;
+        }
+
+        position += rc;
+        size     -= static_cast<bsl::size_t>(rc);
+    }
+
+    return 0;
+}
+
+/// Write the events retained by the specified 'ring' to the specified
+/// 'file'. Return true on success, and false otherwise.
+bool dumpRing(bdls::FilesystemUtil::FileDescriptor file, Ring* ring)
+{
+    const bsls::Types::Uint64 capacity = FlightRecorder::k_CAPACITY;
+
+    const bsls::Types::Uint64 end    = ring->d_position.loadAcquire();
+    bsls::Types::Uint64       origin = ring->d_origin.loadAcquire();
+
+    bsls::Types::Uint64 begin = end > capacity ? end - capacity : 0;
+    if (begin < origin) {
+        begin = origin;
+    }
+
+    if (begin >= end) {
+        return true;
+    }
+
+    JournalHeader journalHeader;
+    bsl::memset(&journalHeader, 0, sizeof journalHeader);
+
+    journalHeader.d_threadId = ring->d_threadId.loadAcquire();
+    bsl::memcpy(journalHeader.d_threadName,
+                ring->d_threadName,
+                k_THREAD_NAME_CAPACITY - 1);
+    journalHeader.d_numEvents = end - begin;
+
+    if (!writeAll(file, &journalHeader, sizeof journalHeader)) {
+        return false;
+    }
+
+    FlightRecorderEvent chunk[k_CHUNK_CAPACITY];
+
+    bsls::Types::Uint64 current = begin;
+    while (current < end) {
+        bsl::size_t numEvents = k_CHUNK_CAPACITY;
+        if (end - current < numEvents) {
+            numEvents = static_cast<bsl::size_t>(end - current);
+        }
+
+        // Copy the events under the sequence number of the ring buffer:
+        // the copy is consistent only if the sequence number is even and
+        // unchanged after the events are copied. The final read of the
+        // sequence number is a read-modify-write so that it has release
+        // semantics and cannot be observed before the events are copied.
+
+        bool                consistent = false;
+        bsls::Types::Uint64 latest     = 0;
+
+        for (bsl::size_t attempt = 0; attempt < k_MAX_READ_ATTEMPTS;
+             ++attempt)
+        {
+            const bsls::Types::Uint64 before =
+                ring->d_sequence.loadAcquire();
+            if ((before & 1) != 0) {
+                continue;
+            }
+
+            latest = ring->d_position.loadRelaxed();
+
+            for (bsl::size_t i = 0; i < numEvents; ++i) {
+                chunk[i] = ring->d_events[(current + i) & (capacity - 1)];
+            }
+
+            const bsls::Types::Uint64 after = ring->d_sequence.addAcqRel(0);
+            if (after == before) {
+                consistent = true;
+                break;
+            }
+        }
+
+        // Discard the events that the owner of the ring buffer overwrote
+        // before they were copied, or every event if the owner was
+        // writing during each attempt to copy them.
+
+        for (bsl::size_t i = 0; i < numEvents; ++i) {
+            if (!consistent || current + i + capacity <= latest) {
+                bsl::memset(&chunk[i], 0, sizeof chunk[i]);
+            }
+        }
+
+        if (!writeAll(file, chunk, numEvents * sizeof chunk[0])) {
+            return false;
+        }
+
+        current += numEvents;
+    }
+
+    return true;
+}
+
+struct Initializer {
+    Initializer()
+    {
+        int rc = bslmt::ThreadUtil::createKey(&s_key, &releaseRing);
+        BSLS_ASSERT_OPT(rc == 0);
+
+        bool enabled;
+        if (ntccfg::Tune::configure(&enabled, "NTC_FLIGHT_RECORDER")) {
+            if (enabled) {
+                ntcs::FlightRecorder::enable();
+            }
+            else {
+                ntcs::FlightRecorder::disable();
+            }
+        }
+
+        bsl::string path;
+        if (ntccfg::Tune::configure(&path, "NTC_FLIGHT_RECORDER_PATH")) {
+            if (!path.empty()) {
+                ntcs::FlightRecorder::installCrashHandler(path.c_str());
+            }
+        }
+    }
+
+    ~Initializer()
+    {
+        // The ring buffers, and the key to each thread's ring buffer, are
+        // intentionally retained so that events may be dumped by a crash
+        // during process exit.
+    }
+};
+
+}  // close unnamed namespace
+
+bsls::AtomicBool FlightRecorder::s_enabled(false);
+
+namespace {
+Initializer s_initializer;
+}  // close unnamed namespace
+
+int FlightRecorderEventType::fromInt(FlightRecorderEventType::Value* result,
+                                     int                             number)
+{
+    switch (number) {
+    case FlightRecorderEventType::e_UNDEFINED:
+    case FlightRecorderEventType::e_WAIT_ENTER:
+    case FlightRecorderEventType::e_WAIT_EXIT:
+    case FlightRecorderEventType::e_POLL:
+    case FlightRecorderEventType::e_TIMER:
+    case FlightRecorderEventType::e_SUBMIT:
+    case FlightRecorderEventType::e_COMPLETE:
+        *result = static_cast<FlightRecorderEventType::Value>(number);
+        return 0;
+    default:
+        return -1;
+    }
+}
+
+const char* FlightRecorderEventType::toString(
+    FlightRecorderEventType::Value value)
+{
+    switch (value) {
+    case FlightRecorderEventType::e_UNDEFINED:
+        return "UNDEFINED";
+    case FlightRecorderEventType::e_WAIT_ENTER:
+        return "WAIT_ENTER";
+    case FlightRecorderEventType::e_WAIT_EXIT:
+        return "WAIT_EXIT";
+    case FlightRecorderEventType::e_POLL:
+        return "POLL";
+    case FlightRecorderEventType::e_TIMER:
+        return "TIMER";
+    case FlightRecorderEventType::e_SUBMIT:
+        return "SUBMIT";
+    case FlightRecorderEventType::e_COMPLETE:
+        return "COMPLETE";
+    }
+
+    return "???";
+}
+
+bsl::ostream& FlightRecorderEventType::print(
+    bsl::ostream&                  stream,
+    FlightRecorderEventType::Value value)
+{
+    return stream << toString(value);
+}
+
+bsl::ostream& operator<<(bsl::ostream&                  stream,
+                         FlightRecorderEventType::Value rhs)
+{
+    return FlightRecorderEventType::print(stream, rhs);
+}
+
+FlightRecorderJournal::FlightRecorderJournal(bslma::Allocator* basicAllocator)
+: d_threadId(0)
+, d_threadName(basicAllocator)
+, d_events(basicAllocator)
+{
+}
+
+FlightRecorderJournal::FlightRecorderJournal(
+    const FlightRecorderJournal& original,
+    bslma::Allocator*            basicAllocator)
+: d_threadId(original.d_threadId)
+, d_threadName(original.d_threadName, basicAllocator)
+, d_events(original.d_events, basicAllocator)
+{
+}
+
+FlightRecorderJournal::~FlightRecorderJournal()
+{
+}
+
+FlightRecorderJournal& FlightRecorderJournal::operator=(
+    const FlightRecorderJournal& other)
+{
+    if (this != &other) {
+        d_threadId   = other.d_threadId;
+        d_threadName = other.d_threadName;
+        d_events     = other.d_events;
+    }
+
+    return *this;
+}
+
+void FlightRecorderJournal::setThreadId(bsls::Types::Uint64 value)
+{
+    d_threadId = value;
+}
+
+void FlightRecorderJournal::setThreadName(const bsl::string& value)
+{
+    d_threadName = value;
+}
+
+void FlightRecorderJournal::addEvent(const FlightRecorderEvent& event)
+{
+    d_events.push_back(event);
+}
+
+bsls::Types::Uint64 FlightRecorderJournal::threadId() const
+{
+    return d_threadId;
+}
+
+const bsl::string& FlightRecorderJournal::threadName() const
+{
+    return d_threadName;
+}
+
+const bsl::vector<FlightRecorderEvent>& FlightRecorderJournal::events() const
+{
+    return d_events;
+}
+
+void FlightRecorder::commit(FlightRecorderEventType::Value type,
+                            ntsa::Handle                   handle,
+                            bsls::Types::Int64             value,
+                            bsl::uint16_t                  flags)
+{
+    Ring* ring = static_cast<Ring*>(bslmt::ThreadUtil::getSpecific(s_key));
+    if (NTCCFG_UNLIKELY(ring == 0)) {
+        ring = claimRing();
+    }
+
+    const bsls::Types::Int64 now = bsls::TimeUtil::getTimer();
+
+    // Mark the ring buffer as being written. The read-modify-write has
+    // acquire semantics so the writes to the event below cannot be observed
+    // before the sequence number becomes odd.
+
+    const bsls::Types::Uint64 sequence = ring->d_sequence.addAcqRel(1);
+
+    const bsls::Types::Uint64 position = ring->d_position.loadRelaxed();
+
+    FlightRecorderEvent& event =
+        ring->d_events[position & (FlightRecorder::k_CAPACITY - 1)];
+
+    event.d_time   = now;
+    event.d_value  = value;
+    event.d_handle = static_cast<bsl::int32_t>(handle);
+    event.d_type   = static_cast<bsl::uint16_t>(type);
+    event.d_flags  = flags;
+
+    ring->d_position.storeRelease(position + 1);
+    ring->d_sequence.storeRelease(sequence + 1);
+}
+
+void FlightRecorder::enable()
+{
+    s_enabled.storeRelaxed(true);
+}
+
+void FlightRecorder::disable()
+{
+    s_enabled.storeRelaxed(false);
+}
+
+ntsa::Error FlightRecorder::dump(const char* path)
+{
+    bdls::FilesystemUtil::FileDescriptor file =
+        bdls::FilesystemUtil::open(path,
+                                   bdls::FilesystemUtil::e_OPEN_OR_CREATE,
+                                   bdls::FilesystemUtil::e_WRITE_ONLY,
+                                   bdls::FilesystemUtil::e_TRUNCATE);
+
+    if (file == bdls::FilesystemUtil::k_INVALID_FD) {
+        return ntsa::Error::last();
+    }
+
+    bdls::FileDescriptorGuard guard(file);
+
+    FileHeader fileHeader;
+    bsl::memset(&fileHeader, 0, sizeof fileHeader);
+
+    bsl::memcpy(fileHeader.d_magic, k_MAGIC, sizeof k_MAGIC);
+    fileHeader.d_version       = k_VERSION;
+    fileHeader.d_eventSize     = sizeof(FlightRecorderEvent);
+    fileHeader.d_monotonicTime = bsls::TimeUtil::getTimer();
+    fileHeader.d_realTime =
+        bsls::SystemTime::nowRealtimeClock().totalNanoseconds();
+
+    if (!writeAll(file, &fileHeader, sizeof fileHeader)) {
+        return ntsa::Error::last();
+    }
+
+    for (Ring* ring = s_head.loadAcquire(); ring != 0; ring = ring->d_next_p)
+    {
+        if (!dumpRing(file, ring)) {
+            return ntsa::Error::last();
+        }
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error FlightRecorder::installCrashHandler(const char* path)
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+
+    const bsl::size_t length = bsl::strlen(path);
+    if (length == 0 || length >= sizeof s_crashPath) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    bsl::memcpy(s_crashPath, path, length + 1);
+
+    struct ::sigaction action;
+    bsl::memset(&action, 0, sizeof action);
+
+    action.sa_handler = &handleCrash;
+    action.sa_flags   = SA_RESETHAND;
+    sigemptyset(&action.sa_mask);
+
+    const bsl::size_t numSignals =
+        sizeof k_CRASH_SIGNALS / sizeof k_CRASH_SIGNALS[0];
+
+    for (bsl::size_t i = 0; i < numSignals; ++i) {
+        int rc = ::sigaction(k_CRASH_SIGNALS[i], &action, 0);
+        if (rc != 0) {
+            return ntsa::Error(errno);
+        }
+    }
+
+    return ntsa::Error();
+
+#else
+
+    NTCCFG_WARNING_UNUSED(path);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+
+#endif
+}
+
+ntsa::Error FlightRecorder::load(bsl::vector<FlightRecorderJournal>* result,
+                                 const char*                         path)
+{
+    result->clear();
+
+    bdls::FilesystemUtil::FileDescriptor file =
+        bdls::FilesystemUtil::open(path,
+                                   bdls::FilesystemUtil::e_OPEN,
+                                   bdls::FilesystemUtil::e_READ_ONLY);
+
+    if (file == bdls::FilesystemUtil::k_INVALID_FD) {
+        return ntsa::Error::last();
+    }
+
+    bdls::FileDescriptorGuard guard(file);
+
+    FileHeader fileHeader;
+    if (readAll(file, &fileHeader, sizeof fileHeader) != 0) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    if (bsl::memcmp(fileHeader.d_magic, k_MAGIC, sizeof k_MAGIC) != 0 ||
+        fileHeader.d_version != k_VERSION ||
+        fileHeader.d_eventSize != sizeof(FlightRecorderEvent))
+    {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    const bsls::Types::Int64 offset =
+        fileHeader.d_realTime - fileHeader.d_monotonicTime;
+
+    while (true) {
+        JournalHeader journalHeader;
+
+        int rc = readAll(file, &journalHeader, sizeof journalHeader);
+        if (rc == 1) {
+            break;
+        }
+        else if (rc != 0) {
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+
+        if (journalHeader.d_numEvents > FlightRecorder::k_CAPACITY) {
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+
+        journalHeader.d_threadName[k_THREAD_NAME_CAPACITY - 1] = 0;
+
+        result->resize(result->size() + 1);
+        FlightRecorderJournal& journal = result->back();
+
+        journal.setThreadId(journalHeader.d_threadId);
+        journal.setThreadName(bsl::string(journalHeader.d_threadName));
+
+        for (bsls::Types::Uint64 i = 0; i < journalHeader.d_numEvents; ++i) {
+            FlightRecorderEvent event;
+            if (readAll(file, &event, sizeof event) != 0) {
+                return ntsa::Error(ntsa::Error::e_INVALID);
+            }
+
+            if (event.d_type == FlightRecorderEventType::e_UNDEFINED) {
+                continue;
+            }
+
+            event.d_time += offset;
+            journal.addEvent(event);
+        }
+    }
+
+    return ntsa::Error();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
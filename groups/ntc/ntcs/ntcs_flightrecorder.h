@@ -0,0 +1,361 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCS_FLIGHTRECORDER
+#define INCLUDED_NTCS_FLIGHTRECORDER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntccfg_platform.h>
+#include <ntcscm_version.h>
+#include <ntsa_error.h>
+#include <ntsa_handle.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+#include <bsl_cstdint.h>
+#include <bsl_iosfwd.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ntcs {
+
+/// @internal @brief
+/// Enumerate the types of events recorded by the flight recorder.
+///
+/// @par Thread Safety
+/// This struct is thread safe.
+///
+/// @ingroup module_ntcs
+struct FlightRecorderEventType {
+    /// Enumerate the types of events recorded by the flight recorder.
+    enum Value {
+        /// The event type is not defined.
+        e_UNDEFINED = 0,
+
+        /// The thread is about to wait for events. The value is the timeout
+        /// of the wait, in milliseconds, or -1 if the wait is indefinite.
+        e_WAIT_ENTER = 1,
+
+        /// The thread has finished waiting for events. The value is the
+        /// number of events detected.
+        e_WAIT_EXIT = 2,
+
+        /// The socket identified by the handle is readable, writable, or
+        /// failed, as indicated by the flags.
+        e_POLL = 3,
+
+        /// A timer has fired. The value is the number of microseconds the
+        /// timer fired after its deadline.
+        e_TIMER = 4,
+
+        /// An operation has been submitted for the socket identified by the
+        /// handle. The value is the driver-specific operation code.
+        e_SUBMIT = 5,
+
+        /// An operation has completed for the socket identified by the
+        /// handle. The value is the number of bytes transferred, or the
+        /// error number if the 'e_FAILED' flag is set.
+        e_COMPLETE = 6
+    };
+
+    /// Return the string representation exactly matching the enumerator
+    /// name corresponding to the specified enumeration 'value'.
+    static const char* toString(Value value);
+
+    /// Load into the specified 'result' the enumerator matching the
+    /// specified 'number'.  Return 0 on success, and a non-zero value with
+    /// no effect on 'result' otherwise (i.e., 'number' does not match any
+    /// enumerator).
+    static int fromInt(Value* result, int number);
+
+    /// Write to the specified 'stream' the string representation of the
+    /// specified enumeration 'value'.  Return a reference to the modifiable
+    /// 'stream'.
+    static bsl::ostream& print(bsl::ostream& stream, Value value);
+};
+
+/// Format the specified 'rhs' to the specified output 'stream' and return a
+/// reference to the modifiable 'stream'.
+///
+/// @related ntcs::FlightRecorderEventType
+bsl::ostream& operator<<(bsl::ostream&                  stream,
+                         FlightRecorderEventType::Value rhs);
+
+/// @internal @brief
+/// Describe an event recorded by the flight recorder.
+///
+/// @details
+/// This struct has a fixed size and layout so that it may be stored in the
+/// ring buffer of each thread and written to a file without any conversion.
+/// The time of an event is measured in nanoseconds from an arbitrary but
+/// fixed point in time while the event is held in a ring buffer, and in
+/// nanoseconds since the Unix epoch once the event is loaded from a file.
+///
+/// @par Thread Safety
+/// This struct is not thread safe.
+///
+/// @ingroup module_ntcs
+struct FlightRecorderEvent {
+    /// Enumerate the flags that qualify an event.
+    enum Flag {
+        /// The socket is readable.
+        e_READABLE = 1,
+
+        /// The socket is writable.
+        e_WRITABLE = 2,
+
+        /// The socket has an error.
+        e_ERROR = 4,
+
+        /// The operation failed.
+        e_FAILED = 8
+    };
+
+    /// The time of the event, in nanoseconds.
+    bsls::Types::Int64 d_time;
+
+    /// The value of the event, whose meaning depends on the event type.
+    bsls::Types::Int64 d_value;
+
+    /// The handle of the socket, or -1 if the event does not pertain to a
+    /// socket.
+    bsl::int32_t d_handle;
+
+    /// The event type.
+    bsl::uint16_t d_type;
+
+    /// The flags that qualify the event.
+    bsl::uint16_t d_flags;
+};
+
+/// @internal @brief
+/// Describe the events recorded by a single thread.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntcs
+class FlightRecorderJournal
+{
+    bsls::Types::Uint64              d_threadId;
+    bsl::string                      d_threadName;
+    bsl::vector<FlightRecorderEvent> d_events;
+
+  public:
+    /// Create a new, empty journal. Optionally specify a 'basicAllocator'
+    /// used to supply memory. If 'basicAllocator' is 0, the currently
+    /// installed default allocator is used.
+    explicit FlightRecorderJournal(bslma::Allocator* basicAllocator = 0);
+
+    /// Create a new journal having the same value as the specified
+    /// 'original' object. Optionally specify a 'basicAllocator' used to
+    /// supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used.
+    FlightRecorderJournal(const FlightRecorderJournal& original,
+                          bslma::Allocator*            basicAllocator = 0);
+
+    /// Destroy this object.
+    ~FlightRecorderJournal();
+
+    /// Assign the value of the specified 'other' object to this object.
+    /// Return a reference to this modifiable object.
+    FlightRecorderJournal& operator=(const FlightRecorderJournal& other);
+
+    /// Set the identifier of the thread that recorded the events to the
+    /// specified 'value'.
+    void setThreadId(bsls::Types::Uint64 value);
+
+    /// Set the name of the thread that recorded the events to the specified
+    /// 'value'.
+    void setThreadName(const bsl::string& value);
+
+    /// Append the specified 'event' to the events recorded by the thread.
+    void addEvent(const FlightRecorderEvent& event);
+
+    /// Return the identifier of the thread that recorded the events.
+    bsls::Types::Uint64 threadId() const;
+
+    /// Return the name of the thread that recorded the events.
+    const bsl::string& threadName() const;
+
+    /// Return the events recorded by the thread, in the order in which they
+    /// were recorded.
+    const bsl::vector<FlightRecorderEvent>& events() const;
+
+    /// This type accepts an allocator argument to its constructors and may
+    /// dynamically allocate memory during its operation.
+    BSLMF_NESTED_TRAIT_DECLARATION(FlightRecorderJournal,
+                                   bslma::UsesBslmaAllocator);
+};
+
+/// @internal @brief
+/// Provide a low-overhead recorder of driver events.
+///
+/// @details
+/// Each thread that records an event is lazily assigned a fixed-capacity
+/// ring buffer into which events are written without locks and without
+/// memory allocation: recording an event costs a thread-local lookup, a read
+/// of the monotonic clock, a store of a few words, and an atomic increment
+/// of the sequence number of the ring buffer, which lets the ring buffer be
+/// read consistently by another thread while it is being written. Once a
+/// ring buffer is full, each new event overwrites the oldest event in that
+/// buffer. The ring buffers of every thread may be
+/// dumped to a file at any time, or automatically when the process crashes,
+/// and the file decoded into a timeline of events to analyze latency spikes
+/// after the fact.
+///
+/// The recorder is disabled by default, and may be enabled by setting the
+/// environment variable 'NTC_FLIGHT_RECORDER' to 1. When the environment
+/// variable 'NTC_FLIGHT_RECORDER_PATH' is set, the recorder installs a
+/// handler that dumps the ring buffers to the file at that path when the
+/// process crashes.
+///
+/// @par Thread Safety
+/// This struct is thread safe.
+///
+/// @ingroup module_ntcs
+struct FlightRecorder {
+  private:
+    /// The flag indicating whether events are recorded.
+    static bsls::AtomicBool s_enabled;
+
+    /// Record an event of the specified 'type' qualified by the specified
+    /// 'flags' having the specified 'handle' and 'value' into the ring
+    /// buffer of the calling thread.
+    static void commit(FlightRecorderEventType::Value type,
+                       ntsa::Handle                   handle,
+                       bsls::Types::Int64             value,
+                       bsl::uint16_t                  flags);
+
+  public:
+    /// The maximum number of events retained by each thread.
+    enum { k_CAPACITY = 4096 };
+
+    /// Start recording events.
+    static void enable();
+
+    /// Stop recording events. Note that events already recorded are
+    /// retained.
+    static void disable();
+
+    /// Return true if events are recorded, otherwise return false.
+    static bool isEnabled();
+
+    /// Record an event of the specified 'type' having the specified
+    /// 'handle' and 'value' into the ring buffer of the calling thread,
+    /// qualified by the optionally specified 'flags', if events are
+    /// recorded.
+    static void record(FlightRecorderEventType::Value type,
+                       ntsa::Handle                   handle,
+                       bsls::Types::Int64             value,
+                       bsl::uint16_t                  flags = 0);
+
+    /// Write the events retained by each thread to the file at the specified
+    /// 'path'. Return the error. Note that this function does not allocate
+    /// memory, so it may be called from a signal handler.
+    static ntsa::Error dump(const char* path);
+
+    /// Install a handler that writes the events retained by each thread to
+    /// the file at the specified 'path' when the process receives a signal
+    /// indicating a crash, then re-raises the signal. Return the error.
+    static ntsa::Error installCrashHandler(const char* path);
+
+    /// Load into the specified 'result' the journal of each thread read from
+    /// the file at the specified 'path', written by 'dump'. The time of each
+    /// event is converted to nanoseconds since the Unix epoch. Return the
+    /// error.
+    static ntsa::Error load(bsl::vector<FlightRecorderJournal>* result,
+                            const char*                         path);
+};
+
+NTCCFG_INLINE
+bool FlightRecorder::isEnabled()
+{
+    return s_enabled.loadRelaxed();
+}
+
+NTCCFG_INLINE
+void FlightRecorder::record(FlightRecorderEventType::Value type,
+                            ntsa::Handle                   handle,
+                            bsls::Types::Int64             value,
+                            bsl::uint16_t                  flags)
+{
+    if (s_enabled.loadRelaxed()) {
+        FlightRecorder::commit(type, handle, value, flags);
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#define NTCS_FLIGHTRECORDER_WAIT_ENTER(timeout)                               \
+    if (ntcs::FlightRecorder::isEnabled()) {                                  \
+        ntcs::FlightRecorder::record(                                         \
+            ntcs::FlightRecorderEventType::e_WAIT_ENTER,                      \
+            ntsa::k_INVALID_HANDLE,                                           \
+            (timeout));                                                       \
+    }
+
+#define NTCS_FLIGHTRECORDER_WAIT_EXIT(numEvents)                              \
+    if (ntcs::FlightRecorder::isEnabled()) {                                  \
+        ntcs::FlightRecorder::record(                                         \
+            ntcs::FlightRecorderEventType::e_WAIT_EXIT,                       \
+            ntsa::k_INVALID_HANDLE,                                           \
+            static_cast<bsls::Types::Int64>(numEvents));                      \
+    }
+
+#define NTCS_FLIGHTRECORDER_POLL(handle, readable, writable, error)           \
+    if (ntcs::FlightRecorder::isEnabled()) {                                  \
+        ntcs::FlightRecorder::record(                                         \
+            ntcs::FlightRecorderEventType::e_POLL,                            \
+            (handle),                                                         \
+            0,                                                                \
+            static_cast<bsl::uint16_t>(                                       \
+                ((readable) ? ntcs::FlightRecorderEvent::e_READABLE : 0) |    \
+                ((writable) ? ntcs::FlightRecorderEvent::e_WRITABLE : 0) |    \
+                ((error) ? ntcs::FlightRecorderEvent::e_ERROR : 0)));         \
+    }
+
+#define NTCS_FLIGHTRECORDER_TIMER(lateness)                                   \
+    if (ntcs::FlightRecorder::isEnabled()) {                                  \
+        ntcs::FlightRecorder::record(ntcs::FlightRecorderEventType::e_TIMER,  \
+                                     ntsa::k_INVALID_HANDLE,                  \
+                                     (lateness).totalMicroseconds());         \
+    }
+
+#define NTCS_FLIGHTRECORDER_SUBMIT(handle, operation)                         \
+    if (ntcs::FlightRecorder::isEnabled()) {                                  \
+        ntcs::FlightRecorder::record(                                         \
+            ntcs::FlightRecorderEventType::e_SUBMIT,                          \
+            (handle),                                                         \
+            static_cast<bsls::Types::Int64>(operation));                      \
+    }
+
+#define NTCS_FLIGHTRECORDER_COMPLETE(handle, result, failed)                  \
+    if (ntcs::FlightRecorder::isEnabled()) {                                  \
+        ntcs::FlightRecorder::record(                                         \
+            ntcs::FlightRecorderEventType::e_COMPLETE,                        \
+            (handle),                                                         \
+            static_cast<bsls::Types::Int64>(result),                          \
+            static_cast<bsl::uint16_t>(                                       \
+                (failed) ? ntcs::FlightRecorderEvent::e_FAILED : 0));         \
+    }
+
+#endif
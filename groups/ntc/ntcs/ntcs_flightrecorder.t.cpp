@@ -0,0 +1,282 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_flightrecorder.h>
+
+#include <ntccfg_test.h>
+
+#include <ntsa_temporary.h>
+#include <bslmt_threadutil.h>
+#include <bsls_atomic.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+//
+//-----------------------------------------------------------------------------
+
+// [ 1]
+// [ 2]
+// [ 3]
+//-----------------------------------------------------------------------------
+// [ 1]
+// [ 2]
+// [ 3]
+//-----------------------------------------------------------------------------
+
+namespace test {
+
+/// Return the journal of the calling thread in the specified 'journals', or
+/// 0 if no such journal exists.
+const ntcs::FlightRecorderJournal* findJournal(
+    const bsl::vector<ntcs::FlightRecorderJournal>& journals)
+{
+    const bsls::Types::Uint64 threadId = bslmt::ThreadUtil::selfIdAsUint64();
+
+    for (bsl::size_t i = 0; i < journals.size(); ++i) {
+        if (journals[i].threadId() == threadId) {
+            return &journals[i];
+        }
+    }
+
+    return 0;
+}
+
+/// Record events into the flight recorder of the calling thread until the
+/// specified 'stop' flag is set, after loading the identifier of the calling
+/// thread into the specified 'threadId'. The handle of each event is the
+/// remainder of its value divided by 1000, so that a torn event may be
+/// detected.
+void recordEvents(bsls::AtomicUint64* threadId, bsls::AtomicBool* stop)
+{
+    threadId->storeRelease(bslmt::ThreadUtil::selfIdAsUint64());
+
+    bsls::Types::Int64 value = 0;
+    while (!stop->loadAcquire()) {
+        ntcs::FlightRecorder::record(
+            ntcs::FlightRecorderEventType::e_TIMER,
+            static_cast<ntsa::Handle>(value % 1000),
+            value);
+        ++value;
+    }
+}
+
+}  // close namespace 'test'
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: Events recorded by a thread are dumped to a file and loaded
+    // from that file in the order in which they were recorded.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+
+        ntcs::FlightRecorder::enable();
+
+        ntcs::FlightRecorder::record(
+            ntcs::FlightRecorderEventType::e_WAIT_ENTER,
+            ntsa::k_INVALID_HANDLE,
+            -1);
+
+        ntcs::FlightRecorder::record(
+            ntcs::FlightRecorderEventType::e_WAIT_EXIT,
+            ntsa::k_INVALID_HANDLE,
+            1);
+
+        ntcs::FlightRecorder::record(
+            ntcs::FlightRecorderEventType::e_POLL,
+            10,
+            0,
+            ntcs::FlightRecorderEvent::e_READABLE |
+                ntcs::FlightRecorderEvent::e_ERROR);
+
+        ntsa::TemporaryFile file(&ta);
+
+        error = ntcs::FlightRecorder::dump(file.path().c_str());
+        NTCCFG_TEST_OK(error);
+
+        bsl::vector<ntcs::FlightRecorderJournal> journals(&ta);
+        error = ntcs::FlightRecorder::load(&journals, file.path().c_str());
+        NTCCFG_TEST_OK(error);
+
+        const ntcs::FlightRecorderJournal* journal =
+            test::findJournal(journals);
+        NTCCFG_TEST_TRUE(journal != 0);
+
+        const bsl::vector<ntcs::FlightRecorderEvent>& events =
+            journal->events();
+        NTCCFG_TEST_GE(events.size(), 3U);
+
+        const bsl::size_t n = events.size();
+
+        NTCCFG_TEST_EQ(events[n - 3].d_type,
+                       ntcs::FlightRecorderEventType::e_WAIT_ENTER);
+        NTCCFG_TEST_EQ(events[n - 3].d_value, -1);
+
+        NTCCFG_TEST_EQ(events[n - 2].d_type,
+                       ntcs::FlightRecorderEventType::e_WAIT_EXIT);
+        NTCCFG_TEST_EQ(events[n - 2].d_value, 1);
+
+        NTCCFG_TEST_EQ(events[n - 1].d_type,
+                       ntcs::FlightRecorderEventType::e_POLL);
+        NTCCFG_TEST_EQ(events[n - 1].d_handle, 10);
+        NTCCFG_TEST_EQ(events[n - 1].d_flags,
+                       ntcs::FlightRecorderEvent::e_READABLE |
+                           ntcs::FlightRecorderEvent::e_ERROR);
+
+        NTCCFG_TEST_LE(events[n - 3].d_time, events[n - 2].d_time);
+        NTCCFG_TEST_LE(events[n - 2].d_time, events[n - 1].d_time);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: Each thread retains only its most recent events, and events
+    // are not recorded while the recorder is disabled.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+
+        ntcs::FlightRecorder::enable();
+
+        const bsl::size_t k_NUM_EVENTS = ntcs::FlightRecorder::k_CAPACITY * 2;
+
+        for (bsl::size_t i = 0; i < k_NUM_EVENTS; ++i) {
+            ntcs::FlightRecorder::record(
+                ntcs::FlightRecorderEventType::e_TIMER,
+                ntsa::k_INVALID_HANDLE,
+                static_cast<bsls::Types::Int64>(i));
+        }
+
+        ntcs::FlightRecorder::disable();
+
+        ntcs::FlightRecorder::record(
+            ntcs::FlightRecorderEventType::e_WAIT_ENTER,
+            ntsa::k_INVALID_HANDLE,
+            0);
+
+        ntcs::FlightRecorder::enable();
+
+        ntsa::TemporaryFile file(&ta);
+
+        error = ntcs::FlightRecorder::dump(file.path().c_str());
+        NTCCFG_TEST_OK(error);
+
+        bsl::vector<ntcs::FlightRecorderJournal> journals(&ta);
+        error = ntcs::FlightRecorder::load(&journals, file.path().c_str());
+        NTCCFG_TEST_OK(error);
+
+        const ntcs::FlightRecorderJournal* journal =
+            test::findJournal(journals);
+        NTCCFG_TEST_TRUE(journal != 0);
+
+        const bsl::vector<ntcs::FlightRecorderEvent>& events =
+            journal->events();
+        NTCCFG_TEST_EQ(
+            events.size(),
+            static_cast<bsl::size_t>(ntcs::FlightRecorder::k_CAPACITY));
+
+        for (bsl::size_t i = 0; i < events.size(); ++i) {
+            NTCCFG_TEST_EQ(events[i].d_type,
+                           ntcs::FlightRecorderEventType::e_TIMER);
+            NTCCFG_TEST_EQ(
+                events[i].d_value,
+                static_cast<bsls::Types::Int64>(
+                    k_NUM_EVENTS - ntcs::FlightRecorder::k_CAPACITY + i));
+        }
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(3)
+{
+    // Concern: Events dumped while the owning thread is recording them are
+    // never torn and are dumped in the order in which they were recorded.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+
+        ntcs::FlightRecorder::enable();
+
+        bsls::AtomicUint64 threadId(0);
+        bsls::AtomicBool   stop(false);
+
+        bslmt::ThreadUtil::Handle thread = bslmt::ThreadUtil::invalidHandle();
+        bslmt::ThreadUtil::create(
+            &thread,
+            NTCCFG_BIND(&test::recordEvents, &threadId, &stop));
+        NTCCFG_TEST_ASSERT(thread != bslmt::ThreadUtil::invalidHandle());
+
+        while (threadId.loadAcquire() == 0) {
+            bslmt::ThreadUtil::yield();
+        }
+
+        for (bsl::size_t iteration = 0; iteration < 10; ++iteration) {
+            ntsa::TemporaryFile file(&ta);
+
+            error = ntcs::FlightRecorder::dump(file.path().c_str());
+            NTCCFG_TEST_OK(error);
+
+            bsl::vector<ntcs::FlightRecorderJournal> journals(&ta);
+            error = ntcs::FlightRecorder::load(&journals, file.path().c_str());
+            NTCCFG_TEST_OK(error);
+
+            for (bsl::size_t i = 0; i < journals.size(); ++i) {
+                if (journals[i].threadId() != threadId.loadAcquire()) {
+                    continue;
+                }
+
+                const bsl::vector<ntcs::FlightRecorderEvent>& events =
+                    journals[i].events();
+
+                for (bsl::size_t j = 0; j < events.size(); ++j) {
+                    NTCCFG_TEST_EQ(events[j].d_type,
+                                   ntcs::FlightRecorderEventType::e_TIMER);
+                    NTCCFG_TEST_EQ(
+                        events[j].d_handle,
+                        static_cast<bsl::int32_t>(events[j].d_value % 1000));
+                    if (j > 0) {
+                        NTCCFG_TEST_LT(events[j - 1].d_value,
+                                       events[j].d_value);
+                    }
+                }
+            }
+        }
+
+        stop.storeRelease(true);
+        bslmt::ThreadUtil::join(thread);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+    NTCCFG_TEST_REGISTER(3);
+}
+NTCCFG_TEST_DRIVER_END;
@@ -45,8 +45,65 @@ struct Initializer {
     }
 } s_initializer;
 
+/// The scale by which delays recorded in microseconds are multiplied to be
+/// reported in seconds.
+const double k_SECONDS_PER_MICROSECOND = 1e-6;
+
+/// Return the number of shards of each sharded metric of metrics having the
+/// specified 'parent'.
+bsl::size_t numShards(const bsl::shared_ptr<ntcs::Metrics>& parent)
+{
+    if (parent) {
+        return 1;
+    }
+    else {
+        return ntci::MetricSharded::k_DEFAULT_SHARDS;
+    }
+}
+
+/// Load null values into the specified 'array' at the specified 'index' for
+/// the specified 'numValues', and increment 'index' by 'numValues'.
+void collectNull(bdld::DatumMutableArrayRef* array,
+                 bsl::size_t*                index,
+                 bsl::size_t                 numValues)
+{
+    for (bsl::size_t i = 0; i < numValues; ++i) {
+        array->data()[(*index)++] = bdld::Datum::createNull();
+    }
+}
+
 }  // close unnamed namespace
 
+/// Describe the metrics sampled from the state of a TCP connection.
+struct Metrics::TcpMetrics {
+    ntci::MetricHistogram d_roundTripTime;
+    ntci::MetricSharded   d_roundTripTimeVariance;
+    ntci::MetricSharded   d_congestionWindow;
+    ntci::MetricSharded   d_retransmittedSegments;
+    ntci::MetricSharded   d_deliveryRate;
+    ntci::MetricSharded   d_unacknowledgedBytes;
+
+    /// The number of values collected by the histogram.
+    static const bsl::size_t k_NUM_HISTOGRAM_VALUES = 9;
+
+    /// The number of values collected by the summaries.
+    static const bsl::size_t k_NUM_SUMMARY_VALUES = 5 * 5;
+
+    /// Create new metrics whose sharded metrics have the specified
+    /// 'numShards'. Optionally specify a 'basicAllocator' used to supply
+    /// memory. If 'basicAllocator' is 0, the currently installed default
+    /// allocator is used.
+    TcpMetrics(bsl::size_t numShards, bslma::Allocator* basicAllocator = 0)
+    : d_roundTripTime(1.0, basicAllocator)
+    , d_roundTripTimeVariance(numShards, basicAllocator)
+    , d_congestionWindow(numShards, basicAllocator)
+    , d_retransmittedSegments(numShards, basicAllocator)
+    , d_deliveryRate(numShards, basicAllocator)
+    , d_unacknowledgedBytes(numShards, basicAllocator)
+    {
+    }
+};
+
 const ntci::MetricMetadata Metrics::STATISTICS[] = {
     NTCI_METRIC_METADATA_SUMMARY(bytesSendable),
     NTCI_METRIC_METADATA_SUMMARY(bytesSent),
@@ -59,13 +116,13 @@ const ntci::MetricMetadata Metrics::STATISTICS[] = {
     NTCI_METRIC_METADATA_SUMMARY(iterationsReceiving),
 
     NTCI_METRIC_METADATA_SUMMARY(connectionsInAcceptQueue),
-    NTCI_METRIC_METADATA_SUMMARY(delayInAcceptQueue),
+    NTCI_METRIC_METADATA_HISTOGRAM(delayInAcceptQueue),
 
     NTCI_METRIC_METADATA_SUMMARY(bytesInWriteQueue),
-    NTCI_METRIC_METADATA_SUMMARY(delayInWriteQueue),
+    NTCI_METRIC_METADATA_HISTOGRAM(delayInWriteQueue),
 
     NTCI_METRIC_METADATA_SUMMARY(bytesInReadQueue),
-    NTCI_METRIC_METADATA_SUMMARY(delayInReadQueue),
+    NTCI_METRIC_METADATA_HISTOGRAM(delayInReadQueue),
 
     NTCI_METRIC_METADATA_SUMMARY(connectionsAccepted),
     NTCI_METRIC_METADATA_SUMMARY(connectionsUnacceptable),
@@ -75,42 +132,55 @@ const ntci::MetricMetadata Metrics::STATISTICS[] = {
 
     NTCI_METRIC_METADATA_SUMMARY(bytesAllocated),
 
-    NTCI_METRIC_METADATA_SUMMARY(txDelayBeforeScheduling),
-    NTCI_METRIC_METADATA_SUMMARY(txDelayInSoftware),
-    NTCI_METRIC_METADATA_SUMMARY(txDelay),
-    NTCI_METRIC_METADATA_SUMMARY(txDelayBeforeAcknowledgement),
+    NTCI_METRIC_METADATA_HISTOGRAM(txDelayBeforeScheduling),
+    NTCI_METRIC_METADATA_HISTOGRAM(txDelayInSoftware),
+    NTCI_METRIC_METADATA_HISTOGRAM(txDelay),
+    NTCI_METRIC_METADATA_HISTOGRAM(txDelayBeforeAcknowledgement),
+
+    NTCI_METRIC_METADATA_HISTOGRAM(rxDelayInHardware),
+    NTCI_METRIC_METADATA_HISTOGRAM(rxDelay),
+
+    NTCI_METRIC_METADATA_HISTOGRAM(tcpRoundTripTime),
+    NTCI_METRIC_METADATA_SUMMARY(tcpRoundTripTimeVariance),
+    NTCI_METRIC_METADATA_SUMMARY(tcpCongestionWindow),
+    NTCI_METRIC_METADATA_SUMMARY(tcpRetransmittedSegments),
+    NTCI_METRIC_METADATA_SUMMARY(tcpDeliveryRate),
+    NTCI_METRIC_METADATA_SUMMARY(tcpUnacknowledgedBytes),
+
+    // New fields are appended so the ordinals of existing fields are stable.
 
-    NTCI_METRIC_METADATA_SUMMARY(rxDelayInHardware),
-    NTCI_METRIC_METADATA_SUMMARY(rxDelay)};
+    NTCI_METRIC_METADATA_SUMMARY(bytesConflatedInWriteQueue)};
 
 Metrics::Metrics(const bslstl::StringRef& prefix,
                  const bslstl::StringRef& objectName,
                  bslma::Allocator*        basicAllocator)
 : d_mutex()
-, d_numBytesSendable()
-, d_numBytesSent()
-, d_numBytesReceivable()
-, d_numBytesReceived()
-, d_numAcceptIterations()
-, d_numSendIterations()
-, d_numReceiveIterations()
-, d_acceptQueueSize()
-, d_acceptQueueDelay()
-, d_writeQueueSize()
-, d_writeQueueDelay()
-, d_readQueueSize()
-, d_readQueueDelay()
-, d_numConnectionsAccepted()
-, d_numConnectionsUnacceptable()
-, d_numConnectionsSynchronized()
-, d_numConnectionsUnsynchronizable()
-, d_numBytesAllocated()
-, d_txDelayBeforeScheduling()
-, d_txDelayInSoftware()
-, d_txDelay()
-, d_txDelayBeforeAcknowledgement()
-, d_rxDelayInHardware()
-, d_rxDelay()
+, d_numBytesSendable(basicAllocator)
+, d_numBytesSent(basicAllocator)
+, d_numBytesReceivable(basicAllocator)
+, d_numBytesReceived(basicAllocator)
+, d_numAcceptIterations(basicAllocator)
+, d_numSendIterations(basicAllocator)
+, d_numReceiveIterations(basicAllocator)
+, d_acceptQueueSize(basicAllocator)
+, d_acceptQueueDelay(k_SECONDS_PER_MICROSECOND, basicAllocator)
+, d_writeQueueSize(basicAllocator)
+, d_writeQueueDelay(k_SECONDS_PER_MICROSECOND, basicAllocator)
+, d_writeQueueConflated(basicAllocator)
+, d_readQueueSize(basicAllocator)
+, d_readQueueDelay(k_SECONDS_PER_MICROSECOND, basicAllocator)
+, d_numConnectionsAccepted(basicAllocator)
+, d_numConnectionsUnacceptable(basicAllocator)
+, d_numConnectionsSynchronized(basicAllocator)
+, d_numConnectionsUnsynchronizable(basicAllocator)
+, d_numBytesAllocated(basicAllocator)
+, d_txDelayBeforeScheduling(1.0, basicAllocator)
+, d_txDelayInSoftware(1.0, basicAllocator)
+, d_txDelay(1.0, basicAllocator)
+, d_txDelayBeforeAcknowledgement(1.0, basicAllocator)
+, d_rxDelayInHardware(1.0, basicAllocator)
+, d_rxDelay(1.0, basicAllocator)
+, d_tcpMetrics(0)
 , d_prefix(prefix, basicAllocator)
 , d_objectName(objectName, basicAllocator)
 , d_parent_sp()
@@ -123,30 +193,32 @@ Metrics::Metrics(const bslstl::StringRef&              prefix,
                  const bsl::shared_ptr<ntcs::Metrics>& parent,
                  bslma::Allocator*                     basicAllocator)
 : d_mutex()
-, d_numBytesSendable()
-, d_numBytesSent()
-, d_numBytesReceivable()
-, d_numBytesReceived()
-, d_numAcceptIterations()
-, d_numSendIterations()
-, d_numReceiveIterations()
-, d_acceptQueueSize()
-, d_acceptQueueDelay()
-, d_writeQueueSize()
-, d_writeQueueDelay()
-, d_readQueueSize()
-, d_readQueueDelay()
-, d_numConnectionsAccepted()
-, d_numConnectionsUnacceptable()
-, d_numConnectionsSynchronized()
-, d_numConnectionsUnsynchronizable()
-, d_numBytesAllocated()
-, d_txDelayBeforeScheduling()
-, d_txDelayInSoftware()
-, d_txDelay()
-, d_txDelayBeforeAcknowledgement()
-, d_rxDelayInHardware()
-, d_rxDelay()
+, d_numBytesSendable(numShards(parent), basicAllocator)
+, d_numBytesSent(numShards(parent), basicAllocator)
+, d_numBytesReceivable(numShards(parent), basicAllocator)
+, d_numBytesReceived(numShards(parent), basicAllocator)
+, d_numAcceptIterations(numShards(parent), basicAllocator)
+, d_numSendIterations(numShards(parent), basicAllocator)
+, d_numReceiveIterations(numShards(parent), basicAllocator)
+, d_acceptQueueSize(numShards(parent), basicAllocator)
+, d_acceptQueueDelay(k_SECONDS_PER_MICROSECOND, basicAllocator)
+, d_writeQueueSize(numShards(parent), basicAllocator)
+, d_writeQueueDelay(k_SECONDS_PER_MICROSECOND, basicAllocator)
+, d_writeQueueConflated(numShards(parent), basicAllocator)
+, d_readQueueSize(numShards(parent), basicAllocator)
+, d_readQueueDelay(k_SECONDS_PER_MICROSECOND, basicAllocator)
+, d_numConnectionsAccepted(numShards(parent), basicAllocator)
+, d_numConnectionsUnacceptable(numShards(parent), basicAllocator)
+, d_numConnectionsSynchronized(numShards(parent), basicAllocator)
+, d_numConnectionsUnsynchronizable(numShards(parent), basicAllocator)
+, d_numBytesAllocated(numShards(parent), basicAllocator)
+, d_txDelayBeforeScheduling(1.0, basicAllocator)
+, d_txDelayInSoftware(1.0, basicAllocator)
+, d_txDelay(1.0, basicAllocator)
+, d_txDelayBeforeAcknowledgement(1.0, basicAllocator)
+, d_rxDelayInHardware(1.0, basicAllocator)
+, d_rxDelay(1.0, basicAllocator)
+, d_tcpMetrics(0)
 , d_prefix(basicAllocator)
 , d_objectName(basicAllocator)
 , d_parent_sp(parent)
@@ -166,6 +238,29 @@ Metrics::Metrics(const bslstl::StringRef&              prefix,
 
 Metrics::~Metrics()
 {
+    TcpMetrics* tcpMetrics = d_tcpMetrics.load();
+    if (tcpMetrics != 0) {
+        d_allocator_p->deleteObject(tcpMetrics);
+    }
+}
+
+Metrics::TcpMetrics* Metrics::tcpMetrics()
+{
+    TcpMetrics* tcpMetrics = d_tcpMetrics.loadAcquire();
+    if (NTCCFG_LIKELY(tcpMetrics != 0)) {
+        return tcpMetrics;
+    }
+
+    tcpMetrics = new (*d_allocator_p)
+        TcpMetrics(numShards(d_parent_sp), d_allocator_p);
+
+    TcpMetrics* previous = d_tcpMetrics.testAndSwap(0, tcpMetrics);
+    if (previous != 0) {
+        d_allocator_p->deleteObject(tcpMetrics);
+        return previous;
+    }
+
+    return tcpMetrics;
 }
 
 void Metrics::logConnectCompletion()
@@ -271,7 +366,8 @@ void Metrics::logAcceptQueueSize(bsl::size_t acceptQueueSize)
 
 void Metrics::logAcceptQueueDelay(const bsls::TimeInterval& acceptQueueDelay)
 {
-    d_acceptQueueDelay.update(acceptQueueDelay.totalSecondsAsDouble());
+    d_acceptQueueDelay.update(
+        static_cast<double>(acceptQueueDelay.totalMicroseconds()));
 
     if (d_parent_sp) {
         d_parent_sp->logAcceptQueueDelay(acceptQueueDelay);
@@ -289,13 +385,23 @@ void Metrics::logWriteQueueSize(bsl::size_t writeQueueSize)
 
 void Metrics::logWriteQueueDelay(const bsls::TimeInterval& writeQueueDelay)
 {
-    d_writeQueueDelay.update(writeQueueDelay.totalSecondsAsDouble());
+    d_writeQueueDelay.update(
+        static_cast<double>(writeQueueDelay.totalMicroseconds()));
 
     if (d_parent_sp) {
         d_parent_sp->logWriteQueueDelay(writeQueueDelay);
     }
 }
 
+void Metrics::logWriteQueueConflated(bsl::size_t numBytesConflated)
+{
+    d_writeQueueConflated.update(static_cast<double>(numBytesConflated));
+
+    if (d_parent_sp) {
+        d_parent_sp->logWriteQueueConflated(numBytesConflated);
+    }
+}
+
 void Metrics::logReadQueueSize(bsl::size_t readQueueSize)
 {
     d_readQueueSize.update(static_cast<double>(readQueueSize));
@@ -307,7 +413,8 @@ void Metrics::logReadQueueSize(bsl::size_t readQueueSize)
 
 void Metrics::logReadQueueDelay(const bsls::TimeInterval& readQueueDelay)
 {
-    d_readQueueDelay.update(readQueueDelay.totalSecondsAsDouble());
+    d_readQueueDelay.update(
+        static_cast<double>(readQueueDelay.totalMicroseconds()));
 
     if (d_parent_sp) {
         d_parent_sp->logReadQueueDelay(readQueueDelay);
@@ -384,6 +491,29 @@ void Metrics::logRxDelay(const bsls::TimeInterval& rxDelay)
     }
 }
 
+void Metrics::logTcpInfo(const ntsa::TcpInfo& tcpInfo,
+                         bsl::uint32_t        numRetransmissions)
+{
+    TcpMetrics* tcpMetrics = this->tcpMetrics();
+
+    tcpMetrics->d_roundTripTime.update(
+        static_cast<double>(tcpInfo.roundTripTime().totalMicroseconds()));
+    tcpMetrics->d_roundTripTimeVariance.update(static_cast<double>(
+        tcpInfo.roundTripTimeVariance().totalMicroseconds()));
+    tcpMetrics->d_congestionWindow.update(
+        static_cast<double>(tcpInfo.congestionWindow()));
+    tcpMetrics->d_retransmittedSegments.update(
+        static_cast<double>(numRetransmissions));
+    tcpMetrics->d_deliveryRate.update(
+        static_cast<double>(tcpInfo.deliveryRate()));
+    tcpMetrics->d_unacknowledgedBytes.update(
+        static_cast<double>(tcpInfo.unacknowledgedBytes()));
+
+    if (d_parent_sp) {
+        d_parent_sp->logTcpInfo(tcpInfo, numRetransmissions);
+    }
+}
+
 void Metrics::getStats(bdld::ManagedDatum* result)
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
@@ -406,13 +536,13 @@ void Metrics::getStats(bdld::ManagedDatum* result)
     d_numReceiveIterations.collectSummary(&array, &index);
 
     d_acceptQueueSize.collectSummary(&array, &index);
-    d_acceptQueueDelay.collectSummary(&array, &index);
+    d_acceptQueueDelay.collectHistogram(&array, &index);
 
     d_writeQueueSize.collectSummary(&array, &index);
-    d_writeQueueDelay.collectSummary(&array, &index);
+    d_writeQueueDelay.collectHistogram(&array, &index);
 
     d_readQueueSize.collectSummary(&array, &index);
-    d_readQueueDelay.collectSummary(&array, &index);
+    d_readQueueDelay.collectHistogram(&array, &index);
 
     d_numConnectionsAccepted.collectSummary(&array, &index);
 
@@ -424,12 +554,28 @@ void Metrics::getStats(bdld::ManagedDatum* result)
 
     d_numBytesAllocated.collectSummary(&array, &index);
 
-    d_txDelayBeforeScheduling.collectSummary(&array, &index);
-    d_txDelayInSoftware.collectSummary(&array, &index);
-    d_txDelay.collectSummary(&array, &index);
-    d_txDelayBeforeAcknowledgement.collectSummary(&array, &index);
-    d_rxDelayInHardware.collectSummary(&array, &index);
-    d_rxDelay.collectSummary(&array, &index);
+    d_txDelayBeforeScheduling.collectHistogram(&array, &index);
+    d_txDelayInSoftware.collectHistogram(&array, &index);
+    d_txDelay.collectHistogram(&array, &index);
+    d_txDelayBeforeAcknowledgement.collectHistogram(&array, &index);
+    d_rxDelayInHardware.collectHistogram(&array, &index);
+    d_rxDelay.collectHistogram(&array, &index);
+
+    TcpMetrics* tcpMetrics = d_tcpMetrics.loadAcquire();
+    if (tcpMetrics != 0) {
+        tcpMetrics->d_roundTripTime.collectHistogram(&array, &index);
+        tcpMetrics->d_roundTripTimeVariance.collectSummary(&array, &index);
+        tcpMetrics->d_congestionWindow.collectSummary(&array, &index);
+        tcpMetrics->d_retransmittedSegments.collectSummary(&array, &index);
+        tcpMetrics->d_deliveryRate.collectSummary(&array, &index);
+        tcpMetrics->d_unacknowledgedBytes.collectSummary(&array, &index);
+    }
+    else {
+        collectNull(&array, &index, TcpMetrics::k_NUM_HISTOGRAM_VALUES);
+        collectNull(&array, &index, TcpMetrics::k_NUM_SUMMARY_VALUES);
+    }
+
+    d_writeQueueConflated.collectSummary(&array, &index);
 
     // TODO: Calculate and publish derivative metrics.
     // double avgBytesSentPerEvent = 0;
@@ -23,8 +23,10 @@ BSLS_IDENT("$Id: $")
 #include <ntci_metric.h>
 #include <ntci_monitorable.h>
 #include <ntcscm_version.h>
+#include <ntsa_tcpinfo.h>
 #include <bslmt_mutex.h>
 #include <bslmt_threadutil.h>
+#include <bsls_atomic.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
 #include <bsl_vector.h>
@@ -35,41 +37,60 @@ namespace ntcs {
 /// @internal @brief
 /// Provide statistics for the runtime behavior of sockets.
 ///
+/// @details
+/// Delays are measured in microseconds as histograms, so that their
+/// percentiles are reported in addition to their summary. The delays in the
+/// accept, write, and read queues are reported in seconds; all other delays
+/// are reported in microseconds. The memory for each histogram is allocated
+/// only once the delay it measures is first recorded, and the memory for the
+/// metrics sampled from the state of a TCP connection is allocated only once
+/// such a sample is first recorded, and published without locking, so that
+/// recording a sample never serializes the sockets sharing a parent. Metrics
+/// that have no parent typically aggregate the metrics of many sockets updated
+/// concurrently by many threads, so their measurements are sharded by thread;
+/// metrics that have a parent are typically updated by one thread at a time
+/// and are not sharded.
+///
 /// @par Thread Safety
 /// This class is thread safe.
 ///
 /// @ingroup module_ntcs
 class Metrics : public ntci::Monitorable, public ntccfg::Shared<Metrics>
 {
-    mutable bslmt::Mutex           d_mutex;
-    ntci::Metric                   d_numBytesSendable;
-    ntci::Metric                   d_numBytesSent;
-    ntci::Metric                   d_numBytesReceivable;
-    ntci::Metric                   d_numBytesReceived;
-    ntci::Metric                   d_numAcceptIterations;
-    ntci::Metric                   d_numSendIterations;
-    ntci::Metric                   d_numReceiveIterations;
-    ntci::Metric                   d_acceptQueueSize;
-    ntci::Metric                   d_acceptQueueDelay;
-    ntci::Metric                   d_writeQueueSize;
-    ntci::Metric                   d_writeQueueDelay;
-    ntci::Metric                   d_readQueueSize;
-    ntci::Metric                   d_readQueueDelay;
-    ntci::Metric                   d_numConnectionsAccepted;
-    ntci::Metric                   d_numConnectionsUnacceptable;
-    ntci::Metric                   d_numConnectionsSynchronized;
-    ntci::Metric                   d_numConnectionsUnsynchronizable;
-    ntci::Metric                   d_numBytesAllocated;
-    ntci::Metric                   d_txDelayBeforeScheduling;
-    ntci::Metric                   d_txDelayInSoftware;
-    ntci::Metric                   d_txDelay;
-    ntci::Metric                   d_txDelayBeforeAcknowledgement;
-    ntci::Metric                   d_rxDelayInHardware;
-    ntci::Metric                   d_rxDelay;
-    bsl::string                    d_prefix;
-    bsl::string                    d_objectName;
-    bsl::shared_ptr<ntcs::Metrics> d_parent_sp;
-    bslma::Allocator*              d_allocator_p;
+    /// Describe the metrics sampled from the state of a TCP connection.
+    struct TcpMetrics;
+
+    mutable bslmt::Mutex            d_mutex;
+    ntci::MetricSharded             d_numBytesSendable;
+    ntci::MetricSharded             d_numBytesSent;
+    ntci::MetricSharded             d_numBytesReceivable;
+    ntci::MetricSharded             d_numBytesReceived;
+    ntci::MetricSharded             d_numAcceptIterations;
+    ntci::MetricSharded             d_numSendIterations;
+    ntci::MetricSharded             d_numReceiveIterations;
+    ntci::MetricSharded             d_acceptQueueSize;
+    ntci::MetricHistogram           d_acceptQueueDelay;
+    ntci::MetricSharded             d_writeQueueSize;
+    ntci::MetricHistogram           d_writeQueueDelay;
+    ntci::MetricSharded             d_writeQueueConflated;
+    ntci::MetricSharded             d_readQueueSize;
+    ntci::MetricHistogram           d_readQueueDelay;
+    ntci::MetricSharded             d_numConnectionsAccepted;
+    ntci::MetricSharded             d_numConnectionsUnacceptable;
+    ntci::MetricSharded             d_numConnectionsSynchronized;
+    ntci::MetricSharded             d_numConnectionsUnsynchronizable;
+    ntci::MetricSharded             d_numBytesAllocated;
+    ntci::MetricHistogram           d_txDelayBeforeScheduling;
+    ntci::MetricHistogram           d_txDelayInSoftware;
+    ntci::MetricHistogram           d_txDelay;
+    ntci::MetricHistogram           d_txDelayBeforeAcknowledgement;
+    ntci::MetricHistogram           d_rxDelayInHardware;
+    ntci::MetricHistogram           d_rxDelay;
+    bsls::AtomicPointer<TcpMetrics> d_tcpMetrics;
+    bsl::string                     d_prefix;
+    bsl::string                     d_objectName;
+    bsl::shared_ptr<ntcs::Metrics>  d_parent_sp;
+    bslma::Allocator*               d_allocator_p;
 
     static const struct ntci::MetricMetadata STATISTICS[];
 
@@ -77,6 +98,12 @@ class Metrics : public ntci::Monitorable, public ntccfg::Shared<Metrics>
     Metrics(const Metrics&) BSLS_KEYWORD_DELETED;
     Metrics& operator=(const Metrics&) BSLS_KEYWORD_DELETED;
 
+  private:
+    /// Return the metrics sampled from the state of a TCP connection,
+    /// allocating them if necessary, unless already allocated by another
+    /// thread.
+    TcpMetrics* tcpMetrics();
+
   public:
     /// Create new metrics for the specified 'objectName whose field names
     /// have the specified 'prefix'. Optionally specify a 'basicAllocator'
@@ -145,6 +172,10 @@ class Metrics : public ntci::Monitorable, public ntccfg::Shared<Metrics>
     /// Log the gauge of the specified 'writeQueueDelay'.
     void logWriteQueueDelay(const bsls::TimeInterval& writeQueueDelay);
 
+    /// Log the gauge of the specified 'numBytesConflated' replaced in the
+    /// write queue by subsequent data having the same conflation key.
+    void logWriteQueueConflated(bsl::size_t numBytesConflated);
+
     /// Log the gauge of the specified 'writeQueueSize'.
     void logReadQueueSize(bsl::size_t writeQueueSize);
 
@@ -175,6 +206,15 @@ class Metrics : public ntci::Monitorable, public ntccfg::Shared<Metrics>
     /// Log the gauge of the specified 'rxDelay'.
     void logRxDelay(const bsls::TimeInterval& rxDelay);
 
+    /// Log the gauges of the round trip time, congestion window, delivery
+    /// rate, and unacknowledged bytes sampled in the specified 'tcpInfo',
+    /// and the gauge of the specified 'numRetransmissions' of segments since
+    /// the previous sample. Note that the retransmitted segments reported in
+    /// 'tcpInfo' are the total over the lifetime of the connection and are
+    /// not logged.
+    void logTcpInfo(const ntsa::TcpInfo& tcpInfo,
+                    bsl::uint32_t        numRetransmissions);
+
     /// Load into the specified 'result' the array of statistics from the
     /// specified 'snapshot' for this object based on the specified
     /// 'operation': if 'operation' is e_CUMULATIVE then the statistics are
@@ -381,6 +421,13 @@ MetricsGuard::~MetricsGuard()
         }                                                                     \
     } while (false)
 
+#define NTCS_METRICS_UPDATE_WRITE_QUEUE_CONFLATED(numBytesConflated)          \
+    do {                                                                      \
+        if (d_metrics_sp) {                                                   \
+            d_metrics_sp->logWriteQueueConflated(numBytesConflated);          \
+        }                                                                     \
+    } while (false)
+
 #define NTCS_METRICS_UPDATE_READ_QUEUE_SIZE(readQueueSize)                    \
     do {                                                                      \
         if (d_metrics_sp) {                                                   \
@@ -444,6 +491,13 @@ MetricsGuard::~MetricsGuard()
         }                                                                     \
     } while (false)
 
+#define NTCS_METRICS_UPDATE_TCP_INFO(tcpInfo, numRetransmissions)             \
+    do {                                                                      \
+        if (d_metrics_sp) {                                                   \
+            d_metrics_sp->logTcpInfo(tcpInfo, numRetransmissions);            \
+        }                                                                     \
+    } while (false)
+
 #else
 
 #define NTCS_METRICS_UPDATE_ACCEPT_COMPLETE()
@@ -463,6 +517,7 @@ MetricsGuard::~MetricsGuard()
 
 #define NTCS_METRICS_UPDATE_WRITE_QUEUE_SIZE(writeQueueSize)
 #define NTCS_METRICS_UPDATE_WRITE_QUEUE_DELAY(writeQueueDelay)
+#define NTCS_METRICS_UPDATE_WRITE_QUEUE_CONFLATED(numBytesConflated)
 
 #define NTCS_METRICS_UPDATE_READ_QUEUE_SIZE(readQueueSize)
 #define NTCS_METRICS_UPDATE_READ_QUEUE_DELAY(readQueueDelay)
@@ -476,6 +531,8 @@ MetricsGuard::~MetricsGuard()
 #define NTCS_METRICS_UPDATE_RX_DELAY_IN_HARDWARE(rxDelayInHardware)
 #define NTCS_METRICS_UPDATE_RX_DELAY(rxDelay)
 
+#define NTCS_METRICS_UPDATE_TCP_INFO(tcpInfo, numRetransmissions)
+
 #endif
 
 }  // close package namespace
@@ -0,0 +1,261 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_numautil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntcs_numautil_cpp, "$Id$ $CSID$")
+
+#include <bslma_default.h>
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsl_algorithm.h>
+#include <bsl_fstream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+#include <sched.h>
+#endif
+
+namespace BloombergLP {
+namespace ntcs {
+
+namespace {
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+/// The path to the directory describing the NUMA nodes.
+const char k_NODE_PATH[] = "/sys/devices/system/node";
+
+/// Load into the specified 'result' the first line of the file at the
+/// specified 'path'. Return true if the file could be read, otherwise return
+/// false.
+bool readLine(bsl::string* result, const bsl::string& path)
+{
+    bsl::ifstream stream(path.c_str());
+    if (!stream) {
+        return false;
+    }
+
+    if (!bsl::getline(stream, *result)) {
+        return false;
+    }
+
+    return true;
+}
+
+#endif
+
+/// Parse an unsigned decimal number from the specified 'text' starting at the
+/// specified 'position'. Load the number into the specified 'result' and
+/// advance 'position' past it. Return true if at least one digit was parsed,
+/// otherwise return false.
+bool parseNumber(bsl::size_t*             result,
+                 bsl::size_t*             position,
+                 const bslstl::StringRef& text)
+{
+    bsl::size_t value = 0;
+    bsl::size_t start = *position;
+
+    while (*position < text.length() && text[*position] >= '0' &&
+           text[*position] <= '9')
+    {
+        value = (value * 10) + static_cast<bsl::size_t>(text[*position] - '0');
+        ++(*position);
+    }
+
+    if (*position == start) {
+        return false;
+    }
+
+    *result = value;
+    return true;
+}
+
+}  // close unnamed namespace
+
+NumaNode::NumaNode(bslma::Allocator* basicAllocator)
+: d_nodeIndex(0)
+, d_cpuList(basicAllocator)
+{
+}
+
+NumaNode::NumaNode(const NumaNode& original, bslma::Allocator* basicAllocator)
+: d_nodeIndex(original.d_nodeIndex)
+, d_cpuList(original.d_cpuList, basicAllocator)
+{
+}
+
+NumaNode::~NumaNode()
+{
+}
+
+NumaNode& NumaNode::operator=(const NumaNode& other)
+{
+    if (this != &other) {
+        d_nodeIndex = other.d_nodeIndex;
+        d_cpuList   = other.d_cpuList;
+    }
+
+    return *this;
+}
+
+ntsa::Error NumaUtil::parseCpuList(bsl::vector<bsl::size_t>* result,
+                                   const bslstl::StringRef&  text)
+{
+    result->clear();
+
+    bsl::size_t length = text.length();
+    while (length > 0 && (text[length - 1] == '\n' || text[length - 1] == ' '))
+    {
+        --length;
+    }
+
+    const bslstl::StringRef trimmed(text.data(), length);
+
+    bsl::size_t position = 0;
+    while (position < trimmed.length()) {
+        bsl::size_t first = 0;
+        if (!parseNumber(&first, &position, trimmed)) {
+            result->clear();
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+
+        bsl::size_t last = first;
+        if (position < trimmed.length() && trimmed[position] == '-') {
+            ++position;
+            if (!parseNumber(&last, &position, trimmed) || last < first) {
+                result->clear();
+                return ntsa::Error(ntsa::Error::e_INVALID);
+            }
+        }
+
+        for (bsl::size_t cpu = first; cpu <= last; ++cpu) {
+            result->push_back(cpu);
+        }
+
+        if (position < trimmed.length()) {
+            if (trimmed[position] != ',') {
+                result->clear();
+                return ntsa::Error(ntsa::Error::e_INVALID);
+            }
+            ++position;
+        }
+    }
+
+    bsl::sort(result->begin(), result->end());
+    result->erase(bsl::unique(result->begin(), result->end()), result->end());
+
+    return ntsa::Error();
+}
+
+void NumaUtil::discover(bsl::vector<ntcs::NumaNode>* result)
+{
+    result->clear();
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+    bsl::string onlinePath(k_NODE_PATH);
+    onlinePath.append("/online");
+
+    bsl::string onlineText;
+    if (readLine(&onlineText, onlinePath)) {
+        bsl::vector<bsl::size_t> nodeIndexList;
+        ntsa::Error error = NumaUtil::parseCpuList(&nodeIndexList, onlineText);
+        if (!error) {
+            for (bsl::size_t i = 0; i < nodeIndexList.size(); ++i) {
+                bsl::string cpuListPath;
+                {
+                    bsl::stringstream ss;
+                    ss << k_NODE_PATH << "/node" << nodeIndexList[i]
+                       << "/cpulist";
+                    cpuListPath = ss.str();
+                }
+
+                bsl::string cpuListText;
+                if (!readLine(&cpuListText, cpuListPath)) {
+                    continue;
+                }
+
+                ntcs::NumaNode node;
+                node.d_nodeIndex = nodeIndexList[i];
+
+                error = NumaUtil::parseCpuList(&node.d_cpuList, cpuListText);
+                if (error || node.d_cpuList.empty()) {
+                    // Skip nodes that have memory but no CPUs.
+                    continue;
+                }
+
+                result->push_back(node);
+            }
+        }
+    }
+
+#endif
+
+    if (result->empty()) {
+        result->push_back(ntcs::NumaNode());
+    }
+}
+
+ntsa::Error NumaUtil::bind(const ntcs::NumaNode& node)
+{
+    if (node.d_cpuList.empty()) {
+        return ntsa::Error();
+    }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+
+    for (bsl::size_t i = 0; i < node.d_cpuList.size(); ++i) {
+        const bsl::size_t cpu = node.d_cpuList[i];
+        if (cpu < static_cast<bsl::size_t>(CPU_SETSIZE)) {
+            CPU_SET(static_cast<int>(cpu), &cpuSet);
+        }
+    }
+
+    int rc = sched_setaffinity(0, sizeof cpuSet, &cpuSet);
+    if (rc != 0) {
+        return ntsa::Error::last();
+    }
+
+    return ntsa::Error();
+
+#else
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+
+#endif
+}
+
+ntsa::Error NumaUtil::bind(bsl::size_t nodeIndex)
+{
+    bsl::vector<ntcs::NumaNode> nodeList;
+    NumaUtil::discover(&nodeList);
+
+    for (bsl::size_t i = 0; i < nodeList.size(); ++i) {
+        if (nodeList[i].d_nodeIndex == nodeIndex) {
+            return NumaUtil::bind(nodeList[i]);
+        }
+    }
+
+    return ntsa::Error(ntsa::Error::e_INVALID);
+}
+
+}  // end namespace ntcs
+}  // end namespace BloombergLP
@@ -0,0 +1,113 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCS_NUMAUTIL
+#define INCLUDED_NTCS_NUMAUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntccfg_platform.h>
+#include <ntcscm_version.h>
+#include <ntsa_error.h>
+#include <bslma_allocator.h>
+#include <bslstl_stringref.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ntcs {
+
+/// @internal @brief
+/// Describe a NUMA node and the CPUs local to it.
+///
+/// @details
+/// An empty CPU list indicates the node is a stand-in for the entire machine,
+/// discovered when the NUMA topology is unavailable, and that threads bound to
+/// it may run on any CPU.
+///
+/// @par Thread Safety
+/// This struct is not thread safe.
+///
+/// @ingroup module_ntcs
+struct NumaNode {
+    /// The index of the node, as numbered by the operating system.
+    bsl::size_t d_nodeIndex;
+
+    /// The sorted list of the CPUs local to the node.
+    bsl::vector<bsl::size_t> d_cpuList;
+
+    /// Create a new NUMA node description. Optionally specify a
+    /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0, the
+    /// currently installed default allocator is used.
+    explicit NumaNode(bslma::Allocator* basicAllocator = 0);
+
+    /// Create a new NUMA node description having the same value as the
+    /// specified 'original' object. Optionally specify a 'basicAllocator'
+    /// used to supply memory. If 'basicAllocator' is 0, the currently
+    /// installed default allocator is used.
+    NumaNode(const NumaNode& original, bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~NumaNode();
+
+    /// Assign the value of the specified 'other' object to this object.
+    /// Return a reference to this modifiable object.
+    NumaNode& operator=(const NumaNode& other);
+
+    /// Defines the traits of this type. These traits can be used to select,
+    /// at compile-time, the most efficient algorithm to manipulate objects
+    /// of this type.
+    NTCCFG_DECLARE_NESTED_USES_ALLOCATOR_TRAITS(NumaNode);
+};
+
+/// @internal @brief
+/// Provide utilities for discovering the NUMA topology of the machine and
+/// binding threads to NUMA nodes.
+///
+/// @details
+/// On Linux the topology is read from '/sys/devices/system/node'. On all other
+/// platforms, or when the topology cannot be read, the machine is described
+/// as a single node having no explicit CPU list, so that callers degrade to
+/// the behavior of a non-NUMA machine.
+///
+/// @par Thread Safety
+/// This struct is thread safe.
+///
+/// @ingroup module_ntcs
+struct NumaUtil {
+    /// Load into the specified 'result' the CPU indexes described by the
+    /// specified 'text', in the format of the Linux 'cpulist' files, e.g.
+    /// "0-3,8,10-11". Return the error.
+    static ntsa::Error parseCpuList(bsl::vector<bsl::size_t>* result,
+                                    const bslstl::StringRef&  text);
+
+    /// Load into the specified 'result' the description of each NUMA node
+    /// of the machine, sorted by node index. At least one node is always
+    /// loaded.
+    static void discover(bsl::vector<ntcs::NumaNode>* result);
+
+    /// Bind the calling thread to the CPUs local to the specified 'node'.
+    /// Return the error. Note that binding a thread to a node having an
+    /// empty CPU list has no effect.
+    static ntsa::Error bind(const ntcs::NumaNode& node);
+
+    /// Bind the calling thread to the CPUs local to the NUMA node having the
+    /// specified 'nodeIndex'. Return the error.
+    static ntsa::Error bind(bsl::size_t nodeIndex);
+};
+
+}  // end namespace ntcs
+}  // end namespace BloombergLP
+#endif
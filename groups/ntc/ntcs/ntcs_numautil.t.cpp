@@ -0,0 +1,141 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_numautil.h>
+
+#include <ntccfg_test.h>
+
+#include <ntci_log.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bsls_assert.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+//
+//-----------------------------------------------------------------------------
+
+// [ 1]
+//-----------------------------------------------------------------------------
+// [ 1]
+//-----------------------------------------------------------------------------
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: Parsing CPU lists.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+
+        bsl::vector<bsl::size_t> cpuList(&ta);
+
+        error = ntcs::NumaUtil::parseCpuList(&cpuList, "0");
+        NTCCFG_TEST_OK(error);
+        NTCCFG_TEST_EQ(cpuList.size(), 1);
+        NTCCFG_TEST_EQ(cpuList[0], 0);
+
+        error = ntcs::NumaUtil::parseCpuList(&cpuList, "0-3,8,10-11\n");
+        NTCCFG_TEST_OK(error);
+        NTCCFG_TEST_EQ(cpuList.size(), 7);
+        NTCCFG_TEST_EQ(cpuList[0], 0);
+        NTCCFG_TEST_EQ(cpuList[3], 3);
+        NTCCFG_TEST_EQ(cpuList[4], 8);
+        NTCCFG_TEST_EQ(cpuList[5], 10);
+        NTCCFG_TEST_EQ(cpuList[6], 11);
+
+        error = ntcs::NumaUtil::parseCpuList(&cpuList, "");
+        NTCCFG_TEST_OK(error);
+        NTCCFG_TEST_TRUE(cpuList.empty());
+
+        error = ntcs::NumaUtil::parseCpuList(&cpuList, "3-1");
+        NTCCFG_TEST_ERROR(error, ntsa::Error::e_INVALID);
+        NTCCFG_TEST_TRUE(cpuList.empty());
+
+        error = ntcs::NumaUtil::parseCpuList(&cpuList, "0,a");
+        NTCCFG_TEST_ERROR(error, ntsa::Error::e_INVALID);
+        NTCCFG_TEST_TRUE(cpuList.empty());
+
+        error = ntcs::NumaUtil::parseCpuList(&cpuList, "0;1");
+        NTCCFG_TEST_ERROR(error, ntsa::Error::e_INVALID);
+        NTCCFG_TEST_TRUE(cpuList.empty());
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: Discovering the NUMA topology and binding the calling thread
+    // to a node.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        NTCI_LOG_CONTEXT();
+
+        ntsa::Error error;
+
+        bsl::vector<ntcs::NumaNode> nodeList(&ta);
+        ntcs::NumaUtil::discover(&nodeList);
+
+        NTCCFG_TEST_GE(nodeList.size(), 1);
+
+        for (bsl::size_t i = 0; i < nodeList.size(); ++i) {
+            NTCI_LOG_DEBUG("NUMA node %d has %d CPUs",
+                           (int)(nodeList[i].d_nodeIndex),
+                           (int)(nodeList[i].d_cpuList.size()));
+
+            if (nodeList.size() > 1) {
+                NTCCFG_TEST_FALSE(nodeList[i].d_cpuList.empty());
+            }
+
+            if (i > 0) {
+                NTCCFG_TEST_LT(nodeList[i - 1].d_nodeIndex,
+                               nodeList[i].d_nodeIndex);
+            }
+        }
+
+        // Note that binding may be refused when the process is confined to
+        // a subset of the CPUs of the node, e.g. by a container.
+
+        error = ntcs::NumaUtil::bind(nodeList.front());
+        if (nodeList.front().d_cpuList.empty()) {
+            NTCCFG_TEST_OK(error);
+        }
+        else if (error) {
+            NTCI_LOG_DEBUG("Failed to bind to NUMA node %d: %s",
+                           (int)(nodeList.front().d_nodeIndex),
+                           error.text().c_str());
+        }
+
+        error = ntcs::NumaUtil::bind(nodeList.back().d_nodeIndex + 1);
+        NTCCFG_TEST_ERROR(error, ntsa::Error::e_INVALID);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+}
+NTCCFG_TEST_DRIVER_END;
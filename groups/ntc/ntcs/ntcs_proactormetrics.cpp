@@ -56,7 +56,10 @@ const ntci::MetricMetadata ProactorMetrics::STATISTICS[] = {
     NTCI_METRIC_METADATA_SUMMARY(wakeupsSpurious),
     NTCI_METRIC_METADATA_SUMMARY(timeProcessingRead),
     NTCI_METRIC_METADATA_SUMMARY(timeProcessingWrite),
-    NTCI_METRIC_METADATA_SUMMARY(timeProcessingError)};
+    NTCI_METRIC_METADATA_SUMMARY(timeProcessingError),
+    NTCI_METRIC_METADATA_HISTOGRAM(timeProcessingCallback),
+    NTCI_METRIC_METADATA_SUMMARY(callbacksStalled),
+    NTCI_METRIC_METADATA_HISTOGRAM(timerLag)};
 
 ProactorMetrics::ProactorMetrics(const bslstl::StringRef& prefix,
                                  const bslstl::StringRef& objectName,
@@ -71,6 +74,9 @@ ProactorMetrics::ProactorMetrics(const bslstl::StringRef& prefix,
 , d_readProcessingTime()
 , d_writeProcessingTime()
 , d_errorProcessingTime()
+, d_callbackTime(1.0, basicAllocator)
+, d_numCallbacksStalled()
+, d_timerLag(1.0, basicAllocator)
 , d_prefix(prefix, basicAllocator)
 , d_objectName(objectName, basicAllocator)
 , d_parent_sp()
@@ -93,6 +99,9 @@ ProactorMetrics::ProactorMetrics(
 , d_readProcessingTime()
 , d_writeProcessingTime()
 , d_errorProcessingTime()
+, d_callbackTime(1.0, basicAllocator)
+, d_numCallbacksStalled()
+, d_timerLag(1.0, basicAllocator)
 , d_prefix(basicAllocator)
 , d_objectName(basicAllocator)
 , d_parent_sp(parent)
@@ -155,9 +164,19 @@ void ProactorMetrics::logSpuriousWakeup()
     }
 }
 
+void ProactorMetrics::logCallback(const bsls::TimeInterval& duration)
+{
+    d_callbackTime.update(static_cast<double>(duration.totalMicroseconds()));
+
+    if (NTCCFG_UNLIKELY(ntcs::Watchdog::isStalled(duration))) {
+        d_numCallbacksStalled.update(1);
+    }
+}
+
 void ProactorMetrics::logReadCallback(const bsls::TimeInterval& duration)
 {
     d_readProcessingTime.update(duration.totalSecondsAsDouble());
+    this->logCallback(duration);
 
     if (d_parent_sp) {
         d_parent_sp->logReadCallback(duration);
@@ -167,6 +186,7 @@ void ProactorMetrics::logReadCallback(const bsls::TimeInterval& duration)
 void ProactorMetrics::logWriteCallback(const bsls::TimeInterval& duration)
 {
     d_writeProcessingTime.update(duration.totalSecondsAsDouble());
+    this->logCallback(duration);
 
     if (d_parent_sp) {
         d_parent_sp->logWriteCallback(duration);
@@ -176,12 +196,22 @@ void ProactorMetrics::logWriteCallback(const bsls::TimeInterval& duration)
 void ProactorMetrics::logErrorCallback(const bsls::TimeInterval& duration)
 {
     d_errorProcessingTime.update(duration.totalSecondsAsDouble());
+    this->logCallback(duration);
 
     if (d_parent_sp) {
         d_parent_sp->logErrorCallback(duration);
     }
 }
 
+void ProactorMetrics::logTimerLag(const bsls::TimeInterval& lag)
+{
+    d_timerLag.update(static_cast<double>(lag.totalMicroseconds()));
+
+    if (d_parent_sp) {
+        d_parent_sp->logTimerLag(lag);
+    }
+}
+
 void ProactorMetrics::getStats(bdld::ManagedDatum* result)
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
@@ -211,6 +241,12 @@ void ProactorMetrics::getStats(bdld::ManagedDatum* result)
 
     d_errorProcessingTime.collectSummary(&array, &index);
 
+    d_callbackTime.collectHistogram(&array, &index);
+
+    d_numCallbacksStalled.collectSummary(&array, &index);
+
+    d_timerLag.collectHistogram(&array, &index);
+
     *array.length() = numOrdinals();
 
     result->adopt(bdld::Datum::adoptArray(array));
@@ -289,10 +325,10 @@ const bsl::shared_ptr<ntci::ProactorMetrics>& ProactorMetrics::parent() const
     return d_parent_sp;
 }
 
-ntcs::ProactorMetrics* ProactorMetrics::setThreadLocal(
-    ntcs::ProactorMetrics* metrics)
+ntci::ProactorMetrics* ProactorMetrics::setThreadLocal(
+    ntci::ProactorMetrics* metrics)
 {
-    ntcs::ProactorMetrics* previous = reinterpret_cast<ntcs::ProactorMetrics*>(
+    ntci::ProactorMetrics* previous = reinterpret_cast<ntci::ProactorMetrics*>(
         bslmt::ThreadUtil::getSpecific(s_key));
 
     int rc = bslmt::ThreadUtil::setSpecific(
@@ -303,9 +339,9 @@ ntcs::ProactorMetrics* ProactorMetrics::setThreadLocal(
     return previous;
 }
 
-ntcs::ProactorMetrics* ProactorMetrics::getThreadLocal()
+ntci::ProactorMetrics* ProactorMetrics::getThreadLocal()
 {
-    ntcs::ProactorMetrics* current = reinterpret_cast<ntcs::ProactorMetrics*>(
+    ntci::ProactorMetrics* current = reinterpret_cast<ntci::ProactorMetrics*>(
         bslmt::ThreadUtil::getSpecific(s_key));
 
     return current;
@@ -23,6 +23,7 @@ BSLS_IDENT("$Id: $")
 #include <ntci_metric.h>
 #include <ntci_monitorable.h>
 #include <ntci_proactormetrics.h>
+#include <ntcs_watchdog.h>
 #include <ntcscm_version.h>
 
 #include <bslmt_mutex.h>
@@ -55,6 +56,9 @@ class ProactorMetrics : public ntci::ProactorMetrics,
     ntci::Metric                           d_readProcessingTime;
     ntci::Metric                           d_writeProcessingTime;
     ntci::Metric                           d_errorProcessingTime;
+    ntci::MetricHistogram                  d_callbackTime;
+    ntci::Metric                           d_numCallbacksStalled;
+    ntci::MetricHistogram                  d_timerLag;
     bsl::string                            d_prefix;
     bsl::string                            d_objectName;
     bsl::shared_ptr<ntci::ProactorMetrics> d_parent_sp;
@@ -66,6 +70,11 @@ class ProactorMetrics : public ntci::ProactorMetrics,
     ProactorMetrics(const ProactorMetrics&) BSLS_KEYWORD_DELETED;
     ProactorMetrics& operator=(const ProactorMetrics&) BSLS_KEYWORD_DELETED;
 
+  private:
+    /// Log the specified 'duration' in any function to process a socket
+    /// and detect whether the function stalled the calling thread.
+    void logCallback(const bsls::TimeInterval& duration);
+
   public:
     /// Create new metrics for the specified 'objectName whose field names
     /// have the specified 'prefix'. Optionally specify a 'basicAllocator'
@@ -124,6 +133,10 @@ class ProactorMetrics : public ntci::ProactorMetrics,
     void logErrorCallback(const bsls::TimeInterval& duration)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Log the specified 'lag' between the deadline of the earliest timer
+    /// due and the time the timer was announced by the proactor thread.
+    void logTimerLag(const bsls::TimeInterval& lag) BSLS_KEYWORD_OVERRIDE;
+
     /// Load into the specified 'result' the array of statistics from the
     /// specified 'snapshot' for this object based on the specified
     /// 'operation': if 'operation' is e_CUMULATIVE then the statistics are
@@ -178,11 +191,11 @@ class ProactorMetrics : public ntci::ProactorMetrics,
 
     /// Set the specified 'metrics' as the metrics to use by this thread.
     /// Return the previous metrics used by this thread, if any.
-    static ntcs::ProactorMetrics* setThreadLocal(
-        ntcs::ProactorMetrics* metrics);
+    static ntci::ProactorMetrics* setThreadLocal(
+        ntci::ProactorMetrics* metrics);
 
     /// Return the metrics to use by the current thread, if any.
-    static ntcs::ProactorMetrics* getThreadLocal();
+    static ntci::ProactorMetrics* getThreadLocal();
 };
 
 /// @internal @brief
@@ -200,8 +213,8 @@ class ProactorMetrics : public ntci::ProactorMetrics,
 /// @ingroup module_ntcs
 class ProactorMetricsGuard
 {
-    ntcs::ProactorMetrics* d_current_p;
-    ntcs::ProactorMetrics* d_previous_p;
+    ntci::ProactorMetrics* d_current_p;
+    ntci::ProactorMetrics* d_previous_p;
 
   private:
     ProactorMetricsGuard(const ProactorMetricsGuard&) BSLS_KEYWORD_DELETED;
@@ -212,7 +225,7 @@ class ProactorMetricsGuard
     /// Create a new metrics guard that installs the specified 'metrics'
     /// object into thread local storage and uninstalls it when this object
     /// is destroyed.
-    explicit ProactorMetricsGuard(ntcs::ProactorMetrics* metrics);
+    explicit ProactorMetricsGuard(ntci::ProactorMetrics* metrics);
 
     /// Uninstall the underlying metrics object from thread local storage
     /// then destroy this object.
@@ -220,7 +233,7 @@ class ProactorMetricsGuard
 };
 
 NTCCFG_INLINE
-ProactorMetricsGuard::ProactorMetricsGuard(ntcs::ProactorMetrics* metrics)
+ProactorMetricsGuard::ProactorMetricsGuard(ntci::ProactorMetrics* metrics)
 : d_current_p(metrics)
 , d_previous_p(0)
 {
@@ -240,7 +253,11 @@ ProactorMetricsGuard::~ProactorMetricsGuard()
 #if NTC_BUILD_WITH_METRICS
 
 #define NTCS_PROACTORMETRICS_GET()                                            \
-    ntci::ProactorMetrics* metrics = result->d_metrics_sp.get()
+    ntci::ProactorMetrics* metrics = result->d_metrics_sp.get();              \
+    ntcs::ProactorMetricsGuard metricsGuard(metrics)
+
+#define NTCS_PROACTORMETRICS_GET_THREAD_LOCAL()                               \
+    ntci::ProactorMetrics* metrics = ntcs::ProactorMetrics::getThreadLocal()
 
 #define NTCS_PROACTORMETRICS_UPDATE_INTERRUPTS(numSignals)                    \
     if (metrics) {                                                            \
@@ -268,7 +285,7 @@ ProactorMetricsGuard::~ProactorMetricsGuard()
         errorProcessingStartTime = bsls::TimeUtil::getTimer();                \
     }
 
-#define NTCS_PROACTORMETRICS_UPDATE_ERROR_CALLBACK_TIME_END()                 \
+#define NTCS_PROACTORMETRICS_UPDATE_ERROR_CALLBACK_TIME_END(handle)           \
     if (metrics) {                                                            \
         bsl::int64_t errorProcessingStopTime = bsls::TimeUtil::getTimer();    \
         bsl::int64_t errorProcessingTime =                                    \
@@ -279,6 +296,9 @@ ProactorMetricsGuard::~ProactorMetricsGuard()
         bsls::TimeInterval duration;                                          \
         duration.setTotalNanoseconds(errorProcessingTime);                    \
         metrics->logErrorCallback(duration);                                  \
+        if (NTCCFG_UNLIKELY(ntcs::Watchdog::isStalled(duration))) {           \
+            ntcs::Watchdog::reportStall("error", handle, duration);           \
+        }                                                                     \
     }
 
 #define NTCS_PROACTORMETRICS_UPDATE_WRITE_CALLBACK_TIME_BEGIN()               \
@@ -287,7 +307,7 @@ ProactorMetricsGuard::~ProactorMetricsGuard()
         writeProcessingStartTime = bsls::TimeUtil::getTimer();                \
     }
 
-#define NTCS_PROACTORMETRICS_UPDATE_WRITE_CALLBACK_TIME_END()                 \
+#define NTCS_PROACTORMETRICS_UPDATE_WRITE_CALLBACK_TIME_END(handle)           \
     if (metrics) {                                                            \
         bsl::int64_t writeProcessingStopTime = bsls::TimeUtil::getTimer();    \
         bsl::int64_t writeProcessingTime =                                    \
@@ -298,6 +318,9 @@ ProactorMetricsGuard::~ProactorMetricsGuard()
         bsls::TimeInterval duration;                                          \
         duration.setTotalNanoseconds(writeProcessingTime);                    \
         metrics->logWriteCallback(duration);                                  \
+        if (NTCCFG_UNLIKELY(ntcs::Watchdog::isStalled(duration))) {           \
+            ntcs::Watchdog::reportStall("write", handle, duration);           \
+        }                                                                     \
     }
 
 #define NTCS_PROACTORMETRICS_UPDATE_READ_CALLBACK_TIME_BEGIN()                \
@@ -306,7 +329,7 @@ ProactorMetricsGuard::~ProactorMetricsGuard()
         readProcessingStartTime = bsls::TimeUtil::getTimer();                 \
     }
 
-#define NTCS_PROACTORMETRICS_UPDATE_READ_CALLBACK_TIME_END()                  \
+#define NTCS_PROACTORMETRICS_UPDATE_READ_CALLBACK_TIME_END(handle)            \
     if (metrics) {                                                            \
         bsl::int64_t readProcessingStopTime = bsls::TimeUtil::getTimer();     \
         bsl::int64_t readProcessingTime =                                     \
@@ -317,21 +340,25 @@ ProactorMetricsGuard::~ProactorMetricsGuard()
         bsls::TimeInterval duration;                                          \
         duration.setTotalNanoseconds(readProcessingTime);                     \
         metrics->logReadCallback(duration);                                   \
+        if (NTCCFG_UNLIKELY(ntcs::Watchdog::isStalled(duration))) {           \
+            ntcs::Watchdog::reportStall("read", handle, duration);            \
+        }                                                                     \
     }
 
 #else
 
 #define NTCS_PROACTORMETRICS_GET()
+#define NTCS_PROACTORMETRICS_GET_THREAD_LOCAL()
 #define NTCS_PROACTORMETRICS_UPDATE_INTERRUPTS(numSignals)
 #define NTCS_PROACTORMETRICS_UPDATE_POLL(numReadable, numWritable, numErrors)
 #define NTCS_PROACTORMETRICS_UPDATE_DEFERRED_SOCKET()
 #define NTCS_PROACTORMETRICS_UPDATE_SPURIOUS_WAKEUP()
 #define NTCS_PROACTORMETRICS_UPDATE_ERROR_CALLBACK_TIME_BEGIN()
-#define NTCS_PROACTORMETRICS_UPDATE_ERROR_CALLBACK_TIME_END()
+#define NTCS_PROACTORMETRICS_UPDATE_ERROR_CALLBACK_TIME_END(handle)
 #define NTCS_PROACTORMETRICS_UPDATE_WRITE_CALLBACK_TIME_BEGIN()
-#define NTCS_PROACTORMETRICS_UPDATE_WRITE_CALLBACK_TIME_END()
+#define NTCS_PROACTORMETRICS_UPDATE_WRITE_CALLBACK_TIME_END(handle)
 #define NTCS_PROACTORMETRICS_UPDATE_READ_CALLBACK_TIME_BEGIN()
-#define NTCS_PROACTORMETRICS_UPDATE_READ_CALLBACK_TIME_END()
+#define NTCS_PROACTORMETRICS_UPDATE_READ_CALLBACK_TIME_END(handle)
 
 #endif
 
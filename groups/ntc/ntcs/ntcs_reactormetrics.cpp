@@ -56,7 +56,10 @@ const ntci::MetricMetadata ReactorMetrics::STATISTICS[] = {
     NTCI_METRIC_METADATA_SUMMARY(wakeupsSpurious),
     NTCI_METRIC_METADATA_SUMMARY(timeProcessingReadability),
     NTCI_METRIC_METADATA_SUMMARY(timeProcessingWritability),
-    NTCI_METRIC_METADATA_SUMMARY(timeProcessingError)};
+    NTCI_METRIC_METADATA_SUMMARY(timeProcessingError),
+    NTCI_METRIC_METADATA_HISTOGRAM(timeProcessingCallback),
+    NTCI_METRIC_METADATA_SUMMARY(callbacksStalled),
+    NTCI_METRIC_METADATA_HISTOGRAM(timerLag)};
 
 ReactorMetrics::ReactorMetrics(const bslstl::StringRef& prefix,
                                const bslstl::StringRef& objectName,
@@ -71,6 +74,9 @@ ReactorMetrics::ReactorMetrics(const bslstl::StringRef& prefix,
 , d_readProcessingTime()
 , d_writeProcessingTime()
 , d_errorProcessingTime()
+, d_callbackTime(1.0, basicAllocator)
+, d_numCallbacksStalled()
+, d_timerLag(1.0, basicAllocator)
 , d_prefix(prefix, basicAllocator)
 , d_objectName(objectName, basicAllocator)
 , d_parent_sp()
@@ -93,6 +99,9 @@ ReactorMetrics::ReactorMetrics(
 , d_readProcessingTime()
 , d_writeProcessingTime()
 , d_errorProcessingTime()
+, d_callbackTime(1.0, basicAllocator)
+, d_numCallbacksStalled()
+, d_timerLag(1.0, basicAllocator)
 , d_prefix(basicAllocator)
 , d_objectName(basicAllocator)
 , d_parent_sp(parent)
@@ -155,9 +164,19 @@ void ReactorMetrics::logSpuriousWakeup()
     }
 }
 
+void ReactorMetrics::logCallback(const bsls::TimeInterval& duration)
+{
+    d_callbackTime.update(static_cast<double>(duration.totalMicroseconds()));
+
+    if (NTCCFG_UNLIKELY(ntcs::Watchdog::isStalled(duration))) {
+        d_numCallbacksStalled.update(1);
+    }
+}
+
 void ReactorMetrics::logReadCallback(const bsls::TimeInterval& duration)
 {
     d_readProcessingTime.update(duration.totalSecondsAsDouble());
+    this->logCallback(duration);
 
     if (d_parent_sp) {
         d_parent_sp->logReadCallback(duration);
@@ -167,6 +186,7 @@ void ReactorMetrics::logReadCallback(const bsls::TimeInterval& duration)
 void ReactorMetrics::logWriteCallback(const bsls::TimeInterval& duration)
 {
     d_writeProcessingTime.update(duration.totalSecondsAsDouble());
+    this->logCallback(duration);
 
     if (d_parent_sp) {
         d_parent_sp->logWriteCallback(duration);
@@ -176,12 +196,22 @@ void ReactorMetrics::logWriteCallback(const bsls::TimeInterval& duration)
 void ReactorMetrics::logErrorCallback(const bsls::TimeInterval& duration)
 {
     d_errorProcessingTime.update(duration.totalSecondsAsDouble());
+    this->logCallback(duration);
 
     if (d_parent_sp) {
         d_parent_sp->logErrorCallback(duration);
     }
 }
 
+void ReactorMetrics::logTimerLag(const bsls::TimeInterval& lag)
+{
+    d_timerLag.update(static_cast<double>(lag.totalMicroseconds()));
+
+    if (d_parent_sp) {
+        d_parent_sp->logTimerLag(lag);
+    }
+}
+
 void ReactorMetrics::getStats(bdld::ManagedDatum* result)
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
@@ -211,6 +241,12 @@ void ReactorMetrics::getStats(bdld::ManagedDatum* result)
 
     d_errorProcessingTime.collectSummary(&array, &index);
 
+    d_callbackTime.collectHistogram(&array, &index);
+
+    d_numCallbacksStalled.collectSummary(&array, &index);
+
+    d_timerLag.collectHistogram(&array, &index);
+
     *array.length() = numOrdinals();
 
     result->adopt(bdld::Datum::adoptArray(array));
@@ -289,10 +325,10 @@ const bsl::shared_ptr<ntci::ReactorMetrics>& ReactorMetrics::parent() const
     return d_parent_sp;
 }
 
-ntcs::ReactorMetrics* ReactorMetrics::setThreadLocal(
-    ntcs::ReactorMetrics* metrics)
+ntci::ReactorMetrics* ReactorMetrics::setThreadLocal(
+    ntci::ReactorMetrics* metrics)
 {
-    ntcs::ReactorMetrics* previous = reinterpret_cast<ntcs::ReactorMetrics*>(
+    ntci::ReactorMetrics* previous = reinterpret_cast<ntci::ReactorMetrics*>(
         bslmt::ThreadUtil::getSpecific(s_key));
 
     int rc = bslmt::ThreadUtil::setSpecific(
@@ -303,9 +339,9 @@ ntcs::ReactorMetrics* ReactorMetrics::setThreadLocal(
     return previous;
 }
 
-ntcs::ReactorMetrics* ReactorMetrics::getThreadLocal()
+ntci::ReactorMetrics* ReactorMetrics::getThreadLocal()
 {
-    ntcs::ReactorMetrics* current = reinterpret_cast<ntcs::ReactorMetrics*>(
+    ntci::ReactorMetrics* current = reinterpret_cast<ntci::ReactorMetrics*>(
         bslmt::ThreadUtil::getSpecific(s_key));
 
     return current;
@@ -23,6 +23,7 @@ BSLS_IDENT("$Id: $")
 #include <ntci_metric.h>
 #include <ntci_monitorable.h>
 #include <ntci_reactormetrics.h>
+#include <ntcs_watchdog.h>
 #include <ntcscm_version.h>
 
 #include <bslmt_mutex.h>
@@ -55,6 +56,9 @@ class ReactorMetrics : public ntci::ReactorMetrics,
     ntci::Metric                          d_readProcessingTime;
     ntci::Metric                          d_writeProcessingTime;
     ntci::Metric                          d_errorProcessingTime;
+    ntci::MetricHistogram                 d_callbackTime;
+    ntci::Metric                          d_numCallbacksStalled;
+    ntci::MetricHistogram                 d_timerLag;
     bsl::string                           d_prefix;
     bsl::string                           d_objectName;
     bsl::shared_ptr<ntci::ReactorMetrics> d_parent_sp;
@@ -66,6 +70,11 @@ class ReactorMetrics : public ntci::ReactorMetrics,
     ReactorMetrics(const ReactorMetrics&) BSLS_KEYWORD_DELETED;
     ReactorMetrics& operator=(const ReactorMetrics&) BSLS_KEYWORD_DELETED;
 
+  private:
+    /// Log the specified 'duration' in any function to process a socket
+    /// and detect whether the function stalled the calling thread.
+    void logCallback(const bsls::TimeInterval& duration);
+
   public:
     /// Create new metrics for the specified 'objectName whose field names
     /// have the specified 'prefix'. Optionally specify a 'basicAllocator'
@@ -124,6 +133,10 @@ class ReactorMetrics : public ntci::ReactorMetrics,
     void logErrorCallback(const bsls::TimeInterval& duration)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Log the specified 'lag' between the deadline of the earliest timer
+    /// due and the time the timer was announced by the reactor thread.
+    void logTimerLag(const bsls::TimeInterval& lag) BSLS_KEYWORD_OVERRIDE;
+
     /// Load into the specified 'result' the array of statistics from the
     /// specified 'snapshot' for this object based on the specified
     /// 'operation': if 'operation' is e_CUMULATIVE then the statistics are
@@ -178,10 +191,11 @@ class ReactorMetrics : public ntci::ReactorMetrics,
 
     /// Set the specified 'metrics' as the metrics to use by this thread.
     /// Return the previous metrics used by this thread, if any.
-    static ntcs::ReactorMetrics* setThreadLocal(ntcs::ReactorMetrics* metrics);
+    static ntci::ReactorMetrics* setThreadLocal(
+        ntci::ReactorMetrics* metrics);
 
     /// Return the metrics to use by the current thread, if any.
-    static ntcs::ReactorMetrics* getThreadLocal();
+    static ntci::ReactorMetrics* getThreadLocal();
 };
 
 /// @internal @brief
@@ -199,8 +213,8 @@ class ReactorMetrics : public ntci::ReactorMetrics,
 /// @ingroup module_ntcs
 class ReactorMetricsGuard
 {
-    ntcs::ReactorMetrics* d_current_p;
-    ntcs::ReactorMetrics* d_previous_p;
+    ntci::ReactorMetrics* d_current_p;
+    ntci::ReactorMetrics* d_previous_p;
 
   private:
     ReactorMetricsGuard(const ReactorMetricsGuard&) BSLS_KEYWORD_DELETED;
@@ -211,7 +225,7 @@ class ReactorMetricsGuard
     /// Create a new metrics guard that installs the specified 'metrics'
     /// object into thread local storage and uninstalls it when this object
     /// is destroyed.
-    explicit ReactorMetricsGuard(ntcs::ReactorMetrics* metrics);
+    explicit ReactorMetricsGuard(ntci::ReactorMetrics* metrics);
 
     /// Uninstall the underlying metrics object from thread local storage
     /// then destroy this object.
@@ -219,7 +233,7 @@ class ReactorMetricsGuard
 };
 
 NTCCFG_INLINE
-ReactorMetricsGuard::ReactorMetricsGuard(ntcs::ReactorMetrics* metrics)
+ReactorMetricsGuard::ReactorMetricsGuard(ntci::ReactorMetrics* metrics)
 : d_current_p(metrics)
 , d_previous_p(0)
 {
@@ -239,7 +253,8 @@ ReactorMetricsGuard::~ReactorMetricsGuard()
 #if NTC_BUILD_WITH_METRICS
 
 #define NTCS_METRICS_GET()                                                    \
-    ntci::ReactorMetrics* metrics = result->d_metrics_sp.get()
+    ntci::ReactorMetrics* metrics = result->d_metrics_sp.get();               \
+    ntcs::ReactorMetricsGuard metricsGuard(metrics)
 
 #define NTCS_METRICS_UPDATE_INTERRUPTS(numSignals)                            \
     if (metrics) {                                                            \
@@ -267,7 +282,7 @@ ReactorMetricsGuard::~ReactorMetricsGuard()
         errorProcessingStartTime = bsls::TimeUtil::getTimer();                \
     }
 
-#define NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END()                         \
+#define NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END(handle)                   \
     if (metrics) {                                                            \
         bsl::int64_t errorProcessingStopTime = bsls::TimeUtil::getTimer();    \
         bsl::int64_t errorProcessingTime =                                    \
@@ -278,6 +293,9 @@ ReactorMetricsGuard::~ReactorMetricsGuard()
         bsls::TimeInterval duration;                                          \
         duration.setTotalNanoseconds(errorProcessingTime);                    \
         metrics->logErrorCallback(duration);                                  \
+        if (NTCCFG_UNLIKELY(ntcs::Watchdog::isStalled(duration))) {           \
+            ntcs::Watchdog::reportStall("error", handle, duration);           \
+        }                                                                     \
     }
 
 #define NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_BEGIN()                       \
@@ -286,7 +304,7 @@ ReactorMetricsGuard::~ReactorMetricsGuard()
         writeProcessingStartTime = bsls::TimeUtil::getTimer();                \
     }
 
-#define NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END()                         \
+#define NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END(handle)                   \
     if (metrics) {                                                            \
         bsl::int64_t writeProcessingStopTime = bsls::TimeUtil::getTimer();    \
         bsl::int64_t writeProcessingTime =                                    \
@@ -297,6 +315,9 @@ ReactorMetricsGuard::~ReactorMetricsGuard()
         bsls::TimeInterval duration;                                          \
         duration.setTotalNanoseconds(writeProcessingTime);                    \
         metrics->logWriteCallback(duration);                                  \
+        if (NTCCFG_UNLIKELY(ntcs::Watchdog::isStalled(duration))) {           \
+            ntcs::Watchdog::reportStall("write", handle, duration);           \
+        }                                                                     \
     }
 
 #define NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_BEGIN()                        \
@@ -305,7 +326,7 @@ ReactorMetricsGuard::~ReactorMetricsGuard()
         readProcessingStartTime = bsls::TimeUtil::getTimer();                 \
     }
 
-#define NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END()                          \
+#define NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END(handle)                    \
     if (metrics) {                                                            \
         bsl::int64_t readProcessingStopTime = bsls::TimeUtil::getTimer();     \
         bsl::int64_t readProcessingTime =                                     \
@@ -316,6 +337,9 @@ ReactorMetricsGuard::~ReactorMetricsGuard()
         bsls::TimeInterval duration;                                          \
         duration.setTotalNanoseconds(readProcessingTime);                     \
         metrics->logReadCallback(duration);                                   \
+        if (NTCCFG_UNLIKELY(ntcs::Watchdog::isStalled(duration))) {           \
+            ntcs::Watchdog::reportStall("read", handle, duration);            \
+        }                                                                     \
     }
 
 #else
@@ -326,11 +350,11 @@ ReactorMetricsGuard::~ReactorMetricsGuard()
 #define NTCS_METRICS_UPDATE_DEFERRED_SOCKET()
 #define NTCS_METRICS_UPDATE_SPURIOUS_WAKEUP()
 #define NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_BEGIN()
-#define NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END()
+#define NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END(handle)
 #define NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_BEGIN()
-#define NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END()
+#define NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_END(handle)
 #define NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_BEGIN()
-#define NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END()
+#define NTCS_METRICS_UPDATE_READ_CALLBACK_TIME_END(handle)
 
 #endif
 
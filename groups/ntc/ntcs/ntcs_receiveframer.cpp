@@ -0,0 +1,295 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_receiveframer.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntcs_receiveframer_cpp, "$Id$ $CSID$")
+
+#include <bdlbb_blobutil.h>
+#include <bsls_assert.h>
+#include <bsls_types.h>
+#include <bsl_climits.h>
+#include <bsl_cstring.h>
+#include <bsl_limits.h>
+
+namespace BloombergLP {
+namespace ntcs {
+
+namespace {
+
+/// Load into the specified 'size', 'prefix', and 'suffix' the framing of the
+/// first message at the front of the specified 'data' whose length is
+/// described by a length field according to the specified 'configuration'.
+/// Return the error. Return 'ntsa::Error::e_LIMIT' as soon as the length
+/// field is decoded if the message, less its prefix, is larger than the
+/// specified 'maxSize'.
+ntsa::Error frameLength(bsl::size_t*               size,
+                        bsl::size_t*               prefix,
+                        bsl::size_t*               suffix,
+                        const ntca::ReceiveFramer& configuration,
+                        const bdlbb::Blob&         data,
+                        bsl::size_t                maxSize)
+{
+    const bsl::size_t dataSize     = static_cast<bsl::size_t>(data.length());
+    const bsl::size_t lengthOffset = configuration.lengthOffset();
+    const bsl::size_t lengthSize   = configuration.lengthSize();
+    const bsl::size_t headerSize   = lengthOffset + lengthSize;
+
+    BSLS_ASSERT(lengthSize >= 1);
+    BSLS_ASSERT(lengthSize <= 8);
+
+    if (dataSize < headerSize) {
+        return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
+    }
+
+    unsigned char field[8];
+    bdlbb::BlobUtil::copy(reinterpret_cast<char*>(field),
+                          data,
+                          static_cast<int>(lengthOffset),
+                          static_cast<int>(lengthSize));
+
+    bsls::Types::Uint64 value = 0;
+    if (configuration.bigEndian()) {
+        for (bsl::size_t i = 0; i < lengthSize; ++i) {
+            value = (value << 8) | field[i];
+        }
+    }
+    else {
+        for (bsl::size_t i = lengthSize; i > 0; --i) {
+            value = (value << 8) | field[i - 1];
+        }
+    }
+
+    // Reject lengths that could not possibly be buffered in a blob, which
+    // also guards the signed arithmetic below against overflow.
+
+    if (value > static_cast<bsls::Types::Uint64>(INT_MAX)) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    const bsls::Types::Int64 remainder =
+        static_cast<bsls::Types::Int64>(value) +
+        configuration.lengthAdjustment();
+
+    if (remainder < 0) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    const bsl::size_t total =
+        headerSize + static_cast<bsl::size_t>(remainder);
+
+    if (total > static_cast<bsl::size_t>(INT_MAX) ||
+        total < configuration.strip())
+    {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    if (total - configuration.strip() > maxSize) {
+        return ntsa::Error(ntsa::Error::e_LIMIT);
+    }
+
+    if (dataSize < total) {
+        return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
+    }
+
+    *size   = total;
+    *prefix = configuration.strip();
+    *suffix = 0;
+
+    return ntsa::Error();
+}
+
+/// Load into the specified 'size', 'prefix', and 'suffix' the framing of the
+/// first message at the front of the specified 'data' terminated by the
+/// delimiter defined by the specified 'configuration', resuming the scan
+/// from the specified 'offset', and load into 'offset' where the scan
+/// stopped if no delimiter is found. Return the error. Return
+/// 'ntsa::Error::e_LIMIT' as soon as enough bytes have been scanned without
+/// finding a delimiter that the message, less its prefix and suffix, must be
+/// larger than the specified 'maxSize'.
+ntsa::Error frameDelimiter(bsl::size_t*               size,
+                           bsl::size_t*               prefix,
+                           bsl::size_t*               suffix,
+                           bsl::size_t*               offset,
+                           const ntca::ReceiveFramer& configuration,
+                           const bdlbb::Blob&         data,
+                           bsl::size_t                maxSize)
+{
+    const bslstl::StringRef delimiter     = configuration.delimiter();
+    const bsl::size_t       delimiterSize = delimiter.size();
+    const bsl::size_t       strip         = configuration.strip();
+
+    BSLS_ASSERT(delimiterSize >= 1);
+    BSLS_ASSERT(delimiterSize <=
+                static_cast<bsl::size_t>(
+                    ntca::ReceiveFramer::k_MAX_DELIMITER_SIZE));
+
+    // A delimiter ending beyond the limit would terminate a message larger
+    // than the maximum size, so the scan fails once it passes the limit.
+
+    bsl::size_t limit = bsl::numeric_limits<bsl::size_t>::max();
+    if (maxSize < limit - strip - delimiterSize) {
+        limit = strip + maxSize + delimiterSize;
+    }
+
+    // Resume the scan where the previous scan stopped, less the width of
+    // the delimiter so that a delimiter split between the data previously
+    // scanned and the data since received is detected.
+
+    bsl::size_t position = 0;
+    if (*offset >= delimiterSize) {
+        position = *offset - (delimiterSize - 1);
+    }
+
+    // Slide a window the width of the delimiter over the data so that
+    // delimiters split across blob buffers are detected without copying the
+    // data.
+
+    char        window[ntca::ReceiveFramer::k_MAX_DELIMITER_SIZE];
+    bsl::size_t windowSize = 0;
+    bsl::size_t skip       = position;
+
+    const int numDataBuffers = data.numDataBuffers();
+
+    for (int i = 0; i < numDataBuffers; ++i) {
+        const bdlbb::BlobBuffer& buffer = data.buffer(i);
+
+        const char* bufferData = buffer.data();
+        const int   bufferSize = (i == numDataBuffers - 1)
+                                     ? data.lastDataBufferLength()
+                                     : buffer.size();
+
+        if (skip >= static_cast<bsl::size_t>(bufferSize)) {
+            skip -= static_cast<bsl::size_t>(bufferSize);
+            continue;
+        }
+
+        for (int j = static_cast<int>(skip); j < bufferSize; ++j) {
+            const char c = bufferData[j];
+            ++position;
+
+            if (windowSize < delimiterSize) {
+                window[windowSize++] = c;
+            }
+            else {
+                bsl::memmove(window, window + 1, delimiterSize - 1);
+                window[delimiterSize - 1] = c;
+            }
+
+            if (windowSize == delimiterSize &&
+                window[delimiterSize - 1] == delimiter[delimiterSize - 1] &&
+                bsl::memcmp(window, delimiter.data(), delimiterSize) == 0)
+            {
+                *offset = 0;
+
+                if (position < strip + delimiterSize) {
+                    return ntsa::Error(ntsa::Error::e_INVALID);
+                }
+
+                *size   = position;
+                *prefix = strip;
+                *suffix = delimiterSize;
+
+                return ntsa::Error();
+            }
+
+            if (position >= limit) {
+                *offset = 0;
+                return ntsa::Error(ntsa::Error::e_LIMIT);
+            }
+        }
+
+        skip = 0;
+    }
+
+    *offset = position;
+
+    return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
+}
+
+}  // close unnamed namespace
+
+ReceiveFramer::ReceiveFramer()
+: d_configuration()
+, d_offset(0)
+{
+}
+
+ReceiveFramer::ReceiveFramer(const ntca::ReceiveFramer& configuration)
+: d_configuration(configuration)
+, d_offset(0)
+{
+}
+
+ReceiveFramer::~ReceiveFramer()
+{
+}
+
+ntsa::Error ReceiveFramer::frame(bsl::size_t*       size,
+                                 bsl::size_t*       prefix,
+                                 bsl::size_t*       suffix,
+                                 const bdlbb::Blob& data)
+{
+    return ReceiveFramer::frame(size, prefix, suffix, d_configuration, data);
+}
+
+ntsa::Error ReceiveFramer::frame(bsl::size_t*               size,
+                                 bsl::size_t*               prefix,
+                                 bsl::size_t*               suffix,
+                                 const ntca::ReceiveFramer& configuration,
+                                 const bdlbb::Blob&         data)
+{
+    bsl::size_t offset = 0;
+    return ReceiveFramer::frame(size,
+                                prefix,
+                                suffix,
+                                &offset,
+                                configuration,
+                                data,
+                                bsl::numeric_limits<bsl::size_t>::max());
+}
+
+ntsa::Error ReceiveFramer::frame(bsl::size_t*               size,
+                                 bsl::size_t*               prefix,
+                                 bsl::size_t*               suffix,
+                                 bsl::size_t*               offset,
+                                 const ntca::ReceiveFramer& configuration,
+                                 const bdlbb::Blob&         data,
+                                 bsl::size_t                maxSize)
+{
+    *size   = 0;
+    *prefix = 0;
+    *suffix = 0;
+
+    if (configuration.type() == ntca::ReceiveFramerType::e_LENGTH) {
+        return frameLength(size, prefix, suffix, configuration, data, maxSize);
+    }
+    else if (configuration.type() == ntca::ReceiveFramerType::e_DELIMITER) {
+        return frameDelimiter(size,
+                              prefix,
+                              suffix,
+                              offset,
+                              configuration,
+                              data,
+                              maxSize);
+    }
+    else {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,188 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCS_RECEIVEFRAMER
+#define INCLUDED_NTCS_RECEIVEFRAMER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntca_receiveframer.h>
+#include <ntccfg_platform.h>
+#include <ntci_receiveframer.h>
+#include <ntcscm_version.h>
+#include <ntsa_error.h>
+#include <bdlbb_blob.h>
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace ntcs {
+
+/// @internal @brief
+/// Provide a receive framer for the built-in framing strategies.
+///
+/// @details
+/// This class detects the boundaries of messages according to a
+/// 'ntca::ReceiveFramer' configuration: either by decoding a fixed-width
+/// length field at a fixed offset from the start of each message, or by
+/// scanning for the delimiter that terminates each message.
+///
+/// When framing by delimiter, a framer may resume the scan of the data from
+/// where its previous scan stopped, rather than rescanning the data from the
+/// beginning each time more data is received. A framer resumes its scan only
+/// when framing through the overload of 'frame' that accepts a maximum
+/// message size: the caller must then pass data that begins with the data
+/// passed to the previous call, unless that call detected a complete
+/// message, or 'reset' has been called since. Framing by either strategy
+/// through that overload fails with 'ntsa::Error::e_LIMIT' as soon as the
+/// message at the front of the data is known to be larger than the maximum
+/// size, without waiting for the entire message to be received.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntcs
+class ReceiveFramer : public ntci::ReceiveFramer
+{
+    ntca::ReceiveFramer d_configuration;
+    bsl::size_t         d_offset;
+
+  private:
+    ReceiveFramer(const ReceiveFramer&) BSLS_KEYWORD_DELETED;
+    ReceiveFramer& operator=(const ReceiveFramer&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new receive framer having a default configuration.
+    ReceiveFramer();
+
+    /// Create a new receive framer having the specified 'configuration'.
+    explicit ReceiveFramer(const ntca::ReceiveFramer& configuration);
+
+    /// Destroy this object.
+    ~ReceiveFramer() BSLS_KEYWORD_OVERRIDE;
+
+    /// Set the configuration of this object to the specified
+    /// 'configuration' and forget where the previous scan stopped.
+    void setConfiguration(const ntca::ReceiveFramer& configuration);
+
+    /// Forget where the previous scan stopped, so that the next scan
+    /// begins at the front of the data. Note that this function must be
+    /// called whenever data is removed from the front of the data other
+    /// than by removing a complete message detected by 'frame'.
+    void reset();
+
+    /// Load into the specified 'size' the number of bytes of the first
+    /// complete message at the front of the specified 'data', including its
+    /// framing, and load into the specified 'prefix' and 'suffix' the number
+    /// of bytes at the beginning and end, respectively, of that message that
+    /// should not be delivered to the user. Return the error. Note that an
+    /// error of 'ntsa::Error::e_WOULD_BLOCK' indicates that 'data' does not
+    /// yet contain a complete message, and any other error indicates that
+    /// 'data' is malformed and the stream cannot be framed. Also note that
+    /// this function always scans 'data' from the beginning.
+    ntsa::Error frame(bsl::size_t*       size,
+                      bsl::size_t*       prefix,
+                      bsl::size_t*       suffix,
+                      const bdlbb::Blob& data) BSLS_KEYWORD_OVERRIDE;
+
+    /// Load into the specified 'size', 'prefix', and 'suffix' the framing of
+    /// the first complete message at the front of the specified 'data',
+    /// resuming the scan of 'data' from where the previous scan stopped.
+    /// Return the error. Return 'ntsa::Error::e_LIMIT' if that message,
+    /// less its prefix and suffix, is known to be larger than the specified
+    /// 'maxSize', even if 'data' does not yet contain the entire message.
+    /// Note that an error of 'ntsa::Error::e_WOULD_BLOCK' indicates that
+    /// 'data' does not yet contain a complete message, and any other error
+    /// indicates that 'data' is malformed and the stream cannot be framed.
+    ntsa::Error frame(bsl::size_t*       size,
+                      bsl::size_t*       prefix,
+                      bsl::size_t*       suffix,
+                      const bdlbb::Blob& data,
+                      bsl::size_t        maxSize);
+
+    /// Return the configuration of this object.
+    const ntca::ReceiveFramer& configuration() const;
+
+    /// Load into the specified 'size', 'prefix', and 'suffix' the framing of
+    /// the first complete message at the front of the specified 'data'
+    /// according to the specified 'configuration'. Return the error. Note
+    /// that an error of 'ntsa::Error::e_WOULD_BLOCK' indicates that 'data'
+    /// does not yet contain a complete message, and any other error
+    /// indicates that 'data' is malformed and the stream cannot be framed.
+    static ntsa::Error frame(bsl::size_t*               size,
+                             bsl::size_t*               prefix,
+                             bsl::size_t*               suffix,
+                             const ntca::ReceiveFramer& configuration,
+                             const bdlbb::Blob&         data);
+
+    /// Load into the specified 'size', 'prefix', and 'suffix' the framing of
+    /// the first complete message at the front of the specified 'data'
+    /// according to the specified 'configuration', resuming the scan of
+    /// 'data' from the specified 'offset', and load into 'offset' where the
+    /// scan stopped if 'data' does not yet contain a complete message, or
+    /// zero otherwise. Return the error. Return 'ntsa::Error::e_LIMIT' if
+    /// that message, less its prefix and suffix, is known to be larger than
+    /// the specified 'maxSize', even if 'data' does not yet contain the
+    /// entire message. Note that an error of 'ntsa::Error::e_WOULD_BLOCK'
+    /// indicates that 'data' does not yet contain a complete message, and
+    /// any other error indicates that 'data' is malformed and the stream
+    /// cannot be framed.
+    static ntsa::Error frame(bsl::size_t*               size,
+                             bsl::size_t*               prefix,
+                             bsl::size_t*               suffix,
+                             bsl::size_t*               offset,
+                             const ntca::ReceiveFramer& configuration,
+                             const bdlbb::Blob&         data,
+                             bsl::size_t                maxSize);
+};
+
+NTCCFG_INLINE
+void ReceiveFramer::setConfiguration(const ntca::ReceiveFramer& configuration)
+{
+    d_configuration = configuration;
+    d_offset        = 0;
+}
+
+NTCCFG_INLINE
+void ReceiveFramer::reset()
+{
+    d_offset = 0;
+}
+
+NTCCFG_INLINE
+ntsa::Error ReceiveFramer::frame(bsl::size_t*       size,
+                                 bsl::size_t*       prefix,
+                                 bsl::size_t*       suffix,
+                                 const bdlbb::Blob& data,
+                                 bsl::size_t        maxSize)
+{
+    return ReceiveFramer::frame(size,
+                                prefix,
+                                suffix,
+                                &d_offset,
+                                d_configuration,
+                                data,
+                                maxSize);
+}
+
+NTCCFG_INLINE
+const ntca::ReceiveFramer& ReceiveFramer::configuration() const
+{
+    return d_configuration;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
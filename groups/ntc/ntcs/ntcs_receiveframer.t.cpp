@@ -0,0 +1,383 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_receiveframer.h>
+
+#include <ntccfg_test.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+//
+//-----------------------------------------------------------------------------
+
+// [ 1]
+// [ 2]
+// [ 3]
+// [ 4]
+// [ 5]
+//-----------------------------------------------------------------------------
+// [ 1]
+// [ 2]
+// [ 3]
+// [ 4]
+// [ 5]
+//-----------------------------------------------------------------------------
+
+namespace test {
+
+/// Append the specified 'size' bytes at the specified 'data' to the specified
+/// 'blob'.
+void append(bdlbb::Blob* blob, const char* data, bsl::size_t size)
+{
+    bdlbb::BlobUtil::append(blob, data, static_cast<int>(size));
+}
+
+}  // close namespace 'test'
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: Messages prefixed by a big-endian or little-endian length
+    // field are framed once complete, and leading bytes are stripped.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+        bsl::size_t size   = 0;
+        bsl::size_t prefix = 0;
+        bsl::size_t suffix = 0;
+
+        bdlbb::PooledBlobBufferFactory blobBufferFactory(3, &ta);
+
+        // Big-endian, 2-byte length at offset 1 counting the entire message.
+
+        {
+            ntca::ReceiveFramer configuration;
+            configuration.setType(ntca::ReceiveFramerType::e_LENGTH);
+            configuration.setLengthOffset(1);
+            configuration.setLengthSize(2);
+            configuration.setBigEndian(true);
+            configuration.setLengthAdjustment(-3);
+            configuration.setStrip(3);
+
+            ntcs::ReceiveFramer framer(configuration);
+
+            bdlbb::Blob data(&blobBufferFactory, &ta);
+            test::append(&data, "X\x00\x08", 3);
+
+            error = framer.frame(&size, &prefix, &suffix, data);
+            NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+
+            test::append(&data, "abcde", 5);
+            test::append(&data, "Y", 1);
+
+            error = framer.frame(&size, &prefix, &suffix, data);
+            NTCCFG_TEST_OK(error);
+
+            NTCCFG_TEST_EQ(size, 8);
+            NTCCFG_TEST_EQ(prefix, 3);
+            NTCCFG_TEST_EQ(suffix, 0);
+        }
+
+        // Little-endian, 4-byte length at offset 0 counting the body.
+
+        {
+            ntca::ReceiveFramer configuration;
+            configuration.setType(ntca::ReceiveFramerType::e_LENGTH);
+            configuration.setLengthSize(4);
+            configuration.setBigEndian(false);
+
+            ntcs::ReceiveFramer framer(configuration);
+
+            bdlbb::Blob data(&blobBufferFactory, &ta);
+            test::append(&data, "\x05\x00\x00\x00" "abcd", 8);
+
+            error = framer.frame(&size, &prefix, &suffix, data);
+            NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+
+            test::append(&data, "e", 1);
+
+            error = framer.frame(&size, &prefix, &suffix, data);
+            NTCCFG_TEST_OK(error);
+
+            NTCCFG_TEST_EQ(size, 9);
+            NTCCFG_TEST_EQ(prefix, 0);
+            NTCCFG_TEST_EQ(suffix, 0);
+        }
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: Messages terminated by a delimiter are framed once complete,
+    // even when the delimiter spans blob buffers.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+        bsl::size_t size   = 0;
+        bsl::size_t prefix = 0;
+        bsl::size_t suffix = 0;
+
+        bdlbb::PooledBlobBufferFactory blobBufferFactory(3, &ta);
+
+        ntca::ReceiveFramer configuration;
+        configuration.setType(ntca::ReceiveFramerType::e_DELIMITER);
+        configuration.setDelimiter("\r\n");
+
+        ntcs::ReceiveFramer framer(configuration);
+
+        bdlbb::Blob data(&blobBufferFactory, &ta);
+        test::append(&data, "hello\r", 6);
+
+        error = framer.frame(&size, &prefix, &suffix, data);
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+
+        test::append(&data, "\nworld", 6);
+
+        error = framer.frame(&size, &prefix, &suffix, data);
+        NTCCFG_TEST_OK(error);
+
+        NTCCFG_TEST_EQ(size, 7);
+        NTCCFG_TEST_EQ(prefix, 0);
+        NTCCFG_TEST_EQ(suffix, 2);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(3)
+{
+    // Concern: Malformed messages are detected.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+        bsl::size_t size   = 0;
+        bsl::size_t prefix = 0;
+        bsl::size_t suffix = 0;
+
+        bdlbb::PooledBlobBufferFactory blobBufferFactory(3, &ta);
+
+        // The length, after adjustment, is negative.
+
+        {
+            ntca::ReceiveFramer configuration;
+            configuration.setType(ntca::ReceiveFramerType::e_LENGTH);
+            configuration.setLengthSize(1);
+            configuration.setLengthAdjustment(-2);
+
+            ntcs::ReceiveFramer framer(configuration);
+
+            bdlbb::Blob data(&blobBufferFactory, &ta);
+            test::append(&data, "\x01" "a", 2);
+
+            error = framer.frame(&size, &prefix, &suffix, data);
+            NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_INVALID));
+        }
+
+        // The message is shorter than the number of bytes to strip.
+
+        {
+            ntca::ReceiveFramer configuration;
+            configuration.setType(ntca::ReceiveFramerType::e_DELIMITER);
+            configuration.setDelimiter(";");
+            configuration.setStrip(2);
+
+            ntcs::ReceiveFramer framer(configuration);
+
+            bdlbb::Blob data(&blobBufferFactory, &ta);
+            test::append(&data, "a;", 2);
+
+            error = framer.frame(&size, &prefix, &suffix, data);
+            NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_INVALID));
+        }
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(4)
+{
+    // Concern: Messages larger than the maximum size are rejected as soon as
+    // they are known to be too large, before they are entirely received.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+        bsl::size_t size   = 0;
+        bsl::size_t prefix = 0;
+        bsl::size_t suffix = 0;
+
+        bdlbb::PooledBlobBufferFactory blobBufferFactory(3, &ta);
+
+        // The length field declares a message larger than the maximum size.
+
+        {
+            ntca::ReceiveFramer configuration;
+            configuration.setType(ntca::ReceiveFramerType::e_LENGTH);
+            configuration.setLengthSize(2);
+            configuration.setBigEndian(true);
+            configuration.setStrip(2);
+
+            ntcs::ReceiveFramer framer(configuration);
+
+            bdlbb::Blob data(&blobBufferFactory, &ta);
+            test::append(&data, "\x00", 1);
+
+            error = framer.frame(&size, &prefix, &suffix, data, 4);
+            NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+
+            test::append(&data, "\x05" "ab", 3);
+
+            error = framer.frame(&size, &prefix, &suffix, data, 4);
+            NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_LIMIT));
+
+            error = framer.frame(&size, &prefix, &suffix, data, 5);
+            NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+        }
+
+        // No delimiter is found within the maximum size.
+
+        {
+            ntca::ReceiveFramer configuration;
+            configuration.setType(ntca::ReceiveFramerType::e_DELIMITER);
+            configuration.setDelimiter("\r\n");
+
+            ntcs::ReceiveFramer framer(configuration);
+
+            bdlbb::Blob data(&blobBufferFactory, &ta);
+            test::append(&data, "abcde", 5);
+
+            error = framer.frame(&size, &prefix, &suffix, data, 4);
+            NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+
+            test::append(&data, "f", 1);
+
+            error = framer.frame(&size, &prefix, &suffix, data, 4);
+            NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_LIMIT));
+        }
+
+        // A delimiter immediately following the maximum size is accepted.
+
+        {
+            ntca::ReceiveFramer configuration;
+            configuration.setType(ntca::ReceiveFramerType::e_DELIMITER);
+            configuration.setDelimiter("\r\n");
+
+            ntcs::ReceiveFramer framer(configuration);
+
+            bdlbb::Blob data(&blobBufferFactory, &ta);
+            test::append(&data, "abcd\r\n", 6);
+
+            error = framer.frame(&size, &prefix, &suffix, data, 4);
+            NTCCFG_TEST_OK(error);
+
+            NTCCFG_TEST_EQ(size, 6);
+            NTCCFG_TEST_EQ(prefix, 0);
+            NTCCFG_TEST_EQ(suffix, 2);
+        }
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(5)
+{
+    // Concern: A delimiter scan resumes where the previous scan stopped,
+    // and detects delimiters split between the data previously scanned and
+    // the data since received.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+        bsl::size_t size   = 0;
+        bsl::size_t prefix = 0;
+        bsl::size_t suffix = 0;
+
+        bdlbb::PooledBlobBufferFactory blobBufferFactory(3, &ta);
+
+        ntca::ReceiveFramer configuration;
+        configuration.setType(ntca::ReceiveFramerType::e_DELIMITER);
+        configuration.setDelimiter("END");
+
+        ntcs::ReceiveFramer framer(configuration);
+
+        const bsl::size_t k_MAX_SIZE = 1024;
+
+        bdlbb::Blob data(&blobBufferFactory, &ta);
+
+        test::append(&data, "abcdefgE", 8);
+
+        error = framer.frame(&size, &prefix, &suffix, data, k_MAX_SIZE);
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+
+        test::append(&data, "N", 1);
+
+        error = framer.frame(&size, &prefix, &suffix, data, k_MAX_SIZE);
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+
+        test::append(&data, "Dxyz", 4);
+
+        error = framer.frame(&size, &prefix, &suffix, data, k_MAX_SIZE);
+        NTCCFG_TEST_OK(error);
+
+        NTCCFG_TEST_EQ(size, 10);
+        NTCCFG_TEST_EQ(prefix, 0);
+        NTCCFG_TEST_EQ(suffix, 3);
+
+        // After the message is consumed, the next scan starts from the front
+        // of the remaining data.
+
+        bdlbb::BlobUtil::erase(&data, 0, static_cast<int>(size));
+        framer.reset();
+
+        test::append(&data, "EN", 2);
+
+        error = framer.frame(&size, &prefix, &suffix, data, k_MAX_SIZE);
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+
+        test::append(&data, "D", 1);
+
+        error = framer.frame(&size, &prefix, &suffix, data, k_MAX_SIZE);
+        NTCCFG_TEST_OK(error);
+
+        NTCCFG_TEST_EQ(size, 6);
+        NTCCFG_TEST_EQ(prefix, 0);
+        NTCCFG_TEST_EQ(suffix, 3);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+    NTCCFG_TEST_REGISTER(3);
+    NTCCFG_TEST_REGISTER(4);
+    NTCCFG_TEST_REGISTER(5);
+}
+NTCCFG_TEST_DRIVER_END;
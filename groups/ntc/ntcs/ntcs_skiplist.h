@@ -266,6 +266,13 @@ class SkipListPair
 /// minimum.  Also, in comparison with bdlcc::Skiplist, this component is not
 /// thread safe at all (and thus it's faster).
 ///
+/// Nodes are pooled by level in free lists that are not thread safe and that
+/// are replenished in geometrically-growing blocks from the allocator
+/// supplied at construction.  Once the list has reached its steady-state
+/// length, adding, removing, and updating pairs does not allocate memory, so
+/// an owner that already serializes access to the list may supply an
+/// allocator that is not thread safe.
+///
 /// SkipList is a randomized data structure. SkipList has two main properties:
 /// length and level (listLevel in this description).  length of SkipList is a
 /// number of its nodes and listLevel is a maximum node level which has ever
@@ -28,12 +28,15 @@
 #include <ntci_log.h>
 
 #include <bdlb_random.h>
+#include <bslma_testallocator.h>
 #include <bsls_nameof.h>
+#include <bsls_stopwatch.h>
 #include <bslstl_array.h>
 #include <bslstl_list.h>
 #include <bslstl_multimap.h>
 #include <bslstl_set.h>
 #include <bsltf_templatetestfacility.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 
@@ -1087,6 +1090,110 @@ NTCCFG_TEST_CASE(13)
     }
 }
 
+// This test measures the throughput of 'addR', 'remove', and 'updateR' under
+// timer-like churn and verifies that, once the list has reached its
+// steady-state length, the churn is satisfied from the node pools without
+// allocating memory.
+
+NTCCFG_TEST_CASE(14)
+{
+    NTCI_LOG_CONTEXT();
+
+    ntccfg::TestAllocator ta;
+    {
+        typedef ntcs::SkipList<bsl::int64_t, int> SkipList;
+
+        const int k_NUM_ITEMS  = 1024;
+        const int k_NUM_ROUNDS = 100;
+
+        bslma::TestAllocator listAllocator;
+
+        SkipList skipList(&listAllocator);
+
+        bsl::vector<SkipList::Pair*> pairs(&ta);
+        pairs.resize(k_NUM_ITEMS);
+
+        int          seed = 0x5eed;
+        bsl::int64_t now  = 0;
+
+        for (int i = 0; i < k_NUM_ITEMS; ++i) {
+            pairs[i] = skipList.addR(now + bdlb::Random::generate15(&seed), i);
+        }
+
+        const bsls::Types::Int64 numAllocationsAfterWarmup =
+            listAllocator.numAllocations();
+
+        bsls::Stopwatch stopwatch;
+
+        double insertTime = 0;
+        double removeTime = 0;
+        double updateTime = 0;
+
+        for (int round = 0; round < k_NUM_ROUNDS; ++round) {
+            now += 1000;
+
+            stopwatch.reset();
+            stopwatch.start();
+            for (int i = 0; i < k_NUM_ITEMS; ++i) {
+                int rc = skipList.updateR(
+                    pairs[i],
+                    now + bdlb::Random::generate15(&seed));
+                NTCCFG_TEST_EQ(rc, 0);
+            }
+            stopwatch.stop();
+            updateTime += stopwatch.elapsedTime();
+
+            stopwatch.reset();
+            stopwatch.start();
+            for (int i = 0; i < k_NUM_ITEMS; ++i) {
+                int rc = skipList.remove(pairs[i]);
+                NTCCFG_TEST_EQ(rc, 0);
+            }
+            stopwatch.stop();
+            removeTime += stopwatch.elapsedTime();
+
+            NTCCFG_TEST_TRUE(skipList.isEmpty());
+
+            stopwatch.reset();
+            stopwatch.start();
+            for (int i = 0; i < k_NUM_ITEMS; ++i) {
+                pairs[i] =
+                    skipList.addR(now + bdlb::Random::generate15(&seed), i);
+            }
+            stopwatch.stop();
+            insertTime += stopwatch.elapsedTime();
+
+            NTCCFG_TEST_EQ(skipList.length(), k_NUM_ITEMS);
+        }
+
+        const double numOperations =
+            static_cast<double>(k_NUM_ITEMS) * k_NUM_ROUNDS;
+
+        NTCI_LOG_DEBUG("SkipList addR:    %.0f operations/second",
+                       insertTime > 0 ? numOperations / insertTime : 0.0);
+        NTCI_LOG_DEBUG("SkipList remove:  %.0f operations/second",
+                       removeTime > 0 ? numOperations / removeTime : 0.0);
+        NTCI_LOG_DEBUG("SkipList updateR: %.0f operations/second",
+                       updateTime > 0 ? numOperations / updateTime : 0.0);
+
+        // Each per-level pool doubles its capacity whenever it is replenished,
+        // so the number of blocks ever allocated for a level is bounded by the
+        // logarithm of the maximum number of nodes at that level, independent
+        // of the number of operations performed.
+
+        const bsls::Types::Int64 numAllocationsDuringChurn =
+            listAllocator.numAllocations() - numAllocationsAfterWarmup;
+
+        NTCI_LOG_DEBUG("SkipList allocations during %.0f operations: %d",
+                       numOperations * 3,
+                       static_cast<int>(numAllocationsDuringChurn));
+
+        NTCCFG_TEST_LE(listAllocator.numAllocations(),
+                       1 + ntcs::SkipListConsts::k_MAX_NUM_LEVELS * 12);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
@@ -1102,5 +1209,6 @@ NTCCFG_TEST_DRIVER
     NTCCFG_TEST_REGISTER(11);
     NTCCFG_TEST_REGISTER(12);
     NTCCFG_TEST_REGISTER(13);
+    NTCCFG_TEST_REGISTER(14);
 }
 NTCCFG_TEST_DRIVER_END;
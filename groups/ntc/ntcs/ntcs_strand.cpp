@@ -20,7 +20,6 @@ BSLS_IDENT_RCSID(ntcs_strand_cpp, "$Id$ $CSID$")
 
 #include <ntccfg_bind.h>
 #include <ntcs_async.h>
-#include <bdlb_nullablevalue.h>
 #include <bdlf_bind.h>
 #include <bdlf_memfn.h>
 #include <bdlf_placeholder.h>
@@ -29,18 +28,8 @@ BSLS_IDENT_RCSID(ntcs_strand_cpp, "$Id$ $CSID$")
 #include <bsls_assert.h>
 #include <bsls_log.h>
 
-// Uncomment to enable logging from this component.
-// #define NTCS_STRAND_LOG 1
-
 #if NTCS_STRAND_LOG
 
-#define NTCS_STRAND_LOG_QUEUE_PUSHED(strandAddress, functorQueue, pending)    \
-    BSLS_LOG_INFO(                                                            \
-        "Strand %p pushed function onto queue, size = %d, pending = %d",      \
-        (strandAddress),                                                      \
-        (int)((functorQueue).size()),                                         \
-        (int)(pending));
-
 #define NTCS_STRAND_LOG_QUEUE_POPPED(strandAddress, functorQueue)             \
     BSLS_LOG_INFO("Strand %p popped %d functions from queue",                 \
                   (strandAddress),                                            \
@@ -54,10 +43,10 @@ BSLS_IDENT_RCSID(ntcs_strand_cpp, "$Id$ $CSID$")
                   (strandAddress),                                            \
                   (int)((functorQueue).size()));
 
-#define NTCS_STRAND_LOG_EXECUTION_COMPLETE(strandAddress, functorQueue)       \
+#define NTCS_STRAND_LOG_EXECUTION_COMPLETE(strandAddress, numExecuted)        \
     BSLS_LOG_INFO("Strand %p execution complete for %d functions",            \
                   (strandAddress),                                            \
-                  (int)((functorQueue).size()));
+                  (int)(numExecuted));
 
 #define NTCS_STRAND_LOG_ACTIVATION(strandAddress)                             \
     BSLS_LOG_INFO("Strand %p activating itself in its reactor",               \
@@ -65,11 +54,10 @@ BSLS_IDENT_RCSID(ntcs_strand_cpp, "$Id$ $CSID$")
 
 #else
 
-#define NTCS_STRAND_LOG_QUEUE_PUSHED(strandAddress, functorQueue, pending)
 #define NTCS_STRAND_LOG_QUEUE_POPPED(strandAddress, functorQueue)
 #define NTCS_STRAND_LOG_QUEUE_EMPTY(strandAddress)
 #define NTCS_STRAND_LOG_EXECUTION_STARTING(strandAddress, functorQueue)
-#define NTCS_STRAND_LOG_EXECUTION_COMPLETE(strandAddress, functorQueue)
+#define NTCS_STRAND_LOG_EXECUTION_COMPLETE(strandAddress, numExecuted)
 #define NTCS_STRAND_LOG_ACTIVATION(strandAddress)
 
 #endif
@@ -107,16 +95,22 @@ void Strand::invoke()
 {
 #if (NTCS_STRAND_IMP == NTCS_STRAND_IMP_GREEDY)
 
+    FunctorQueue functorQueue(d_allocator_p);
+
     while (true) {
-        bdlb::NullableValue<FunctorQueue> functorQueue(d_allocator_p);
         {
             NTCCFG_LOCK_SCOPE_ENTER(&d_functorQueueMutex);
 
             BSLS_ASSERT(d_pending);
 
+            // Return the nodes used by the previous batch to the shared
+            // queue so they are re-used by subsequent calls to 'execute'.
+
+            d_functorQueue.reclaim(&functorQueue);
+
             if (!d_functorQueue.empty()) {
-                functorQueue.makeValue().swap(d_functorQueue);
-                NTCS_STRAND_LOG_QUEUE_POPPED(this, functorQueue.value());
+                functorQueue.splice(&d_functorQueue);
+                NTCS_STRAND_LOG_QUEUE_POPPED(this, functorQueue);
             }
             else {
                 NTCS_STRAND_LOG_QUEUE_EMPTY(this);
@@ -127,27 +121,22 @@ void Strand::invoke()
             NTCCFG_LOCK_SCOPE_LEAVE(&d_functorQueueMutex);
         }
 
-        NTCS_STRAND_LOG_EXECUTION_STARTING(this, functorQueue.value());
-
-        FunctorQueue::iterator it = functorQueue.value().begin();
-        FunctorQueue::iterator et = functorQueue.value().end();
+        NTCS_STRAND_LOG_EXECUTION_STARTING(this, functorQueue);
 
+        bsl::size_t numExecuted;
         {
             ntci::StrandGuard strandGuard(this);
-
-            while (it != et) {
-                (*it)();
-                ++it;
-            }
+            numExecuted = functorQueue.execute();
         }
 
-        NTCS_STRAND_LOG_EXECUTION_COMPLETE(this, functorQueue.value());
+        NTCCFG_WARNING_UNUSED(numExecuted);
+        NTCS_STRAND_LOG_EXECUTION_COMPLETE(this, numExecuted);
     }
 
 #elif (NTCS_STRAND_IMP == NTCS_STRAND_IMP_FAIR)
 
-    Functor functor(NTCCFG_FUNCTION_INIT(d_allocator_p));
-    bool    activate = false;
+    ntccfg::InplaceFunction functor(d_allocator_p);
+    bool                    activate = false;
 
     {
         NTCCFG_LOCK_SCOPE_ENTER(&d_functorQueueMutex);
@@ -155,9 +144,7 @@ void Strand::invoke()
         BSLS_ASSERT(d_pending);
         BSLS_ASSERT(!d_functorQueue.empty());
 
-        functor.swap(d_functorQueue.front());
-
-        d_functorQueue.pop_front();
+        d_functorQueue.pop(&functor);
 
         activate  = !d_functorQueue.empty();
         d_pending = activate;
@@ -172,15 +159,7 @@ void Strand::invoke()
     }
 
     if (activate) {
-        ntcs::ObserverRef<ntci::Executor> executorRef(&d_executor);
-        if (executorRef) {
-            executorRef->execute(
-                NTCCFG_BIND(&Strand::invoke, this->getSelf(this)));
-        }
-        else {
-            ntcs::Async::execute(
-                NTCCFG_BIND(&Strand::invoke, this->getSelf(this)));
-        }
+        this->schedule();
     }
 
 #else
@@ -204,39 +183,26 @@ Strand::~Strand()
     BSLS_ASSERT(d_functorQueue.empty());
 }
 
-void Strand::execute(const Functor& function)
+void Strand::schedule()
 {
-    bool activate = false;
-    {
-        NTCCFG_LOCK_SCOPE_ENTER(&d_functorQueueMutex);
-
-        d_functorQueue.push_back(function);
-
-        NTCS_STRAND_LOG_QUEUE_PUSHED(this, d_functorQueue, d_pending);
-
-        if (!d_pending) {
-            d_pending = true;
-            activate  = true;
-        }
+    NTCS_STRAND_LOG_ACTIVATION(this);
 
-        NTCCFG_LOCK_SCOPE_LEAVE(&d_functorQueueMutex);
+    ntcs::ObserverRef<ntci::Executor> executorRef(&d_executor);
+    if (executorRef) {
+        executorRef->execute(
+            NTCCFG_BIND(&Strand::invoke, this->getSelf(this)));
     }
-
-    if (activate) {
-        NTCS_STRAND_LOG_ACTIVATION(this);
-
-        ntcs::ObserverRef<ntci::Executor> executorRef(&d_executor);
-        if (executorRef) {
-            executorRef->execute(
-                NTCCFG_BIND(&Strand::invoke, this->getSelf(this)));
-        }
-        else {
-            ntcs::Async::execute(
-                NTCCFG_BIND(&Strand::invoke, this->getSelf(this)));
-        }
+    else {
+        ntcs::Async::execute(
+            NTCCFG_BIND(&Strand::invoke, this->getSelf(this)));
     }
 }
 
+void Strand::execute(const Functor& function)
+{
+    this->execute<Functor>(function);
+}
+
 void Strand::moveAndExecute(FunctorSequence* functorSequence,
                             const Functor&   functor)
 {
@@ -244,9 +210,15 @@ void Strand::moveAndExecute(FunctorSequence* functorSequence,
     {
         NTCCFG_LOCK_SCOPE_ENTER(&d_functorQueueMutex);
 
-        d_functorQueue.splice(d_functorQueue.end(), *functorSequence);
+        for (FunctorSequence::iterator it = functorSequence->begin();
+             it != functorSequence->end();
+             ++it)
+        {
+            d_functorQueue.adopt(&*it);
+        }
+
         if (functor) {
-            d_functorQueue.push_back(functor);
+            d_functorQueue.push(functor);
         }
 
         if (!d_pending) {
@@ -257,31 +229,31 @@ void Strand::moveAndExecute(FunctorSequence* functorSequence,
         NTCCFG_LOCK_SCOPE_LEAVE(&d_functorQueueMutex);
     }
 
+    functorSequence->clear();
+
     if (activate) {
-        ntcs::ObserverRef<ntci::Executor> executorRef(&d_executor);
-        if (executorRef) {
-            executorRef->execute(
-                NTCCFG_BIND(&Strand::invoke, this->getSelf(this)));
-        }
-        else {
-            ntcs::Async::execute(
-                NTCCFG_BIND(&Strand::invoke, this->getSelf(this)));
-        }
+        this->schedule();
     }
 }
 
 void Strand::drain()
 {
+    FunctorQueue functorQueue(d_allocator_p);
+
     while (true) {
-        bdlb::NullableValue<FunctorQueue> functorQueue(d_allocator_p);
         {
             NTCCFG_LOCK_SCOPE_ENTER(&d_functorQueueMutex);
 
             BSLS_ASSERT(!d_pending);
 
+            // Return the nodes used by the previous batch to the shared
+            // queue so they are re-used by subsequent calls to 'execute'.
+
+            d_functorQueue.reclaim(&functorQueue);
+
             if (!d_functorQueue.empty()) {
-                functorQueue.makeValue().swap(d_functorQueue);
-                NTCS_STRAND_LOG_QUEUE_POPPED(this, functorQueue.value());
+                functorQueue.splice(&d_functorQueue);
+                NTCS_STRAND_LOG_QUEUE_POPPED(this, functorQueue);
             }
             else {
                 NTCS_STRAND_LOG_QUEUE_EMPTY(this);
@@ -291,21 +263,16 @@ void Strand::drain()
             NTCCFG_LOCK_SCOPE_LEAVE(&d_functorQueueMutex);
         }
 
-        NTCS_STRAND_LOG_EXECUTION_STARTING(this, functorQueue.value());
-
-        FunctorQueue::iterator it = functorQueue.value().begin();
-        FunctorQueue::iterator et = functorQueue.value().end();
+        NTCS_STRAND_LOG_EXECUTION_STARTING(this, functorQueue);
 
+        bsl::size_t numExecuted;
         {
             ntci::StrandGuard strandGuard(this);
-
-            while (it != et) {
-                (*it)();
-                ++it;
-            }
+            numExecuted = functorQueue.execute();
         }
 
-        NTCS_STRAND_LOG_EXECUTION_COMPLETE(this, functorQueue.value());
+        NTCCFG_WARNING_UNUSED(numExecuted);
+        NTCS_STRAND_LOG_EXECUTION_COMPLETE(this, numExecuted);
     }
 }
 
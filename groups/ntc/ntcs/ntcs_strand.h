@@ -19,16 +19,36 @@
 #include <bsls_ident.h>
 BSLS_IDENT("$Id: $")
 
+#include <ntccfg_inplacefunction.h>
 #include <ntccfg_platform.h>
 #include <ntci_executor.h>
 #include <ntci_strand.h>
 #include <ntcs_observer.h>
 #include <ntcscm_version.h>
+#include <bsls_log.h>
 #include <bsls_spinlock.h>
 #include <bsl_functional.h>
 #include <bsl_list.h>
 #include <bsl_memory.h>
 
+// Uncomment to enable logging from this component.
+// #define NTCS_STRAND_LOG 1
+
+#if NTCS_STRAND_LOG
+
+#define NTCS_STRAND_LOG_QUEUE_PUSHED(strandAddress, functorQueue, pending)    \
+    BSLS_LOG_INFO(                                                            \
+        "Strand %p pushed function onto queue, size = %d, pending = %d",      \
+        (strandAddress),                                                      \
+        (int)((functorQueue).size()),                                         \
+        (int)(pending));
+
+#else
+
+#define NTCS_STRAND_LOG_QUEUE_PUSHED(strandAddress, functorQueue, pending)
+
+#endif
+
 namespace BloombergLP {
 namespace ntcs {
 
@@ -44,7 +64,7 @@ class Strand : public ntci::Strand, public ntccfg::Shared<Strand>
 {
     /// Define a type alias for a queue of callbacks to
     /// execute on this thread.
-    typedef ntci::Executor::FunctorSequence FunctorQueue;
+    typedef ntccfg::InplaceFunctionQueue FunctorQueue;
 
     ntccfg::Object                 d_object;
     mutable ntccfg::Mutex          d_functorQueueMutex;
@@ -61,6 +81,9 @@ class Strand : public ntci::Strand, public ntccfg::Shared<Strand>
     /// Invoke the next functor in the queue.
     void invoke();
 
+    /// Arrange for the queue to be invoked on the executor.
+    void schedule();
+
   public:
     /// Create a new strand on the specified 'executor'. Optionally specify
     /// a 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
@@ -79,6 +102,13 @@ class Strand : public ntci::Strand, public ntccfg::Shared<Strand>
     /// previously deferred functions were executed.
     void execute(const Functor& function) BSLS_KEYWORD_OVERRIDE;
 
+    /// Defer the specified 'function' to execute sequentially, and
+    /// non-concurrently, after all previously deferred functions. Note that
+    /// 'function' is copied directly into the storage of the queue, inline
+    /// if it fits, rather than first into an 'ntci::Executor::Functor'.
+    template <typename FUNCTION>
+    void execute(const FUNCTION& function);
+
     /// Atomically defer the execution of the specified 'functorSequence'
     /// immediately followed by the specified 'functor', then clear the
     /// 'functorSequence'.
@@ -98,6 +128,30 @@ class Strand : public ntci::Strand, public ntccfg::Shared<Strand>
     bool isRunningInCurrentThread() const BSLS_KEYWORD_OVERRIDE;
 };
 
+template <typename FUNCTION>
+NTCCFG_INLINE void Strand::execute(const FUNCTION& function)
+{
+    bool activate = false;
+    {
+        NTCCFG_LOCK_SCOPE_ENTER(&d_functorQueueMutex);
+
+        d_functorQueue.push(function);
+
+        NTCS_STRAND_LOG_QUEUE_PUSHED(this, d_functorQueue, d_pending);
+
+        if (!d_pending) {
+            d_pending = true;
+            activate  = true;
+        }
+
+        NTCCFG_LOCK_SCOPE_LEAVE(&d_functorQueueMutex);
+    }
+
+    if (activate) {
+        this->schedule();
+    }
+}
+
 }  // end namespace ntci
 }  // end namespace BloombergLP
 #endif
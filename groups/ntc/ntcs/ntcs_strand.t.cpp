@@ -22,6 +22,7 @@
 #include <bdlf_memfn.h>
 #include <bdlf_placeholder.h>
 #include <bdlma_concurrentmultipoolallocator.h>
+#include <bslma_testallocator.h>
 #include <bslmt_barrier.h>
 #include <bslmt_latch.h>
 #include <bslmt_semaphore.h>
@@ -29,6 +30,8 @@
 #include <bslmt_threadutil.h>
 #include <bsls_stopwatch.h>
 #include <bsls_timeinterval.h>
+#include <bsls_types.h>
+#include <bsl_cstring.h>
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
 #include <bsl_unordered_map.h>
@@ -65,6 +68,10 @@ class Executor : public ntci::Executor
     /// Unblock all threads running this object.
     void stop();
 
+    /// Execute each job currently pending on the calling thread, then
+    /// return without blocking.
+    void poll();
+
     /// Defer the execution of the specified 'functor'.
     void execute(const Functor& functor) BSLS_KEYWORD_OVERRIDE;
 
@@ -122,6 +129,23 @@ void Executor::stop()
     d_functorQueueCondition.broadcast();
 }
 
+void Executor::poll()
+{
+    FunctorSequence functorQueue(d_allocator_p);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_functorQueueMutex);
+        functorQueue.swap(d_functorQueue);
+    }
+
+    for (FunctorSequence::iterator it = functorQueue.begin();
+         it != functorQueue.end();
+         ++it)
+    {
+        (*it)();
+    }
+}
+
 void Executor::execute(const Functor& functor)
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_functorQueueMutex);
@@ -143,6 +167,30 @@ void Executor::moveAndExecute(FunctorSequence* functorSequence,
     d_functorQueueCondition.signal();
 }
 
+/// Provide a function object that increments a counter, padded to the
+/// parameterized 'SIZE' in bytes.
+template <bsl::size_t SIZE>
+class Increment
+{
+    int* d_counter_p;
+    char d_padding[SIZE - sizeof(int*)];
+
+  public:
+    /// Create a new function object that increments the specified
+    /// 'counter'.
+    explicit Increment(int* counter)
+    : d_counter_p(counter)
+    {
+        bsl::memset(d_padding, 0, sizeof d_padding);
+    }
+
+    /// Increment the counter.
+    void operator()() const
+    {
+        ++*d_counter_p;
+    }
+};
+
 /// This class keeps track of the count of an action performed by a thread.
 /// This class is thread safe.
 class Count
@@ -954,9 +1002,74 @@ NTCCFG_TEST_CASE(2)
     NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
 
+NTCCFG_TEST_CASE(3)
+{
+    // Concern: Function objects executed directly on an 'ntcs::Strand' are
+    // copied into the storage of its queue, inline if they fit, so that
+    // executing them does not allocate memory once the strand has reached
+    // its steady-state number of pending functions.
+
+    ntccfg::TestAllocator ta;
+    {
+        const int k_NUM_PENDING = 16;
+        const int k_NUM_ROUNDS  = 100;
+
+        bslma::TestAllocator strandAllocator;
+
+        bsl::shared_ptr<test::Executor> executor;
+        executor.createInplace(&ta, &ta);
+
+        bsl::shared_ptr<ntcs::Strand> strand;
+        strand.createInplace(&ta, executor, &strandAllocator);
+
+        int counter = 0;
+
+        const test::Increment<56> inlineFunction(&counter);
+
+        bsls::Types::Int64 numAllocationsAfterWarmup = 0;
+
+        for (int round = 0; round < k_NUM_ROUNDS; ++round) {
+            for (int i = 0; i < k_NUM_PENDING; ++i) {
+                strand->execute(inlineFunction);
+            }
+
+            executor->poll();
+
+            if (round == 0) {
+                numAllocationsAfterWarmup = strandAllocator.numAllocations();
+            }
+            else {
+                NTCCFG_TEST_EQ(strandAllocator.numAllocations(),
+                               numAllocationsAfterWarmup);
+            }
+        }
+
+        NTCCFG_TEST_EQ(counter, k_NUM_PENDING * k_NUM_ROUNDS);
+
+        // Function objects too large to be stored inline, and functions
+        // executed through the 'ntci::Strand' protocol, are still executed
+        // in order.
+
+        counter = 0;
+
+        strand->execute(test::Increment<128>(&counter));
+
+        {
+            const bsl::shared_ptr<ntci::Strand> protocol = strand;
+            protocol->execute(ntci::Executor::Functor(inlineFunction));
+        }
+
+        executor->poll();
+
+        NTCCFG_TEST_EQ(counter, 2);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
     NTCCFG_TEST_REGISTER(2);
+    NTCCFG_TEST_REGISTER(3);
 }
 NTCCFG_TEST_DRIVER_END;
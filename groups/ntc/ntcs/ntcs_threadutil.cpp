@@ -116,6 +116,7 @@ ThreadContext::ThreadContext(bslma::Allocator* basicAllocator)
 , d_semaphore_p(0)
 , d_threadName(basicAllocator)
 , d_threadIndex(0)
+, d_numaNode_p(0)
 {
 }
 
@@ -20,6 +20,7 @@
 BSLS_IDENT("$Id: $")
 
 #include <ntccfg_platform.h>
+#include <ntcs_numautil.h>
 #include <ntcscm_version.h>
 #include <ntsa_error.h>
 #include <bslmt_condition.h>
@@ -74,6 +75,7 @@ struct ThreadContext {
     bslmt::Semaphore* d_semaphore_p;
     bsl::string       d_threadName;
     bsl::size_t       d_threadIndex;
+    const NumaNode*   d_numaNode_p;
 
     /// Create a new thread context. Optionally specify a 'basicAllocator'
     /// used to supply memory. If 'basicAllocator' is null, the currently
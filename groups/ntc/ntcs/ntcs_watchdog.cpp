@@ -0,0 +1,61 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_watchdog.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntcs_watchdog_cpp, "$Id$ $CSID$")
+
+#include <ntci_log.h>
+
+namespace BloombergLP {
+namespace ntcs {
+
+bsls::AtomicInt64 Watchdog::s_threshold(0);
+
+void Watchdog::setThreshold(const bsls::TimeInterval& threshold)
+{
+    bsls::Types::Int64 value = threshold.totalNanoseconds();
+    if (value < 0) {
+        value = 0;
+    }
+
+    s_threshold.storeRelaxed(value);
+}
+
+bsls::TimeInterval Watchdog::threshold()
+{
+    bsls::TimeInterval result;
+    result.setTotalNanoseconds(s_threshold.loadRelaxed());
+    return result;
+}
+
+NTCCFG_INLINE_NEVER
+void Watchdog::reportStall(const char*               operation,
+                           ntsa::Handle              handle,
+                           const bsls::TimeInterval& duration)
+{
+    NTCI_LOG_CONTEXT();
+    NTCI_LOG_CONTEXT_GUARD_DESCRIPTOR(handle);
+
+    NTCI_LOG_WARN("Callback to process %s stalled the thread for %d us, "
+                  "exceeding the threshold of %d us",
+                  operation,
+                  static_cast<int>(duration.totalMicroseconds()),
+                  static_cast<int>(Watchdog::threshold().totalMicroseconds()));
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,100 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCS_WATCHDOG
+#define INCLUDED_NTCS_WATCHDOG
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntccfg_platform.h>
+#include <ntcscm_version.h>
+#include <ntsa_handle.h>
+#include <bsls_atomic.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace ntcs {
+
+/// @internal @brief
+/// Provide utilities to detect callbacks that stall a driver thread.
+///
+/// @details
+/// A callback invoked by a reactor or proactor thread is said to stall the
+/// thread when the duration of the callback exceeds the process-wide stall
+/// threshold. The watchdog does not measure time itself. Drivers check the
+/// durations of socket callbacks they already measure for their metrics, so
+/// detecting stalls of socket callbacks requires no additional reads of the
+/// system clock. The chronology of each driver times each due timer
+/// callback, and each batch of deferred functions, only while stall
+/// detection is enabled. Stalls are not detected while the threshold is
+/// zero, which is the default.
+///
+/// @par Thread Safety
+/// This struct is thread safe.
+///
+/// @ingroup module_ntcs
+struct Watchdog {
+  private:
+    /// The stall threshold, in nanoseconds, or zero if stalls are not
+    /// detected.
+    static bsls::AtomicInt64 s_threshold;
+
+  public:
+    /// Set the duration of a callback beyond which the callback is considered
+    /// to stall the thread that invoked it to the specified 'threshold'. A
+    /// zero 'threshold' disables the detection of stalls.
+    static void setThreshold(const bsls::TimeInterval& threshold);
+
+    /// Return the duration of a callback beyond which the callback is
+    /// considered to stall the thread that invoked it, or zero if the
+    /// detection of stalls is disabled.
+    static bsls::TimeInterval threshold();
+
+    /// Return true if the detection of stalls is enabled, otherwise return
+    /// false.
+    static bool isEnabled();
+
+    /// Return true if a callback having the specified 'duration' stalls the
+    /// thread that invoked it, otherwise return false.
+    static bool isStalled(const bsls::TimeInterval& duration);
+
+    /// Report that the callback to process the specified 'operation' on the
+    /// specified 'handle' stalled the calling thread for the specified
+    /// 'duration'. The report is attributed to the log context of the calling
+    /// thread and to the 'handle', which is 'ntsa::k_INVALID_HANDLE' if the
+    /// callback is not associated with a socket.
+    static void reportStall(const char*               operation,
+                            ntsa::Handle              handle,
+                            const bsls::TimeInterval& duration);
+};
+
+NTCCFG_INLINE
+bool Watchdog::isEnabled()
+{
+    return s_threshold.loadRelaxed() > 0;
+}
+
+NTCCFG_INLINE
+bool Watchdog::isStalled(const bsls::TimeInterval& duration)
+{
+    const bsls::Types::Int64 threshold = s_threshold.loadRelaxed();
+    return threshold > 0 && duration.totalNanoseconds() > threshold;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
@@ -0,0 +1,76 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_watchdog.h>
+
+#include <ntccfg_test.h>
+
+#include <bsls_timeinterval.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+//
+//-----------------------------------------------------------------------------
+
+// [ 1]
+//-----------------------------------------------------------------------------
+// [ 1]
+//-----------------------------------------------------------------------------
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: Stalls are detected only when a callback exceeds the
+    // threshold, and not at all when the threshold is zero.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        NTCCFG_TEST_EQ(ntcs::Watchdog::threshold(), bsls::TimeInterval());
+        NTCCFG_TEST_FALSE(ntcs::Watchdog::isEnabled());
+
+        NTCCFG_TEST_FALSE(
+            ntcs::Watchdog::isStalled(bsls::TimeInterval(3600, 0)));
+
+        const bsls::TimeInterval threshold(0, 10 * 1000 * 1000);
+
+        ntcs::Watchdog::setThreshold(threshold);
+        NTCCFG_TEST_EQ(ntcs::Watchdog::threshold(), threshold);
+        NTCCFG_TEST_TRUE(ntcs::Watchdog::isEnabled());
+
+        NTCCFG_TEST_FALSE(ntcs::Watchdog::isStalled(bsls::TimeInterval()));
+        NTCCFG_TEST_FALSE(ntcs::Watchdog::isStalled(threshold));
+        NTCCFG_TEST_TRUE(ntcs::Watchdog::isStalled(
+            threshold + bsls::TimeInterval(0, 1)));
+
+        ntcs::Watchdog::setThreshold(bsls::TimeInterval(-1, 0));
+        NTCCFG_TEST_EQ(ntcs::Watchdog::threshold(), bsls::TimeInterval());
+        NTCCFG_TEST_FALSE(ntcs::Watchdog::isEnabled());
+
+        NTCCFG_TEST_FALSE(
+            ntcs::Watchdog::isStalled(bsls::TimeInterval(3600, 0)));
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+}
+NTCCFG_TEST_DRIVER_END;
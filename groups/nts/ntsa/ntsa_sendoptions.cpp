@@ -29,7 +29,7 @@ bool SendOptions::equals(const SendOptions& other) const
             d_foreignHandle == other.d_foreignHandle &&
             d_maxBytes == other.d_maxBytes &&
             d_maxBuffers == other.d_maxBuffers &&
-            d_zeroCopy == other.d_zeroCopy);
+            d_zeroCopy == other.d_zeroCopy && d_more == other.d_more);
 }
 
 bool SendOptions::less(const SendOptions& other) const
@@ -65,7 +65,16 @@ bool SendOptions::less(const SendOptions& other) const
     if (other.d_maxBuffers < d_maxBuffers) {
         return false;
     }
-    return d_zeroCopy < other.d_zeroCopy;
+
+    if (d_zeroCopy < other.d_zeroCopy) {
+        return true;
+    }
+
+    if (other.d_zeroCopy < d_zeroCopy) {
+        return false;
+    }
+
+    return d_more < other.d_more;
 }
 
 bsl::ostream& SendOptions::print(bsl::ostream& stream,
@@ -79,6 +88,7 @@ bsl::ostream& SendOptions::print(bsl::ostream& stream,
     printer.printAttribute("maxBytes", d_maxBytes);
     printer.printAttribute("maxBuffers", d_maxBuffers);
     printer.printAttribute("zeroCopy", d_zeroCopy);
+    printer.printAttribute("more", d_more);
     printer.end();
     return stream;
 }
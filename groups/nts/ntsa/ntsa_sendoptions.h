@@ -89,6 +89,15 @@ namespace ntsa {
 /// notification (which also indicates whether the data was referenced in-place
 /// or copied.)
 ///
+/// @li @b more:
+/// The flag that indicates the caller intends to send more data immediately
+/// after this data, so that the operating system may delay transmitting a
+/// partially-filled segment until that data is sent. This flag is intended
+/// for stream sockets. Note that this flag is advisory and only honored on
+/// platforms that support it, and that setting it on the last data to send
+/// may delay its transmission by up to the operating system's coalescing
+/// timeout.
+///
 /// @par Thread Safety
 /// This class is not thread safe.
 ///
@@ -100,6 +109,7 @@ class SendOptions
     bsl::size_t                         d_maxBytes;
     bsl::size_t                         d_maxBuffers;
     bool                                d_zeroCopy;
+    bool                                d_more;
 
   public:
     /// Create new send options having the default value.
@@ -137,6 +147,10 @@ class SendOptions
     /// Set the flag to request zero-copy semantics to the specified 'value'.
     void setZeroCopy(bool value);
 
+    /// Set the flag that indicates more data will be sent immediately after
+    /// this data to the specified 'value'.
+    void setMore(bool value);
+
     /// Return the remote endpoint to which the data should be sent.
     const bdlb::NullableValue<ntsa::Endpoint>& endpoint() const;
 
@@ -152,6 +166,10 @@ class SendOptions
     /// Return the flag that indicates zero-copy semantics are requested.
     bool zeroCopy() const;
 
+    /// Return the flag that indicates more data will be sent immediately
+    /// after this data.
+    bool more() const;
+
     /// Return true if this object has the same value as the specified
     /// 'other' object, otherwise return false.
     bool equals(const SendOptions& other) const;
@@ -219,6 +237,7 @@ SendOptions::SendOptions()
 , d_maxBytes(0)
 , d_maxBuffers(0)
 , d_zeroCopy(false)
+, d_more(false)
 {
 }
 
@@ -229,6 +248,7 @@ SendOptions::SendOptions(const SendOptions& original)
 , d_maxBytes(original.d_maxBytes)
 , d_maxBuffers(original.d_maxBuffers)
 , d_zeroCopy(original.d_zeroCopy)
+, d_more(original.d_more)
 {
 }
 
@@ -245,6 +265,7 @@ SendOptions& SendOptions::operator=(const SendOptions& other)
     d_maxBytes   = other.d_maxBytes;
     d_maxBuffers = other.d_maxBuffers;
     d_zeroCopy   = other.d_zeroCopy;
+    d_more       = other.d_more;
     return *this;
 }
 
@@ -256,6 +277,7 @@ void SendOptions::reset()
     d_maxBytes   = 0;
     d_maxBuffers = 0;
     d_zeroCopy   = false;
+    d_more       = false;
 }
 
 NTSCFG_INLINE
@@ -288,6 +310,12 @@ void SendOptions::setZeroCopy(bool value)
     d_zeroCopy = value;
 }
 
+NTSCFG_INLINE
+void SendOptions::setMore(bool value)
+{
+    d_more = value;
+}
+
 NTSCFG_INLINE
 const bdlb::NullableValue<ntsa::Endpoint>& SendOptions::endpoint() const
 {
@@ -318,6 +346,12 @@ bool SendOptions::zeroCopy() const
     return d_zeroCopy;
 }
 
+NTSCFG_INLINE
+bool SendOptions::more() const
+{
+    return d_more;
+}
+
 NTSCFG_INLINE
 bsl::ostream& operator<<(bsl::ostream& stream, const SendOptions& object)
 {
@@ -352,6 +386,7 @@ void hashAppend(HASH_ALGORITHM& algorithm, const SendOptions& value)
     hashAppend(algorithm, value.maxBytes());
     hashAppend(algorithm, value.maxBuffers());
     hashAppend(algorithm, value.zeroCopy());
+    hashAppend(algorithm, value.more());
 }
 
 }  // close package namespace
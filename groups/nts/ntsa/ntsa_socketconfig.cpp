@@ -76,6 +76,9 @@ void SocketConfig::setOption(const ntsa::SocketOption& option)
     else if (option.isZeroCopy()) {
         d_zeroCopy = option.zeroCopy();
     }
+    else if (option.isUnsentLowWatermark()) {
+        d_unsentLowWatermark = option.unsentLowWatermark();
+    }
 }
 
 void SocketConfig::getOption(ntsa::SocketOption*           option,
@@ -170,6 +173,11 @@ void SocketConfig::getOption(ntsa::SocketOption*           option,
             option->makeZeroCopy(d_zeroCopy.value());
         }
     }
+    else if (type == ntsa::SocketOptionType::e_UNSENT_LOW_WATERMARK) {
+        if (!d_unsentLowWatermark.isNull()) {
+            option->makeUnsentLowWatermark(d_unsentLowWatermark.value());
+        }
+    }
 }
 
 bool SocketConfig::equals(const SocketConfig& other) const
@@ -188,7 +196,8 @@ bool SocketConfig::equals(const SocketConfig& other) const
            d_inlineOutOfBandData == other.d_inlineOutOfBandData &&
            d_timestampIncomingData == other.d_timestampIncomingData &&
            d_timestampOutgoingData == other.d_timestampOutgoingData &&
-           d_zeroCopy == other.d_zeroCopy;
+           d_zeroCopy == other.d_zeroCopy &&
+           d_unsentLowWatermark == other.d_unsentLowWatermark;
 }
 
 bool SocketConfig::less(const SocketConfig& other) const
@@ -321,7 +330,15 @@ bool SocketConfig::less(const SocketConfig& other) const
         return false;
     }
 
-    return d_zeroCopy < other.d_zeroCopy;
+    if (d_zeroCopy < other.d_zeroCopy) {
+        return true;
+    }
+
+    if (other.d_zeroCopy < d_zeroCopy) {
+        return false;
+    }
+
+    return d_unsentLowWatermark < other.d_unsentLowWatermark;
 }
 
 bsl::ostream& SocketConfig::print(bsl::ostream& stream,
@@ -407,6 +424,11 @@ bsl::ostream& SocketConfig::print(bsl::ostream& stream,
         printer.printAttribute("zeroCopy", d_zeroCopy.value());
     }
 
+    if (!d_unsentLowWatermark.isNull()) {
+        printer.printAttribute("unsentLowWatermark",
+                               d_unsentLowWatermark.value());
+    }
+
     printer.end();
     return stream;
 }
@@ -112,6 +112,10 @@ namespace ntsa {
 /// The flag that indicates each send operation can request copy avoidance when
 /// enqueing data to the socket send buffer.
 ///
+/// @li @b unsentLowWatermark:
+/// The maximum amount of data in the socket send buffer not yet sent for the
+/// operating system to indicate the socket is writable.
+///
 /// @par Thread Safety
 /// This class is not thread safe.
 ///
@@ -135,6 +139,7 @@ class SocketConfig
     bdlb::NullableValue<bool>         d_timestampIncomingData;
     bdlb::NullableValue<bool>         d_timestampOutgoingData;
     bdlb::NullableValue<bool>         d_zeroCopy;
+    bdlb::NullableValue<bsl::size_t>  d_unsentLowWatermark;
 
   public:
     /// Create new send options having the default value.
@@ -229,6 +234,10 @@ class SocketConfig
     /// 'value'.
     void setZeroCopy(bool value);
 
+    /// Set the maximum amount of data in the socket send buffer not yet sent
+    /// for the socket to be considered writable to the specified 'value'.
+    void setUnsentLowWatermark(bsl::size_t value);
+
     /// Load into the specified 'option' the option for the specified
     /// 'type'. Note that if the option for the 'type' is not set, the
     /// resulting 'option->isUndefined()' will be true.
@@ -297,6 +306,10 @@ class SocketConfig
     /// avoidance when enqueing data to the socket send buffer.
     const bdlb::NullableValue<bool>& zeroCopy() const;
 
+    /// Return the maximum amount of data in the socket send buffer not yet
+    /// sent for the socket to be considered writable.
+    const bdlb::NullableValue<bsl::size_t>& unsentLowWatermark() const;
+
     /// Return true if this object has the same value as the specified
     /// 'other' object, otherwise return false.
     bool equals(const SocketConfig& other) const;
@@ -376,6 +389,7 @@ SocketConfig::SocketConfig()
 , d_timestampIncomingData()
 , d_timestampOutgoingData()
 , d_zeroCopy()
+, d_unsentLowWatermark()
 {
 }
 
@@ -398,6 +412,7 @@ SocketConfig::SocketConfig(const SocketConfig& original)
 , d_timestampIncomingData(original.d_timestampIncomingData)
 , d_timestampOutgoingData(original.d_timestampOutgoingData)
 , d_zeroCopy(original.d_zeroCopy)
+, d_unsentLowWatermark(original.d_unsentLowWatermark)
 {
 }
 
@@ -426,6 +441,7 @@ SocketConfig& SocketConfig::operator=(const SocketConfig& other)
     d_timestampIncomingData     = other.d_timestampIncomingData;
     d_timestampOutgoingData     = other.d_timestampOutgoingData;
     d_zeroCopy                  = other.d_zeroCopy;
+    d_unsentLowWatermark        = other.d_unsentLowWatermark;
 
     return *this;
 }
@@ -450,6 +466,7 @@ void SocketConfig::reset()
     d_timestampIncomingData.reset();
     d_timestampOutgoingData.reset();
     d_zeroCopy.reset();
+    d_unsentLowWatermark.reset();
 }
 
 NTSCFG_INLINE
@@ -554,6 +571,12 @@ void SocketConfig::setZeroCopy(bool value)
     d_zeroCopy = value;
 }
 
+NTSCFG_INLINE
+void SocketConfig::setUnsentLowWatermark(bsl::size_t value)
+{
+    d_unsentLowWatermark = value;
+}
+
 NTSCFG_INLINE
 const bdlb::NullableValue<bool>& SocketConfig::reuseAddress() const
 {
@@ -658,6 +681,13 @@ const bdlb::NullableValue<bool>& SocketConfig::zeroCopy() const
     return d_zeroCopy;
 }
 
+NTSCFG_INLINE
+const bdlb::NullableValue<bsl::size_t>& SocketConfig::unsentLowWatermark()
+    const
+{
+    return d_unsentLowWatermark;
+}
+
 NTSCFG_INLINE
 bsl::ostream& operator<<(bsl::ostream& stream, const SocketConfig& object)
 {
@@ -704,6 +734,7 @@ void hashAppend(HASH_ALGORITHM& algorithm, const SocketConfig& value)
     hashAppend(algorithm, value.timestampIncomingData());
     hashAppend(algorithm, value.timestampOutgoingData());
     hashAppend(algorithm, value.zeroCopy());
+    hashAppend(algorithm, value.unsentLowWatermark());
 }
 
 }  // close package namespace
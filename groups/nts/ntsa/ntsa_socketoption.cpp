@@ -89,6 +89,10 @@ SocketOption::SocketOption(const SocketOption& other)
         new (d_zeroCopy.buffer()) bool(
             other.d_zeroCopy.object());
         break;
+    case ntsa::SocketOptionType::e_UNSENT_LOW_WATERMARK:
+        new (d_unsentLowWatermark.buffer())
+            bsl::size_t(other.d_unsentLowWatermark.object());
+        break;
     default:
         BSLS_ASSERT(d_type == ntsa::SocketOptionType::e_UNDEFINED);
     }
@@ -164,6 +168,10 @@ SocketOption& SocketOption::operator=(const SocketOption& other)
         new (d_zeroCopy.buffer()) bool(
             other.d_zeroCopy.object());
         break;
+    case ntsa::SocketOptionType::e_UNSENT_LOW_WATERMARK:
+        new (d_unsentLowWatermark.buffer())
+            bsl::size_t(other.d_unsentLowWatermark.object());
+        break;
     default:
         BSLS_ASSERT(d_type == ntsa::SocketOptionType::e_UNDEFINED);
     }
@@ -649,6 +657,34 @@ bool& SocketOption::makeZeroCopy(bool value)
     return d_zeroCopy.object();
 }
 
+bsl::size_t& SocketOption::makeUnsentLowWatermark()
+{
+    if (d_type == ntsa::SocketOptionType::e_UNSENT_LOW_WATERMARK) {
+        d_unsentLowWatermark.object() = 0;
+    }
+    else {
+        this->reset();
+        new (d_unsentLowWatermark.buffer()) bsl::size_t();
+        d_type = ntsa::SocketOptionType::e_UNSENT_LOW_WATERMARK;
+    }
+
+    return d_unsentLowWatermark.object();
+}
+
+bsl::size_t& SocketOption::makeUnsentLowWatermark(bsl::size_t value)
+{
+    if (d_type == ntsa::SocketOptionType::e_UNSENT_LOW_WATERMARK) {
+        d_unsentLowWatermark.object() = value;
+    }
+    else {
+        this->reset();
+        new (d_unsentLowWatermark.buffer()) bsl::size_t(value);
+        d_type = ntsa::SocketOptionType::e_UNSENT_LOW_WATERMARK;
+    }
+
+    return d_unsentLowWatermark.object();
+}
+
 bool SocketOption::equals(const SocketOption& other) const
 {
     if (d_type != other.d_type) {
@@ -700,6 +736,9 @@ bool SocketOption::equals(const SocketOption& other) const
     case ntsa::SocketOptionType::e_ZERO_COPY:
         return d_zeroCopy.object() == 
                other.d_zeroCopy.object();
+    case ntsa::SocketOptionType::e_UNSENT_LOW_WATERMARK:
+        return d_unsentLowWatermark.object() ==
+               other.d_unsentLowWatermark.object();
     default:
         return true;
     }
@@ -755,6 +794,9 @@ bool SocketOption::less(const SocketOption& other) const
                other.d_timestampOutgoingData.object();
     case ntsa::SocketOptionType::e_ZERO_COPY:
         return d_zeroCopy.object() < other.d_zeroCopy.object();
+    case ntsa::SocketOptionType::e_UNSENT_LOW_WATERMARK:
+        return d_unsentLowWatermark.object() <
+               other.d_unsentLowWatermark.object();
     default:
         return true;
     }
@@ -816,6 +858,9 @@ bsl::ostream& SocketOption::print(bsl::ostream& stream,
     case ntsa::SocketOptionType::e_ZERO_COPY:
         stream << d_zeroCopy.object();
         break;
+    case ntsa::SocketOptionType::e_UNSENT_LOW_WATERMARK:
+        stream << d_unsentLowWatermark.object();
+        break;
     default:
         BSLS_ASSERT(d_type == ntsa::SocketOptionType::e_UNDEFINED);
         stream << "UNDEFINED";
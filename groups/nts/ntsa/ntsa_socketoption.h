@@ -117,6 +117,10 @@ namespace ntsa {
 /// The flag that indicates each send operation can request copy avoidance when
 /// enqueing data to the socket send buffer.
 ///
+/// @li @b unsentLowWatermark:
+/// The maximum amount of data in the socket send buffer not yet sent for the
+/// operating system to indicate the socket is writable.
+///
 /// @par Thread Safety
 /// This class is not thread safe.
 ///
@@ -141,6 +145,7 @@ class SocketOption
         bsls::ObjectBuffer<bool>         d_timestampIncomingData;
         bsls::ObjectBuffer<bool>         d_timestampOutgoingData;
         bsls::ObjectBuffer<bool>         d_zeroCopy;
+        bsls::ObjectBuffer<bsl::size_t>  d_unsentLowWatermark;
     };
 
     ntsa::SocketOptionType::Value d_type;
@@ -300,6 +305,15 @@ class SocketOption
     /// 'value'. Return a reference to the modifiable representation.
     bool& makeZeroCopy(bool value);
 
+    /// Select the "unsentLowWatermark" representation. Return a reference to
+    /// the modifiable representation.
+    bsl::size_t& makeUnsentLowWatermark();
+
+    /// Select the "unsentLowWatermark" representation initially having the
+    /// specified 'value'. Return a reference to the modifiable
+    /// representation.
+    bsl::size_t& makeUnsentLowWatermark(bsl::size_t value);
+
     /// Return a reference to the modifiable "reuseAddress" representation. The
     /// behavior is undefined unless 'isReuseAddress()' is true.
     bool& reuseAddress();
@@ -376,6 +390,11 @@ class SocketOption
     /// behavior is undefined unless 'isZeroCopy()' is true.
     bool& zeroCopy();
 
+    /// Return a reference to the modifiable "unsentLowWatermark"
+    /// representation. The behavior is undefined unless
+    /// 'isUnsentLowWatermark()' is true.
+    bsl::size_t& unsentLowWatermark();
+
     /// Return the non-modifiable "reuseAddress" representation. The behavior
     /// is undefined unless 'isReuseAddress()' is true.
     bool reuseAddress() const;
@@ -445,6 +464,10 @@ class SocketOption
     /// undefined unless 'isZeroCopy()' is true.
     bool zeroCopy() const;
 
+    /// Return the non-modifiable "unsentLowWatermark" representation. The
+    /// behavior is undefined unless 'isUnsentLowWatermark()' is true.
+    bsl::size_t unsentLowWatermark() const;
+
     /// Return the type of the option representation.
     enum ntsa::SocketOptionType::Value type() const;
 
@@ -520,6 +543,10 @@ class SocketOption
     /// otherwise return false.
     bool isZeroCopy() const;
 
+    /// Return true if the "unsentLowWatermark" representation is currently
+    /// selected, otherwise return false.
+    bool isUnsentLowWatermark() const;
+
     /// Return true if this object has the same value as the specified 'other'
     /// object, otherwise return false.
     bool equals(const SocketOption& other) const;
@@ -710,6 +737,13 @@ bool& SocketOption::zeroCopy()
     return d_zeroCopy.object();
 }
 
+NTSCFG_INLINE
+bsl::size_t& SocketOption::unsentLowWatermark()
+{
+    BSLS_ASSERT(d_type == ntsa::SocketOptionType::e_UNSENT_LOW_WATERMARK);
+    return d_unsentLowWatermark.object();
+}
+
 NTSCFG_INLINE
 bool SocketOption::reuseAddress() const
 {
@@ -830,6 +864,13 @@ bool SocketOption::zeroCopy() const
     return d_zeroCopy.object();
 }
 
+NTSCFG_INLINE
+bsl::size_t SocketOption::unsentLowWatermark() const
+{
+    BSLS_ASSERT(d_type == ntsa::SocketOptionType::e_UNSENT_LOW_WATERMARK);
+    return d_unsentLowWatermark.object();
+}
+
 NTSCFG_INLINE
 ntsa::SocketOptionType::Value SocketOption::type() const
 {
@@ -944,6 +985,12 @@ bool SocketOption::isZeroCopy() const
     return (d_type == ntsa::SocketOptionType::e_ZERO_COPY);
 }
 
+NTSCFG_INLINE
+bool SocketOption::isUnsentLowWatermark() const
+{
+    return (d_type == ntsa::SocketOptionType::e_UNSENT_LOW_WATERMARK);
+}
+
 NTSCFG_INLINE
 bsl::ostream& operator<<(bsl::ostream& stream, const SocketOption& object)
 {
@@ -1024,6 +1071,9 @@ void hashAppend(HASH_ALGORITHM& algorithm, const SocketOption& value)
     else if (value.isZeroCopy()) {
         hashAppend(algorithm, value.zeroCopy());
     }
+    else if (value.isUnsentLowWatermark()) {
+        hashAppend(algorithm, value.unsentLowWatermark());
+    }
 }
 
 }  // close package namespace
@@ -94,7 +94,11 @@ struct SocketOptionType {
 
         /// Allow each send operation to request copy avoidance when enqueing
         /// data to the socket send buffer.
-        e_ZERO_COPY = 17
+        e_ZERO_COPY = 17,
+
+        /// The maximum number of bytes in the socket send buffer not yet
+        /// sent for the socket to be considered writable.
+        e_UNSENT_LOW_WATERMARK = 18
     };
 
     /// Return the string representation exactly matching the enumerator
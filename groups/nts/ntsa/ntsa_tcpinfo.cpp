@@ -0,0 +1,134 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntsa_tcpinfo.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntsa_tcpinfo_cpp, "$Id$ $CSID$")
+
+#include <bslim_printer.h>
+
+namespace BloombergLP {
+namespace ntsa {
+
+bsl::uint64_t TcpInfo::bandwidthDelayProduct() const
+{
+    const bsls::Types::Int64 roundTripTimeInMicroseconds =
+        d_roundTripTime.totalMicroseconds();
+
+    if (d_deliveryRate == 0 || roundTripTimeInMicroseconds <= 0) {
+        return 0;
+    }
+
+    return static_cast<bsl::uint64_t>(
+        (static_cast<double>(d_deliveryRate) *
+         static_cast<double>(roundTripTimeInMicroseconds)) /
+        1000000.0);
+}
+
+bool TcpInfo::equals(const TcpInfo& other) const
+{
+    return (d_roundTripTime == other.d_roundTripTime &&
+            d_roundTripTimeVariance == other.d_roundTripTimeVariance &&
+            d_congestionWindow == other.d_congestionWindow &&
+            d_maxSegmentSize == other.d_maxSegmentSize &&
+            d_unacknowledgedSegments == other.d_unacknowledgedSegments &&
+            d_retransmittedSegments == other.d_retransmittedSegments &&
+            d_deliveryRate == other.d_deliveryRate &&
+            d_unsentBytes == other.d_unsentBytes);
+}
+
+bool TcpInfo::less(const TcpInfo& other) const
+{
+    if (d_roundTripTime < other.d_roundTripTime) {
+        return true;
+    }
+
+    if (other.d_roundTripTime < d_roundTripTime) {
+        return false;
+    }
+
+    if (d_roundTripTimeVariance < other.d_roundTripTimeVariance) {
+        return true;
+    }
+
+    if (other.d_roundTripTimeVariance < d_roundTripTimeVariance) {
+        return false;
+    }
+
+    if (d_congestionWindow < other.d_congestionWindow) {
+        return true;
+    }
+
+    if (other.d_congestionWindow < d_congestionWindow) {
+        return false;
+    }
+
+    if (d_maxSegmentSize < other.d_maxSegmentSize) {
+        return true;
+    }
+
+    if (other.d_maxSegmentSize < d_maxSegmentSize) {
+        return false;
+    }
+
+    if (d_unacknowledgedSegments < other.d_unacknowledgedSegments) {
+        return true;
+    }
+
+    if (other.d_unacknowledgedSegments < d_unacknowledgedSegments) {
+        return false;
+    }
+
+    if (d_retransmittedSegments < other.d_retransmittedSegments) {
+        return true;
+    }
+
+    if (other.d_retransmittedSegments < d_retransmittedSegments) {
+        return false;
+    }
+
+    if (d_deliveryRate < other.d_deliveryRate) {
+        return true;
+    }
+
+    if (other.d_deliveryRate < d_deliveryRate) {
+        return false;
+    }
+
+    return d_unsentBytes < other.d_unsentBytes;
+}
+
+bsl::ostream& TcpInfo::print(bsl::ostream& stream,
+                             int           level,
+                             int           spacesPerLevel) const
+{
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    printer.printAttribute("roundTripTime", d_roundTripTime);
+    printer.printAttribute("roundTripTimeVariance", d_roundTripTimeVariance);
+    printer.printAttribute("congestionWindow", d_congestionWindow);
+    printer.printAttribute("maxSegmentSize", d_maxSegmentSize);
+    printer.printAttribute("unacknowledgedSegments",
+                           d_unacknowledgedSegments);
+    printer.printAttribute("retransmittedSegments", d_retransmittedSegments);
+    printer.printAttribute("deliveryRate", d_deliveryRate);
+    printer.printAttribute("unsentBytes", d_unsentBytes);
+    printer.end();
+    return stream;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
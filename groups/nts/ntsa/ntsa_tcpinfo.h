@@ -0,0 +1,421 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTSA_TCPINFO
+#define INCLUDED_NTSA_TCPINFO
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntscfg_platform.h>
+#include <ntsscm_version.h>
+#include <bslh_hash.h>
+#include <bsls_timeinterval.h>
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+namespace ntsa {
+
+/// Describe the state of a TCP connection as measured by the operating
+/// system.
+///
+/// @par Attributes
+/// This class is composed of the following attributes:
+///
+/// @li @b roundTripTime:
+/// The smoothed round trip time estimated for the connection.
+///
+/// @li @b roundTripTimeVariance:
+/// The variance of the round trip time estimated for the connection.
+///
+/// @li @b congestionWindow:
+/// The size of the congestion window, in segments.
+///
+/// @li @b maxSegmentSize:
+/// The maximum size of each segment sent, in bytes.
+///
+/// @li @b unacknowledgedSegments:
+/// The number of segments sent that have not yet been acknowledged by the
+/// peer.
+///
+/// @li @b retransmittedSegments:
+/// The total number of segments retransmitted over the life of the
+/// connection.
+///
+/// @li @b deliveryRate:
+/// The most recently measured rate at which data is delivered to the peer,
+/// in bytes per second, or zero if the operating system does not measure
+/// the delivery rate.
+///
+/// @li @b unsentBytes:
+/// The number of bytes in the send buffer that have not yet been sent.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntsa_system
+class TcpInfo
+{
+    bsls::TimeInterval d_roundTripTime;
+    bsls::TimeInterval d_roundTripTimeVariance;
+    bsl::uint32_t      d_congestionWindow;
+    bsl::uint32_t      d_maxSegmentSize;
+    bsl::uint32_t      d_unacknowledgedSegments;
+    bsl::uint32_t      d_retransmittedSegments;
+    bsl::uint64_t      d_deliveryRate;
+    bsl::uint32_t      d_unsentBytes;
+
+  public:
+    /// Create new TCP information having the default value.
+    TcpInfo();
+
+    /// Create new object having the same value as the specified 'original'
+    /// object.
+    TcpInfo(const TcpInfo& original);
+
+    /// Destroy this object.
+    ~TcpInfo();
+
+    /// Assign the value of the specified 'other' object to this object. Return
+    /// a reference to this modifiable object.
+    TcpInfo& operator=(const TcpInfo& other);
+
+    /// Reset the value of this object to its value upon default
+    /// construction.
+    void reset();
+
+    /// Set the smoothed round trip time to the specified 'value'.
+    void setRoundTripTime(const bsls::TimeInterval& value);
+
+    /// Set the round trip time variance to the specified 'value'.
+    void setRoundTripTimeVariance(const bsls::TimeInterval& value);
+
+    /// Set the congestion window, in segments, to the specified 'value'.
+    void setCongestionWindow(bsl::uint32_t value);
+
+    /// Set the maximum segment size, in bytes, to the specified 'value'.
+    void setMaxSegmentSize(bsl::uint32_t value);
+
+    /// Set the number of unacknowledged segments to the specified 'value'.
+    void setUnacknowledgedSegments(bsl::uint32_t value);
+
+    /// Set the total number of retransmitted segments to the specified
+    /// 'value'.
+    void setRetransmittedSegments(bsl::uint32_t value);
+
+    /// Set the delivery rate, in bytes per second, to the specified 'value'.
+    void setDeliveryRate(bsl::uint64_t value);
+
+    /// Set the number of bytes in the send buffer not yet sent to the
+    /// specified 'value'.
+    void setUnsentBytes(bsl::uint32_t value);
+
+    /// Return the smoothed round trip time.
+    BSLS_ANNOTATION_NODISCARD const bsls::TimeInterval& roundTripTime() const;
+
+    /// Return the round trip time variance.
+    BSLS_ANNOTATION_NODISCARD const bsls::TimeInterval& roundTripTimeVariance()
+        const;
+
+    /// Return the congestion window, in segments.
+    BSLS_ANNOTATION_NODISCARD bsl::uint32_t congestionWindow() const;
+
+    /// Return the maximum segment size, in bytes.
+    BSLS_ANNOTATION_NODISCARD bsl::uint32_t maxSegmentSize() const;
+
+    /// Return the number of unacknowledged segments.
+    BSLS_ANNOTATION_NODISCARD bsl::uint32_t unacknowledgedSegments() const;
+
+    /// Return the total number of retransmitted segments.
+    BSLS_ANNOTATION_NODISCARD bsl::uint32_t retransmittedSegments() const;
+
+    /// Return the delivery rate, in bytes per second.
+    BSLS_ANNOTATION_NODISCARD bsl::uint64_t deliveryRate() const;
+
+    /// Return the number of bytes in the send buffer not yet sent.
+    BSLS_ANNOTATION_NODISCARD bsl::uint32_t unsentBytes() const;
+
+    /// Return the number of bytes sent that have not yet been acknowledged,
+    /// approximated from the number of unacknowledged segments and the
+    /// maximum segment size.
+    BSLS_ANNOTATION_NODISCARD bsl::uint64_t unacknowledgedBytes() const;
+
+    /// Return the bandwidth-delay product of the connection, in bytes,
+    /// computed from the delivery rate and the smoothed round trip time, or
+    /// zero if either is unknown.
+    BSLS_ANNOTATION_NODISCARD bsl::uint64_t bandwidthDelayProduct() const;
+
+    /// Return true if this object has the same value as the specified
+    /// 'other' object, otherwise return false.
+    BSLS_ANNOTATION_NODISCARD bool equals(const TcpInfo& other) const;
+
+    /// Return true if the value of this object is less than the value of
+    /// the specified 'other' object, otherwise return false.
+    BSLS_ANNOTATION_NODISCARD bool less(const TcpInfo& other) const;
+
+    /// Format this object to the specified output 'stream' at the optionally
+    /// specified indentation 'level' and return a reference to the modifiable
+    /// 'stream'.  If 'level' is specified, optionally specify
+    /// 'spacesPerLevel', the number of spaces per indentation level for this
+    /// and all of its nested objects.  Each line is indented by the absolute
+    /// value of 'level * spacesPerLevel'.  If 'level' is negative, suppress
+    /// indentation of the first line.  If 'spacesPerLevel' is negative,
+    /// suppress line breaks and format the entire output on one line.  If
+    /// 'stream' is initially invalid, this operation has no effect.  Note that
+    /// a trailing newline is provided in multiline mode only.
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level          = 0,
+                        int           spacesPerLevel = 4) const;
+
+    /// Defines the traits of this type. These traits can be used to select,
+    /// at compile-time, the most efficient algorithm to manipulate objects
+    /// of this type.
+    NTSCFG_DECLARE_NESTED_BITWISE_MOVABLE_TRAITS(TcpInfo);
+};
+
+/// Write the specified 'object' to the specified 'stream'. Return a modifiable
+/// reference to the 'stream'.
+///
+/// @related ntsa::TcpInfo
+bsl::ostream& operator<<(bsl::ostream& stream, const TcpInfo& object);
+
+/// Return true if the specified 'lhs' has the same value as the specified
+/// 'rhs', otherwise return false.
+///
+/// @related ntsa::TcpInfo
+bool operator==(const TcpInfo& lhs, const TcpInfo& rhs);
+
+/// Return true if the specified 'lhs' does not have the same value as the
+/// specified 'rhs', otherwise return false.
+///
+/// @related ntsa::TcpInfo
+bool operator!=(const TcpInfo& lhs, const TcpInfo& rhs);
+
+/// Return true if the value of the specified 'lhs' is less than the value of
+/// the specified 'rhs', otherwise return false.
+///
+/// @related ntsa::TcpInfo
+bool operator<(const TcpInfo& lhs, const TcpInfo& rhs);
+
+/// Contribute the values of the salient attributes of the specified 'value' to
+/// the specified hash 'algorithm'.
+///
+/// @related ntsa::TcpInfo
+template <typename HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& algorithm, const TcpInfo& value);
+
+NTSCFG_INLINE
+TcpInfo::TcpInfo()
+: d_roundTripTime()
+, d_roundTripTimeVariance()
+, d_congestionWindow(0)
+, d_maxSegmentSize(0)
+, d_unacknowledgedSegments(0)
+, d_retransmittedSegments(0)
+, d_deliveryRate(0)
+, d_unsentBytes(0)
+{
+}
+
+NTSCFG_INLINE
+TcpInfo::TcpInfo(const TcpInfo& original)
+: d_roundTripTime(original.d_roundTripTime)
+, d_roundTripTimeVariance(original.d_roundTripTimeVariance)
+, d_congestionWindow(original.d_congestionWindow)
+, d_maxSegmentSize(original.d_maxSegmentSize)
+, d_unacknowledgedSegments(original.d_unacknowledgedSegments)
+, d_retransmittedSegments(original.d_retransmittedSegments)
+, d_deliveryRate(original.d_deliveryRate)
+, d_unsentBytes(original.d_unsentBytes)
+{
+}
+
+NTSCFG_INLINE
+TcpInfo::~TcpInfo()
+{
+}
+
+NTSCFG_INLINE
+TcpInfo& TcpInfo::operator=(const TcpInfo& other)
+{
+    d_roundTripTime          = other.d_roundTripTime;
+    d_roundTripTimeVariance  = other.d_roundTripTimeVariance;
+    d_congestionWindow       = other.d_congestionWindow;
+    d_maxSegmentSize         = other.d_maxSegmentSize;
+    d_unacknowledgedSegments = other.d_unacknowledgedSegments;
+    d_retransmittedSegments  = other.d_retransmittedSegments;
+    d_deliveryRate           = other.d_deliveryRate;
+    d_unsentBytes            = other.d_unsentBytes;
+    return *this;
+}
+
+NTSCFG_INLINE
+void TcpInfo::reset()
+{
+    d_roundTripTime          = bsls::TimeInterval();
+    d_roundTripTimeVariance  = bsls::TimeInterval();
+    d_congestionWindow       = 0;
+    d_maxSegmentSize         = 0;
+    d_unacknowledgedSegments = 0;
+    d_retransmittedSegments  = 0;
+    d_deliveryRate           = 0;
+    d_unsentBytes            = 0;
+}
+
+NTSCFG_INLINE
+void TcpInfo::setRoundTripTime(const bsls::TimeInterval& value)
+{
+    d_roundTripTime = value;
+}
+
+NTSCFG_INLINE
+void TcpInfo::setRoundTripTimeVariance(const bsls::TimeInterval& value)
+{
+    d_roundTripTimeVariance = value;
+}
+
+NTSCFG_INLINE
+void TcpInfo::setCongestionWindow(bsl::uint32_t value)
+{
+    d_congestionWindow = value;
+}
+
+NTSCFG_INLINE
+void TcpInfo::setMaxSegmentSize(bsl::uint32_t value)
+{
+    d_maxSegmentSize = value;
+}
+
+NTSCFG_INLINE
+void TcpInfo::setUnacknowledgedSegments(bsl::uint32_t value)
+{
+    d_unacknowledgedSegments = value;
+}
+
+NTSCFG_INLINE
+void TcpInfo::setRetransmittedSegments(bsl::uint32_t value)
+{
+    d_retransmittedSegments = value;
+}
+
+NTSCFG_INLINE
+void TcpInfo::setDeliveryRate(bsl::uint64_t value)
+{
+    d_deliveryRate = value;
+}
+
+NTSCFG_INLINE
+void TcpInfo::setUnsentBytes(bsl::uint32_t value)
+{
+    d_unsentBytes = value;
+}
+
+NTSCFG_INLINE
+const bsls::TimeInterval& TcpInfo::roundTripTime() const
+{
+    return d_roundTripTime;
+}
+
+NTSCFG_INLINE
+const bsls::TimeInterval& TcpInfo::roundTripTimeVariance() const
+{
+    return d_roundTripTimeVariance;
+}
+
+NTSCFG_INLINE
+bsl::uint32_t TcpInfo::congestionWindow() const
+{
+    return d_congestionWindow;
+}
+
+NTSCFG_INLINE
+bsl::uint32_t TcpInfo::maxSegmentSize() const
+{
+    return d_maxSegmentSize;
+}
+
+NTSCFG_INLINE
+bsl::uint32_t TcpInfo::unacknowledgedSegments() const
+{
+    return d_unacknowledgedSegments;
+}
+
+NTSCFG_INLINE
+bsl::uint32_t TcpInfo::retransmittedSegments() const
+{
+    return d_retransmittedSegments;
+}
+
+NTSCFG_INLINE
+bsl::uint64_t TcpInfo::deliveryRate() const
+{
+    return d_deliveryRate;
+}
+
+NTSCFG_INLINE
+bsl::uint32_t TcpInfo::unsentBytes() const
+{
+    return d_unsentBytes;
+}
+
+NTSCFG_INLINE
+bsl::uint64_t TcpInfo::unacknowledgedBytes() const
+{
+    return static_cast<bsl::uint64_t>(d_unacknowledgedSegments) *
+           static_cast<bsl::uint64_t>(d_maxSegmentSize);
+}
+
+NTSCFG_INLINE
+bsl::ostream& operator<<(bsl::ostream& stream, const TcpInfo& object)
+{
+    return object.print(stream, 0, -1);
+}
+
+NTSCFG_INLINE
+bool operator==(const TcpInfo& lhs, const TcpInfo& rhs)
+{
+    return lhs.equals(rhs);
+}
+
+NTSCFG_INLINE
+bool operator!=(const TcpInfo& lhs, const TcpInfo& rhs)
+{
+    return !operator==(lhs, rhs);
+}
+
+NTSCFG_INLINE
+bool operator<(const TcpInfo& lhs, const TcpInfo& rhs)
+{
+    return lhs.less(rhs);
+}
+
+template <typename HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& algorithm, const TcpInfo& value)
+{
+    using bslh::hashAppend;
+
+    hashAppend(algorithm, value.roundTripTime());
+    hashAppend(algorithm, value.roundTripTimeVariance());
+    hashAppend(algorithm, value.congestionWindow());
+    hashAppend(algorithm, value.maxSegmentSize());
+    hashAppend(algorithm, value.unacknowledgedSegments());
+    hashAppend(algorithm, value.retransmittedSegments());
+    hashAppend(algorithm, value.deliveryRate());
+    hashAppend(algorithm, value.unsentBytes());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
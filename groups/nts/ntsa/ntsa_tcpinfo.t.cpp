@@ -0,0 +1,60 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntsa_tcpinfo.h>
+
+#include <ntscfg_test.h>
+
+using namespace BloombergLP;
+using namespace ntsa;
+
+NTSCFG_TEST_CASE(1)
+{
+    {
+        TcpInfo info;
+        NTSCFG_TEST_EQ(info.roundTripTime(), bsls::TimeInterval());
+        NTSCFG_TEST_EQ(info.congestionWindow(), 0);
+        NTSCFG_TEST_EQ(info.deliveryRate(), 0);
+        NTSCFG_TEST_EQ(info.unacknowledgedBytes(), 0);
+        NTSCFG_TEST_EQ(info.bandwidthDelayProduct(), 0);
+    }
+    {
+        TcpInfo info;
+        info.setRoundTripTime(bsls::TimeInterval(0, 20 * 1000 * 1000));
+        info.setRoundTripTimeVariance(bsls::TimeInterval(0, 1000 * 1000));
+        info.setCongestionWindow(10);
+        info.setMaxSegmentSize(1448);
+        info.setUnacknowledgedSegments(4);
+        info.setRetransmittedSegments(2);
+        info.setDeliveryRate(1000 * 1000);
+        info.setUnsentBytes(512);
+
+        NTSCFG_TEST_EQ(info.unacknowledgedBytes(), 4 * 1448);
+        NTSCFG_TEST_EQ(info.bandwidthDelayProduct(), 20 * 1000);
+
+        TcpInfo copy(info);
+        NTSCFG_TEST_EQ(copy, info);
+
+        copy.reset();
+        NTSCFG_TEST_NE(copy, info);
+        NTSCFG_TEST_EQ(copy, TcpInfo());
+    }
+}
+
+NTSCFG_TEST_DRIVER
+{
+    NTSCFG_TEST_REGISTER(1);
+}
+NTSCFG_TEST_DRIVER_END;
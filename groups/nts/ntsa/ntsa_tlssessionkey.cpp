@@ -0,0 +1,126 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntsa_tlssessionkey.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntsa_tlssessionkey_cpp, "$Id$ $CSID$")
+
+#include <bslim_printer.h>
+
+namespace BloombergLP {
+namespace ntsa {
+
+namespace {
+
+/// Overwrite the specified 'size' bytes at the specified 'data' with zeroes
+/// in a way the compiler may not elide even though the memory is about to
+/// be released.
+void clearSecret(void* data, bsl::size_t size)
+{
+    volatile bsl::uint8_t* current = static_cast<volatile bsl::uint8_t*>(data);
+    for (bsl::size_t i = 0; i < size; ++i) {
+        current[i] = 0;
+    }
+}
+
+const char* cipherName(TlsSessionKey::Cipher cipher)
+{
+    switch (cipher) {
+    case TlsSessionKey::e_AES_128_GCM:
+        return "AES_128_GCM";
+    case TlsSessionKey::e_AES_256_GCM:
+        return "AES_256_GCM";
+    case TlsSessionKey::e_CHACHA20_POLY1305:
+        return "CHACHA20_POLY1305";
+    default:
+        break;
+    }
+
+    return "UNDEFINED";
+}
+
+}  // close unnamed namespace
+
+void TlsSessionKey::reset()
+{
+    d_version                  = 0;
+    d_cipher                   = e_UNDEFINED;
+    d_keySize                  = 0;
+    d_initializationVectorSize = 0;
+    d_saltSize                 = 0;
+    d_recordSequence           = 0;
+
+    clearSecret(d_key, sizeof d_key);
+    clearSecret(d_initializationVector, sizeof d_initializationVector);
+    clearSecret(d_salt, sizeof d_salt);
+}
+
+bool TlsSessionKey::isValid() const
+{
+    if (d_version != k_VERSION_TLS_1_2 && d_version != k_VERSION_TLS_1_3) {
+        return false;
+    }
+
+    switch (d_cipher) {
+    case e_AES_128_GCM:
+        return d_keySize == 16 && d_initializationVectorSize == 8 &&
+               d_saltSize == 4;
+    case e_AES_256_GCM:
+        return d_keySize == 32 && d_initializationVectorSize == 8 &&
+               d_saltSize == 4;
+    case e_CHACHA20_POLY1305:
+        return d_keySize == 32 && d_initializationVectorSize == 12 &&
+               d_saltSize == 0;
+    default:
+        break;
+    }
+
+    return false;
+}
+
+bool TlsSessionKey::equals(const TlsSessionKey& other) const
+{
+    return (d_version == other.d_version && d_cipher == other.d_cipher &&
+            d_keySize == other.d_keySize &&
+            d_initializationVectorSize == other.d_initializationVectorSize &&
+            d_saltSize == other.d_saltSize &&
+            d_recordSequence == other.d_recordSequence &&
+            bsl::memcmp(d_key, other.d_key, d_keySize) == 0 &&
+            bsl::memcmp(d_initializationVector,
+                        other.d_initializationVector,
+                        d_initializationVectorSize) == 0 &&
+            bsl::memcmp(d_salt, other.d_salt, d_saltSize) == 0);
+}
+
+bsl::ostream& TlsSessionKey::print(bsl::ostream& stream,
+                                   int           level,
+                                   int           spacesPerLevel) const
+{
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    printer.printAttribute("version", d_version);
+    printer.printAttribute("cipher", cipherName(d_cipher));
+    printer.printAttribute("keySize", d_keySize);
+    printer.printAttribute("initializationVectorSize",
+                           d_initializationVectorSize);
+    printer.printAttribute("saltSize", d_saltSize);
+    printer.printAttribute("recordSequence", d_recordSequence);
+    printer.end();
+    return stream;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,409 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTSA_TLSSESSIONKEY
+#define INCLUDED_NTSA_TLSSESSIONKEY
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntscfg_platform.h>
+#include <ntsscm_version.h>
+#include <bsls_assert.h>
+#include <bsl_cstring.h>
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+namespace ntsa {
+
+/// Describe the keying material of one direction of an established TLS
+/// session, in the form required to offload the encryption of that
+/// direction to the operating system.
+///
+/// @par Attributes
+/// This class is composed of the following attributes:
+///
+/// @li @b version:
+/// The TLS protocol version, as encoded on the wire, e.g. 0x0303 for TLS 1.2
+/// and 0x0304 for TLS 1.3.
+///
+/// @li @b cipher:
+/// The authenticated encryption algorithm negotiated for the session.
+///
+/// @li @b key:
+/// The traffic key.
+///
+/// @li @b initializationVector:
+/// The per-record part of the nonce. For AES-GCM this is the 8-byte explicit
+/// nonce; for ChaCha20-Poly1305 this is the full 12-byte write IV.
+///
+/// @li @b salt:
+/// The fixed part of the nonce. For AES-GCM this is the 4-byte implicit
+/// nonce; for ChaCha20-Poly1305 this is empty.
+///
+/// @li @b recordSequence:
+/// The sequence number of the next record to be processed in this
+/// direction.
+///
+/// @par Security
+/// The keying material is never formatted by 'print'.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntsa_system
+class TlsSessionKey
+{
+  public:
+    /// Enumerate the authenticated encryption algorithms.
+    enum Cipher {
+        /// The cipher is undefined.
+        e_UNDEFINED = 0,
+
+        /// AES in Galois/Counter mode with a 128-bit key.
+        e_AES_128_GCM = 1,
+
+        /// AES in Galois/Counter mode with a 256-bit key.
+        e_AES_256_GCM = 2,
+
+        /// ChaCha20 with the Poly1305 authenticator.
+        e_CHACHA20_POLY1305 = 3
+    };
+
+    enum {
+        /// The TLS 1.2 protocol version.
+        k_VERSION_TLS_1_2 = 0x0303,
+
+        /// The TLS 1.3 protocol version.
+        k_VERSION_TLS_1_3 = 0x0304,
+
+        /// The maximum size of the key, in bytes.
+        k_MAX_KEY_SIZE = 32,
+
+        /// The maximum size of the initialization vector, in bytes.
+        k_MAX_INITIALIZATION_VECTOR_SIZE = 12,
+
+        /// The maximum size of the salt, in bytes.
+        k_MAX_SALT_SIZE = 4
+    };
+
+  private:
+    bsl::uint16_t d_version;
+    Cipher        d_cipher;
+    bsl::uint8_t  d_key[k_MAX_KEY_SIZE];
+    bsl::size_t   d_keySize;
+    bsl::uint8_t  d_initializationVector[k_MAX_INITIALIZATION_VECTOR_SIZE];
+    bsl::size_t   d_initializationVectorSize;
+    bsl::uint8_t  d_salt[k_MAX_SALT_SIZE];
+    bsl::size_t   d_saltSize;
+    bsl::uint64_t d_recordSequence;
+
+  public:
+    /// Create a new TLS session key having the default value.
+    TlsSessionKey();
+
+    /// Create new object having the same value as the specified 'original'
+    /// object.
+    TlsSessionKey(const TlsSessionKey& original);
+
+    /// Destroy this object. The keying material is cleared.
+    ~TlsSessionKey();
+
+    /// Assign the value of the specified 'other' object to this object. Return
+    /// a reference to this modifiable object.
+    TlsSessionKey& operator=(const TlsSessionKey& other);
+
+    /// Reset the value of this object to its value upon default
+    /// construction. The keying material is cleared.
+    void reset();
+
+    /// Set the TLS protocol version to the specified 'value'.
+    void setVersion(bsl::uint16_t value);
+
+    /// Set the cipher to the specified 'value'.
+    void setCipher(Cipher value);
+
+    /// Set the traffic key to the specified 'size' bytes at the specified
+    /// 'data'. The behavior is undefined unless 'size <= k_MAX_KEY_SIZE'.
+    void setKey(const void* data, bsl::size_t size);
+
+    /// Set the initialization vector to the specified 'size' bytes at the
+    /// specified 'data'. The behavior is undefined unless
+    /// 'size <= k_MAX_INITIALIZATION_VECTOR_SIZE'.
+    void setInitializationVector(const void* data, bsl::size_t size);
+
+    /// Set the salt to the specified 'size' bytes at the specified 'data'.
+    /// The behavior is undefined unless 'size <= k_MAX_SALT_SIZE'.
+    void setSalt(const void* data, bsl::size_t size);
+
+    /// Set the sequence number of the next record to the specified 'value'.
+    void setRecordSequence(bsl::uint64_t value);
+
+    /// Return the TLS protocol version.
+    BSLS_ANNOTATION_NODISCARD bsl::uint16_t version() const;
+
+    /// Return the cipher.
+    BSLS_ANNOTATION_NODISCARD Cipher cipher() const;
+
+    /// Return the traffic key.
+    BSLS_ANNOTATION_NODISCARD const bsl::uint8_t* key() const;
+
+    /// Return the size of the traffic key, in bytes.
+    BSLS_ANNOTATION_NODISCARD bsl::size_t keySize() const;
+
+    /// Return the initialization vector.
+    BSLS_ANNOTATION_NODISCARD const bsl::uint8_t* initializationVector()
+        const;
+
+    /// Return the size of the initialization vector, in bytes.
+    BSLS_ANNOTATION_NODISCARD bsl::size_t initializationVectorSize() const;
+
+    /// Return the salt.
+    BSLS_ANNOTATION_NODISCARD const bsl::uint8_t* salt() const;
+
+    /// Return the size of the salt, in bytes.
+    BSLS_ANNOTATION_NODISCARD bsl::size_t saltSize() const;
+
+    /// Return the sequence number of the next record.
+    BSLS_ANNOTATION_NODISCARD bsl::uint64_t recordSequence() const;
+
+    /// Return true if the sizes of the key, initialization vector, and salt
+    /// are those required by the cipher, and the version is TLS 1.2 or TLS
+    /// 1.3, otherwise return false.
+    BSLS_ANNOTATION_NODISCARD bool isValid() const;
+
+    /// Return true if this object has the same value as the specified
+    /// 'other' object, otherwise return false.
+    BSLS_ANNOTATION_NODISCARD bool equals(const TlsSessionKey& other) const;
+
+    /// Format this object to the specified output 'stream' at the optionally
+    /// specified indentation 'level' and return a reference to the modifiable
+    /// 'stream'.  If 'level' is specified, optionally specify
+    /// 'spacesPerLevel', the number of spaces per indentation level for this
+    /// and all of its nested objects.  Each line is indented by the absolute
+    /// value of 'level * spacesPerLevel'.  If 'level' is negative, suppress
+    /// indentation of the first line.  If 'spacesPerLevel' is negative,
+    /// suppress line breaks and format the entire output on one line.  If
+    /// 'stream' is initially invalid, this operation has no effect.  Note that
+    /// a trailing newline is provided in multiline mode only.
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level          = 0,
+                        int           spacesPerLevel = 4) const;
+
+    /// Defines the traits of this type. These traits can be used to select,
+    /// at compile-time, the most efficient algorithm to manipulate objects
+    /// of this type.
+    NTSCFG_DECLARE_NESTED_BITWISE_MOVABLE_TRAITS(TlsSessionKey);
+};
+
+/// Write the specified 'object' to the specified 'stream'. Return a modifiable
+/// reference to the 'stream'.
+///
+/// @related ntsa::TlsSessionKey
+bsl::ostream& operator<<(bsl::ostream& stream, const TlsSessionKey& object);
+
+/// Return true if the specified 'lhs' has the same value as the specified
+/// 'rhs', otherwise return false.
+///
+/// @related ntsa::TlsSessionKey
+bool operator==(const TlsSessionKey& lhs, const TlsSessionKey& rhs);
+
+/// Return true if the specified 'lhs' does not have the same value as the
+/// specified 'rhs', otherwise return false.
+///
+/// @related ntsa::TlsSessionKey
+bool operator!=(const TlsSessionKey& lhs, const TlsSessionKey& rhs);
+
+NTSCFG_INLINE
+TlsSessionKey::TlsSessionKey()
+: d_version(0)
+, d_cipher(e_UNDEFINED)
+, d_keySize(0)
+, d_initializationVectorSize(0)
+, d_saltSize(0)
+, d_recordSequence(0)
+{
+    bsl::memset(d_key, 0, sizeof d_key);
+    bsl::memset(d_initializationVector, 0, sizeof d_initializationVector);
+    bsl::memset(d_salt, 0, sizeof d_salt);
+}
+
+NTSCFG_INLINE
+TlsSessionKey::TlsSessionKey(const TlsSessionKey& original)
+: d_version(original.d_version)
+, d_cipher(original.d_cipher)
+, d_keySize(original.d_keySize)
+, d_initializationVectorSize(original.d_initializationVectorSize)
+, d_saltSize(original.d_saltSize)
+, d_recordSequence(original.d_recordSequence)
+{
+    bsl::memcpy(d_key, original.d_key, sizeof d_key);
+    bsl::memcpy(d_initializationVector,
+                original.d_initializationVector,
+                sizeof d_initializationVector);
+    bsl::memcpy(d_salt, original.d_salt, sizeof d_salt);
+}
+
+NTSCFG_INLINE
+TlsSessionKey::~TlsSessionKey()
+{
+    this->reset();
+}
+
+NTSCFG_INLINE
+TlsSessionKey& TlsSessionKey::operator=(const TlsSessionKey& other)
+{
+    if (this != &other) {
+        d_version                  = other.d_version;
+        d_cipher                   = other.d_cipher;
+        d_keySize                  = other.d_keySize;
+        d_initializationVectorSize = other.d_initializationVectorSize;
+        d_saltSize                 = other.d_saltSize;
+        d_recordSequence           = other.d_recordSequence;
+
+        bsl::memcpy(d_key, other.d_key, sizeof d_key);
+        bsl::memcpy(d_initializationVector,
+                    other.d_initializationVector,
+                    sizeof d_initializationVector);
+        bsl::memcpy(d_salt, other.d_salt, sizeof d_salt);
+    }
+
+    return *this;
+}
+
+NTSCFG_INLINE
+void TlsSessionKey::setVersion(bsl::uint16_t value)
+{
+    d_version = value;
+}
+
+NTSCFG_INLINE
+void TlsSessionKey::setCipher(Cipher value)
+{
+    d_cipher = value;
+}
+
+NTSCFG_INLINE
+void TlsSessionKey::setKey(const void* data, bsl::size_t size)
+{
+    BSLS_ASSERT(size <= k_MAX_KEY_SIZE);
+
+    bsl::memset(d_key, 0, sizeof d_key);
+    bsl::memcpy(d_key, data, size);
+    d_keySize = size;
+}
+
+NTSCFG_INLINE
+void TlsSessionKey::setInitializationVector(const void* data,
+                                            bsl::size_t size)
+{
+    BSLS_ASSERT(size <= k_MAX_INITIALIZATION_VECTOR_SIZE);
+
+    bsl::memset(d_initializationVector, 0, sizeof d_initializationVector);
+    bsl::memcpy(d_initializationVector, data, size);
+    d_initializationVectorSize = size;
+}
+
+NTSCFG_INLINE
+void TlsSessionKey::setSalt(const void* data, bsl::size_t size)
+{
+    BSLS_ASSERT(size <= k_MAX_SALT_SIZE);
+
+    bsl::memset(d_salt, 0, sizeof d_salt);
+    bsl::memcpy(d_salt, data, size);
+    d_saltSize = size;
+}
+
+NTSCFG_INLINE
+void TlsSessionKey::setRecordSequence(bsl::uint64_t value)
+{
+    d_recordSequence = value;
+}
+
+NTSCFG_INLINE
+bsl::uint16_t TlsSessionKey::version() const
+{
+    return d_version;
+}
+
+NTSCFG_INLINE
+TlsSessionKey::Cipher TlsSessionKey::cipher() const
+{
+    return d_cipher;
+}
+
+NTSCFG_INLINE
+const bsl::uint8_t* TlsSessionKey::key() const
+{
+    return d_key;
+}
+
+NTSCFG_INLINE
+bsl::size_t TlsSessionKey::keySize() const
+{
+    return d_keySize;
+}
+
+NTSCFG_INLINE
+const bsl::uint8_t* TlsSessionKey::initializationVector() const
+{
+    return d_initializationVector;
+}
+
+NTSCFG_INLINE
+bsl::size_t TlsSessionKey::initializationVectorSize() const
+{
+    return d_initializationVectorSize;
+}
+
+NTSCFG_INLINE
+const bsl::uint8_t* TlsSessionKey::salt() const
+{
+    return d_salt;
+}
+
+NTSCFG_INLINE
+bsl::size_t TlsSessionKey::saltSize() const
+{
+    return d_saltSize;
+}
+
+NTSCFG_INLINE
+bsl::uint64_t TlsSessionKey::recordSequence() const
+{
+    return d_recordSequence;
+}
+
+NTSCFG_INLINE
+bsl::ostream& operator<<(bsl::ostream& stream, const TlsSessionKey& object)
+{
+    return object.print(stream, 0, -1);
+}
+
+NTSCFG_INLINE
+bool operator==(const TlsSessionKey& lhs, const TlsSessionKey& rhs)
+{
+    return lhs.equals(rhs);
+}
+
+NTSCFG_INLINE
+bool operator!=(const TlsSessionKey& lhs, const TlsSessionKey& rhs)
+{
+    return !operator==(lhs, rhs);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
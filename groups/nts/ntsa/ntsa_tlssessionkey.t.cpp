@@ -0,0 +1,88 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntsa_tlssessionkey.h>
+
+#include <ntscfg_test.h>
+
+using namespace BloombergLP;
+using namespace ntsa;
+
+NTSCFG_TEST_CASE(1)
+{
+    const bsl::uint8_t KEY[32] = {
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+        0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10,
+        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+        0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20};
+
+    const bsl::uint8_t IV[12] = {
+        0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab,
+        0xac};
+
+    const bsl::uint8_t SALT[4] = {0xb1, 0xb2, 0xb3, 0xb4};
+
+    {
+        TlsSessionKey key;
+        NTSCFG_TEST_EQ(key.version(), 0);
+        NTSCFG_TEST_EQ(key.cipher(), TlsSessionKey::e_UNDEFINED);
+        NTSCFG_TEST_EQ(key.keySize(), 0);
+        NTSCFG_TEST_FALSE(key.isValid());
+    }
+    {
+        TlsSessionKey key;
+        key.setVersion(TlsSessionKey::k_VERSION_TLS_1_3);
+        key.setCipher(TlsSessionKey::e_AES_128_GCM);
+        key.setKey(KEY, 16);
+        key.setInitializationVector(IV, 8);
+        key.setSalt(SALT, 4);
+        key.setRecordSequence(7);
+
+        NTSCFG_TEST_TRUE(key.isValid());
+        NTSCFG_TEST_EQ(bsl::memcmp(key.key(), KEY, 16), 0);
+        NTSCFG_TEST_EQ(key.recordSequence(), 7);
+
+        TlsSessionKey copy(key);
+        NTSCFG_TEST_EQ(copy, key);
+
+        copy.setKey(KEY, 32);
+        NTSCFG_TEST_NE(copy, key);
+        NTSCFG_TEST_FALSE(copy.isValid());
+
+        copy.setCipher(TlsSessionKey::e_AES_256_GCM);
+        NTSCFG_TEST_TRUE(copy.isValid());
+
+        copy.reset();
+        NTSCFG_TEST_EQ(copy, TlsSessionKey());
+    }
+    {
+        TlsSessionKey key;
+        key.setVersion(TlsSessionKey::k_VERSION_TLS_1_2);
+        key.setCipher(TlsSessionKey::e_CHACHA20_POLY1305);
+        key.setKey(KEY, 32);
+        key.setInitializationVector(IV, 12);
+
+        NTSCFG_TEST_TRUE(key.isValid());
+
+        key.setSalt(SALT, 4);
+        NTSCFG_TEST_FALSE(key.isValid());
+    }
+}
+
+NTSCFG_TEST_DRIVER
+{
+    NTSCFG_TEST_REGISTER(1);
+}
+NTSCFG_TEST_DRIVER_END;
@@ -184,6 +184,18 @@ ntsa::Error StreamSocket::getLastError(ntsa::Error* result)
     return ntsu::SocketOptionUtil::getLastError(result, d_handle);
 }
 
+ntsa::Error StreamSocket::getTcpInfo(ntsa::TcpInfo* result)
+{
+    return ntsu::SocketOptionUtil::getTcpInfo(result, d_handle);
+}
+
+ntsa::Error StreamSocket::setTlsTransmitOffload(
+    const ntsa::TlsSessionKey& transmitKey)
+{
+    return ntsu::SocketOptionUtil::setTlsTransmitOffload(d_handle,
+                                                         transmitKey);
+}
+
 bsl::size_t StreamSocket::maxBuffersPerSend() const
 {
     return ntsu::SocketUtil::maxBuffersPerSend();
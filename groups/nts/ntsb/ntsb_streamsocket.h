@@ -23,6 +23,8 @@ BSLS_IDENT("$Id: $")
 #include <ntsa_endpoint.h>
 #include <ntsa_error.h>
 #include <ntsa_shutdowntype.h>
+#include <ntsa_tcpinfo.h>
+#include <ntsa_tlssessionkey.h>
 #include <ntsa_transport.h>
 #include <ntscfg_platform.h>
 #include <ntsi_streamsocket.h>
@@ -170,6 +172,17 @@ class StreamSocket : public ntsi::StreamSocket
     /// when connecting the socket. Return the error (retrieving the error).
     ntsa::Error getLastError(ntsa::Error* result) BSLS_KEYWORD_OVERRIDE;
 
+    /// Load into the specified 'result' the state of the TCP connection as
+    /// measured by the operating system. Return the error.
+    ntsa::Error getTcpInfo(ntsa::TcpInfo* result) BSLS_KEYWORD_OVERRIDE;
+
+    /// Offload the encryption of the records sent by the established TLS
+    /// session to the operating system, using the specified 'transmitKey'.
+    /// Return the error. If the error is e_NOT_IMPLEMENTED or e_INVALID the
+    /// socket continues to send data unmodified.
+    ntsa::Error setTlsTransmitOffload(const ntsa::TlsSessionKey& transmitKey)
+        BSLS_KEYWORD_OVERRIDE;
+
     // *** Limits ***
 
     /// Return the maximum number of buffers that can be the source of a
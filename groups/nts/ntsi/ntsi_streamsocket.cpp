@@ -163,6 +163,20 @@ ntsa::Error StreamSocket::getLastError(ntsa::Error* result)
     return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
 }
 
+ntsa::Error StreamSocket::getTcpInfo(ntsa::TcpInfo* result)
+{
+    result->reset();
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setTlsTransmitOffload(
+    const ntsa::TlsSessionKey& transmitKey)
+{
+    NTSCFG_WARNING_UNUSED(transmitKey);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
 bsl::size_t StreamSocket::maxBuffersPerSend() const
 {
     return 1;
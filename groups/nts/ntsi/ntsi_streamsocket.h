@@ -25,6 +25,8 @@ BSLS_IDENT("$Id: $")
 #include <ntsa_notificationqueue.h>
 #include <ntsa_shutdowntype.h>
 #include <ntsa_socketoption.h>
+#include <ntsa_tcpinfo.h>
+#include <ntsa_tlssessionkey.h>
 #include <ntsa_transport.h>
 #include <ntscfg_platform.h>
 #include <ntsi_channel.h>
@@ -344,6 +346,17 @@ class StreamSocket : public ntsi::Channel
     /// when connecting the socket. Return the error (retrieving the error).
     virtual ntsa::Error getLastError(ntsa::Error* result);
 
+    /// Load into the specified 'result' the state of the TCP connection as
+    /// measured by the operating system. Return the error.
+    virtual ntsa::Error getTcpInfo(ntsa::TcpInfo* result);
+
+    /// Offload the encryption of the records sent by the established TLS
+    /// session to the operating system, using the specified 'transmitKey'.
+    /// Return the error. If the error is e_NOT_IMPLEMENTED or e_INVALID the
+    /// socket continues to send data unmodified.
+    virtual ntsa::Error setTlsTransmitOffload(
+        const ntsa::TlsSessionKey& transmitKey);
+
     // *** Limits ***
 
     /// Return the maximum number of buffers that can be the source of a
@@ -26,6 +26,7 @@ BSLS_IDENT_RCSID(ntsu_socketoptionutil_cpp, "$Id$ $CSID$")
 #include <bsls_assert.h>
 #include <bsls_log.h>
 #include <bsls_platform.h>
+#include <bsl_cstddef.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 
@@ -159,6 +160,11 @@ ntsa::Error SocketOptionUtil::setOption(ntsa::Handle              socket,
     else if (option.isZeroCopy()) {
         return SocketOptionUtil::setZeroCopy(socket, option.zeroCopy());
     }
+    else if (option.isUnsentLowWatermark()) {
+        return SocketOptionUtil::setUnsentLowWatermark(
+            socket,
+            option.unsentLowWatermark());
+    }
     else {
         return ntsa::Error(ntsa::Error::e_INVALID);
     }
@@ -308,6 +314,15 @@ ntsa::Error SocketOptionUtil::getOption(ntsa::SocketOption*           option,
         option->makeZeroCopy(value);
         return ntsa::Error();
     }
+    else if (type == ntsa::SocketOptionType::e_UNSENT_LOW_WATERMARK) {
+        bsl::size_t value = 0;
+        error = SocketOptionUtil::getUnsentLowWatermark(&value, socket);
+        if (error) {
+            return error;
+        }
+        option->makeUnsentLowWatermark(value);
+        return ntsa::Error();
+    }
     else {
         return ntsa::Error(ntsa::Error::e_INVALID);
     }
@@ -726,6 +741,32 @@ ntsa::Error SocketOptionUtil::setZeroCopy(ntsa::Handle socket, bool zeroCopy)
 #endif
 }
 
+ntsa::Error SocketOptionUtil::setUnsentLowWatermark(ntsa::Handle socket,
+                                                    bsl::size_t  size)
+{
+#if defined(BSLS_PLATFORM_OS_LINUX) || defined(BSLS_PLATFORM_OS_DARWIN)
+
+    int optionValue = static_cast<int>(size);
+
+    int rc = setsockopt(socket,
+                        IPPROTO_TCP,
+                        TCP_NOTSENT_LOWAT,
+                        reinterpret_cast<char*>(&optionValue),
+                        sizeof(optionValue));
+
+    if (rc != 0) {
+        return ntsa::Error(errno);
+    }
+
+    return ntsa::Error();
+#else
+    NTSCFG_WARNING_UNUSED(socket);
+    NTSCFG_WARNING_UNUSED(size);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+#endif
+}
+
 ntsa::Error SocketOptionUtil::getKeepAlive(bool*        keepAlive,
                                            ntsa::Handle socket)
 {
@@ -1125,6 +1166,40 @@ ntsa::Error SocketOptionUtil::getZeroCopy(bool*        zeroCopyFlag,
 #endif
 }
 
+ntsa::Error SocketOptionUtil::getUnsentLowWatermark(bsl::size_t* size,
+                                                    ntsa::Handle socket)
+{
+    *size = 0;
+
+#if defined(BSLS_PLATFORM_OS_LINUX) || defined(BSLS_PLATFORM_OS_DARWIN)
+
+    int       optionValue = 0;
+    socklen_t optionSize  = static_cast<socklen_t>(sizeof(optionValue));
+
+    int rc = getsockopt(socket,
+                        IPPROTO_TCP,
+                        TCP_NOTSENT_LOWAT,
+                        reinterpret_cast<char*>(&optionValue),
+                        &optionSize);
+
+    if (rc != 0) {
+        return ntsa::Error(errno);
+    }
+
+    if (optionValue > 0) {
+        *size = static_cast<bsl::size_t>(optionValue);
+    }
+
+    return ntsa::Error();
+
+#else
+
+    NTSCFG_WARNING_UNUSED(socket);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+
+#endif
+}
+
 ntsa::Error SocketOptionUtil::getSendBufferRemaining(bsl::size_t* size,
                                                      ntsa::Handle socket)
 {
@@ -1275,6 +1350,285 @@ ntsa::Error SocketOptionUtil::getLastError(ntsa::Error* error,
     return ntsa::Error();
 }
 
+ntsa::Error SocketOptionUtil::getTcpInfo(ntsa::TcpInfo* result,
+                                         ntsa::Handle   socket)
+{
+    result->reset();
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+    // The C library's definition of 'struct tcp_info' lags the kernel's, so
+    // the kernel's layout is mirrored here through the delivery rate, which
+    // was introduced in Linux 4.9. Older kernels fill only a prefix of this
+    // structure and report the size they filled.
+
+    struct LinuxTcpInfo {
+        bsl::uint8_t  d_state;
+        bsl::uint8_t  d_caState;
+        bsl::uint8_t  d_retransmits;
+        bsl::uint8_t  d_probes;
+        bsl::uint8_t  d_backoff;
+        bsl::uint8_t  d_options;
+        bsl::uint8_t  d_windowScale;
+        bsl::uint8_t  d_flags;
+        bsl::uint32_t d_rto;
+        bsl::uint32_t d_ato;
+        bsl::uint32_t d_sendMss;
+        bsl::uint32_t d_receiveMss;
+        bsl::uint32_t d_unacked;
+        bsl::uint32_t d_sacked;
+        bsl::uint32_t d_lost;
+        bsl::uint32_t d_retrans;
+        bsl::uint32_t d_fackets;
+        bsl::uint32_t d_lastDataSent;
+        bsl::uint32_t d_lastAckSent;
+        bsl::uint32_t d_lastDataReceived;
+        bsl::uint32_t d_lastAckReceived;
+        bsl::uint32_t d_pmtu;
+        bsl::uint32_t d_receiveSlowStartThreshold;
+        bsl::uint32_t d_rtt;
+        bsl::uint32_t d_rttVariance;
+        bsl::uint32_t d_sendSlowStartThreshold;
+        bsl::uint32_t d_sendCongestionWindow;
+        bsl::uint32_t d_advertisedMss;
+        bsl::uint32_t d_reordering;
+        bsl::uint32_t d_receiveRtt;
+        bsl::uint32_t d_receiveSpace;
+        bsl::uint32_t d_totalRetrans;
+        bsl::uint64_t d_pacingRate;
+        bsl::uint64_t d_maxPacingRate;
+        bsl::uint64_t d_bytesAcked;
+        bsl::uint64_t d_bytesReceived;
+        bsl::uint32_t d_segmentsOut;
+        bsl::uint32_t d_segmentsIn;
+        bsl::uint32_t d_notSentBytes;
+        bsl::uint32_t d_minRtt;
+        bsl::uint32_t d_dataSegmentsIn;
+        bsl::uint32_t d_dataSegmentsOut;
+        bsl::uint64_t d_deliveryRate;
+    };
+
+    LinuxTcpInfo optionValue;
+    socklen_t    optionSize = static_cast<socklen_t>(sizeof(optionValue));
+
+    bsl::memset(&optionValue, 0, sizeof optionValue);
+
+    int rc = getsockopt(socket,
+                        IPPROTO_TCP,
+                        TCP_INFO,
+                        reinterpret_cast<char*>(&optionValue),
+                        &optionSize);
+
+    if (rc != 0) {
+        return ntsa::Error(errno);
+    }
+
+    if (static_cast<bsl::size_t>(optionSize) <
+        offsetof(LinuxTcpInfo, d_pacingRate))
+    {
+        return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+    }
+
+    bsls::TimeInterval roundTripTime;
+    roundTripTime.setTotalMicroseconds(optionValue.d_rtt);
+
+    bsls::TimeInterval roundTripTimeVariance;
+    roundTripTimeVariance.setTotalMicroseconds(optionValue.d_rttVariance);
+
+    result->setRoundTripTime(roundTripTime);
+    result->setRoundTripTimeVariance(roundTripTimeVariance);
+    result->setCongestionWindow(optionValue.d_sendCongestionWindow);
+    result->setMaxSegmentSize(optionValue.d_sendMss);
+    result->setUnacknowledgedSegments(optionValue.d_unacked);
+    result->setRetransmittedSegments(optionValue.d_totalRetrans);
+
+    if (static_cast<bsl::size_t>(optionSize) >=
+        offsetof(LinuxTcpInfo, d_minRtt))
+    {
+        result->setUnsentBytes(optionValue.d_notSentBytes);
+    }
+
+    if (static_cast<bsl::size_t>(optionSize) >= sizeof(LinuxTcpInfo)) {
+        result->setDeliveryRate(optionValue.d_deliveryRate);
+    }
+
+    return ntsa::Error();
+
+#else
+
+    NTSCFG_WARNING_UNUSED(socket);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+
+#endif
+}
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+namespace {
+
+// The definitions of the kernel TLS interface are mirrored here so that
+// this component does not depend on the presence of <linux/tls.h>, which
+// is absent from older C libraries.
+
+const int k_LINUX_TCP_ULP = 31;
+const int k_LINUX_SOL_TLS = 282;
+const int k_LINUX_TLS_TX  = 1;
+const int k_LINUX_TLS_RX  = 2;
+
+const bsl::uint16_t k_LINUX_TLS_CIPHER_AES_GCM_128       = 51;
+const bsl::uint16_t k_LINUX_TLS_CIPHER_AES_GCM_256       = 52;
+const bsl::uint16_t k_LINUX_TLS_CIPHER_CHACHA20_POLY1305 = 54;
+
+/// The layout of each 'struct tls12_crypto_info_*': the version and cipher
+/// type followed by the initialization vector, key, salt, and record
+/// sequence number, in that order, with sizes that depend on the cipher.
+struct LinuxTlsCryptoInfo {
+    bsl::uint16_t d_version;
+    bsl::uint16_t d_cipherType;
+    unsigned char d_data[12 + 32 + 4 + 8];
+};
+
+/// Encode the specified 'key' into the specified 'result'. Return the
+/// number of bytes of 'result' that are significant, or zero if the
+/// cipher of 'key' is not supported.
+socklen_t encodeTlsCryptoInfo(LinuxTlsCryptoInfo*        result,
+                              const ntsa::TlsSessionKey& key)
+{
+    bsl::memset(result, 0, sizeof *result);
+
+    result->d_version = key.version();
+
+    switch (key.cipher()) {
+    case ntsa::TlsSessionKey::e_AES_128_GCM:
+        result->d_cipherType = k_LINUX_TLS_CIPHER_AES_GCM_128;
+        break;
+    case ntsa::TlsSessionKey::e_AES_256_GCM:
+        result->d_cipherType = k_LINUX_TLS_CIPHER_AES_GCM_256;
+        break;
+    case ntsa::TlsSessionKey::e_CHACHA20_POLY1305:
+        result->d_cipherType = k_LINUX_TLS_CIPHER_CHACHA20_POLY1305;
+        break;
+    default:
+        return 0;
+    }
+
+    unsigned char* position = result->d_data;
+
+    bsl::memcpy(position,
+                key.initializationVector(),
+                key.initializationVectorSize());
+    position += key.initializationVectorSize();
+
+    bsl::memcpy(position, key.key(), key.keySize());
+    position += key.keySize();
+
+    bsl::memcpy(position, key.salt(), key.saltSize());
+    position += key.saltSize();
+
+    // The record sequence number is stored in network byte order.
+
+    const bsl::uint64_t recordSequence = key.recordSequence();
+    for (int i = 7; i >= 0; --i) {
+        *position++ =
+            static_cast<unsigned char>((recordSequence >> (i * 8)) & 0xFF);
+    }
+
+    return static_cast<socklen_t>(
+        offsetof(LinuxTlsCryptoInfo, d_data) +
+        static_cast<bsl::size_t>(position - result->d_data));
+}
+
+/// Install the specified 'key' for the specified 'direction', either
+/// 'k_LINUX_TLS_TX' or 'k_LINUX_TLS_RX', of the specified 'socket',
+/// attaching the "tls" upper layer protocol if necessary. Return the error.
+ntsa::Error installTlsKey(ntsa::Handle               socket,
+                          int                        direction,
+                          const ntsa::TlsSessionKey& key)
+{
+    if (!key.isValid()) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    int rc;
+
+    // Attach the "tls" upper layer protocol. Until a key is installed the
+    // socket continues to transfer data unmodified in that direction, so any
+    // failure here or when installing the key leaves the socket usable.
+
+    const char k_ULP[] = "tls";
+
+    rc = ::setsockopt(socket,
+                      IPPROTO_TCP,
+                      k_LINUX_TCP_ULP,
+                      k_ULP,
+                      static_cast<socklen_t>(sizeof k_ULP - 1));
+    if (rc != 0 && errno != EEXIST) {
+        return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+    }
+
+    LinuxTlsCryptoInfo cryptoInfo;
+    socklen_t          cryptoInfoSize;
+
+    cryptoInfoSize = encodeTlsCryptoInfo(&cryptoInfo, key);
+    if (cryptoInfoSize == 0) {
+        return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+    }
+
+    rc = ::setsockopt(socket,
+                      k_LINUX_SOL_TLS,
+                      direction,
+                      &cryptoInfo,
+                      cryptoInfoSize);
+
+    bsl::memset(&cryptoInfo, 0, sizeof cryptoInfo);
+
+    if (rc != 0) {
+        return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+    }
+
+    return ntsa::Error();
+}
+
+}  // close unnamed namespace
+
+#endif
+
+ntsa::Error SocketOptionUtil::setTlsTransmitOffload(
+    ntsa::Handle               socket,
+    const ntsa::TlsSessionKey& transmitKey)
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+    return installTlsKey(socket, k_LINUX_TLS_TX, transmitKey);
+
+#else
+
+    NTSCFG_WARNING_UNUSED(socket);
+    NTSCFG_WARNING_UNUSED(transmitKey);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+
+#endif
+}
+
+ntsa::Error SocketOptionUtil::setTlsReceiveOffload(
+    ntsa::Handle               socket,
+    const ntsa::TlsSessionKey& receiveKey)
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+    return installTlsKey(socket, k_LINUX_TLS_RX, receiveKey);
+
+#else
+
+    NTSCFG_WARNING_UNUSED(socket);
+    NTSCFG_WARNING_UNUSED(receiveKey);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+
+#endif
+}
+
 ntsa::Error SocketOptionUtil::setMulticastLoopback(ntsa::Handle socket,
                                                    bool         enabled)
 {
@@ -2337,6 +2691,53 @@ ntsa::Error SocketOptionUtil::getLastError(ntsa::Error* error,
     return ntsa::Error();
 }
 
+ntsa::Error SocketOptionUtil::getTcpInfo(ntsa::TcpInfo* result,
+                                         ntsa::Handle   socket)
+{
+    NTSCFG_WARNING_UNUSED(socket);
+
+    result->reset();
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error SocketOptionUtil::setTlsTransmitOffload(
+    ntsa::Handle               socket,
+    const ntsa::TlsSessionKey& transmitKey)
+{
+    NTSCFG_WARNING_UNUSED(socket);
+    NTSCFG_WARNING_UNUSED(transmitKey);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error SocketOptionUtil::setTlsReceiveOffload(
+    ntsa::Handle               socket,
+    const ntsa::TlsSessionKey& receiveKey)
+{
+    NTSCFG_WARNING_UNUSED(socket);
+    NTSCFG_WARNING_UNUSED(receiveKey);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error SocketOptionUtil::setUnsentLowWatermark(ntsa::Handle socket,
+                                                    bsl::size_t  size)
+{
+    NTSCFG_WARNING_UNUSED(socket);
+    NTSCFG_WARNING_UNUSED(size);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error SocketOptionUtil::getUnsentLowWatermark(bsl::size_t* size,
+                                                    ntsa::Handle socket)
+{
+    NTSCFG_WARNING_UNUSED(socket);
+
+    *size = 0;
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
 ntsa::Error SocketOptionUtil::setMulticastLoopback(ntsa::Handle socket,
                                                    bool         enabled)
 {
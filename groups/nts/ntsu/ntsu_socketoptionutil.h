@@ -23,6 +23,8 @@ BSLS_IDENT("$Id: $")
 #include <ntsa_error.h>
 #include <ntsa_handle.h>
 #include <ntsa_socketoption.h>
+#include <ntsa_tcpinfo.h>
+#include <ntsa_tlssessionkey.h>
 #include <ntscfg_platform.h>
 #include <ntsscm_version.h>
 #include <bsls_timeinterval.h>
@@ -142,6 +144,12 @@ struct SocketOptionUtil {
     /// flag. Return the error.
     static ntsa::Error setZeroCopy(ntsa::Handle socket, bool zeroCopy);
 
+    /// Set the option for the specified 'socket' that limits the amount of
+    /// data in the socket send buffer not yet sent for the socket to be
+    /// considered writable to the specified 'size'. Return the error.
+    static ntsa::Error setUnsentLowWatermark(ntsa::Handle socket,
+                                             bsl::size_t  size);
+
     /// Load into the specified 'option' the socket option of the specified
     /// 'type' for the specified 'socket'. Return the error.
     static ntsa::Error getOption(ntsa::SocketOption*           option,
@@ -230,6 +238,12 @@ struct SocketOptionUtil {
     static ntsa::Error getZeroCopy(bool*        zeroCopyFlag,
                                    ntsa::Handle socket);
 
+    /// Load into the specified 'size' the option for the specified 'socket'
+    /// that limits the amount of data in the socket send buffer not yet sent
+    /// for the socket to be considered writable. Return the error.
+    static ntsa::Error getUnsentLowWatermark(bsl::size_t* size,
+                                             ntsa::Handle socket);
+
     /// Load into the specified 'size' the option for the specified 'socket'
     /// that indicates the amount of space left in the send buffer. Return
     /// the error.
@@ -246,6 +260,38 @@ struct SocketOptionUtil {
     /// when connecting the socket. Return the error (retrieving the error).
     static ntsa::Error getLastError(ntsa::Error* error, ntsa::Handle socket);
 
+    /// Load into the specified 'result' the state of the TCP connection
+    /// of the specified 'socket' as measured by the operating system.
+    /// Return the error. Note that this function is only supported on
+    /// Linux; attributes not measured by the running kernel are left at
+    /// their default values.
+    static ntsa::Error getTcpInfo(ntsa::TcpInfo* result, ntsa::Handle socket);
+
+    /// Offload the encryption of the records sent by the established TLS
+    /// session on the specified 'socket' to the operating system, using the
+    /// specified 'transmitKey'. On success, subsequent data sent to
+    /// 'socket' is plaintext. Return the error. If the error is
+    /// e_NOT_IMPLEMENTED or e_INVALID the socket continues to send data
+    /// unmodified. Note that this function is only supported on Linux with
+    /// the "tls" upper layer protocol available.
+    static ntsa::Error setTlsTransmitOffload(
+        ntsa::Handle               socket,
+        const ntsa::TlsSessionKey& transmitKey);
+
+    /// Offload the decryption of the records received by the established
+    /// TLS session on the specified 'socket' to the operating system, using
+    /// the specified 'receiveKey'. On success, subsequent data received
+    /// from 'socket' is plaintext. Return the error. If the error is
+    /// e_NOT_IMPLEMENTED or e_INVALID the socket continues to receive data
+    /// unmodified. Note that records other than application data received
+    /// after the decryption is offloaded, such as a TLS 1.3
+    /// NewSessionTicket or KeyUpdate, fail the receive operation. Note that
+    /// this function is only supported on Linux with the "tls" upper layer
+    /// protocol available.
+    static ntsa::Error setTlsReceiveOffload(
+        ntsa::Handle               socket,
+        const ntsa::TlsSessionKey& receiveKey);
+
     /// Set the flag that indicates multicast datagrams should be looped
     /// back to the local host to the specified 'value'. Return the error.
     static ntsa::Error setMulticastLoopback(ntsa::Handle socket, bool enabled);
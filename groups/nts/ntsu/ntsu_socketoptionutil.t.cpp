@@ -14,12 +14,14 @@
 // limitations under the License.
 
 #include <ntsa_adapter.h>
+#include <ntsa_tlssessionkey.h>
 #include <ntscfg_test.h>
 #include <ntsu_adapterutil.h>
 #include <ntsu_socketoptionutil.h>
 #include <ntsu_socketutil.h>
 #include <ntsu_timestamputil.h>
 #include <bslma_testallocator.h>
+#include <bsl_cstring.h>
 #include <bsl_iostream.h>
 #include <bsl_vector.h>
 
@@ -49,6 +51,81 @@ using namespace BloombergLP;
 // [ 1]
 //-----------------------------------------------------------------------------
 
+namespace test {
+
+/// Load into the specified 'result' the keying material of a TLS 1.2
+/// session using AES-128-GCM whose bytes are derived from the specified
+/// 'seed', having the specified 'recordSequence'.
+void makeTlsSessionKey(ntsa::TlsSessionKey* result,
+                       unsigned char        seed,
+                       bsl::uint64_t        recordSequence)
+{
+    unsigned char key[16];
+    unsigned char initializationVector[8];
+    unsigned char salt[4];
+
+    for (bsl::size_t i = 0; i < sizeof key; ++i) {
+        key[i] = static_cast<unsigned char>(seed + i);
+    }
+
+    for (bsl::size_t i = 0; i < sizeof initializationVector; ++i) {
+        initializationVector[i] = static_cast<unsigned char>(seed ^ i);
+    }
+
+    for (bsl::size_t i = 0; i < sizeof salt; ++i) {
+        salt[i] = static_cast<unsigned char>(seed - i);
+    }
+
+    result->reset();
+    result->setVersion(0x0303);
+    result->setCipher(ntsa::TlsSessionKey::e_AES_128_GCM);
+    result->setKey(key, sizeof key);
+    result->setInitializationVector(initializationVector,
+                                    sizeof initializationVector);
+    result->setSalt(salt, sizeof salt);
+    result->setRecordSequence(recordSequence);
+
+    NTSCFG_TEST_TRUE(result->isValid());
+}
+
+/// Send the specified 'size' bytes of the specified 'data' to the specified
+/// 'socket'.
+void sendAll(ntsa::Handle socket, const void* data, bsl::size_t size)
+{
+    ntsa::SendContext context;
+    ntsa::SendOptions options;
+
+    ntsa::Error error =
+        ntsu::SocketUtil::send(&context, data, size, options, socket);
+    NTSCFG_TEST_OK(error);
+    NTSCFG_TEST_EQ(context.bytesSent(), size);
+}
+
+/// Receive exactly the specified 'size' bytes from the specified 'socket'
+/// into the specified 'data'.
+void receiveAll(ntsa::Handle socket, void* data, bsl::size_t size)
+{
+    bsl::size_t numBytesReceived = 0;
+
+    while (numBytesReceived < size) {
+        ntsa::ReceiveContext context;
+        ntsa::ReceiveOptions options;
+
+        ntsa::Error error = ntsu::SocketUtil::receive(
+            &context,
+            static_cast<char*>(data) + numBytesReceived,
+            size - numBytesReceived,
+            options,
+            socket);
+        NTSCFG_TEST_OK(error);
+        NTSCFG_TEST_GT(context.bytesReceived(), 0U);
+
+        numBytesReceived += context.bytesReceived();
+    }
+}
+
+}  // close namespace test
+
 NTSCFG_TEST_CASE(1)
 {
     // Concern: Socket options on TCP/IPv4 sockets, using the raw API.
@@ -570,6 +647,40 @@ NTSCFG_TEST_CASE(1)
             }
         }
 
+        // Test IPPROTO_TCP/TCP_NOTSENT_LOWAT.
+
+        {
+            const bsl::size_t INPUT[] = {16 * 1024, 128 * 1024};
+
+            for (bsl::size_t i = 0; i < sizeof INPUT / sizeof INPUT[0]; ++i) {
+                error = ntsu::SocketOptionUtil::setUnsentLowWatermark(
+                    socket,
+                    INPUT[i]);
+
+                NTSCFG_TEST_LOG_INFO << "setUnsentLowWatermark: " << error
+                                     << NTSCFG_TEST_LOG_END;
+
+                if (error) {
+                    NTSCFG_TEST_TRUE(error == ntsa::Error::e_INVALID ||
+                                     error == ntsa::Error::e_NOT_IMPLEMENTED);
+                }
+                else {
+                    bsl::size_t output;
+                    error = ntsu::SocketOptionUtil::getUnsentLowWatermark(
+                        &output,
+                        socket);
+                    if (error) {
+                        NTSCFG_TEST_TRUE(error == ntsa::Error::e_INVALID ||
+                                         error ==
+                                             ntsa::Error::e_NOT_IMPLEMENTED);
+                    }
+                    else {
+                        NTSCFG_TEST_EQ(output, INPUT[i]);
+                    }
+                }
+            }
+        }
+
         // Close the socket.
 
         ntsu::SocketUtil::close(socket);
@@ -1902,6 +2013,133 @@ NTSCFG_TEST_CASE(9)
     }
 }
 
+NTSCFG_TEST_CASE(10)
+{
+    // Concern: offload the encryption and decryption of TLS records
+
+    if (!ntsu::AdapterUtil::supportsIpv4()) {
+        return;
+    }
+
+    ntsa::Error error;
+
+    ntsa::Handle client;
+    ntsa::Handle server;
+
+    error = ntsu::SocketUtil::pair(&client,
+                                   &server,
+                                   ntsa::Transport::e_TCP_IPV4_STREAM);
+    NTSCFG_TEST_OK(error);
+
+    // The size of the header, explicit nonce, and authentication tag of a
+    // TLS 1.2 record encrypted using AES-128-GCM.
+
+    const bsl::size_t k_RECORD_OVERHEAD = 5 + 8 + 16;
+
+    const char k_REQUEST[]  = "Hello, world!";
+    const char k_RESPONSE[] = "Goodbye, world!";
+
+    ntsa::TlsSessionKey clientKey;
+    ntsa::TlsSessionKey serverKey;
+
+    // Offload the encryption of the records sent by the client.
+
+    test::makeTlsSessionKey(&clientKey, 0x10, 0);
+
+    error = ntsu::SocketOptionUtil::setTlsTransmitOffload(client, clientKey);
+    if (error == ntsa::Error::e_NOT_IMPLEMENTED) {
+        NTSCFG_TEST_LOG_WARN << "TLS offload is not supported"
+                             << NTSCFG_TEST_LOG_END;
+
+        ntsu::SocketUtil::close(client);
+        ntsu::SocketUtil::close(server);
+        return;
+    }
+
+    NTSCFG_TEST_OK(error);
+
+    // Send plaintext from the client and ensure the server receives a TLS
+    // application data record.
+
+    {
+        test::sendAll(client, k_REQUEST, sizeof k_REQUEST - 1);
+
+        bsl::vector<char> record(sizeof k_REQUEST - 1 + k_RECORD_OVERHEAD);
+        test::receiveAll(server, &record.front(), record.size());
+
+        NTSCFG_TEST_EQ(static_cast<unsigned char>(record[0]), 0x17);
+        NTSCFG_TEST_EQ(static_cast<unsigned char>(record[1]), 0x03);
+        NTSCFG_TEST_EQ(static_cast<unsigned char>(record[2]), 0x03);
+
+        NTSCFG_TEST_NE(bsl::memcmp(&record[5 + 8],
+                                   k_REQUEST,
+                                   sizeof k_REQUEST - 1),
+                       0);
+    }
+
+    // Offload the decryption of the records received by the server using
+    // the client's key, continuing from the record already received.
+
+    test::makeTlsSessionKey(&clientKey, 0x10, 1);
+
+    error = ntsu::SocketOptionUtil::setTlsReceiveOffload(server, clientKey);
+    if (error == ntsa::Error::e_NOT_IMPLEMENTED) {
+        NTSCFG_TEST_LOG_WARN << "TLS receive offload is not supported"
+                             << NTSCFG_TEST_LOG_END;
+
+        ntsu::SocketUtil::close(client);
+        ntsu::SocketUtil::close(server);
+        return;
+    }
+
+    NTSCFG_TEST_OK(error);
+
+    // Offload the encryption of the records sent by the server and the
+    // decryption of the records received by the client.
+
+    test::makeTlsSessionKey(&serverKey, 0x80, 0);
+
+    error = ntsu::SocketOptionUtil::setTlsTransmitOffload(server, serverKey);
+    NTSCFG_TEST_OK(error);
+
+    error = ntsu::SocketOptionUtil::setTlsReceiveOffload(client, serverKey);
+    NTSCFG_TEST_OK(error);
+
+    // Round-trip plaintext between the client and the server.
+
+    {
+        test::sendAll(client, k_REQUEST, sizeof k_REQUEST - 1);
+
+        char request[sizeof k_REQUEST - 1];
+        test::receiveAll(server, request, sizeof request);
+
+        NTSCFG_TEST_EQ(bsl::memcmp(request, k_REQUEST, sizeof request), 0);
+    }
+
+    {
+        test::sendAll(server, k_RESPONSE, sizeof k_RESPONSE - 1);
+
+        char response[sizeof k_RESPONSE - 1];
+        test::receiveAll(client, response, sizeof response);
+
+        NTSCFG_TEST_EQ(bsl::memcmp(response, k_RESPONSE, sizeof response),
+                       0);
+    }
+
+    // Ensure an invalid key is rejected.
+
+    {
+        ntsa::TlsSessionKey invalidKey;
+
+        error =
+            ntsu::SocketOptionUtil::setTlsTransmitOffload(client, invalidKey);
+        NTSCFG_TEST_ERROR(error, ntsa::Error::e_INVALID);
+    }
+
+    ntsu::SocketUtil::close(client);
+    ntsu::SocketUtil::close(server);
+}
+
 NTSCFG_TEST_DRIVER
 {
     NTSCFG_TEST_REGISTER(1);
@@ -1913,5 +2151,6 @@ NTSCFG_TEST_DRIVER
     NTSCFG_TEST_REGISTER(7);
     NTSCFG_TEST_REGISTER(8);
     NTSCFG_TEST_REGISTER(9);
+    NTSCFG_TEST_REGISTER(10);
 }
 NTSCFG_TEST_DRIVER_END;
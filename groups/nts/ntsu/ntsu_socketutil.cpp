@@ -1395,6 +1395,10 @@ ntsa::Error SocketUtil::send(ntsa::SendContext*       context,
     if (options.zeroCopy()) {
         sendFlags |= ntsu::ZeroCopyUtil::e_MSG_ZEROCOPY;
     }
+
+    if (options.more()) {
+        sendFlags |= MSG_MORE;
+    }
 #endif
 
     ssize_t sendmsgResult = ::sendmsg(socket, &msg, sendFlags);
@@ -1485,6 +1489,10 @@ ntsa::Error SocketUtil::send(ntsa::SendContext*       context,
     if (options.zeroCopy()) {
         sendFlags |= ntsu::ZeroCopyUtil::e_MSG_ZEROCOPY;
     }
+
+    if (options.more()) {
+        sendFlags |= MSG_MORE;
+    }
 #endif
 
     ssize_t sendmsgResult = ::sendmsg(socket, &msg, sendFlags);
@@ -1572,6 +1580,10 @@ ntsa::Error SocketUtil::send(ntsa::SendContext*       context,
     if (options.zeroCopy()) {
         sendFlags |= ntsu::ZeroCopyUtil::e_MSG_ZEROCOPY;
     }
+
+    if (options.more()) {
+        sendFlags |= MSG_MORE;
+    }
 #endif
 
     ssize_t sendmsgResult = ::sendmsg(socket, &msg, sendFlags);
@@ -1658,6 +1670,10 @@ ntsa::Error SocketUtil::send(ntsa::SendContext*            context,
     if (options.zeroCopy()) {
         sendFlags |= ntsu::ZeroCopyUtil::e_MSG_ZEROCOPY;
     }
+
+    if (options.more()) {
+        sendFlags |= MSG_MORE;
+    }
 #endif
 
     ssize_t sendmsgResult = ::sendmsg(socket, &msg, sendFlags);
@@ -1744,6 +1760,10 @@ ntsa::Error SocketUtil::send(ntsa::SendContext*               context,
     if (options.zeroCopy()) {
         sendFlags |= ntsu::ZeroCopyUtil::e_MSG_ZEROCOPY;
     }
+
+    if (options.more()) {
+        sendFlags |= MSG_MORE;
+    }
 #endif
 
     ssize_t sendmsgResult = ::sendmsg(socket, &msg, sendFlags);
@@ -1834,6 +1854,10 @@ ntsa::Error SocketUtil::send(ntsa::SendContext*         context,
     if (options.zeroCopy()) {
         sendFlags |= ntsu::ZeroCopyUtil::e_MSG_ZEROCOPY;
     }
+
+    if (options.more()) {
+        sendFlags |= MSG_MORE;
+    }
 #endif
 
     ssize_t sendmsgResult = ::sendmsg(socket, &msg, sendFlags);
@@ -1921,6 +1945,10 @@ ntsa::Error SocketUtil::send(ntsa::SendContext*         context,
     if (options.zeroCopy()) {
         sendFlags |= ntsu::ZeroCopyUtil::e_MSG_ZEROCOPY;
     }
+
+    if (options.more()) {
+        sendFlags |= MSG_MORE;
+    }
 #endif
 
     ssize_t sendmsgResult = ::sendmsg(socket, &msg, sendFlags);
@@ -2007,6 +2035,10 @@ ntsa::Error SocketUtil::send(ntsa::SendContext*              context,
     if (options.zeroCopy()) {
         sendFlags |= ntsu::ZeroCopyUtil::e_MSG_ZEROCOPY;
     }
+
+    if (options.more()) {
+        sendFlags |= MSG_MORE;
+    }
 #endif
 
     ssize_t sendmsgResult = ::sendmsg(socket, &msg, sendFlags);
@@ -2092,6 +2124,10 @@ ntsa::Error SocketUtil::send(ntsa::SendContext*                 context,
     if (options.zeroCopy()) {
         sendFlags |= ntsu::ZeroCopyUtil::e_MSG_ZEROCOPY;
     }
+
+    if (options.more()) {
+        sendFlags |= MSG_MORE;
+    }
 #endif
 
     ssize_t sendmsgResult = ::sendmsg(socket, &msg, sendFlags);
@@ -2181,6 +2217,10 @@ ntsa::Error SocketUtil::send(ntsa::SendContext*       context,
     if (options.zeroCopy()) {
         sendFlags |= ntsu::ZeroCopyUtil::e_MSG_ZEROCOPY;
     }
+
+    if (options.more()) {
+        sendFlags |= MSG_MORE;
+    }
 #endif
 
     ssize_t sendmsgResult = ::sendmsg(socket, &msg, sendFlags);
@@ -2304,6 +2344,10 @@ ntsa::Error SocketUtil::send(ntsa::SendContext*       context,
     if (options.zeroCopy()) {
         sendFlags |= ntsu::ZeroCopyUtil::e_MSG_ZEROCOPY;
     }
+
+    if (options.more()) {
+        sendFlags |= MSG_MORE;
+    }
 #endif
 
     ssize_t sendmsgResult = ::sendmsg(socket, &msg, sendFlags);
@@ -2394,6 +2438,10 @@ ntsa::Error SocketUtil::send(ntsa::SendContext*       context,
     if (options.zeroCopy()) {
         sendFlags |= ntsu::ZeroCopyUtil::e_MSG_ZEROCOPY;
     }
+
+    if (options.more()) {
+        sendFlags |= MSG_MORE;
+    }
 #endif
 
     ssize_t sendmsgResult = ::sendmsg(socket, &msg, sendFlags);
@@ -151,6 +151,13 @@ function(bdeproj_project_process_uors proj listDir)
                 ${listDir}/examples/m_ntsu08
             )
         endif()
+
+        if (${NTF_BUILD_WITH_APPLICATIONS})
+            bde_project_process_applications(
+                ${proj}
+                ${listDir}/applications/m_ntsbench
+            )
+        endif()
     endif()
 
     if (${NTF_BUILD_WITH_NTC})
@@ -178,6 +185,16 @@ function(bdeproj_project_process_uors proj listDir)
                 ${listDir}/examples/m_ntcu14
             )
         endif()
+
+        if (${NTF_BUILD_WITH_APPLICATIONS})
+            bde_project_process_applications(
+                ${proj}
+                ${listDir}/applications/m_ntcbench
+                ${listDir}/applications/m_ntcflightrecorder
+                ${listDir}/applications/m_ntcloadclient
+                ${listDir}/applications/m_ntcloadserver
+            )
+        endif()
     endif()
 
 endfunction()
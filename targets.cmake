@@ -153,6 +153,8 @@ if (${NTF_BUILD_WITH_NTS})
     ntf_component(NAME ntsa_socketinfo)
     ntf_component(NAME ntsa_socketinfofilter)
     ntf_component(NAME ntsa_socketstate)
+    ntf_component(NAME ntsa_tcpinfo)
+    ntf_component(NAME ntsa_tlssessionkey)
     ntf_component(NAME ntsa_temporary)
     ntf_component(NAME ntsa_transport)
     ntf_component(NAME ntsa_timestamp)
@@ -344,12 +346,14 @@ if (${NTF_BUILD_WITH_NTC})
     ntf_component(NAME ntccfg_foreach)
     ntf_component(NAME ntccfg_function)
     ntf_component(NAME ntccfg_inline)
+    ntf_component(NAME ntccfg_inplacefunction)
     ntf_component(NAME ntccfg_likely)
     ntf_component(NAME ntccfg_limits)
     ntf_component(NAME ntccfg_lock)
     ntf_component(NAME ntccfg_object)
     ntf_component(NAME ntccfg_platform)
     ntf_component(NAME ntccfg_test)
+    ntf_component(NAME ntccfg_tracepoint)
     ntf_component(NAME ntccfg_traits)
     ntf_component(NAME ntccfg_tune)
 
@@ -440,6 +444,8 @@ if (${NTF_BUILD_WITH_NTC})
     ntf_component(NAME ntca_readqueueevent)
     ntf_component(NAME ntca_readqueueeventtype)
     ntf_component(NAME ntca_receivetoken)
+    ntf_component(NAME ntca_receiveframertype)
+    ntf_component(NAME ntca_receiveframer)
     ntf_component(NAME ntca_receiveoptions)
     ntf_component(NAME ntca_receivecontext)
     ntf_component(NAME ntca_receiveevent)
@@ -553,8 +559,10 @@ if (${NTF_BUILD_WITH_NTC})
     ntf_component(NAME ntci_reactormetrics)
     ntf_component(NAME ntci_reactorpool)
     ntf_component(NAME ntci_reactorsocket)
+    ntf_component(NAME ntci_receivebatchcallback)
     ntf_component(NAME ntci_receivecallback)
     ntf_component(NAME ntci_receivecallbackfactory)
+    ntf_component(NAME ntci_receiveframer)
     ntf_component(NAME ntci_receivefuture)
     ntf_component(NAME ntci_receiveresult)
     ntf_component(NAME ntci_receiver)
@@ -611,6 +619,8 @@ if (${NTF_BUILD_WITH_NTC})
     ntf_component(NAME ntcm_logpublisher)
     ntf_component(NAME ntcm_monitorableregistry)
     ntf_component(NAME ntcm_monitorableutil)
+    ntf_component(NAME ntcm_openmetricspublisher)
+    ntf_component(NAME ntcm_openmetricsserver)
     ntf_component(NAME ntcm_periodiccollector)
 
     ntf_package_end(NAME ntcm)
@@ -634,6 +644,7 @@ if (${NTF_BUILD_WITH_NTC})
     ntf_component(NAME ntcs_blobutil)
     ntf_component(NAME ntcs_callbackstate)
     ntf_component(NAME ntcs_chronology)
+    ntf_component(NAME ntcs_chronologymetrics)
     ntf_component(NAME ntcs_compat)
     ntf_component(NAME ntcs_controller)
     ntf_component(NAME ntcs_datapool)
@@ -641,6 +652,7 @@ if (${NTF_BUILD_WITH_NTC})
     ntf_component(NAME ntcs_dispatch)
     ntf_component(NAME ntcs_driver)
     ntf_component(NAME ntcs_event)
+    ntf_component(NAME ntcs_flightrecorder)
     ntf_component(NAME ntcs_flowcontrolcontext)
     ntf_component(NAME ntcs_flowcontrolstate)
     ntf_component(NAME ntcs_global)
@@ -651,6 +663,7 @@ if (${NTF_BUILD_WITH_NTC})
     ntf_component(NAME ntcs_memorymap)
     ntf_component(NAME ntcs_metrics)
     ntf_component(NAME ntcs_nomenclature)
+    ntf_component(NAME ntcs_numautil)
     ntf_component(NAME ntcs_observer)
     ntf_component(NAME ntcs_openstate)
     ntf_component(NAME ntcs_plugin)
@@ -661,6 +674,7 @@ if (${NTF_BUILD_WITH_NTC})
     ntf_component(NAME ntcs_processstatistics)
     ntf_component(NAME ntcs_ratelimiter)
     ntf_component(NAME ntcs_reactormetrics)
+    ntf_component(NAME ntcs_receiveframer)
     ntf_component(NAME ntcs_registry)
     ntf_component(NAME ntcs_reservation)
     ntf_component(NAME ntcs_shutdowncontext)
@@ -668,6 +682,7 @@ if (${NTF_BUILD_WITH_NTC})
     ntf_component(NAME ntcs_skiplist)
     ntf_component(NAME ntcs_strand)
     ntf_component(NAME ntcs_threadutil)
+    ntf_component(NAME ntcs_watchdog)
     ntf_component(NAME ntcs_watermarks)
     ntf_component(NAME ntcs_watermarkutil)
     ntf_component(NAME ntcs_user)
@@ -710,6 +725,7 @@ if (${NTF_BUILD_WITH_NTC})
         PRIVATE
     )
 
+    ntf_component(NAME ntcd_benchmarkutil)
     ntf_component(NAME ntcd_datagramsocket)
     ntf_component(NAME ntcd_datautil)
     ntf_component(NAME ntcd_encryption)
@@ -920,6 +936,67 @@ if (${NTF_BUILD_WITH_USAGE_EXAMPLES})
     endif()
 endif()
 
+if (${NTF_BUILD_WITH_APPLICATIONS})
+    if (${NTF_BUILD_WITH_NTS})
+        ntf_executable(
+            NAME
+                ntsbench
+            PATH
+                applications/m_ntsbench
+            REQUIRES
+                nts
+            PRIVATE)
+
+        ntf_executable_end(NAME ntsbench)
+    endif()
+
+    if (${NTF_BUILD_WITH_NTC})
+        ntf_executable(
+            NAME
+                ntcbench
+            PATH
+                applications/m_ntcbench
+            REQUIRES
+                ntc nts
+            PRIVATE)
+
+        ntf_executable_end(NAME ntcbench)
+
+        ntf_executable(
+            NAME
+                ntcflightrecorder
+            PATH
+                applications/m_ntcflightrecorder
+            REQUIRES
+                ntc nts
+            PRIVATE)
+
+        ntf_executable_end(NAME ntcflightrecorder)
+
+        ntf_executable(
+            NAME
+                ntcloadclient
+            PATH
+                applications/m_ntcloadclient
+            REQUIRES
+                ntc nts
+            PRIVATE)
+
+        ntf_executable_end(NAME ntcloadclient)
+
+        ntf_executable(
+            NAME
+                ntcloadserver
+            PATH
+                applications/m_ntcloadserver
+            REQUIRES
+                ntc nts
+            PRIVATE)
+
+        ntf_executable_end(NAME ntcloadserver)
+    endif()
+endif()
+
 if (VERBOSE)
     ntf_target_dump(bsl)
     ntf_target_dump(bdl)
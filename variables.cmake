@@ -263,6 +263,18 @@ if (NOT DEFINED NTF_BUILD_WITH_USAGE_EXAMPLES)
     endif()
 endif()
 
+if (NOT DEFINED NTF_BUILD_WITH_APPLICATIONS)
+    if (DEFINED NTF_CONFIGURE_WITH_APPLICATIONS)
+        set(NTF_BUILD_WITH_APPLICATIONS
+            ${NTF_CONFIGURE_WITH_APPLICATIONS} CACHE INTERNAL "")
+    elseif (DEFINED ENV{NTF_CONFIGURE_WITH_APPLICATIONS})
+        set(NTF_BUILD_WITH_APPLICATIONS
+            $ENV{NTF_CONFIGURE_WITH_APPLICATIONS} CACHE INTERNAL "")
+    else()
+        set(NTF_BUILD_WITH_APPLICATIONS TRUE CACHE INTERNAL "")
+    endif()
+endif()
+
 if (NOT DEFINED NTF_BUILD_WITH_MOCKS)
     if (DEFINED NTF_CONFIGURE_WITH_MOCKS)
         set(NTF_BUILD_WITH_MOCKS
@@ -608,6 +620,22 @@ if (NOT DEFINED NTF_BUILD_WITH_METRICS)
     endif()
 endif()
 
+if (NOT DEFINED NTF_BUILD_WITH_TRACEPOINTS)
+    if (DEFINED NTF_CONFIGURE_WITH_TRACEPOINTS)
+        set(NTF_BUILD_WITH_TRACEPOINTS
+            ${NTF_CONFIGURE_WITH_TRACEPOINTS} CACHE INTERNAL "")
+    elseif (DEFINED ENV{NTF_CONFIGURE_WITH_TRACEPOINTS})
+        set(NTF_BUILD_WITH_TRACEPOINTS
+            $ENV{NTF_CONFIGURE_WITH_TRACEPOINTS} CACHE INTERNAL "")
+    else()
+        if(${CMAKE_SYSTEM_NAME} STREQUAL "Linux")
+            set(NTF_BUILD_WITH_TRACEPOINTS TRUE CACHE INTERNAL "")
+        else()
+            set(NTF_BUILD_WITH_TRACEPOINTS FALSE CACHE INTERNAL "")
+        endif()
+    endif()
+endif()
+
 if (NOT DEFINED NTF_BUILD_WITH_BRANCH_PREDICTION)
     if (DEFINED NTF_CONFIGURE_WITH_BRANCH_PREDICTION)
         set(NTF_BUILD_WITH_BRANCH_PREDICTION
@@ -709,6 +737,12 @@ else()
     message(STATUS "NTF: Building with usage examples:              no")
 endif()
 
+if (${NTF_BUILD_WITH_APPLICATIONS})
+    message(STATUS "NTF: Building with applications:                yes")
+else()
+    message(STATUS "NTF: Building with applications:                no")
+endif()
+
 if (${NTF_BUILD_WITH_MOCKS})
     message(STATUS "NTF: Building with mocks:                       yes")
 else()
@@ -859,6 +893,12 @@ else()
     message(STATUS "NTF: Building with metrics:                     no")
 endif()
 
+if (${NTF_BUILD_WITH_TRACEPOINTS})
+    message(STATUS "NTF: Building with tracepoints:                 yes")
+else()
+    message(STATUS "NTF: Building with tracepoints:                 no")
+endif()
+
 if (${NTF_BUILD_WITH_BRANCH_PREDICTION})
     message(STATUS "NTF: Building with branch prediction:           yes")
 else()